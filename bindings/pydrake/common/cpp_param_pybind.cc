@@ -7,7 +7,8 @@ namespace pydrake {
 
 // N.B. py::handle::inc_ref() and ::dec_ref() use the Py_X* variants, implying
 // that they are safe to use on nullptr, thus we do not need any
-// `ptr != nullptr` checks.
+// `ptr != nullptr` checks for the reference counting itself. We do check it
+// before acquiring the GIL, so that empty objects remain cheap to use.
 Object::Object(::PyObject* ptr) : ptr_(ptr) {
   inc_ref();
 }
@@ -31,10 +32,17 @@ Object& Object::operator=(Object&& other) {
   other.ptr_ = nullptr;
   return *this;
 }
+// Since an Object may be copied or destroyed in C++ code that has released
+// the GIL (e.g., while a Simulator copies abstract values during AdvanceTo),
+// the reference counting must (re)acquire it.
 void Object::inc_ref() {
+  if (ptr_ == nullptr) return;
+  py::gil_scoped_acquire guard;
   py::handle(ptr_).inc_ref();
 }
 void Object::dec_ref() {
+  if (ptr_ == nullptr) return;
+  py::gil_scoped_acquire guard;
   py::handle(ptr_).dec_ref();
 }
 
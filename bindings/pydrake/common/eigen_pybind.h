@@ -19,6 +19,17 @@ auto ToEigenRef(Eigen::VectorBlock<Derived>* derived) {
   return Eigen::Ref<Derived>(*derived);
 }
 
+/**
+Provides a read-only Ref<> for a const block, so that it is cast to a read-only
+view of the block's data rather than to a copy of it (for `T = double`).
+Meant to be used for decorating methods passed to `pybind11` (e.g. virtual
+function dispatch); the view is only valid for the duration of the call.
+*/
+template <typename Derived>
+auto ToEigenRef(const Eigen::VectorBlock<const Derived>& derived) {
+  return Eigen::Ref<const Derived>(derived);
+}
+
 /** Converts a raw array to a numpy array. */
 template <typename T>
 py::object ToArray(T* ptr, int size, py::tuple shape) {
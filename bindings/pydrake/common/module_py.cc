@@ -121,6 +121,13 @@ PYBIND11_MODULE(_module_py, m) {
       .def(py::init<RandomGenerator::result_type>(),
           "Constructs the engine and initializes the state with a given "
           "value.")
+      .def_static("MakeCounterBased", &RandomGenerator::MakeCounterBased,
+          py::arg("seed"), py::arg("stream") = 0,
+          doc.RandomGenerator.MakeCounterBased.doc)
+      .def("is_counter_based", &RandomGenerator::is_counter_based,
+          doc.RandomGenerator.is_counter_based.doc)
+      .def("Split", &RandomGenerator::Split, py::arg("index"),
+          doc.RandomGenerator.Split.doc)
       .def(
           "__call__", [](RandomGenerator& self) { return self(); },
           "Generates a pseudo-random value.");
@@ -54,6 +54,13 @@ class TestCommon(unittest.TestCase):
         self.assertEqual(g1(), 3499211612)
         g2 = mut.RandomGenerator(10)
         self.assertEqual(g2(), 3312796937)
+        self.assertFalse(g2.is_counter_based())
+        g3 = mut.RandomGenerator.MakeCounterBased(seed=0, stream=0)
+        self.assertTrue(g3.is_counter_based())
+        self.assertEqual(g3(), 0x6627e8d5)
+        g4 = g3.Split(index=1)
+        self.assertTrue(g4.is_counter_based())
+        self.assertEqual(g4(), g3.Split(index=1)())
 
     def test_assert_is_armed(self):
         self.assertIsInstance(mut.kDrakeAssertIsArmed, bool)
@@ -39,6 +39,9 @@ class pylogging_sink final : public spdlog::sinks::base_sink<std::mutex> {
 
  protected:
   void sink_it_(const spdlog::details::log_msg& msg) override {
+    // Messages may be logged from C++ code that has released the GIL (e.g.,
+    // Simulator.AdvanceTo), possibly from several threads at once.
+    py::gil_scoped_acquire guard;
     spdlog::memory_buf_t formatted;
     spdlog::sinks::base_sink<std::mutex>::formatter_->format(msg, formatted);
     // Use CRITICAL level to ensure that messages will always be logged.
@@ -21,6 +21,8 @@ class PyObjectValue : public drake::Value<Object> {
   using Base::Base;
   // Override `Clone()` to perform a deep copy on the object.
   std::unique_ptr<AbstractValue> Clone() const override {
+    // This may be called from C++ code that has released the GIL.
+    py::gil_scoped_acquire guard;
     py::object py_copy = py::module::import("copy").attr("deepcopy");
     py::object copied = py_copy(get_value().to_pyobject<py::object>());
     return std::make_unique<PyObjectValue>(Object::from_pyobject(copied));
@@ -106,7 +106,25 @@ void def_geometry_render(py::module m) {
       .def_readwrite("default_diffuse", &RenderEngineVtkParams::default_diffuse,
           doc.RenderEngineVtkParams.default_diffuse.doc);
 
-  m.def("MakeRenderEngineGl", &MakeRenderEngineGl, doc.MakeRenderEngineGl.doc);
+  py::class_<RenderEngineGlParams>(
+      m, "RenderEngineGlParams", doc.RenderEngineGlParams.doc)
+      .def(ParamInit<RenderEngineGlParams>())
+      .def_readwrite("pipelined_readback",
+          &RenderEngineGlParams::pipelined_readback,
+          doc.RenderEngineGlParams.pipelined_readback.doc)
+      .def_readwrite("default_diffuse", &RenderEngineGlParams::default_diffuse,
+          doc.RenderEngineGlParams.default_diffuse.doc)
+      .def_readwrite("default_clear_color",
+          &RenderEngineGlParams::default_clear_color,
+          doc.RenderEngineGlParams.default_clear_color.doc)
+      .def_readwrite("egl_device", &RenderEngineGlParams::egl_device,
+          doc.RenderEngineGlParams.egl_device.doc);
+
+  m.def("MakeRenderEngineGl", &MakeRenderEngineGl,
+      py::arg("params") = RenderEngineGlParams(), doc.MakeRenderEngineGl.doc);
+
+  m.def("GetRenderEngineGlDeviceCount", &GetRenderEngineGlDeviceCount,
+      doc.GetRenderEngineGlDeviceCount.doc);
 
   m.def("MakeRenderEngineVtk", &MakeRenderEngineVtk, py::arg("params"),
       doc.MakeRenderEngineVtk.doc);
@@ -444,6 +462,10 @@ void DoScalarDependentDefinitions(py::module m, T) {
             &QueryObject<T>::ComputeSignedDistanceToPoint, py::arg("p_WQ"),
             py::arg("threshold") = std::numeric_limits<double>::infinity(),
             doc.QueryObject.ComputeSignedDistanceToPoint.doc)
+        .def("ComputeSignedDistanceToPoints",
+            &QueryObject<T>::ComputeSignedDistanceToPoints, py::arg("p_WQs"),
+            py::arg("threshold") = std::numeric_limits<double>::infinity(),
+            doc.QueryObject.ComputeSignedDistanceToPoints.doc)
         .def("FindCollisionCandidates",
             &QueryObject<T>::FindCollisionCandidates,
             doc.QueryObject.FindCollisionCandidates.doc)
@@ -310,6 +310,13 @@ void DoScalarIndependentDefinitions(py::module m) {
               const Eigen::Ref<const MatrixX<T>>&,
               const Eigen::Ref<const VectorX<T>>&>(&BarycentricMesh<T>::Eval),
           doc.BarycentricMesh.Eval.doc_2args)
+      .def("EvalBatch",
+          overload_cast_explicit<MatrixX<T>,
+              const Eigen::Ref<const MatrixX<T>>&,
+              const Eigen::Ref<const MatrixX<T>>&>(
+              &BarycentricMesh<T>::EvalBatch),
+          py::arg("mesh_values"), py::arg("inputs"),
+          doc.BarycentricMesh.EvalBatch.doc_2args)
       .def("MeshValuesFrom", &BarycentricMesh<T>::MeshValuesFrom,
           doc.BarycentricMesh.MeshValuesFrom.doc);
 
@@ -14,9 +14,11 @@
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/batch_dynamics_evaluator.h"
 #include "drake/multibody/plant/contact_results.h"
 #include "drake/multibody/plant/contact_results_to_lcm.h"
 #include "drake/multibody/plant/externally_applied_spatial_force.h"
+#include "drake/multibody/plant/forward_kinematics_evaluator.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/point_pair_contact_info.h"
 #include "drake/multibody/plant/propeller.h"
@@ -1035,6 +1037,125 @@ void DoScalarDependentDefinitions(py::module m, T) {
             &Class::get_spatial_forces_output_port, py_rvp::reference_internal,
             doc.Propeller.get_spatial_forces_output_port.doc);
   }
+
+  // N.B. The batch methods below release the GIL while they compute, so that
+  // they may also be called from several Python threads in parallel.
+
+  // ForwardKinematicsEvaluator
+  {
+    using Class = ForwardKinematicsEvaluator<T>;
+    constexpr auto& cls_doc = doc.ForwardKinematicsEvaluator;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "ForwardKinematicsEvaluator", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<const MultibodyPlant<T>*>(), py::arg("plant"),
+            // Keep alive, reference: `self` keeps `plant` alive.
+            py::keep_alive<1, 2>(), cls_doc.ctor.doc)
+        .def("plant", &Class::plant, py_rvp::reference_internal,
+            cls_doc.plant.doc)
+        .def("set_num_threads", &Class::set_num_threads,
+            py::arg("num_threads"), cls_doc.set_num_threads.doc)
+        .def("num_threads", &Class::num_threads, cls_doc.num_threads.doc)
+        .def(
+            "CalcBodyPosesInWorld",
+            [](Class* self, const Eigen::Ref<const VectorX<T>>& q) {
+              std::vector<math::RigidTransform<T>> X_WB;
+              self->CalcBodyPosesInWorld(q, &X_WB);
+              return X_WB;
+            },
+            py::arg("q"), cls_doc.CalcBodyPosesInWorld.doc)
+        .def(
+            "BatchCalcBodyPosesInWorld",
+            [](Class* self, const Eigen::Ref<const MatrixX<T>>& q_samples) {
+              std::vector<math::RigidTransform<T>> X_WB;
+              self->BatchCalcBodyPosesInWorld(q_samples, &X_WB);
+              return X_WB;
+            },
+            py::arg("q_samples"), py::call_guard<py::gil_scoped_release>(),
+            cls_doc.BatchCalcBodyPosesInWorld.doc);
+  }
+
+  // BatchDynamicsEvaluator
+  {
+    using Class = BatchDynamicsEvaluator<T>;
+    constexpr auto& cls_doc = doc.BatchDynamicsEvaluator;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "BatchDynamicsEvaluator", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<const MultibodyPlant<T>*>(), py::arg("plant"),
+            // Keep alive, reference: `self` keeps `plant` alive.
+            py::keep_alive<1, 2>(), cls_doc.ctor.doc)
+        .def("plant", &Class::plant, py_rvp::reference_internal,
+            cls_doc.plant.doc)
+        .def("set_num_threads", &Class::set_num_threads,
+            py::arg("num_threads"), cls_doc.set_num_threads.doc)
+        .def("num_threads", &Class::num_threads, cls_doc.num_threads.doc)
+        .def(
+            "BatchCalcMassMatrix",
+            [](Class* self, const Eigen::Ref<const MatrixX<T>>& q_samples) {
+              std::vector<MatrixX<T>> M;
+              self->BatchCalcMassMatrix(q_samples, &M);
+              return M;
+            },
+            py::arg("q_samples"), py::call_guard<py::gil_scoped_release>(),
+            cls_doc.BatchCalcMassMatrix.doc)
+        .def(
+            "BatchCalcInverseDynamics",
+            [](Class* self, const Eigen::Ref<const MatrixX<T>>& q_samples,
+                const Eigen::Ref<const MatrixX<T>>& v_samples,
+                const Eigen::Ref<const MatrixX<T>>& vdot_samples) {
+              MatrixX<T> tau;
+              self->BatchCalcInverseDynamics(
+                  q_samples, v_samples, vdot_samples, &tau);
+              return tau;
+            },
+            py::arg("q_samples"), py::arg("v_samples"),
+            py::arg("vdot_samples"), py::call_guard<py::gil_scoped_release>(),
+            cls_doc.BatchCalcInverseDynamics.doc)
+        .def(
+            "BatchCalcForwardDynamics",
+            [](Class* self, const Eigen::Ref<const MatrixX<T>>& q_samples,
+                const Eigen::Ref<const MatrixX<T>>& v_samples,
+                const Eigen::Ref<const MatrixX<T>>& tau_samples) {
+              MatrixX<T> vdot;
+              self->BatchCalcForwardDynamics(
+                  q_samples, v_samples, tau_samples, &vdot);
+              return vdot;
+            },
+            py::arg("q_samples"), py::arg("v_samples"),
+            py::arg("tau_samples"), py::call_guard<py::gil_scoped_release>(),
+            cls_doc.BatchCalcForwardDynamics.doc)
+        .def(
+            "BatchCalcSemiExplicitEulerStep",
+            [](Class* self, double h,
+                const Eigen::Ref<const MatrixX<T>>& q_samples,
+                const Eigen::Ref<const MatrixX<T>>& v_samples,
+                const Eigen::Ref<const MatrixX<T>>& tau_samples) {
+              MatrixX<T> x_next;
+              self->BatchCalcSemiExplicitEulerStep(
+                  h, q_samples, v_samples, tau_samples, &x_next);
+              return x_next;
+            },
+            py::arg("h"), py::arg("q_samples"), py::arg("v_samples"),
+            py::arg("tau_samples"), py::call_guard<py::gil_scoped_release>(),
+            cls_doc.BatchCalcSemiExplicitEulerStep.doc)
+        .def(
+            "BatchCalcJacobianSpatialVelocity",
+            [](Class* self, const Eigen::Ref<const MatrixX<T>>& q_samples,
+                JacobianWrtVariable with_respect_to, const Frame<T>& frame_B,
+                const Eigen::Ref<const Vector3<T>>& p_BP,
+                const Frame<T>& frame_A, const Frame<T>& frame_E) {
+              std::vector<MatrixX<T>> Js_V_ABp_E;
+              self->BatchCalcJacobianSpatialVelocity(q_samples,
+                  with_respect_to, frame_B, p_BP, frame_A, frame_E,
+                  &Js_V_ABp_E);
+              return Js_V_ABp_E;
+            },
+            py::arg("q_samples"), py::arg("with_respect_to"),
+            py::arg("frame_B"), py::arg("p_BP"), py::arg("frame_A"),
+            py::arg("frame_E"), py::call_guard<py::gil_scoped_release>(),
+            cls_doc.BatchCalcJacobianSpatialVelocity.doc);
+  }
   // NOLINTNEXTLINE(readability/fn_size)
 }
 }  // namespace
@@ -1058,15 +1179,31 @@ PYBIND11_MODULE(plant, m) {
 
   using T = double;
 
+  {
+    using Class = HydroelasticContactVisualizationDetail;
+    constexpr auto& cls_doc = doc.HydroelasticContactVisualizationDetail;
+    py::enum_<Class>(m, "HydroelasticContactVisualizationDetail", cls_doc.doc)
+        .value("kFull", Class::kFull, cls_doc.kFull.doc)
+        .value("kNoQuadraturePoints", Class::kNoQuadraturePoints,
+            cls_doc.kNoQuadraturePoints.doc)
+        .value("kWrenchOnly", Class::kWrenchOnly, cls_doc.kWrenchOnly.doc);
+  }
+
   // ContactResultsToLcmSystem
   {
     using Class = ContactResultsToLcmSystem<T>;
     constexpr auto& cls_doc = doc.ContactResultsToLcmSystem;
     py::class_<Class, systems::LeafSystem<T>>(
         m, "ContactResultsToLcmSystem", cls_doc.doc)
-        .def(py::init<const MultibodyPlant<T>&>(), py::arg("plant"),
+        .def(py::init<const MultibodyPlant<T>&,
+                 HydroelasticContactVisualizationDetail>(),
+            py::arg("plant"),
+            py::arg("hydroelastic_detail") =
+                HydroelasticContactVisualizationDetail::kFull,
             // Keep alive, reference: `self` keeps `plant` alive.
             py::keep_alive<1, 2>(), cls_doc.ctor.doc)
+        .def("hydroelastic_detail", &Class::hydroelastic_detail,
+            cls_doc.hydroelastic_detail.doc)
         .def("get_contact_result_input_port",
             &Class::get_contact_result_input_port, py_rvp::reference_internal,
             cls_doc.get_contact_result_input_port.doc)
@@ -50,6 +50,7 @@ from pydrake.multibody.math import (
 )
 from pydrake.multibody.plant import (
     AddMultibodyPlantSceneGraph,
+    BatchDynamicsEvaluator_,
     CalcContactFrictionFromSurfaceProperties,
     ConnectContactResultsToDrakeVisualizer,
     ContactModel,
@@ -57,6 +58,8 @@ from pydrake.multibody.plant import (
     ContactResultsToLcmSystem,
     CoulombFriction_,
     ExternallyAppliedSpatialForce_,
+    ForwardKinematicsEvaluator_,
+    HydroelasticContactVisualizationDetail,
     MultibodyPlant_,
     PointPairContactInfo_,
     PropellerInfo,
@@ -1614,6 +1617,10 @@ class TestPlant(unittest.TestCase):
         contact_results_to_lcm.CalcOutput(context, output)
         result = output.get_data(0)
         self.assertIsInstance(result, AbstractValue)
+        detail = HydroelasticContactVisualizationDetail.kWrenchOnly
+        contact_results_to_lcm = ContactResultsToLcmSystem(
+            plant=plant, hydroelastic_detail=detail)
+        self.assertEqual(contact_results_to_lcm.hydroelastic_detail(), detail)
 
     def test_connect_contact_results(self):
         DiagramBuilder = DiagramBuilder_[float]
@@ -1747,3 +1754,66 @@ class TestPlant(unittest.TestCase):
 
         prop2 = Propeller_[float]([info, info])
         self.assertEqual(prop2.num_propellers(), 2)
+
+    def test_batch_evaluators(self):
+        plant = MultibodyPlant_[float](time_step=0.0)
+        file_name = FindResourceOrThrow(
+            "drake/multibody/benchmarks/acrobot/acrobot.sdf")
+        Parser(plant).AddModelFromFile(file_name)
+        plant.Finalize()
+        context = plant.CreateDefaultContext()
+        nq = plant.num_positions()
+        nv = plant.num_velocities()
+        num_samples = 4
+        q_samples = np.linspace(-1., 1., nq * num_samples).reshape(
+            (nq, num_samples))
+        v_samples = np.ones((nv, num_samples))
+        vdot_samples = np.zeros((nv, num_samples))
+        link2 = plant.GetBodyByName("Link2")
+        world_frame = plant.world_frame()
+
+        fk = ForwardKinematicsEvaluator_[float](plant)
+        self.assertIs(fk.plant(), plant)
+        fk.set_num_threads(num_threads=2)
+        self.assertEqual(fk.num_threads(), 2)
+        self.assertEqual(
+            len(fk.CalcBodyPosesInWorld(q=q_samples[:, 0])),
+            plant.num_bodies())
+        X_WB = fk.BatchCalcBodyPosesInWorld(q_samples=q_samples)
+        self.assertEqual(len(X_WB), num_samples * plant.num_bodies())
+
+        dut = BatchDynamicsEvaluator_[float](plant)
+        self.assertIs(dut.plant(), plant)
+        dut.set_num_threads(num_threads=2)
+        self.assertEqual(dut.num_threads(), 2)
+        M = dut.BatchCalcMassMatrix(q_samples=q_samples)
+        tau = dut.BatchCalcInverseDynamics(
+            q_samples=q_samples, v_samples=v_samples,
+            vdot_samples=vdot_samples)
+        self.assertEqual(tau.shape, (nv, num_samples))
+        vdot = dut.BatchCalcForwardDynamics(
+            q_samples=q_samples, v_samples=v_samples, tau_samples=tau)
+        numpy_compare.assert_float_allclose(vdot, vdot_samples, atol=1e-10)
+        x_next = dut.BatchCalcSemiExplicitEulerStep(
+            h=1e-3, q_samples=q_samples, v_samples=v_samples,
+            tau_samples=tau)
+        self.assertEqual(x_next.shape, (nq + nv, num_samples))
+        Js = dut.BatchCalcJacobianSpatialVelocity(
+            q_samples=q_samples, with_respect_to=JacobianWrtVariable.kV,
+            frame_B=link2.body_frame(), p_BP=np.zeros(3),
+            frame_A=world_frame, frame_E=world_frame)
+        self.assertEqual(len(M), num_samples)
+        self.assertEqual(len(Js), num_samples)
+        for n in range(num_samples):
+            plant.SetPositions(context, q_samples[:, n])
+            X_WL2 = X_WB[n * plant.num_bodies() + int(link2.index())]
+            numpy_compare.assert_float_allclose(
+                X_WL2.GetAsMatrix4(),
+                plant.EvalBodyPoseInWorld(context, link2).GetAsMatrix4())
+            numpy_compare.assert_float_allclose(
+                M[n], plant.CalcMassMatrixViaInverseDynamics(context))
+            numpy_compare.assert_float_allclose(
+                Js[n], plant.CalcJacobianSpatialVelocity(
+                    context=context, with_respect_to=JacobianWrtVariable.kV,
+                    frame_B=link2.body_frame(), p_BP=np.zeros(3),
+                    frame_A=world_frame, frame_E=world_frame))
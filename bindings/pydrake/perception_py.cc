@@ -1,6 +1,7 @@
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
 #include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
 
 #include "drake/bindings/pydrake/common/cpp_param_pybind.h"
 #include "drake/bindings/pydrake/common/value_pybind.h"
@@ -8,6 +9,8 @@
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/perception/depth_image_to_point_cloud.h"
 #include "drake/perception/point_cloud.h"
+#include "drake/perception/point_cloud_concatenation.h"
+#include "drake/perception/point_cloud_kd_tree.h"
 
 namespace drake {
 namespace pydrake {
@@ -114,7 +117,27 @@ void init_perception(py::module m) {
             [](PointCloud* self, const PointCloud& other) {
               self->SetFrom(other);
             },
-            py::arg("other"), cls_doc.SetFrom.doc);
+            py::arg("other"), cls_doc.SetFrom.doc)
+        // Spatial operations.
+        .def("VoxelizedDownSample", &Class::VoxelizedDownSample,
+            py::arg("voxel_size"), cls_doc.VoxelizedDownSample.doc);
+  }
+
+  {
+    using Class = PointCloudKdTree;
+    constexpr auto& cls_doc = doc.PointCloudKdTree;
+    py::class_<Class>(m, "PointCloudKdTree", cls_doc.doc)
+        .def(py::init<const PointCloud*, int>(), py::arg("cloud"),
+            py::arg("max_leaf_size") = 10,
+            // Keep alive, reference: `self` keeps `cloud` alive.
+            py::keep_alive<1, 2>(), cls_doc.ctor.doc)
+        .def("cloud", &Class::cloud, py_rvp::reference_internal,
+            cls_doc.cloud.doc)
+        .def("size", &Class::size, cls_doc.size.doc)
+        .def("FindNeighborsInRadius", &Class::FindNeighborsInRadius,
+            py::arg("p"), py::arg("radius"), cls_doc.FindNeighborsInRadius.doc)
+        .def("FindNearestNeighbors", &Class::FindNearestNeighbors,
+            py::arg("p"), py::arg("k"), cls_doc.FindNearestNeighbors.doc);
   }
 
   AddValueInstantiation<PointCloud>(m);
@@ -135,7 +158,35 @@ void init_perception(py::module m) {
         .def("color_image_input_port", &Class::color_image_input_port,
             py_rvp::reference_internal, cls_doc.color_image_input_port.doc)
         .def("point_cloud_output_port", &Class::point_cloud_output_port,
-            py_rvp::reference_internal, cls_doc.point_cloud_output_port.doc);
+            py_rvp::reference_internal, cls_doc.point_cloud_output_port.doc)
+        .def("set_drop_invalid_points", &Class::set_drop_invalid_points,
+            py::arg("drop_invalid_points"), cls_doc.set_drop_invalid_points.doc)
+        .def("drop_invalid_points", &Class::drop_invalid_points,
+            cls_doc.drop_invalid_points.doc)
+        .def("set_num_threads", &Class::set_num_threads,
+            py::arg("num_threads"), cls_doc.set_num_threads.doc)
+        .def("num_threads", &Class::num_threads, cls_doc.num_threads.doc);
+  }
+
+  {
+    using Class = PointCloudConcatenation;
+    constexpr auto& cls_doc = doc.PointCloudConcatenation;
+    py::class_<Class, LeafSystem<double>>(
+        m, "PointCloudConcatenation", cls_doc.doc)
+        .def(py::init<int, pc_flags::BaseFieldT>(), py::arg("num_clouds"),
+            py::arg("fields") = pc_flags::kXYZs, cls_doc.ctor.doc)
+        .def("num_clouds", &Class::num_clouds, cls_doc.num_clouds.doc)
+        .def("point_cloud_input_port", &Class::point_cloud_input_port,
+            py::arg("i"), py_rvp::reference_internal,
+            cls_doc.point_cloud_input_port.doc)
+        .def("camera_pose_input_port", &Class::camera_pose_input_port,
+            py::arg("i"), py_rvp::reference_internal,
+            cls_doc.camera_pose_input_port.doc)
+        .def("point_cloud_output_port", &Class::point_cloud_output_port,
+            py_rvp::reference_internal, cls_doc.point_cloud_output_port.doc)
+        .def("set_voxel_size", &Class::set_voxel_size, py::arg("voxel_size"),
+            cls_doc.set_voxel_size.doc)
+        .def("voxel_size", &Class::voxel_size, cls_doc.voxel_size.doc);
   }
 }
 
@@ -317,7 +317,10 @@ top-level documentation for :py:mod:`pydrake.math`.
             self.Solve(prog, initial_guess, solver_options, result);
           },
           py::arg("prog"), py::arg("initial_guess"), py::arg("solver_options"),
-          py::arg("result"), doc.SolverInterface.Solve.doc)
+          py::arg("result"),
+          // See the free function Solve() below about the GIL.
+          py::call_guard<py::gil_scoped_release>(),
+          doc.SolverInterface.Solve.doc)
       .def(
           "Solve",
           // This method really lives on SolverBase, but we manually write it
@@ -330,7 +333,9 @@ top-level documentation for :py:mod:`pydrake.math`.
             return result;
           },
           py::arg("prog"), py::arg("initial_guess") = std::nullopt,
-          py::arg("solver_options") = std::nullopt, doc.SolverBase.Solve.doc)
+          py::arg("solver_options") = std::nullopt,
+          // See the free function Solve() below about the GIL.
+          py::call_guard<py::gil_scoped_release>(), doc.SolverBase.Solve.doc)
       // TODO(m-chaturvedi) Add Pybind11 documentation.
       .def("solver_type",
           [](const SolverInterface& self) {
@@ -1414,7 +1419,11 @@ for every column of ``prog_var_vals``. )""")
               const std::optional<Eigen::VectorXd>&,
               const std::optional<SolverOptions>&>(&solvers::Solve),
           py::arg("prog"), py::arg("initial_guess") = py::none(),
-          py::arg("solver_options") = py::none(), doc.Solve.doc_3args);
+          py::arg("solver_options") = py::none(),
+          // Solving releases the GIL, so that several programs may be solved
+          // in parallel Python threads. Python-defined costs, constraints,
+          // callbacks and solvers reacquire it when they are called.
+          py::call_guard<py::gil_scoped_release>(), doc.Solve.doc_3args);
 
   ExecuteExtraPythonCode(m);
 }  // NOLINT(readability/fn_size)
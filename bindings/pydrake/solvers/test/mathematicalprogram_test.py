@@ -11,6 +11,7 @@ from pydrake.solvers.mathematicalprogram import (
     )
 
 from functools import partial
+from threading import Thread
 import unittest
 import warnings
 
@@ -629,6 +630,28 @@ class TestMathematicalProgram(unittest.TestCase):
         self.assertEqual(
             prog.generic_costs()[0].evaluator(), cost_binding.evaluator())
 
+    def test_pycost_solve_threads(self):
+        # Solve releases the GIL, so programs may be solved in parallel
+        # threads; Python-defined costs must still be callable.
+        solutions = []
+
+        def solve(target):
+            prog = mp.MathematicalProgram()
+            x = prog.NewContinuousVariables(1, 'x')
+            prog.AddCost(lambda x: (x[0] - target)**2, vars=x)
+            prog.AddBoundingBoxConstraint(-10., 10., x)
+            result = mp.Solve(prog)
+            solutions.append((target, result.GetSolution(x)[0]))
+
+        threads = [Thread(target=partial(solve, float(i))) for i in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual(len(solutions), 4)
+        for target, xstar in solutions:
+            self.assertAlmostEqual(xstar, target, delta=1e-5)
+
     def get_different_scalar_type(self, T):
         # Gets U such that U != T.
         next_index = SCALAR_TYPES.index(T) + 1
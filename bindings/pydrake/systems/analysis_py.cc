@@ -139,12 +139,18 @@ PYBIND11_MODULE(analysis, m) {
             py::keep_alive<1, 2>(),
             // Keep alive, ownership: `context` keeps `self` alive.
             py::keep_alive<3, 1>(), doc.Simulator.ctor.doc)
+        // N.B. The simulation methods release the GIL, so that several
+        // simulations may run in parallel Python threads. Python-defined
+        // systems and callbacks reacquire it when they are called.
         .def("Initialize", &Simulator<T>::Initialize,
             doc.Simulator.Initialize.doc,
-            py::arg("params") = InitializeParams{})
+            py::arg("params") = InitializeParams{},
+            py::call_guard<py::gil_scoped_release>())
         .def("AdvanceTo", &Simulator<T>::AdvanceTo, py::arg("boundary_time"),
+            py::call_guard<py::gil_scoped_release>(),
             doc.Simulator.AdvanceTo.doc)
         .def("AdvancePendingEvents", &Simulator<T>::AdvancePendingEvents,
+            py::call_guard<py::gil_scoped_release>(),
             doc.Simulator.AdvancePendingEvents.doc)
         .def("set_monitor", WrapCallbacks(&Simulator<T>::set_monitor),
             py::arg("monitor"), doc.Simulator.set_monitor.doc)
@@ -245,6 +251,26 @@ PYBIND11_MODULE(analysis, m) {
         py::arg("num_samples"), py::arg("generator"),
         doc.MonteCarloSimulation.doc);
 
+    m.def("GetMonteCarloShardRange", &GetMonteCarloShardRange,
+        py::arg("num_samples"), py::arg("shard_index"), py::arg("num_shards"),
+        doc.GetMonteCarloShardRange.doc);
+
+    m.def("MonteCarloSimulationShard",
+        WrapCallbacks([](const SimulatorFactory make_simulator,
+                          const ScalarSystemFunction& output, double final_time,
+                          int num_samples, int shard_index, int num_shards,
+                          RandomGenerator* generator)
+                          -> std::vector<RandomSimulationResult> {
+          return MonteCarloSimulationShard(make_simulator, output, final_time,
+              num_samples, shard_index, num_shards, generator);
+        }),
+        py::arg("make_simulator"), py::arg("output"), py::arg("final_time"),
+        py::arg("num_samples"), py::arg("shard_index"), py::arg("num_shards"),
+        py::arg("generator"), doc.MonteCarloSimulationShard.doc);
+
+    m.def("MergeMonteCarloShards", &MergeMonteCarloShards, py::arg("shards"),
+        py::arg("num_samples"), doc.MergeMonteCarloShards.doc);
+
     py::class_<RegionOfAttractionOptions>(
         m, "RegionOfAttractionOptions", doc.RegionOfAttractionOptions.doc)
         .def(py::init<>(), doc.RegionOfAttractionOptions.ctor.doc)
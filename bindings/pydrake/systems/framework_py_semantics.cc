@@ -33,8 +33,12 @@ template <typename SomeObject, typename T>
 py::object DoEval(const SomeObject* self, const systems::Context<T>& context) {
   switch (self->get_data_type()) {
     case systems::kVectorValued: {
-      const VectorX<T> eigen_copy = self->Eval(context);
-      return py::cast(eigen_copy);
+      // Copy the cached value directly into the returned array (a view would
+      // silently change when the cache entry is recomputed).
+      const auto& basic =
+          self->template Eval<systems::BasicVector<T>>(context);
+      const Eigen::Ref<const VectorX<T>> value = basic.get_value();
+      return py::cast(value, py_rvp::copy);
     }
     case systems::kAbstractValued: {
       const auto& abstract = self->template Eval<AbstractValue>(context);
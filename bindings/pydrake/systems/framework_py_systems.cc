@@ -227,7 +227,9 @@ struct Impl {
           // N.B. Passing `Eigen::Map<>` derived classes by reference rather
           // than pointer to ensure conceptual clarity. pybind11 `type_caster`
           // struggles with types of `Map<Derived>*`, but not `Map<Derived>&`.
-          &context, input, state, ToEigenRef(output));
+          // The input and state are passed as read-only views rather than
+          // copies, which spares one allocation and copy per vector and call.
+          &context, ToEigenRef(input), ToEigenRef(state), ToEigenRef(output));
       // If the macro did not return, use default functionality.
       Base::DoCalcVectorOutput(context, input, state, output);
     }
@@ -239,10 +241,10 @@ struct Impl {
       // WARNING: Mutating `derivatives` will not work when T is AutoDiffXd,
       // Expression, etc. See above.
       PYBIND11_OVERLOAD_INT(void, VectorSystem<T>,
-          "DoCalcVectorTimeDerivatives", &context, input, state,
-          ToEigenRef(derivatives));
+          "DoCalcVectorTimeDerivatives", &context, ToEigenRef(input),
+          ToEigenRef(state), ToEigenRef(derivatives));
       // If the macro did not return, use default functionality.
-      Base::DoCalcVectorOutput(context, input, state, derivatives);
+      Base::DoCalcVectorTimeDerivatives(context, input, state, derivatives);
     }
 
     void DoCalcVectorDiscreteVariableUpdates(const Context<T>& context,
@@ -252,8 +254,8 @@ struct Impl {
       // WARNING: Mutating `next_state` will not work when T is AutoDiffXd,
       // Expression, etc. See above.
       PYBIND11_OVERLOAD_INT(void, VectorSystem<T>,
-          "DoCalcVectorDiscreteVariableUpdates", &context, input, state,
-          ToEigenRef(next_state));
+          "DoCalcVectorDiscreteVariableUpdates", &context, ToEigenRef(input),
+          ToEigenRef(state), ToEigenRef(next_state));
       // If the macro did not return, use default functionality.
       Base::DoCalcVectorDiscreteVariableUpdates(
           context, input, state, next_state);
@@ -235,6 +235,8 @@ PYBIND11_MODULE(primitives, m) {
         .def("set_forced_publish_only",
             &SignalLogger<T>::set_forced_publish_only,
             doc.SignalLogger.set_forced_publish_only.doc)
+        .def("set_max_samples", &SignalLogger<T>::set_max_samples,
+            py::arg("max_samples"), doc.SignalLogger.set_max_samples.doc)
         .def("sample_times", &SignalLogger<T>::sample_times,
             py_rvp::reference_internal, doc.SignalLogger.sample_times.doc)
         .def("data", &SignalLogger<T>::data, py_rvp::reference_internal,
@@ -403,7 +405,8 @@ PYBIND11_MODULE(primitives, m) {
           systems::InputPortSelection::kUseFirstInputIfItExists,
       py::arg("output_port_index") =
           systems::OutputPortSelection::kUseFirstOutputIfItExists,
-      py::arg("equilibrium_check_tolerance") = 1e-6, doc.Linearize.doc);
+      py::arg("equilibrium_check_tolerance") = 1e-6,
+      py::arg("max_chunk_size") = std::nullopt, doc.Linearize.doc);
 
   m.def("FirstOrderTaylorApproximation", &FirstOrderTaylorApproximation,
       py::arg("system"), py::arg("context"),
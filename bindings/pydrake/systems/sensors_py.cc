@@ -136,7 +136,22 @@ PYBIND11_MODULE(sensors, m) {
         return array;
       };
 
-      py::class_<ImageT> image(m, TemporaryClassName<ImageT>().c_str());
+      // Exposes the pixels through the buffer protocol, so that e.g.
+      // `np.asarray(image)` is a (mutable) view with the same shape as `data`,
+      // which keeps the image alive.
+      auto get_buffer = [](ImageT& self) {
+        constexpr py::ssize_t kNumChannels = ImageTraitsT::kNumChannels;
+        constexpr py::ssize_t channel_stride = sizeof(T);
+        constexpr py::ssize_t pixel_stride = channel_stride * kNumChannels;
+        return py::buffer_info(self.at(0, 0), sizeof(T),
+            py::format_descriptor<T>::format(), 3,
+            {py::ssize_t{self.height()}, py::ssize_t{self.width()},
+                kNumChannels},
+            {pixel_stride * self.width(), pixel_stride, channel_stride});
+      };
+
+      py::class_<ImageT> image(
+          m, TemporaryClassName<ImageT>().c_str(), py::buffer_protocol());
       AddTemplateClass(m, "Image", image, py_param);
       image  // BR
           .def(py::init<int, int>(), py::arg("width"), py::arg("height"),
@@ -152,7 +167,8 @@ PYBIND11_MODULE(sensors, m) {
           // Non-C++ properties. Make them Pythonic.
           .def_property_readonly("shape", get_shape)
           .def_property_readonly("data", get_data)
-          .def_property_readonly("mutable_data", get_mutable_data);
+          .def_property_readonly("mutable_data", get_mutable_data)
+          .def_buffer(get_buffer);
       // Constants.
       image.attr("Traits") = traits;
       // - Do not duplicate aliases (e.g. `kNumChannels`) for now.
@@ -302,7 +318,10 @@ PYBIND11_MODULE(sensors, m) {
             py_rvp::reference_internal, cls_doc.label_image_input_port.doc)
         .def("image_array_t_msg_output_port",
             &Class::image_array_t_msg_output_port, py_rvp::reference_internal,
-            cls_doc.image_array_t_msg_output_port.doc);
+            cls_doc.image_array_t_msg_output_port.doc)
+        .def("set_num_threads", &Class::set_num_threads,
+            py::arg("num_threads"), cls_doc.set_num_threads.doc)
+        .def("num_threads", &Class::num_threads, cls_doc.num_threads.doc);
     // Because the public interface requires templates and it's hard to
     // reproduce the logic publicly (e.g. no overload that just takes
     // `AbstractValue` and the pixel type), go ahead and bind the templated
@@ -1,3 +1,4 @@
+from threading import Thread
 import unittest
 
 from pydrake.symbolic import Variable, Expression
@@ -110,3 +111,31 @@ class TestAnalysis(unittest.TestCase):
         self.assertLess(status.return_time(), 1.1)
         simulator.clear_monitor()
         self.assertIsNone(simulator.get_monitor())
+
+    def test_simulator_threads(self):
+        # AdvanceTo releases the GIL, so simulators may run in parallel
+        # threads; Python callbacks (here, the monitor) must still work.
+        x = Variable("x")
+        sys = SymbolicVectorSystem(state=[x], dynamics=[-x])
+        num_monitor_calls = []
+
+        def simulate():
+            simulator = Simulator(sys)
+            calls = [0]
+
+            def monitor(root_context):
+                calls[0] += 1
+                return EventStatus.DidNothing()
+
+            simulator.set_monitor(monitor)
+            status = simulator.AdvanceTo(1.)
+            self.assertTrue(status.succeeded())
+            num_monitor_calls.append(calls[0])
+
+        threads = [Thread(target=simulate) for _ in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual(len(num_monitor_calls), 4)
+        self.assertTrue(all(n > 0 for n in num_monitor_calls))
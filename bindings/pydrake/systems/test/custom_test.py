@@ -89,18 +89,23 @@ class CustomVectorSystem(VectorSystem):
             self.DeclareContinuousState(2)
         # Record calls for testing.
         self.has_called = []
+        # Record whether the input and state arguments are writeable.
+        self.writeable_calls = []
 
     def DoCalcVectorOutput(self, context, u, x, y):
         y[:] = np.hstack([u, x])
         self.has_called.append("output")
+        self.writeable_calls.append(u.flags.writeable or x.flags.writeable)
 
     def DoCalcVectorTimeDerivatives(self, context, u, x, x_dot):
         x_dot[:] = x + u
         self.has_called.append("continuous")
+        self.writeable_calls.append(u.flags.writeable or x.flags.writeable)
 
     def DoCalcVectorDiscreteVariableUpdates(self, context, u, x, x_n):
         x_n[:] = x + 2*u
         self.has_called.append("discrete")
+        self.writeable_calls.append(u.flags.writeable or x.flags.writeable)
 
 
 # Wraps `Adder`.
@@ -416,6 +421,8 @@ class TestCustom(unittest.TestCase):
             self.assertEqual(
                 system.has_called,
                 [update_type, "output"])
+            # The input and state are passed as read-only views.
+            self.assertEqual(system.writeable_calls, [False, False])
 
             # Check values.
             state = context.get_state()
@@ -9,7 +9,10 @@ import numpy as np
 
 from pydrake.common import RandomGenerator
 from pydrake.systems.analysis import (
+    GetMonteCarloShardRange,
+    MergeMonteCarloShards,
     MonteCarloSimulation,
+    MonteCarloSimulationShard,
     RandomSimulationResult,
     RandomSimulation,
     Simulator
@@ -48,3 +51,16 @@ class TestMonteCarlo(unittest.TestCase):
         for i in range(1, len(result)):
             self.assertIsNot(result[0].generator_snapshot,
                              result[i].generator_snapshot)
+
+        shards = [
+            MonteCarloSimulationShard(
+                make_simulator=make_simulator, output=calc_output,
+                final_time=1.0, num_samples=10, shard_index=i, num_shards=3,
+                generator=RandomGenerator())
+            for i in range(3)]
+        self.assertEqual(GetMonteCarloShardRange(
+            num_samples=10, shard_index=2, num_shards=3), (6, 10))
+        self.assertEqual(len(shards[2]), 4)
+        merged = MergeMonteCarloShards(shards=shards, num_samples=10)
+        self.assertEqual(len(merged), 10)
+        self.assertEqual(merged[9].output, 42.)
@@ -121,6 +121,14 @@ class TestGeneral(unittest.TestCase):
         builder.Connect(integrator.get_output_port(0),
                         logger_periodic.get_input_port(0))
 
+        # Add a periodic logger that only retains its latest samples.
+        logger_bounded = builder.AddSystem(SignalLogger(kSize))
+        logger_bounded.set_publish_period(kPeriod)
+        kMaxSamples = 3
+        logger_bounded.set_max_samples(max_samples=kMaxSamples)
+        builder.Connect(integrator.get_output_port(0),
+                        logger_bounded.get_input_port(0))
+
         diagram = builder.Build()
         simulator = Simulator(diagram)
         kTime = 1.
@@ -141,6 +149,12 @@ class TestGeneral(unittest.TestCase):
         # Should log exactly once every kPeriod, up to and including kTime.
         self.assertTrue(t.shape[0] == np.floor(kTime / kPeriod) + 1.)
 
+        # Verify that the bounded logger retains the latest samples.
+        np.testing.assert_array_equal(
+            logger_bounded.sample_times(), t[-kMaxSamples:])
+        np.testing.assert_array_equal(
+            logger_bounded.data(), x[:, -kMaxSamples:])
+
         logger_per_step.reset()
 
         # Verify that t and x retain their values after systems are deleted.
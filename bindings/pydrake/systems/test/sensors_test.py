@@ -155,16 +155,25 @@ class TestSensors(unittest.TestCase):
                     self.assertTrue(
                         np.allclose(data[ih, iw, :], image.at(iw, ih)))
 
+            # The buffer protocol gives a view of the same pixels.
+            view = np.asarray(image)
+            self.assertEqual(view.shape, image.shape)
+            self.assertEqual(view.dtype, ImageT.Traits.ChannelType)
+            np.testing.assert_array_equal(view, image.data)
+            view[0, 0, 0] = 4
+            self.assertEqual(image.at(0, 0)[0], 4)
+
             # Ensure that keep alive works by using temporary objects.
 
             def check_keep_alive():
                 image = ImageT(w, h, channel_default)
-                return (image.data, image.mutable_data)
+                return (image.data, image.mutable_data, np.asarray(image))
 
-            data, mutable_data = check_keep_alive()
+            data, mutable_data, view = check_keep_alive()
             gc.collect()
             np.testing.assert_array_equal(data, channel_default)
             np.testing.assert_array_equal(mutable_data, channel_default)
+            np.testing.assert_array_equal(view, channel_default)
 
     def test_constants(self):
         # Simply ensure we can access the constants.
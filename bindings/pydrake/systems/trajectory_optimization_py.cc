@@ -179,7 +179,7 @@ PYBIND11_MODULE(trajectory_optimization, m) {
           py::arg("input_port_index") =
               systems::InputPortSelection::kUseFirstInputIfItExists,
           py::arg("assume_non_continuous_states_are_fixed") = false,
-          doc.DirectCollocation.ctor.doc);
+          doc.DirectCollocation.ctor.doc_7args);
 
   py::class_<DirectCollocationConstraint, solvers::Constraint,
       std::shared_ptr<DirectCollocationConstraint>>(
@@ -193,7 +193,7 @@ PYBIND11_MODULE(trajectory_optimization, m) {
           py::arg("input_port_index") =
               systems::InputPortSelection::kUseFirstInputIfItExists,
           py::arg("assume_non_continuous_states_are_fixed") = false,
-          doc.DirectCollocationConstraint.ctor.doc);
+          doc.DirectCollocationConstraint.ctor.doc_4args);
 
   m.def("AddDirectCollocationConstraint", &AddDirectCollocationConstraint,
       py::arg("constraint"), py::arg("timestep"), py::arg("state"),
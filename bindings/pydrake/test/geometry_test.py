@@ -561,6 +561,10 @@ class TestGeometry(unittest.TestCase):
         self.assertEqual(len(results), 0)
         results = query_object.ComputeSignedDistanceToPoint(p_WQ=(1, 2, 3))
         self.assertEqual(len(results), 0)
+        results = query_object.ComputeSignedDistanceToPoints(
+            p_WQs=np.array([[1., 2., 3.], [4., 5., 6.]]).T)
+        self.assertEqual(len(results), 2)
+        self.assertEqual(len(results[0]), 0)
         results = query_object.FindCollisionCandidates()
         self.assertEqual(len(results), 0)
         self.assertFalse(query_object.HasCollisions())
@@ -36,6 +36,9 @@ class TestBarycentricMesh(unittest.TestCase):
         self.assertEqual(mesh.Eval(values, (1, 0))[0], 1)
         self.assertEqual(mesh.Eval(values, (0, 1))[0], 2)
         self.assertEqual(mesh.Eval(values, (1, 1))[0], 3)
+        np.testing.assert_equal(
+            mesh.EvalBatch(values, [[0, 1, 0, 1], [0, 0, 1, 1]]),
+            [[0, 1, 2, 3]])
 
     def test_weight(self):
         mesh = BarycentricMesh([{0, 1}, {0, 1}])
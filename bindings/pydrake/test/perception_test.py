@@ -76,6 +76,25 @@ class TestPerception(unittest.TestCase):
         # Test Systems' value registration.
         self.assertIsInstance(AbstractValue.Make(pc), Value[mut.PointCloud])
 
+    def test_point_cloud_spatial_api(self):
+        pc = mut.PointCloud(new_size=4)
+        pc.mutable_xyzs()[:] = [[0.1, 0.2, 1.5, 1.6],
+                                [0.1, 0.1, 0.1, 0.1],
+                                [0.1, 0.1, 0.1, 0.1]]
+        down_sampled = pc.VoxelizedDownSample(voxel_size=1.)
+        self.assertEqual(down_sampled.size(), 2)
+        np.testing.assert_allclose(
+            down_sampled.xyzs(), [[0.15, 1.55], [0.1, 0.1], [0.1, 0.1]],
+            rtol=1e-6)
+
+        kd_tree = mut.PointCloudKdTree(cloud=pc, max_leaf_size=1)
+        self.assertEqual(kd_tree.size(), 4)
+        self.assertEqual(kd_tree.cloud().size(), 4)
+        p = np.array([1.4, 0.1, 0.1])
+        self.assertEqual(kd_tree.FindNearestNeighbors(p=p, k=2), [2, 3])
+        self.assertEqual(
+            kd_tree.FindNeighborsInRadius(p=p, radius=0.5), [2, 3])
+
     def test_depth_image_to_point_cloud_api(self):
         camera_info = CameraInfo(width=640, height=480, fov_y=np.pi / 4)
         dut = mut.DepthImageToPointCloud(camera_info=camera_info)
@@ -87,3 +106,21 @@ class TestPerception(unittest.TestCase):
             pixel_type=PixelType.kDepth16U,
             scale=0.001,
             fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs)
+
+    def test_point_cloud_concatenation_api(self):
+        dut = mut.PointCloudConcatenation(num_clouds=2)
+        self.assertEqual(dut.num_clouds(), 2)
+        self.assertIsInstance(dut.point_cloud_input_port(i=1), InputPort)
+        self.assertIsInstance(dut.camera_pose_input_port(i=1), InputPort)
+        self.assertIsInstance(dut.point_cloud_output_port(), OutputPort)
+        dut.set_voxel_size(voxel_size=0.01)
+        self.assertEqual(dut.voxel_size(), 0.01)
+
+        context = dut.CreateDefaultContext()
+        dut.point_cloud_input_port(i=0).FixValue(
+            context, mut.PointCloud(new_size=2))
+        dut.point_cloud_input_port(i=1).FixValue(
+            context, mut.PointCloud(new_size=3))
+        dut.set_voxel_size(voxel_size=0.)
+        output = dut.point_cloud_output_port().Eval(context)
+        self.assertEqual(output.size(), 5)
@@ -18,6 +18,7 @@
 
 #include <cmath>
 #include <ostream>
+#include <utility>
 
 #include <Eigen/Dense>
 
@@ -214,10 +215,8 @@ class AutoDiffScalar<VectorXd>
     return *this;
   }
 
-  // It is possible that further overloads could exploit more move-awareness
-  // here. However, overload ambiguities are difficult to resolve. Currently
-  // only the left-hand operand is available for optimizations.
-  // TODO(rpoyner-tri) investigate further optimizations.
+  // The left-hand operand is used as storage, unless the right-hand operand
+  // is an rvalue; see the overload below.
   template <typename OtherDerType>
   friend inline AutoDiffScalar<DerType> operator+(
       AutoDiffScalar<DerType> a, const AutoDiffScalar<OtherDerType>& b) {
@@ -225,6 +224,16 @@ class AutoDiffScalar<VectorXd>
     return a;
   }
 
+  // When the right-hand operand is an rvalue (e.g., the result of another
+  // operation), it is used as storage instead. Binding it by rvalue reference
+  // makes this overload the better match, so that there is no ambiguity with
+  // the overload above.
+  friend inline AutoDiffScalar operator+(const AutoDiffScalar& a,
+                                         AutoDiffScalar&& b) {
+    b += a;
+    return std::move(b);
+  }
+
   template <typename OtherDerType>
   inline AutoDiffScalar& operator+=(const AutoDiffScalar<OtherDerType>& other) {
     const bool has_this_der = m_derivatives.size() > 0;
@@ -265,6 +274,22 @@ class AutoDiffScalar<VectorXd>
     return a;
   }
 
+  friend inline AutoDiffScalar operator-(const AutoDiffScalar& a,
+                                         AutoDiffScalar&& b) {
+    const bool has_a_der = a.derivatives().size() > 0;
+    const bool has_both_der = has_a_der && (b.derivatives().size() > 0);
+    b.value() = a.value() - b.value();
+    if (has_both_der) {
+      b.derivatives() *= -1;
+      b.derivatives() += a.derivatives();
+    } else if (has_a_der) {
+      b.derivatives() = a.derivatives();
+    } else {
+      b.derivatives() *= -1;
+    }
+    return std::move(b);
+  }
+
   template <typename OtherDerType>
   inline AutoDiffScalar& operator-=(const AutoDiffScalar<OtherDerType>& other) {
     const bool has_this_der = m_derivatives.size() > 0;
@@ -323,6 +348,30 @@ class AutoDiffScalar<VectorXd>
     return a;
   }
 
+  friend inline AutoDiffScalar operator/(const AutoDiffScalar& a,
+                                         AutoDiffScalar&& b) {
+    const bool has_a_der = a.derivatives().size() > 0;
+    const bool has_both_der = has_a_der && (b.derivatives().size() > 0);
+    const Scalar scale = Scalar(1) / (b.value() * b.value());
+    if (has_both_der) {
+      b.derivatives() *= -a.value();
+      b.derivatives() += a.derivatives() * b.value();
+      b.derivatives() *= scale;
+    } else if (has_a_der) {
+      b.derivatives() = a.derivatives() * (Scalar(1) / b.value());
+    } else {
+      b.derivatives() *= -a.value() * scale;
+    }
+    b.value() = a.value() / b.value();
+    return std::move(b);
+  }
+
+  friend inline AutoDiffScalar operator*(const AutoDiffScalar& a,
+                                         AutoDiffScalar&& b) {
+    b *= a;
+    return std::move(b);
+  }
+
   inline AutoDiffScalar& operator*=(const Scalar& other) {
     m_value *= other;
     m_derivatives *= other;
@@ -0,0 +1,61 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace internal {
+
+int GetHardwareConcurrency() {
+  // hardware_concurrency() is allowed to return zero when it is unknown.
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+void StaticParallelForRange(
+    int num_items, int num_threads,
+    const std::function<void(int, int, int)>& body) {
+  DRAKE_DEMAND(num_items >= 0);
+  DRAKE_DEMAND(num_threads >= 1);
+  if (num_items == 0) return;
+
+  const int num_blocks = std::min(num_items, num_threads);
+  // The first (num_items % num_blocks) blocks get one extra item.
+  const int block_size = num_items / num_blocks;
+  const int num_larger_blocks = num_items % num_blocks;
+  auto block_begin = [=](int block) {
+    return block * block_size + std::min(block, num_larger_blocks);
+  };
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_blocks - 1);
+  for (int block = 1; block < num_blocks; ++block) {
+    futures.emplace_back(std::async(std::launch::async, body, block,
+                                    block_begin(block),
+                                    block_begin(block + 1)));
+  }
+
+  // Process the first block here, but make sure that every other block has
+  // finished before any exception leaves this function.
+  std::exception_ptr first_error;
+  try {
+    body(0, block_begin(0), block_begin(1));
+  } catch (...) {
+    first_error = std::current_exception();
+  }
+  for (auto& future : futures) {
+    try {
+      future.get();
+    } catch (...) {
+      if (!first_error) first_error = std::current_exception();
+    }
+  }
+  if (first_error) std::rethrow_exception(first_error);
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <functional>
+
+namespace drake {
+namespace internal {
+
+/* Returns the number of threads reported by std::thread::hardware_concurrency,
+ or 1 if that number is not known.  */
+int GetHardwareConcurrency();
+
+/* Partitions the index range [0, num_items) into (at most) `num_threads`
+ contiguous blocks of nearly equal size and calls `body(thread_num, begin,
+ end)` once per non-empty block, each on its own thread. Block `thread_num`
+ always covers the same indices for the same `num_items` and `num_threads`,
+ so callers that write per-block results into per-thread storage (indexed by
+ `thread_num`) and then concatenate them in `thread_num` order get results
+ that do not depend on thread scheduling.
+
+ The first block is processed on the calling thread. This function returns
+ only once every block has been processed; if any invocation of `body` throws,
+ one of the exceptions is rethrown after all of the threads have finished.
+
+ @pre num_items >= 0 and num_threads >= 1.  */
+void StaticParallelForRange(
+    int num_items, int num_threads,
+    const std::function<void(int thread_num, int begin, int end)>& body);
+
+}  // namespace internal
+}  // namespace drake
@@ -215,6 +215,12 @@ class Polynomial {
 
     DRAKE_DEMAND(derivative_order >= 0);
     ProductType value = 0;
+    // For numerical types, the monomials (which are usually sorted by
+    // increasing degree) reuse the power of x of the previous monomial, rather
+    // than calling pow() for each of them. Symbolic types keep using pow(), so
+    // that the resulting expressions do not change.
+    ProductType x_power = 1;
+    PowerType x_power_degree = 0;
     using std::pow;
     for (typename std::vector<Monomial>::const_iterator iter =
              monomials_.begin();
@@ -229,6 +235,12 @@ class Polynomial {
         value += coefficient;
       } else if (degree == 1) {
         value += coefficient * x;
+      } else if (!std::is_same_v<ProductType, symbolic::Expression> &&
+                 degree >= x_power_degree) {
+        for (; x_power_degree < degree; ++x_power_degree) {
+          x_power *= x;
+        }
+        value += coefficient * x_power;
       } else {  // degree > 1.
         value += coefficient * pow(static_cast<ProductType>(x), degree);
       }
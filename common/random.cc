@@ -1,4 +1,59 @@
 #include "drake/common/random.h"
 
-// For now, this is an empty .cc file that only serves to confirm
-// random.h is a stand-alone header.
+#include <stdexcept>
+
+namespace drake {
+namespace internal {
+namespace {
+
+constexpr uint32_t kMultiplier0 = 0xD2511F53;
+constexpr uint32_t kMultiplier1 = 0xCD9E8D57;
+constexpr uint32_t kWeyl0 = 0x9E3779B9;
+constexpr uint32_t kWeyl1 = 0xBB67AE85;
+
+// Returns the high and the low 32 bits of a * b.
+void MulHiLo(uint32_t a, uint32_t b, uint32_t* hi, uint32_t* lo) {
+  const uint64_t product = static_cast<uint64_t>(a) * b;
+  *hi = static_cast<uint32_t>(product >> 32);
+  *lo = static_cast<uint32_t>(product);
+}
+
+}  // namespace
+
+Philox4x32::Block Philox4x32::Evaluate(uint64_t key, uint64_t stream,
+                                       uint64_t counter) {
+  Block x{static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32),
+          static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+  uint32_t k0 = static_cast<uint32_t>(key);
+  uint32_t k1 = static_cast<uint32_t>(key >> 32);
+  for (int round = 0; round < 10; ++round) {
+    uint32_t hi0, lo0, hi1, lo1;
+    MulHiLo(kMultiplier0, x[0], &hi0, &lo0);
+    MulHiLo(kMultiplier1, x[2], &hi1, &lo1);
+    x = {hi1 ^ x[1] ^ k0, lo1, hi0 ^ x[3] ^ k1, lo0};
+    k0 += kWeyl0;
+    k1 += kWeyl1;
+  }
+  return x;
+}
+
+}  // namespace internal
+
+RandomGenerator RandomGenerator::Split(uint64_t index) const {
+  const auto* philox = std::get_if<internal::Philox4x32>(&generator_);
+  if (philox == nullptr) {
+    throw std::logic_error(
+        "RandomGenerator::Split(): only counter-based generators (see "
+        "MakeCounterBased()) can be split");
+  }
+  // The substream is the image of (stream, index) under the bijection keyed
+  // by the seed, but with the key's bits flipped so that it does not coincide
+  // with a block of the generator's own output.
+  const internal::Philox4x32::Block block = internal::Philox4x32::Evaluate(
+      ~philox->key(), philox->stream(), index);
+  const uint64_t substream =
+      (static_cast<uint64_t>(block[1]) << 32) | block[0];
+  return MakeCounterBased(philox->key(), substream);
+}
+
+}  // namespace drake
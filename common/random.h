@@ -1,15 +1,70 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <random>
+#include <variant>
 
 #include "drake/common/drake_copyable.h"
 
 namespace drake {
+namespace internal {
+
+/// The counter-based Philox4x32-10 engine of Salmon et al., "Parallel random
+/// numbers: as easy as 1, 2, 3", 2011.  Block `n` of stream `s` with key `k`
+/// is the bijection Philox(k, {n, s}) evaluated on its own, so that streams
+/// (and positions within a stream) can be reached in O(1) without stepping
+/// through the earlier ones.  Use RandomGenerator::MakeCounterBased() rather
+/// than this class directly.
+class Philox4x32 {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Philox4x32)
+
+  using Block = std::array<uint32_t, 4>;
+
+  Philox4x32(uint64_t key, uint64_t stream)
+      : key_(key), stream_(stream) {}
+
+  uint64_t key() const { return key_; }
+  uint64_t stream() const { return stream_; }
+
+  uint32_t operator()() {
+    if (offset_ == 4) {
+      buffer_ = Evaluate(key_, stream_, counter_++);
+      offset_ = 0;
+    }
+    return buffer_[offset_++];
+  }
+
+  /// Returns the block of four 32-bit values at position `counter` of the
+  /// given stream.
+  static Block Evaluate(uint64_t key, uint64_t stream, uint64_t counter);
+
+ private:
+  uint64_t key_{};
+  uint64_t stream_{};
+  // The position of the next block to evaluate.
+  uint64_t counter_{0};
+  // The current block, and the index of its next unused value.
+  Block buffer_{};
+  int offset_{4};
+};
+
+}  // namespace internal
+
 /// Defines Drake's canonical implementation of the UniformRandomBitGenerator
 /// C++ concept (as well as a few conventional extras beyond the concept, e.g.,
-/// seeds).  This uses the 32-bit Mersenne Twister mt19937 by Matsumoto and
-/// Nishimura, 1998.  For more information, see
+/// seeds).  By default this uses the 32-bit Mersenne Twister mt19937 by
+/// Matsumoto and Nishimura, 1998.  For more information, see
 /// https://en.cppreference.com/w/cpp/numeric/random/mersenne_twister_engine
+///
+/// Alternatively, MakeCounterBased() creates a generator that uses the
+/// counter-based Philox4x32-10 engine of Salmon et al., 2011.  A counter-based
+/// generator is identified by a (seed, stream) pair, and Split() creates new
+/// independent streams from it in O(1).  This is the preferred way to give
+/// each thread, rollout, or random source of a parallel computation its own
+/// reproducible generator, because no sequential stepping of a shared
+/// generator is required.
 class RandomGenerator {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RandomGenerator)
@@ -17,16 +72,47 @@ class RandomGenerator {
   using result_type = std::mt19937::result_type;
 
   RandomGenerator() = default;
-  explicit RandomGenerator(result_type value) : generator_(value) {}
+  explicit RandomGenerator(result_type value)
+      : generator_(std::in_place_type<std::mt19937>, value) {}
+
+  /// Creates a counter-based generator for the given `seed` and `stream`.
+  /// Generators with the same seed and different streams produce independent
+  /// sequences.
+  static RandomGenerator MakeCounterBased(uint64_t seed, uint64_t stream = 0) {
+    return RandomGenerator(internal::Philox4x32(seed, stream));
+  }
+
+  /// Returns true iff this generator was created by MakeCounterBased() (or by
+  /// Split()).
+  bool is_counter_based() const {
+    return std::holds_alternative<internal::Philox4x32>(generator_);
+  }
+
+  /// Returns a counter-based generator for the substream `index` of this
+  /// generator, with the same seed.  The result only depends on this
+  /// generator's seed and stream and on `index` (not on how many values this
+  /// generator has produced), so that the substreams of a computation can be
+  /// created in any order, or concurrently.  Substreams may themselves be
+  /// split further.
+  /// @throws std::exception if this generator is not counter-based.
+  RandomGenerator Split(uint64_t index) const;
 
   static constexpr result_type min() { return std::mt19937::min(); }
   static constexpr result_type max() { return std::mt19937::max(); }
-  result_type operator()() { return generator_(); }
+  result_type operator()() {
+    if (auto* philox = std::get_if<internal::Philox4x32>(&generator_)) {
+      return (*philox)();
+    }
+    return (*std::get_if<std::mt19937>(&generator_))();
+  }
 
   static constexpr result_type default_seed = std::mt19937::default_seed;
 
  private:
-  std::mt19937 generator_{};
+  explicit RandomGenerator(const internal::Philox4x32& philox)
+      : generator_(philox) {}
+
+  std::variant<std::mt19937, internal::Philox4x32> generator_{};
 };
 
 /// Drake supports explicit reasoning about a few carefully chosen random
@@ -5,6 +5,8 @@
 
 #include <fmt/format.h>
 
+#include "drake/common/drake_assert.h"
+
 namespace drake {
 namespace symbolic {
 
@@ -22,7 +24,54 @@ CodeGenVisitor::CodeGenVisitor(const vector<Variable>& parameters) {
 }
 
 string CodeGenVisitor::CodeGen(const Expression& e) const {
-  return VisitExpression<string>(this, e);
+  if (cse_ == nullptr || is_variable(e) || is_constant(e)) {
+    return VisitExpression<string>(this, e);
+  }
+  if (cse_->counting) {
+    // Descend into each distinct subexpression only once.
+    if (++cse_->occurrences[e] == 1) {
+      VisitExpression<string>(this, e);
+    }
+    return {};
+  }
+  if (cse_->occurrences.at(e) < 2) {
+    return VisitExpression<string>(this, e);
+  }
+  const auto it = cse_->temporaries.find(e);
+  if (it != cse_->temporaries.end()) {
+    return it->second;
+  }
+  // The subexpressions of e are declared first, while generating its code.
+  const string code{VisitExpression<string>(this, e)};
+  string name{"t" + to_string(cse_->temporaries.size())};
+  (*cse_->os) << "    const double " << name << " = " << code << ";\n";
+  cse_->temporaries.emplace(e, name);
+  return name;
+}
+
+vector<string> CodeGenVisitor::CodeGenWithCse(const Expression* const data,
+                                              const int size,
+                                              ostream* const os) {
+  DRAKE_DEMAND(os != nullptr);
+  CseState state;
+  state.os = os;
+  cse_ = &state;
+  vector<string> result;
+  result.reserve(size);
+  try {
+    for (int i = 0; i < size; ++i) {
+      (void)CodeGen(data[i]);
+    }
+    state.counting = false;
+    for (int i = 0; i < size; ++i) {
+      result.push_back(CodeGen(data[i]));
+    }
+  } catch (...) {
+    cse_ = nullptr;
+    throw;
+  }
+  cse_ = nullptr;
+  return result;
 }
 
 string CodeGenVisitor::VisitVariable(const Expression& e) const {
@@ -183,7 +232,9 @@ string CodeGen(const string& function_name, const vector<Variable>& parameters,
   // Add header for the main function.
   oss << "double " << function_name << "(const double* p) {\n";
   // Codegen the expression.
-  oss << "    return " << CodeGenVisitor{parameters}.CodeGen(e) << ";\n";
+  CodeGenVisitor visitor{parameters};
+  const vector<string> code{visitor.CodeGenWithCse(&e, 1, &oss)};
+  oss << "    return " << code[0] << ";\n";
   // Add footer for the main function.
   oss << "}\n";
   // <function_name>_meta_t type.
@@ -205,10 +256,11 @@ void CodeGenDenseData(const string& function_name,
                       ostream* const os) {
   // Add header for the main function.
   (*os) << "void " << function_name << "(const double* p, double* m) {\n";
-  const CodeGenVisitor visitor{parameters};
+  CodeGenVisitor visitor{parameters};
+  const vector<string> code{visitor.CodeGenWithCse(data, size, os)};
   for (int i = 0; i < size; ++i) {
     (*os) << "    "
-          << "m[" << i << "] = " << visitor.CodeGen(data[i]) << ";\n";
+          << "m[" << i << "] = " << code[i] << ";\n";
   }
   // Add footer for the main function.
   (*os) << "}\n";
@@ -249,10 +301,10 @@ void CodeGenSparseData(const string& function_name,
     (*os) << fmt::format("    inner_indices[{0}] = {1};\n", i,
                          inner_index_ptr[i]);
   }
-  const CodeGenVisitor visitor{parameters};
+  CodeGenVisitor visitor{parameters};
+  const vector<string> code{visitor.CodeGenWithCse(value_ptr, non_zeros, os)};
   for (int i = 0; i < non_zeros; ++i) {
-    (*os) << fmt::format("    values[{0}] = {1};\n", i,
-                         visitor.CodeGen(value_ptr[i]));
+    (*os) << fmt::format("    values[{0}] = {1};\n", i, code[i]);
   }
   // Print footer.
   (*os) << "}\n";
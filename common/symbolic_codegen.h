@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ostream>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -31,7 +32,27 @@ class CodeGenVisitor {
   /// Generates C expression for the expression @p e.
   [[nodiscard]] std::string CodeGen(const Expression& e) const;
 
+  /// Generates C expressions for the @p size expressions in @p data with
+  /// common subexpression elimination across all of them. Every non-trivial
+  /// subexpression which occurs more than once is evaluated only once, into a
+  /// local variable `t<n>` whose declaration is written to @p os. The returned
+  /// C expressions refer to these local variables, so they are only valid
+  /// after the declarations.
+  [[nodiscard]] std::vector<std::string> CodeGenWithCse(const Expression* data,
+                                                        int size,
+                                                        std::ostream* os);
+
  private:
+  // Bookkeeping for CodeGenWithCse().
+  struct CseState {
+    // While true, CodeGen() only counts the occurrences of subexpressions.
+    bool counting{true};
+    std::unordered_map<Expression, int> occurrences;
+    // Maps a subexpression to the name of the local variable holding it.
+    std::unordered_map<Expression, std::string> temporaries;
+    std::ostream* os{nullptr};
+  };
+
   [[nodiscard]] std::string VisitVariable(const Expression& e) const;
   [[nodiscard]] std::string VisitConstant(const Expression& e) const;
   [[nodiscard]] std::string VisitAddition(const Expression& e) const;
@@ -71,6 +92,8 @@ class CodeGenVisitor {
                                                   const Expression&);
 
   IdToIndexMap id_to_idx_map_;
+  // Non-null only while CodeGenWithCse() is running.
+  CseState* cse_{nullptr};
 };
 
 /// @defgroup codegen Code Generation
@@ -83,6 +106,11 @@ class CodeGenVisitor {
 /// math functions defined in `<math.h>` such as `sin`, `cos`, `exp`, and `log`.
 /// A user of generated code is responsible to include `<math.h>` if needed to
 /// compile generated code.
+///
+/// @note Common subexpressions are eliminated across all outputs of a
+/// generated function. A non-trivial subexpression that occurs more than once
+/// is evaluated once into a local variable, e.g. `const double t0 = (1 +
+/// p[0]);`, which is then used in place of the subexpression.
 
 /// For a given symbolic expression @p e, generates two C functions,
 /// `<function_name>` and `<function_name>_meta`. The generated
@@ -8,6 +8,7 @@
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -209,9 +210,13 @@ Expression Expression::Expand() const {
     // If it is already expanded, return the current expression without calling
     // Expand() on the cell.
     return *this;
-  } else {
-    return ptr_->Expand();
   }
+  if (shared_ptr<ExpressionCell> cached = ptr_->get_expanded_cache()) {
+    return Expression{std::move(cached)};
+  }
+  Expression result{ptr_->Expand()};
+  ptr_->set_expanded_cache(result.ptr_);
+  return result;
 }
 
 Expression Expression::Substitute(const Variable& var,
@@ -17,6 +17,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -72,6 +73,18 @@ class ExpressionCell {
   /** Sets this symbolic expression as already expanded. */
   void set_expanded() { is_expanded_ = true; }
 
+  /** Returns the cell of the expression previously returned by Expand() for
+   * this cell, or nullptr if this cell has not been expanded yet. */
+  [[nodiscard]] std::shared_ptr<ExpressionCell> get_expanded_cache() const {
+    return std::atomic_load(&expanded_cache_);
+  }
+
+  /** Memoizes @p expanded as the result of Expand() for this cell, so that
+   * subtrees shared by several expressions are expanded only once. */
+  void set_expanded_cache(std::shared_ptr<ExpressionCell> expanded) const {
+    std::atomic_store(&expanded_cache_, std::move(expanded));
+  }
+
   /** Evaluates under a given environment (by default, an empty environment).
    *  @throws std::runtime_error if NaN is detected during evaluation.
    */
@@ -121,6 +134,8 @@ class ExpressionCell {
   const ExpressionKind kind_{};
   const bool is_polynomial_{false};
   bool is_expanded_{false};
+  // Cells are immutable once shared, so the expansion of a cell never changes.
+  mutable std::shared_ptr<ExpressionCell> expanded_cache_;
 };
 
 /** Represents the base class for unary expressions.  */
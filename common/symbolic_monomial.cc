@@ -225,14 +225,19 @@ Expression Monomial::ToExpression() const {
 }
 
 Monomial& Monomial::operator*=(const Monomial& m) {
+  // Both maps are sorted by variable, so merge them in a single pass instead
+  // of searching powers_ for every variable of m.
+  auto it = powers_.begin();
   for (const auto& p : m.get_powers()) {
     const Variable& var{p.first};
     const int exponent{p.second};
-    auto it = powers_.find(var);
-    if (it == powers_.end()) {
-      powers_.insert(p);
-    } else {
+    while (it != powers_.end() && it->first.less(var)) {
+      ++it;
+    }
+    if (it != powers_.end() && it->first.equal_to(var)) {
       it->second += exponent;
+    } else {
+      it = powers_.emplace_hint(it, p);
     }
     total_degree_ += exponent;
   }
@@ -31,10 +31,21 @@ void DoAddProduct(const Expression& coeff, const Monomial& m,
   if (is_zero(coeff)) {
     return;
   }
-  auto it = map->find(m);
-  if (it != map->end()) {
+  auto it = map->lower_bound(m);
+  if (it != map->end() && !map->key_comp()(m, it->first)) {
     // m ∈ dom(map)
     Expression& existing_coeff = it->second;
+    if (is_constant(existing_coeff) && is_constant(coeff)) {
+      // Fast path for numeric coefficients, which avoids the expansions below.
+      const double sum{get_constant_value(existing_coeff) +
+                       get_constant_value(coeff)};
+      if (sum == 0.0) {
+        map->erase(it);
+      } else {
+        existing_coeff = sum;
+      }
+      return;
+    }
     // Note that `.Expand()` is needed in the following line. For example,
     // consider the following case:
     //     c1 := (a + b)²
@@ -612,7 +623,9 @@ Polynomial& Polynomial::operator*=(const Monomial& m) {
        monomial_to_coefficient_map_) {
     const Monomial& m_i{p.first};
     const Expression& coeff_i{p.second};
-    new_map.emplace(m * m_i, coeff_i);
+    // Multiplying by m preserves the monomial order, so each new entry
+    // belongs at the end of new_map.
+    new_map.emplace_hint(new_map.end(), m * m_i, coeff_i);
   }
   monomial_to_coefficient_map_ = std::move(new_map);
   indeterminates_ += m.GetVariables();
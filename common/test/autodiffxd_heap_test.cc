@@ -28,6 +28,31 @@ class AutoDiffXdHeapTest : public ::testing::Test {
 // evidence that the technique is strictly necessary. However, future
 // implementations may be vulnerable to dead-code elimination.
 
+// Binary operations use either operand as storage, when it is a temporary.
+TEST_F(AutoDiffXdHeapTest, Addition) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) + y_;
+  volatile auto w = y_ + (x_ + y_);
+}
+
+TEST_F(AutoDiffXdHeapTest, Subtraction) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) - y_;
+  volatile auto w = y_ - (x_ + y_);
+}
+
+TEST_F(AutoDiffXdHeapTest, Multiplication) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) * y_;
+  volatile auto w = y_ * (x_ + y_);
+}
+
+TEST_F(AutoDiffXdHeapTest, Division) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) / y_;
+  volatile auto w = y_ / (x_ + y_);
+}
+
 TEST_F(AutoDiffXdHeapTest, Abs) {
   LimitMalloc guard({.max_num_allocations = 1, .min_num_allocations = 1});
   volatile auto v = abs(x_ + y_);
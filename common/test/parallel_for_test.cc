@@ -0,0 +1,57 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace internal {
+namespace {
+
+// Every index is visited exactly once, by contiguous blocks whose thread
+// numbers increase with the indices.
+GTEST_TEST(StaticParallelForRangeTest, VisitsEveryIndexOnce) {
+  for (const int num_items : {0, 1, 7, 64, 101}) {
+    for (const int num_threads : {1, 2, 3, 8, 200}) {
+      std::vector<int> visits(num_items, 0);
+      std::vector<int> owner(num_items, -1);
+      StaticParallelForRange(num_items, num_threads,
+                             [&](int thread_num, int begin, int end) {
+                               for (int i = begin; i < end; ++i) {
+                                 ++visits[i];
+                                 owner[i] = thread_num;
+                               }
+                             });
+      for (int i = 0; i < num_items; ++i) {
+        EXPECT_EQ(visits[i], 1);
+        EXPECT_GE(owner[i], 0);
+        EXPECT_LT(owner[i], std::min(num_items, num_threads));
+      }
+      EXPECT_TRUE(std::is_sorted(owner.begin(), owner.end()));
+    }
+  }
+}
+
+// Exceptions thrown on any thread reach the caller.
+GTEST_TEST(StaticParallelForRangeTest, PropagatesExceptions) {
+  for (const int throwing_thread : {0, 2}) {
+    EXPECT_THROW(StaticParallelForRange(
+                     10, 4,
+                     [throwing_thread](int thread_num, int, int) {
+                       if (thread_num == throwing_thread) {
+                         throw std::runtime_error("failure");
+                       }
+                     }),
+                 std::runtime_error);
+  }
+}
+
+GTEST_TEST(StaticParallelForRangeTest, HardwareConcurrency) {
+  EXPECT_GE(GetHardwareConcurrency(), 1);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
@@ -222,6 +222,23 @@ GTEST_TEST(PolynomialTest, TestMakeMonomialsUnique) {
   EXPECT_EQ(poly_squared.GetNumberOfCoefficients(), 3);
 }
 
+// The evaluation must not depend on the order in which the monomials are
+// stored.
+GTEST_TEST(PolynomialTest, EvaluateUnivariateMonomialOrder) {
+  const Polynomiald x("x");
+  const Polynomiald ascending = 1 + 2 * x + 3 * x * x + 4 * x * x * x;
+  const Polynomiald descending = 4 * x * x * x + 3 * x * x + 2 * x + 1;
+  const Polynomiald unordered = 3 * x * x + 1 + 4 * x * x * x + 2 * x;
+  const double t = 1.3;
+  const double expected = 1 + 2 * t + 3 * t * t + 4 * t * t * t;
+  const double expected_derivative = 2 + 6 * t + 12 * t * t;
+  for (const Polynomiald* poly : {&ascending, &descending, &unordered}) {
+    EXPECT_NEAR(poly->EvaluateUnivariate(t), expected, 1e-14);
+    EXPECT_NEAR(poly->EvaluateUnivariate(t, 1), expected_derivative, 1e-14);
+    EXPECT_NEAR(poly->EvaluateUnivariate(t, 3), 24, 1e-14);
+  }
+}
+
 GTEST_TEST(PolynomialTest, Operators) { testOperators<double>(); }
 
 GTEST_TEST(PolynomialTest, Roots) { testRoots<double>(); }
@@ -1,5 +1,7 @@
 #include "drake/common/random.h"
 
+#include <set>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -29,5 +31,70 @@ GTEST_TEST(RandomTest, Seed) {
   }
 }
 
+// Compares the Philox4x32-10 blocks with the known-answer vectors of the
+// reference implementation (Random123).
+GTEST_TEST(RandomTest, PhiloxKnownAnswers) {
+  using internal::Philox4x32;
+  using Block = Philox4x32::Block;
+  EXPECT_EQ(Philox4x32::Evaluate(0, 0, 0),
+            (Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(Philox4x32::Evaluate(~uint64_t{0}, ~uint64_t{0}, ~uint64_t{0}),
+            (Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(Philox4x32::Evaluate(0x299f31d0a4093822, 0x0370734413198a2e,
+                                 0x85a308d3243f6a88),
+            (Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+GTEST_TEST(RandomTest, CounterBased) {
+  RandomGenerator dut = RandomGenerator::MakeCounterBased(1, 2);
+  EXPECT_TRUE(dut.is_counter_based());
+  EXPECT_FALSE(RandomGenerator().is_counter_based());
+
+  // The values are the consecutive blocks of the stream.
+  for (uint64_t counter = 0; counter < 3; ++counter) {
+    for (uint32_t expected : internal::Philox4x32::Evaluate(1, 2, counter)) {
+      EXPECT_EQ(dut(), expected);
+    }
+  }
+
+  // Copies continue from the same position.
+  RandomGenerator copy(dut);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(copy(), dut());
+  }
+
+  // Other seeds and streams differ.
+  const RandomGenerator::result_type first =
+      RandomGenerator::MakeCounterBased(1, 2)();
+  EXPECT_NE(RandomGenerator::MakeCounterBased(3, 2)(), first);
+  EXPECT_NE(RandomGenerator::MakeCounterBased(1, 3)(), first);
+}
+
+GTEST_TEST(RandomTest, Split) {
+  const RandomGenerator parent = RandomGenerator::MakeCounterBased(7);
+  RandomGenerator advanced(parent);
+  for (int i = 0; i < 5; ++i) advanced();
+
+  // The substreams do not depend on the position of the parent, and are
+  // distinct from each other and from the parent.
+  std::set<RandomGenerator::result_type> first_values{
+      RandomGenerator(parent)()};
+  for (uint64_t index = 0; index < 100; ++index) {
+    RandomGenerator child = parent.Split(index);
+    RandomGenerator same_child = advanced.Split(index);
+    EXPECT_TRUE(child.is_counter_based());
+    const RandomGenerator::result_type value = child();
+    EXPECT_EQ(value, same_child());
+    first_values.insert(value);
+  }
+  EXPECT_EQ(first_values.size(), 101);
+
+  // Splitting is hierarchical.
+  EXPECT_NE(parent.Split(1).Split(0)(), parent.Split(0).Split(1)());
+
+  // Only counter-based generators can be split.
+  EXPECT_THROW(RandomGenerator().Split(0), std::exception);
+}
+
 }  // namespace
 }  // namespace drake
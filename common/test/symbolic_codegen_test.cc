@@ -285,6 +285,29 @@ TEST_F(SymbolicCodeGenTest, DenseMatrixExampleInDocumentation) {
                                         2 /* number of columns */, expected));
 }
 
+TEST_F(SymbolicCodeGenTest, CommonSubexpressionScalar) {
+  const Expression shared{x_ + 1};
+  string expected{MakeScalarFunctionCode("f", 1, "(sin(t0) / cos(t0))")};
+  const string header{"double f(const double* p) {\n"};
+  expected.insert(header.size(), "    const double t0 = (1 + p[0]);\n");
+  EXPECT_EQ(CodeGen("f", {x_}, sin(shared) / cos(shared)), expected);
+}
+
+TEST_F(SymbolicCodeGenTest, CommonSubexpressionAcrossMatrixEntries) {
+  Eigen::Matrix<symbolic::Expression, 3, 1> M;
+  const Expression shared{2 + x_ + y_};
+  M(0) = sin(shared);
+  M(1) = cos(shared);
+  // Variables and constants are never hoisted into local variables.
+  M(2) = x_;
+  string expected{MakeDenseMatrixFunctionCode(
+      "f", 2 /* number of input parameters */, 3 /* number of rows */,
+      1 /* number of columns */, {"sin(t0)", "cos(t0)", "p[0]"})};
+  const string header{"void f(const double* p, double* m) {\n"};
+  expected.insert(header.size(), "    const double t0 = (2 + p[0] + p[1]);\n");
+  EXPECT_EQ(CodeGen("f", {x_, y_}, M), expected);
+}
+
 TEST_F(SymbolicCodeGenTest, SparseMatrixColMajor) {
   const Variable x{"x"};
   const Variable y{"y"};
@@ -322,6 +322,27 @@ TEST_F(SymbolicExpansionTest, RepeatedExpandShouldBeNoop) {
   }
 }
 
+TEST_F(SymbolicExpansionTest, RepeatedExpandOfUnexpandedIsMemoized) {
+  const Expression e{(x_ + y_) * (x_ + y_)};
+  const Expression e_expanded{e.Expand()};
+  {
+    LimitMalloc guard;
+    // The expansion of e is memoized in its cell, so expanding e again should
+    // return the same cell without any memory allocation.
+    const Expression e_expanded_again{e.Expand()};
+    EXPECT_PRED2(ExprEqual, e_expanded, e_expanded_again);
+  }
+
+  // A subtree shared by two expressions is expanded only once; the results
+  // remain correct for both.
+  const Expression shared{(x_ + 1) * (y_ - 1)};
+  const Expression e1{sin(shared)};
+  const Expression e2{shared * z_};
+  EXPECT_PRED2(ExprEqual, e1.Expand(), sin(shared.Expand()));
+  EXPECT_TRUE(CheckExpandPreserveEvaluation(e1, 1e-8));
+  EXPECT_TRUE(CheckExpandPreserveEvaluation(e2, 1e-8));
+}
+
 TEST_F(SymbolicExpansionTest, ExpandMultiplicationsWithDivisions) {
   const Expression e1{((x_ + 1) / y_) * (x_ + 3)};
   const Expression e2{(x_ + 3) * ((x_ + 1) / z_)};
@@ -713,6 +713,15 @@ TEST_F(MonomialTest, Multiplication) {
   Monomial m{m1};  // m = m₁
   m *= m2;         // m = m₁ * m₂
   EXPECT_EQ(m, m1 * m2);
+
+  // Interleaved variables: m₄ = xz², m₅ = yz³w, m₄ * m₅ = xyz⁵w.
+  const Monomial m4{{{var_x_, 1}, {var_z_, 2}}};
+  const Monomial m5{{{var_y_, 1}, {var_z_, 3}, {var_w_, 1}}};
+  const Monomial m6{m4 * m5};
+  EXPECT_EQ(m6, Monomial({{var_x_, 1}, {var_y_, 1}, {var_z_, 5}, {var_w_, 1}}));
+  EXPECT_EQ(m6.total_degree(), 8);
+  EXPECT_EQ(m5 * m4, m6);
+  EXPECT_EQ(Monomial{} * m4, m4);
 }
 
 TEST_F(MonomialTest, Pow) {
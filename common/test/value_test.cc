@@ -231,6 +231,23 @@ TYPED_TEST(TypedValueTest, Mutation) {
   EXPECT_EQ(6, erased.get_value<T>());
 }
 
+// SetFrom() reuses the storage of copyable types and does not re-clone
+// cloneable types when setting a value from itself.
+GTEST_TEST(ValueTest, SetFromReusesStorage) {
+  Value<std::vector<double>> value(std::vector<double>(10, 1.0));
+  const double* const data = value.get_value().data();
+  value.SetFrom(Value<std::vector<double>>(std::vector<double>(5, 2.0)));
+  EXPECT_EQ(value.get_value().data(), data);
+  EXPECT_EQ(value.get_value(), std::vector<double>(5, 2.0));
+
+  Value<CloneableInt> cloneable(7);
+  const CloneableInt* const address = &cloneable.get_value();
+  const AbstractValue& erased = cloneable;
+  cloneable.SetFrom(erased);
+  EXPECT_EQ(&cloneable.get_value(), address);
+  EXPECT_EQ(7, cloneable.get_value());
+}
+
 TYPED_TEST(TypedValueTest, BadCast) {
   using T = TypeParam;
   Value<double> value(4);
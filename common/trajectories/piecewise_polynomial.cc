@@ -118,13 +118,16 @@ MatrixX<T> PiecewisePolynomial<T>::DoEvalDerivative(
     const T& t, int derivative_order) const {
   const int segment_index = this->get_segment_index(t);
   const T time = min(max(t, this->start_time()), this->end_time());
+  // The time relative to the segment start is shared by all of the entries.
   Eigen::Matrix<T, PolynomialMatrix::RowsAtCompileTime,
                 PolynomialMatrix::ColsAtCompileTime>
       ret(rows(), cols());
-  for (Eigen::Index row = 0; row < rows(); row++) {
-    for (Eigen::Index col = 0; col < cols(); col++) {
-      ret(row, col) = EvaluateSegmentAbsoluteTime(segment_index, time, row, col,
-                                                  derivative_order);
+  const T segment_time = time - this->start_time(segment_index);
+  const PolynomialMatrix& segment = polynomials_[segment_index];
+  for (Eigen::Index col = 0; col < ret.cols(); col++) {
+    for (Eigen::Index row = 0; row < ret.rows(); row++) {
+      ret(row, col) =
+          segment(row, col).EvaluateUnivariate(segment_time, derivative_order);
     }
   }
   return ret;
@@ -801,72 +804,171 @@ PiecewisePolynomial<T>::CubicHermite(
   return PiecewisePolynomial<T>(polynomials, times);
 }
 
-// Sets up the linear system for solving for the cubic piecewise polynomial
-// coefficients.
-// See the header file for more information.
-template <typename T>
-int PiecewisePolynomial<T>::
-    SetupCubicSplineInteriorCoeffsLinearSystem(
-        const std::vector<T>& breaks,
-        const std::vector<MatrixX<T>>& samples,
-        int row, int col,
-        MatrixX<T>* A,
-        VectorX<T>* b) {
-  const std::vector<T>& times = breaks;
-  const std::vector<MatrixX<T>>& Y = samples;
-  int N = static_cast<int>(times.size());
+namespace {
 
-  DRAKE_DEMAND(A != nullptr);
-  DRAKE_DEMAND(b != nullptr);
-  DRAKE_DEMAND(A->rows() == 4 * (N - 1));
-  DRAKE_DEMAND(A->cols() == 4 * (N - 1));
-  DRAKE_DEMAND(b->rows() == 4 * (N - 1));
+// Solves the tridiagonal system of n rows with the sub-diagonal `a`, the
+// diagonal `b` and the super-diagonal `c` (`a[0]` and `c[n - 1]` are unused)
+// for the right-hand sides `d`, in place, with the Thomas algorithm in O(n).
+// The system must not need pivoting, e.g. it must be diagonally dominant. The
+// right-hand side of a row can be a matrix, to solve for all the elements of
+// the samples of a spline at once.
+template <typename T, typename Rhs>
+void SolveTridiagonal(const std::vector<T>& a, std::vector<T> b,
+                      const std::vector<T>& c, std::vector<Rhs>* d) {
+  const int n = static_cast<int>(b.size());
+  std::vector<Rhs>& x = *d;
+  for (int i = 1; i < n; ++i) {
+    const T w = a[i] / b[i - 1];
+    b[i] -= w * c[i - 1];
+    x[i] -= w * x[i - 1];
+  }
+  x[n - 1] /= b[n - 1];
+  for (int i = n - 2; i >= 0; --i) {
+    x[i] = (x[i] - c[i] * x[i + 1]) / b[i];
+  }
+}
 
-  int row_idx = 0;
-  MatrixX<T>& Aref = *A;
-  VectorX<T>& bref = *b;
+// Solves the cyclic tridiagonal system of n rows, whose row i couples the
+// unknowns i - 1, i and i + 1 modulo n with the coefficients `a[i]`, `b[i]`
+// and `c[i]`, for the right-hand sides `d`, in place. As a rank one
+// modification of a tridiagonal system, it is solved in O(n) with the
+// Sherman-Morrison formula, see Section 2.7 of Press et al., "Numerical
+// Recipes", 3rd ed.
+template <typename T>
+void SolveCyclicTridiagonal(const std::vector<T>& a, const std::vector<T>& b,
+                            const std::vector<T>& c,
+                            std::vector<MatrixX<T>>* d) {
+  const int n = static_cast<int>(b.size());
+  std::vector<MatrixX<T>>& x = *d;
+  if (n == 2) {
+    // The corners are the off-diagonal entries themselves.
+    const T A01 = a[0] + c[0];
+    const T A10 = a[1] + c[1];
+    const T det = b[0] * b[1] - A01 * A10;
+    const MatrixX<T> x0 = (b[1] * x[0] - A01 * x[1]) / det;
+    x[1] = (b[0] * x[1] - A10 * x[0]) / det;
+    x[0] = x0;
+    return;
+  }
+  const T alpha = a[0];
+  const T beta = c[n - 1];
+  const T gamma = -b[0];
+  std::vector<T> b_modified = b;
+  b_modified[0] = b[0] - gamma;
+  b_modified[n - 1] = b[n - 1] - alpha * beta / gamma;
+  SolveTridiagonal(a, b_modified, c, d);
+  std::vector<T> z(n, T(0));
+  z[0] = gamma;
+  z[n - 1] = beta;
+  SolveTridiagonal(a, b_modified, c, &z);
+  const T z_factor = 1 + z[0] + alpha * z[n - 1] / gamma;
+  const MatrixX<T> factor = (x[0] + alpha * x[n - 1] / gamma) / z_factor;
+  for (int i = 0; i < n; ++i) {
+    x[i] -= z[i] * factor;
+  }
+}
 
+// The end conditions of CubicSplineSampleDots().
+enum class SplineEndCondition { kGivenSampleDots, kPeriodic, kNotAKnot };
+
+// Computes the first derivatives at the breaks of the cubic spline with
+// continuous second derivatives through the samples, from which the spline is
+// the CubicHermite() one. The continuity of the second derivative at a break k
+// between the segments of durations h₀ and h₁ and slopes δ₀ and δ₁ is
+//   h₁ ẏₖ₋₁ + 2 (h₀ + h₁) ẏₖ + h₀ ẏₖ₊₁ = 3 (h₁ δ₀ + h₀ δ₁),
+// so the first derivatives solve a tridiagonal system, together with the end
+// conditions: the given `sample_dot_at_start` and `sample_dot_at_end`, the
+// continuity of the first and second derivatives between the end and the
+// start, or the continuity of the third derivatives at the second and the
+// penultimate breaks, see Section 3.3 of Moler, "Numerical Computing with
+// MATLAB". All the elements of the samples are solved for at once, in
+// O(number of breaks × elements).
+template <typename T>
+std::vector<MatrixX<T>> CubicSplineSampleDots(
+    const std::vector<T>& times, const std::vector<MatrixX<T>>& Y,
+    SplineEndCondition end_condition,
+    const MatrixX<T>* sample_dot_at_start = nullptr,
+    const MatrixX<T>* sample_dot_at_end = nullptr) {
+  const int N = static_cast<int>(times.size());
+  std::vector<T> h(N - 1);
+  std::vector<MatrixX<T>> slope(N - 1);
   for (int i = 0; i < N - 1; ++i) {
-    const T dt = times[i + 1] - times[i];
-
-    // y_i(x_i) = a0i = Y[i]
-    Aref(row_idx, 4 * i) = 1;
-    bref(row_idx++) = Y[i](row, col);
-
-    // y_i(x_{i+1}) = y_{i+1}(x_{i}) =>
-    // a0i + a1i*(x_{i+1} - x_i) + a2i(x_{i+1} - x_i)^2 + a3i(x_{i+1} -
-    // x_i)^3 = a0{i+1}
-    Aref(row_idx, 4 * i + 0) = 1;
-    Aref(row_idx, 4 * i + 1) = dt;
-    Aref(row_idx, 4 * i + 2) = dt * dt;
-    Aref(row_idx, 4 * i + 3) = dt * dt * dt;
-    if (i != N - 2) {
-      Aref(row_idx++, 4 * (i + 1)) = -1;
-    } else {
-      bref(row_idx++) = Y[N - 1](row, col);
+    h[i] = times[i + 1] - times[i];
+    slope[i] = (Y[i + 1] - Y[i]) / h[i];
+  }
+  std::vector<T> a, b, c;
+  std::vector<MatrixX<T>> Ydot;
+  // Appends the row of the continuity of the second derivative at the break
+  // between the segments `left` and `right`.
+  auto add_interior_row = [&](int left, int right) {
+    a.push_back(h[right]);
+    b.push_back(2 * (h[left] + h[right]));
+    c.push_back(h[left]);
+    Ydot.push_back(3 * (h[right] * slope[left] + h[left] * slope[right]));
+  };
+
+  switch (end_condition) {
+    case SplineEndCondition::kGivenSampleDots: {
+      DRAKE_DEMAND(sample_dot_at_start != nullptr);
+      DRAKE_DEMAND(sample_dot_at_end != nullptr);
+      // The unknowns are the first derivatives at the interior breaks.
+      for (int k = 1; k < N - 1; ++k) {
+        add_interior_row(k - 1, k);
+      }
+      if (N > 2) {
+        Ydot.front() -= a.front() * (*sample_dot_at_start);
+        Ydot.back() -= c.back() * (*sample_dot_at_end);
+        SolveTridiagonal(a, b, c, &Ydot);
+      }
+      Ydot.insert(Ydot.begin(), *sample_dot_at_start);
+      Ydot.push_back(*sample_dot_at_end);
+      break;
     }
-
-    // y_i'(x_{i+1}) = y_{i+1}'(x_{i}) =>
-    // a1i + 2*a2i(x_{i+1} - x_i) + 3*a3i(x_{i+1} - x_i)^2 = a1{i+1}
-    if (i != N - 2) {
-      Aref(row_idx, 4 * i + 1) = 1;
-      Aref(row_idx, 4 * i + 2) = 2 * dt;
-      Aref(row_idx, 4 * i + 3) = 3 * dt * dt;
-      Aref(row_idx++, 4 * (i + 1) + 1) = -1;
+    case SplineEndCondition::kPeriodic: {
+      // The unknowns are the first derivatives at all the breaks but the
+      // last, which is the same as the first.
+      for (int k = 0; k < N - 1; ++k) {
+        add_interior_row(k == 0 ? N - 2 : k - 1, k);
+      }
+      SolveCyclicTridiagonal(a, b, c, &Ydot);
+      Ydot.push_back(Ydot.front());
+      break;
     }
-
-    if (i != N - 2) {
-      // y_i''(x_{i+1}) = y_{i+1}''(x_{i}) =>
-      // 2*a2i + 6*a3i(x_{i+1} - x_i) = 2*a2{i+1}
-      Aref(row_idx, 4 * i + 2) = 2;
-      Aref(row_idx, 4 * i + 3) = 6 * dt;
-      Aref(row_idx++, 4 * (i + 1) + 2) = -2;
+    case SplineEndCondition::kNotAKnot: {
+      DRAKE_DEMAND(N >= 3);
+      if (N == 3) {
+        // The spline is the parabola through the three samples.
+        const T H = h[0] + h[1];
+        Ydot.push_back(((2 * h[0] + h[1]) * slope[0] - h[0] * slope[1]) / H);
+        Ydot.push_back((h[1] * slope[0] + h[0] * slope[1]) / H);
+        Ydot.push_back(((2 * h[1] + h[0]) * slope[1] - h[1] * slope[0]) / H);
+        break;
+      }
+      const T H_start = h[0] + h[1];
+      a.push_back(0);
+      b.push_back(h[1]);
+      c.push_back(H_start);
+      Ydot.push_back(((h[0] + 2 * H_start) * h[1] * slope[0] +
+                      h[0] * h[0] * slope[1]) / H_start);
+      for (int k = 1; k < N - 1; ++k) {
+        add_interior_row(k - 1, k);
+      }
+      const T H_end = h[N - 3] + h[N - 2];
+      a.push_back(H_end);
+      b.push_back(h[N - 3]);
+      c.push_back(0);
+      Ydot.push_back((h[N - 2] * h[N - 2] * slope[N - 3] +
+                      (2 * H_end + h[N - 2]) * h[N - 3] * slope[N - 2]) /
+                     H_end);
+      SolveTridiagonal(a, b, c, &Ydot);
+      break;
     }
   }
-  DRAKE_DEMAND(row_idx == 4 * (N - 1) - 2);
-  return row_idx;
+  return Ydot;
 }
 
+}  // namespace
+
 // Makes a cubic piecewise polynomial.
 // Internal sample points have continuous values, first and second derivatives,
 // and first derivatives at both end points are set to `sample_dot_at_start`
@@ -885,7 +987,6 @@ PiecewisePolynomial<T>::CubicWithContinuousSecondDerivatives(
 
   CheckSplineGenerationInputValidityOrThrow(times, Y, 2);
 
-  int N = static_cast<int>(times.size());
   int rows = Y.front().rows();
   int cols = Y.front().cols();
 
@@ -897,45 +998,10 @@ PiecewisePolynomial<T>::CubicWithContinuousSecondDerivatives(
     throw std::runtime_error("Ydot_end and Y dimension mismatch");
   }
 
-  std::vector<PolynomialMatrix> polynomials(N - 1);
-  for (int i = 0; i < N - 1; ++i) {
-    polynomials[i].resize(rows, cols);
-  }
-
-  MatrixX<T> A(4 * (N - 1), 4 * (N - 1));
-  VectorX<T> b(4 * (N - 1));
-  VectorX<T> solution;
-
-  A.setZero();
-  b.setZero();
-
-  // Sets up a linear equation to solve for the coefficients.
-  for (int j = 0; j < rows; ++j) {
-    for (int k = 0; k < cols; ++k) {
-      int row_idx =
-          SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, j, k, &A, &b);
-
-      // Endpoints' velocity matches the given ones.
-      A(row_idx, 1) = 1;
-      b(row_idx++) = Ydot_start(j, k);
-
-      A(row_idx, 4 * (N - 2) + 1) = 1;
-      A(row_idx, 4 * (N - 2) + 2) = 2 * (times[N - 1] - times[N - 2]);
-      A(row_idx, 4 * (N - 2) + 3) =
-          3 * (times[N - 1] - times[N - 2]) * (times[N - 1] - times[N - 2]);
-      b(row_idx++) = Ydot_end(j, k);
-
-      // TODO(siyuan.feng): Should switch to a sparse solver.
-      solution = A.colPivHouseholderQr().solve(b);
-
-      for (int i = 0; i < N - 1; ++i) {
-        polynomials[i](j, k) =
-            Polynomial<T>(solution.template segment<4>(4 * i));
-      }
-    }
-  }
-
-  return PiecewisePolynomial<T>(polynomials, times);
+  return CubicHermite(
+      times, Y,
+      CubicSplineSampleDots(times, Y, SplineEndCondition::kGivenSampleDots,
+                            &Ydot_start, &Ydot_end));
 }
 
 // Makes a cubic piecewise polynomial.
@@ -955,80 +1021,12 @@ PiecewisePolynomial<T>::CubicWithContinuousSecondDerivatives(
   const std::vector<MatrixX<T>>& Y = samples;
   CheckSplineGenerationInputValidityOrThrow(times, Y, 3);
 
-  int N = static_cast<int>(times.size());
-  int rows = Y.front().rows();
-  int cols = Y.front().cols();
-
-  std::vector<PolynomialMatrix> polynomials(N - 1);
-  for (int i = 0; i < N - 1; ++i) {
-    polynomials[i].resize(rows, cols);
-  }
-
-  MatrixX<T> A(4 * (N - 1), 4 * (N - 1));
-  VectorX<T> b(4 * (N - 1));
-  VectorX<T> solution;
-
-  A.setZero();
-  b.setZero();
-
-  // Sets up a linear equation to solve for the coefficients.
-  for (int j = 0; j < rows; ++j) {
-    for (int k = 0; k < cols; ++k) {
-      int row_idx =
-          SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, j, k, &A, &b);
-
-      if (periodic_end_condition) {
-        // Time during the last segment.
-        const T end_dt = times[times.size() - 1] - times[times.size() - 2];
-        // Enforce velocity between end-of-last and beginning-of-first segments
-        // is continuous.
-        A(row_idx, 1) = -1;  // Linear term of 1st segment.
-        A(row_idx, 4 * (N - 2) + 1) = 1;  // Linear term of last segment.
-        A(row_idx, 4 * (N - 2) + 2) = 2 * end_dt;  // Squared term of last
-                                                   // segment.
-        A(row_idx, 4 * (N - 2) + 3) = 3 * end_dt * end_dt;  // Cubic term of
-                                                            // last segment.
-        b(row_idx++) = 0;
-
-        // Enforce that acceleration between end-of-last and beginning-of-first
-        // segments is continuous.
-        A(row_idx, 2) = -2;  // Quadratic term of 1st segment.
-        A(row_idx, 4 * (N - 2) + 2) = 2;  // Quadratic term of last segment.
-        A(row_idx, 4 * (N - 2) + 3) = 6 * end_dt;  // Cubic term of last
-                                                   // segment.
-        b(row_idx++) = 0;
-      } else {
-        if (N > 3) {
-          // Ydddot(times[1]) is continuous.
-          A(row_idx, 3) = 1;  // Cubic term of 1st segment.
-          A(row_idx, 4 + 3) = -1;  // Cubic term of 2nd segment.
-          b(row_idx++) = 0;
-
-          // Ydddot(times[N-2]) is continuous.
-          A(row_idx, 4 * (N - 3) + 3) = 1;
-          A(row_idx, 4 * (N - 2) + 3) = -1;
-          b(row_idx++) = 0;
-        } else {
-          // Set Jerk to zero if only have 3 points, becomes a quadratic.
-          A(row_idx, 3) = 1;
-          b(row_idx++) = 0;
-
-          A(row_idx, 4 + 3) = 1;
-          b(row_idx++) = 0;
-        }
-      }
-
-      // TODO(siyuan.feng): Should switch to a sparse solver.
-      solution = A.colPivHouseholderQr().solve(b);
-
-      for (int i = 0; i < N - 1; ++i) {
-        polynomials[i](j, k) =
-            Polynomial<T>(solution.template segment<4>(4 * i));
-      }
-    }
-  }
-
-  return PiecewisePolynomial<T>(polynomials, times);
+  return CubicHermite(
+      times, Y,
+      CubicSplineSampleDots(times, Y,
+                            periodic_end_condition
+                                ? SplineEndCondition::kPeriodic
+                                : SplineEndCondition::kNotAKnot));
 }
 
 template <typename T>
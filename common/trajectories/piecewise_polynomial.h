@@ -793,37 +793,6 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
   static Eigen::Matrix<T, 4, 1> ComputeCubicSplineCoeffs(const T& dt, T y0,
                                                          T y1, T yd0, T yd1);
 
-  // For a cubic spline, there are 4 unknowns for each segment Pi, namely
-  // the coefficients for Pi = a0 + a1 * t + a2 * t^2 + a3 * t^3.
-  // Let N be the size of breaks and samples, there are N-1 segments,
-  // and thus 4*(N-1) unknowns to fully specified a cubic spline for the given
-  // data.
-  //
-  // If we are also given N sample_dot (velocity), each Pi will be fully
-  // specified by (samples[i], sample_dot[i]) and (samples[i+1],
-  // sample_dot[i+1]).  When sample_dot are not specified, we make the design
-  // choice to enforce continuity up to the second order (Yddot) for
-  // the interior points, i.e. Pi'(duration_i) = Pi+1'(0), and
-  // Pi''(duration_i) = Pi+1''(0), where ' means time derivative, and
-  // duration_i = breaks[i+1] - breaks[i] is the duration for the ith segment.
-  //
-  // At this point, we have 2 * (N - 1) position constraints:
-  // Pi(0) = samples[i], for i in [0, N - 2]
-  // Pi(duration_i) = samples[i+1], for i in [0, N - 2]
-  // N - 2 velocity constraints for the interior points:
-  // Pi'(duration_i) = Pi+1'(0), for i in [0, N - 3]
-  // N - 2 acceleration constraints for the interior points:
-  // Pi''(duration_i) = Pi+1''(0), for i in [0, N - 3]
-  //
-  // These sum up to 4 * (N - 1) - 2. This function sets up the above
-  // constraints. There are still 2 constraints missing, which can be resolved
-  // by various end point conditions (velocity at the end points /
-  // "not-a-sample" / etc). These will be specified by the callers.
-  static int SetupCubicSplineInteriorCoeffsLinearSystem(
-      const std::vector<T>& breaks,
-      const std::vector<MatrixX<T>>& samples, int row, int col,
-      MatrixX<T>* A, VectorX<T>* b);
-
   // Throws std::runtime_error if
   // `breaks` and `samples` have different length,
   // `breaks` is not strictly increasing,
@@ -500,6 +500,34 @@ GTEST_TEST(SplineTests, RandomizedCubicSplineTest) {
   }
 }
 
+// The slopes of the cubic splines are found with a tridiagonal solve, so that
+// splines through many samples stay cheap and accurate.
+GTEST_TEST(SplineTests, LongCubicSplineTest) {
+  default_random_engine generator(456);
+  std::uniform_real_distribution<double> duration(0.5, 1);
+  const int N = 2000;
+  std::vector<double> T(N, 0);
+  for (int i = 1; i < N; ++i) T[i] = T[i - 1] + duration(generator);
+  std::vector<MatrixX<double>> Y(N);
+  for (int i = 0; i < N; ++i) Y[i] = MatrixX<double>::Random(2, 1);
+  Y.back() = Y.front();
+
+  for (bool periodic_end : {false, true}) {
+    const PiecewisePolynomial<double> spline =
+        PiecewisePolynomial<double>::CubicWithContinuousSecondDerivatives(
+            T, Y, periodic_end);
+    EXPECT_TRUE(CheckContinuity(spline, 1e-8, 2));
+    EXPECT_TRUE(CheckInterpolatedValuesAtBreakTime(spline, T, Y, 1e-8));
+    if (periodic_end) {
+      for (int derivative_order : {1, 2}) {
+        EXPECT_TRUE(CompareMatrices(
+            spline.EvalDerivative(T.front(), derivative_order),
+            spline.EvalDerivative(T.back(), derivative_order), 1e-6));
+      }
+    }
+  }
+}
+
 GTEST_TEST(SplineTests, CubicSplineSize2) {
   std::vector<double> T = {1, 2};
   std::vector<MatrixX<double>> Y(2, MatrixX<double>::Zero(1, 1));
@@ -164,6 +164,13 @@ class AbstractValue {
 /// }
 /// @endcode
 ///
+/// Copyable types are stored directly within the %Value object, so that
+/// constructing or cloning a %Value<T> performs a single heap allocation and
+/// set_value() and SetFrom() use T's copy-assignment operator, which allows T
+/// to reuse its own storage (e.g., the capacity of a std::vector).
+/// Cloneable-only types are stored on the heap and are cloned on every
+/// set_value() and SetFrom(), except when setting a value from itself.
+///
 /// (Advanced.) User-defined classes with additional features may subclass
 /// Value, but should take care to override Clone().
 ///
@@ -768,6 +775,8 @@ std::unique_ptr<AbstractValue> Value<T>::Clone() const {
 
 template <typename T>
 void Value<T>::SetFrom(const AbstractValue& other) {
+  // For cloneable types, this check avoids a needless Clone().
+  if (&other == this) { return; }
   value_ = Traits::to_storage(other.get_value<T>());
 }
 
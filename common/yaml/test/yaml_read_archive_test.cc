@@ -515,6 +515,34 @@ TEST_P(YamlReadArchiveTest, EigenMissing) {
   EXPECT_EQ(mn.value(0, 0), kNominalDouble);
 }
 
+// Returns the `!!binary` YAML encoding of the given coefficients.
+std::string EncodeBinary(const std::vector<double>& coefficients) {
+  return "!!binary " + YAML::EncodeBase64(
+      reinterpret_cast<const unsigned char*>(coefficients.data()),
+      coefficients.size() * sizeof(double));
+}
+
+TEST_P(YamlReadArchiveTest, EigenBinary) {
+  using Matrix34d = Eigen::Matrix<double, 3, 4>;
+  const std::string vector = EncodeBinary({1.0, 2.0, 3.0});
+  const auto& vec = AcceptNoThrow<EigenVecStruct>(LoadSingleValue(vector));
+  const auto& vec3 = AcceptNoThrow<EigenVec3Struct>(LoadSingleValue(vector));
+  EXPECT_TRUE(drake::CompareMatrices(vec.value, Eigen::Vector3d(1, 2, 3)));
+  EXPECT_TRUE(drake::CompareMatrices(vec3.value, Eigen::Vector3d(1, 2, 3)));
+
+  // The coefficients of a matrix are in row-major order.
+  const std::string matrix =
+      EncodeBinary({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+  const auto& mat34 =
+      AcceptNoThrow<EigenMatrix34Struct>(LoadSingleValue(matrix));
+  EXPECT_TRUE(drake::CompareMatrices(mat34.value,
+      (Matrix34d{} << 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11).finished()));
+
+  const auto& empty = AcceptNoThrow<EigenVecStruct>(LoadSingleValue(
+      "!!binary ''"));
+  EXPECT_EQ(empty.value.size(), 0);
+}
+
 TEST_P(YamlReadArchiveTest, Nested) {
   const auto& x = AcceptNoThrow<OuterStruct>(Load(R"""(
 doc:
@@ -919,6 +947,38 @@ doc:
       " has inconsistent cols dimensions entry for Eigen::Matrix.* value\\.");
 }
 
+// This finds binary data that does not fit the Eigen::Vector or Eigen::Matrix
+// that was wanted.
+TEST_P(YamlReadArchiveTest, VisitEigenFoundBadBinary) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AcceptIntoDummy<EigenVec3Struct>(LoadSingleValue(
+          EncodeBinary({1.0, 2.0}))),
+      std::runtime_error,
+      "YAML node of type Map \\(with size 1 and keys \\{value\\}\\)"
+      " has 2 binary coefficients \\(wanted 3x1\\)"
+      " entry for Eigen::Vector3d value\\.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AcceptIntoDummy<EigenMatrix34Struct>(LoadSingleValue(
+          EncodeBinary({1.0, 2.0}))),
+      std::runtime_error,
+      ".* has 2 binary coefficients \\(wanted 3x4\\) entry for .*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AcceptIntoDummy<EigenVecStruct>(LoadSingleValue("!!binary AAAA")),
+      std::runtime_error,
+      ".* has 3 bytes of binary data \\(wanted a multiple of 8\\) entry for "
+      "Eigen::VectorXd value\\.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AcceptIntoDummy<EigenVecStruct>(LoadSingleValue("!!binary '*'")),
+      std::runtime_error,
+      ".* has invalid base64 data entry for Eigen::VectorXd value\\.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AcceptIntoDummy<EigenMatrixStruct>(LoadSingleValue(
+          EncodeBinary({1.0, 2.0}))),
+      std::runtime_error,
+      ".* has binary data \\(wanted a fixed number of rows or cols\\) entry "
+      "for Eigen::MatrixXd value\\.");
+}
+
 // This finds nothing when a sub-structure was wanted.
 TEST_P(YamlReadArchiveTest, VisitStructFoundNothing) {
   const YAML::Node node = Load(R"""(
@@ -2,16 +2,19 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <map>
 #include <optional>
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#include "yaml-cpp/binary.h"
 #include "yaml-cpp/yaml.h"
 #include <Eigen/Core>
 #include <fmt/format.h>
@@ -62,6 +65,18 @@ namespace yaml {
 ///
 /// YAML's "merge keys" (https://yaml.org/type/merge.html) are supported.
 ///
+/// Eigen vectors and matrices of arithmetic scalars may also be given as
+/// packed binary data, i.e., a base64 scalar with YAML's `!!binary` tag that
+/// holds the coefficients in row-major order and in the byte order of the
+/// host.  For large arrays, this is much more compact and faster to load than
+/// a Sequence of numbers.  The dimensions are inferred from the size of the
+/// data, so a matrix needs at least one fixed dimension:
+/// @code{yaml}
+/// doc:
+///   # The same as [1.0, 2.0].
+///   bar: !!binary AAAAAAAA8D8AAAAAAAAAQA==
+/// @endcode
+///
 /// For inspiration and background, see:
 /// https://www.boost.org/doc/libs/release/libs/serialization/doc/tutorial.html
 class YamlReadArchive final {
@@ -247,6 +262,9 @@ class YamlReadArchive final {
   // For Eigen::Vector.
   template <typename NVP, typename T, int Rows>
   void DoVisit(const NVP& nvp, const Eigen::Matrix<T, Rows, 1>&, int32_t) {
+    if (this->VisitBinaryMatrix(nvp.name(), nvp.value())) {
+      return;
+    }
     if (Rows >= 0) {
       this->VisitArray(nvp.name(), Rows, nvp.value()->data());
     } else {
@@ -257,6 +275,9 @@ class YamlReadArchive final {
   // For Eigen::Matrix.
   template <typename NVP, typename T, int Rows, int Cols>
   void DoVisit(const NVP& nvp, const Eigen::Matrix<T, Rows, Cols>&, int32_t) {
+    if (this->VisitBinaryMatrix(nvp.name(), nvp.value())) {
+      return;
+    }
     this->VisitMatrix(nvp.name(), nvp.value());
   }
 
@@ -397,13 +418,29 @@ class YamlReadArchive final {
           sub_node.size(), size));
     }
     for (size_t i = 0; i < size; ++i) {
-      const std::string key = fmt::format("{}[{}]", name, i);
       const YAML::Node value = sub_node[i];
+      if (VisitScalarItem(value, &data[i])) { continue; }
+      const std::string key = fmt::format("{}[{}]", name, i);
       YamlReadArchive item_archive(key.c_str(), &value, this);
       item_archive.Visit(drake::MakeNameValue(key.c_str(), &data[i]));
     }
   }
 
+  // Sets `item` directly from a Scalar `value`, when `T` is a type that would
+  // be read by VisitScalar() anyway.  This skips the construction of the item
+  // archive, which dominates the cost of reading long sequences of numbers.
+  // Returns false when `value` must be visited through an item archive.
+  template <typename T>
+  static bool VisitScalarItem(const YAML::Node& value, T* item) {
+    if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>) {
+      if (value.Type() == YAML::NodeType::Scalar) {
+        *item = value.template as<T>();
+        return true;
+      }
+    }
+    return false;
+  }
+
   template <typename NVP>
   void VisitVector(const NVP& nvp) {
     const auto& sub_node = GetSubNode(nvp.name(), YAML::NodeType::Sequence);
@@ -451,15 +488,74 @@ class YamlReadArchive final {
 
     // Parse.
     for (size_t i = 0; i < rows; ++i) {
+      const YAML::Node one_row = sub_node[i];
       for (size_t j = 0; j < cols; ++j) {
+        const YAML::Node value = one_row[j];
+        if (VisitScalarItem(value, &storage(i, j))) { continue; }
         const std::string key = fmt::format("{}[{}][{}]", name, i, j);
-        const YAML::Node value = sub_node[i][j];
         YamlReadArchive item_archive(key.c_str(), &value, this);
         item_archive.Visit(drake::MakeNameValue(key.c_str(), &storage(i, j)));
       }
     }
   }
 
+  // If the YAML value is packed binary data (see the class overview), sets
+  // `matrix` from it and returns true.  Otherwise, returns false and leaves
+  // the YAML value to be visited as a Sequence.
+  template <typename T, int Rows, int Cols>
+  bool VisitBinaryMatrix(const char* name,
+                         Eigen::Matrix<T, Rows, Cols>* matrix) {
+    if constexpr (!std::is_arithmetic_v<T>) {
+      return false;
+    } else {
+      const YAML::Node sub_node = MaybeGetSubNode(name);
+      if (!sub_node || !sub_node.IsScalar() ||
+          sub_node.Tag() != "tag:yaml.org,2002:binary") {
+        return false;
+      }
+      const std::string& encoded = sub_node.Scalar();
+      const std::vector<unsigned char> bytes = YAML::DecodeBase64(encoded);
+      if (bytes.empty() && !encoded.empty()) {
+        ReportError("has invalid base64 data");
+      }
+      if (bytes.size() % sizeof(T) != 0) {
+        ReportError(fmt::format(
+            "has {} bytes of binary data (wanted a multiple of {})",
+            bytes.size(), sizeof(T)));
+      }
+      const size_t size = bytes.size() / sizeof(T);
+      // Infer the dynamic dimension (if any) from the size.
+      size_t rows = Rows;
+      size_t cols = Cols;
+      if (Rows == Eigen::Dynamic && Cols == Eigen::Dynamic) {
+        ReportError("has binary data (wanted a fixed number of rows or cols)");
+      } else if (Rows == Eigen::Dynamic) {
+        rows = size / cols;
+      } else if (Cols == Eigen::Dynamic) {
+        cols = rows > 0 ? size / rows : 0;
+      }
+      if (rows * cols != size) {
+        if (Rows >= 0 && Cols >= 0) {
+          ReportError(fmt::format(
+              "has {} binary coefficients (wanted {}x{})", size, Rows, Cols));
+        } else {
+          ReportError(fmt::format(
+              "has {} binary coefficients (wanted a multiple of {})",
+              size, std::max(Rows, Cols)));
+        }
+      }
+      matrix->resize(rows, cols);
+      const unsigned char* data = bytes.data();
+      for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+          std::memcpy(&(*matrix)(i, j), data, sizeof(T));
+          data += sizeof(T);
+        }
+      }
+      return true;
+    }
+  }
+
   template <typename Key, typename Value, typename NVP>
   void VisitMap(const NVP& nvp) {
     static_assert(std::is_same<Key, std::string>::value,
@@ -479,7 +575,10 @@ class YamlReadArchive final {
         DRAKE_DEMAND(inserted == true);
       }
       Value& newvalue = newiter->second;
-      YamlReadArchive item_archive(&sub_node, this);
+      // Pass the item's value directly, instead of looking up the key in the
+      // whole map again (which is linear in its size for yaml-cpp).
+      const YAML::Node& value = yaml_key_value.second;
+      YamlReadArchive item_archive(key.c_str(), &value, this);
       item_archive.Visit(drake::MakeNameValue(key.c_str(), &newvalue));
     }
   }
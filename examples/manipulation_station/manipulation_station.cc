@@ -151,6 +151,24 @@ multibody::ModelInstanceIndex AddAndWeldModelFrom(
   return new_model;
 }
 
+// Connects the geometry query input of `camera`, which is either an
+// RgbdSensor or an RgbdSensorDiscrete, and exports its image outputs using
+// the station's port names.
+template <typename Camera>
+void ConnectAndExportCamera(const std::string& camera_name,
+                            const SceneGraph<double>& scene_graph,
+                            const Camera& camera,
+                            systems::DiagramBuilder<double>* builder) {
+  builder->Connect(scene_graph.get_query_output_port(),
+                   camera.query_object_input_port());
+  builder->ExportOutput(camera.color_image_output_port(),
+                        camera_name + "_rgb_image");
+  builder->ExportOutput(camera.depth_image_16U_output_port(),
+                        camera_name + "_depth_image");
+  builder->ExportOutput(camera.label_image_output_port(),
+                        camera_name + "_label_image");
+}
+
 }  // namespace internal
 
 template <typename T>
@@ -695,17 +713,19 @@ void ManipulationStation<T>::Finalize(
       const RigidTransform<double> X_PC =
           info.parent_frame->GetFixedPoseInBodyFrame() * info.X_PC;
 
-      auto camera = builder.template AddSystem<systems::sensors::RgbdSensor>(
+      auto camera = std::make_unique<systems::sensors::RgbdSensor>(
           parent_body_id.value(), X_PC, info.properties);
-      builder.Connect(scene_graph_->get_query_output_port(),
-                      camera->query_object_input_port());
-
-      builder.ExportOutput(camera->color_image_output_port(),
-                           camera_name + "_rgb_image");
-      builder.ExportOutput(camera->depth_image_16U_output_port(),
-                           camera_name + "_depth_image");
-      builder.ExportOutput(camera->label_image_output_port(),
-                           camera_name + "_label_image");
+      if (camera_update_period_ > 0) {
+        const auto* discrete_camera =
+            builder.template AddSystem<systems::sensors::RgbdSensorDiscrete>(
+                std::move(camera), camera_update_period_);
+        internal::ConnectAndExportCamera(camera_name, *scene_graph_,
+                                         *discrete_camera, &builder);
+      } else {
+        internal::ConnectAndExportCamera(camera_name, *scene_graph_,
+                                         *builder.AddSystem(std::move(camera)),
+                                         &builder);
+      }
     }
   }
 
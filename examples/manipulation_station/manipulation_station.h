@@ -451,6 +451,22 @@ class ManipulationStation : public systems::Diagram<T> {
     iiwa_ki_ = ki;
   }
 
+  /// Sets the period at which the cameras render their images. By default
+  /// (`period` = 0) the cameras render whenever their image outputs are
+  /// evaluated, e.g., every time a downstream system reads them. With a
+  /// positive `period`, each camera is instead wrapped in an
+  /// systems::sensors::RgbdSensorDiscrete that renders once per period and
+  /// holds its images in between, which can greatly reduce the cost of
+  /// simulating the station when images are consumed at a high rate. The
+  /// names of the camera output ports are the same for both options.
+  /// @throws exception if Finalize() has been called or if `period` is
+  /// negative.
+  void SetCameraUpdatePeriod(double period) {
+    DRAKE_THROW_UNLESS(!plant_->is_finalized());
+    DRAKE_THROW_UNLESS(period >= 0);
+    camera_update_period_ = period;
+  }
+
  private:
   // Struct defined to store information about the how to parse and add a model.
   struct ModelInformation {
@@ -499,6 +515,9 @@ class ManipulationStation : public systems::Diagram<T> {
 
   // Registered camera related information.
   std::map<std::string, CameraInformation> camera_information_;
+  // The period of the discrete camera updates, or zero for cameras that
+  // render whenever their outputs are evaluated.
+  double camera_update_period_{0};
 
   // These are kp and kd gains for iiwa and wsg controllers.
   VectorX<double> iiwa_kp_;
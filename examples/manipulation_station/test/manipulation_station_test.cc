@@ -236,6 +236,34 @@ GTEST_TEST(ManipulationStationTest, CheckRGBDOutputs) {
   }
 }
 
+// With a camera update period, the cameras are discrete and the images are
+// available on the same output ports.
+GTEST_TEST(ManipulationStationTest, CheckDiscreteRGBDOutputs) {
+  ManipulationStation<double> station(0.001);
+  station.SetupManipulationClassStation();
+  EXPECT_THROW(station.SetCameraUpdatePeriod(-1), std::exception);
+  station.SetCameraUpdatePeriod(0.1);
+  station.Finalize();
+  EXPECT_THROW(station.SetCameraUpdatePeriod(0.1), std::exception);
+
+  auto context = station.CreateDefaultContext();
+  EXPECT_GT(context->num_discrete_state_groups(), 0);
+  for (const auto& name : station.get_camera_names()) {
+    EXPECT_GE(station.GetOutputPort("camera_" + name + "_rgb_image")
+                  .Eval<systems::sensors::ImageRgba8U>(*context)
+                  .size(),
+              0);
+    EXPECT_GE(station.GetOutputPort("camera_" + name + "_depth_image")
+                  .Eval<systems::sensors::ImageDepth16U>(*context)
+                  .size(),
+              0);
+    EXPECT_GE(station.GetOutputPort("camera_" + name + "_label_image")
+                  .Eval<systems::sensors::ImageLabel16I>(*context)
+                  .size(),
+              0);
+  }
+}
+
 GTEST_TEST(ManipulationStationTest, CheckCollisionVariants) {
   ManipulationStation<double> station1(0.002);
   station1.SetupManipulationClassStation(IiwaCollisionModel::kNoCollision);
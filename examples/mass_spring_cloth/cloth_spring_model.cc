@@ -1,6 +1,9 @@
 #include "drake/examples/mass_spring_cloth/cloth_spring_model.h"
 
+#include <algorithm>
+
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 
 namespace drake {
 namespace examples {
@@ -180,9 +183,7 @@ void ClothSpringModel<T>::DoCalcTimeDerivatives(
   const T mass_per_particle = p.mass() / static_cast<T>(num_particles_);
   // Mass of each particle must be positive.
   DRAKE_THROW_UNLESS(mass_per_particle > 0);
-  for (int i = 0; i < vdot.size(); ++i) {
-    tmp_vdot[i] /= mass_per_particle;
-  }
+  tmp_vdot /= mass_per_particle;
   // Apply gravity to acceleration.
   const Vector3<T> gravity{0, 0, p.gravity()};
   for (int i = 0; i < num_particles_; ++i) {
@@ -259,8 +260,62 @@ void ClothSpringModel<T>::AccumulateContinuousSpringForce(
   const auto& q = continuous_states.head(num_positions());
   const auto& v = continuous_states.segment(num_positions(), num_velocities());
   const ClothSpringModelParams<T>& p = GetParameters(context);
-  AccumulateElasticForce(p, q, forces);
-  AccumulateDampingForce(p, q, v, forces);
+  // The elastic and damping forces are computed in a single pass over the
+  // springs so that the spring directions are computed only once.
+  AccumulateOverSprings(
+      [this, &p, &q, &v](int begin, int end, EigenPtr<VectorX<T>> f_block) {
+        for (int i = begin; i < end; ++i) {
+          const Spring& s = springs_[i];
+          const int p0 = s.particle0;
+          const int p1 = s.particle1;
+          const Vector3<T> p_P0P1_W =
+              particle_state(p1, q) - particle_state(p0, q);
+          const T spring_length = p_P0P1_W.norm();
+          ThrowIfInvalidSpringLength(spring_length, s.rest_length);
+          const Vector3<T> n = p_P0P1_W / spring_length;
+          const Vector3<T> v_P0P1_W =
+              particle_state(p1, v) - particle_state(p0, v);
+          // Elastic force k * (current_length - rest_length) * n plus the
+          // damping force d * (v_P0P1 ⋅ n) * n, with n the unit vector from P0
+          // to P1.
+          const Vector3<T> f = (p.k() * (spring_length - s.rest_length) +
+                                p.d() * v_P0P1_W.dot(n)) * n;
+          accumulate_particle_state(p0, f, f_block);
+          accumulate_particle_state(p1, -f, f_block);
+        }
+      },
+      forces);
+}
+
+template <typename T>
+template <typename AccumulateRange>
+void ClothSpringModel<T>::AccumulateOverSprings(
+    const AccumulateRange& accumulate, EigenPtr<VectorX<T>> forces) const {
+  DRAKE_DEMAND(forces != nullptr);
+  const int num_springs = static_cast<int>(springs_.size());
+  const int num_threads = std::min(num_threads_, num_springs);
+  if (num_threads <= 1) {
+    accumulate(0, num_springs, forces);
+    return;
+  }
+  thread_forces_.resize(num_threads - 1);
+  for (VectorX<T>& thread_force : thread_forces_) {
+    thread_force.setZero(forces->size());
+  }
+  // The first block runs on the calling thread and accumulates directly into
+  // forces; the other blocks only write to their own buffer.
+  drake::internal::StaticParallelForRange(
+      num_springs, num_threads,
+      [&accumulate, &forces, this](int thread_num, int begin, int end) {
+        if (thread_num == 0) {
+          accumulate(begin, end, forces);
+        } else {
+          accumulate(begin, end, &thread_forces_[thread_num - 1]);
+        }
+      });
+  for (const VectorX<T>& thread_force : thread_forces_) {
+    *forces += thread_force;
+  }
 }
 
 template <typename T>
@@ -269,22 +324,27 @@ void ClothSpringModel<T>::AccumulateElasticForce(
     const Eigen::Ref<const VectorX<T>>& q,
     EigenPtr<VectorX<T>> elastic_force) const {
   DRAKE_DEMAND(elastic_force != nullptr);
-  for (const Spring& s : springs_) {
-    // Get the positions of the two particles connected by the spring.
-    const int p0 = s.particle0;
-    const int p1 = s.particle1;
-    const Vector3<T> p_WP0 = particle_state(p0, q);
-    const Vector3<T> p_WP1 = particle_state(p1, q);
-    const Vector3<T> p_P0P1_W = p_WP1 - p_WP0;
-    const T spring_length = p_P0P1_W.norm();
-    ThrowIfInvalidSpringLength(spring_length, s.rest_length);
-    const Vector3<T> n = p_P0P1_W / spring_length;
-    // If the n is the unit vector point from P0 to P1,
-    // the spring elastic force = k * (current_length - rest_length) * n
-    const Vector3<T> f = param.k() * (spring_length - s.rest_length) * n;
-    accumulate_particle_state(p0, f, elastic_force);
-    accumulate_particle_state(p1, -f, elastic_force);
-  }
+  AccumulateOverSprings(
+      [this, &param, &q](int begin, int end, EigenPtr<VectorX<T>> f_block) {
+        for (int i = begin; i < end; ++i) {
+          const Spring& s = springs_[i];
+          // Get the positions of the two particles connected by the spring.
+          const int p0 = s.particle0;
+          const int p1 = s.particle1;
+          const Vector3<T> p_WP0 = particle_state(p0, q);
+          const Vector3<T> p_WP1 = particle_state(p1, q);
+          const Vector3<T> p_P0P1_W = p_WP1 - p_WP0;
+          const T spring_length = p_P0P1_W.norm();
+          ThrowIfInvalidSpringLength(spring_length, s.rest_length);
+          const Vector3<T> n = p_P0P1_W / spring_length;
+          // If the n is the unit vector point from P0 to P1,
+          // the spring elastic force = k * (current_length - rest_length) * n
+          const Vector3<T> f = param.k() * (spring_length - s.rest_length) * n;
+          accumulate_particle_state(p0, f, f_block);
+          accumulate_particle_state(p1, -f, f_block);
+        }
+      },
+      elastic_force);
 }
 
 template <typename T>
@@ -294,27 +354,33 @@ void ClothSpringModel<T>::AccumulateDampingForce(
     const Eigen::Ref<const VectorX<T>>& v,
     EigenPtr<VectorX<T>> damping_force) const {
   DRAKE_DEMAND(damping_force != nullptr);
-  for (const Spring& s : springs_) {
-    // Get the positions and velocities of the two particles connected by
-    // the spring.
-    const int p0 = s.particle0;
-    const int p1 = s.particle1;
-    const Vector3<T> p_WP0 = particle_state(p0, q);
-    const Vector3<T> p_WP1 = particle_state(p1, q);
-    const Vector3<T> v_WP0 = particle_state(p0, v);
-    const Vector3<T> v_WP1 = particle_state(p1, v);
-    const Vector3<T> p_P0P1_W = p_WP1 - p_WP0;
-    const T spring_length = p_P0P1_W.norm();
-    ThrowIfInvalidSpringLength(spring_length, s.rest_length);
-    const Vector3<T> n = p_P0P1_W / spring_length;
-    // If the n is the unit vector point from q0 to q1,
-    // the damping force = (damping coefficient * velocity difference)
-    // projected in the direction of n.
-    const Vector3<T> f = param.d() * (v_WP1 - v_WP0).dot(n) * n;
-    accumulate_particle_state(p0, f, damping_force);
-    accumulate_particle_state(p1, -f, damping_force);
-  }
+  AccumulateOverSprings(
+      [this, &param, &q, &v](int begin, int end, EigenPtr<VectorX<T>> f_block) {
+        for (int i = begin; i < end; ++i) {
+          const Spring& s = springs_[i];
+          // Get the positions and velocities of the two particles connected by
+          // the spring.
+          const int p0 = s.particle0;
+          const int p1 = s.particle1;
+          const Vector3<T> p_WP0 = particle_state(p0, q);
+          const Vector3<T> p_WP1 = particle_state(p1, q);
+          const Vector3<T> v_WP0 = particle_state(p0, v);
+          const Vector3<T> v_WP1 = particle_state(p1, v);
+          const Vector3<T> p_P0P1_W = p_WP1 - p_WP0;
+          const T spring_length = p_P0P1_W.norm();
+          ThrowIfInvalidSpringLength(spring_length, s.rest_length);
+          const Vector3<T> n = p_P0P1_W / spring_length;
+          // If the n is the unit vector point from q0 to q1,
+          // the damping force = (damping coefficient * velocity difference)
+          // projected in the direction of n.
+          const Vector3<T> f = param.d() * (v_WP1 - v_WP0).dot(n) * n;
+          accumulate_particle_state(p0, f, f_block);
+          accumulate_particle_state(p1, -f, f_block);
+        }
+      },
+      damping_force);
 }
+
 template <typename T>
 void ClothSpringModel<T>::CalcDiscreteDv(const ClothSpringModelParams<T>& param,
                                          const VectorX<T>& q, VectorX<T>* f,
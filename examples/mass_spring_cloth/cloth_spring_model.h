@@ -117,6 +117,16 @@ class ClothSpringModel final : public systems::LeafSystem<T> {
     cg_.setTolerance(accuracy);
   }
 
+  /** Sets the number of threads used to compute the spring forces, both in
+    continuous and discrete mode. The springs are split into `num_threads`
+    contiguous blocks whose forces are accumulated separately and then summed
+    in a fixed order. The default is 1, i.e., serial evaluation.
+    @throws std::exception if `num_threads` is less than 1. */
+  void set_num_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_threads_ = num_threads;
+  }
+
  private:
   struct Spring {
     // Indices of the two particles connected by the spring.
@@ -198,6 +208,14 @@ class ClothSpringModel final : public systems::LeafSystem<T> {
         context, param_index_);
   }
 
+  /* Partitions springs_ into at most num_threads_ contiguous blocks and, for
+   each block [begin, end), calls `accumulate(begin, end, block_forces)` where
+   block_forces is either `forces` itself or a zero-initialized per-thread
+   buffer, which is then added to `forces`. */
+  template <typename AccumulateRange>
+  void AccumulateOverSprings(const AccumulateRange& accumulate,
+                             EigenPtr<VectorX<T>> forces) const;
+
   /* Calculates the elastic force from springs given the positions of the
    particles and add to the output elastic_force. The values contained in
    elastic_force should be set to zero outside this function if fresh values
@@ -277,6 +295,11 @@ class ClothSpringModel final : public systems::LeafSystem<T> {
   int param_index_{};
   /* A list of springs in the system. Indexing does not matter here.*/
   std::vector<Spring> springs_;
+  /* The number of threads used to compute the spring forces.*/
+  int num_threads_{1};
+  /* Per-thread force accumulators for all but the first thread, reused across
+   evaluations to prevent reallocations.*/
+  mutable std::vector<VectorX<T>> thread_forces_;
   /* Pre-allocated H matrix to prevent reallocations.*/
   mutable Eigen::SparseMatrix<T> H_;
   /* We use a CG solver for the symmetric positive definite matrix in the linear
@@ -24,6 +24,8 @@ DEFINE_double(dt, 0.01,
               "scheme described in Bridson et.al. will be used if dt > 0. The "
               "discrete scheme runs faster but is not error controlled. If dt "
               "<= 0, the system will be continuous");
+DEFINE_int32(num_threads, 1,
+             "Number of threads used to compute the spring forces");
 DEFINE_double(simulation_time, std::numeric_limits<double>::infinity(),
               "How long to simulate the system");
 
@@ -36,6 +38,7 @@ int DoMain() {
   systems::DiagramBuilder<double> builder;
   auto* cloth_spring_model = builder.AddSystem<ClothSpringModel<double>>(
       FLAGS_nx, FLAGS_ny, FLAGS_h, FLAGS_dt);
+  cloth_spring_model->set_num_threads(FLAGS_num_threads);
   auto* scene_graph = builder.AddSystem<geometry::SceneGraph>();
   ClothSpringModelGeometry::AddToBuilder(&builder, *cloth_spring_model,
                                          scene_graph);
@@ -33,6 +33,25 @@ TEST_F(ContinuousClothSpringModelTest, Simulate) {
   EXPECT_EQ(simulator.get_context().get_time(), t_final);
 }
 
+// Computing the spring forces on several threads gives the same
+// derivatives, up to round off, as the serial computation.
+TEST_F(ContinuousClothSpringModelTest, MultipleThreads) {
+  // Perturb the initial state so that all springs are stretched and moving.
+  const int num_states = context_->num_continuous_states();
+  const Eigen::VectorXd x0 =
+      context_->get_continuous_state_vector().CopyToVector() +
+      0.01 * Eigen::VectorXd::LinSpaced(num_states, -1, 1).array().sin()
+                 .matrix();
+  context_->SetContinuousState(x0);
+  const Eigen::VectorXd xdot_serial =
+      dut_->EvalTimeDerivatives(*context_).CopyToVector();
+  dut_->set_num_threads(3);
+  auto derivatives = dut_->AllocateTimeDerivatives();
+  dut_->CalcTimeDerivatives(*context_, derivatives.get());
+  EXPECT_TRUE(derivatives->CopyToVector().isApprox(xdot_serial, 1e-14));
+  EXPECT_THROW(dut_->set_num_threads(0), std::exception);
+}
+
 class DiscreteClothSpringModelTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -62,6 +81,23 @@ TEST_F(DiscreteClothSpringModelTest, Simulate) {
   // linear system. Therefore the sim should not crash.
   EXPECT_EQ(simulator.get_context().get_time(), t_final);
 }
+
+TEST_F(DiscreteClothSpringModelTest, MultipleThreads) {
+  // Perturb the initial state so that all springs are stretched and moving.
+  systems::BasicVector<double>& state =
+      context_->get_mutable_discrete_state_vector();
+  const int num_states = state.size();
+  state.get_mutable_value() +=
+      0.01 * Eigen::VectorXd::LinSpaced(num_states, -1, 1).array().sin()
+                 .matrix();
+  auto serial_values = dut_->AllocateDiscreteVariables();
+  dut_->CalcDiscreteVariableUpdates(*context_, serial_values.get());
+  dut_->set_num_threads(4);
+  auto values = dut_->AllocateDiscreteVariables();
+  dut_->CalcDiscreteVariableUpdates(*context_, values.get());
+  EXPECT_TRUE(values->get_vector().get_value().isApprox(
+      serial_values->get_vector().get_value(), 1e-12));
+}
 }  // namespace
 }  // namespace mass_spring_cloth
 }  // namespace examples
@@ -1,6 +1,11 @@
+#include <stack>
+#include <utility>
+#include <vector>
+
 #include "fmt/format.h"
 #include <benchmark/benchmark.h>
 
+#include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/make_ellipsoid_field.h"
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
@@ -18,6 +23,11 @@ namespace internal {
 
  It computes the contact surface formed from the intersection of an ellipsoid
  and a sphere using broad-phase culling (via a bounding volume hierarchy).
+ The BvhCollide benchmarks time only that culling step: BvhCollideFlat uses
+ Bvh::Collide(), which traverses the hierarchy's contiguous, depth-first node
+ array, and BvhCollideTree performs the same traversal by following the
+ pointers of the BvNode tree (the layout Collide() used to traverse). Both
+ report the number of candidate pairs, which must agree.
  Arguments include:
  - __resolution__: An enumeration in the integer range from 0 to 3 that guides
    the level of mesh refinement, where 0 produces the coarsest meshes and 3
@@ -102,7 +112,7 @@ Resulting contact surface sizes:
  MeshIntersectionBenchmark/TestName/resolution/contact_overlap/rotation_factor/min_time
  ```
 
-   - __TestName__: RigidSoftMesh
+   - __TestName__: RigidSoftMesh, BvhCollideFlat, or BvhCollideTree
    - __resolution__: Affects the resolution of the ellipsoid and sphere
      meshes. Valid values must be one of [0, 1, 2, 3], where 0 produces the
      coarsest meshes and 3 produces the finest meshes. This is converted behind
@@ -260,6 +270,93 @@ BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMesh)
     ->Args({2, 3, 1})   // 2 resolution, 3 contact overlap, 1 rotation factor.
     ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
 
+/* Runs the callback on the candidate pairs of `bvh_S` and `bvh_R` by
+ traversing the pointer based BvNode trees, in the same order as
+ Bvh::Collide() traverses its flat node array. This serves as the baseline for
+ the BvhCollideFlat benchmark.  */
+void CollideTrees(
+    const Bvh<VolumeMesh<double>>& bvh_S, const Bvh<SurfaceMesh<double>>& bvh_R,
+    const RigidTransformd& X_SR,
+    BvttCallback<VolumeMesh<double>, SurfaceMesh<double>> callback) {
+  using NodePair = std::pair<const BvNode<VolumeMesh<double>>&,
+                             const BvNode<SurfaceMesh<double>>&>;
+  std::stack<NodePair, std::vector<NodePair>> node_pairs;
+  node_pairs.emplace(bvh_S.root_node(), bvh_R.root_node());
+  while (!node_pairs.empty()) {
+    const auto& [node_a, node_b] = node_pairs.top();
+    node_pairs.pop();
+    if (!Obb::HasOverlap(node_a.bv(), node_b.bv(), X_SR)) continue;
+    if (node_a.is_leaf() && node_b.is_leaf()) {
+      for (int a = 0; a < node_a.num_element_indices(); ++a) {
+        for (int b = 0; b < node_b.num_element_indices(); ++b) {
+          callback(node_a.element_index(a), node_b.element_index(b));
+        }
+      }
+    } else if (node_b.is_leaf()) {
+      node_pairs.emplace(node_a.left(), node_b);
+      node_pairs.emplace(node_a.right(), node_b);
+    } else if (node_a.is_leaf()) {
+      node_pairs.emplace(node_a, node_b.left());
+      node_pairs.emplace(node_a, node_b.right());
+    } else {
+      node_pairs.emplace(node_a.left(), node_b.left());
+      node_pairs.emplace(node_a.right(), node_b.left());
+      node_pairs.emplace(node_a.left(), node_b.right());
+      node_pairs.emplace(node_a.right(), node_b.right());
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, BvhCollideFlat)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const auto bvh_S = Bvh<VolumeMesh<double>>(mesh_S_);
+  const auto bvh_R = Bvh<SurfaceMesh<double>>(mesh_R_);
+  int count = 0;
+  for (auto _ : state) {
+    count = 0;
+    bvh_S.Collide(bvh_R, X_SR_,
+                  [&count](VolumeElementIndex, SurfaceFaceIndex) {
+                    ++count;
+                    return BvttCallbackResult::Continue;
+                  });
+    benchmark::DoNotOptimize(count);
+  }
+  state.counters["candidates"] = count;
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, BvhCollideFlat)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1, 4, 0})   // 1 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({3, 4, 3});  // 3 resolution, 4 contact overlap, 3 rotation factor.
+
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, BvhCollideTree)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const auto bvh_S = Bvh<VolumeMesh<double>>(mesh_S_);
+  const auto bvh_R = Bvh<SurfaceMesh<double>>(mesh_R_);
+  int count = 0;
+  for (auto _ : state) {
+    count = 0;
+    CollideTrees(bvh_S, bvh_R, X_SR_,
+                 [&count](VolumeElementIndex, SurfaceFaceIndex) {
+                   ++count;
+                   return BvttCallbackResult::Continue;
+                 });
+    benchmark::DoNotOptimize(count);
+  }
+  state.counters["candidates"] = count;
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, BvhCollideTree)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1, 4, 0})   // 1 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({3, 4, 3});  // 3 resolution, 4 contact overlap, 3 rotation factor.
+
 void ReportContactSurfaces() {
   std::cout << "Resulting contact surface sizes:" << std::endl;
   for (const auto& output :
@@ -27,8 +27,9 @@ FrameKinematicsVector<KinematicsValue>::FrameKinematicsVector() {
 template <typename KinematicsValue>
 FrameKinematicsVector<KinematicsValue>::FrameKinematicsVector(
     std::initializer_list<std::pair<const FrameId, KinematicsValue>> init) {
-  values_.insert(init.begin(), init.end());
-  size_ = init.size();
+  for (const auto& item : init) {
+    set_value(item.first, item.second);
+  }
   DRAKE_ASSERT_VOID(CheckInvariants());
 }
 
@@ -36,9 +37,6 @@ template <typename KinematicsValue>
 FrameKinematicsVector<KinematicsValue>&
 FrameKinematicsVector<KinematicsValue>::operator=(
     std::initializer_list<std::pair<const FrameId, KinematicsValue>> init) {
-  // N.B. We can't use unordered_map::insert in our operator= implementation
-  // because it does not overwrite pre-existing keys.  (Our clear() doesn't
-  // remove the keys, it only nulls the values.)
   clear();
   for (const auto& item : init) {
     set_value(item.first, item.second);
@@ -49,29 +47,41 @@ FrameKinematicsVector<KinematicsValue>::operator=(
 
 template <typename KinematicsValue>
 void FrameKinematicsVector<KinematicsValue>::clear() {
-  for (auto& item : values_) {
-    item.second = std::nullopt;
+  for (auto& value : values_) {
+    value = std::nullopt;
   }
+  next_index_ = 0;
   size_ = 0;
 }
 
 template <typename KinematicsValue>
 void FrameKinematicsVector<KinematicsValue>::set_value(
     FrameId id, const KinematicsValue& value) {
-  auto& map_value = values_[id];
-  if (!map_value.has_value()) { ++size_; }
-  map_value = value;
+  int index = next_index_;
+  if (index >= static_cast<int>(ids_.size()) || ids_[index] != id) {
+    const auto [iter, inserted] =
+        indices_.insert({id, static_cast<int>(ids_.size())});
+    if (inserted) {
+      ids_.push_back(id);
+      values_.emplace_back();
+    }
+    index = iter->second;
+  }
+  next_index_ = index + 1;
+  std::optional<KinematicsValue>& stored_value = values_[index];
+  if (!stored_value.has_value()) { ++size_; }
+  stored_value = value;
 }
 
 template <typename KinematicsValue>
 const KinematicsValue& FrameKinematicsVector<KinematicsValue>::value(
     FrameId id) const {
   using std::to_string;
-  auto iter = values_.find(id);
-  if (iter != values_.end()) {
-    const std::optional<KinematicsValue>& map_value = iter->second;
-    if (map_value.has_value()) {
-      return *map_value;
+  auto iter = indices_.find(id);
+  if (iter != indices_.end()) {
+    const std::optional<KinematicsValue>& stored_value = values_[iter->second];
+    if (stored_value.has_value()) {
+      return *stored_value;
     }
   }
   throw std::runtime_error("No such FrameId " + to_string(id) + ".");
@@ -79,8 +89,8 @@ const KinematicsValue& FrameKinematicsVector<KinematicsValue>::value(
 
 template <typename KinematicsValue>
 bool FrameKinematicsVector<KinematicsValue>::has_id(FrameId id) const {
-  auto iter = values_.find(id);
-  return (iter != values_.end()) && iter->second.has_value();
+  auto iter = indices_.find(id);
+  return (iter != indices_.end()) && values_[iter->second].has_value();
 }
 
 template <typename KinematicsValue>
@@ -88,9 +98,9 @@ std::vector<FrameId>
 FrameKinematicsVector<KinematicsValue>::frame_ids() const {
   std::vector<FrameId> result;
   result.reserve(size_);
-  for (const auto& item : values_) {
-    if (item.second.has_value()) {
-      result.emplace_back(item.first);
+  for (int i = 0; i < static_cast<int>(ids_.size()); ++i) {
+    if (values_[i].has_value()) {
+      result.emplace_back(ids_[i]);
     }
   }
   DRAKE_ASSERT(static_cast<int>(result.size()) == size_);
@@ -99,9 +109,11 @@ FrameKinematicsVector<KinematicsValue>::frame_ids() const {
 
 template <typename KinematicsValue>
 void FrameKinematicsVector<KinematicsValue>::CheckInvariants() const {
+  DRAKE_DEMAND(ids_.size() == values_.size());
+  DRAKE_DEMAND(indices_.size() == ids_.size());
   int num_nonnull = 0;
-  for (const auto& item : values_) {
-    if (item.second.has_value()) {
+  for (const auto& value : values_) {
+    if (value.has_value()) {
       ++num_nonnull;
     }
   }
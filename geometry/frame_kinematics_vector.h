@@ -126,7 +126,8 @@ class FrameKinematicsVector {
   /** Reports true if the given id is a member of this data. */
   bool has_id(FrameId id) const;
 
-  /** Provides a range object for all of the frame ids in the vector.
+  /** Provides a range object for all of the frame ids in the vector, in the
+   order in which they were first set (since construction).
    This is intended to be used as:
    @code
    for (FrameId id : this_vector.frame_ids()) {
@@ -141,15 +142,21 @@ class FrameKinematicsVector {
  private:
   void CheckInvariants() const;
 
-  // Mapping from frame id to its current pose.  If the map's optional value is
-  // nullopt, we treat it as if the map key were absent instead.  We do this in
-  // order to avoid reallocating map nodes as we repeatedly clear() and then
+  // The frame ids and their current values, stored densely in the order in
+  // which each id was first set.  If a value is nullopt, we treat it as if the
+  // id were absent instead.  We do this in order to keep both the storage and
+  // the order of the ids stable as we repeatedly clear() and then
   // re-set_value() the same IDs over and over again.
-  // TODO(jwnimmer-tri) A better way to avoid map node allocations would be to
-  // replace this unordered_map with a flat_hash_map (where the entire storage
-  // is a single heap slab); in that case, the complicated implementation in
-  // the cc file would become simplified.
-  std::unordered_map<FrameId, std::optional<KinematicsValue>> values_;
+  std::vector<FrameId> ids_;
+  std::vector<std::optional<KinematicsValue>> values_;
+
+  // The index of each id in ids_ and values_.
+  std::unordered_map<FrameId, int> indices_;
+
+  // The index where set_value() first looks for its id.  When the same ids are
+  // re-set in the same order after each clear(), as is typical for a Calc
+  // method, every set_value() finds its id there without hashing.
+  int next_index_{0};
 
   // The count of non-nullopt items in values_.  We could recompute this from
   // values_, but we store it separately so that size() is still constant-time.
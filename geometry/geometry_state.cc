@@ -1,6 +1,7 @@
 #include "drake/geometry/geometry_state.h"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
@@ -115,27 +116,29 @@ std::string get_missing_id_message<GeometryId>(const GeometryId& key) {
 template <typename T>
 GeometryState<T>::GeometryState()
     : self_source_(SourceId::get_new_id()),
+      topology_(std::make_shared<internal::GeometryStateTopology>()),
       geometry_engine_(make_unique<internal::ProximityEngine<T>>()) {
-  source_names_[self_source_] = "SceneGraphInternal";
+  internal::GeometryStateTopology& registration = mutable_topology();
+  registration.source_names[self_source_] = "SceneGraphInternal";
 
   const FrameId world = InternalFrame::world_frame_id();
   // As an arbitrary design choice, we'll say the world frame is its own parent.
-  frames_[world] = InternalFrame(self_source_, world, "world",
-                                 InternalFrame::world_frame_group(),
-                                 FrameIndex(0), world,
-                                 InternalFrame::world_frame_clique());
-  frame_index_to_id_map_.push_back(world);
+  registration.frames[world] =
+      InternalFrame(self_source_, world, "world",
+                    InternalFrame::world_frame_group(), FrameIndex(0), world,
+                    InternalFrame::world_frame_clique());
+  registration.frame_index_to_id_map.push_back(world);
   X_WF_.push_back(RigidTransform<T>::Identity());
   X_PF_.push_back(RigidTransform<T>::Identity());
 
-  source_frame_id_map_[self_source_] = {world};
-  source_root_frame_map_[self_source_] = {world};
+  registration.source_frame_id_map[self_source_] = {world};
+  registration.source_root_frame_map[self_source_] = {world};
 }
 
 template <typename T>
 int GeometryState<T>::NumGeometriesWithRole(Role role) const {
   int count = 0;
-  for (const auto& pair : geometries_) {
+  for (const auto& pair : topology().geometries) {
     if (pair.second.has_role(role)) ++count;
   }
   return count;
@@ -144,7 +147,7 @@ int GeometryState<T>::NumGeometriesWithRole(Role role) const {
 template <typename T>
 int GeometryState<T>::NumDynamicGeometries() const {
   int count = 0;
-  for (const auto& pair : frames_) {
+  for (const auto& pair : topology().frames) {
     const InternalFrame& frame = pair.second;
     if (frame.id() == InternalFrame::world_frame_id()) continue;
     count += frame.num_child_geometries();
@@ -154,7 +157,8 @@ int GeometryState<T>::NumDynamicGeometries() const {
 
 template <typename T>
 int GeometryState<T>::NumAnchoredGeometries() const {
-  const InternalFrame& frame = frames_.at(InternalFrame::world_frame_id());
+  const InternalFrame& frame =
+      topology().frames.at(InternalFrame::world_frame_id());
   return frame.num_child_geometries();
 }
 
@@ -162,11 +166,11 @@ template <typename T>
 std::set<std::pair<GeometryId, GeometryId>>
 GeometryState<T>::GetCollisionCandidates() const {
   std::set<std::pair<GeometryId, GeometryId>> pairs;
-  for (const auto& pairA : geometries_) {
+  for (const auto& pairA : topology().geometries) {
     const GeometryId idA = pairA.first;
     const InternalGeometry& geometryA = pairA.second;
     if (!geometryA.has_proximity_role()) continue;
-    for (const auto& pairB : geometries_) {
+    for (const auto& pairB : topology().geometries) {
       const GeometryId idB = pairB.first;
       if (idB < idA) continue;  // Only consider the pair (A, B) and not (B, A).
       const InternalGeometry& geometryB = pairB.second;
@@ -183,27 +187,28 @@ GeometryState<T>::GetCollisionCandidates() const {
 
 template <typename T>
 bool GeometryState<T>::SourceIsRegistered(SourceId source_id) const {
-  return source_frame_id_map_.find(source_id) != source_frame_id_map_.end();
+  return topology().source_frame_id_map.count(source_id) > 0;
 }
 
 template <typename T>
 const std::string& GeometryState<T>::GetName(SourceId id) const {
-  auto itr = source_names_.find(id);
-  if (itr != source_names_.end()) return itr->second;
+  auto itr = topology().source_names.find(id);
+  if (itr != topology().source_names.end()) return itr->second;
   throw std::logic_error(
       "Querying source name for an invalid source id: " + to_string(id) + ".");
 }
 
 template <typename T>
 int GeometryState<T>::NumFramesForSource(SourceId source_id) const {
-  const auto& frame_set = GetValueOrThrow(source_id, source_frame_id_map_);
+  const auto& frame_set =
+      GetValueOrThrow(source_id, topology().source_frame_id_map);
   return static_cast<int>(frame_set.size());
 }
 
 template <typename T>
 const FrameIdSet& GeometryState<T>::FramesForSource(
     SourceId source_id) const {
-  return GetValueOrThrow(source_id, source_frame_id_map_);
+  return GetValueOrThrow(source_id, topology().source_frame_id_map);
 }
 
 template <typename T>
@@ -211,7 +216,7 @@ bool GeometryState<T>::BelongsToSource(FrameId frame_id,
                                        SourceId source_id) const {
   // Confirm that the source_id is valid; use the utility function to confirm
   // source_id is valid and throw an exception with a known message.
-  GetValueOrThrow(source_id, source_frame_id_map_);
+  GetValueOrThrow(source_id, topology().source_frame_id_map);
   // If valid, test the frame.
   return get_source_id(frame_id) == source_id;
 }
@@ -219,40 +224,40 @@ bool GeometryState<T>::BelongsToSource(FrameId frame_id,
 template <typename T>
 const std::string& GeometryState<T>::GetOwningSourceName(FrameId id) const {
   SourceId source_id = get_source_id(id);
-  return source_names_.at(source_id);
+  return topology().source_names.at(source_id);
 }
 
 template <typename T>
 const std::string& GeometryState<T>::GetName(FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, topology().frames, [frame_id]() {
     return "No frame name available for invalid frame id: " +
         to_string(frame_id);
   });
-  return frames_.at(frame_id).name();
+  return topology().frames.at(frame_id).name();
 }
 
 template <typename T>
 int GeometryState<T>::GetFrameGroup(FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, topology().frames, [frame_id]() {
     return "No frame group available for invalid frame id: " +
         to_string(frame_id);
   });
-  return frames_.at(frame_id).frame_group();
+  return topology().frames.at(frame_id).frame_group();
 }
 
 template <typename T>
 int GeometryState<T>::NumGeometriesForFrame(FrameId frame_id) const {
-  const InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(frame_id, topology().frames);
   return static_cast<int>(frame.child_geometries().size());
 }
 
 template <typename T>
 int GeometryState<T>::NumGeometriesForFrameWithRole(FrameId frame_id,
                                                     Role role) const {
-  const InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(frame_id, topology().frames);
   int count = 0;
   for (GeometryId geometry_id : frame.child_geometries()) {
-    if (geometries_.at(geometry_id).has_role(role)) ++count;
+    if (topology().geometries.at(geometry_id).has_role(role)) ++count;
   }
   return count;
 }
@@ -260,13 +265,13 @@ int GeometryState<T>::NumGeometriesForFrameWithRole(FrameId frame_id,
 template <typename T>
 int GeometryState<T>::NumGeometriesWithRole(FrameId frame_id, Role role) const {
   int count = 0;
-  FindOrThrow(frame_id, frames_, [frame_id, role]() {
+  FindOrThrow(frame_id, topology().frames, [frame_id, role]() {
     return "Cannot report number of geometries with the " + to_string(role) +
         " role for invalid frame id: " + to_string(frame_id);
   });
-  const InternalFrame& frame = frames_.at(frame_id);
+  const InternalFrame& frame = topology().frames.at(frame_id);
   for (GeometryId id : frame.child_geometries()) {
-    if (geometries_.at(id).has_role(role)) ++count;
+    if (topology().geometries.at(id).has_role(role)) ++count;
   }
   return count;
 }
@@ -274,18 +279,18 @@ int GeometryState<T>::NumGeometriesWithRole(FrameId frame_id, Role role) const {
 template <typename T>
 std::vector<GeometryId> GeometryState<T>::GetGeometries(
     FrameId frame_id, std::optional<Role> role) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, topology().frames, [frame_id]() {
     return fmt::format(
         "Cannot report geometries associated with invalid frame id: {}",
         frame_id);
   });
-  const InternalFrame& frame = frames_.at(frame_id);
+  const InternalFrame& frame = topology().frames.at(frame_id);
 
   std::vector<GeometryId> ids;
   ids.reserve(frame.child_geometries().size());
   for (GeometryId g_id : frame.child_geometries()) {
     if (role.has_value()) {
-      if (!geometries_.at(g_id).has_role(*role)) continue;
+      if (!topology().geometries.at(g_id).has_role(*role)) continue;
     }
     ids.push_back(g_id);
   }
@@ -302,10 +307,10 @@ GeometryId GeometryState<T>::GetGeometryIdByName(
   int count = 0;
   std::string frame_name;
 
-  const InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(frame_id, topology().frames);
   frame_name = frame.name();
   for (GeometryId geometry_id : frame.child_geometries()) {
-    const InternalGeometry& geometry = geometries_.at(geometry_id);
+    const InternalGeometry& geometry = topology().geometries.at(geometry_id);
     if (geometry.has_role(role) && geometry.name() == canonical_name) {
       ++count;
       result = geometry_id;
@@ -331,23 +336,23 @@ template <typename T>
 bool GeometryState<T>::BelongsToSource(GeometryId geometry_id,
                                        SourceId source_id) const {
   // Confirm valid source id.
-  FindOrThrow(source_id, source_names_, [source_id](){
+  FindOrThrow(source_id, topology().source_names, [source_id](){
     return get_missing_id_message(source_id);
   });
   // If this fails, the geometry_id is not valid and an exception is thrown.
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, topology().geometries);
   return geometry.belongs_to_source(source_id);
 }
 
 template <typename T>
 const std::string& GeometryState<T>::GetOwningSourceName(GeometryId id) const {
   SourceId source_id = get_source_id(id);
-  return source_names_.at(source_id);
+  return topology().source_names.at(source_id);
 }
 
 template <typename T>
 FrameId GeometryState<T>::GetFrameId(GeometryId geometry_id) const {
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, topology().geometries);
   return geometry.frame_id();
 }
 
@@ -372,14 +377,14 @@ const Shape& GeometryState<T>::GetShape(GeometryId id) const {
 template <typename T>
 const math::RigidTransform<double>& GeometryState<T>::GetPoseInFrame(
     GeometryId geometry_id) const {
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, topology().geometries);
   return geometry.X_FG();
 }
 
 template <typename T>
 const math::RigidTransform<double>& GeometryState<T>::GetPoseInParent(
     GeometryId geometry_id) const {
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, topology().geometries);
   return geometry.X_PG();
 }
 
@@ -447,17 +452,17 @@ bool GeometryState<T>::CollisionFiltered(GeometryId id1, GeometryId id2) const {
 template <typename T>
 const math::RigidTransform<T>& GeometryState<T>::get_pose_in_world(
     FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, topology().frames, [frame_id]() {
     return "No world pose available for invalid frame id: " +
            to_string(frame_id);
   });
-  return X_WF_[frames_.at(frame_id).index()];
+  return X_WF_[topology().frames.at(frame_id).index()];
 }
 
 template <typename T>
 const math::RigidTransform<T>& GeometryState<T>::get_pose_in_world(
     GeometryId geometry_id) const {
-  FindOrThrow(geometry_id, geometries_, [geometry_id]() {
+  FindOrThrow(geometry_id, topology().geometries, [geometry_id]() {
     return "No world pose available for invalid geometry id: " +
            to_string(geometry_id);
   });
@@ -467,10 +472,10 @@ const math::RigidTransform<T>& GeometryState<T>::get_pose_in_world(
 template <typename T>
 const math::RigidTransform<T>& GeometryState<T>::get_pose_in_parent(
     FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, topology().frames, [frame_id]() {
     return "No pose available for invalid frame id: " + to_string(frame_id);
   });
-  return X_PF_[frames_.at(frame_id).index()];
+  return X_PF_[topology().frames.at(frame_id).index()];
 }
 
 template <typename T>
@@ -480,17 +485,17 @@ SourceId GeometryState<T>::RegisterNewSource(const std::string& name) {
       name != "" ? name : "Source_" + to_string(source_id);
 
   // The user can provide bad names, _always_ test.
-  for (const auto& pair : source_names_) {
+  for (const auto& pair : topology().source_names) {
     if (pair.second == final_name) {
       throw std::logic_error(
           "Registering new source with duplicate name: " + final_name + ".");
     }
   }
 
-  source_frame_id_map_[source_id];
-  source_root_frame_map_[source_id];
-  source_anchored_geometry_map_[source_id];
-  source_names_[source_id] = final_name;
+  mutable_topology().source_frame_id_map[source_id];
+  mutable_topology().source_root_frame_map[source_id];
+  mutable_topology().source_anchored_geometry_map[source_id];
+  mutable_topology().source_names[source_id] = final_name;
   return source_id;
 }
 
@@ -505,35 +510,36 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
                                         const GeometryFrame& frame) {
   FrameId frame_id = frame.id();
 
-  if (frames_.count(frame_id) > 0) {
+  if (topology().frames.count(frame_id) > 0) {
     throw std::logic_error(
         "Registering frame with an id that has already been registered: " +
             to_string(frame_id));
   }
 
-  FrameIdSet& f_set = GetMutableValueOrThrow(source_id, &source_frame_id_map_);
+  FrameIdSet& f_set = GetMutableValueOrThrow(
+      source_id, &mutable_topology().source_frame_id_map);
   if (parent_id != InternalFrame::world_frame_id()) {
     FindOrThrow(parent_id, f_set, [parent_id, source_id]() {
       return "Indicated parent id " + to_string(parent_id) + " does not belong "
           "to the indicated source id " + to_string(source_id) + ".";
     });
-    frames_[parent_id].add_child(frame_id);
+    mutable_topology().frames[parent_id].add_child(frame_id);
   } else {
     // The parent is the world frame; register it as a root frame.
-    source_root_frame_map_[source_id].insert(frame_id);
+    mutable_topology().source_root_frame_map[source_id].insert(frame_id);
   }
 
-  DRAKE_ASSERT(X_PF_.size() == frame_index_to_id_map_.size());
+  DRAKE_ASSERT(X_PF_.size() == topology().frame_index_to_id_map.size());
   FrameIndex index(X_PF_.size());
   X_PF_.emplace_back(RigidTransform<T>::Identity());
   X_WF_.emplace_back(RigidTransform<T>::Identity());
-  frame_index_to_id_map_.push_back(frame_id);
+  mutable_topology().frame_index_to_id_map.push_back(frame_id);
   f_set.insert(frame_id);
   int clique = GeometryStateCollisionFilterAttorney::get_next_clique(
       geometry_engine_.get_mutable());
-  frames_.emplace(frame_id, InternalFrame(source_id, frame_id, frame.name(),
-                                          frame.frame_group(), index,
-                                          parent_id, clique));
+  mutable_topology().frames.emplace(
+      frame_id, InternalFrame(source_id, frame_id, frame.name(),
+                              frame.frame_group(), index, parent_id, clique));
   return frame_id;
 }
 
@@ -548,7 +554,7 @@ GeometryId GeometryState<T>::RegisterGeometry(
   }
 
   GeometryId geometry_id = geometry->id();
-  if (geometries_.count(geometry_id) > 0) {
+  if (topology().geometries.count(geometry_id) > 0) {
     throw std::logic_error(
         "Registering geometry with an id that has already been registered: " +
             to_string(geometry_id));
@@ -558,13 +564,13 @@ GeometryId GeometryState<T>::RegisterGeometry(
   if (frame_id == InternalFrame::world_frame_id()) {
     // Explicitly validate the source id because it won't happen in acquiring
     // the world frame.
-    FindOrThrow(source_id, source_frame_id_map_, [source_id]() {
+    FindOrThrow(source_id, topology().source_frame_id_map, [source_id]() {
       return get_missing_id_message(source_id);
     });
     frame_source_id = self_source_;
   }
-  FrameIdSet& set = GetMutableValueOrThrow(frame_source_id,
-                                           &source_frame_id_map_);
+  FrameIdSet& set = GetMutableValueOrThrow(
+      frame_source_id, &mutable_topology().source_frame_id_map);
 
   FindOrThrow(frame_id, set, [frame_id, frame_source_id]() {
     return "Referenced frame " + to_string(frame_id) + " for source " +
@@ -576,14 +582,14 @@ GeometryId GeometryState<T>::RegisterGeometry(
   // NOTE: Names are not validated here -- there are no roles. The names are
   // validated when roles are assigned.
 
-  InternalFrame& frame = frames_[frame_id];
+  InternalFrame& frame = mutable_topology().frames[frame_id];
   frame.add_child(geometry_id);
 
   // pose() is always RigidTransform<double>. To account for
   // GeometryState<AutoDiff>, we need to cast it to the common type T.
   X_WGs_[geometry_id] = X_WF_[frame.index()] * geometry->pose().cast<T>();
 
-  geometries_.emplace(
+  mutable_topology().geometries.emplace(
       geometry_id,
       InternalGeometry(source_id, geometry->release_shape(), frame_id,
                        geometry_id, geometry->name(), geometry->pose()));
@@ -627,7 +633,7 @@ GeometryId GeometryState<T>::RegisterGeometryWithParent(
 
   // This confirms that parent_id exists at all.
   InternalGeometry& parent_geometry =
-      GetMutableValueOrThrow(parent_id, &geometries_);
+      GetMutableValueOrThrow(parent_id, &mutable_topology().geometries);
   FrameId frame_id = parent_geometry.frame_id();
 
   // This implicitly confirms that source_id is registered (condition #2) and
@@ -640,7 +646,7 @@ GeometryId GeometryState<T>::RegisterGeometryWithParent(
   // semantically correct value X_FG by concatenating X_FP with X_PG.
 
   // Transform pose relative to geometry, to pose relative to frame.
-  InternalGeometry& new_geometry = geometries_[new_id];
+  InternalGeometry& new_geometry = mutable_topology().geometries[new_id];
   // The call to `RegisterGeometry()` above stashed the pose X_PG into the
   // X_FG_ vector assuming the parent was the frame. Replace it by concatenating
   // its pose in parent, with its parent's pose in frame. NOTE: the pose is no
@@ -675,7 +681,7 @@ void GeometryState<T>::RemoveGeometry(SourceId source_id,
 template <typename T>
 bool GeometryState<T>::IsValidGeometryName(
     FrameId frame_id, Role role, const std::string& candidate_name) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, topology().frames, [frame_id]() {
     return "Given frame id is not valid: " + to_string(frame_id);
   });
   const std::string name = internal::CanonicalizeStringName(candidate_name);
@@ -700,7 +706,7 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
                                              geometry_id,
                                              *geometry.proximity_properties());
 
-        InternalFrame& frame = frames_[geometry.frame_id()];
+        const InternalFrame& frame = topology().frames.at(geometry.frame_id());
 
         int child_count = static_cast<int>(frame.child_geometries().size());
         if (child_count > 1) {
@@ -712,7 +718,7 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
           std::vector<GeometryId> proximity_geometries;
           proximity_geometries.reserve(child_count);
           for (GeometryId child_id : frame.child_geometries()) {
-            if (geometries_[child_id].has_proximity_role()) {
+            if (topology().geometries.at(child_id).has_proximity_role()) {
               proximity_geometries.push_back(child_id);
             }
           }
@@ -949,8 +955,8 @@ void GeometryState<T>::AddRenderer(
   }
   render::RenderEngine* render_engine = renderer.get();
   render_engines_[name] = move(renderer);
-  for (auto& id_geo_pair : geometries_) {
-    InternalGeometry& geometry = id_geo_pair.second;
+  for (const auto& id_geo_pair : topology().geometries) {
+    const InternalGeometry& geometry = id_geo_pair.second;
     if (geometry.has_perception_role()) {
       const GeometryId id = id_geo_pair.first;
       const PerceptionProperties* properties = geometry.perception_properties();
@@ -1068,10 +1074,10 @@ void GeometryState<T>::CollectIds(
   // that collecting ids for *other* role-related tasks prove necessary.
   std::unordered_set<GeometryId>* target;
   for (auto frame_id : geometry_set.frames()) {
-    const auto& frame = GetValueOrThrow(frame_id, frames_);
+    const auto& frame = GetValueOrThrow(frame_id, topology().frames);
     target = frame.is_world() ? anchored : dynamic;
     for (auto geometry_id : frame.child_geometries()) {
-      InternalGeometry& geometry = geometries_[geometry_id];
+      const InternalGeometry& geometry = topology().geometries.at(geometry_id);
       if (geometry.has_proximity_role()) {
         target->insert(geometry_id);
       }
@@ -1103,8 +1109,8 @@ void GeometryState<T>::SetFramePoses(
   // ASSERT_ARMED.
   ValidateFrameIds(source_id, poses);
   const RigidTransform<T> world_pose = RigidTransform<T>::Identity();
-  for (auto frame_id : source_root_frame_map_[source_id]) {
-    UpdatePosesRecursively(frames_[frame_id], world_pose, poses);
+  for (auto frame_id : topology().source_root_frame_map.at(source_id)) {
+    UpdatePosesRecursively(topology().frames.at(frame_id), world_pose, poses);
   }
 }
 
@@ -1143,7 +1149,7 @@ void GeometryState<T>::FinalizePoseUpdate() {
 
 template <typename T>
 SourceId GeometryState<T>::get_source_id(FrameId frame_id) const {
-  const auto& frame = GetValueOrThrow(frame_id, frames_);
+  const auto& frame = GetValueOrThrow(frame_id, topology().frames);
   return frame.source_id();
 }
 
@@ -1160,7 +1166,10 @@ SourceId GeometryState<T>::get_source_id(GeometryId id) const {
 template <typename T>
 void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
                                                RemoveGeometryOrigin caller) {
-  const InternalGeometry& geometry = GetValueOrThrow(geometry_id, geometries_);
+  // The geometry is taken from this state's own registration data, since it is
+  // referenced after that data is modified.
+  const InternalGeometry& geometry =
+      GetValueOrThrow(geometry_id, mutable_topology().geometries);
 
   // TODO(SeanCurtis-TRI): When this gets invoked by RemoveFrame(), this
   // recursive action will not be necessary, as all child geometries will
@@ -1172,7 +1181,8 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
       RemoveGeometryUnchecked(child_id, RemoveGeometryOrigin::kRecurse);
     }
     // Remove the geometry from its frame's list of geometries.
-    auto& frame = GetMutableValueOrThrow(geometry.frame_id(), &frames_);
+    auto& frame = GetMutableValueOrThrow(geometry.frame_id(),
+                                         &mutable_topology().frames);
     frame.remove_child(geometry_id);
   }
 
@@ -1187,7 +1197,7 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
     // is implicit in the deletion of that parent geometry.
     if (std::optional<GeometryId> parent_id = geometry.parent_id()) {
       auto& parent_geometry =
-          GetMutableValueOrThrow(*parent_id, &geometries_);
+          GetMutableValueOrThrow(*parent_id, &mutable_topology().geometries);
       parent_geometry.remove_child(geometry_id);
     }
   }
@@ -1196,7 +1206,7 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
   X_WGs_.erase(geometry_id);
 
   // Remove from the geometries.
-  geometries_.erase(geometry_id);
+  mutable_topology().geometries.erase(geometry_id);
 }
 
 template <typename T>
@@ -1211,7 +1221,7 @@ void GeometryState<T>::UpdatePosesRecursively(
   X_WF_[frame.index()] = X_WF;
   // Update the geometry which belong to *this* frame.
   for (auto child_id : frame.child_geometries()) {
-    auto& child_geometry = geometries_[child_id];
+    const auto& child_geometry = topology().geometries.at(child_id);
     // X_FG() is always RigidTransform<double>, to account for
     // GeometryState<AutoDiff>, we need to cast it to the common type T.
     RigidTransform<double> X_FG(child_geometry.X_FG());
@@ -1220,33 +1230,45 @@ void GeometryState<T>::UpdatePosesRecursively(
 
   // Update each child frame.
   for (auto child_id : frame.child_frames()) {
-    auto& child_frame = frames_[child_id];
+    const auto& child_frame = topology().frames.at(child_id);
     UpdatePosesRecursively(child_frame, X_WF, poses);
   }
 }
 
 template <typename T>
 const InternalGeometry* GeometryState<T>::GetGeometry(GeometryId id) const {
-  const auto& iterator = geometries_.find(id);
-  if (iterator != geometries_.end()) {
+  const auto& iterator = topology().geometries.find(id);
+  if (iterator != topology().geometries.end()) {
     return &iterator->second;
   }
   return nullptr;
 }
 
+template <typename T>
+internal::GeometryStateTopology& GeometryState<T>::mutable_topology() {
+  if (topology_.use_count() > 1) {
+    topology_ = std::make_shared<internal::GeometryStateTopology>(*topology_);
+  } else {
+    // The copies that shared the data may have released it from other
+    // threads; this orders their last reads before the writes that follow.
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  return *topology_;
+}
+
 template <typename T>
 InternalGeometry* GeometryState<T>::GetMutableGeometry(GeometryId id) {
-  const InternalGeometry* geometry = GetGeometry(id);
-  return const_cast<InternalGeometry*>(geometry);
+  if (GetGeometry(id) == nullptr) return nullptr;
+  return &mutable_topology().geometries.at(id);
 }
 
 template <typename T>
 bool GeometryState<T>::NameIsUnique(FrameId id, Role role,
                                     const std::string& name) const {
   bool unique = true;
-  const InternalFrame& frame = GetValueOrThrow(id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(id, topology().frames);
   for (GeometryId geometry_id : frame.child_geometries()) {
-    const InternalGeometry& geometry = geometries_.at(geometry_id);
+    const InternalGeometry& geometry = topology().geometries.at(geometry_id);
     if (geometry.has_role(role) && geometry.name() == name) {
       unique = false;
       break;
@@ -1386,21 +1408,21 @@ const InternalFrame& GeometryState<T>::ValidateAndGetFrame(
     SourceId source_id, FrameId frame_id) const {
   // Handle the special case of the world frame; source_id will *not* own it.
   if (frame_id == InternalFrame::world_frame_id()) {
-    FindOrThrow(source_id, source_frame_id_map_, [source_id]() {
+    FindOrThrow(source_id, topology().source_frame_id_map, [source_id]() {
       return get_missing_id_message(source_id);
     });
-    return frames_.at(frame_id);
+    return topology().frames.at(frame_id);
   } else {
     // The generic test that the frame_id is owned by the source_id.
     const FrameIdSet& set =
-        GetValueOrThrow(source_id, source_frame_id_map_);
+        GetValueOrThrow(source_id, topology().source_frame_id_map);
     FindOrThrow(frame_id, set, [frame_id, source_id]() {
       return "Referenced frame " + to_string(frame_id) + " for source " +
           to_string(source_id) +
           ", but the frame doesn't belong to the source.";
     });
   }
-  return frames_.at(frame_id);
+  return topology().frames.at(frame_id);
 }
 
 template <typename T>
@@ -1420,7 +1442,8 @@ RigidTransformd GeometryState<T>::GetDoubleWorldPose(FrameId frame_id) const {
   if (frame_id == InternalFrame::world_frame_id()) {
     return RigidTransformd::Identity();
   }
-  const internal::InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const internal::InternalFrame& frame =
+      GetValueOrThrow(frame_id, topology().frames);
   return internal::convert_to_double(X_WF_[frame.index()]);
 }
 
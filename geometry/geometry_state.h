@@ -49,6 +49,58 @@ using FrameIdSet = std::unordered_set<FrameId>;
 
 //@}
 
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+
+/* The registration data of a GeometryState: the registered sources and the
+ frames and geometries registered on them (including their shapes and
+ properties). This data does not depend on the scalar type, and should only
+ change at _discrete_ events where sources, frames, geometries or roles are
+ introduced and removed. It does _not_ depend on time-dependent input values
+ (e.g., System::Context). Therefore, all the copies of a GeometryState (e.g.,
+ in cloned contexts) share the same instance until one of them modifies it, at
+ which point that copy gets its own instance.  */
+struct GeometryStateTopology {
+  // The registered geometry sources and the frame ids that have been registered
+  // on them.
+  std::unordered_map<SourceId, FrameIdSet> source_frame_id_map;
+
+  // The registered geometry sources and the frame ids that have the world frame
+  // as the parent frame. For a completely flat hierarchy, this contains the
+  // same values as the corresponding entry in source_frame_id_map.
+  std::unordered_map<SourceId, FrameIdSet> source_root_frame_map;
+
+  // The registered geometry source names. Each name is unique and the keys in
+  // this map should be identical to those in source_frame_id_map and
+  // source_root_frame_map.
+  std::unordered_map<SourceId, std::string> source_names;
+
+  // The registered geometry sources and the _anchored_ geometries that have
+  // been registered on them. These don't fit in the frame hierarchy because
+  // they do not belong to dynamic frames.
+  std::unordered_map<SourceId, std::unordered_set<GeometryId>>
+      source_anchored_geometry_map;
+
+  // The frame data, keyed on unique frame identifier.
+  std::unordered_map<FrameId, InternalFrame> frames;
+
+  // The geometry data, keyed on unique geometry identifiers.
+  std::unordered_map<GeometryId, InternalGeometry> geometries;
+
+  // This provides the look up from the internal index of a frame to its frame
+  // id. It is constructed so that the index value of any position in the vector
+  // _is_ the frame index of the corresponding frame.
+  // It should be invariant that:
+  //   1. frames.size() == frame_index_to_id_map.size();
+  //   2. frame_index_to_id_map.size() == biggest_index(frames) + 1
+  //      i.e. the largest pose index associated with frames is the last valid
+  //      index of this vector.
+  std::vector<FrameId> frame_index_to_id_map;
+};
+
+}  // namespace internal
+#endif
+
 // TODO(SeanCurtis-TRI): Move GeometryState into `internal` namespace (and then
 //  I can kill the `@note` in the class documentation).
 
@@ -94,25 +146,29 @@ class GeometryState {
 
   /** Implementation of SceneGraphInspector::num_sources().  */
   int get_num_sources() const {
-    return static_cast<int>(source_frame_id_map_.size());
+    return static_cast<int>(topology().source_frame_id_map.size());
   }
 
   /** Implementation of SceneGraphInspector::num_frames().  */
-  int get_num_frames() const { return static_cast<int>(frames_.size()); }
+  int get_num_frames() const {
+    return static_cast<int>(topology().frames.size());
+  }
 
   /** Implementation of SceneGraphInspector::all_frame_ids().  */
-  FrameIdRange get_frame_ids() const { return FrameIdRange(&frames_); }
+  FrameIdRange get_frame_ids() const {
+    return FrameIdRange(&topology().frames);
+  }
 
   /** Implementation of SceneGraphInspector::num_geometries().  */
   int get_num_geometries() const {
-    return static_cast<int>(geometries_.size());
+    return static_cast<int>(topology().geometries.size());
   }
 
   /** Implementation of SceneGraphInspector::GetAllGeometryIds().  */
   std::vector<GeometryId> GetAllGeometryIds() const {
     std::vector<GeometryId> ids;
-    ids.reserve(geometries_.size());
-    for (const auto& id_geometry_pair : geometries_) {
+    ids.reserve(topology().geometries.size());
+    for (const auto& id_geometry_pair : topology().geometries) {
       ids.push_back(id_geometry_pair.first);
     }
     return ids;
@@ -464,6 +520,14 @@ class GeometryState {
                                                           threshold);
   }
 
+  /** Implementation of QueryObject::ComputeSignedDistanceToPoints().  */
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(const Matrix3X<T>& p_WQs,
+                                double threshold) const {
+    return geometry_engine_->ComputeSignedDistanceToPoints(p_WQs, X_WGs_,
+                                                           threshold);
+  }
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -559,13 +623,7 @@ class GeometryState {
   template <typename U>
   explicit GeometryState(const GeometryState<U>& source)
       : self_source_(source.self_source_),
-        source_frame_id_map_(source.source_frame_id_map_),
-        source_root_frame_map_(source.source_root_frame_map_),
-        source_names_(source.source_names_),
-        source_anchored_geometry_map_(source.source_anchored_geometry_map_),
-        frames_(source.frames_),
-        geometries_(source.geometries_),
-        frame_index_to_id_map_(source.frame_index_to_id_map_),
+        topology_(source.topology_),
         geometry_engine_(std::move(source.geometry_engine_->ToAutoDiffXd())),
         render_engines_(source.render_engines_) {
     auto convert_pose_vector = [](const std::vector<math::RigidTransform<U>>& s,
@@ -675,7 +733,7 @@ class GeometryState {
   //    frame and, if it exists, its parent geometry.
   //   - RemoveGeometryUnchecked(): This is the recursive call; it's parent
   //    is already slated for removal, so parent references can be left alone.
-  // @throws std::logic_error if `geometry_id` is not in `geometries_`.
+  // @throws std::logic_error if `geometry_id` is not a registered geometry.
   void RemoveGeometryUnchecked(GeometryId geometry_id,
                                RemoveGeometryOrigin caller);
 
@@ -689,9 +747,17 @@ class GeometryState {
   // Reports true if the given id refers to a _dynamic_ geometry. Assumes the
   // precondition that id refers to a valid geometry in the state.
   bool is_dynamic(GeometryId id) const {
-    return geometries_.at(id).is_dynamic();
+    return topology().geometries.at(id).is_dynamic();
   }
 
+  // Returns the registration data, which may be shared with copies of this
+  // state.
+  const internal::GeometryStateTopology& topology() const { return *topology_; }
+
+  // Returns the registration data for modification. If it is shared with
+  // copies of this state, this state first gets its own copy of it.
+  internal::GeometryStateTopology& mutable_topology();
+
   // Convenience function for accessing geometry whether dynamic or anchored.
   const internal::InternalGeometry* GetGeometry(GeometryId id) const;
 
@@ -762,47 +828,10 @@ class GeometryState {
   // world frame).
   SourceId self_source_;
 
-  // Maps from registered source ids to the entities registered to those
-  // sources (e.g., frames and geometries). This lives in the state to support
-  // runtime topology changes. This data should only change at _discrete_
-  // events where frames/geometries are introduced and removed. They do _not_
-  // depend on time-dependent input values (e.g., System::Context).
-
-  // The registered geometry sources and the frame ids that have been registered
-  // on them.
-  std::unordered_map<SourceId, FrameIdSet> source_frame_id_map_;
-
-  // The registered geometry sources and the frame ids that have the world frame
-  // as the parent frame. For a completely flat hierarchy, this contains the
-  // same values as the corresponding entry in source_frame_id_map_.
-  std::unordered_map<SourceId, FrameIdSet> source_root_frame_map_;
-
-  // The registered geometry source names. Each name is unique and the keys in
-  // this map should be identical to those in source_frame_id_map_ and
-  // source_root_frame_map_.
-  std::unordered_map<SourceId, std::string> source_names_;
-
-  // The registered geometry sources and the _anchored_ geometries that have
-  // been registered on them. These don't fit in the frame hierarchy because
-  // they do not belong to dynamic frames.
-  std::unordered_map<SourceId, std::unordered_set<GeometryId>>
-      source_anchored_geometry_map_;
-
-  // The frame data, keyed on unique frame identifier.
-  std::unordered_map<FrameId, internal::InternalFrame> frames_;
-
-  // The geometry data, keyed on unique geometry identifiers.
-  std::unordered_map<GeometryId, internal::InternalGeometry> geometries_;
-
-  // This provides the look up from the internal index of a frame to its frame
-  // id. It is constructed so that the index value of any position in the vector
-  // _is_ the frame index of the corresponding frame.
-  // It should be invariant that:
-  //   1. frames_.size() == frame_index_to_id_map_.size();
-  //   2. frame_index_to_id_map_.size() == biggest_index(frames_) + 1
-  //      i.e. the largest pose index associated with frames_ is the last valid
-  //      index of this vector.
-  std::vector<FrameId> frame_index_to_id_map_;
+  // The registration data, shared among the copies of this state until one of
+  // them changes it; see internal::GeometryStateTopology. Only access it
+  // through topology() and mutable_topology().
+  std::shared_ptr<internal::GeometryStateTopology> topology_;
 
   // ---------------------------------------------------------------------
   // These values depend on time-dependent input values (e.g., current frame
@@ -829,8 +858,8 @@ class GeometryState {
   std::unordered_map<GeometryId, math::RigidTransform<T>> X_WGs_;
 
   // The pose of each frame relative to the _world_ frame.
-  // frames_.size() == X_WF_.size() is an invariant. Furthermore, after a
-  // complete state update from input poses,
+  // topology().frames.size() == X_WF_.size() is an invariant. Furthermore,
+  // after a complete state update from input poses,
   //   X_WF_[i] == X_WFₙ X_FₙFₙ₋₁ ... X_Fᵢ₊₂Fᵢ₊₁ X_PF_[i]
   // Where Fᵢ₊₁ is the parent frame of frame i, Fₖ₊₁ is the parent frame of
   // frame Fₖ, and the world frame W is the parent of frame Fₙ.
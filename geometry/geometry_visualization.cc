@@ -174,7 +174,7 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
   // role. These (plus possibly the world frame) are the frames that will be
   // broadcast in the message.
   std::vector<std::pair<FrameId, int>> dynamic_frames;
-  for (const auto& pair : state.frames_) {
+  for (const auto& pair : state.topology().frames) {
     const FrameId frame_id = pair.first;
     // We'll handle the world frame special.
     if (frame_id == InternalFrame::world_frame_id()) continue;
@@ -222,9 +222,9 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
     message.link[0].geom.resize(anchored_count);
     int geom_index = 0;
     const InternalFrame& world_frame =
-        state.frames_.at(InternalFrame::world_frame_id());
+        state.topology().frames.at(InternalFrame::world_frame_id());
     for (const GeometryId& id : world_frame.child_geometries()) {
-      const InternalGeometry& geometry = state.geometries_.at(id);
+      const InternalGeometry& geometry = state.topology().geometries.at(id);
       const GeometryProperties* props = get_properties(geometry, role);
       if (props != nullptr) {
         const Shape& shape = geometry.shape();
@@ -242,7 +242,7 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
   for (const auto& pair : dynamic_frames) {
     const FrameId frame_id = pair.first;
     const int geometry_count = pair.second;
-    const internal::InternalFrame& frame = state.frames_.at(frame_id);
+    const internal::InternalFrame& frame = state.topology().frames.at(frame_id);
     SourceId s_id = state.get_source_id(frame.id());
     const std::string& src_name = state.GetName(s_id);
     // TODO(SeanCurtis-TRI): The name in the load message *must* match the name
@@ -254,7 +254,8 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
     message.link[link_index].geom.resize(geometry_count);
     int geom_index = 0;
     for (GeometryId geom_id : frame.child_geometries()) {
-      const InternalGeometry& geometry = state.geometries_.at(geom_id);
+      const InternalGeometry& geometry =
+          state.topology().geometries.at(geom_id);
       const GeometryProperties* props = get_properties(geometry, role);
       if (props != nullptr) {
         const Shape& shape = geometry.shape();
@@ -1,8 +1,10 @@
 #include "drake/geometry/proximity/bvh.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <set>
+#include <stack>
 #include <vector>
 
 #include "drake/geometry/utilities.h"
@@ -27,6 +29,7 @@ Bvh<MeshType>::Bvh(const MeshType& mesh) {
 
   root_node_ =
       BuildBvTree(mesh, element_centroids.begin(), element_centroids.end());
+  Flatten();
 }
 
 template <class MeshType>
@@ -79,14 +82,17 @@ std::unique_ptr<BvNode<MeshType>> Bvh<MeshType>::BuildBvTree(
     bv_M.half_width().maxCoeff(&axis);
     // B is the canonical frame of the bounding volume.
     const auto& Baxis_M = bv_M.pose().rotation().col(axis);
-    std::sort(start, end,
-              [&Baxis_M](const CentroidPair& a, const CentroidPair& b) {
-                return Baxis_M.dot(a.second) < Baxis_M.dot(b.second);
-              });
-
-    // Continue with the next branches.
+    // The split only requires the elements to be partitioned about the median
+    // (each branch sorts its own elements again), which nth_element() does in
+    // linear time, instead of the O(n log n) of a full sort.
     const typename std::vector<CentroidPair>::iterator mid =
         start + num_elements / 2;
+    std::nth_element(start, mid, end,
+                     [&Baxis_M](const CentroidPair& a, const CentroidPair& b) {
+                       return Baxis_M.dot(a.second) < Baxis_M.dot(b.second);
+                     });
+
+    // Continue with the next branches.
     return std::make_unique<BvNode<MeshType>>(
         bv_M, BuildBvTree(mesh_M, start, mid), BuildBvTree(mesh_M, mid, end));
   }
@@ -97,15 +103,23 @@ Obb Bvh<MeshType>::ComputeBoundingVolume(
     const MeshType& mesh,
     const typename std::vector<CentroidPair>::iterator& start,
     const typename std::vector<CentroidPair>::iterator& end) {
-  std::set<typename MeshType::VertexIndex> vertices;
-  // Check each mesh element in the given range.
+  // Gather the vertices of each mesh element in the given range and remove the
+  // duplicates in a contiguous array first; building the set from the sorted
+  // unique vertices then takes linear time.
+  std::vector<typename MeshType::VertexIndex> element_vertices;
+  element_vertices.reserve(kElementVertexCount * (end - start));
   for (auto pair = start; pair < end; ++pair) {
     const auto& element = mesh.element(pair->first);
-    // Check each vertex in the element.
     for (int v = 0; v < kElementVertexCount; ++v) {
-      vertices.insert(element.vertex(v));
+      element_vertices.push_back(element.vertex(v));
     }
   }
+  std::sort(element_vertices.begin(), element_vertices.end());
+  element_vertices.erase(
+      std::unique(element_vertices.begin(), element_vertices.end()),
+      element_vertices.end());
+  const std::set<typename MeshType::VertexIndex> vertices(
+      element_vertices.begin(), element_vertices.end());
   return ObbMaker<MeshType>(mesh, vertices).Compute();
 }
 
@@ -124,6 +138,151 @@ Vector3d Bvh<MeshType>::ComputeCentroid(const MeshType& mesh,
   return centroid;
 }
 
+template <class MeshType>
+int Bvh<MeshType>::Update(const MeshType& mesh, double rebuild_volume_ratio) {
+  DRAKE_DEMAND(rebuild_volume_ratio >= 1.0);
+  std::set<typename MeshType::VertexIndex> vertices;
+  RefitTree(mesh, root_node_.get(), &vertices);
+  const int num_rebuilt =
+      RebuildOversizedTrees(mesh, rebuild_volume_ratio, &root_node_);
+  Flatten();
+  return num_rebuilt;
+}
+
+template <class MeshType>
+double Bvh<MeshType>::CalcVolumeRatio() const {
+  double volume = 0;
+  double build_volume = 0;
+  std::stack<const BvNode<MeshType>*> nodes;
+  nodes.push(root_node_.get());
+  while (!nodes.empty()) {
+    const BvNode<MeshType>* node = nodes.top();
+    nodes.pop();
+    volume += node->bv().CalcVolume();
+    build_volume += node->build_volume();
+    if (!node->is_leaf()) {
+      nodes.push(&node->left());
+      nodes.push(&node->right());
+    }
+  }
+  return volume / build_volume;
+}
+
+template <class MeshType>
+void Bvh<MeshType>::RefitTree(
+    const MeshType& mesh, BvNode<MeshType>* node,
+    std::set<typename MeshType::VertexIndex>* vertices) {
+  if (node->is_leaf()) {
+    std::set<typename MeshType::VertexIndex> leaf_vertices;
+    for (int i = 0; i < node->num_element_indices(); ++i) {
+      const auto& element = mesh.element(node->element_index(i));
+      for (int v = 0; v < kElementVertexCount; ++v) {
+        leaf_vertices.insert(element.vertex(v));
+      }
+    }
+    node->bv_ = FitOrientedBox(mesh, node->bv_.pose().rotation(),
+                               leaf_vertices);
+    vertices->insert(leaf_vertices.begin(), leaf_vertices.end());
+  } else {
+    // Fit the branch to its elements' vertices (like ComputeBoundingVolume()
+    // does) rather than to its children's boxes; boxes fit to boxes get
+    // looser at every level of the tree.
+    std::set<typename MeshType::VertexIndex> branch_vertices;
+    auto& children = std::get<typename BvNode<MeshType>::NodeChildren>(
+        node->child_);
+    RefitTree(mesh, children.left.get(), &branch_vertices);
+    RefitTree(mesh, children.right.get(), &branch_vertices);
+    node->bv_ = FitOrientedBox(mesh, node->bv_.pose().rotation(),
+                               branch_vertices);
+    vertices->insert(branch_vertices.begin(), branch_vertices.end());
+  }
+}
+
+template <class MeshType>
+int Bvh<MeshType>::RebuildOversizedTrees(
+    const MeshType& mesh, double ratio,
+    std::unique_ptr<BvNode<MeshType>>* subtree) {
+  BvNode<MeshType>* node = subtree->get();
+  if (node->bv().CalcVolume() > ratio * node->build_volume()) {
+    // Collect the elements in this subtree and build a new subtree from them.
+    std::vector<CentroidPair> element_centroids;
+    std::stack<const BvNode<MeshType>*> nodes;
+    nodes.push(node);
+    while (!nodes.empty()) {
+      const BvNode<MeshType>* current = nodes.top();
+      nodes.pop();
+      if (current->is_leaf()) {
+        for (int i = 0; i < current->num_element_indices(); ++i) {
+          const IndexType e = current->element_index(i);
+          element_centroids.emplace_back(e, ComputeCentroid(mesh, e));
+        }
+      } else {
+        nodes.push(&current->left());
+        nodes.push(&current->right());
+      }
+    }
+    *subtree = BuildBvTree(mesh, element_centroids.begin(),
+                           element_centroids.end());
+    return 1;
+  }
+  if (node->is_leaf()) return 0;
+
+  auto& children =
+      std::get<typename BvNode<MeshType>::NodeChildren>(node->child_);
+  const int num_rebuilt =
+      RebuildOversizedTrees(mesh, ratio, &children.left) +
+      RebuildOversizedTrees(mesh, ratio, &children.right);
+  if (num_rebuilt > 0) {
+    std::set<typename MeshType::VertexIndex> vertices;
+    RefitTree(mesh, node, &vertices);
+  }
+  return num_rebuilt;
+}
+
+template <class MeshType>
+Obb Bvh<MeshType>::FitOrientedBox(
+    const MeshType& mesh, const RotationMatrixd& R_MB,
+    const std::set<typename MeshType::VertexIndex>& vertices) {
+  DRAKE_DEMAND(!vertices.empty());
+  const RotationMatrixd R_BM = R_MB.inverse();
+  Vector3d lower_B = Vector3d::Constant(std::numeric_limits<double>::max());
+  Vector3d upper_B = -lower_B;
+  for (const auto& v : vertices) {
+    const Vector3d p_MV_B = R_BM * convert_to_double(mesh.vertex(v).r_MV());
+    lower_B = lower_B.cwiseMin(p_MV_B);
+    upper_B = upper_B.cwiseMax(p_MV_B);
+  }
+  const Vector3d p_MoBo_B = (upper_B + lower_B) / 2;
+  const Vector3d half_width = (upper_B - lower_B) / 2;
+  return Obb(math::RigidTransformd(R_MB, R_MB * p_MoBo_B), half_width);
+}
+
+template <class MeshType>
+void Bvh<MeshType>::Flatten() {
+  flat_nodes_.clear();
+  AppendFlatNodes(*root_node_, &flat_nodes_);
+}
+
+template <class MeshType>
+void Bvh<MeshType>::AppendFlatNodes(const BvNode<MeshType>& node,
+                                    std::vector<FlatNode>* flat_nodes) {
+  // Note: we refer to the new node by index; appending its descendants may
+  // reallocate the vector.
+  const int index = static_cast<int>(flat_nodes->size());
+  flat_nodes->emplace_back(node.bv());
+  if (node.is_leaf()) {
+    FlatNode& flat_node = flat_nodes->back();
+    flat_node.leaf.num_index = node.num_element_indices();
+    for (int i = 0; i < node.num_element_indices(); ++i) {
+      flat_node.leaf.indices[i] = node.element_index(i);
+    }
+  } else {
+    AppendFlatNodes(node.left(), flat_nodes);
+    (*flat_nodes)[index].right = static_cast<int>(flat_nodes->size());
+    AppendFlatNodes(node.right(), flat_nodes);
+  }
+}
+
 template <class MeshType>
 bool Bvh<MeshType>::EqualTrees(const BvNode<MeshType>& a,
                                const BvNode<MeshType>& b) {
@@ -2,7 +2,7 @@
 
 #include <array>
 #include <memory>
-#include <stack>
+#include <set>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -33,6 +33,9 @@ struct MeshTraits<VolumeMesh<T>> {
   static constexpr int kMaxElementPerBvhLeaf = 1;
 };
 
+template <class MeshType>
+class Bvh;
+
 /* Node of the tree structure representing the Bvh.  */
 template <class MeshType>
 class BvNode {
@@ -51,7 +54,9 @@ class BvNode {
    @param obb The bounding volume encompassing the elements.
    @param data contains indices into the mesh for retrieving the elements. */
   BvNode(Obb bv, LeafData data)
-      : bv_(std::move(bv)), child_(std::move(data)) {}
+      : bv_(std::move(bv)),
+        build_volume_(bv_.CalcVolume()),
+        child_(std::move(data)) {}
 
   /* Constructor for branch/internal nodes.
    @param bv The bounding volume encompassing the elements in child branches.
@@ -61,6 +66,7 @@ class BvNode {
   BvNode(Obb bv, std::unique_ptr<BvNode<MeshType>> left,
          std::unique_ptr<BvNode<MeshType>> right)
       : bv_(std::move(bv)),
+        build_volume_(bv_.CalcVolume()),
         child_(NodeChildren(std::move(left), std::move(right))) {}
 
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BvNode)
@@ -68,6 +74,11 @@ class BvNode {
   /* Returns the bounding volume.  */
   const Obb& bv() const { return bv_; }
 
+  /* Returns the volume of the bounding volume as it was when this node was
+   constructed. Comparing it with the volume of bv() measures how much
+   refitting (see Bvh::Update()) has loosened the bounding volume.  */
+  double build_volume() const { return build_volume_; }
+
   /* Returns the number of element indices.
    @pre is_leaf() returns true. */
   int num_element_indices() const {
@@ -115,6 +126,9 @@ class BvNode {
   }
 
  private:
+  // Bvh refits the bounding volumes of its nodes in place; see Bvh::Update().
+  friend class Bvh<MeshType>;
+
   struct NodeChildren {
     std::unique_ptr<BvNode<MeshType>> left;
     std::unique_ptr<BvNode<MeshType>> right;
@@ -134,6 +148,8 @@ class BvNode {
 
   Obb bv_;
 
+  double build_volume_{};
+
   // If this is a leaf node then the child refers to indices into the mesh's
   // elements (i.e., triangles or tetrahedra) bounded by the node's bounding
   // volume. Otherwise, it refers to child nodes further down the tree.
@@ -164,8 +180,9 @@ using BvttCallback = std::function<BvttCallbackResult(
  hierarchy's frame H. Leaf nodes contain element indices into elements of the
  mesh. The BVH needs a reference to the mesh in order to build the tree, but
  does not own the mesh.
- @pre    The mesh is not mutable. Modifications to the mesh after
-         constructing the BVH will make the BVH invalid.
+ @pre    Modifications to the mesh after constructing the BVH will make the
+         BVH invalid, unless they only move the mesh's vertices and are
+         followed by a call to Update().
  @tparam MeshType SurfaceMesh<double> or VolumeMesh<double> (Exotic types like
          SurfaceMesh<AutoDiffXd> are not supported).  */
 template <class MeshType>
@@ -181,6 +198,7 @@ class Bvh {
     if (&bvh == this) return *this;
 
     root_node_ = std::make_unique<BvNode<MeshType>>(*bvh.root_node_);
+    flat_nodes_ = bvh.flat_nodes_;
     return *this;
   }
 
@@ -189,48 +207,97 @@ class Bvh {
 
   const BvNode<MeshType>& root_node() const { return *root_node_; }
 
+  /* The default value of the `rebuild_volume_ratio` parameter of Update().  */
+  static constexpr double kDefaultRebuildVolumeRatio = 4.0;
+
+  /* Updates the bounding volumes of this hierarchy to enclose the elements of
+   the given `mesh`, whose vertices may have moved (arbitrarily, not
+   necessarily rigidly) since the hierarchy was built. The tree is refit
+   bottom up: each node's box keeps its orientation and is shrunk or grown to
+   fit the new positions of the vertices of the elements it bounds. This is
+   much cheaper than building a new hierarchy, but the refit boxes can be
+   looser than freshly built ones, which makes culling less effective.
+
+   To bound that degradation, any subtree whose root box volume exceeds
+   `rebuild_volume_ratio` times its volume when it was built (see
+   BvNode::build_volume()) is rebuilt from scratch (an "oversized" subtree).
+   Only the largest oversized subtrees are rebuilt; their ancestors are then
+   refit again.
+
+   @param mesh  The mesh used to build this hierarchy, or a mesh with the same
+                elements (in the same order) but different vertex positions.
+   @param rebuild_volume_ratio  The ratio of refit volume to build volume that
+                triggers rebuilding a subtree. Pass infinity to only refit.
+   @returns The number of rebuilt subtrees.
+   @pre `mesh` has the same elements as the mesh this hierarchy was built
+        from.
+   @pre `rebuild_volume_ratio` >= 1.  */
+  int Update(const MeshType& mesh,
+             double rebuild_volume_ratio = kDefaultRebuildVolumeRatio);
+
+  /* Reports the quality of the bounding volumes of this hierarchy as the ratio
+   of the total volume of all of its boxes to their total volume when they
+   were built. The value is one for a freshly built tree and grows as Update()
+   loosens the boxes.  */
+  double CalcVolumeRatio() const;
+
   /* Perform a query of this bvh's mesh elements against the given bvh's
    mesh elements and runs the callback for each unculled pair.  */
   template <class OtherMeshType>
   void Collide(const Bvh<OtherMeshType>& bvh, const math::RigidTransformd& X_AB,
                BvttCallback<MeshType, OtherMeshType> callback) const {
-    using NodePair =
-        std::pair<const BvNode<MeshType>&, const BvNode<OtherMeshType>&>;
-    std::stack<NodePair, std::vector<NodePair>> node_pairs;
-    node_pairs.emplace(root_node(), bvh.root_node());
+    // Pairs of indices into flat_nodes_ and bvh.flat_nodes_ whose bounding
+    // volumes are known to overlap. Testing the children of a pair of nodes
+    // before pushing them allows the four pairs of children of two branches
+    // to be tested together with the batched Obb::HasOverlap().
+    std::vector<std::pair<int, int>> node_pairs;
+    auto push_if_overlapping = [this, &bvh, &X_AB, &node_pairs](int a, int b) {
+      if (Obb::HasOverlap(flat_nodes_[a].bv, bvh.flat_nodes_[b].bv, X_AB)) {
+        node_pairs.emplace_back(a, b);
+      }
+    };
+    push_if_overlapping(0, 0);
 
     while (!node_pairs.empty()) {
-      const auto& [node_a, node_b] = node_pairs.top();
-      node_pairs.pop();
-
-      // Check if the bounding volumes overlap.
-      if (!Obb::HasOverlap(node_a.bv(), node_b.bv(), X_AB)) {
-        continue;
-      }
+      const auto [a, b] = node_pairs.back();
+      node_pairs.pop_back();
+      const auto& node_a = flat_nodes_[a];
+      const auto& node_b = bvh.flat_nodes_[b];
 
       // Run the callback on the pair if they are both leaf nodes, otherwise
       // check each branch.
       if (node_a.is_leaf() && node_b.is_leaf()) {
-        const int num_a_elements = node_a.num_element_indices();
-        const int num_b_elements = node_b.num_element_indices();
-        for (int a = 0; a < num_a_elements; ++a) {
-          for (int b = 0; b < num_b_elements; ++b) {
+        const int num_a_elements = node_a.leaf.num_index;
+        const int num_b_elements = node_b.leaf.num_index;
+        for (int i = 0; i < num_a_elements; ++i) {
+          for (int j = 0; j < num_b_elements; ++j) {
             BvttCallbackResult result =
-                callback(node_a.element_index(a), node_b.element_index(b));
+                callback(node_a.leaf.indices[i], node_b.leaf.indices[j]);
             if (result == BvttCallbackResult::Terminate) return;  // Exit early.
           }
         }
       } else if (node_b.is_leaf()) {
-        node_pairs.emplace(node_a.left(), node_b);
-        node_pairs.emplace(node_a.right(), node_b);
+        push_if_overlapping(node_a.left(a), b);
+        push_if_overlapping(node_a.right, b);
       } else if (node_a.is_leaf()) {
-        node_pairs.emplace(node_a, node_b.left());
-        node_pairs.emplace(node_a, node_b.right());
+        push_if_overlapping(a, node_b.left(b));
+        push_if_overlapping(a, node_b.right);
       } else {
-        node_pairs.emplace(node_a.left(), node_b.left());
-        node_pairs.emplace(node_a.right(), node_b.left());
-        node_pairs.emplace(node_a.left(), node_b.right());
-        node_pairs.emplace(node_a.right(), node_b.right());
+        const std::array<int, 4> children_a{node_a.left(a), node_a.right,
+                                            node_a.left(a), node_a.right};
+        const std::array<int, 4> children_b{node_b.left(b), node_b.left(b),
+                                            node_b.right, node_b.right};
+        const std::array<bool, 4> overlaps = Obb::HasOverlap(
+            {&flat_nodes_[children_a[0]].bv, &flat_nodes_[children_a[1]].bv,
+             &flat_nodes_[children_a[2]].bv, &flat_nodes_[children_a[3]].bv},
+            {&bvh.flat_nodes_[children_b[0]].bv,
+             &bvh.flat_nodes_[children_b[1]].bv,
+             &bvh.flat_nodes_[children_b[2]].bv,
+             &bvh.flat_nodes_[children_b[3]].bv},
+            X_AB);
+        for (int k = 0; k < 4; ++k) {
+          if (overlaps[k]) node_pairs.emplace_back(children_a[k], children_b[k]);
+        }
       }
     }
   }
@@ -260,25 +327,27 @@ class Bvh {
       const PrimitiveType& primitive_P, const math::RigidTransformd& X_PH,
       std::function<BvttCallbackResult(typename MeshType::ElementIndex)>
           callback) const {
-    std::stack<const BvNode<MeshType>*> nodes;
-    nodes.emplace(&root_node());
+    // Indices into flat_nodes_.
+    std::vector<int> nodes;
+    nodes.push_back(0);
     while (!nodes.empty()) {
-      const auto node = nodes.top();
-      nodes.pop();
+      const int n = nodes.back();
+      nodes.pop_back();
+      const FlatNode& node = flat_nodes_[n];
 
-      if (!Obb::HasOverlap(node->bv(), primitive_P, X_PH)) {
+      if (!Obb::HasOverlap(node.bv, primitive_P, X_PH)) {
         continue;
       }
       // Run the call back if `node` is a leaf.
-      if (node->is_leaf()) {
-        const int num_elements = node->num_element_indices();
+      if (node.is_leaf()) {
+        const int num_elements = node.leaf.num_index;
         for (int i = 0; i < num_elements; ++i) {
-          BvttCallbackResult result = callback(node->element_index(i));
+          BvttCallbackResult result = callback(node.leaf.indices[i]);
           if (result == BvttCallbackResult::Terminate) return;  // Exit early.
         }
       } else {
-        nodes.emplace(&node->left());
-        nodes.emplace(&node->right());
+        nodes.push_back(node.left(n));
+        nodes.push_back(node.right);
       }
     }
   }
@@ -315,6 +384,26 @@ class Bvh {
   // Convenience class for testing.
   friend class BvhTester;
 
+  // Collide() traverses the other hierarchy's flat_nodes_.
+  template <class OtherMeshType>
+  friend class Bvh;
+
+  // A node of the flattened hierarchy; see flat_nodes_.
+  struct FlatNode {
+    explicit FlatNode(const Obb& bv_in) : bv(bv_in) {}
+
+    bool is_leaf() const { return right < 0; }
+
+    // The left child of a branch immediately follows it in depth-first order.
+    int left(int self) const { return self + 1; }
+
+    Obb bv;
+    // The index of the right child of a branch, or -1 for a leaf.
+    int right{-1};
+    // The elements of a leaf; num_index is zero for a branch.
+    typename BvNode<MeshType>::LeafData leaf{0, {}};
+  };
+
   using CentroidPair = std::pair<IndexType, Vector3<double>>;
 
   static std::unique_ptr<BvNode<MeshType>> BuildBvTree(
@@ -332,6 +421,32 @@ class Bvh {
   static Vector3<double> ComputeCentroid(const MeshType& mesh,
                                          IndexType i);
 
+  // Refits the bounding volumes of the subtree rooted at `node` to the
+  // elements of `mesh`, bottom up, and adds the subtree's vertices to
+  // `vertices`; see Update().
+  static void RefitTree(const MeshType& mesh, BvNode<MeshType>* node,
+                        std::set<typename MeshType::VertexIndex>* vertices);
+
+  // Rebuilds the largest subtrees (rooted at or below `subtree`) whose
+  // volumes exceed `ratio` times their build volumes, refitting the
+  // ancestors of rebuilt subtrees. Returns the number of rebuilt subtrees.
+  static int RebuildOversizedTrees(const MeshType& mesh, double ratio,
+                                   std::unique_ptr<BvNode<MeshType>>* subtree);
+
+  // Returns the box in orientation R_MB that encloses the given `vertices` of
+  // `mesh`.
+  static Obb FitOrientedBox(
+      const MeshType& mesh, const math::RotationMatrixd& R_MB,
+      const std::set<typename MeshType::VertexIndex>& vertices);
+
+  // Rebuilds flat_nodes_ from the tree rooted at root_node_.
+  void Flatten();
+
+  // Appends the subtree rooted at `node` to `flat_nodes` in depth-first
+  // order.
+  static void AppendFlatNodes(const BvNode<MeshType>& node,
+                              std::vector<FlatNode>* flat_nodes);
+
   // Tests that the two hierarchy trees, rooted at nodes a and b, are equal in
   // the sense that they have identical structure and equal bounding volumes
   // (see Obb::Equal()).
@@ -340,6 +455,14 @@ class Bvh {
   static constexpr int kElementVertexCount = MeshType::kDim + 1;
 
   std::unique_ptr<BvNode<MeshType>> root_node_;
+
+  // The same hierarchy as root_node_, stored contiguously in depth-first
+  // order with child indices instead of pointers. The traversals in Collide()
+  // use this copy so that they stay within a single allocation regardless of
+  // where (e.g., after Update() rebuilds subtrees) the tree's nodes live on
+  // the heap. The root is at index 0. It must be rebuilt (see Flatten())
+  // whenever the tree changes.
+  std::vector<FlatNode> flat_nodes_;
 };
 
 }  // namespace internal
@@ -1,13 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
-#include "drake/common/sorted_vectors_have_intersection.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
 
 namespace drake {
@@ -17,16 +18,24 @@ namespace internal {
 // TODO(SeanCurtis-TRI): Replace this "legacy" mechanism with the
 // new-and-improved alternative when it is ready.
 /* A simple class for providing collision filtering functionality similar to
- that found in RigidBodyTree but made compatible with fcl. The majority of
- this code is lifted verbatim from drake/multibody/collision/element.{h, cc}.
+ that found in RigidBodyTree but made compatible with fcl.
 
  The basic principle is that we create "cliques". If geometries A and B belong
  to the same clique, then the pair (A, B) is filtered. It is possible for A and
- B to redundantly belong to multiple cliques.
+ B to redundantly belong to multiple cliques. Individual pairs can also be
+ filtered directly with ExcludePair(), without consuming any cliques.
 
  Geometries are identified by their encoded ids (see EncodedData). Before a
  geometry can be added to a clique (AddToCollisionClique()) it must be added
- to this filter system (AddGeometry()).  */
+ to this filter system (AddGeometry()).
+
+ The filtered pairs are stored in a dense, symmetric bit matrix indexed by a
+ compact slot assigned to each geometry; the cliques only record their members
+ so that geometries joining a clique later can be filtered against them.
+ Therefore CanCollideWith(), which is evaluated for every broadphase candidate,
+ costs O(1) regardless of the number of cliques, while adding a geometry to a
+ clique costs O(m), for a clique with m members. The matrix requires n²/8
+ bytes for n geometries.  */
 class CollisionFilterLegacy {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CollisionFilterLegacy)
@@ -36,49 +45,78 @@ class CollisionFilterLegacy {
   /* Adds a geometry to the filter system as represented by its encoded `id`
    (see EncodedData). When added, it will not be part of any filtered pairs.  */
   void AddGeometry(uintptr_t id) {
-    collision_cliques_.insert({id, std::vector<int>()});
+    if (slots_.count(id) > 0) return;
+    int slot{};
+    if (!free_slots_.empty()) {
+      slot = free_slots_.back();
+      free_slots_.pop_back();
+    } else {
+      slot = num_slots_++;
+      if (num_slots_ > capacity_) Reserve(std::max(2 * capacity_, kWordBits));
+    }
+    slots_.insert({id, Slot{slot, {}}});
   }
 
   /* Removes the geometry represented by its encoded `id` from the data. If
    `id` has no collision filters; no action is taken.  */
   void RemoveGeometry(uintptr_t id) {
-    collision_cliques_.erase(id);
+    auto iter = slots_.find(id);
+    if (iter == slots_.end()) return;
+    const Slot& slot = iter->second;
+    for (int clique : slot.cliques) {
+      std::vector<uintptr_t>& members = clique_members_[clique];
+      members.erase(std::find(members.begin(), members.end(), id));
+    }
+    // Clear the row and the column of the slot so that it can be reused.
+    for (int other = 0; other < num_slots_; ++other) {
+      SetFiltered(slot.index, other, false);
+    }
+    free_slots_.push_back(slot.index);
+    slots_.erase(iter);
   }
 
   /* Reports true if the geometry pair (`id_A`, `id_B`) has been explicitly
    added to the set of filtered pairs.  */
   bool CanCollideWith(uintptr_t id_A, uintptr_t id_B) const {
     // These ids should all be registered with the filter machinery.
-    DRAKE_ASSERT(collision_cliques_.count(id_A) == 1);
-    DRAKE_ASSERT(collision_cliques_.count(id_B) == 1);
-
-    bool excluded = id_A == id_B ||
-                    SortedVectorsHaveIntersection(collision_cliques_.at(id_A),
-                                                  collision_cliques_.at(id_B));
-
-    return !excluded;
+    DRAKE_ASSERT(slots_.count(id_A) == 1);
+    DRAKE_ASSERT(slots_.count(id_B) == 1);
+    if (id_A == id_B) return false;
+    return !IsFiltered(slots_.at(id_A).index, slots_.at(id_B).index);
   }
 
   /* Adds the previously registered geometry indicated by its encoded id
-   `geometry_id` to the clique with the given `clique_id`.  */
+   `geometry_id` to the clique with the given `clique_id`. The geometry is
+   filtered against every current member of the clique.  */
   void AddToCollisionClique(uintptr_t geometry_id, int clique_id) {
-    DRAKE_ASSERT(collision_cliques_.count(geometry_id) == 1);
-
-    std::vector<int>& cliques = collision_cliques_[geometry_id];
-    // Order(N) insertion.
-    // `cliques` is a sorted vector so that checking if two collision elements
-    // belong to a common group can be performed efficiently in order N.
-    // See Element::CanCollideWith() and Element::collision_cliques_ for
-    // explanation.
+    DRAKE_ASSERT(slots_.count(geometry_id) == 1);
+
+    Slot& slot = slots_.at(geometry_id);
+    std::vector<int>& cliques = slot.cliques;
+    // `cliques` is kept sorted so that duplicate clique ids can be detected in
+    // logarithmic time.
     auto it = std::lower_bound(cliques.begin(), cliques.end(), clique_id);
+    if (it != cliques.end() && !(clique_id < *it)) return;
+    cliques.insert(it, clique_id);
 
-    // This test prevents duplicate clique ids from being added.
-    if (it == cliques.end() || clique_id < *it) cliques.insert(it, clique_id);
+    std::vector<uintptr_t>& members = clique_members_[clique_id];
+    for (uintptr_t member : members) {
+      SetFiltered(slot.index, slots_.at(member).index, true);
+    }
+    members.push_back(geometry_id);
+  }
+
+  /* Filters the pair of previously registered geometries indicated by their
+   encoded ids (`id_A`, `id_B`) without consuming a clique.  */
+  void ExcludePair(uintptr_t id_A, uintptr_t id_B) {
+    DRAKE_ASSERT(slots_.count(id_A) == 1);
+    DRAKE_ASSERT(slots_.count(id_B) == 1);
+    SetFiltered(slots_.at(id_A).index, slots_.at(id_B).index, true);
   }
 
   int num_cliques(uintptr_t geometry_id) const {
-    DRAKE_ASSERT(collision_cliques_.count(geometry_id) == 1);
-    return static_cast<int>(collision_cliques_.at(geometry_id).size());
+    DRAKE_ASSERT(slots_.count(geometry_id) == 1);
+    return static_cast<int>(slots_.at(geometry_id).cliques.size());
   }
 
   /* Allocates a new clique and returns its id (to use with
@@ -100,9 +138,67 @@ class CollisionFilterLegacy {
   int peek_next_clique() const { return next_available_clique_; }
 
  private:
-  // A map between the EncodedData::encoding() value for a geometry and
-  // its set of cliques.
-  std::unordered_map<uintptr_t, std::vector<int>> collision_cliques_;
+  // The bookkeeping of a registered geometry: its slot in the bit matrix and
+  // the sorted ids of the cliques it belongs to.
+  struct Slot {
+    int index{};
+    std::vector<int> cliques;
+  };
+
+  static constexpr int kWordBits = 64;
+
+  bool IsFiltered(int a, int b) const {
+    const int64_t bit = static_cast<int64_t>(a) * capacity_ + b;
+    return (filtered_[bit / kWordBits] >> (bit % kWordBits)) & 1;
+  }
+
+  // Sets the (symmetric) filter state of the pair of slots (a, b).
+  void SetFiltered(int a, int b, bool filtered) {
+    SetBit(static_cast<int64_t>(a) * capacity_ + b, filtered);
+    SetBit(static_cast<int64_t>(b) * capacity_ + a, filtered);
+  }
+
+  void SetBit(int64_t bit, bool value) {
+    const uint64_t mask = uint64_t{1} << (bit % kWordBits);
+    uint64_t& word = filtered_[bit / kWordBits];
+    word = value ? (word | mask) : (word & ~mask);
+  }
+
+  // Grows the bit matrix to `capacity` slots, preserving its contents.
+  // `capacity` is a multiple of kWordBits, so that every row is word aligned.
+  void Reserve(int capacity) {
+    DRAKE_DEMAND(capacity % kWordBits == 0 && capacity >= capacity_);
+    const int old_words_per_row = capacity_ / kWordBits;
+    const int words_per_row = capacity / kWordBits;
+    std::vector<uint64_t> filtered(
+        static_cast<size_t>(capacity) * words_per_row, 0);
+    for (int row = 0; row < capacity_; ++row) {
+      std::copy_n(
+          filtered_.begin() + static_cast<int64_t>(row) * old_words_per_row,
+          old_words_per_row,
+          filtered.begin() + static_cast<int64_t>(row) * words_per_row);
+    }
+    filtered_ = std::move(filtered);
+    capacity_ = capacity;
+  }
+
+  // A map between the EncodedData::encoding() value for a geometry and its
+  // bookkeeping.
+  std::unordered_map<uintptr_t, Slot> slots_;
+
+  // The slots released by RemoveGeometry(), to be reused by AddGeometry().
+  std::vector<int> free_slots_;
+
+  // The number of slots ever assigned (including the free ones).
+  int num_slots_{0};
+
+  // The row-major bit matrix of filtered slot pairs, with capacity_ rows of
+  // capacity_ bits.
+  int capacity_{0};
+  std::vector<uint64_t> filtered_;
+
+  // The encoded ids of the members of each clique.
+  std::unordered_map<int, std::vector<uintptr_t>> clique_members_;
 
   int next_available_clique_{0};
 };
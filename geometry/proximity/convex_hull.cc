@@ -0,0 +1,319 @@
+#include "drake/geometry/proximity/convex_hull.h"
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+namespace {
+
+using Eigen::Vector3d;
+
+// The distance from the hull, relative to the extent of the points, below
+// which a point is considered to be inside the hull.
+constexpr double kRelativeTolerance = 1e-10;
+
+// Builds the convex hull of a set of points with the Quickhull algorithm.
+class QuickHull {
+ public:
+  explicit QuickHull(const std::vector<Vector3d>& points) : points_(points) {}
+
+  ConvexHull Compute() {
+    if (points_.size() < 4) ThrowCoplanar();
+    Vector3d lower = points_[0];
+    Vector3d upper = points_[0];
+    for (const Vector3d& p : points_) {
+      lower = lower.cwiseMin(p);
+      upper = upper.cwiseMax(p);
+    }
+    tolerance_ = kRelativeTolerance * (upper - lower).maxCoeff();
+
+    AddInitialTetrahedron();
+    std::vector<int> stack;
+    for (int t = 0; t < static_cast<int>(triangles_.size()); ++t) {
+      if (!triangles_[t].outside.empty()) stack.push_back(t);
+    }
+    while (!stack.empty()) {
+      const int t = stack.back();
+      stack.pop_back();
+      if (triangles_[t].removed || triangles_[t].outside.empty()) continue;
+      AddFarthestOutsidePoint(t, &stack);
+    }
+    return MakeConvexHull();
+  }
+
+ private:
+  // A triangle of the hull being built. Its vertices are counterclockwise
+  // when seen from outside of the hull, and neighbor[i] is the triangle
+  // across its edge from vertex[i] to vertex[(i + 1) % 3].
+  struct Triangle {
+    std::array<int, 3> vertex;
+    std::array<int, 3> neighbor;
+    // The unit outward normal n and the offset d of the plane n⋅p = d of the
+    // triangle.
+    Vector3d normal;
+    double offset{};
+    // The points above the plane of the triangle that were not yet added to
+    // the hull.
+    std::vector<int> outside;
+    bool removed{false};
+  };
+
+  // A horizon edge, from vertex a to vertex b of a triangle that is visible
+  // from the added point, and the triangle across it, which is not.
+  struct HorizonEdge {
+    int a;
+    int b;
+    int outer;
+  };
+
+  [[noreturn]] static void ThrowCoplanar() {
+    throw std::runtime_error(
+        "CalcConvexHull(): the points are coplanar; they have no volumetric "
+        "convex hull");
+  }
+
+  double Distance(const Triangle& triangle, int p) const {
+    return triangle.normal.dot(points_[p]) - triangle.offset;
+  }
+
+  int AddTriangle(int a, int b, int c) {
+    Triangle triangle;
+    triangle.vertex = {a, b, c};
+    triangle.neighbor = {-1, -1, -1};
+    triangle.normal =
+        (points_[b] - points_[a]).cross(points_[c] - points_[a]).normalized();
+    triangle.offset = triangle.normal.dot(points_[a]);
+    triangles_.push_back(std::move(triangle));
+    return static_cast<int>(triangles_.size()) - 1;
+  }
+
+  // Adds the initial tetrahedron spanned by four extreme points, and assigns
+  // the other points to the outside sets of its triangles.
+  void AddInitialTetrahedron() {
+    // The two points farthest apart among the extreme points along the axes.
+    std::array<int, 6> extremes{};
+    for (int p = 0; p < static_cast<int>(points_.size()); ++p) {
+      for (int axis = 0; axis < 3; ++axis) {
+        if (points_[p][axis] < points_[extremes[2 * axis]][axis]) {
+          extremes[2 * axis] = p;
+        }
+        if (points_[p][axis] > points_[extremes[2 * axis + 1]][axis]) {
+          extremes[2 * axis + 1] = p;
+        }
+      }
+    }
+    int i0 = extremes[0];
+    int i1 = extremes[1];
+    double max_distance = 0;
+    for (int i : extremes) {
+      for (int j : extremes) {
+        const double d = (points_[i] - points_[j]).norm();
+        if (d > max_distance) {
+          max_distance = d;
+          i0 = i;
+          i1 = j;
+        }
+      }
+    }
+    if (max_distance <= tolerance_) ThrowCoplanar();
+
+    // The point farthest from the line through the first two.
+    const Vector3d direction = (points_[i1] - points_[i0]).normalized();
+    int i2 = i0;
+    max_distance = 0;
+    for (int p = 0; p < static_cast<int>(points_.size()); ++p) {
+      const double d = (points_[p] - points_[i0]).cross(direction).norm();
+      if (d > max_distance) {
+        max_distance = d;
+        i2 = p;
+      }
+    }
+    if (max_distance <= tolerance_) ThrowCoplanar();
+
+    // The point farthest from the plane through the first three.
+    const Vector3d normal =
+        (points_[i1] - points_[i0]).cross(points_[i2] - points_[i0])
+            .normalized();
+    int i3 = i0;
+    max_distance = 0;
+    for (int p = 0; p < static_cast<int>(points_.size()); ++p) {
+      const double d = std::abs(normal.dot(points_[p] - points_[i0]));
+      if (d > max_distance) {
+        max_distance = d;
+        i3 = p;
+      }
+    }
+    if (max_distance <= tolerance_) ThrowCoplanar();
+    // Orient the base (i0, i1, i2) so that i3 is below it.
+    if (normal.dot(points_[i3] - points_[i0]) > 0) std::swap(i1, i2);
+
+    AddTriangle(i0, i1, i2);
+    AddTriangle(i0, i3, i1);
+    AddTriangle(i1, i3, i2);
+    AddTriangle(i2, i3, i0);
+    for (Triangle& triangle : triangles_) {
+      for (int i = 0; i < 3; ++i) {
+        const int a = triangle.vertex[i];
+        const int b = triangle.vertex[(i + 1) % 3];
+        for (int t = 0; t < 4; ++t) {
+          for (int j = 0; j < 3; ++j) {
+            if (triangles_[t].vertex[j] == b &&
+                triangles_[t].vertex[(j + 1) % 3] == a) {
+              triangle.neighbor[i] = t;
+            }
+          }
+        }
+        DRAKE_DEMAND(triangle.neighbor[i] >= 0);
+      }
+    }
+
+    std::vector<int> candidates;
+    candidates.reserve(points_.size());
+    for (int p = 0; p < static_cast<int>(points_.size()); ++p) {
+      if (p != i0 && p != i1 && p != i2 && p != i3) candidates.push_back(p);
+    }
+    AssignToOutsideSets(candidates, {0, 1, 2, 3});
+  }
+
+  // Adds each candidate point to the outside set of the first of the given
+  // triangles that it is above. The other points are inside the hull.
+  void AssignToOutsideSets(const std::vector<int>& candidates,
+                           const std::vector<int>& triangles) {
+    for (int p : candidates) {
+      for (int t : triangles) {
+        if (Distance(triangles_[t], p) > tolerance_) {
+          triangles_[t].outside.push_back(p);
+          break;
+        }
+      }
+    }
+  }
+
+  // Adds to the hull the point of the outside set of `triangle` that is the
+  // farthest from it. The triangles visible from that point are replaced by
+  // the cone from the point to their horizon, and the new triangles with
+  // non-empty outside sets are pushed on the `stack`.
+  void AddFarthestOutsidePoint(int triangle, std::vector<int>* stack) {
+    int eye = -1;
+    double max_distance = 0;
+    for (int p : triangles_[triangle].outside) {
+      const double d = Distance(triangles_[triangle], p);
+      if (d > max_distance) {
+        max_distance = d;
+        eye = p;
+      }
+    }
+    DRAKE_DEMAND(eye >= 0);
+
+    // Find the visible triangles, connected to `triangle`, and their horizon.
+    ++iteration_;
+    visit_.resize(triangles_.size(), 0);
+    visible_.resize(triangles_.size(), false);
+    visit_[triangle] = iteration_;
+    visible_[triangle] = true;
+    std::vector<int> visible{triangle};
+    std::vector<HorizonEdge> horizon;
+    for (int k = 0; k < static_cast<int>(visible.size()); ++k) {
+      const Triangle& current = triangles_[visible[k]];
+      for (int i = 0; i < 3; ++i) {
+        const int n = current.neighbor[i];
+        if (visit_[n] != iteration_) {
+          visit_[n] = iteration_;
+          visible_[n] = Distance(triangles_[n], eye) > tolerance_;
+          if (visible_[n]) visible.push_back(n);
+        }
+        if (!visible_[n]) {
+          horizon.push_back(
+              {current.vertex[i], current.vertex[(i + 1) % 3], n});
+        }
+      }
+    }
+
+    // Replace the visible triangles with the cone from the eye to the
+    // horizon.
+    std::vector<int> candidates;
+    for (int t : visible) {
+      Triangle& removed = triangles_[t];
+      removed.removed = true;
+      for (int p : removed.outside) {
+        if (p != eye) candidates.push_back(p);
+      }
+      std::vector<int>().swap(removed.outside);
+    }
+    std::vector<int> cone;
+    cone.reserve(horizon.size());
+    std::unordered_map<int, int> cone_starting_at;
+    for (const HorizonEdge& edge : horizon) {
+      const int t = AddTriangle(edge.a, edge.b, eye);
+      triangles_[t].neighbor[0] = edge.outer;
+      Triangle& outer = triangles_[edge.outer];
+      for (int j = 0; j < 3; ++j) {
+        if (outer.vertex[j] == edge.b) outer.neighbor[j] = t;
+      }
+      cone.push_back(t);
+      cone_starting_at[edge.a] = t;
+    }
+    for (int t : cone) {
+      // The edge from b to the eye is shared with the cone triangle starting
+      // at b.
+      auto iter = cone_starting_at.find(triangles_[t].vertex[1]);
+      DRAKE_DEMAND(iter != cone_starting_at.end());
+      triangles_[t].neighbor[1] = iter->second;
+      triangles_[iter->second].neighbor[2] = t;
+    }
+
+    AssignToOutsideSets(candidates, cone);
+    for (int t : cone) {
+      if (!triangles_[t].outside.empty()) stack->push_back(t);
+    }
+  }
+
+  ConvexHull MakeConvexHull() const {
+    // Number the vertices of the hull in the order of the points.
+    std::vector<int> vertex_index(points_.size(), -1);
+    for (const Triangle& triangle : triangles_) {
+      if (triangle.removed) continue;
+      for (int v : triangle.vertex) vertex_index[v] = 0;
+    }
+    ConvexHull hull;
+    for (int p = 0; p < static_cast<int>(points_.size()); ++p) {
+      if (vertex_index[p] < 0) continue;
+      vertex_index[p] = static_cast<int>(hull.vertices.size());
+      hull.vertices.push_back(points_[p]);
+    }
+    for (const Triangle& triangle : triangles_) {
+      if (triangle.removed) continue;
+      hull.faces.push_back(3);
+      for (int v : triangle.vertex) hull.faces.push_back(vertex_index[v]);
+      ++hull.num_faces;
+    }
+    return hull;
+  }
+
+  const std::vector<Vector3d>& points_;
+  double tolerance_{};
+  std::vector<Triangle> triangles_;
+  // The iteration at which each triangle was last tested for visibility, and
+  // the result of that test.
+  int iteration_{0};
+  std::vector<int> visit_;
+  std::vector<bool> visible_;
+};
+
+}  // namespace
+
+ConvexHull CalcConvexHull(const std::vector<Vector3<double>>& points) {
+  return QuickHull(points).Compute();
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The convex hull of a set of points, as a closed triangle mesh.  */
+struct ConvexHull {
+  /* The points of the set that are vertices of the hull.  */
+  std::vector<Vector3<double>> vertices;
+
+  /* The triangles of the hull in the format of fcl::Convex, i.e., the
+   sequence (3, a, b, c) for each triangle with indices a, b, and c into
+   `vertices`. Each triangle has its right-handed normal pointing outwards.
+   The (non-triangular) facets of the hull are triangulated.  */
+  std::vector<int> faces;
+
+  /* The number of triangles in `faces`.  */
+  int num_faces{0};
+};
+
+/*
+ Computes the convex hull of the given points with the Quickhull algorithm
+ (see C. B. Barber, D. P. Dobkin, and H. Huhdanpaa, "The Quickhull algorithm
+ for convex hulls", ACM Transactions on Mathematical Software, 1996). Its
+ expected cost is O(n log n) for n points, and only the points that are
+ vertices of the hull are kept; e.g., the hull of a mesh with tens of thousands
+ of vertices typically has a few hundred vertices.
+
+ The points that are within a small tolerance (relative to the extent of the
+ points) of the hull are considered to be inside it; therefore, the
+ vertices of nearly coplanar facets may be omitted.
+
+ @throws std::runtime_error if the points are (nearly) coplanar, i.e., they do
+                            not span a volume.
+ */
+ConvexHull CalcConvexHull(const std::vector<Vector3<double>>& points);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
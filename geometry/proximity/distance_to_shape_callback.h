@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <unordered_map>
 #include <utility>
@@ -150,6 +151,19 @@ class DistancePairGeometry {
 
   //@}
 
+  /* Computes the signed distance between two capsules A and B in closed form.
+   A capsule is the set of points within its radius of its spine, the segment
+   of length lz centered on its origin along its z axis. Therefore, if Sa and
+   Sb are the closest points between the spines of A and B, then
+   1. φ_A,B = |Sa - Sb| - ra - rb
+   2. nhat_BA = (Sa - Sb) / |Sa - Sb|
+   3. Na = Sa - ra * nhat_BA and Nb = Sb + rb * nhat_BA.
+   When the spines intersect, nhat_BA is not unique; we report the direction
+   perpendicular to both spines (or to the spine of A, if they are parallel).
+   */
+  void operator()(const fcl::Capsuled& capsule_A,
+                  const fcl::Capsuled& capsule_B);
+
  private:
   // Distance computation between a sphere A and a generic shape B. We use
   // the overloaded call operators above to limit the kinds of queries, and
@@ -180,6 +194,84 @@ class DistancePairGeometry {
   SignedDistancePair<T>* result_;
 };
 
+template <typename T>
+void DistancePairGeometry<T>::operator()(const fcl::Capsuled& capsule_A,
+                                         const fcl::Capsuled& capsule_B) {
+  // The spines are the segments P + s * D, with s ∈ [0, 1], in World.
+  const Vector3<T> Az_W = X_WA_.rotation().col(2);
+  const Vector3<T> Bz_W = X_WB_.rotation().col(2);
+  const Vector3<T> d_A = Az_W * capsule_A.lz;
+  const Vector3<T> d_B = Bz_W * capsule_B.lz;
+  const Vector3<T> p_WPa = X_WA_.translation() - d_A / 2;
+  const Vector3<T> p_WPb = X_WB_.translation() - d_B / 2;
+
+  // The closest points between two segments, following Section 5.1.9 of
+  // [Ericson 2004] (Real-Time Collision Detection), with the parameters s and
+  // t of the closest points on A and B clamped to [0, 1].
+  const auto clamp01 = [](const T& x) -> T {
+    if (x < 0) return T(0);
+    if (x > 1) return T(1);
+    return x;
+  };
+  const double kEps = std::numeric_limits<double>::epsilon();
+  const Vector3<T> r = p_WPa - p_WPb;
+  const T a = d_A.dot(d_A);
+  const T e = d_B.dot(d_B);
+  const T f = d_B.dot(r);
+  T s(0);
+  T t(0);
+  if (a <= kEps && e <= kEps) {
+    // Both spines degenerate to points.
+  } else if (a <= kEps) {
+    t = clamp01(f / e);
+  } else {
+    const T c = d_A.dot(r);
+    if (e <= kEps) {
+      s = clamp01(-c / a);
+    } else {
+      const T b = d_A.dot(d_B);
+      const T denom = a * e - b * b;
+      // For parallel spines (denom = 0), any s is a valid starting point.
+      if (denom > kEps * a * e) s = clamp01((b * f - c * e) / denom);
+      t = (b * s + f) / e;
+      if (t < 0) {
+        t = 0;
+        s = clamp01(-c / a);
+      } else if (t > 1) {
+        t = 1;
+        s = clamp01((b - c) / a);
+      }
+    }
+  }
+  const Vector3<T> p_WSa = p_WPa + s * d_A;
+  const Vector3<T> p_WSb = p_WPb + t * d_B;
+
+  const Vector3<T> p_SbSa_W = p_WSa - p_WSb;
+  const T spine_distance = p_SbSa_W.norm();
+  Vector3<T> nhat_BA_W;
+  if (spine_distance > kEps) {
+    nhat_BA_W = p_SbSa_W / spine_distance;
+    result_->is_nhat_BA_W_unique = true;
+  } else {
+    Vector3<T> perpendicular_W = Az_W.cross(Bz_W);
+    if (perpendicular_W.norm() <= kEps) {
+      // The spines are parallel; pick the world axis least aligned with A's.
+      int axis{};
+      Az_W.cwiseAbs().minCoeff(&axis);
+      perpendicular_W = Az_W.cross(Vector3<T>::Unit(axis));
+    }
+    nhat_BA_W = perpendicular_W.normalized();
+    result_->is_nhat_BA_W_unique = false;
+  }
+
+  result_->id_A = id_A_;
+  result_->id_B = id_B_;
+  result_->distance = spine_distance - capsule_A.radius - capsule_B.radius;
+  result_->nhat_BA_W = nhat_BA_W;
+  result_->p_ACa = X_WA_.inverse() * (p_WSa - capsule_A.radius * nhat_BA_W);
+  result_->p_BCb = X_WB_.inverse() * (p_WSb + capsule_B.radius * nhat_BA_W);
+}
+
 /* @name  Definition of fallback for missing primitive-primitive tests
 
  Generally, we favor hand-crafted functions for determining the signed distance
@@ -283,6 +375,17 @@ void ComputeNarrowPhaseDistance(const fcl::CollisionObjectd& a,
   const bool b_is_sphere = b_geometry->getNodeType() == fcl::GEOM_SPHERE;
   const bool no_sphere = !(a_is_sphere || b_is_sphere);
   if (no_sphere) {
+    if (a_geometry->getNodeType() == fcl::GEOM_CAPSULE &&
+        b_geometry->getNodeType() == fcl::GEOM_CAPSULE) {
+      // Capsules are common in robot collision models, so this pair gets a
+      // closed form solution rather than the (much slower) fallback.
+      DistancePairGeometry<T> distance_pair(EncodedData(a).id(),
+                                            EncodedData(b).id(), X_WA, X_WB,
+                                            result);
+      distance_pair(*static_cast<const fcl::Capsuled*>(a_geometry),
+                    *static_cast<const fcl::Capsuled*>(b_geometry));
+      return;
+    }
     CalcDistanceFallback<T>(a, b, request, result);
     return;
   }
@@ -392,16 +495,36 @@ struct ScalarSupport<Eigen::AutoDiffScalar<DerType>> {
     //  (sphere, sphere)
     //  (sphere, box)
     //  (sphere, halfspace)
+    //  (capsule, capsule)
     return (node1 == fcl::GEOM_SPHERE &&
             (node2 == fcl::GEOM_SPHERE || node2 == fcl::GEOM_BOX ||
              node2 == fcl::GEOM_HALFSPACE)) ||
            (node2 == fcl::GEOM_SPHERE &&
-            (node1 == fcl::GEOM_BOX || node1 == fcl::GEOM_HALFSPACE));
+            (node1 == fcl::GEOM_BOX || node1 == fcl::GEOM_HALFSPACE)) ||
+           (node1 == fcl::GEOM_CAPSULE && node2 == fcl::GEOM_CAPSULE);
   }
 };
 
 //@}
 
+/* Reports true if the bounding spheres of the two objects (the spheres that
+ circumscribe their local axis-aligned bounding boxes) are separated by more
+ than `distance`, which proves that the objects themselves are. This test is
+ independent of the objects' orientations, so it complements the broadphase's
+ test of the world-aligned bounding boxes, which grow as the objects rotate.
+ Objects with unbounded extents (e.g., half spaces) never pass this test.  */
+inline bool AreBoundingSpheresFartherThan(const fcl::CollisionObjectd& a,
+                                          const fcl::CollisionObjectd& b,
+                                          double distance) {
+  const fcl::CollisionGeometryd& geometry_a = *a.collisionGeometry();
+  const fcl::CollisionGeometryd& geometry_b = *b.collisionGeometry();
+  const double radii = geometry_a.aabb_radius + geometry_b.aabb_radius;
+  if (!std::isfinite(radii)) return false;
+  const Eigen::Vector3d p_WAo = a.getTransform() * geometry_a.aabb_center;
+  const Eigen::Vector3d p_WBo = b.getTransform() * geometry_b.aabb_center;
+  return (p_WBo - p_WAo).norm() - radii > distance;
+}
+
 /* The callback function for computing signed distance between two arbitrary
  shapes.
 
@@ -456,6 +579,12 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
     if (ScalarSupport<T>::is_supported(
             object_A_ptr->collisionGeometry()->getNodeType(),
             object_B_ptr->collisionGeometry()->getNodeType())) {
+      // Pairs that are provably farther apart than the maximum distance need
+      // no narrowphase computation.
+      if (AreBoundingSpheresFartherThan(*object_A_ptr, *object_B_ptr,
+                                        data.max_distance)) {
+        return false;
+      }
       // We want to pass object_A and object_B to the narrowphase distance in a
       // specific order. This way the broadphase distance is free to give us
       // either (A,B) or (B,A), but the narrowphase distance will always receive
@@ -290,6 +290,8 @@ bool CallbackWithFallback(fcl::CollisionObjectd* object_A_ptr,
     //   fallback can only be double.
     penetration_as_point_pair::CallbackData point_data{
         &data.data.collision_filter, data.point_pairs};
+    // Rigid boxes are commonly stacked; report their full contact manifold.
+    point_data.report_box_box_manifold = true;
     penetration_as_point_pair::Callback(object_A_ptr, object_B_ptr,
                                         &point_data);
   }
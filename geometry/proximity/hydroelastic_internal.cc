@@ -1,6 +1,8 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -24,18 +26,6 @@ namespace hydroelastic {
 using std::make_unique;
 using std::move;
 
-SoftMesh& SoftMesh::operator=(const SoftMesh& s) {
-  if (this == &s) return *this;
-
-  mesh_ = make_unique<VolumeMesh<double>>(s.mesh());
-  // We can't simply copy the mesh field; the copy must contain a pointer to
-  // the new mesh. So, we use CloneAndSetMesh() instead.
-  pressure_ = s.pressure().CloneAndSetMesh(mesh_.get());
-  bvh_ = make_unique<Bvh<VolumeMesh<double>>>(s.bvh());
-
-  return *this;
-}
-
 HydroelasticType Geometries::hydroelastic_type(GeometryId id) const {
   auto iter = supported_geometries_.find(id);
   if (iter != supported_geometries_.end()) return iter->second;
@@ -46,6 +36,16 @@ void Geometries::RemoveGeometry(GeometryId id) {
   supported_geometries_.erase(id);
   soft_geometries_.erase(id);
   rigid_geometries_.erase(id);
+  for (auto iter = rigid_mesh_sources_.begin();
+       iter != rigid_mesh_sources_.end();) {
+    std::vector<GeometryId>& ids = iter->second;
+    ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+    if (ids.empty()) {
+      iter = rigid_mesh_sources_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
 }
 
 void Geometries::MaybeAddGeometry(const Shape& shape, GeometryId id,
@@ -85,7 +85,21 @@ void Geometries::ImplementGeometry(const Ellipsoid& ellipsoid,
 }
 
 void Geometries::ImplementGeometry(const Mesh& mesh, void* user_data) {
-  MakeShape(mesh, *reinterpret_cast<ReifyData*>(user_data));
+  const ReifyData& data = *reinterpret_cast<ReifyData*>(user_data);
+  if (data.type != HydroelasticType::kRigid) {
+    MakeShape(mesh, data);
+    return;
+  }
+  const std::pair<std::string, double> source(mesh.filename(), mesh.scale());
+  auto iter = rigid_mesh_sources_.find(source);
+  if (iter != rigid_mesh_sources_.end()) {
+    AddGeometry(data.id, rigid_geometries_.at(iter->second.front()));
+  } else {
+    MakeShape(mesh, data);
+  }
+  if (hydroelastic_type(data.id) == HydroelasticType::kRigid) {
+    rigid_mesh_sources_[source].push_back(data.id);
+  }
 }
 
 void Geometries::ImplementGeometry(const Convex& convex, void* user_data) {
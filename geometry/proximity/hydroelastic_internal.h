@@ -1,12 +1,15 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_ids.h"
@@ -27,24 +30,24 @@ namespace hydroelastic {
 /* Defines a soft mesh -- a mesh, its linearized pressure field, p̃(e), and its
  bounding volume hierarchy. While this class retains ownership of the mesh,
  we assume that both the pressure field and the bounding volume hierarchy
- are derived from the mesh. */
+ are derived from the mesh.
+
+ The mesh, pressure field, and bounding volume hierarchy are immutable once
+ constructed; copies of a %SoftMesh share them.  */
 class SoftMesh {
  public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SoftMesh)
+
   SoftMesh() = default;
 
   SoftMesh(std::unique_ptr<VolumeMesh<double>> mesh,
            std::unique_ptr<VolumeMeshField<double, double>> pressure)
       : mesh_(std::move(mesh)),
         pressure_(std::move(pressure)),
-        bvh_(std::make_unique<Bvh<VolumeMesh<double>>>(*mesh_)) {
+        bvh_(std::make_shared<const Bvh<VolumeMesh<double>>>(*mesh_)) {
     DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
   }
 
-  SoftMesh(const SoftMesh& s) { *this = s; }
-  SoftMesh& operator=(const SoftMesh& s);
-  SoftMesh(SoftMesh&&) = default;
-  SoftMesh& operator=(SoftMesh&&) = default;
-
   const VolumeMesh<double>& mesh() const {
     DRAKE_DEMAND(mesh_ != nullptr);
     return *mesh_;
@@ -59,9 +62,10 @@ class SoftMesh {
   }
 
  private:
-  std::unique_ptr<VolumeMesh<double>> mesh_;
-  std::unique_ptr<VolumeMeshField<double, double>> pressure_;
-  std::unique_ptr<Bvh<VolumeMesh<double>>> bvh_;
+  std::shared_ptr<const VolumeMesh<double>> mesh_;
+  // The pressure field references mesh_, which outlives it in all copies.
+  std::shared_ptr<const VolumeMeshField<double, double>> pressure_;
+  std::shared_ptr<const Bvh<VolumeMesh<double>>> bvh_;
 };
 
 /* Defines a soft half space. The half space is defined such that the half
@@ -177,15 +181,15 @@ class SoftGeometry {
 
 /* Defines a rigid mesh -- a surface mesh and its bounding volume hierarchy.
  This class retains ownership of the mesh, with the bounding volume hierarchy
- just referencing it.  */
+ just referencing it. Both are immutable once constructed; copies of a
+ %RigidMesh share them.  */
 class RigidMesh {
  public:
   RigidMesh() = default;
 
   explicit RigidMesh(std::unique_ptr<SurfaceMesh<double>> mesh)
       : mesh_(std::move(mesh)),
-        bvh_(std::make_unique<Bvh<SurfaceMesh<double>>>(
-            *mesh_)) {}
+        bvh_(std::make_shared<const Bvh<SurfaceMesh<double>>>(*mesh_)) {}
 
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidMesh)
 
@@ -199,8 +203,8 @@ class RigidMesh {
   }
 
  private:
-  copyable_unique_ptr<SurfaceMesh<double>> mesh_;
-  copyable_unique_ptr<Bvh<SurfaceMesh<double>>> bvh_;
+  std::shared_ptr<const SurfaceMesh<double>> mesh_;
+  std::shared_ptr<const Bvh<SurfaceMesh<double>>> bvh_;
 };
 
 /* The base representation of rigid geometries. Generally, a rigid geometry
@@ -353,6 +357,14 @@ class Geometries final : public ShapeReifier {
 
   // The representations of all rigid geometries.
   std::unordered_map<GeometryId, RigidGeometry> rigid_geometries_;
+
+  // For each (file name, scale) of a rigid Mesh, the ids of the rigid
+  // geometries made from it. The rigid representation of a Mesh doesn't depend
+  // on its properties, so further geometries with the same mesh share an
+  // existing representation instead of parsing the file and building the Bvh
+  // again.
+  std::map<std::pair<std::string, double>, std::vector<GeometryId>>
+      rigid_mesh_sources_;
 };
 
 /* @name Creating hydroelastic representations of shapes
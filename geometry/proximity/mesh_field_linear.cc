@@ -6,12 +6,14 @@ namespace drake {
 namespace geometry {
 
 template <class T, class MeshType>
-void MeshFieldLinear<T, MeshType>::CalcGradientField() {
-  gradients_.clear();
-  gradients_.reserve(this->mesh().num_elements());
+void MeshFieldLinear<T, MeshType>::CalcAffineCoefficients() {
+  affine_coefficients_.clear();
+  affine_coefficients_.reserve(this->mesh().num_elements());
   for (typename MeshType::ElementIndex e(0); e < this->mesh().num_elements();
        ++e) {
-    gradients_.push_back(CalcGradientVector(e));
+    const Vector3<T> gradient = CalcGradientVector(e);
+    affine_coefficients_.emplace_back(gradient.x(), gradient.y(), gradient.z(),
+                                      CalcValueAtMeshOrigin(e, gradient));
   }
 }
 
@@ -25,25 +27,14 @@ Vector3<T> MeshFieldLinear<T, MeshType>::CalcGradientVector(
   return this->mesh().CalcGradientVectorOfLinearField(u, e);
 }
 
-template <class T, class MeshType>
-void MeshFieldLinear<T, MeshType>::CalcValueAtMeshOriginForAllElements() {
-  values_at_Mo_.clear();
-  values_at_Mo_.reserve(this->mesh().num_elements());
-  for (typename MeshType::ElementIndex e(0); e < this->mesh().num_elements();
-       ++e) {
-    values_at_Mo_.push_back(CalcValueAtMeshOrigin(e));
-  }
-}
-
 template <class T, class MeshType>
 T MeshFieldLinear<T, MeshType>::CalcValueAtMeshOrigin(
-    typename MeshType::ElementIndex e) const {
-  DRAKE_DEMAND(e < gradients_.size());
+    typename MeshType::ElementIndex e, const Vector3<T>& gradient) const {
   const typename MeshType::VertexIndex v0 = this->mesh().element(e).vertex(0);
   const Vector3<T>& p_MV0 = this->mesh().vertex(v0).r_MV();
   // f(V₀) = ∇fᵉ⋅p_MV₀ + fᵉ(Mo)
   // fᵉ(Mo) = f(V₀) - ∇fᵉ⋅p_MV₀
-  return values_[v0] - gradients_[e].dot(p_MV0);
+  return values_[v0] - gradient.dot(p_MV0);
 }
 
 template class MeshFieldLinear<double, SurfaceMesh<double>>;
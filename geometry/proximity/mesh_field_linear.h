@@ -87,6 +87,12 @@ namespace geometry {
 
  Notice that (0,0,0) may or may not lie in element E.
 
+ When the gradient is calculated (see the constructor), the affine
+ coefficients (∇fᵉ, fᵉ(0,0,0)) of all elements are computed once, at
+ construction, and stored contiguously, so that evaluating the field at a
+ Cartesian point (EvaluateCartesian()) is a single dot product, and the
+ gradient (EvaluateGradient()) is a look-up.
+
  @tparam T  a valid Eigen scalar for field values.
  @tparam MeshType    the type of the meshes: SurfaceMesh or VolumeMesh.
  */
@@ -121,11 +127,9 @@ class MeshFieldLinear final : public MeshField<T, MeshType> {
     DRAKE_DEMAND(static_cast<int>(values_.size()) ==
                  this->mesh().num_vertices());
     if (calculate_gradient) {
-      CalcGradientField();
-      CalcValueAtMeshOriginForAllElements();
-      DRAKE_DEMAND(mesh->num_elements() == static_cast<int>(gradients_.size()));
+      CalcAffineCoefficients();
       DRAKE_DEMAND(mesh->num_elements() ==
-                   static_cast<int>(values_at_Mo_.size()));
+                   static_cast<int>(affine_coefficients_.size()));
     }
   }
 
@@ -156,12 +160,12 @@ class MeshFieldLinear final : public MeshField<T, MeshType> {
    */
   T EvaluateCartesian(typename MeshType::ElementIndex e,
                       const typename MeshType::Cartesian& p_MQ) const final {
-    if (gradients_.size() == 0) {
+    if (affine_coefficients_.empty()) {
       return Evaluate(e, this->mesh().CalcBarycentric(p_MQ, e));
     } else {
-      DRAKE_ASSERT(e < gradients_.size());
-      DRAKE_ASSERT(e < values_at_Mo_.size());
-      return gradients_[e].dot(p_MQ) + values_at_Mo_[e];
+      DRAKE_ASSERT(e < affine_coefficients_.size());
+      const Vector4<T>& coefficients = affine_coefficients_[e];
+      return coefficients.template head<3>().dot(p_MQ) + coefficients[3];
     }
   }
 
@@ -171,21 +175,28 @@ class MeshFieldLinear final : public MeshField<T, MeshType> {
   @throw std::runtime_error if the gradient vector was not calculated.
   */
   Vector3<T> EvaluateGradient(typename MeshType::ElementIndex e) const {
-    if (gradients_.size() == 0) {
+    if (affine_coefficients_.empty()) {
       throw std::runtime_error("Gradient vector was not calculated.");
     }
-    return gradients_[e];
+    return affine_coefficients_[e].template head<3>();
   }
 
   /** Transforms the gradient vectors of this field from its initial frame M
-   to the new frame N.
+   to the new frame N. The values of the elements' linear functions at the
+   origin are updated accordingly, so that EvaluateCartesian() accepts points
+   measured and expressed in frame N afterwards.
    @warning Use this function when the reference mesh of this field changes
    its frame in the same way.
    */
   void TransformGradients(
       const math::RigidTransform<typename MeshType::ScalarType>& X_NM) {
-    for (auto& grad : gradients_) {
-      grad = X_NM.rotation() * grad;
+    for (auto& coefficients : affine_coefficients_) {
+      // f(Q) = ∇fᵉ_M⋅p_MQ + fᵉ(Mo) = ∇fᵉ_N⋅p_NQ + fᵉ(No), where
+      // ∇fᵉ_N = R_NM ∇fᵉ_M and fᵉ(No) = fᵉ(Mo) - ∇fᵉ_N⋅p_NMo.
+      const Vector3<T> gradient_N =
+          X_NM.rotation() * Vector3<T>(coefficients.template head<3>());
+      coefficients.template head<3>() = gradient_N;
+      coefficients[3] -= gradient_N.dot(X_NM.translation());
     }
   }
 
@@ -218,8 +229,9 @@ class MeshFieldLinear final : public MeshField<T, MeshType> {
       if (values_.at(i) != field_linear->values_.at(i))
         return false;
     }
-    if (gradients_ != field_linear->gradients_) return false;
-    if (values_at_Mo_ != field_linear->values_at_Mo_) return false;
+    if (affine_coefficients_ != field_linear->affine_coefficients_) {
+      return false;
+    }
     // All checks passed.
     return true;
   }
@@ -231,24 +243,24 @@ class MeshFieldLinear final : public MeshField<T, MeshType> {
   DoCloneWithNullMesh() const final {
     return std::make_unique<MeshFieldLinear>(*this);
   }
-  void CalcGradientField();
+  void CalcAffineCoefficients();
   Vector3<T> CalcGradientVector(typename MeshType::ElementIndex e) const;
-
-  void CalcValueAtMeshOriginForAllElements();
-  T CalcValueAtMeshOrigin(typename MeshType::ElementIndex e) const;
+  T CalcValueAtMeshOrigin(typename MeshType::ElementIndex e,
+                          const Vector3<T>& gradient) const;
 
   std::string name_;
   // The field values are indexed in the same way as vertices, i.e.,
   // values_[i] is the field value for the mesh vertices_[i].
   std::vector<T> values_;
-  // The gradients are indexed in the same way as elements, i.e.,
-  // gradients_[i] is the gradient vector on elements_[i]. The elements could
-  // be tetrahedra for VolumeMesh or triangles for SurfaceMesh.
-  std::vector<Vector3<T>> gradients_;
-  // values_at_Mo_[i] is the value of the linear function that represents the
-  // piecewise linear field on the mesh elements_[i] at Mo the origin of
-  // frame M of the mesh. Notice that Mo may or may not lie inside elements_[i].
-  std::vector<T> values_at_Mo_;
+  // The affine coefficients are indexed in the same way as elements, i.e.,
+  // affine_coefficients_[i] is (∇fᵉ, fᵉ(Mo)) on elements_[i]: its first three
+  // entries are the gradient vector, and its last entry is the value of the
+  // linear function that represents the piecewise linear field on the mesh
+  // elements_[i] at Mo the origin of frame M of the mesh. Notice that Mo may
+  // or may not lie inside elements_[i]. The elements could be tetrahedra for
+  // VolumeMesh or triangles for SurfaceMesh. It is empty if the gradients
+  // were not calculated.
+  std::vector<Vector4<T>> affine_coefficients_;
 };
 
 /**
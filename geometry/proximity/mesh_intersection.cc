@@ -397,7 +397,7 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
   //  See issue #14136.
 
   // Compute the transformation from the rigid frame to the soft frame.
-  const math::RigidTransform<T> X_SR = X_WS.inverse() * X_WR;
+  const math::RigidTransform<T> X_SR = X_WS.InvertAndCompose(X_WR);
 
   // The mesh will be computed in Frame S and then transformed to the world
   // frame.
@@ -422,11 +422,12 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
   //    (grad_eS_S) in the world frame (grad_eS_W).
   surface_SR->TransformVertices(X_WS);
   e_SR->TransformGradients(X_WS);
-  std::unique_ptr<std::vector<Vector3<T>>> grad_eS_W;
-  grad_eS_W = std::make_unique<std::vector<Vector3<T>>>();
-  grad_eS_W->reserve(grad_eS_S.size());
-  for (const auto& grad_eSi_S : grad_eS_S) {
-    grad_eS_W->emplace_back(X_WS.rotation() * grad_eSi_S);
+  // The gradients are re-expressed in place so that the contact surface takes
+  // ownership of the buffer filled by the intersector instead of a copy.
+  auto grad_eS_W =
+      std::make_unique<std::vector<Vector3<T>>>(std::move(grad_eS_S));
+  for (auto& grad_eSi : *grad_eS_W) {
+    grad_eSi = X_WS.rotation() * grad_eSi;
   }
 
   // The contact surface is documented as having the normals pointing *out* of
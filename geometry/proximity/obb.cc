@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 
+#include "drake/geometry/proximity/obb_avx2.h"
 #include "drake/geometry/proximity/surface_mesh.h"
 #include "drake/geometry/proximity/volume_mesh.h"
 
@@ -16,43 +17,97 @@ using math::RigidTransformd;
 using math::RollPitchYawd;
 using math::RotationMatrixd;
 
+namespace {
+
+ObbPointers MakeObbPointers(const Obb& box) {
+  return {box.pose().rotation().matrix().data(), box.pose().translation().data(),
+          box.half_width().data()};
+}
+
+}  // namespace
+
+bool Obb::IsAvx2Available() {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  static const bool result = __builtin_cpu_supports("avx2");
+  return result;
+#else
+  return false;
+#endif
+}
+
 bool Obb::HasOverlap(const Obb& a, const Obb& b,
                      const math::RigidTransformd& X_GH) {
   // The canonical frame A of box `a` is posed in the hierarchy frame G, and
   // the canonical frame B of box `b` is posed in the hierarchy frame H.
-  const RigidTransformd& X_GA = a.pose();
-  const RigidTransformd& X_HB = b.pose();
-  const RigidTransformd X_AB = X_GA.inverse() * X_GH * X_HB;
-
-  // We need to split the transform into the position and rotation components,
-  // `p_AB` and `R_AB`. For the purposes of streamlining the math below, they
-  // will henceforth be named `t` and `r` respectively.
-  const Vector3d& t = X_AB.translation();
-  const Matrix3d& r = X_AB.rotation().matrix();
+  //
+  // N.B. The arithmetic below is spelled out (rather than using Eigen's
+  // products and dot products) so that the order of its floating-point
+  // operations is fixed; the batched overlap test mirrors it exactly in each
+  // SIMD lane and must produce identical results. Sums of three or more terms
+  // are evaluated left to right.
+  const Matrix3d& R_GA = a.pose().rotation().matrix();
+  const Vector3d& p_GA = a.pose().translation();
+  const Matrix3d& R_HB = b.pose().rotation().matrix();
+  const Vector3d& p_HB = b.pose().translation();
+  const Matrix3d& R_GH = X_GH.rotation().matrix();
+  const Vector3d& p_GH = X_GH.translation();
+
+  // We need the pose X_AB = X_GA⁻¹ * X_GH * X_HB split into the position and
+  // rotation components, `p_AB` and `R_AB`. For the purposes of streamlining
+  // the math below, they will henceforth be named `t` and `r` respectively.
+  // We first compute X_GB = X_GH * X_HB and then X_AB = X_GA⁻¹ * X_GB.
+  Matrix3d R_GB;
+  Vector3d p_GB;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      R_GB(i, j) = R_GH(i, 0) * R_HB(0, j) + R_GH(i, 1) * R_HB(1, j) +
+                   R_GH(i, 2) * R_HB(2, j);
+    }
+    p_GB(i) = p_GH(i) + (R_GH(i, 0) * p_HB(0) + R_GH(i, 1) * p_HB(1) +
+                         R_GH(i, 2) * p_HB(2));
+  }
+  const Vector3d p_AB_G = p_GB - p_GA;
+  Matrix3d r;
+  Vector3d t;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      r(i, j) = R_GA(0, i) * R_GB(0, j) + R_GA(1, i) * R_GB(1, j) +
+                R_GA(2, i) * R_GB(2, j);
+    }
+    t(i) = R_GA(0, i) * p_AB_G(0) + R_GA(1, i) * p_AB_G(1) +
+           R_GA(2, i) * p_AB_G(2);
+  }
 
   // Compute some common subexpressions and add epsilon to counteract
   // arithmetic error, e.g. when two edges are parallel. We use the value as
   // specified from Gottschalk's OBB robustness tests.
   const double kEpsilon = 0.000001;
-  Matrix3d abs_r = r;
+  Matrix3d abs_r;
   for (int i = 0; i < 3; ++i) {
     for (int j = 0; j < 3; ++j) {
-      abs_r(i, j) = abs(abs_r(i, j)) + kEpsilon;
+      abs_r(i, j) = abs(r(i, j)) + kEpsilon;
     }
   }
 
+  const Vector3d& a_half_width = a.half_width();
+  const Vector3d& b_half_width = b.half_width();
+
   // First category of cases separating along a's axes.
   for (int i = 0; i < 3; ++i) {
     if (abs(t[i]) >
-        a.half_width()[i] + b.half_width().dot(abs_r.block<1, 3>(i, 0))) {
+        a_half_width[i] + (b_half_width[0] * abs_r(i, 0) +
+                           b_half_width[1] * abs_r(i, 1) +
+                           b_half_width[2] * abs_r(i, 2))) {
       return false;
     }
   }
 
   // Second category of cases separating along b's axes.
   for (int i = 0; i < 3; ++i) {
-    if (abs(t.dot(r.block<3, 1>(0, i))) >
-        b.half_width()[i] + a.half_width().dot(abs_r.block<3, 1>(0, i))) {
+    if (abs(t[0] * r(0, i) + t[1] * r(1, i) + t[2] * r(2, i)) >
+        b_half_width[i] + (a_half_width[0] * abs_r(0, i) +
+                           a_half_width[1] * abs_r(1, i) +
+                           a_half_width[2] * abs_r(2, i))) {
       return false;
     }
   }
@@ -67,10 +122,10 @@ bool Obb::HasOverlap(const Obb& a, const Obb& b,
       const int j2 = (j1 + 1) % 3;
       if (abs(t[i2] * r(i1, j) -
               t[i1] * r(i2, j)) >
-          a.half_width()[i1] * abs_r(i2, j) +
-              a.half_width()[i2] * abs_r(i1, j) +
-              b.half_width()[j1] * abs_r(i, j2) +
-              b.half_width()[j2] * abs_r(i, j1)) {
+          a_half_width[i1] * abs_r(i2, j) +
+              a_half_width[i2] * abs_r(i1, j) +
+              b_half_width[j1] * abs_r(i, j2) +
+              b_half_width[j2] * abs_r(i, j1)) {
         return false;
       }
       j1 = j2;
@@ -81,6 +136,35 @@ bool Obb::HasOverlap(const Obb& a, const Obb& b,
   return true;
 }
 
+std::array<bool, 4> Obb::HasOverlap(const std::array<const Obb*, 4>& a_G,
+                                    const std::array<const Obb*, 4>& b_H,
+                                    const math::RigidTransformd& X_GH) {
+  std::array<bool, 4> overlaps;
+  if (IsAvx2Available()) {
+    ObbPointers a_data[4];
+    ObbPointers b_data[4];
+    for (int i = 0; i < 4; ++i) {
+      a_data[i] = MakeObbPointers(*a_G[i]);
+      b_data[i] = MakeObbPointers(*b_H[i]);
+    }
+    HasOverlapAvx2(a_data, b_data, X_GH.rotation().matrix().data(),
+                   X_GH.translation().data(), overlaps.data());
+  } else {
+    overlaps = HasOverlapSequential(a_G, b_H, X_GH);
+  }
+  return overlaps;
+}
+
+std::array<bool, 4> Obb::HasOverlapSequential(
+    const std::array<const Obb*, 4>& a_G, const std::array<const Obb*, 4>& b_H,
+    const math::RigidTransformd& X_GH) {
+  std::array<bool, 4> overlaps;
+  for (int i = 0; i < 4; ++i) {
+    overlaps[i] = HasOverlap(*a_G[i], *b_H[i], X_GH);
+  }
+  return overlaps;
+}
+
 bool Obb::HasOverlap(const Obb& bv, const Plane<double>& plane_P,
                       const math::RigidTransformd& X_PH) {
   // We want the two corners of the box that lie at the most extreme extents in
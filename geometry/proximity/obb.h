@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <set>
 #include <utility>
 
@@ -77,6 +78,17 @@ class Obb {
   static bool HasOverlap(const Obb& a_G, const Obb& b_H,
                          const math::RigidTransformd& X_GH);
 
+  /* Batched version of HasOverlap(a_G, b_H, X_GH) that checks four pairs of
+   boxes at once, e.g., the four pairs of children of two branch nodes during
+   a hierarchy traversal. The i-th result reports whether `a_G[i]` and
+   `b_H[i]` overlap. When the CPU supports AVX2 (as determined at runtime) the
+   four tests run in parallel SIMD lanes; otherwise they run one after the
+   other. The results are identical either way.
+   @pre All pointers are non-null. */
+  static std::array<bool, 4> HasOverlap(const std::array<const Obb*, 4>& a_G,
+                                        const std::array<const Obb*, 4>& b_H,
+                                        const math::RigidTransformd& X_GH);
+
   /* Checks whether bounding volume `bv` intersects the given plane. The
    bounding volume is centered on its canonical frame B, and B is posed in the
    corresponding hierarchy frame H. The plane is defined in frame P.
@@ -124,6 +136,14 @@ class Obb {
  private:
   friend class ObbTester;
 
+  /* Reports whether the batched HasOverlap() uses its AVX2 implementation.  */
+  static bool IsAvx2Available();
+
+  /* The non-SIMD implementation of the batched HasOverlap().  */
+  static std::array<bool, 4> HasOverlapSequential(
+      const std::array<const Obb*, 4>& a_G,
+      const std::array<const Obb*, 4>& b_H, const math::RigidTransformd& X_GH);
+
   /* Pad this box in place by a small amount to ensure there will be no
    roundoff problems. The amount to pad depends on the default tolerance for
    this precision, the dimensions, and the position of the box in space.
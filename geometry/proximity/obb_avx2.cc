@@ -0,0 +1,183 @@
+#include "drake/geometry/proximity/obb_avx2.h"
+
+/* N.B. This file is compiled with -mavx2 (see BUILD.bazel). Do not include
+ anything here that may define inline functions used elsewhere, see the
+ header's note. */
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#else
+#include <cstdlib>
+#endif
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+#if defined(__AVX2__)
+
+namespace {
+
+// Every function in this file operates on four independent lanes; lane i
+// holds the values for the i-th pair of boxes.
+
+// Loads the k-th value of the given array from each of the four lanes' data.
+template <typename Member>
+__m256d Gather(const ObbPointers boxes[4], Member member, int k) {
+  return _mm256_setr_pd(
+      (boxes[0].*member)[k], (boxes[1].*member)[k], (boxes[2].*member)[k],
+      (boxes[3].*member)[k]);
+}
+
+__m256d Add(__m256d x, __m256d y) { return _mm256_add_pd(x, y); }
+__m256d Sub(__m256d x, __m256d y) { return _mm256_sub_pd(x, y); }
+__m256d Mul(__m256d x, __m256d y) { return _mm256_mul_pd(x, y); }
+
+// Clears the sign bit, exactly as std::abs(double) does.
+__m256d Abs(__m256d x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+
+// Lane-wise x > y (false if either is NaN), as all ones or all zeros.
+__m256d Greater(__m256d x, __m256d y) {
+  return _mm256_cmp_pd(x, y, _CMP_GT_OQ);
+}
+
+bool AllLanesSet(__m256d mask) { return _mm256_movemask_pd(mask) == 0xF; }
+
+}  // namespace
+
+void HasOverlapAvx2(const ObbPointers a_G[4], const ObbPointers b_H[4],
+                    const double* R_GH_data, const double* p_GH_data,
+                    bool overlaps[4]) {
+  // Indexing of column-major 3x3 matrices.
+  auto ij = [](int i, int j) { return i + 3 * j; };
+
+  __m256d R_GH[9];
+  __m256d p_GH[3];
+  __m256d R_GA[9];
+  __m256d p_GA[3];
+  __m256d R_HB[9];
+  __m256d p_HB[3];
+  __m256d a_half_width[3];
+  __m256d b_half_width[3];
+  for (int k = 0; k < 9; ++k) {
+    R_GH[k] = _mm256_set1_pd(R_GH_data[k]);
+    R_GA[k] = Gather(a_G, &ObbPointers::R_HB, k);
+    R_HB[k] = Gather(b_H, &ObbPointers::R_HB, k);
+  }
+  for (int k = 0; k < 3; ++k) {
+    p_GH[k] = _mm256_set1_pd(p_GH_data[k]);
+    p_GA[k] = Gather(a_G, &ObbPointers::p_HoBo_H, k);
+    p_HB[k] = Gather(b_H, &ObbPointers::p_HoBo_H, k);
+    a_half_width[k] = Gather(a_G, &ObbPointers::half_width, k);
+    b_half_width[k] = Gather(b_H, &ObbPointers::half_width, k);
+  }
+
+  // The remainder mirrors Obb::HasOverlap(const Obb&, const Obb&, ...)
+  // operation for operation; see the comments there.
+  __m256d R_GB[9];
+  __m256d p_GB[3];
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      R_GB[ij(i, j)] = Add(Add(Mul(R_GH[ij(i, 0)], R_HB[ij(0, j)]),
+                               Mul(R_GH[ij(i, 1)], R_HB[ij(1, j)])),
+                           Mul(R_GH[ij(i, 2)], R_HB[ij(2, j)]));
+    }
+    p_GB[i] = Add(p_GH[i], Add(Add(Mul(R_GH[ij(i, 0)], p_HB[0]),
+                                   Mul(R_GH[ij(i, 1)], p_HB[1])),
+                               Mul(R_GH[ij(i, 2)], p_HB[2])));
+  }
+
+  __m256d p_AB_G[3];
+  for (int i = 0; i < 3; ++i) p_AB_G[i] = Sub(p_GB[i], p_GA[i]);
+  __m256d r[9];
+  __m256d t[3];
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      r[ij(i, j)] = Add(Add(Mul(R_GA[ij(0, i)], R_GB[ij(0, j)]),
+                            Mul(R_GA[ij(1, i)], R_GB[ij(1, j)])),
+                        Mul(R_GA[ij(2, i)], R_GB[ij(2, j)]));
+    }
+    t[i] = Add(Add(Mul(R_GA[ij(0, i)], p_AB_G[0]),
+                   Mul(R_GA[ij(1, i)], p_AB_G[1])),
+               Mul(R_GA[ij(2, i)], p_AB_G[2]));
+  }
+
+  const __m256d kEpsilon = _mm256_set1_pd(0.000001);
+  __m256d abs_r[9];
+  for (int k = 0; k < 9; ++k) abs_r[k] = Add(Abs(r[k]), kEpsilon);
+
+  // Lanes in which a separating axis has been found.
+  __m256d separated = _mm256_setzero_pd();
+  auto finish = [&separated, overlaps]() {
+    const int mask = _mm256_movemask_pd(separated);
+    for (int k = 0; k < 4; ++k) overlaps[k] = ((mask >> k) & 1) == 0;
+  };
+
+  // First category of cases separating along a's axes.
+  for (int i = 0; i < 3; ++i) {
+    const __m256d rhs =
+        Add(a_half_width[i],
+            Add(Add(Mul(b_half_width[0], abs_r[ij(i, 0)]),
+                    Mul(b_half_width[1], abs_r[ij(i, 1)])),
+                Mul(b_half_width[2], abs_r[ij(i, 2)])));
+    separated = _mm256_or_pd(separated, Greater(Abs(t[i]), rhs));
+  }
+  if (AllLanesSet(separated)) {
+    finish();
+    return;
+  }
+
+  // Second category of cases separating along b's axes.
+  for (int i = 0; i < 3; ++i) {
+    const __m256d lhs = Abs(Add(Add(Mul(t[0], r[ij(0, i)]),
+                                    Mul(t[1], r[ij(1, i)])),
+                                Mul(t[2], r[ij(2, i)])));
+    const __m256d rhs =
+        Add(b_half_width[i],
+            Add(Add(Mul(a_half_width[0], abs_r[ij(0, i)]),
+                    Mul(a_half_width[1], abs_r[ij(1, i)])),
+                Mul(a_half_width[2], abs_r[ij(2, i)])));
+    separated = _mm256_or_pd(separated, Greater(lhs, rhs));
+  }
+  if (AllLanesSet(separated)) {
+    finish();
+    return;
+  }
+
+  // Third category of cases separating along the axes formed from the cross
+  // products of a's and b's axes.
+  int i1 = 1;
+  for (int i = 0; i < 3; ++i) {
+    const int i2 = (i1 + 1) % 3;
+    int j1 = 1;
+    for (int j = 0; j < 3; ++j) {
+      const int j2 = (j1 + 1) % 3;
+      const __m256d lhs = Abs(Sub(Mul(t[i2], r[ij(i1, j)]),
+                                  Mul(t[i1], r[ij(i2, j)])));
+      const __m256d rhs =
+          Add(Add(Add(Mul(a_half_width[i1], abs_r[ij(i2, j)]),
+                      Mul(a_half_width[i2], abs_r[ij(i1, j)])),
+                  Mul(b_half_width[j1], abs_r[ij(i, j2)])),
+              Mul(b_half_width[j2], abs_r[ij(i, j1)]));
+      separated = _mm256_or_pd(separated, Greater(lhs, rhs));
+      j1 = j2;
+    }
+    i1 = i2;
+  }
+  finish();
+}
+
+#else  // defined(__AVX2__)
+
+void HasOverlapAvx2(const ObbPointers[4], const ObbPointers[4], const double*,
+                    const double*, bool[4]) {
+  // Callers check for AVX2 support before calling, and code generation for
+  // AVX2 is always enabled when the CPU can support it.
+  std::abort();
+}
+
+#endif  // defined(__AVX2__)
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
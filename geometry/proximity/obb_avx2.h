@@ -0,0 +1,42 @@
+#pragma once
+
+/* @file
+ Provides the AVX2 implementation of the batched Obb-Obb overlap test (see
+ Obb::HasOverlap()).
+
+ The implementation is compiled with AVX2 code generation enabled while the
+ rest of Drake is not. To keep AVX2 instructions from leaking into code that
+ runs on CPUs without AVX2 (e.g., via inline functions that the linker could
+ pick from either translation unit), this header and its implementation
+ include no Eigen or Drake headers and communicate through plain pointers.
+ Callers must check that the CPU supports AVX2 before calling. */
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The data of an oriented bounding box B posed in a hierarchy frame H (see
+ Obb), given by pointers into its storage. */
+struct ObbPointers {
+  // The rotation matrix R_HB, nine values in column-major order.
+  const double* R_HB;
+  // The position p_HoBo_H, three values.
+  const double* p_HoBo_H;
+  // The half widths, three values.
+  const double* half_width;
+};
+
+/* Computes the overlap of the four pairs of boxes a_G[i] and b_H[i] (with the
+ i-th pair in the i-th SIMD lane), writing the results to `overlaps`. The
+ boxes `a_G` are posed in frame G and the boxes `b_H` in frame H, and the
+ pose X_GH is given by its rotation `R_GH` (column major) and position
+ `p_GoHo_G`. The arithmetic is that of the scalar Obb::HasOverlap(), in the
+ same order, so the results are identical.
+ @pre The CPU supports AVX2. */
+void HasOverlapAvx2(const ObbPointers a_G[4], const ObbPointers b_H[4],
+                    const double* R_GH, const double* p_GoHo_G,
+                    bool overlaps[4]);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
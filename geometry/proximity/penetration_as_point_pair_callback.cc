@@ -53,56 +53,70 @@ bool Callback(CollisionObjectd* fcl_object_A_ptr,
   // Since we want *all* collisions, we return false.
   if (!can_collide) return false;
 
+  // Two boxes can report their contact manifold: FCL clips the incident face
+  // of one box against the reference face of the other and reports (up to
+  // kMaxBoxBoxContacts of) the clipped points that penetrate.
+  const bool is_box_box =
+      data.report_box_box_manifold &&
+      fcl_object_A.collisionGeometry()->getNodeType() == fcl::GEOM_BOX &&
+      fcl_object_B.collisionGeometry()->getNodeType() == fcl::GEOM_BOX;
+
   // Unpack the callback data
   const CollisionRequestd& request = data.request;
 
-  // This callback only works for a single contact, this confirms a request
-  // hasn't been made for more contacts.
+  // This callback only works for a single contact (except for the box-box
+  // manifold), this confirms a request hasn't been made for more contacts.
   DRAKE_ASSERT(request.num_max_contacts == 1);
   CollisionResultd result;
 
   // Perform nearphase collision detection
-  collide(&fcl_object_A, &fcl_object_B, request, result);
+  if (is_box_box) {
+    CollisionRequestd manifold_request = request;
+    manifold_request.num_max_contacts = kMaxBoxBoxContacts;
+    collide(&fcl_object_A, &fcl_object_B, manifold_request, result);
+  } else {
+    collide(&fcl_object_A, &fcl_object_B, request, result);
+  }
 
   if (!result.isCollision()) return false;
 
   // Process the contact points
-  // NOTE: This assumes that the request is configured to use a single
-  // contact.
-  const Contactd& contact = result.getContact(0);
-
-  // Signed distance is negative when penetration depth is positive.
-  const double depth = contact.penetration_depth;
-
-  // TODO(SeanCurtis-TRI): Remove this test when FCL issue 375 is fixed.
-  // FCL returns osculation as contact but doesn't guarantee a non-zero
-  // normal. Drake isn't really in a position to define that normal from the
-  // geometry or contact results so, if the geometry is sufficiently close
-  // to osculation, we consider the geometries to be non-penetrating.
-  if (depth <= std::numeric_limits<double>::epsilon()) return false;
-
-  // By convention, Drake requires the contact normal to point out of B
-  // and into A. FCL uses the opposite convention.
-  Vector3d drake_normal = -contact.normal;
-
-  // FCL returns a single contact point centered between the two
-  // penetrating surfaces. PenetrationAsPointPair expects
-  // two, one on the surface of body A (Ac) and one on the surface of body
-  // B (Bc). Choose points along the line defined by the contact point and
-  // normal, equidistant to the contact point. Recall that signed_distance
-  // is strictly non-positive, so signed_distance * drake_normal points
-  // out of A and into B.
-  Vector3d p_WAc = contact.pos - 0.5 * depth * drake_normal;
-  Vector3d p_WBc = contact.pos + 0.5 * depth * drake_normal;
-
-  PenetrationAsPointPair<double> penetration;
-  penetration.depth = depth;
-  penetration.id_A = encoding_A.id();
-  penetration.id_B = encoding_B.id();
-  penetration.p_WCa = p_WAc;
-  penetration.p_WCb = p_WBc;
-  penetration.nhat_BA_W = drake_normal;
-  data.point_pairs.push_back(std::move(penetration));
+  for (int i = 0; i < static_cast<int>(result.numContacts()); ++i) {
+    const Contactd& contact = result.getContact(i);
+
+    // Signed distance is negative when penetration depth is positive.
+    const double depth = contact.penetration_depth;
+
+    // TODO(SeanCurtis-TRI): Remove this test when FCL issue 375 is fixed.
+    // FCL returns osculation as contact but doesn't guarantee a non-zero
+    // normal. Drake isn't really in a position to define that normal from the
+    // geometry or contact results so, if the geometry is sufficiently close
+    // to osculation, we consider the geometries to be non-penetrating.
+    if (depth <= std::numeric_limits<double>::epsilon()) continue;
+
+    // By convention, Drake requires the contact normal to point out of B
+    // and into A. FCL uses the opposite convention.
+    Vector3d drake_normal = -contact.normal;
+
+    // FCL returns a single contact point centered between the two
+    // penetrating surfaces. PenetrationAsPointPair expects
+    // two, one on the surface of body A (Ac) and one on the surface of body
+    // B (Bc). Choose points along the line defined by the contact point and
+    // normal, equidistant to the contact point. Recall that signed_distance
+    // is strictly non-positive, so signed_distance * drake_normal points
+    // out of A and into B.
+    Vector3d p_WAc = contact.pos - 0.5 * depth * drake_normal;
+    Vector3d p_WBc = contact.pos + 0.5 * depth * drake_normal;
+
+    PenetrationAsPointPair<double> penetration;
+    penetration.depth = depth;
+    penetration.id_A = encoding_A.id();
+    penetration.id_B = encoding_B.id();
+    penetration.p_WCa = p_WAc;
+    penetration.p_WCb = p_WBc;
+    penetration.nhat_BA_W = drake_normal;
+    data.point_pairs.push_back(std::move(penetration));
+  }
 
   return false;
 }
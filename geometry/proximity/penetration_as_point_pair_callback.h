@@ -21,7 +21,8 @@ namespace penetration_as_point_pair {
     - A collision filter instance.
     - An fcl collision request.
     - A vector of point pairs -- one instance of PenetrationAsPointPair for
-      every supported, unfiltered penetrating pair.  */
+      every supported, unfiltered penetrating pair (or, optionally, one for
+      each point of the contact manifold between two boxes).  */
 struct CallbackData {
   CallbackData(
       const CollisionFilterLegacy* collision_filter_in,
@@ -49,12 +50,25 @@ struct CallbackData {
 
   /* The results of the collision query.  */
   std::vector<PenetrationAsPointPair<double>>& point_pairs;
+
+  /* If true, the penetration between two boxes is reported as one point
+   pair for each point of their contact manifold (up to
+   kMaxBoxBoxContacts), each with its own depth, instead of a single point
+   pair. A single point cannot support a box resting on a face of another
+   box, so a stack of boxes rocks about its contact point unless the time
+   step is small; the manifold supports it over the overlapping area.  */
+  bool report_box_box_manifold{false};
 };
 
+/* The maximum number of point pairs reported for two boxes when
+ CallbackData::report_box_box_manifold is true.  */
+constexpr int kMaxBoxBoxContacts = 4;
+
 /* Callback function for FCL's collide() function for retrieving a *single*
- contact. As documented by QueryObject::ComputePointPairPenetration(), the
- result added to the output data is the same, regardless of the order of
- the two fcl objects.  */
+ contact (or the contact manifold of two boxes, see
+ CallbackData::report_box_box_manifold). As documented by
+ QueryObject::ComputePointPairPenetration(), the results added to the output
+ data are the same, regardless of the order of the two fcl objects.  */
 bool Callback(fcl::CollisionObjectd* fcl_object_A_ptr,
               fcl::CollisionObjectd* fcl_object_B_ptr, void* callback_data);
 
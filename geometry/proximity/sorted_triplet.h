@@ -1,26 +1,23 @@
 #pragma once
 
-#include <algorithm>
 #include <array>
 #include <tuple>
 #include <utility>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/hash.h"
 #include "drake/common/is_less_than_comparable.h"
 
 namespace drake {
 namespace geometry {
 namespace internal {
 
-// TODO(DamrongGuoy): If we add hash_append, change the documentation below
-//  to say it can be used with std::unordered_map and std::unordered_set.
-
 // This class is similar to the drake::SortedPair class. However, this class
 // uses a triplet of homogeneous types. Both SortedPair and SortedTriplet
 // sort the values such that one value is less than or equal to the next one.
 // The SortedTriplet class can be used to generate keys for std::map (or
-// std::set) from triplets of objects. However, it cannot be used to
-// generate keys for std::unordered_map (or std::unordered_set).
+// std::set) from triplets of objects. It can also be used to generate keys for
+// std::unordered_map (or std::unordered_set) if T supports hash_append.
 //
 // @tparam T A template type that provides `operator<` and supports default
 //           construction.
@@ -40,7 +37,12 @@ struct SortedTriplet {
 
   // Constructs a %SortedTriplet from three objects.
   SortedTriplet(const T& a, const T& b, const T& c) : objects_{a, b, c} {
-    std::stable_sort(objects_.begin(), objects_.end());
+    // A stable sorting network of three elements; it is much cheaper than
+    // std::stable_sort, which may allocate a buffer.
+    using std::swap;
+    if (objects_[1] < objects_[0]) swap(objects_[0], objects_[1]);
+    if (objects_[2] < objects_[1]) swap(objects_[1], objects_[2]);
+    if (objects_[1] < objects_[0]) swap(objects_[0], objects_[1]);
   }
 
   // TODO(DamrongGuoy): Add type-converting copy constructor.
@@ -58,8 +60,15 @@ struct SortedTriplet {
 
   // TODO(DamrongGuoy): Add Swap(t) to swap `this` and `t`.
 
-  // TODO(DamrongGuoy): Add hash_append(HashAlgorithm&, SortedTriplet&) to
-  //  implement the hash_append concept.
+  // Implements the @ref hash_append concept.
+  template <class HashAlgorithm>
+  friend void hash_append(HashAlgorithm& hasher,
+                          const SortedTriplet& t) noexcept {
+    using drake::hash_append;
+    hash_append(hasher, t.objects_[0]);
+    hash_append(hasher, t.objects_[1]);
+    hash_append(hasher, t.objects_[2]);
+  }
 
  private:
   // The three objects in the order of T::operator<.
@@ -91,5 +100,18 @@ inline bool operator<(const SortedTriplet<T>& x, const SortedTriplet<T>& y) {
 
 // TODO(DamrongGuoy): Implement std::swap().
 
-// TODO(DamrongGuoy): Implement std::hash<SortedTriplet<T>>.
+namespace std {
+
+// Provides std::hash<SortedTriplet<T>>.
+template <class T>
+struct hash<drake::geometry::internal::SortedTriplet<T>>
+    : public drake::DefaultHash {};
+#if defined(__GLIBCXX__)
+// https://gcc.gnu.org/onlinedocs/libstdc++/manual/unordered_associative.html
+template <class T>
+struct __is_fast_hash<hash<drake::geometry::internal::SortedTriplet<T>>>
+    : std::false_type {};
+#endif
+
+}  // namespace std
 
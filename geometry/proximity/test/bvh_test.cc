@@ -1,5 +1,8 @@
 #include "drake/geometry/proximity/bvh.h"
 
+#include <limits>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -67,6 +70,77 @@ class BvhTester {
     }
     return true;
   }
+
+  // Returns true iff every node of the tree rooted at `node` contains the
+  // vertices of all of the mesh elements in its subtree.
+  template <typename MeshType>
+  static bool TreeContains(const BvNode<MeshType>& node,
+                           const MeshType& mesh_M) {
+    std::vector<const Obb*> boxes;
+    return TreeContains(node, mesh_M, &boxes);
+  }
+
+  // Returns true iff the flattened nodes of `bvh` hold exactly the nodes of
+  // its tree, in depth-first order, with the same boxes and elements.
+  template <typename MeshType>
+  static bool FlatNodesMatchTree(const Bvh<MeshType>& bvh) {
+    int next = 0;
+    return FlatNodesMatchTree(bvh, bvh.root_node(), &next) &&
+           next == static_cast<int>(bvh.flat_nodes_.size());
+  }
+
+ private:
+  // `ancestors` holds the boxes of the ancestors of `node`.
+  template <typename MeshType>
+  static bool TreeContains(const BvNode<MeshType>& node,
+                           const MeshType& mesh_M,
+                           std::vector<const Obb*>* ancestors) {
+    ancestors->push_back(&node.bv());
+    bool result = true;
+    if (node.is_leaf()) {
+      for (int i = 0; i < node.num_element_indices(); ++i) {
+        const auto& element = mesh_M.element(node.element_index(i));
+        for (int v = 0; v < MeshType::kVertexPerElement; ++v) {
+          const Vector3d& p_MV = mesh_M.vertex(element.vertex(v)).r_MV();
+          for (const Obb* box : *ancestors) {
+            const Vector3d p_BV = box->pose().inverse() * p_MV;
+            if ((p_BV.array().abs() > box->half_width().array()).any()) {
+              result = false;
+            }
+          }
+        }
+      }
+    } else {
+      result = TreeContains(node.left(), mesh_M, ancestors) &&
+               TreeContains(node.right(), mesh_M, ancestors);
+    }
+    ancestors->pop_back();
+    return result;
+  }
+
+  // `next` is the index of the flat node expected to correspond to `node`;
+  // on return it is the index following the flattened subtree.
+  template <typename MeshType>
+  static bool FlatNodesMatchTree(const Bvh<MeshType>& bvh,
+                                 const BvNode<MeshType>& node, int* next) {
+    const int index = (*next)++;
+    if (index >= static_cast<int>(bvh.flat_nodes_.size())) return false;
+    const auto& flat_node = bvh.flat_nodes_[index];
+    if (!flat_node.bv.Equal(node.bv())) return false;
+    if (node.is_leaf()) {
+      if (!flat_node.is_leaf()) return false;
+      if (flat_node.leaf.num_index != node.num_element_indices()) return false;
+      for (int i = 0; i < node.num_element_indices(); ++i) {
+        if (flat_node.leaf.indices[i] != node.element_index(i)) return false;
+      }
+      return true;
+    }
+    if (flat_node.is_leaf() || flat_node.leaf.num_index != 0) return false;
+    if (flat_node.left(index) != *next) return false;
+    if (!FlatNodesMatchTree(bvh, node.left(), next)) return false;
+    if (flat_node.right != *next) return false;
+    return FlatNodesMatchTree(bvh, node.right(), next);
+  }
 };
 
 namespace {
@@ -244,6 +318,9 @@ TEST_F(BvhTest, TestBuildBvTree) {
   check_node(bvh_.root_node(), 0);
   // Check that we found a leaf node for all elements.
   EXPECT_EQ(element_indices.size(), num_elements);
+
+  // The flattened copy of the tree (used for traversal) matches it.
+  EXPECT_TRUE(BvhTester::FlatNodesMatchTree(bvh_));
 }
 
 // Tests copy constructor.
@@ -267,6 +344,7 @@ TEST_F(BvhTest, TestCopy) {
     }
   };
   check_copy(bvh_.root_node(), bvh_copy.root_node());
+  EXPECT_TRUE(BvhTester::FlatNodesMatchTree(bvh_copy));
 }
 
 // Tests colliding while traversing through the bvh trees. We want to ensure
@@ -445,6 +523,55 @@ TEST_F(BvhTest, TestCollidePrimitive) {
   }
 }
 
+// Tests refitting the boxes to a mesh whose vertices have moved, with and
+// without rebuilding.
+GTEST_TEST(BvhUpdateTest, RefitDeformedMesh) {
+  const VolumeMesh<double> mesh = MakeSphereVolumeMesh<double>(
+      Sphere(1.0), 0.5, TessellationStrategy::kDenseInteriorVertices);
+  Bvh<VolumeMesh<double>> bvh(mesh);
+  EXPECT_EQ(bvh.CalcVolumeRatio(), 1.0);
+
+  // Refitting to the same vertex positions produces a valid hierarchy with
+  // no significant loss in quality; nothing gets rebuilt.
+  EXPECT_EQ(bvh.Update(mesh), 0);
+  EXPECT_TRUE(BvhTester::TreeContains(bvh.root_node(), mesh));
+  EXPECT_LT(bvh.CalcVolumeRatio(), 1.0 + 1e-6);
+
+  // Deform the mesh non-rigidly: stretch it along a diagonal and bend it.
+  std::vector<VolumeVertex<double>> vertices;
+  for (const auto& vertex : mesh.vertices()) {
+    const Vector3d& p = vertex.r_MV();
+    vertices.emplace_back(Vector3d(3 * p.x() + p.y(), p.y() + 0.5 * p.x(),
+                                   p.z() + 0.25 * p.x() * p.x()));
+  }
+  std::vector<VolumeElement> elements = mesh.tetrahedra();
+  const VolumeMesh<double> deformed(std::move(elements), std::move(vertices));
+
+  // Refit only; the boxes enclose the deformed elements but are looser.
+  Bvh<VolumeMesh<double>> refit_only(bvh);
+  EXPECT_EQ(refit_only.Update(deformed,
+                              std::numeric_limits<double>::infinity()),
+            0);
+  EXPECT_TRUE(BvhTester::TreeContains(refit_only.root_node(), deformed));
+  EXPECT_TRUE(BvhTester::FlatNodesMatchTree(refit_only));
+  EXPECT_GT(refit_only.CalcVolumeRatio(), 1.0);
+
+  // Allow rebuilding; with a ratio of one, the first oversized node is the
+  // root itself, so the whole tree is rebuilt.
+  Bvh<VolumeMesh<double>> rebuilt(bvh);
+  EXPECT_EQ(rebuilt.Update(deformed, 1.0), 1);
+  EXPECT_TRUE(BvhTester::TreeContains(rebuilt.root_node(), deformed));
+  EXPECT_EQ(rebuilt.CalcVolumeRatio(), 1.0);
+
+  // With the default ratio, only some subtrees are rebuilt, and the result
+  // is still valid.
+  Bvh<VolumeMesh<double>> partial(bvh);
+  partial.Update(deformed);
+  EXPECT_TRUE(BvhTester::TreeContains(partial.root_node(), deformed));
+  EXPECT_TRUE(BvhTester::FlatNodesMatchTree(partial));
+  EXPECT_LE(partial.CalcVolumeRatio(), refit_only.CalcVolumeRatio());
+}
+
 // Tests computing the centroid of an element.
 GTEST_TEST(BoundingVolumeHierarchyTest, TestComputeCentroid) {
   // Set resolution at double so that we get the coarsest mesh of 8 elements.
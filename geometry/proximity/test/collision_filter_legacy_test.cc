@@ -0,0 +1,104 @@
+#include "drake/geometry/proximity/collision_filter_legacy.h"
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+// Tests filtering through cliques: every pair of members of a clique is
+// filtered, regardless of the order in which they joined it.
+GTEST_TEST(CollisionFilterLegacyTest, Cliques) {
+  CollisionFilterLegacy filter;
+  for (uintptr_t id : {10, 20, 30, 40}) filter.AddGeometry(id);
+  EXPECT_TRUE(filter.CanCollideWith(10, 20));
+  // A geometry never collides with itself.
+  EXPECT_FALSE(filter.CanCollideWith(10, 10));
+
+  const int clique = filter.next_clique_id();
+  EXPECT_EQ(filter.peek_next_clique(), clique + 1);
+  filter.AddToCollisionClique(10, clique);
+  filter.AddToCollisionClique(20, clique);
+  EXPECT_FALSE(filter.CanCollideWith(10, 20));
+  EXPECT_FALSE(filter.CanCollideWith(20, 10));
+  EXPECT_TRUE(filter.CanCollideWith(10, 30));
+
+  // A later member is filtered against all prior members.
+  filter.AddToCollisionClique(30, clique);
+  EXPECT_FALSE(filter.CanCollideWith(30, 10));
+  EXPECT_FALSE(filter.CanCollideWith(30, 20));
+  EXPECT_TRUE(filter.CanCollideWith(30, 40));
+
+  // Duplicate memberships are ignored.
+  filter.AddToCollisionClique(30, clique);
+  EXPECT_EQ(filter.num_cliques(30), 1);
+  EXPECT_EQ(filter.num_cliques(40), 0);
+}
+
+// Tests filtering individual pairs, which does not consume cliques.
+GTEST_TEST(CollisionFilterLegacyTest, ExcludePair) {
+  CollisionFilterLegacy filter;
+  for (uintptr_t id : {10, 20, 30}) filter.AddGeometry(id);
+  const int next_clique = filter.peek_next_clique();
+  filter.ExcludePair(10, 20);
+  EXPECT_FALSE(filter.CanCollideWith(10, 20));
+  EXPECT_FALSE(filter.CanCollideWith(20, 10));
+  EXPECT_TRUE(filter.CanCollideWith(10, 30));
+  EXPECT_TRUE(filter.CanCollideWith(20, 30));
+  EXPECT_EQ(filter.peek_next_clique(), next_clique);
+}
+
+// Tests that a removed geometry leaves no filters behind, even when its slot is
+// reused by a new geometry, and that it leaves its cliques.
+GTEST_TEST(CollisionFilterLegacyTest, RemoveGeometry) {
+  CollisionFilterLegacy filter;
+  for (uintptr_t id : {10, 20, 30}) filter.AddGeometry(id);
+  const int clique = filter.next_clique_id();
+  filter.AddToCollisionClique(10, clique);
+  filter.AddToCollisionClique(20, clique);
+  filter.ExcludePair(20, 30);
+
+  filter.RemoveGeometry(20);
+  // Removing an unknown geometry is a no-op.
+  filter.RemoveGeometry(20);
+  filter.AddGeometry(40);
+  EXPECT_TRUE(filter.CanCollideWith(40, 10));
+  EXPECT_TRUE(filter.CanCollideWith(40, 30));
+
+  filter.AddToCollisionClique(40, clique);
+  EXPECT_FALSE(filter.CanCollideWith(40, 10));
+  EXPECT_TRUE(filter.CanCollideWith(40, 30));
+}
+
+// Tests that the filters are preserved as the filter grows to accommodate many
+// geometries, and by copies.
+GTEST_TEST(CollisionFilterLegacyTest, ManyGeometries) {
+  CollisionFilterLegacy filter;
+  const int num_geometries = 300;
+  filter.AddGeometry(0);
+  filter.AddGeometry(1);
+  filter.ExcludePair(0, 1);
+  const int clique = filter.next_clique_id();
+  for (int i = 2; i < num_geometries; ++i) {
+    filter.AddGeometry(i);
+    if (i % 2 == 0) filter.AddToCollisionClique(i, clique);
+  }
+  const CollisionFilterLegacy& original = filter;
+  const CollisionFilterLegacy copy(filter);
+  for (const CollisionFilterLegacy* f : {&original, &copy}) {
+    EXPECT_FALSE(f->CanCollideWith(0, 1));
+    EXPECT_TRUE(f->CanCollideWith(0, 2));
+    for (int i = 2; i < num_geometries; ++i) {
+      for (int j = i + 1; j < num_geometries; ++j) {
+        ASSERT_EQ(f->CanCollideWith(i, j), i % 2 == 1 || j % 2 == 1)
+            << i << ", " << j;
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
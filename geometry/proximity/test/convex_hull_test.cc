@@ -0,0 +1,104 @@
+#include "drake/geometry/proximity/convex_hull.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+// Returns the largest signed distance of the `points` above the planes of the
+// triangles of the `hull`, and checks that the hull is a closed triangle mesh
+// (i.e., its Euler characteristic is 2).
+double CalcMaxDistanceOutside(const ConvexHull& hull,
+                              const std::vector<Vector3d>& points) {
+  EXPECT_EQ(static_cast<int>(hull.faces.size()), 4 * hull.num_faces);
+  const int num_edges = 3 * hull.num_faces / 2;
+  EXPECT_EQ(static_cast<int>(hull.vertices.size()) - num_edges + hull.num_faces,
+            2);
+  double max_distance = -std::numeric_limits<double>::infinity();
+  for (int f = 0; f < hull.num_faces; ++f) {
+    EXPECT_EQ(hull.faces[4 * f], 3);
+    const Vector3d& a = hull.vertices[hull.faces[4 * f + 1]];
+    const Vector3d& b = hull.vertices[hull.faces[4 * f + 2]];
+    const Vector3d& c = hull.vertices[hull.faces[4 * f + 3]];
+    const Vector3d normal = (b - a).cross(c - a).normalized();
+    for (const Vector3d& p : points) {
+      max_distance = std::max(max_distance, normal.dot(p - a));
+    }
+  }
+  return max_distance;
+}
+
+// The points of a grid in a box, including the points on its faces and edges,
+// have the corners of the box as their hull.
+GTEST_TEST(ConvexHullTest, Box) {
+  std::vector<Vector3d> points;
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        points.emplace_back(0.5 * i, 0.25 * j - 1, 0.1 * k);
+      }
+    }
+  }
+  const ConvexHull hull = CalcConvexHull(points);
+  EXPECT_EQ(hull.vertices.size(), 8u);
+  EXPECT_EQ(hull.num_faces, 12);
+  for (const Vector3d& v : hull.vertices) {
+    EXPECT_TRUE(v.x() == 0 || v.x() == 2);
+    EXPECT_TRUE(v.y() == -1 || v.y() == -0.25);
+    EXPECT_TRUE(v.z() == 0 || v.z() == 0.2);
+  }
+  EXPECT_LE(CalcMaxDistanceOutside(hull, points), 1e-14);
+}
+
+// The points on a sphere are all vertices of their hull, and the points inside
+// the sphere are not.
+GTEST_TEST(ConvexHullTest, Sphere) {
+  std::mt19937 generator(1234);
+  std::normal_distribution<double> distribution;
+  std::vector<Vector3d> points;
+  const int num_surface_points = 2000;
+  for (int i = 0; i < 2 * num_surface_points; ++i) {
+    const Vector3d p = Vector3d(distribution(generator),
+                                distribution(generator),
+                                distribution(generator)).normalized();
+    points.push_back(i % 2 == 0 ? p : 0.9 * p);
+  }
+  const ConvexHull hull = CalcConvexHull(points);
+  EXPECT_EQ(static_cast<int>(hull.vertices.size()), num_surface_points);
+  for (const Vector3d& v : hull.vertices) {
+    EXPECT_NEAR(v.norm(), 1.0, 1e-14);
+  }
+  EXPECT_LE(CalcMaxDistanceOutside(hull, points), 1e-14);
+}
+
+GTEST_TEST(ConvexHullTest, Coplanar) {
+  const std::vector<Vector3d> too_few{
+      Vector3d(0, 0, 0), Vector3d(1, 0, 0), Vector3d(0, 1, 0)};
+  DRAKE_EXPECT_THROWS_MESSAGE(CalcConvexHull(too_few), std::runtime_error,
+                              "CalcConvexHull.*coplanar.*");
+  const std::vector<Vector3d> planar{Vector3d(0, 0, 1), Vector3d(1, 0, 1),
+                                     Vector3d(0, 1, 1), Vector3d(1, 1, 1),
+                                     Vector3d(0.5, 0.5, 1)};
+  DRAKE_EXPECT_THROWS_MESSAGE(CalcConvexHull(planar), std::runtime_error,
+                              "CalcConvexHull.*coplanar.*");
+  const std::vector<Vector3d> collinear{Vector3d(0, 0, 0), Vector3d(1, 1, 1),
+                                        Vector3d(2, 2, 2), Vector3d(3, 3, 3)};
+  DRAKE_EXPECT_THROWS_MESSAGE(CalcConvexHull(collinear), std::runtime_error,
+                              "CalcConvexHull.*coplanar.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
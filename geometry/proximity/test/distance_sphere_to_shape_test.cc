@@ -22,8 +22,8 @@
 
 /* @file
  This tests only the code in distance_to_shape_callback.h that supports
- (sphere-shape) signed distance queries. Ultimately, we'll have unit tests for
- all shapeA-shapeB primitive functions.  */
+ (sphere-shape) and (capsule-capsule) signed distance queries. Ultimately,
+ we'll have unit tests for all shapeA-shapeB primitive functions.  */
 
 namespace drake {
 namespace geometry {
@@ -61,6 +61,10 @@ template <>
 void DistancePairGeometry<float>::operator()(const fcl::Sphered&,
                                              const fcl::Cylinderd&) {}
 
+template <>
+void DistancePairGeometry<float>::operator()(const fcl::Capsuled&,
+                                             const fcl::Capsuled&) {}
+
 namespace {
 
 using Eigen::Vector3d;
@@ -422,6 +426,165 @@ GTEST_TEST(ComputeNarrowPhaseDistance, NoFallbackInvocation) {
     DRAKE_EXPECT_NO_THROW(ComputeNarrowPhaseDistance<T>(
         sphere, X_WA, other, X_WB, request, &result));
   }
+
+  CollisionObjectd capsule(make_shared<Capsuled>(1, 1));
+  EncodedData(other_id, true).write_to(&capsule);
+  DRAKE_EXPECT_NO_THROW(ComputeNarrowPhaseDistance<T>(
+      capsule, X_WA, capsule, X_WB, request, &result));
+}
+
+// Tests the closed-form signed distance between two capsules.
+class CapsuleCapsuleDistanceTest : public ::testing::Test {
+ protected:
+  // Computes the signed distance between capsules A and B with the given
+  // dimensions and poses, confirming the properties that all results share.
+  template <typename T>
+  SignedDistancePair<T> ComputeDistance(const Capsuled& capsule_A,
+                                        const RigidTransform<T>& X_WA,
+                                        const Capsuled& capsule_B,
+                                        const RigidTransform<T>& X_WB) {
+    SignedDistancePair<T> result;
+    DistancePairGeometry<T> distance_pair(id_A_, id_B_, X_WA, X_WB, &result);
+    distance_pair(capsule_A, capsule_B);
+    EXPECT_EQ(result.id_A, id_A_);
+    EXPECT_EQ(result.id_B, id_B_);
+    // The witness points are separated by the signed distance along the
+    // normal, and the normal has unit length.
+    const Vector3<T> p_WCa = X_WA * result.p_ACa;
+    const Vector3<T> p_WCb = X_WB * result.p_BCb;
+    EXPECT_TRUE(CompareMatrices(math::DiscardGradient(p_WCa - p_WCb),
+                                math::DiscardGradient(result.distance *
+                                                      result.nhat_BA_W),
+                                kTolerance));
+    EXPECT_NEAR(ExtractDoubleOrThrow(result.nhat_BA_W.norm()), 1.0,
+                kTolerance);
+    return result;
+  }
+
+  static constexpr double kTolerance = 1e-14;
+  const GeometryId id_A_{GeometryId::get_new_id()};
+  const GeometryId id_B_{GeometryId::get_new_id()};
+};
+
+// Two parallel capsules, side by side. The closest points are not unique, but
+// the distance and normal are.
+TEST_F(CapsuleCapsuleDistanceTest, ParallelSeparated) {
+  const Capsuled capsule_A(0.5, 2);
+  const Capsuled capsule_B(0.25, 2);
+  const RigidTransformd X_WB(Vector3d(3, 0, 0.5));
+  const SignedDistancePair<double> result =
+      ComputeDistance(capsule_A, RigidTransformd::Identity(), capsule_B, X_WB);
+  EXPECT_NEAR(result.distance, 2.25, kTolerance);
+  EXPECT_TRUE(CompareMatrices(result.nhat_BA_W, -Vector3d::UnitX()));
+  EXPECT_TRUE(result.is_nhat_BA_W_unique);
+  EXPECT_NEAR(result.p_ACa.x(), 0.5, kTolerance);
+  EXPECT_NEAR(result.p_BCb.x(), -0.25, kTolerance);
+}
+
+// Two capsules whose spines are aligned end to end; the closest points are
+// the ends of the spines.
+TEST_F(CapsuleCapsuleDistanceTest, EndToEnd) {
+  const Capsuled capsule(0.5, 2);
+  const RigidTransformd X_WB(Vector3d(0, 0, 4));
+  const SignedDistancePair<double> result =
+      ComputeDistance(capsule, RigidTransformd::Identity(), capsule, X_WB);
+  EXPECT_NEAR(result.distance, 1.0, kTolerance);
+  EXPECT_TRUE(CompareMatrices(result.nhat_BA_W, -Vector3d::UnitZ()));
+  EXPECT_TRUE(CompareMatrices(result.p_ACa, Vector3d(0, 0, 1.5), kTolerance));
+  EXPECT_TRUE(CompareMatrices(result.p_BCb, Vector3d(0, 0, -1.5), kTolerance));
+}
+
+// Two perpendicular capsules in penetration.
+TEST_F(CapsuleCapsuleDistanceTest, PerpendicularPenetration) {
+  const Capsuled capsule(0.5, 2);
+  const RigidTransformd X_WB(RotationMatrixd::MakeXRotation(M_PI / 2),
+                             Vector3d(0.6, 0, 0));
+  const SignedDistancePair<double> result =
+      ComputeDistance(capsule, RigidTransformd::Identity(), capsule, X_WB);
+  EXPECT_NEAR(result.distance, -0.4, kTolerance);
+  EXPECT_TRUE(CompareMatrices(result.nhat_BA_W, -Vector3d::UnitX(),
+                              kTolerance));
+  EXPECT_TRUE(result.is_nhat_BA_W_unique);
+}
+
+// When the spines intersect, the normal is not unique. We still report a
+// valid normal, perpendicular to both spines.
+TEST_F(CapsuleCapsuleDistanceTest, IntersectingSpines) {
+  const Capsuled capsule(0.5, 2);
+  const RigidTransformd X_WB(RotationMatrixd::MakeXRotation(M_PI / 3),
+                             Vector3d(0, 0, 0.25));
+  const SignedDistancePair<double> result =
+      ComputeDistance(capsule, RigidTransformd::Identity(), capsule, X_WB);
+  EXPECT_NEAR(result.distance, -1.0, kTolerance);
+  EXPECT_FALSE(result.is_nhat_BA_W_unique);
+  EXPECT_NEAR(result.nhat_BA_W.dot(Vector3d::UnitZ()), 0, kTolerance);
+  EXPECT_NEAR(result.nhat_BA_W.dot(X_WB.rotation().col(2)), 0, kTolerance);
+
+  // Coincident spines are parallel, too.
+  const RigidTransformd X_WA = RigidTransformd::Identity();
+  const SignedDistancePair<double> coincident =
+      ComputeDistance(capsule, X_WA, capsule, X_WA);
+  EXPECT_NEAR(coincident.distance, -1.0, kTolerance);
+  EXPECT_FALSE(coincident.is_nhat_BA_W_unique);
+  EXPECT_NEAR(coincident.nhat_BA_W.dot(Vector3d::UnitZ()), 0, kTolerance);
+}
+
+// For generic poses, the closed form agrees with the fallback.
+TEST_F(CapsuleCapsuleDistanceTest, MatchesFallback) {
+  auto capsule_A = make_shared<Capsuled>(0.3, 1.2);
+  auto capsule_B = make_shared<Capsuled>(0.2, 0.8);
+  const RigidTransformd X_WA(
+      AngleAxis<double>(M_PI / 5, Vector3d{2, 4, 7}.normalized()),
+      Vector3d(0.1, -0.2, 0.3));
+  const RigidTransformd X_WB(
+      AngleAxis<double>(-M_PI / 3, Vector3d{-1, 2, 0.5}.normalized()),
+      Vector3d(1.1, 0.4, -0.2));
+  CollisionObjectd A(capsule_A);
+  CollisionObjectd B(capsule_B);
+  A.setTransform(X_WA.GetAsIsometry3());
+  B.setTransform(X_WB.GetAsIsometry3());
+  EncodedData(id_A_, true).write_to(&A);
+  EncodedData(id_B_, true).write_to(&B);
+  fcl::DistanceRequestd request;
+  request.enable_nearest_points = true;
+  request.enable_signed_distance = true;
+  SignedDistancePair<double> expected;
+  CalcDistanceFallback<double>(A, B, request, &expected);
+  ASSERT_GT(expected.distance, 0);
+
+  const SignedDistancePair<double> result =
+      ComputeDistance(*capsule_A, X_WA, *capsule_B, X_WB);
+  const double kFallbackTolerance = 1e-6;
+  EXPECT_NEAR(result.distance, expected.distance, kFallbackTolerance);
+  EXPECT_TRUE(CompareMatrices(result.nhat_BA_W, expected.nhat_BA_W,
+                              kFallbackTolerance));
+  EXPECT_TRUE(
+      CompareMatrices(result.p_ACa, expected.p_ACa, kFallbackTolerance));
+  EXPECT_TRUE(
+      CompareMatrices(result.p_BCb, expected.p_BCb, kFallbackTolerance));
+}
+
+// Confirms the derivatives of the distance with respect to the position of B:
+// moving B along the normal reduces the distance at unit rate.
+TEST_F(CapsuleCapsuleDistanceTest, AutoDiff) {
+  const Capsuled capsule_A(0.3, 1.2);
+  const Capsuled capsule_B(0.2, 0.8);
+  const RigidTransform<AutoDiffXd> X_WA =
+      RigidTransformd(
+          AngleAxis<double>(M_PI / 5, Vector3d{2, 4, 7}.normalized()),
+          Vector3d(0.1, -0.2, 0.3))
+          .cast<AutoDiffXd>();
+  const RotationMatrixd R_WB(
+      AngleAxis<double>(-M_PI / 3, Vector3d{-1, 2, 0.5}.normalized()));
+  const Vector3<AutoDiffXd> p_WBo =
+      math::initializeAutoDiff(Vector3d(1.1, 0.4, -0.2));
+  const RigidTransform<AutoDiffXd> X_WB(R_WB.cast<AutoDiffXd>(), p_WBo);
+  const SignedDistancePair<AutoDiffXd> result =
+      ComputeDistance(capsule_A, X_WA, capsule_B, X_WB);
+  ASSERT_EQ(result.distance.derivatives().size(), 3);
+  EXPECT_TRUE(CompareMatrices(result.distance.derivatives(),
+                              -math::DiscardGradient(result.nhat_BA_W),
+                              kTolerance));
 }
 
 // Confirms that the fallback *is* invoked for other geometry pairs.
@@ -1,13 +1,17 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
 #include <cmath>
+#include <fstream>
 #include <functional>
 #include <limits>
+#include <string>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include "drake/common/filesystem.h"
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/proximity/make_sphere_field.h"
@@ -42,10 +46,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
     SoftMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -64,10 +68,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
   {
     SoftMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -137,10 +141,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
     SoftGeometry dut(SoftHalfSpace{1e+7});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.pressure_field(), &dut.pressure_field());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.pressure_field(), &dut.pressure_field());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -157,10 +161,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
   {
     SoftGeometry copy(original);
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure_field(), &copy.pressure_field());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure_field(), &copy.pressure_field());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -218,9 +222,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
     RigidMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -230,9 +234,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
   {
     RigidMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -282,9 +286,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
     RigidGeometry dut(HalfSpace{});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     EXPECT_TRUE(dut.bvh().Equal(original.bvh()));
@@ -294,9 +298,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
   {
     RigidGeometry copy(original);
 
-    // Test for uniqueness. Their contents are at different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable contents are shared, not copied.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -411,6 +415,46 @@ GTEST_TEST(Hydroelastic, RemoveGeometry) {
   }
 }
 
+// Tests that rigid geometries made from the same mesh file share the work of
+// reading it and its representation, but not its lifetime.
+GTEST_TEST(Hydroelastic, RigidMeshesFromTheSameFile) {
+  const std::string file = temp_directory() + "/tetrahedron.obj";
+  {
+    std::ofstream obj(file);
+    obj << "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 0 0 1\n"
+        << "f 1 2 4\nf 1 4 3\nf 1 3 2\nf 2 3 4\n";
+  }
+  // Properties don't matter for rigid meshes.
+  ProximityProperties props;
+  AddRigidHydroelasticProperties(&props);
+
+  Geometries geometries;
+  const GeometryId id_A = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(Mesh(file), id_A, props);
+  ASSERT_EQ(geometries.hydroelastic_type(id_A), HydroelasticType::kRigid);
+
+  // Once read, the file is no longer needed for another geometry with the same
+  // mesh, but it is for a different scale.
+  filesystem::remove(file);
+  const GeometryId id_B = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(Mesh(file), id_B, props);
+  ASSERT_EQ(geometries.hydroelastic_type(id_B), HydroelasticType::kRigid);
+  EXPECT_EQ(geometries.rigid_geometry(id_B).mesh().num_faces(), 4);
+  EXPECT_EQ(&geometries.rigid_geometry(id_B).mesh(),
+            &geometries.rigid_geometry(id_A).mesh());
+  EXPECT_THROW(geometries.MaybeAddGeometry(Mesh(file, 2.0),
+                                           GeometryId::get_new_id(), props),
+               std::exception);
+
+  // Removing the first geometry leaves the second one intact, and the second
+  // one now provides the mesh for further geometries.
+  geometries.RemoveGeometry(id_A);
+  EXPECT_EQ(geometries.rigid_geometry(id_B).mesh().num_faces(), 4);
+  const GeometryId id_C = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(Mesh(file), id_C, props);
+  EXPECT_EQ(geometries.rigid_geometry(id_C).mesh().num_faces(), 4);
+}
+
 class HydroelasticRigidGeometryTest : public ::testing::Test {
  protected:
   /* Creates a simple set of properties for generating rigid geometry. */
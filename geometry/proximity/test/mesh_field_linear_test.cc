@@ -169,6 +169,16 @@ GTEST_TEST(MeshFieldLinearTest, TestTransformGradients) {
   Vector3d expect_gradient_N = X_MN.rotation() * expect_gradient_M;
 
   EXPECT_TRUE(CompareMatrices(expect_gradient_N, gradient_N, 1e-14));
+
+  // The field evaluated at the transformed vertices (now measured and
+  // expressed in frame N) still reproduces the vertex values.
+  for (SurfaceFaceIndex f(0); f < mesh->num_faces(); ++f) {
+    for (int i = 0; i < 3; ++i) {
+      const SurfaceVertexIndex v = mesh->element(f).vertex(i);
+      EXPECT_NEAR(mesh_field->EvaluateCartesian(f, mesh->vertex(v).r_MV()),
+                  mesh_field->EvaluateAtVertex(v), 1e-14);
+    }
+  }
 }
 
 // Confirms that invoking EvaluateCartesian() produces equivalent expected
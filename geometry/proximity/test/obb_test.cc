@@ -1,5 +1,10 @@
 #include "drake/geometry/proximity/obb.h"
 
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -25,6 +30,12 @@ using math::RotationMatrixd;
 class ObbTester : public ::testing::Test {
  public:
   static constexpr double kTolerance = Obb::kTolerance;
+
+  static std::array<bool, 4> HasOverlapSequential(
+      const std::array<const Obb*, 4>& a_G,
+      const std::array<const Obb*, 4>& b_H, const RigidTransformd& X_GH) {
+    return Obb::HasOverlapSequential(a_G, b_H, X_GH);
+  }
 };
 
 // Friend class for accessing ObbMaker's private functionality for testing.
@@ -1220,6 +1231,84 @@ GTEST_TEST(ObbTest, HalfSpaceOverlap) {
   }
 }
 
+// Tests that the batched overlap test reports exactly the results of the
+// one-pair-at-a-time test, whether or not it uses its AVX2 implementation.
+// Pairs of boxes that are just touching are the interesting ones: rounding any
+// intermediate value differently could flip the answer. So, for random pairs
+// of boxes, we find the distance at which they separate by bisection and test
+// at and right around that distance. (On a CPU without AVX2 this only tests
+// the sequential fallback.)
+GTEST_TEST(ObbTest, BatchedOverlapMatchesSequential) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  auto random_vector = [&generator, &uniform]() {
+    return Vector3d(uniform(generator), uniform(generator),
+                    uniform(generator));
+  };
+  auto random_rotation = [&generator, &uniform]() {
+    return RotationMatrixd(
+        Eigen::Quaterniond(uniform(generator), uniform(generator),
+                           uniform(generator), uniform(generator))
+            .normalized());
+  };
+  const RigidTransformd X_GH(random_rotation(), Vector3d(0.5, -1, 2));
+  const RigidTransformd X_HG = X_GH.inverse();
+
+  std::vector<Obb> a_boxes;
+  std::vector<Obb> b_boxes;
+  for (int n = 0; n < 200; ++n) {
+    const Obb a(RigidTransformd(random_rotation(), random_vector()),
+                random_vector() + Vector3d::Constant(1.1));
+    const RotationMatrixd R_HB = random_rotation();
+    const Vector3d b_half_width = random_vector() + Vector3d::Constant(1.1);
+    const Vector3d direction_G = random_vector().normalized();
+    // Box b displaced from a's center by the given distance along
+    // direction_G.
+    auto make_b = [&](double distance) {
+      const Vector3d p_GB = a.center() + distance * direction_G;
+      return Obb(RigidTransformd(R_HB, X_HG * p_GB), b_half_width);
+    };
+    // The boxes overlap at zero distance and are separated at a distance of
+    // 10, which exceeds the sum of the largest possible half diagonals.
+    double overlapping = 0;
+    double separated = 10;
+    for (int i = 0; i < 100; ++i) {
+      const double middle = (overlapping + separated) / 2;
+      if (Obb::HasOverlap(a, make_b(middle), X_GH)) {
+        overlapping = middle;
+      } else {
+        separated = middle;
+      }
+    }
+    for (const double distance :
+         {overlapping, separated, std::nextafter(overlapping, 0.0),
+          std::nextafter(separated, 10.0), 0.5 * overlapping,
+          2.0 * separated}) {
+      a_boxes.push_back(a);
+      b_boxes.push_back(make_b(distance));
+    }
+  }
+
+  int num_overlaps = 0;
+  for (int i = 0; i + 4 <= static_cast<int>(a_boxes.size()); i += 4) {
+    const std::array<const Obb*, 4> a_G{&a_boxes[i], &a_boxes[i + 1],
+                                        &a_boxes[i + 2], &a_boxes[i + 3]};
+    const std::array<const Obb*, 4> b_H{&b_boxes[i], &b_boxes[i + 1],
+                                        &b_boxes[i + 2], &b_boxes[i + 3]};
+    const std::array<bool, 4> batched = Obb::HasOverlap(a_G, b_H, X_GH);
+    const std::array<bool, 4> sequential =
+        ObbTester::HasOverlapSequential(a_G, b_H, X_GH);
+    for (int k = 0; k < 4; ++k) {
+      EXPECT_EQ(batched[k], sequential[k]) << "pair " << i + k;
+      EXPECT_EQ(sequential[k], Obb::HasOverlap(*a_G[k], *b_H[k], X_GH));
+      if (batched[k]) ++num_overlaps;
+    }
+  }
+  // Both outcomes are represented.
+  EXPECT_GT(num_overlaps, 0);
+  EXPECT_LT(num_overlaps, static_cast<int>(a_boxes.size()));
+}
+
 GTEST_TEST(ObbTest, TestEqual) {
   Obb a{RigidTransformd(Vector3d{0.5, 0.25, -0.75}), Vector3d{1, 2, 3}};
   // Equal to itself.
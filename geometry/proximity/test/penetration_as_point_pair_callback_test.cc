@@ -16,7 +16,9 @@ namespace internal {
 namespace penetration_as_point_pair {
 namespace {
 
+using Eigen::Vector2d;
 using Eigen::Vector3d;
+using fcl::Boxd;
 using fcl::CollisionObjectd;
 using fcl::Sphered;
 using math::RigidTransformd;
@@ -144,6 +146,55 @@ TEST_F(PenetrationAsPointPairCallbackTest, CollisionFilterRespected) {
   EXPECT_EQ(point_pairs_.size(), 0u);
 }
 
+// Confirms that, on request, two penetrating boxes report one point pair for
+// each point of their contact manifold, and a single point pair otherwise.
+TEST_F(PenetrationAsPointPairCallbackTest, BoxBoxManifold) {
+  CollisionObjectd box_A(make_shared<Boxd>(1, 1, 1));
+  CollisionObjectd box_B(make_shared<Boxd>(1, 1, 1));
+  EncodedData(id_A_, true).write_to(&box_A);
+  EncodedData(id_B_, true).write_to(&box_B);
+  // Box B rests on box A, penetrating it by 1 cm and offset horizontally so
+  // that the two faces overlap in a square.
+  const double target_depth = 0.01;
+  box_B.setTransform(
+      RigidTransformd{Vector3d{0.25, 0.25, 1 - target_depth}}.GetAsIsometry3());
+  box_A.computeAABB();
+  box_B.computeAABB();
+
+  EXPECT_FALSE(Callback(&box_A, &box_B, &callback_data_));
+  EXPECT_EQ(point_pairs_.size(), 1u);
+  point_pairs_.clear();
+
+  callback_data_.report_box_box_manifold = true;
+  EXPECT_FALSE(Callback(&box_B, &box_A, &callback_data_));
+  ASSERT_EQ(point_pairs_.size(), 4u);
+  for (const auto& point_pair : point_pairs_) {
+    EXPECT_EQ(point_pair.id_A, id_A_);
+    EXPECT_EQ(point_pair.id_B, id_B_);
+    EXPECT_NEAR(point_pair.depth, target_depth, 1e-12);
+    EXPECT_TRUE(CompareMatrices(point_pair.nhat_BA_W, -Vector3d::UnitZ(),
+                                1e-12));
+  }
+  // The points span the overlap between the faces of the boxes.
+  Vector3d p_WCa_min = point_pairs_[0].p_WCa;
+  Vector3d p_WCa_max = point_pairs_[0].p_WCa;
+  for (const auto& point_pair : point_pairs_) {
+    p_WCa_min = p_WCa_min.cwiseMin(point_pair.p_WCa);
+    p_WCa_max = p_WCa_max.cwiseMax(point_pair.p_WCa);
+  }
+  EXPECT_TRUE(CompareMatrices(p_WCa_min.head<2>(), Vector2d(-0.25, -0.25),
+                              1e-12));
+  EXPECT_TRUE(CompareMatrices(p_WCa_max.head<2>(), Vector2d(0.5, 0.5),
+                              1e-12));
+
+  // Boxes against other shapes still report a single point pair.
+  point_pairs_.clear();
+  sphere_B_.setTransform(
+      RigidTransformd{Vector3d{0, 0, 0.9}}.GetAsIsometry3());
+  EXPECT_FALSE(Callback(&box_A, &sphere_B_, &callback_data_));
+  EXPECT_EQ(point_pairs_.size(), 1u);
+}
+
 }  // namespace
 }  // namespace penetration_as_point_pair
 }  // namespace internal
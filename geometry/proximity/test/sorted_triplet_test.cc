@@ -1,5 +1,8 @@
 #include "drake/geometry/proximity/sorted_triplet.h"
 
+#include <map>
+#include <unordered_set>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -52,6 +55,18 @@ GTEST_TEST(SortedTriplet, Map) {
   EXPECT_EQ('A', my_map.at(same_triplet));
 }
 
+// Uses as a key in an unordered set.
+GTEST_TEST(SortedTriplet, Hash) {
+  EXPECT_EQ(std::hash<SortedTriplet<int>>{}(SortedTriplet<int>(1, 2, 3)),
+            std::hash<SortedTriplet<int>>{}(SortedTriplet<int>(3, 1, 2)));
+  std::unordered_set<SortedTriplet<int>> my_set;
+  my_set.emplace(1, 2, 3);
+  my_set.emplace(2, 3, 1);
+  my_set.emplace(1, 2, 4);
+  EXPECT_EQ(2, my_set.size());
+  EXPECT_EQ(1, my_set.count(SortedTriplet<int>(3, 2, 1)));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
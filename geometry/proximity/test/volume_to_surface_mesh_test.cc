@@ -82,6 +82,22 @@ GTEST_TEST(VolumeToSurfaceMeshTest, IdentifyBoundaryFaces) {
   EXPECT_EQ(expect_faces, boundary_faces);
 }
 
+// Confirms that the boundary faces don't depend on the number of threads.
+GTEST_TEST(VolumeToSurfaceMeshTest, IdentifyBoundaryFacesThreads) {
+  const auto volume =
+      MakeBoxVolumeMesh<double>(Box(0.2, 0.4, 0.6), 0.05 /* edge length */);
+  const auto expect_faces = IdentifyBoundaryFaces(volume.tetrahedra());
+  ASSERT_FALSE(expect_faces.empty());
+  for (int num_threads : {2, 3, 8}) {
+    EXPECT_EQ(IdentifyBoundaryFaces(volume.tetrahedra(), num_threads),
+              expect_faces);
+  }
+  EXPECT_EQ(ConvertVolumeToSurfaceMesh(volume, 3).num_faces(),
+            expect_faces.size());
+
+  EXPECT_TRUE(IdentifyBoundaryFaces({}, 2).empty());
+}
+
 GTEST_TEST(VolumeToSurfaceMeshTest, CollectUniqueVertices) {
   const std::vector<std::array<VolumeVertexIndex, 3>> faces{
       {VolumeVertexIndex(1), VolumeVertexIndex(2), VolumeVertexIndex(3)},
@@ -1,10 +1,13 @@
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
 
+#include <algorithm>
 #include <array>
-#include <map>
-#include <set>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
+#include "drake/common/hash.h"
+#include "drake/common/parallel_for.h"
 #include "drake/geometry/proximity/sorted_triplet.h"
 #include "drake/geometry/proximity/surface_mesh.h"
 #include "drake/geometry/proximity/volume_mesh.h"
@@ -13,108 +16,192 @@ namespace drake {
 namespace geometry {
 namespace internal {
 
+namespace {
+
+// According to VolumeElement, the first three vertices of a tetrahedron
+// define a triangle with its right-handed normal pointing inwards. The
+// fourth vertex is on the positive side of this first triangle. An example
+// of the four vertices v0,v1,v2,v3 of such a tetrahedron is shown in this
+// picture:
+//
+//      +Z
+//       |
+//       v3
+//       |
+//       |
+//     v0+------v2---+Y
+//      /
+//     /
+//   v1
+//   /
+// +X
+//
+// From the picture above, we can see that each of the following four
+// triangular faces:
+// v1 v2 v3
+// v3 v2 v0
+// v2 v1 v0
+// v1 v3 v0
+// has its right-handed normal pointing outwards from the tetrahedron.
+constexpr int kTetrahedronFaces[4][3] = {
+    {1, 2, 3},
+    {3, 2, 0},
+    {2, 1, 0},
+    {1, 3, 0}
+};
+
+// Returns the vertices of the f-th face of the tetrahedra, where the faces of
+// tetrahedron t are numbered 4t, ..., 4t + 3, and the vertices are ordered
+// according to kTetrahedronFaces.
+std::array<VolumeVertexIndex, 3> GetFace(
+    const std::vector<VolumeElement>& tetrahedra, int f) {
+  const VolumeElement& tetrahedron = tetrahedra[f / 4];
+  const int(&face_vertices)[3] = kTetrahedronFaces[f % 4];
+  return {tetrahedron.vertex(face_vertices[0]),
+          tetrahedron.vertex(face_vertices[1]),
+          tetrahedron.vertex(face_vertices[2])};
+}
+
+}  // namespace
+
 std::vector<std::array<VolumeVertexIndex, 3>> IdentifyBoundaryFaces(
-    const std::vector<VolumeElement>& tetrahedra) {
+    const std::vector<VolumeElement>& tetrahedra, int num_threads) {
+  DRAKE_DEMAND(num_threads >= 1);
   // We want to identify a triangle ABC from all six permutations of A,B,C
   // (i.e., ABC, ACB, BAC, BCA, CAB, CBA), so we use SortedTriplet(A,B,C)
   // as a unique representation of all permutations.
   //     A triangular face of a tetrahedron is either shared with another
   // tetrahedron or on the boundary surface of `volume`.
-  //     We maintain a map from SortedTriplet(A,B,C) to array{A,B,C} as we
-  // go through each triangular face of each tetrahedron. The SortedTriplet
-  // gives us the unique representation, and the array{A,B,C} gives us the
-  // appropriate winding or orientation.
-  //     For each face of each tetrahedron, if its SortedTriplet is already in
-  // the map, we remove the entry from the map because the face is shared with
-  // a previous tetrahedron. Otherwise, we insert the pair
-  // {SortedTriplet(A,B,C), array{A,B,C}} into the map.
-  //     In the end, the entries in the map correspond to the triangular
-  // faces on the boundary surface of the volume.
-  //     We use `map` instead of `unordered_map` so that we get the same
-  // result on different computers, operating systems, or compilers. It will
-  // help with repeatability between different users on different platforms.
-  // The canonical order of the entries in the map is also useful in
-  // debugging. However, `map` is slower, and we may change to
-  // `unordered_map` later if `map` is too slow.
-  std::map<SortedTriplet<VolumeVertexIndex>, std::array<VolumeVertexIndex, 3>>
-      face_map;
+  //     We go through each triangular face of each tetrahedron, and count the
+  // occurrences of its SortedTriplet in a hash table. When a face's
+  // SortedTriplet has been seen an odd number of times before, the face is
+  // marked as shared with the previous, unmatched, occurrence.
+  //     In the end, the unmarked faces are the triangular faces on the
+  // boundary surface of the volume, and their vertex order (which comes from
+  // their tetrahedron) gives the appropriate winding or orientation.
+  //     The counting is linear in the number of tetrahedra. It is partitioned
+  // by the hash of the SortedTriplet: each thread only counts the faces in
+  // its own partition, in its own hash table, so that the threads share no
+  // mutable state, and the same faces are marked regardless of the number of
+  // threads.
+  DRAKE_DEMAND(tetrahedra.size() <=
+               static_cast<size_t>(std::numeric_limits<int>::max() / 8));
+  const int num_faces = 4 * static_cast<int>(tetrahedra.size());
+  num_threads = std::max(1, std::min(num_threads, num_faces));
 
-  auto insert_or_erase = [&face_map](VolumeVertexIndex v0,
-                                     VolumeVertexIndex v1,
-                                     VolumeVertexIndex v2) {
-    SortedTriplet<VolumeVertexIndex> sorted(v0, v1, v2);
-    auto find = face_map.find(sorted);
-    if (find != face_map.end()) {
-      face_map.erase(find);
-    } else {
-      face_map.emplace(sorted,
-                       std::array<VolumeVertexIndex, 3>{v0, v1, v2});
-    }
-  };
+  std::vector<SortedTriplet<VolumeVertexIndex>> sorted_faces(num_faces);
+  std::vector<uint32_t> face_hashes(num_faces);
+  drake::internal::StaticParallelForRange(
+      num_faces, num_threads,
+      [&tetrahedra, &sorted_faces, &face_hashes](int, int begin, int end) {
+        const DefaultHash hash;
+        for (int f = begin; f < end; ++f) {
+          const std::array<VolumeVertexIndex, 3> face = GetFace(tetrahedra, f);
+          sorted_faces[f] =
+              SortedTriplet<VolumeVertexIndex>(face[0], face[1], face[2]);
+          const size_t h = hash(sorted_faces[f]);
+          face_hashes[f] = static_cast<uint32_t>(h ^ (h >> 32));
+        }
+      });
 
-  // According to VolumeElement, the first three vertices of a tetrahedron
-  // define a triangle with its right-handed normal pointing inwards. The
-  // fourth vertex is on the positive side of this first triangle. An example
-  // of the four vertices v0,v1,v2,v3 of such a tetrahedron is shown in this
-  // picture:
-  //
-  //      +Z
-  //       |
-  //       v3
-  //       |
-  //       |
-  //     v0+------v2---+Y
-  //      /
-  //     /
-  //   v1
-  //   /
-  // +X
-  //
-  // From the picture above, we can see that each of the following four
-  // triangular faces:
-  // v1 v2 v3
-  // v3 v2 v0
-  // v2 v1 v0
-  // v1 v3 v0
-  // has its right-handed normal pointing outwards from the tetrahedron.
-  const int tetrahedron_faces[4][3] = {
-      {1, 2, 3},
-      {3, 2, 0},
-      {2, 1, 0},
-      {1, 3, 0}
-  };
-  for (const VolumeElement& tetrahedron : tetrahedra) {
-    for (const auto& face_vertices : tetrahedron_faces) {
-      insert_or_erase(tetrahedron.vertex(face_vertices[0]),
-                      tetrahedron.vertex(face_vertices[1]),
-                      tetrahedron.vertex(face_vertices[2]));
-    }
+  // Each face is written by the one thread that owns its partition. We don't
+  // use vector<bool> here, because its elements can't be written
+  // concurrently.
+  std::vector<uint8_t> is_shared(num_faces, 0);
+  drake::internal::StaticParallelForRange(
+      num_threads, num_threads,
+      [&sorted_faces, &face_hashes, &is_shared, num_faces, num_threads](
+          int partition, int, int) {
+        auto in_partition = [&face_hashes, partition, num_threads](int f) {
+          return static_cast<int>(face_hashes[f] % num_threads) == partition;
+        };
+        int num_partition_faces = 0;
+        for (int f = 0; f < num_faces; ++f) {
+          if (in_partition(f)) ++num_partition_faces;
+        }
+        // An open-addressing hash table (with linear probing) with one slot
+        // per distinct SortedTriplet of the partition, at most two thirds
+        // full. The slot's hash avoids most comparisons of SortedTriplets.
+        struct Slot {
+          uint32_t hash{};
+          // -1 if the slot is empty, or 2f + u for a face f with the slot's
+          // SortedTriplet, where u is 1 if f is still waiting for a face to
+          // share it with.
+          int face{-1};
+        };
+        size_t capacity = 16;
+        while (2 * capacity < 3 * static_cast<size_t>(num_partition_faces)) {
+          capacity *= 2;
+        }
+        const size_t mask = capacity - 1;
+        std::vector<Slot> table(capacity);
+        for (int f = 0; f < num_faces; ++f) {
+          if (!in_partition(f)) continue;
+          const uint32_t hash = face_hashes[f];
+          size_t i = (hash / num_threads) & mask;
+          while (table[i].face >= 0 &&
+                 !(table[i].hash == hash &&
+                   sorted_faces[table[i].face / 2] == sorted_faces[f])) {
+            i = (i + 1) & mask;
+          }
+          Slot& slot = table[i];
+          if (slot.face >= 0 && slot.face % 2 == 1) {
+            is_shared[slot.face / 2] = 1;
+            is_shared[f] = 1;
+            slot.face -= 1;
+          } else {
+            slot = Slot{hash, 2 * f + 1};
+          }
+        }
+      });
+
+  // We report the faces in the order of their SortedTriplet, so that we get
+  // the same result on different computers, operating systems, or compilers.
+  // It will help with repeatability between different users on different
+  // platforms. The canonical order is also useful in debugging. Only the
+  // boundary faces, typically a small fraction of all faces, are sorted.
+  std::vector<int> boundary_faces;
+  for (int f = 0; f < num_faces; ++f) {
+    if (!is_shared[f]) boundary_faces.push_back(f);
   }
+  std::sort(boundary_faces.begin(), boundary_faces.end(),
+            [&sorted_faces](int f, int g) {
+              return sorted_faces[f] < sorted_faces[g];
+            });
 
   std::vector<std::array<VolumeVertexIndex, 3>> boundary;
-  boundary.reserve(face_map.size());
-  for (const auto& pair : face_map) {
-    boundary.emplace_back(pair.second);
+  boundary.reserve(boundary_faces.size());
+  for (int f : boundary_faces) {
+    boundary.push_back(GetFace(tetrahedra, f));
   }
-
   return boundary;
 }
 
 std::vector<VolumeVertexIndex> CollectUniqueVertices(
     const std::vector<std::array<VolumeVertexIndex, 3>>& faces) {
-  // We use `set` instead of `unordered_set` so that we get the same
-  // result on different computers, operating systems, or compilers. It will
-  // help with repeatability between different users on different platforms.
-  // The canonical order of the vertices is also useful in debugging.
-  // However, `set` is slower, and we may change to `unordered_set` later if
-  // `set` is too slow.
-  std::set<VolumeVertexIndex> vertex_set;
+  // We mark the vertices in a vector indexed by the vertex index, instead of
+  // using a hash set, so that we get the same result on different computers,
+  // operating systems, or compilers, in linear time. It will help with
+  // repeatability between different users on different platforms. The
+  // vertices are reported in increasing order, which is also useful in
+  // debugging.
+  int num_vertices = 0;
   for (const auto& face : faces) {
     for (const auto& vertex : face) {
-      vertex_set.insert(vertex);
+      num_vertices = std::max(num_vertices, int{vertex} + 1);
     }
   }
-  return std::vector<VolumeVertexIndex>(vertex_set.begin(), vertex_set.end());
+  std::vector<bool> is_used(num_vertices, false);
+  for (const auto& face : faces) {
+    for (const auto& vertex : face) {
+      is_used[vertex] = true;
+    }
+  }
+  std::vector<VolumeVertexIndex> vertices;
+  for (int v = 0; v < num_vertices; ++v) {
+    if (is_used[v]) vertices.emplace_back(v);
+  }
+  return vertices;
 }
 
 }  // namespace internal
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <array>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -13,26 +12,32 @@ namespace geometry {
 namespace internal {
 
 /*
- Identify the triangular boundary faces of a tetrahedral volume mesh.
+ Identify the triangular boundary faces of a tetrahedral volume mesh. The
+ computational cost is linear in the number of tetrahedra (plus the sorting of
+ the boundary faces).
  @param tetrahedra   The tetrahedra of the mesh.
+ @param num_threads  The number of threads among which the identification is
+                     spread. The result does not depend on it.
  @return             The boundary faces, each of which is represented as an
                      array of three indices of vertices of the volume mesh.
                      Each face has its right-handed normal pointing outwards
-                     from the volume mesh.
+                     from the volume mesh. The faces are ordered by the
+                     SortedTriplet of their vertices.
  @pre  1. The volume mesh cannot be a tetrahedron soup. If two tetrahedra
           share a face, they must share vertex indices and not index into
           duplicate vertices.
        2. Any given face is shared by one or two tetrahedra only.
+       3. num_threads >= 1.
  */
 std::vector<std::array<VolumeVertexIndex, 3>> IdentifyBoundaryFaces(
-    const std::vector<VolumeElement>& tetrahedra);
+    const std::vector<VolumeElement>& tetrahedra, int num_threads = 1);
 
 /*
  Collects unique vertices from faces of a volume mesh. Each vertex shared by
  multiple faces is reported once. Each face is represented as an array of
  three vertices of a volume mesh.
  @param[in] faces
- @return    vertices used by the faces.
+ @return    vertices used by the faces, in increasing order.
  */
 std::vector<VolumeVertexIndex> CollectUniqueVertices(
     const std::vector<std::array<VolumeVertexIndex, 3>>& faces);
@@ -42,6 +47,8 @@ std::vector<VolumeVertexIndex> CollectUniqueVertices(
  boundary surface of the volume.
  @param volume  The tetrahedral volume mesh, whose vertex positions are
                 measured and expressed in some frame E.
+ @param num_threads  The number of threads used to identify the boundary
+                faces; see IdentifyBoundaryFaces().
  @return        The triangulated surface mesh, whose vertex positions are
                 measured and expressed in the same frame E of the volume mesh.
  @pre           The vertices of the volume mesh are unique. Adjacent
@@ -53,27 +60,31 @@ std::vector<VolumeVertexIndex> CollectUniqueVertices(
                 or AutoDiffXd. Must be a valid Eigen scalar.
  */
 template <class T>
-SurfaceMesh<T> ConvertVolumeToSurfaceMesh(const VolumeMesh<T>& volume) {
+SurfaceMesh<T> ConvertVolumeToSurfaceMesh(const VolumeMesh<T>& volume,
+                                          int num_threads = 1) {
   const std::vector<std::array<VolumeVertexIndex, 3>> boundary_faces =
-      IdentifyBoundaryFaces(volume.tetrahedra());
+      IdentifyBoundaryFaces(volume.tetrahedra(), num_threads);
 
   const std::vector<VolumeVertexIndex> boundary_vertices =
       CollectUniqueVertices(boundary_faces);
 
+  // The boundary vertices are renumbered compactly, in increasing order of
+  // their volume vertex index. The map from one to the other is a vector
+  // indexed by the volume vertex index.
   std::vector<SurfaceVertex<T>> surface_vertices;
   surface_vertices.reserve(boundary_vertices.size());
-  std::unordered_map<VolumeVertexIndex, SurfaceVertexIndex> volume_to_surface;
+  std::vector<SurfaceVertexIndex> volume_to_surface(volume.num_vertices());
   for (SurfaceVertexIndex i(0); i < boundary_vertices.size(); ++i) {
     surface_vertices.emplace_back(volume.vertex(boundary_vertices[i]).r_MV());
-    volume_to_surface.emplace(boundary_vertices[i], i);
+    volume_to_surface[boundary_vertices[i]] = i;
   }
 
   std::vector<SurfaceFace> surface_faces;
   surface_faces.reserve(boundary_faces.size());
   for (const auto& face_vertices : boundary_faces) {
-    surface_faces.emplace_back(volume_to_surface.at(face_vertices[0]),
-                               volume_to_surface.at(face_vertices[1]),
-                               volume_to_surface.at(face_vertices[2]));
+    surface_faces.emplace_back(volume_to_surface[face_vertices[0]],
+                               volume_to_surface[face_vertices[1]],
+                               volume_to_surface[face_vertices[2]]);
   }
 
   return SurfaceMesh<T>(std::move(surface_faces), std::move(surface_vertices));
@@ -1,8 +1,12 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <limits>
+#include <map>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -13,10 +17,13 @@
 #include <tiny_obj_loader.h>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/proximity/collision_filter_legacy.h"
 #include "drake/geometry/proximity/collisions_exist_callback.h"
+#include "drake/geometry/proximity/convex_hull.h"
 #include "drake/geometry/proximity/distance_to_point_callback.h"
 #include "drake/geometry/proximity/distance_to_point_with_gradient.h"
 #include "drake/geometry/proximity/distance_to_shape_callback.h"
@@ -25,6 +32,7 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
+#include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/utilities.h"
 
 static_assert(std::is_same<tinyobj::real_t, double>::value,
@@ -155,28 +163,19 @@ struct ReifyData {
   unique_ptr<CollisionObjectd> fcl_object;
   const GeometryId id;
   const ProximityProperties& properties;
+  // Whether `fcl_object` is the bounding box of a Mesh, which is supported
+  // only in ComputeContactSurfaces but not other proximity queries (see
+  // ProximityEngine::Impl::X_MeshBs_).
+  bool is_mesh_bounding_box{false};
 };
 
-// Small class for identifying mesh geometries. Unlike other kinds of
-// geometries, meshes are supported only in ComputeContactSurfaces but
-// not other proximity queries.
-class MeshIdentifier final : public ShapeReifier {
- public:
-  bool is_mesh() const { return is_mesh_; }
-
-  // Implementation of ShapeReifier interface.
-  using ShapeReifier::ImplementGeometry;
-  void ImplementGeometry(const Sphere&, void*) final {}
-  void ImplementGeometry(const Cylinder&, void*) final {}
-  void ImplementGeometry(const Ellipsoid&, void*) final {}
-  void ImplementGeometry(const HalfSpace&, void*) final {}
-  void ImplementGeometry(const Box&, void*) final {}
-  void ImplementGeometry(const Capsule&, void*) final {}
-  void ImplementGeometry(const Mesh&, void*) final { is_mesh_ = true; }
-  void ImplementGeometry(const Convex&, void*) final {}
-
- private:
-  bool is_mesh_{false};
+// The vertices and faces of a convex approximation of a Mesh, in the format of
+// fcl::Convex. They are shared by the fcl::Convex objects of the meshes with
+// the same approximation.
+struct ConvexData {
+  shared_ptr<const std::vector<Vector3d>> vertices;
+  int num_faces{};
+  shared_ptr<const std::vector<int>> faces;
 };
 
 // Helper functions to facilitate exercising FCL's broadphase code. FCL has
@@ -202,6 +201,89 @@ void FclDistance(const fcl::DynamicAABBTreeCollisionManager<double>& tree1,
       callback);
 }
 
+// The fcl objects of the geometry pairs reported by the broadphase.
+using CandidatePairs = std::vector<std::pair<CollisionObjectd*,
+                                             CollisionObjectd*>>;
+
+// Broadphase callback that simply records every candidate pair in the
+// CandidatePairs pointed to by `callback_data`, deferring both collision
+// filtering and narrowphase evaluation to the caller.
+bool CollectCandidatePair(CollisionObjectd* fcl_object_A_ptr,
+                          CollisionObjectd* fcl_object_B_ptr,
+                          void* callback_data) {
+  static_cast<CandidatePairs*>(callback_data)
+      ->emplace_back(fcl_object_A_ptr, fcl_object_B_ptr);
+  // Returning false tells the broadphase manager to keep going.
+  return false;
+}
+
+// The narrowphase statistics of a collision query, keyed on shape pair types.
+using ShapePairStatisticsMap =
+    std::map<SortedPair<std::string>,
+             ProximityQueryStatistics::ShapePairStatistics>;
+
+using Clock = std::chrono::steady_clock;
+
+// Returns the number of seconds elapsed since `start`.
+double SecondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Returns the name of the Drake shape represented by the given fcl object.
+std::string GetShapeName(const CollisionObjectd& object) {
+  switch (object.collisionGeometry()->getNodeType()) {
+    case fcl::GEOM_SPHERE:
+      return "Sphere";
+    case fcl::GEOM_CYLINDER:
+      return "Cylinder";
+    case fcl::GEOM_ELLIPSOID:
+      return "Ellipsoid";
+    case fcl::GEOM_HALFSPACE:
+      return "HalfSpace";
+    case fcl::GEOM_BOX:
+      return "Box";
+    case fcl::GEOM_CAPSULE:
+      return "Capsule";
+    case fcl::GEOM_CONVEX:
+      return "Convex";
+    default:
+      return "Unknown";
+  }
+}
+
+// Evaluates the narrowphase `callback` on the candidate `pair` reported by the
+// broadphase. When `shape_pairs` is not nullptr, it also records the time of
+// the evaluation under the shape types of the pair.
+template <typename CallbackData>
+void EvalNarrowphase(
+    const std::pair<CollisionObjectd*, CollisionObjectd*>& pair,
+    fcl::CollisionCallBack<double> callback, CallbackData* data,
+    ShapePairStatisticsMap* shape_pairs) {
+  if (shape_pairs == nullptr) {
+    callback(pair.first, pair.second, data);
+    return;
+  }
+  const Clock::time_point start = Clock::now();
+  callback(pair.first, pair.second, data);
+  const double time = SecondsSince(start);
+  ProximityQueryStatistics::ShapePairStatistics& stats =
+      (*shape_pairs)[SortedPair<std::string>(GetShapeName(*pair.first),
+                                             GetShapeName(*pair.second))];
+  ++stats.num_pairs;
+  stats.narrowphase_time += time;
+}
+
+// Moves the contents of each of the `blocks` (in order) to the end of
+// `results`.
+template <typename Element>
+void MoveAppend(std::vector<std::vector<Element>>* blocks,
+                std::vector<Element>* results) {
+  for (auto& block : *blocks) {
+    results->insert(results->end(), std::make_move_iterator(block.begin()),
+                    std::make_move_iterator(block.end()));
+  }
+}
+
 // Compare function to use with ordering PenetrationAsPointPairs.
 bool OrderPointPair(const PenetrationAsPointPair<double>& p1,
                     const PenetrationAsPointPair<double>& p2) {
@@ -251,6 +333,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     CopyFclObjectsOrThrow(other.dynamic_mesh_objects_, &dynamic_mesh_objects_,
                           &object_map);
     X_MeshBs_ = other.X_MeshBs_;
+    mesh_approximations_ = other.mesh_approximations_;
 
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
@@ -261,6 +344,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                            &anchored_mesh_tree_);
 
     collision_filter_ = other.collision_filter_;
+    num_threads_ = other.num_threads_;
+    collect_statistics_ = other.collect_statistics_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -287,8 +372,11 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     CopyFclObjectsOrThrow(dynamic_mesh_objects_, &engine->dynamic_mesh_objects_,
                           &object_map);
     engine->X_MeshBs_ = this->X_MeshBs_;
+    engine->mesh_approximations_ = this->mesh_approximations_;
 
     engine->collision_filter_ = this->collision_filter_;
+    engine->num_threads_ = this->num_threads_;
+    engine->collect_statistics_ = this->collect_statistics_;
 
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
@@ -378,34 +466,58 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_num_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_threads_ = num_threads;
+  }
+
+  int num_threads() const { return num_threads_; }
+
+  void set_collect_statistics(bool collect_statistics) {
+    collect_statistics_ = collect_statistics;
+  }
+
+  bool collect_statistics() const { return collect_statistics_; }
+
+  const ProximityQueryStatistics& last_query_statistics() const {
+    return statistics_;
+  }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
   //    a vector and the caller sets values there directly.
   void UpdateWorldPoses(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) {
+    // Each object is updated through the iterated entry; the only hash lookups
+    // per geometry are those of its pose. Only the objects whose poses changed
+    // are refit in the broadphase trees, so that geometries at rest (e.g.,
+    // objects resting in a bin) cost no more than a pose comparison. A pose is
+    // considered changed unless it is bitwise identical to the previous one;
+    // any tolerance would make the broadphase miss actual motion.
+    std::vector<CollisionObjectd*> moved_objects;
     for (const auto& id_object_pair : dynamic_objects_) {
       const GeometryId id = id_object_pair.first;
+      CollisionObjectd& object = *id_object_pair.second;
       const RigidTransform<T>& X_WG = X_WGs.at(id);
       // The FCL broadphase requires double-valued poses; so we use ADL to
       // efficiently get double-valued poses out of arbitrary T-valued poses.
-      dynamic_objects_[id]->setTransform(
-          convert_to_double(X_WG).GetAsIsometry3());
-      dynamic_objects_[id]->computeAABB();
+      MaybeSetTransform(convert_to_double(X_WG), &object, &moved_objects);
     }
-    dynamic_tree_.update();
+    UpdateTree(moved_objects, &dynamic_tree_);
 
+    moved_objects.clear();
     for (const auto& id_object_pair : dynamic_mesh_objects_) {
       const GeometryId id = id_object_pair.first;
+      CollisionObjectd& object = *id_object_pair.second;
       const RigidTransform<T>& X_WG = X_WGs.at(id);
       // For a Mesh G, its fcl object is its bounding Box B that has its pose
       // X_GB expressed in G's frame.
       const RigidTransformd& X_GB = X_MeshBs_.at(id);
-      const RigidTransformd X_WB = convert_to_double(X_WG) * X_GB;
-      dynamic_mesh_objects_[id]->setTransform(X_WB.GetAsIsometry3());
-      dynamic_mesh_objects_[id]->computeAABB();
+      MaybeSetTransform(convert_to_double(X_WG) * X_GB, &object,
+                        &moved_objects);
     }
-    dynamic_mesh_tree_.update();
+    UpdateTree(moved_objects, &dynamic_mesh_tree_);
   }
 
   // Implementation of ShapeReifier interface
@@ -473,26 +585,83 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   // Convert Mesh specification to fcl representation and hydroelastic
-  // representation. The fcl representation of the mesh is a box for
+  // representation. Unless the mesh has a convex approximation (see
+  // AddMeshApproximation()), the fcl representation of the mesh is a box for
   // broadphase culling because meshes are not supported in other proximity
   // queries except ComputeContactSurfaces.
   void ImplementGeometry(const Mesh& mesh, void* user_data) override {
+    ReifyData& data = *static_cast<ReifyData*>(user_data);
+    if (data.properties.HasProperty(kMeshGroup, kMeshApproximation)) {
+      const auto approximation = data.properties.GetProperty<MeshApproximation>(
+          kMeshGroup, kMeshApproximation);
+      TakeShapeOwnership(MakeMeshApproximation(mesh, approximation),
+                         user_data);
+      ProcessHydroelastic(mesh, user_data);
+      return;
+    }
+
     static const logging::Warn log_once(
         "Mesh is only for ComputeContactSurfaces in hydroelastic contact "
-        "model. It is _not_ available in other proximity queries.");
+        "model. It is _not_ available in other proximity queries, unless it "
+        "is given a convex approximation with AddMeshApproximation().");
     SurfaceMesh<double> surface =
         ReadObjToSurfaceMesh(mesh.filename(), mesh.scale());
     auto [center, size] = surface.CalcBoundingBox();
     auto fcl_box = make_shared<fcl::Boxd>(size);
 
     TakeShapeOwnership(fcl_box, user_data);
+    data.is_mesh_bounding_box = true;
     // Store the pose X_MB of the bounding box B expressed in mesh's frame M.
     // Since B is axis-aligned, X_MB is simply a translation to B's center.
     RigidTransformd X_MB(center);
-    X_MeshBs_[static_cast<ReifyData*>(user_data)->id] = X_MB;
+    X_MeshBs_[data.id] = X_MB;
     ProcessHydroelastic(mesh, user_data);
   }
 
+  // Returns the fcl::Convex of the given approximation of the `mesh`, which
+  // is computed on the first request for the mesh's file and scale.
+  shared_ptr<fcl::Convexd> MakeMeshApproximation(
+      const Mesh& mesh, MeshApproximation approximation) {
+    const auto key =
+        std::make_tuple(mesh.filename(), mesh.scale(), approximation);
+    auto iter = mesh_approximations_.find(key);
+    if (iter == mesh_approximations_.end()) {
+      const SurfaceMesh<double> surface =
+          ReadObjToSurfaceMesh(mesh.filename(), mesh.scale());
+      std::vector<Vector3d> points;
+      if (approximation == MeshApproximation::kConvexHull) {
+        points.reserve(surface.num_vertices());
+        for (const SurfaceVertex<double>& vertex : surface.vertices()) {
+          points.push_back(vertex.r_MV());
+        }
+      } else {
+        DRAKE_DEMAND(approximation == MeshApproximation::kBoundingBox);
+        const auto [center, size] = surface.CalcBoundingBox();
+        for (int corner = 0; corner < 8; ++corner) {
+          const Vector3d sign((corner & 1) ? 1 : -1, (corner & 2) ? 1 : -1,
+                              (corner & 4) ? 1 : -1);
+          points.push_back(center + 0.5 * size.cwiseProduct(sign));
+        }
+      }
+      ConvexHull hull;
+      try {
+        hull = CalcConvexHull(points);
+      } catch (const std::exception& e) {
+        throw std::runtime_error(fmt::format(
+            "The convex approximation of the Mesh '{}' cannot be computed: {}",
+            mesh.filename(), e.what()));
+      }
+      ConvexData convex{
+          make_shared<const std::vector<Vector3d>>(std::move(hull.vertices)),
+          hull.num_faces,
+          make_shared<const std::vector<int>>(std::move(hull.faces))};
+      iter = mesh_approximations_.emplace(key, std::move(convex)).first;
+    }
+    const ConvexData& convex = iter->second;
+    return make_shared<fcl::Convexd>(convex.vertices, convex.num_faces,
+                                     convex.faces);
+  }
+
   //
   // Convert vertices from tinyobj format to FCL format.
   //
@@ -707,32 +876,106 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     query_point.computeAABB();
 
     std::vector<SignedDistanceToPoint<T>> distances;
+    CalcSignedDistanceToPoint(p_WQ, X_WGs, threshold, &query_point,
+                              &distances);
+    return distances;
+  }
 
-    point_distance::CallbackData<T> data{
-        &query_point, threshold, p_WQ, &X_WGs, &distances};
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const double threshold) const {
+    const int num_points = p_WQs.cols();
+    std::vector<std::vector<SignedDistanceToPoint<T>>> distances(num_points);
+    // The trees are only read by the queries, so each block of points can be
+    // evaluated on its own thread, with its own query object. Each point
+    // writes only to its own result vector.
+    auto fcl_sphere = make_shared<fcl::Sphered>(0.0);
+    drake::internal::StaticParallelForRange(
+        num_points, num_threads_,
+        [this, &p_WQs, &X_WGs, threshold, &fcl_sphere, &distances](
+            int, int begin, int end) {
+          CollisionObjectd query_point(fcl_sphere);
+          for (int i = begin; i < end; ++i) {
+            query_point.setTranslation(convert_to_double(
+                Vector3<T>(p_WQs.col(i))));
+            query_point.computeAABB();
+            CalcSignedDistanceToPoint(p_WQs.col(i), X_WGs, threshold,
+                                      &query_point, &distances[i]);
+          }
+        });
+    return distances;
+  }
+
+  // Appends the signed distances to the point Q (represented by `query_point`,
+  // already posed at p_WQ) of the geometries within `threshold` of it.
+  void CalcSignedDistanceToPoint(
+      const Vector3<T>& p_WQ,
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const double threshold, CollisionObjectd* query_point,
+      std::vector<SignedDistanceToPoint<T>>* distances) const {
+    point_distance::CallbackData<T> data{query_point, threshold, p_WQ, &X_WGs,
+                                         distances};
 
     // Perform query of point vs dynamic objects.
-    dynamic_tree_.distance(&query_point, &data, point_distance::Callback<T>);
+    dynamic_tree_.distance(query_point, &data, point_distance::Callback<T>);
 
     // Perform query of point vs anchored objects.
-    anchored_tree_.distance(&query_point, &data, point_distance::Callback<T>);
-
-    return distances;
+    anchored_tree_.distance(query_point, &data, point_distance::Callback<T>);
   }
 
   std::vector<PenetrationAsPointPair<double>> ComputePointPairPenetration()
       const {
     std::vector<PenetrationAsPointPair<double>> contacts;
-    penetration_as_point_pair::CallbackData data{&collision_filter_, &contacts};
 
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&data, penetration_as_point_pair::Callback);
+    if (num_threads_ == 1 && !collect_statistics_) {
+      penetration_as_point_pair::CallbackData data{&collision_filter_,
+                                                   &contacts};
 
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
-               penetration_as_point_pair::Callback);
+      // Perform a query of the dynamic objects against themselves.
+      dynamic_tree_.collide(&data, penetration_as_point_pair::Callback);
+
+      // Perform a query of the dynamic objects against the anchored. We don't
+      // do anchored against anchored because those pairs are implicitly
+      // filtered.
+      FclCollide(dynamic_tree_, anchored_tree_, &data,
+                 penetration_as_point_pair::Callback);
+    } else {
+      // Collect the broadphase candidates (over the same tree pairs as above)
+      // and then evaluate the narrowphase for blocks of candidates in
+      // parallel, each into its own result vector.
+      const Clock::time_point start = Clock::now();
+      CandidatePairs candidates;
+      dynamic_tree_.collide(&candidates, CollectCandidatePair);
+      FclCollide(dynamic_tree_, anchored_tree_, &candidates,
+                 CollectCandidatePair);
+      RecordBroadphaseStatistics(start, candidates.size());
+
+      std::vector<std::vector<PenetrationAsPointPair<double>>>
+          thread_contacts(num_threads_);
+      vector<ShapePairStatisticsMap> thread_shape_pairs(
+          collect_statistics_ ? num_threads_ : 0);
+      drake::internal::StaticParallelForRange(
+          static_cast<int>(candidates.size()), num_threads_,
+          [this, &candidates, &thread_contacts, &thread_shape_pairs](
+              int thread_num, int begin, int end) {
+            penetration_as_point_pair::CallbackData data{
+                &collision_filter_, &thread_contacts[thread_num]};
+            ShapePairStatisticsMap* shape_pairs =
+                GetShapePairs(&thread_shape_pairs, thread_num);
+            for (int i = begin; i < end; ++i) {
+              EvalNarrowphase(candidates[i],
+                              penetration_as_point_pair::Callback, &data,
+                              shape_pairs);
+            }
+          });
+      MoveAppend(&thread_contacts, &contacts);
+      RecordNarrowphaseStatistics(thread_shape_pairs);
+    }
 
+    // Each geometry pair is reported at most once, so sorting by id pair gives
+    // the same order regardless of which path computed the results.
     std::sort(contacts.begin(), contacts.end(), OrderPointPair);
 
     return contacts;
@@ -743,13 +986,31 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // All these quantities are aliased in the callback data.
     find_collision_candidates::CallbackData data{&collision_filter_, &pairs};
 
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&data, find_collision_candidates::Callback);
-
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
-               find_collision_candidates::Callback);
+    if (collect_statistics_) {
+      // Collect the candidates over the same tree pairs as below, to time the
+      // broadphase and the collision filtering separately.
+      const Clock::time_point start = Clock::now();
+      CandidatePairs candidates;
+      dynamic_tree_.collide(&candidates, CollectCandidatePair);
+      FclCollide(dynamic_tree_, anchored_tree_, &candidates,
+                 CollectCandidatePair);
+      RecordBroadphaseStatistics(start, candidates.size());
+      vector<ShapePairStatisticsMap> shape_pairs(1);
+      for (const auto& candidate : candidates) {
+        EvalNarrowphase(candidate, find_collision_candidates::Callback, &data,
+                        &shape_pairs[0]);
+      }
+      RecordNarrowphaseStatistics(shape_pairs);
+    } else {
+      // Perform a query of the dynamic objects against themselves.
+      dynamic_tree_.collide(&data, find_collision_candidates::Callback);
+
+      // Perform a query of the dynamic objects against the anchored. We don't
+      // do anchored against anchored because those pairs are implicitly
+      // filtered.
+      FclCollide(dynamic_tree_, anchored_tree_, &data,
+                 find_collision_candidates::Callback);
+    }
 
     std::sort(
         pairs.begin(), pairs.end(),
@@ -777,6 +1038,37 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   vector<ContactSurface<T>> ComputeContactSurfaces(
       const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
     vector<ContactSurface<T>> surfaces;
+
+    if (num_threads_ > 1 || collect_statistics_) {
+      // Every candidate pair is strictly hydroelastic here; the parallel
+      // evaluation mirrors the serial broadphase traversal below.
+      const Clock::time_point start = Clock::now();
+      CandidatePairs candidates;
+      CollectHydroelasticCandidates(&candidates, &candidates);
+      RecordBroadphaseStatistics(start, candidates.size());
+
+      vector<vector<ContactSurface<T>>> thread_surfaces(num_threads_);
+      vector<ShapePairStatisticsMap> thread_shape_pairs(
+          collect_statistics_ ? num_threads_ : 0);
+      drake::internal::StaticParallelForRange(
+          static_cast<int>(candidates.size()), num_threads_,
+          [&](int thread_num, int begin, int end) {
+            hydroelastic::CallbackData<T> data{
+                &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+                &thread_surfaces[thread_num]};
+            ShapePairStatisticsMap* shape_pairs =
+                GetShapePairs(&thread_shape_pairs, thread_num);
+            for (int i = begin; i < end; ++i) {
+              EvalNarrowphase(candidates[i], hydroelastic::Callback<T>, &data,
+                              shape_pairs);
+            }
+          });
+      MoveAppend(&thread_surfaces, &surfaces);
+      RecordNarrowphaseStatistics(thread_shape_pairs);
+      std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
+      return surfaces;
+    }
+
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
                                        &hydroelastic_geometries_, &surfaces};
@@ -809,6 +1101,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       std::vector<PenetrationAsPointPair<double>>* point_pairs) const {
     DRAKE_DEMAND(surfaces);
     DRAKE_DEMAND(point_pairs);
+
+    if (num_threads_ > 1 || collect_statistics_) {
+      ComputeContactSurfacesWithFallbackInParallel(X_WGs, surfaces,
+                                                   point_pairs);
+      return;
+    }
+
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackWithFallbackData<T> data{
         hydroelastic::CallbackData<T>{&collision_filter_, &X_WGs,
@@ -850,7 +1149,118 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
 
-    std::sort(point_pairs->begin(), point_pairs->end(), OrderPointPair);
+    // Two boxes can report several point pairs; the stable sort keeps them in
+    // the order they were computed.
+    std::stable_sort(point_pairs->begin(), point_pairs->end(), OrderPointPair);
+  }
+
+  // The multi-threaded implementation of ComputeContactSurfacesWithFallback(),
+  // also used to collect statistics. The narrowphase of every broadphase
+  // candidate is evaluated exactly as in the serial implementation, but each
+  // thread writes to its own results.
+  void ComputeContactSurfacesWithFallbackInParallel(
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      std::vector<ContactSurface<T>>* surfaces,
+      std::vector<PenetrationAsPointPair<double>>* point_pairs) const {
+    const Clock::time_point start = Clock::now();
+    CandidatePairs fallback_candidates;
+    CandidatePairs strict_candidates;
+    CollectHydroelasticCandidates(&fallback_candidates, &strict_candidates);
+    const int num_fallback = static_cast<int>(fallback_candidates.size());
+    const int num_candidates =
+        num_fallback + static_cast<int>(strict_candidates.size());
+    RecordBroadphaseStatistics(start, num_candidates);
+
+    vector<vector<ContactSurface<T>>> thread_surfaces(num_threads_);
+    vector<vector<PenetrationAsPointPair<double>>> thread_point_pairs(
+        num_threads_);
+    vector<ShapePairStatisticsMap> thread_shape_pairs(
+        collect_statistics_ ? num_threads_ : 0);
+    drake::internal::StaticParallelForRange(
+        num_candidates, num_threads_,
+        [&](int thread_num, int begin, int end) {
+          hydroelastic::CallbackWithFallbackData<T> data{
+              hydroelastic::CallbackData<T>{&collision_filter_, &X_WGs,
+                                            &hydroelastic_geometries_,
+                                            &thread_surfaces[thread_num]},
+              &thread_point_pairs[thread_num]};
+          ShapePairStatisticsMap* shape_pairs =
+              GetShapePairs(&thread_shape_pairs, thread_num);
+          for (int i = begin; i < end; ++i) {
+            if (i < num_fallback) {
+              EvalNarrowphase(fallback_candidates[i],
+                              hydroelastic::CallbackWithFallback<T>, &data,
+                              shape_pairs);
+            } else {
+              EvalNarrowphase(strict_candidates[i - num_fallback],
+                              hydroelastic::Callback<T>, &data.data,
+                              shape_pairs);
+            }
+          }
+        });
+
+    MoveAppend(&thread_surfaces, surfaces);
+    MoveAppend(&thread_point_pairs, point_pairs);
+    RecordNarrowphaseStatistics(thread_shape_pairs);
+    std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
+    std::stable_sort(point_pairs->begin(), point_pairs->end(), OrderPointPair);
+  }
+
+  // When collecting statistics, starts the statistics of a new query whose
+  // broadphase started at `start` and reported `num_candidates` pairs.
+  void RecordBroadphaseStatistics(Clock::time_point start,
+                                  int num_candidates) const {
+    if (!collect_statistics_) return;
+    statistics_ = {};
+    statistics_.broadphase_time = SecondsSince(start);
+    statistics_.num_broadphase_candidates = num_candidates;
+  }
+
+  // When collecting statistics, adds the narrowphase statistics accumulated
+  // by each thread to those of the current query.
+  void RecordNarrowphaseStatistics(
+      const vector<ShapePairStatisticsMap>& thread_shape_pairs) const {
+    for (const ShapePairStatisticsMap& shape_pairs : thread_shape_pairs) {
+      for (const auto& [shapes, stats] : shape_pairs) {
+        ProximityQueryStatistics::ShapePairStatistics& total =
+            statistics_.shape_pairs[shapes];
+        total.num_pairs += stats.num_pairs;
+        total.narrowphase_time += stats.narrowphase_time;
+        statistics_.narrowphase_time += stats.narrowphase_time;
+      }
+    }
+  }
+
+  // Returns the narrowphase statistics of the given thread, or nullptr when
+  // statistics are not collected (`thread_shape_pairs` is empty).
+  static ShapePairStatisticsMap* GetShapePairs(
+      vector<ShapePairStatisticsMap>* thread_shape_pairs, int thread_num) {
+    return thread_shape_pairs->empty() ? nullptr
+                                       : &(*thread_shape_pairs)[thread_num];
+  }
+
+  // Collects the broadphase candidates considered by the hydroelastic
+  // queries. Candidates that may fall back to point-pair contact (i.e., those
+  // between non-mesh geometries) are written to `fallback_candidates`; those
+  // that include a mesh (and therefore must be strictly hydroelastic) are
+  // written to `strict_candidates`. The two may alias the same vector.
+  void CollectHydroelasticCandidates(CandidatePairs* fallback_candidates,
+                                     CandidatePairs* strict_candidates) const {
+    DRAKE_DEMAND(fallback_candidates != nullptr);
+    DRAKE_DEMAND(strict_candidates != nullptr);
+    dynamic_tree_.collide(fallback_candidates, CollectCandidatePair);
+    FclCollide(dynamic_tree_, anchored_tree_, fallback_candidates,
+               CollectCandidatePair);
+
+    FclCollide(dynamic_tree_, anchored_mesh_tree_, strict_candidates,
+               CollectCandidatePair);
+    FclCollide(dynamic_tree_, dynamic_mesh_tree_, strict_candidates,
+               CollectCandidatePair);
+    dynamic_mesh_tree_.collide(strict_candidates, CollectCandidatePair);
+    FclCollide(dynamic_mesh_tree_, anchored_tree_, strict_candidates,
+               CollectCandidatePair);
+    FclCollide(dynamic_mesh_tree_, anchored_mesh_tree_, strict_candidates,
+               CollectCandidatePair);
   }
 
   // TODO(SeanCurtis-TRI): Update this with the new collision filter method.
@@ -866,10 +1276,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     //   2. There are non-zero numbers of dynamic *and* anchored geometries.
     //
     // NOTE: Given the set of geometries G, if the pair (gᵢ, gⱼ), gᵢ, gⱼ ∈ G
-    // is already filtered, this *will* add a redundant clique.
-    // TODO(SeanCurtis-TRI): If redundant cliques proves to have a performance
-    // impact before the alternate filtering mechanism is in place, revisit this
-    // algorithm to prevent redundancy.
+    // is already filtered, this *will* add a redundant clique. Redundant
+    // cliques do not affect the cost of the filter queries.
 
     if (dynamic.size() > 1 || (dynamic.size() > 0 && anchored.size() > 0)) {
       int clique = collision_filter_.next_clique_id();
@@ -889,13 +1297,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       const std::unordered_set<GeometryId>& anchored1,
       const std::unordered_set<GeometryId>& dynamic2,
       const std::unordered_set<GeometryId>& anchored2) {
-    // TODO(SeanCurtis-TRI): Update this with the new collision filter method.
-
-    // NOTE: This is a brute-force implementation. It does not claim to be
-    // optimal in any way. It merely guarantees the semantics given. If the
-    // two sets of geometries are in fact the *same* set (i.e., this is used
-    // to create the same effect as ExcludeCollisionsWithin), it will work, but
-    // be horribly inefficient (with each geometry picking up N cliques).
+    // NOTE: This is a brute-force implementation, which filters each pair
+    // (g, h), g ∈ G, h ∈ H, for the two collision groups G and H individually.
+    // Unlike a clique, filtering a pair does not affect the self-collision
+    // within either of the groups. If the two sets of geometries are in fact
+    // the *same* set (i.e., this is used to create the same effect as
+    // ExcludeCollisionsWithin), it will work as well.
     using std::transform;
     using std::back_inserter;
     using std::vector;
@@ -914,25 +1321,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       transform(anchored2.begin(), anchored2.end(), back_inserter(group2),
                 EncodedData::encode_anchored);
 
-      // O(N²) process which generates O(N²) cliques. For the two collision
-      // groups G and H, each pair (g, h), g ∈ G, h ∈ H, requires a unique
-      // clique. If the cliques were not unique, then there would be a pair
-      // (a, b) where a, b ∈ G or a, b ∈ H where a and b have the same clique.
-      // And that would lead to removal of self-collision within one of the
-      // collision groups.
-      //
-      // NOTE: Using cliques for this purpose is *horribly* inefficient. This is
-      // exactly what collision filter groups are best at.
+      // O(N²) process which filters O(N²) pairs, each in constant time.
       for (auto encoding1 : group1) {
         for (auto encoding2 : group2) {
           if ((encoding1.is_dynamic() || encoding2.is_dynamic()) &&
-              collision_filter_.CanCollideWith(encoding1.encoding(),
-                                               encoding2.encoding())) {
-            int clique = collision_filter_.next_clique_id();
-            collision_filter_.AddToCollisionClique(encoding2.encoding(),
-                                                   clique);
-            collision_filter_.AddToCollisionClique(encoding1.encoding(),
-                                                   clique);
+              encoding1.encoding() != encoding2.encoding()) {
+            collision_filter_.ExcludePair(encoding1.encoding(),
+                                          encoding2.encoding());
           }
         }
       }
@@ -1049,10 +1444,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       unordered_map<GeometryId, unique_ptr<CollisionObjectd>>* mesh_objects) {
     ReifyData data{nullptr, id, props};
     shape.Reify(this, &data);
-    MeshIdentifier mesh_identifier;
-    shape.Reify(&mesh_identifier);
 
-    if (!mesh_identifier.is_mesh()) {
+    if (!data.is_mesh_bounding_box) {
       data.fcl_object->setTransform(X_WG.GetAsIsometry3());
     } else {
       // For a Mesh geometry G, its fcl object is its bounding Box B that has
@@ -1065,7 +1458,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     EncodedData encoding(id, is_dynamic);
     encoding.write_to(data.fcl_object.get());
 
-    if (!mesh_identifier.is_mesh()) {
+    if (!data.is_mesh_bounding_box) {
       tree->registerObject(data.fcl_object.get());
       tree->update();
       (*objects)[id] = std::move(data.fcl_object);
@@ -1114,10 +1507,40 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // TODO(SeanCurtis-TRI): Ultimately, this should probably be a cache entry.
   fcl::DynamicAABBTreeCollisionManager<double> dynamic_tree_;
 
+  // Sets the pose of `object` to X_WG (recomputing its bounding box) and adds
+  // it to `moved_objects`, unless it is already at that exact pose.
+  static void MaybeSetTransform(const RigidTransformd& X_WG,
+                                CollisionObjectd* object,
+                                std::vector<CollisionObjectd*>* moved_objects) {
+    const Eigen::Isometry3d X_WG_isometry = X_WG.GetAsIsometry3();
+    if (object->getTransform().matrix() == X_WG_isometry.matrix()) return;
+    object->setTransform(X_WG_isometry);
+    object->computeAABB();
+    moved_objects->push_back(object);
+  }
+
+  // Refits `tree` to the bounding boxes of its `moved_objects`. When most of
+  // the objects moved, refitting the whole tree at once is cheaper than
+  // updating them one by one.
+  static void UpdateTree(const std::vector<CollisionObjectd*>& moved_objects,
+                         fcl::DynamicAABBTreeCollisionManager<double>* tree) {
+    if (moved_objects.empty()) return;
+    if (2 * moved_objects.size() > tree->size()) {
+      tree->update();
+    } else {
+      tree->update(moved_objects);
+    }
+  }
+
   // All of the *dynamic* collision elements (spanning all sources).
   unordered_map<GeometryId, unique_ptr<CollisionObjectd>> dynamic_objects_;
 
   // The tree containing all of the anchored geometry.
+  // TODO(DamrongGuoy): Consider precomputing signed distance fields for
+  //  anchored geometries once Mesh participates in the point-distance and
+  //  signed-distance queries. Today, the anchored geometries reaching those
+  //  queries are primitives (and Convex), whose closed-form or GJK distances
+  //  are already cheaper than a trilinear lookup in a voxel grid.
   fcl::DynamicAABBTreeCollisionManager<double> anchored_tree_;
 
   // All of the *anchored* collision elements (spanning *all* sources).
@@ -1130,6 +1553,15 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // The number of threads used by the queries that support parallel
+  // evaluation. @see ProximityEngine::set_num_threads() for more details.
+  int num_threads_{1};
+
+  // Whether the collision queries collect statistics, and the statistics of
+  // the last one. @see ProximityEngine::set_collect_statistics().
+  bool collect_statistics_{false};
+  mutable ProximityQueryStatistics statistics_;
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
@@ -1163,6 +1595,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   fcl::DynamicAABBTreeCollisionManager<double> anchored_mesh_tree_;
   unordered_map<GeometryId, unique_ptr<CollisionObjectd>>
       anchored_mesh_objects_;
+
+  // The exception to the above are the meshes with a convex approximation
+  // (see AddMeshApproximation()). Their fcl::Convex is in the main trees, and
+  // participates in all proximity queries. The approximations are computed
+  // once per file name, scale, and kind of approximation, and their vertices
+  // and faces are shared by the fcl::Convex objects of those meshes.
+  std::map<std::tuple<std::string, double, MeshApproximation>, ConvexData>
+      mesh_approximations_;
 };
 
 template <typename T>
@@ -1258,6 +1698,32 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_num_threads(int num_threads) {
+  impl_->set_num_threads(num_threads);
+}
+
+template <typename T>
+void ProximityEngine<T>::set_collect_statistics(bool collect_statistics) {
+  impl_->set_collect_statistics(collect_statistics);
+}
+
+template <typename T>
+bool ProximityEngine<T>::collect_statistics() const {
+  return impl_->collect_statistics();
+}
+
+template <typename T>
+const ProximityQueryStatistics& ProximityEngine<T>::last_query_statistics()
+    const {
+  return impl_->last_query_statistics();
+}
+
+template <typename T>
+int ProximityEngine<T>::num_threads() const {
+  return impl_->num_threads();
+}
+
 template <typename T>
 std::unique_ptr<ProximityEngine<AutoDiffXd>> ProximityEngine<T>::ToAutoDiffXd()
     const {
@@ -1297,6 +1763,15 @@ ProximityEngine<T>::ComputeSignedDistanceToPoint(
   return impl_->ComputeSignedDistanceToPoint(query, X_WGs, threshold);
 }
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<T>>>
+ProximityEngine<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs,
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const double threshold) const {
+  return impl_->ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+}
+
 template <typename T>
 bool ProximityEngine<T>::HasCollisions() const {
   return impl_->HasCollisions();
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -33,6 +35,37 @@ namespace internal {
 class GeometryStateCollisionFilterAttorney;
 #endif
 
+/* The cost of the last collision query evaluated by a ProximityEngine that
+ collects statistics, see ProximityEngine::set_collect_statistics(). All times
+ are wall clock times, in seconds.  */
+struct ProximityQueryStatistics {
+  /* The narrowphase cost of the candidate pairs with the same shape types.  */
+  struct ShapePairStatistics {
+    /* The number of candidate pairs (including the filtered ones).  */
+    int num_pairs{0};
+    /* The time spent in the narrowphase of those pairs.  */
+    double narrowphase_time{0};
+  };
+
+  /* The number of geometry pairs reported by the broadphase, before collision
+   filtering.  */
+  int num_broadphase_candidates{0};
+
+  /* The time spent traversing the broadphase trees.  */
+  double broadphase_time{0};
+
+  /* The time spent in the narrowphase (including collision filtering) of all
+   candidate pairs. When the narrowphase is evaluated on several threads, this
+   is the sum of the times spent by each thread.  */
+  double narrowphase_time{0};
+
+  /* The narrowphase statistics keyed on the pair of shape type names (e.g.,
+   {"Box", "Sphere"}), ordered alphabetically. In the hydroelastic queries,
+   a Mesh is represented by its bounding Box, unless it has a convex
+   approximation (see AddMeshApproximation()), which is a Convex.  */
+  std::map<SortedPair<std::string>, ShapePairStatistics> shape_pairs;
+};
+
 /* The underlying engine for performing geometric _proximity_ queries.
  It owns the geometry instances and, once it has been provided with the poses
  of the geometry, it provides geometric queries on that geometry.
@@ -153,6 +186,38 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Sets the number of threads used to evaluate the narrowphase of the
+   collision queries that support parallel evaluation (currently
+   ComputePointPairPenetration(), ComputeContactSurfaces(), and
+   ComputeContactSurfacesWithFallback()). With the default value of 1, all
+   queries are evaluated on the calling thread. For larger values, the
+   candidate pairs reported by the broadphase are partitioned across the
+   threads and each thread accumulates its own results; the merged results are
+   identical (including their order) to the single-threaded results. The
+   query points of ComputeSignedDistanceToPoints() are partitioned across the
+   threads in the same way.
+   @throws std::exception if `num_threads` is less than one.  */
+  void set_num_threads(int num_threads);
+
+  int num_threads() const;
+
+  /* Enables or disables the collection of statistics by the collision queries
+   (ComputePointPairPenetration(), ComputeContactSurfaces(),
+   ComputeContactSurfacesWithFallback(), and FindCollisionCandidates()). When
+   enabled, each of these queries replaces the last_query_statistics() with
+   its own; the query results are not affected. Collecting statistics adds the
+   cost of timing each candidate pair, and therefore it is disabled by
+   default. Since the statistics are stored in the engine, multiple threads
+   must not evaluate queries on the same engine while collecting statistics.
+   */
+  void set_collect_statistics(bool collect_statistics);
+
+  bool collect_statistics() const;
+
+  /* Returns the statistics of the last collision query evaluated while
+   collecting statistics.  */
+  const ProximityQueryStatistics& last_query_statistics() const;
+
   //@}
 
   /* Updates the poses for all of the _dynamic_ geometries in the engine.
@@ -200,6 +265,14 @@ class ProximityEngine {
       const Vector3<T>& p_WQ,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       const double threshold = std::numeric_limits<double>::infinity()) const;
+
+  /* Implementation of GeometryState::ComputeSignedDistanceToPoints().
+   The points are evaluated in parallel, using num_threads() threads.  */
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const double threshold = std::numeric_limits<double>::infinity()) const;
   //@}
 
 
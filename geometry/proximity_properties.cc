@@ -15,6 +15,9 @@ const char* const kRezHint = "resolution_hint";
 const char* const kComplianceType = "compliance_type";
 const char* const  kSlabThickness = "slab_thickness";
 
+const char* const kMeshGroup = "mesh";
+const char* const kMeshApproximation = "approximation";
+
 std::ostream& operator<<(std::ostream& out, const HydroelasticType& type) {
   switch (type) {
     case HydroelasticType::kUndefined:
@@ -126,5 +129,12 @@ void AddSoftHydroelasticPropertiesForHalfSpace(
   AddSoftHydroelasticProperties(properties);
 }
 
+void AddMeshApproximation(MeshApproximation approximation,
+                          ProximityProperties* properties) {
+  DRAKE_DEMAND(properties);
+  properties->AddProperty(internal::kMeshGroup, internal::kMeshApproximation,
+                          approximation);
+}
+
 }  // namespace geometry
 }  // namespace drake
@@ -69,6 +69,15 @@ extern const char* const kSlabThickness;    ///< Slab thickness property name
 
 //@}
 
+/* @name  Declaring the approximation of Mesh geometries.  */
+//@{
+
+extern const char* const kMeshGroup;          ///< Mesh group name.
+extern const char* const kMeshApproximation;  ///< Mesh approximation property
+                                              ///< name.
+
+//@}
+
 // TODO(SeanCurtis-TRI): Update this to have an additional classification: kBoth
 //  when we have the need from the algorithm. For example: when we have two
 //  very stiff objects, we'd want to process them as soft. But when one
@@ -88,6 +97,15 @@ std::ostream& operator<<(std::ostream& out, const HydroelasticType& type);
 
 }  // namespace internal
 
+/** The convex approximations with which a Mesh geometry can participate in the
+ proximity queries that otherwise ignore meshes, see AddMeshApproximation().  */
+enum class MeshApproximation {
+  /** The convex hull of the vertices of the mesh.  */
+  kConvexHull,
+  /** The axis-aligned bounding box of the mesh, in the frame of the mesh.  */
+  kBoundingBox
+};
+
 /**
  * @anchor contact_material_utility_functions
  * @name         Contact Material Utility Functions
@@ -161,6 +179,14 @@ void AddRigidHydroelasticProperties(ProximityProperties* properties);
  geometry's pressure field will be the function p(e) = Ee, where E is the
  elastic modulus stored in the given `properties`.
 
+ The cost of the contact surface computation grows with the number of
+ tetrahedra in the tessellation, so a coarse `resolution_hint` is preferable
+ for geometries whose contact doesn't need to be resolved finely. The hint of a
+ registered geometry can be changed by assigning it new properties with
+ SceneGraph::AssignRole() and RoleAssign::kReplace; this regenerates the
+ hydroelastic representation, and the contact forces are not continuous across
+ such a change.
+
  @param resolution_hint       If the geometry is to be tessellated, it is the
                               parameter that guides the level of mesh
                               refinement. This will be ignored for geometry
@@ -194,5 +220,30 @@ void AddSoftHydroelasticPropertiesForHalfSpace(double slab_thickness,
 
 //@}
 
+/** Adds a property to the given set of proximity properties that causes an
+ associated Mesh geometry to be represented by the given convex
+ `approximation` in the proximity queries that otherwise ignore meshes (e.g.,
+ QueryObject::ComputePointPairPenetration(),
+ QueryObject::ComputeSignedDistancePairwiseClosestPoints(), and
+ QueryObject::HasCollisions()). Their narrowphase then uses GJK/EPA on the
+ approximation, whose cost does not grow with the number of triangles of the
+ mesh. The hydroelastic representation of the mesh (see
+ AddRigidHydroelasticProperties()) is not affected.
+
+ The approximation is computed when the geometry is registered, once per
+ combination of file name and scale; the meshes that share a file (e.g., the
+ instances of a model) share their approximation. Replacing the proximity
+ properties of a registered geometry does not change its approximation. A
+ Mesh without this property is ignored by those queries. The property has no
+ effect on other shapes.
+
+ @param approximation         The convex approximation of the mesh.
+ @param[in,out] properties    The property will be added to this property set.
+ @throws std::logic_error     If `properties` already has the property that
+                              this function would add.
+ @pre `properties` is not nullptr.  */
+void AddMeshApproximation(MeshApproximation approximation,
+                          ProximityProperties* properties);
+
 }  // namespace geometry
 }  // namespace drake
@@ -159,6 +159,18 @@ QueryObject<T>::ComputeSignedDistanceToPoint(
   return state.ComputeSignedDistanceToPoint(p_WQ, threshold);
 }
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<T>>>
+QueryObject<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs,
+    const double threshold) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeSignedDistanceToPoints(p_WQs, threshold);
+}
+
 template <typename T>
 void QueryObject<T>::RenderColorImage(const CameraProperties& camera,
                                       FrameId parent_frame,
@@ -179,7 +179,8 @@ class QueryObject {
             consistent -- for fixed geometry poses, the results will remain
             the same.
    @warning This silently ignores Mesh geometries (but Convex mesh geometries
-            are included). */
+            are included), unless they have a convex approximation (see
+            AddMeshApproximation()). */
   std::vector<PenetrationAsPointPair<double>> ComputePointPairPenetration()
       const;
 
@@ -243,11 +244,19 @@ class QueryObject {
    computation but _ignored_ in the point pair collision query. If a mesh is
    in contact with another shape that _cannot_ be resolved as a contact surface
    (e.g., rigid mesh vs another rigid shape), this computation will throw as
-   there is no fallback functionality for mesh-shape.
+   there is no fallback functionality for mesh-shape, unless the mesh has a
+   convex approximation (see AddMeshApproximation()), on which the fallback
+   point pair is computed.
 
    Because point pairs can only be computed for double-valued systems, this can
    also only support double-valued ContactSurface instances.
 
+   Unlike ComputePointPairPenetration(), which reports a single point pair for
+   each penetrating pair of geometries, the fallback reports the penetration
+   between two boxes as up to four point pairs, one for each point of their
+   contact manifold (e.g., the corners of the overlap between two faces). This
+   lets a box rest stably on another one, as in a stack of boxes.
+
    The ordering of the _added_ results is guaranteed to be consistent -- for
    fixed geometry poses, the results will remain the same.
 
@@ -270,13 +279,15 @@ class QueryObject {
             remain constant for a fixed population but can change as geometry
             ids are added/removed).
    @warning This silently ignores Mesh geometries (but Convex mesh geometries
-            are included). */
+            are included), unless they have a convex approximation (see
+            AddMeshApproximation()). */
   std::vector<SortedPair<GeometryId>> FindCollisionCandidates() const;
 
   /** Reports true if there are _any_ collisions between unfiltered pairs in the
    world.
    @warning This silently ignores Mesh geometries (but Convex mesh geometries
-            are included). */
+            are included), unless they have a convex approximation (see
+            AddMeshApproximation()). */
   bool HasCollisions() const;
 
   //@}
@@ -457,6 +468,27 @@ class QueryObject {
   ComputeSignedDistanceToPoint(const Vector3<T> &p_WQ,
                                const double threshold
                                = std::numeric_limits<double>::infinity()) const;
+
+  /**
+   Computes the signed distances and gradients to each of the query points
+   from each geometry in the scene. The result for each point is exactly what
+   ComputeSignedDistanceToPoint() reports for it; refer to that method for
+   details. Evaluating many points in a single call, as is common for the
+   samples of a point cloud, avoids the per-call overhead.
+
+   @param[in] p_WQs           The positions of the query points Q in world
+                              frame W, one per column.
+   @param[in] threshold       We ignore any object beyond this distance.
+                              By default, it is infinity, so we report
+                              distances from the query points to every object.
+   @retval signed_distances   A vector with one entry per query point (in
+                              the order of the columns of `p_WQs`), each
+                              populated as by ComputeSignedDistanceToPoint().
+   */
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const double threshold = std::numeric_limits<double>::infinity()) const;
   //@}
 
 
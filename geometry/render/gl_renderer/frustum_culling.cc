@@ -0,0 +1,170 @@
+#include "drake/geometry/render/gl_renderer/frustum_culling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+BoundingSphere BoundingSphere::Merge(const BoundingSphere& a,
+                                     const BoundingSphere& b) {
+  if (std::isinf(a.radius)) return a;
+  if (std::isinf(b.radius)) return b;
+  const Vector3<float> p_AB = b.center - a.center;
+  const float distance = p_AB.norm();
+  if (distance + b.radius <= a.radius) return a;
+  if (distance + a.radius <= b.radius) return b;
+  // The merged sphere spans from the far side of `a` to the far side of `b`
+  // along the line through their centers; distance > 0, otherwise one of the
+  // spheres would contain the other.
+  const float radius = 0.5f * (distance + a.radius + b.radius);
+  return {a.center + p_AB * ((radius - a.radius) / distance), radius};
+}
+
+ViewFrustum::ViewFrustum(const Eigen::Matrix4f& X_ClipW) {
+  // A point with homogeneous clip coordinates c = X_ClipW * (p_W, 1) is inside
+  // the frustum if -c.w <= c.x, c.y, c.z <= c.w. Each of the six inequalities
+  // is a plane in the world frame (Gribb and Hartmann, "Fast Extraction of
+  // Viewing Frustum Planes from the World-View-Projection Matrix").
+  const Vector4<float> w = X_ClipW.row(3).transpose();
+  for (int i = 0; i < 3; ++i) {
+    const Vector4<float> r = X_ClipW.row(i).transpose();
+    planes_[2 * i] = w + r;
+    planes_[2 * i + 1] = w - r;
+  }
+  for (Vector4<float>& plane : planes_) {
+    plane /= plane.head<3>().norm();
+  }
+}
+
+ViewFrustum::Containment ViewFrustum::Classify(
+    const BoundingSphere& sphere) const {
+  if (std::isinf(sphere.radius)) return kIntersecting;
+  Containment result = kInside;
+  for (const Vector4<float>& plane : planes_) {
+    const float distance = plane.head<3>().dot(sphere.center) + plane(3);
+    if (distance < -sphere.radius) return kOutside;
+    if (distance < sphere.radius) result = kIntersecting;
+  }
+  return result;
+}
+
+void BoundingSphereTree::Rebuild(const std::vector<BoundingSphere>& leaves) {
+  nodes_.clear();
+  leaf_nodes_.assign(leaves.size(), -1);
+  if (leaves.empty()) return;
+  nodes_.reserve(2 * leaves.size() - 1);
+  std::vector<int> order(leaves.size());
+  std::iota(order.begin(), order.end(), 0);
+  Build(leaves, -1, 0, static_cast<int>(leaves.size()), &order);
+}
+
+int BoundingSphereTree::Build(const std::vector<BoundingSphere>& leaves,
+                              int parent, int begin, int end,
+                              std::vector<int>* order) {
+  const int node = static_cast<int>(nodes_.size());
+  nodes_.push_back({});
+  nodes_[node].parent = parent;
+  if (end - begin == 1) {
+    const int leaf = (*order)[begin];
+    nodes_[node].sphere = leaves[leaf];
+    nodes_[node].leaf = leaf;
+    leaf_nodes_[leaf] = node;
+    return node;
+  }
+
+  // Split the leaves at the median of their centers along the axis in which
+  // the centers are most spread out.
+  Vector3<float> lower = Vector3<float>::Constant(
+      std::numeric_limits<float>::infinity());
+  Vector3<float> upper = -lower;
+  for (int i = begin; i < end; ++i) {
+    const Vector3<float>& center = leaves[(*order)[i]].center;
+    lower = lower.cwiseMin(center);
+    upper = upper.cwiseMax(center);
+  }
+  int axis;
+  (upper - lower).maxCoeff(&axis);
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(order->begin() + begin, order->begin() + middle,
+                   order->begin() + end, [&leaves, axis](int a, int b) {
+                     return leaves[a].center(axis) < leaves[b].center(axis);
+                   });
+
+  const int left = Build(leaves, node, begin, middle, order);
+  const int right = Build(leaves, node, middle, end, order);
+  nodes_[node].left = left;
+  nodes_[node].right = right;
+  nodes_[node].sphere =
+      BoundingSphere::Merge(nodes_[left].sphere, nodes_[right].sphere);
+  return node;
+}
+
+void BoundingSphereTree::UpdateLeaf(int index, const BoundingSphere& sphere) {
+  DRAKE_ASSERT(0 <= index && index < num_leaves());
+  int node = leaf_nodes_[index];
+  nodes_[node].sphere = sphere;
+  for (node = nodes_[node].parent; node >= 0; node = nodes_[node].parent) {
+    Node& parent = nodes_[node];
+    parent.sphere = BoundingSphere::Merge(nodes_[parent.left].sphere,
+                                          nodes_[parent.right].sphere);
+  }
+}
+
+void BoundingSphereTree::Cull(const std::vector<ViewFrustum>& frustums,
+                              std::vector<bool>* visible) const {
+  DRAKE_DEMAND(visible != nullptr);
+  visible->assign(leaf_nodes_.size(), false);
+  if (nodes_.empty()) return;
+  std::vector<int> active(frustums.size());
+  std::iota(active.begin(), active.end(), 0);
+  Cull(0, frustums, active, visible);
+}
+
+void BoundingSphereTree::Cull(int node,
+                              const std::vector<ViewFrustum>& frustums,
+                              const std::vector<int>& active,
+                              std::vector<bool>* visible) const {
+  // The children of a node are inside its sphere, so they are outside of the
+  // frustums that it is outside of, and inside of those that it is inside of.
+  std::vector<int> intersecting;
+  for (int i : active) {
+    switch (frustums[i].Classify(nodes_[node].sphere)) {
+      case ViewFrustum::kInside:
+        MarkVisible(node, visible);
+        return;
+      case ViewFrustum::kIntersecting:
+        intersecting.push_back(i);
+        break;
+      case ViewFrustum::kOutside:
+        break;
+    }
+  }
+  if (intersecting.empty()) return;
+  if (nodes_[node].leaf >= 0) {
+    (*visible)[nodes_[node].leaf] = true;
+    return;
+  }
+  Cull(nodes_[node].left, frustums, intersecting, visible);
+  Cull(nodes_[node].right, frustums, intersecting, visible);
+}
+
+void BoundingSphereTree::MarkVisible(int node,
+                                     std::vector<bool>* visible) const {
+  if (nodes_[node].leaf >= 0) {
+    (*visible)[nodes_[node].leaf] = true;
+    return;
+  }
+  MarkVisible(nodes_[node].left, visible);
+  MarkVisible(nodes_[node].right, visible);
+}
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+/* A sphere that encloses some geometry. A sphere with infinite radius encloses
+ everything (its center is meaningless).  */
+struct BoundingSphere {
+  /* Reports the smallest sphere that encloses both `a` and `b`.  */
+  static BoundingSphere Merge(const BoundingSphere& a, const BoundingSphere& b);
+
+  Vector3<float> center{0, 0, 0};
+  float radius{std::numeric_limits<float>::infinity()};
+};
+
+/* The view frustum of a camera, as the six planes bounding the volume that
+ the camera can see. It is computed from the matrix that maps a point in the
+ world frame to the camera's OpenGL clip coordinates (i.e., its projection
+ matrix times its view matrix), so it agrees exactly with OpenGL's clipping.  */
+class ViewFrustum {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ViewFrustum)
+
+  /* How a bounding volume relates to the frustum.  */
+  enum Containment { kOutside, kIntersecting, kInside };
+
+  /* Constructs the frustum of the given world-to-clip-coordinate matrix, for
+   clip coordinates whose depth ranges from -1 to 1.  */
+  explicit ViewFrustum(const Eigen::Matrix4f& X_ClipW);
+
+  /* Classifies the given sphere, measured and expressed in the world frame.
+   The classification is conservative: a sphere near a corner of the frustum
+   could be reported as kIntersecting while lying outside of it.  */
+  Containment Classify(const BoundingSphere& sphere) const;
+
+ private:
+  // Each plane is (n, d) with unit normal n pointing into the frustum; the
+  // signed distance of a point p_W from it is n⋅p_W + d.
+  std::array<Vector4<float>, 6> planes_;
+};
+
+/* A bounding volume hierarchy of spheres, for culling the geometries of a
+ scene that are outside of the view frustums of a set of cameras. Each leaf
+ bounds one geometry, identified by its index in the spheres passed to
+ Rebuild(). Moving a geometry only refits the spheres of its leaf's ancestors
+ (see UpdateLeaf()), so the tree can be kept up to date as the geometries
+ move. The tree was built for the initial positions, though; if the geometries
+ move far apart, culling stays correct but becomes less effective, until the
+ next Rebuild().  */
+class BoundingSphereTree {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BoundingSphereTree)
+
+  BoundingSphereTree() = default;
+
+  /* Rebuilds the tree with one leaf per sphere in `leaves`.  */
+  void Rebuild(const std::vector<BoundingSphere>& leaves);
+
+  /* Replaces the sphere of the leaf with the given `index` and refits the
+   spheres of its ancestors.
+   @pre 0 <= index < num_leaves().  */
+  void UpdateLeaf(int index, const BoundingSphere& sphere);
+
+  /* Determines which leaves intersect at least one of the given frustums;
+   on return, `visible` has num_leaves() entries, with (*visible)[i] true
+   if leaf i might be visible.  */
+  void Cull(const std::vector<ViewFrustum>& frustums,
+            std::vector<bool>* visible) const;
+
+  int num_leaves() const { return static_cast<int>(leaf_nodes_.size()); }
+
+ private:
+  struct Node {
+    BoundingSphere sphere;
+    int parent{-1};
+    // The children of an internal node; both are -1 for a leaf.
+    int left{-1};
+    int right{-1};
+    // The index of a leaf's sphere; -1 for an internal node.
+    int leaf{-1};
+  };
+
+  // Builds the subtree over leaf indices [begin, end) of `order`, returning
+  // the index of its root node.
+  int Build(const std::vector<BoundingSphere>& leaves, int parent, int begin,
+            int end, std::vector<int>* order);
+
+  // Marks the leaves of the subtree at `node` that intersect one of the
+  // frustums. Only the frustums whose indices are in `active` need testing;
+  // the subtree is wholly inside or outside of the others.
+  void Cull(int node, const std::vector<ViewFrustum>& frustums,
+            const std::vector<int>& active, std::vector<bool>* visible) const;
+
+  // Marks every leaf of the subtree at `node` as visible.
+  void MarkVisible(int node, std::vector<bool>* visible) const;
+
+  // The nodes of the tree; the root (if any) is nodes_[0].
+  std::vector<Node> nodes_;
+  // The node of each leaf, by leaf index.
+  std::vector<int> leaf_nodes_;
+};
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
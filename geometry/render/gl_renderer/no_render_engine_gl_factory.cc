@@ -4,7 +4,22 @@ namespace drake {
 namespace geometry {
 namespace render {
 
-std::unique_ptr<RenderEngine> MakeRenderEngineGl() {
+std::unique_ptr<RenderEngine> MakeRenderEngineGl(RenderEngineGlParams) {
+  throw std::runtime_error(
+      "RenderEngineGl was not compiled. You'll need to use a different render "
+      "engine.");
+}
+
+int GetRenderEngineGlDeviceCount() { return 0; }
+
+RenderEngineGlPool::RenderEngineGlPool(RenderEngineGlParams,
+                                       std::vector<int>) {
+  throw std::runtime_error(
+      "RenderEngineGl was not compiled. You'll need to use a different render "
+      "engine.");
+}
+
+std::unique_ptr<RenderEngine> RenderEngineGlPool::MakeRenderEngine() {
   throw std::runtime_error(
       "RenderEngineGl was not compiled. You'll need to use a different render "
       "engine.");
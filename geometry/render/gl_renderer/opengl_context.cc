@@ -5,11 +5,15 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
-// Note: This is intentionally included here since it's only needed at the
+// Note: These are intentionally included here since they're only needed at the
 // implementation level, and not in a grouping of more generic headers like
 // opengl_includes.h. See opengl_context.h for where pimpl is applied.
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
 #include <GL/glx.h>
+#include <fmt/format.h>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
@@ -51,6 +55,31 @@ GLXContext glXCreateContextAttribsARB(
           dpy, config, share_context, direct, attrib_list);
 }
 
+// Looks up the EGL extension function with the given name and function
+// pointer type. Returns nullptr if the extension is unavailable.
+template <class F>
+F GetEglFunction(const char* func_name) {
+  return reinterpret_cast<F>(eglGetProcAddress(func_name));
+}
+
+// Returns the GPUs that EGL can create headless contexts on. It is empty if EGL
+// doesn't support device enumeration.
+std::vector<EGLDeviceEXT> QueryEglDevices() {
+  auto query_devices =
+      GetEglFunction<PFNEGLQUERYDEVICESEXTPROC>("eglQueryDevicesEXT");
+  EGLint num_devices = 0;
+  if (query_devices == nullptr ||
+      !query_devices(0, nullptr, &num_devices)) {
+    return {};
+  }
+  std::vector<EGLDeviceEXT> devices(num_devices);
+  if (!query_devices(num_devices, devices.data(), &num_devices)) {
+    return {};
+  }
+  devices.resize(num_devices);
+  return devices;
+}
+
 void GlDebugCallback(GLenum, GLenum type, GLuint, GLenum severity, GLsizei,
                      const GLchar* message, const void*) {
   const char* output =
@@ -66,9 +95,26 @@ void GlDebugCallback(GLenum, GLenum type, GLuint, GLenum severity, GLsizei,
 
 class OpenGlContext::Impl {
  public:
+  // Initialize an OpenGL context: a headless EGL context on the given device
+  // or, if there is none, a GLX context on the X display.
+  Impl(bool debug, std::optional<int> egl_device) {
+    if (egl_device.has_value()) {
+      InitializeEgl(*egl_device);
+    } else {
+      InitializeGlx();
+    }
+
+    // Enable debug.
+    if (debug) {
+      drake::log()->info("Vendor: {}", glGetString(GL_VENDOR));
+      glEnable(GL_DEBUG_OUTPUT);
+      glDebugMessageCallback(GlDebugCallback, 0);
+    }
+  }
+
   // Open an X display and initialize an OpenGL context. The display will be
   // open and ready for offscreen rendering, but no window is visible.
-  explicit Impl(bool debug) {
+  void InitializeGlx() {
     // See Offscreen Rendering section here:
     // https://sidvind.com/index.php?title=Opengl/windowless
 
@@ -163,17 +209,92 @@ class OpenGlContext::Impl {
 
     // Make it the current context.
     MakeCurrent();
+    is_complete = true;
+  }
 
-    // Enable debug.
-    if (debug) {
-      drake::log()->info("Vendor: {}", glGetString(GL_VENDOR));
-      glEnable(GL_DEBUG_OUTPUT);
-      glDebugMessageCallback(GlDebugCallback, 0);
+  // Initialize a headless OpenGL context on the given EGL device. It has no
+  // surface at all; all rendering goes to frame buffer objects.
+  void InitializeEgl(int device) {
+    const std::vector<EGLDeviceEXT> devices = QueryEglDevices();
+    if (device < 0 || device >= static_cast<int>(devices.size())) {
+      throw std::runtime_error(fmt::format(
+          "Error initializing headless OpenGL Context for RenderEngineGL; "
+          "requested EGL device {}, but {} device(s) are available.",
+          device, devices.size()));
+    }
+    auto get_platform_display =
+        GetEglFunction<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            "eglGetPlatformDisplayEXT");
+    if (get_platform_display == nullptr) {
+      throw std::runtime_error(
+          "Error initializing headless OpenGL Context for RenderEngineGL; "
+          "eglGetPlatformDisplayEXT is unavailable.");
+    }
+    // Like the X display, the EGL display is never terminated; terminating it
+    // would invalidate the contexts of all other OpenGlContext instances on
+    // the same device. Initializing an initialized display has no effect.
+    egl_display_ = get_platform_display(EGL_PLATFORM_DEVICE_EXT,
+                                        devices[device], nullptr);
+    if (egl_display_ == EGL_NO_DISPLAY ||
+        !eglInitialize(egl_display_, nullptr, nullptr)) {
+      throw std::runtime_error(fmt::format(
+          "Error initializing headless OpenGL Context for RenderEngineGL; "
+          "failed to initialize the display of EGL device {}.",
+          device));
     }
+
+    const EGLint kConfigAttribs[] = {EGL_SURFACE_TYPE,
+                                     EGL_PBUFFER_BIT,
+                                     EGL_RED_SIZE,
+                                     8,
+                                     EGL_GREEN_SIZE,
+                                     8,
+                                     EGL_BLUE_SIZE,
+                                     8,
+                                     EGL_ALPHA_SIZE,
+                                     8,
+                                     EGL_DEPTH_SIZE,
+                                     24,
+                                     EGL_RENDERABLE_TYPE,
+                                     EGL_OPENGL_BIT,
+                                     EGL_NONE};
+    EGLConfig config;
+    EGLint num_configs = 0;
+    if (!eglChooseConfig(egl_display_, kConfigAttribs, &config, 1,
+                         &num_configs) ||
+        num_configs < 1) {
+      throw std::runtime_error(
+          "Error initializing headless OpenGL Context for RenderEngineGL; no "
+          "suitable frame buffer configuration found.");
+    }
+
+    // The client API is per-thread state; see MakeCurrent().
+    eglBindAPI(EGL_OPENGL_API);
+    // Request the same version as the GLX context.
+    const EGLint kContextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION, 3,
+                                      EGL_CONTEXT_MINOR_VERSION, 3, EGL_NONE};
+    // This requires a call to eglDestroyContext in the destructor.
+    egl_context_ =
+        eglCreateContext(egl_display_, config, EGL_NO_CONTEXT, kContextAttribs);
+    if (egl_context_ == EGL_NO_CONTEXT) {
+      throw std::runtime_error(
+          "Error initializing headless OpenGL Context for RenderEngineGL; "
+          "failed to create context via eglCreateContext.");
+    }
+    bool is_complete = false;
+    ScopeExit context_guard([this, &is_complete]() {
+      if (!is_complete) eglDestroyContext(egl_display_, egl_context_);
+    });
+
+    MakeCurrent();
     is_complete = true;
   }
 
   ~Impl() {
+    if (is_headless()) {
+      eglDestroyContext(egl_display_, egl_context_);
+      return;
+    }
     glXDestroyContext(display(), context_);
     XWindowAttributes window_attribs;
     XGetWindowAttributes(display(), window_, &window_attribs);
@@ -181,7 +302,18 @@ class OpenGlContext::Impl {
     XDestroyWindow(display(), window_);
   }
 
+  bool is_headless() const { return egl_context_ != EGL_NO_CONTEXT; }
+
   void MakeCurrent() {
+    if (is_headless()) {
+      eglBindAPI(EGL_OPENGL_API);
+      if (eglGetCurrentContext() != egl_context_ &&
+          !eglMakeCurrent(egl_display_, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                          egl_context_)) {
+        throw std::runtime_error("Error making an OpenGL context current");
+      }
+      return;
+    }
     if (glXGetCurrentContext() != context_ &&
         !glXMakeCurrent(display(), window_, context_)) {
       throw std::runtime_error("Error making an OpenGL context current");
@@ -189,6 +321,7 @@ class OpenGlContext::Impl {
   }
 
   void DisplayWindow(const int width, const int height) {
+    if (is_headless()) return;
     if (width != window_width_ || height != window_height_) {
       XResizeWindow(display(), window_, width, height);
       WaitForExposeEvent();
@@ -207,13 +340,14 @@ class OpenGlContext::Impl {
   }
 
   void HideWindow() {
-    if (IsWindowViewable()) {
+    if (!is_headless() && IsWindowViewable()) {
       XUnmapWindow(display(), window_);
       // Unmapping a window provides no events on that window.
     }
   }
 
   bool IsWindowViewable() const {
+    if (is_headless()) return false;
     XWindowAttributes attr;
     const Status status = XGetWindowAttributes(display(), window_, &attr);
 
@@ -228,6 +362,7 @@ class OpenGlContext::Impl {
   }
 
   void UpdateWindow() {
+    if (is_headless()) return;
     XClearWindow(display(), window_);
     glXSwapBuffers(display(), window_);
   }
@@ -273,6 +408,11 @@ class OpenGlContext::Impl {
 
   GLXContext context_{nullptr};
 
+  // The headless context and its display; egl_context_ is EGL_NO_CONTEXT for a
+  // GLX context.
+  EGLDisplay egl_display_{EGL_NO_DISPLAY};
+  EGLContext egl_context_{EGL_NO_CONTEXT};
+
   // The associated window to support display of rendering results.
   Window window_;
   // The window's current size. We default it to an arbitrary 640x480.
@@ -284,13 +424,15 @@ class OpenGlContext::Impl {
   int window_height_{480};
 };
 
-OpenGlContext::OpenGlContext(bool debug)
-    : impl_(new OpenGlContext::Impl(debug)) {}
+OpenGlContext::OpenGlContext(bool debug, std::optional<int> egl_device)
+    : impl_(new OpenGlContext::Impl(debug, egl_device)) {}
 
 OpenGlContext::~OpenGlContext() = default;
 
 void OpenGlContext::MakeCurrent() { impl_->MakeCurrent(); }
 
+bool OpenGlContext::is_headless() const { return impl_->is_headless(); }
+
 void OpenGlContext::DisplayWindow(const int width, const int height) {
   impl_->DisplayWindow(width, height);
 }
@@ -315,6 +457,8 @@ GLint OpenGlContext::max_allowable_texture_size() {
   return OpenGlContext::Impl::max_allowable_texture_size();
 }
 
+int OpenGlContext::num_egl_devices() { return QueryEglDevices().size(); }
+
 }  // namespace internal
 }  // namespace render
 }  // namespace geometry
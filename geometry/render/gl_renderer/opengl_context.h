@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "drake/geometry/render/gl_renderer/opengl_includes.h"
 
@@ -13,15 +14,26 @@ namespace internal {
  This class creates and owns a new context upon construction. Rendering classes
  need to keep their own OpenGlContext and ensure that they switch to it using
  `MakeCurrent()` before any OpenGL calls.
+
+ By default, the context is created with GLX on the X display (and has a window
+ to display images in). Alternatively, it can be created with EGL on a
+ specific GPU without any X server; such a "headless" context has no window.
+ Headless contexts on different GPUs can be used concurrently from different
+ threads, but a context can only be current on one thread at a time, and a
+ thread should not switch between GLX and headless contexts.
  */
 class OpenGlContext {
  public:
-  /* Constructor. Initializes an OpenGL context.
+  /* Constructor. Initializes an OpenGL context and makes it current.
    @param debug  If debug is true, the OpenGl context will be a "debug" context,
    in that the OpenGl implementation's errors will be written to the Drake log.
    See https://www.khronos.org/opengl/wiki/Debug_Output for more information.
-   */
-  explicit OpenGlContext(bool debug = false);
+   @param egl_device  If given, the context is a headless EGL context on the
+   device with this index in [0, num_egl_devices()).
+   @throws std::runtime_error if the context can't be created (including if
+   `egl_device` is not a valid device index).  */
+  explicit OpenGlContext(bool debug = false,
+                         std::optional<int> egl_device = std::nullopt);
 
   ~OpenGlContext();
 
@@ -29,8 +41,12 @@ class OpenGlContext {
    @throw std::runtime_error if not successful.  */
   void MakeCurrent();
 
+  /* Reports `true` if this is a headless context, i.e., it has no window.  */
+  bool is_headless() const;
+
   /* Displays the window at the given dimensions. Calling this redundantly (on
-   an already visible window of the given size) has no effect.  */
+   an already visible window of the given size) has no effect. Calling this on
+   a headless context has no effect either.  */
   void DisplayWindow(const int width, const int height);
 
   /* Hides the window (if visible). Calling this on a hidden window has no
@@ -56,10 +72,14 @@ class OpenGlContext {
   static GLint max_renderbuffer_size();
   static GLint max_allowable_texture_size();
 
+  /* Returns the number of GPUs available for headless contexts. Returns zero
+   if EGL (or its device enumeration extension) is unavailable.  */
+  static int num_egl_devices();
+
  private:
-  // Note: we are dependent on `GL/glx.h` but don't want to let that bleed into
-  // other code. So, we pimpl this up so that glx.h lives only in the
-  // implementation.
+  // Note: we are dependent on `GL/glx.h` and `EGL/egl.h` but don't want to let
+  // that bleed into other code. So, we pimpl this up so that they live only in
+  // the implementation.
   class Impl;
 
   std::unique_ptr<Impl> impl_;
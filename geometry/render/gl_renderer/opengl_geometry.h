@@ -2,6 +2,7 @@
 
 #include <limits>
 
+#include "drake/geometry/render/gl_renderer/frustum_culling.h"
 #include "drake/geometry/render/gl_renderer/opengl_includes.h"
 #include "drake/geometry/render/render_label.h"
 #include "drake/math/rigid_transform.h"
@@ -69,6 +70,14 @@ struct OpenGlGeometry {
   GLuint index_buffer{kInvalid};
   int index_buffer_size{0};
 
+  /* True if the vertex buffer includes meaningful texture coordinates. If
+   false, the texture coordinates in the vertex buffer are all zero.  */
+  bool has_tex_coord{false};
+
+  /* A sphere that encloses the geometry's vertices, measured and expressed in
+   the geometry's frame. The default (infinite) sphere is never culled.  */
+  BoundingSphere bounds;
+
   /* The value of an object (array, buffer) that should be considered invalid.
    */
   static constexpr GLuint kInvalid = std::numeric_limits<GLuint>::max();
@@ -97,6 +106,13 @@ struct OpenGlInstance {
   math::RigidTransformd X_WG;
   Vector3<double> scale;
   RenderLabel label;
+
+  /* The instance's material for color images: its rgba diffuse color, and the
+   OpenGl texture object of its diffuse map (with its texture coordinate
+   scale). If `diffuse_map` is zero, the diffuse color is used instead.  */
+  Vector4<float> diffuse{1, 1, 1, 1};
+  GLuint diffuse_map{0};
+  Vector2<float> diffuse_scale{1, 1};
 };
 
 }  // namespace internal
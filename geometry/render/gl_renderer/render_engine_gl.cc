@@ -1,12 +1,25 @@
 #include "drake/geometry/render/gl_renderer/render_engine_gl.h"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include <fmt/format.h>
+#include <png.h>
+
+#include "drake/common/text_logging.h"
 
 namespace drake {
 namespace geometry {
 namespace render {
 
+using Eigen::Vector2d;
 using Eigen::Vector3d;
+using Eigen::Vector4d;
+using internal::BoundingSphere;
 using internal::BufferDim;
 using internal::MeshData;
 using internal::OpenGlContext;
@@ -14,6 +27,7 @@ using internal::OpenGlGeometry;
 using internal::OpenGlInstance;
 using internal::RenderTarget;
 using internal::ShaderProgram;
+using internal::ViewFrustum;
 using math::RigidTransformd;
 using std::make_shared;
 using std::string;
@@ -32,6 +46,18 @@ namespace {
 const float kGlZNear = 0.01;
 const float kGlZFar = 10.0;
 
+// The vertex attribute locations (and buffer binding points) of the vertex
+// data, and the binding point of the per-instance attributes, whose first
+// location is kModelMatrixLocation. These must match the vertex shaders.
+const int kPositionLocation = 0;
+const int kNormalLocation = 1;
+const int kUvLocation = 2;
+const int kInstanceBinding = 3;
+const int kModelMatrixLocation = 3;  // A mat4 occupies four locations.
+const int kEncodedLabelLocation = 7;
+const int kDiffuseLocation = 8;
+const int kUvScaleLocation = 9;
+
 // Data to pass through the reification process.
 struct RegistrationData {
   const GeometryId id;
@@ -39,11 +65,118 @@ struct RegistrationData {
   const PerceptionProperties& properties;
 };
 
+// Computes the OpenGL projection matrix for the given camera and clipping
+// planes.
+Eigen::Matrix4f CalcGlProjectionMatrix(const CameraProperties& camera,
+                                       double clip_near, double clip_far) {
+  DRAKE_ASSERT(clip_far > clip_near);
+  const float inverse_frustum_depth = 1 / (clip_far - clip_near);
+  // https://unspecified.wordpress.com/2012/06/21/calculating-the-gluperspective-matrix-and-other-opengl-matrix-maths/
+  // An OpenGL projection matrix maps points in a camera coordinate to a "clip
+  // coordinate", in which the projection step maps a 3D point into 2D
+  // normalized device coordinate (NDC). Effectively, image corners are mapped
+  // into a square from -1 to 1 in NDC. Hence, the clip coordinate is
+  // essentially a scaled version of the camera coordinate, where the camera
+  // image frustum is scaled into a "square" frustum.
+  //
+  // Because the xy elements of the image corner [f*w/2, f*h/2] is mapped to
+  // [fx*f*w/2, fy*f*h/2] in the "square" clip coordinate by the OpenGL
+  // projection matrix P, we have: fx*f*w/2 == fy*f*h/2, i.e. fx*w == fy*h.
+
+  const float fy = 1.0f / static_cast<float>(tan(camera.fov_y * 0.5));
+  const float fx = fy * camera.height / camera.width;
+  const float A = -(clip_near + clip_far) * inverse_frustum_depth;
+  const float B = -2.0f * clip_near * clip_far * inverse_frustum_depth;
+  Eigen::Matrix4f P;
+  // Eigen matrices are col-major, similar to OpenGL.
+  // clang-format off
+  P << fx, 0.0,  0.0, 0.0,
+      0.0, fy,   0.0, 0.0,
+      0.0, 0.0,    A,   B,
+      0.0, 0.0, -1.0, 0.0;
+  // clang-format on
+  return P;
+}
+
+// Our camera frame C wrt the OpenGL's camera frame Cgl.
+const Eigen::Matrix4f& X_CglC() {
+  static const Eigen::Matrix4f kX_CglC =
+      (Eigen::Matrix4f() << 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1)
+          .finished();
+  return kX_CglC;
+}
+
+// Partitions the image requests into groups that can be rendered into a single
+// layered render target: each group has at most kMaxLayers requests, all of
+// whose cameras have the same image size. The groups (and the requests within
+// each group) preserve the order of `requests`.
+template <typename Request, int kMaxLayers>
+std::vector<std::pair<BufferDim, std::vector<const Request*>>> GroupRequests(
+    const std::vector<Request>& requests) {
+  std::vector<std::pair<BufferDim, std::vector<const Request*>>> groups;
+  // The index in `groups` of the group still accepting requests of each size.
+  unordered_map<BufferDim, int> open_groups;
+  for (const Request& request : requests) {
+    const BufferDim dim(request.camera.width, request.camera.height);
+    auto iter = open_groups.find(dim);
+    if (iter == open_groups.end() ||
+        static_cast<int>(groups[iter->second].second.size()) == kMaxLayers) {
+      open_groups[dim] = groups.size();
+      groups.emplace_back(dim, std::vector<const Request*>());
+      iter = open_groups.find(dim);
+    }
+    groups[iter->second].second.push_back(&request);
+  }
+  return groups;
+}
+
+// Computes the frustum of the camera with the given intrinsics and clipping
+// planes, whose pose in the world is the inverse of X_CW.
+ViewFrustum CalcViewFrustum(const CameraProperties& camera,
+                            const RigidTransformd& X_CW, double clip_near,
+                            double clip_far) {
+  return ViewFrustum(CalcGlProjectionMatrix(camera, clip_near, clip_far) *
+                     X_CglC() * X_CW.GetAsMatrix4().cast<float>());
+}
+
+// Computes the bounding sphere of the given instance in the world frame. The
+// scale is applied to the geometry's bounding sphere, so a non-uniform scale
+// makes it looser.
+BoundingSphere CalcBoundingSphere(const OpenGlInstance& instance) {
+  const BoundingSphere& bounds_G = instance.geometry.bounds;
+  const Vector3d p_GoBo_G =
+      bounds_G.center.cast<double>().cwiseProduct(instance.scale);
+  return {(instance.X_WG * p_GoBo_G).cast<float>(),
+          bounds_G.radius *
+              static_cast<float>(instance.scale.cwiseAbs().maxCoeff())};
+}
+
+// Uploads `data` to the given OpenGL buffer, creating or growing the buffer
+// as necessary.
+template <typename T>
+void UploadToBuffer(const std::vector<T>& data, GLuint* buffer,
+                    int* buffer_size) {
+  const int num_bytes = data.size() * sizeof(T);
+  if (*buffer == 0) {
+    glCreateBuffers(1, buffer);
+  }
+  if (num_bytes > *buffer_size) {
+    glNamedBufferData(*buffer, num_bytes, data.data(), GL_DYNAMIC_DRAW);
+    *buffer_size = num_bytes;
+  } else {
+    glNamedBufferSubData(*buffer, 0, num_bytes, data.data());
+  }
+}
+
 }  // namespace
 
-RenderEngineGl::RenderEngineGl()
-    : opengl_context_(make_shared<OpenGlContext>()) {
+RenderEngineGl::RenderEngineGl(RenderEngineGlParams params)
+    : opengl_context_(make_shared<OpenGlContext>(false, params.egl_device)),
+      parameters_(params) {
   // Setup shader program.
+  // All of the visuals sharing a geometry are drawn with a single instanced
+  // draw call, so the vertex shaders get each visual's model matrix (and its
+  // other per-visual quantities) as instance attributes.
   // The vertex shader computes two pieces of information per vertex: its
   // transformed position and its depth. Both get linearly interpolated across
   // the rasterized triangle's fragments.
@@ -51,12 +184,13 @@ RenderEngineGl::RenderEngineGl()
 #version 330
 
 layout(location = 0) in vec3 p_Model;
+layout(location = 3) in mat4 model_matrix;
 out float depth;
-uniform mat4 model_view_matrix;
+uniform mat4 view_matrix;
 uniform mat4 projection_matrix;
 
 void main() {
-  vec4 p_Camera = model_view_matrix * vec4(p_Model, 1);
+  vec4 p_Camera = view_matrix * model_matrix * vec4(p_Model, 1);
   depth = -p_Camera.z;
   gl_Position = projection_matrix * p_Camera;
 })""";
@@ -94,17 +228,21 @@ void main() {
     encoded_depth = depth;
 })""";
 
-  // The vertex shader simply transforms the vertices. Strictly speaking, we
-  // could combine modelview and projection matrices into a single transform,
-  // but there's no real value in doing so. Leaving it as is maintains
-  // compatibility with the depth shader.
+  // The vertex shader simply transforms the vertices and passes the instance's
+  // label on. Strictly speaking, we could combine view and projection matrices
+  // into a single transform, but there's no real value in doing so. Leaving it
+  // as is maintains compatibility with the depth shader.
   const std::string kLabelVertexShader = R"""(
 #version 330
 layout(location = 0) in vec3 p_Model;
-uniform mat4 model_view_matrix;
+layout(location = 3) in mat4 model_matrix;
+layout(location = 7) in vec4 instance_label;
+flat out vec4 encoded_label;
+uniform mat4 view_matrix;
 uniform mat4 projection_matrix;
 void main() {
-  vec4 p_Camera = model_view_matrix * vec4(p_Model, 1);
+  vec4 p_Camera = view_matrix * model_matrix * vec4(p_Model, 1);
+  encoded_label = instance_label;
   gl_Position = projection_matrix * p_Camera;
 })""";
 
@@ -112,16 +250,138 @@ void main() {
   // provided label encoded as an RGBA color.
   const std::string kLabelFragmentShader = R"""(
 #version 330
+flat in vec4 encoded_label;
 out vec4 color;
-uniform vec4 encoded_label;
 void main() {
   color = encoded_label;
 })""";
 
+  // The vertex shader passes the vertex position and normal in the camera
+  // frame, the (scaled) texture coordinates, and the instance's diffuse color
+  // on to the fragment shader. Normals transform with the inverse transpose of
+  // the model view matrix's linear part, so that they stay normal under
+  // non-uniform scale.
+  const string kColorVertexShader = R"""(
+#version 330
+layout(location = 0) in vec3 p_Model;
+layout(location = 1) in vec3 n_Model;
+layout(location = 2) in vec2 uv_Model;
+layout(location = 3) in mat4 model_matrix;
+layout(location = 8) in vec4 instance_diffuse;
+layout(location = 9) in vec2 uv_scale;
+out vec3 p_Camera;
+out vec3 n_Camera;
+out vec2 uv;
+flat out vec4 diffuse;
+uniform mat4 view_matrix;
+uniform mat4 projection_matrix;
+void main() {
+  mat4 model_view_matrix = view_matrix * model_matrix;
+  vec4 p_Camera_h = model_view_matrix * vec4(p_Model, 1);
+  p_Camera = p_Camera_h.xyz;
+  n_Camera = transpose(inverse(mat3(model_view_matrix))) * n_Model;
+  uv = uv_Model * uv_scale;
+  diffuse = instance_diffuse;
+  gl_Position = projection_matrix * p_Camera_h;
+})""";
+
+  // The fragment shader applies Lambertian shading from a single light placed
+  // at the camera origin (a "headlight") to either the diffuse color or the
+  // diffuse map's texel. Which side of a triangle faces the camera doesn't
+  // matter.
+  const string kColorFragmentShader = R"""(
+#version 330
+in vec3 p_Camera;
+in vec3 n_Camera;
+in vec2 uv;
+flat in vec4 diffuse;
+out vec4 color;
+uniform bool use_diffuse_map;
+uniform sampler2D diffuse_map;
+void main() {
+  vec4 surface = use_diffuse_map ? texture(diffuse_map, uv) : diffuse;
+  float intensity = abs(dot(normalize(n_Camera), normalize(-p_Camera)));
+  color = vec4(surface.rgb * intensity, 1);
+})""";
+
   shader_programs_[kLabel].LoadFromSources(kLabelVertexShader,
                                            kLabelFragmentShader);
   shader_programs_[kDepth].LoadFromSources(kDepthVertexShader,
                                            kDepthFragmentShader);
+  shader_programs_[kColor].LoadFromSources(kColorVertexShader,
+                                           kColorFragmentShader);
+
+  // The layered shaders render the same scene from up to kMaxBatchLayers
+  // cameras in one pass. The vertex shader only poses the vertex in the world;
+  // the geometry shader emits each triangle once per camera, into the layer of
+  // the render target belonging to that camera.
+  const string kLayeredVertexShader = R"""(
+#version 330
+layout(location = 0) in vec3 p_Model;
+layout(location = 3) in mat4 model_matrix;
+layout(location = 7) in vec4 instance_label;
+out vec4 p_World;
+flat out vec4 vertex_label;
+void main() {
+  p_World = model_matrix * vec4(p_Model, 1);
+  vertex_label = instance_label;
+  gl_Position = p_World;
+})""";
+
+  const string kLayeredGeometryShader =
+      "#version 330\n#define kMaxLayers " + std::to_string(kMaxBatchLayers) +
+      "\n#define kMaxVertices " + std::to_string(3 * kMaxBatchLayers) + R"""(
+layout(triangles) in;
+layout(triangle_strip, max_vertices = kMaxVertices) out;
+in vec4 p_World[];
+flat in vec4 vertex_label[];
+out float depth;
+flat out int layer;
+flat out vec4 encoded_label;
+uniform int num_layers;
+uniform mat4 view_matrices[kMaxLayers];
+uniform mat4 projection_matrices[kMaxLayers];
+void main() {
+  for (int i = 0; i < num_layers; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      vec4 p_Camera = view_matrices[i] * p_World[j];
+      depth = -p_Camera.z;
+      layer = i;
+      encoded_label = vertex_label[j];
+      gl_Layer = i;
+      gl_Position = projection_matrices[i] * p_Camera;
+      EmitVertex();
+    }
+    EndPrimitive();
+  }
+})""";
+
+  // The same encoding as kDepthFragmentShader, with the depth range of the
+  // fragment's camera.
+  const string kLayeredDepthFragmentShader =
+      "#version 330\n#define kMaxLayers " + std::to_string(kMaxBatchLayers) +
+      R"""(
+in float depth;
+flat in int layer;
+layout(location = 0) out float encoded_depth;
+uniform float depth_z_near[kMaxLayers];
+uniform float depth_z_far[kMaxLayers];
+
+void main() {
+  const float pos_infinity = intBitsToFloat(0x7F800000);
+  if (depth < depth_z_near[layer])
+    encoded_depth = 0;
+  else if (depth > depth_z_far[layer])
+    encoded_depth = pos_infinity;
+  else
+    encoded_depth = depth;
+})""";
+
+  layered_shader_programs_[kLabel].LoadFromSources(
+      kLayeredVertexShader, kLayeredGeometryShader, kLabelFragmentShader);
+  layered_shader_programs_[kDepth].LoadFromSources(
+      kLayeredVertexShader, kLayeredGeometryShader,
+      kLayeredDepthFragmentShader);
 }
 
 RenderEngineGl::~RenderEngineGl() = default;
@@ -130,9 +390,27 @@ void RenderEngineGl::UpdateViewpoint(const RigidTransformd& X_WR) {
   X_CW_ = X_WR.inverse();
 }
 
-void RenderEngineGl::RenderColorImage(const CameraProperties&, bool,
-                                      ImageRgba8U*) const {
-  throw std::runtime_error("RenderEngineGl cannot render color images");
+void RenderEngineGl::RenderColorImage(const CameraProperties& camera,
+                                      bool show_window,
+                                      ImageRgba8U* color_image_out) const {
+  const ShaderProgram& shader_program = ActivateShader(ImageType::kColor);
+
+  const RenderTarget target = SetCameraProperties(
+      camera, shader_program, kGlZNear, kGlZFar, ImageType::kColor);
+
+  const Vector3d& clear = parameters_.default_clear_color;
+  float clear_color[4] = {static_cast<float>(clear(0)),
+                          static_cast<float>(clear(1)),
+                          static_cast<float>(clear(2)), 1.f};
+  glClearNamedFramebufferfv(target.frame_buffer, GL_COLOR, 0, &clear_color[0]);
+  RenderAt(shader_program, {&camera, X_CW_, kGlZNear, kGlZFar}, kColor);
+  // See RenderLabelImage() for why this must follow the rendering.
+  SetWindowVisibility(camera, show_window, target);
+  ReadTexture(target, ImageType::kColor,
+              BufferDim(color_image_out->width(), color_image_out->height()),
+              GL_RGBA, GL_UNSIGNED_BYTE,
+              color_image_out->size() * sizeof(GLubyte),
+              color_image_out->at(0, 0));
 }
 
 void RenderEngineGl::RenderDepthImage(const DepthCameraProperties& camera,
@@ -163,10 +441,11 @@ void RenderEngineGl::RenderDepthImage(const DepthCameraProperties& camera,
   glClearNamedFramebufferfv(target.frame_buffer, GL_COLOR, 0,
                             &InvalidDepth::kTooFar);
   // TODO(SeanCurtis-TRI): Make sure RenderAt doesn't clear color buffer.
-  RenderAt(shader_program, X_CW_.GetAsMatrix4().matrix().cast<float>(), kDepth);
-  glGetTextureImage(target.value_texture, 0, GL_RED, GL_FLOAT,
-                    depth_image_out->size() * sizeof(GLfloat),
-                    depth_image_out->at(0, 0));
+  RenderAt(shader_program, {&camera, X_CW_, near_clip, far_clip}, kDepth);
+  ReadTexture(target, ImageType::kDepth,
+              BufferDim(depth_image_out->width(), depth_image_out->height()),
+              GL_RED, GL_FLOAT, depth_image_out->size() * sizeof(GLfloat),
+              depth_image_out->at(0, 0));
 }
 
 void RenderEngineGl::RenderLabelImage(const CameraProperties& camera,
@@ -183,8 +462,7 @@ void RenderEngineGl::RenderLabelImage(const CameraProperties& camera,
                           static_cast<float>(empty_color.g),
                           static_cast<float>(empty_color.b), 1.f};
   glClearNamedFramebufferfv(target.frame_buffer, GL_COLOR, 0, &clear_color[0]);
-  RenderAt(shader_program, X_CW_.GetAsMatrix4().matrix().cast<float>(),
-           kLabel);
+  RenderAt(shader_program, {&camera, X_CW_, kGlZNear, kGlZFar}, kLabel);
   // Note: SetWindowVisibility must be called *after* the rendering; setting the
   // visibility is responsible for taking the target buffer and bringing it to
   // the front buffer; reversing the order means the image we've just rendered
@@ -197,6 +475,80 @@ void RenderEngineGl::RenderLabelImage(const CameraProperties& camera,
   GetLabelImage(label_image_out, target);
 }
 
+void RenderEngineGl::DoRenderImages(const ImageRenderBatch& batch) {
+  // TODO(SeanCurtis-TRI): Render the color images into layered render targets
+  //  as well; this requires a layered version of the color shader program.
+  const RigidTransformd X_CW = X_CW_;
+  for (const ColorImageRequest& request : batch.color_images) {
+    X_CW_ = request.X_WC.inverse();
+    RenderColorImage(request.camera, false, request.image);
+  }
+  X_CW_ = X_CW;
+
+  for (const auto& [dim, requests] :
+       GroupRequests<DepthImageRequest, kMaxBatchLayers>(
+           batch.depth_images)) {
+    const ShaderProgram& shader_program = ActivateLayeredShader(kDepth);
+    std::vector<BatchLayer> layers;
+    std::vector<float> z_near;
+    std::vector<float> z_far;
+    for (const DepthImageRequest* request : requests) {
+      // See RenderDepthImage() for the choice of clipping planes.
+      const DepthCameraProperties& camera = request->camera;
+      layers.push_back({&camera, request->X_WC.inverse(), camera.z_near - 0.1,
+                        camera.z_far + 0.1});
+      z_near.push_back(camera.z_near);
+      z_far.push_back(camera.z_far);
+    }
+    const int num_layers = layers.size();
+    glUniform1fv(shader_program.GetUniformLocation("depth_z_near"), num_layers,
+                 z_near.data());
+    glUniform1fv(shader_program.GetUniformLocation("depth_z_far"), num_layers,
+                 z_far.data());
+
+    const RenderTarget target = GetLayeredRenderTarget(dim, kDepth);
+    // Clearing a layered frame buffer clears all of its layers.
+    glClearNamedFramebufferfv(target.frame_buffer, GL_COLOR, 0,
+                              &InvalidDepth::kTooFar);
+    RenderLayers(shader_program, layers, kDepth);
+    for (int i = 0; i < num_layers; ++i) {
+      ImageDepth32F* depth_image_out = requests[i]->image;
+      glGetTextureSubImage(target.value_texture, 0, 0, 0, i, dim.width(),
+                           dim.height(), 1, GL_RED, GL_FLOAT,
+                           depth_image_out->size() * sizeof(GLfloat),
+                           depth_image_out->at(0, 0));
+    }
+  }
+
+  for (const auto& [dim, requests] :
+       GroupRequests<LabelImageRequest, kMaxBatchLayers>(
+           batch.label_images)) {
+    const ShaderProgram& shader_program = ActivateLayeredShader(kLabel);
+    std::vector<BatchLayer> layers;
+    for (const LabelImageRequest* request : requests) {
+      layers.push_back(
+          {&request->camera, request->X_WC.inverse(), kGlZNear, kGlZFar});
+    }
+
+    const RenderTarget target = GetLayeredRenderTarget(dim, kLabel);
+    const ColorD empty_color =
+        RenderEngine::GetColorDFromLabel(RenderLabel::kEmpty);
+    float clear_color[4] = {static_cast<float>(empty_color.r),
+                            static_cast<float>(empty_color.g),
+                            static_cast<float>(empty_color.b), 1.f};
+    glClearNamedFramebufferfv(target.frame_buffer, GL_COLOR, 0,
+                              &clear_color[0]);
+    RenderLayers(shader_program, layers, kLabel);
+    ImageRgba8U image(dim.width(), dim.height());
+    for (int i = 0; i < static_cast<int>(layers.size()); ++i) {
+      glGetTextureSubImage(target.value_texture, 0, 0, 0, i, dim.width(),
+                           dim.height(), 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                           image.size() * sizeof(GLubyte), image.at(0, 0));
+      DecodeLabelImage(image, requests[i]->image);
+    }
+  }
+}
+
 void RenderEngineGl::ImplementGeometry(const Sphere& sphere, void* user_data) {
   OpenGlGeometry geometry = GetSphere();
   const double r = sphere.radius();
@@ -262,13 +614,21 @@ bool RenderEngineGl::DoRegisterVisual(GeometryId id, const Shape& shape,
 
 void RenderEngineGl::DoUpdateVisualPose(GeometryId id,
                                         const RigidTransformd& X_WG) {
-  visuals_.at(id).X_WG = X_WG;
+  OpenGlInstance& instance = visuals_.at(id);
+  instance.X_WG = X_WG;
+  if (!instances_.layout_dirty) {
+    const int index = instances_.indices.at(id);
+    instances_.attributes[index] = MakeInstanceAttributes(instance);
+    instances_.bounds.UpdateLeaf(index, CalcBoundingSphere(instance));
+    instances_.data_dirty = true;
+  }
 }
 
 bool RenderEngineGl::DoRemoveGeometry(GeometryId id) {
   auto iter = visuals_.find(id);
   if (iter != visuals_.end()) {
     visuals_.erase(iter);
+    instances_.layout_dirty = true;
     return true;
   } else {
     return false;
@@ -280,7 +640,7 @@ unique_ptr<RenderEngine> RenderEngineGl::DoClone() const {
 }
 
 void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
-                              const Eigen::Matrix4f& X_CW,
+                              const BatchLayer& camera,
                               ImageType image_type) const {
   glClipControl(GL_UPPER_LEFT, GL_NEGATIVE_ONE_TO_ONE);
   glEnable(GL_DEPTH_TEST);
@@ -289,28 +649,109 @@ void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
   // appropriate color for an "empty" pixel.
   glClear(GL_DEPTH_BUFFER_BIT);
 
-  for (const auto& pair : visuals_) {
-    const internal::OpenGlInstance& instance = pair.second;
-    glBindVertexArray(instance.geometry.vertex_array);
+  SetGlViewMatrix(shader_program, camera.X_CW.GetAsMatrix4().cast<float>());
+  DrawInstances(shader_program,
+                {CalcViewFrustum(*camera.camera, camera.X_CW, camera.clip_near,
+                                 camera.clip_far)},
+                image_type);
+  // Unbind the vertex array (and texture) back to the default of 0.
+  glBindVertexArray(0);
+  glBindTextureUnit(0, 0);
+  shader_program.Unuse();
+}
 
-    if (image_type == kLabel) {
-      const ColorD color = RenderEngine::GetColorDFromLabel(instance.label);
-      const Vector4<float> encoded_label(color.r, color.g, color.b, 1.f);
-      shader_program.SetUniformValue("encoded_label", encoded_label);
+void RenderEngineGl::DrawInstances(const ShaderProgram& shader_program,
+                                   const std::vector<ViewFrustum>& frustums,
+                                   ImageType image_type) const {
+  UpdateInstances();
+  Instances& instances = instances_;
+  instances.bounds.Cull(frustums, &instances.visible);
+  const int num_visible =
+      std::count(instances.visible.begin(), instances.visible.end(), true);
+  instances.num_culled = instances.attributes.size() - num_visible;
+
+  // Without culling, the batches are drawn straight from the instance buffer.
+  // Otherwise, the visible instances are compacted into the culled buffer;
+  // copying them is much cheaper than drawing the rest.
+  const std::vector<InstanceBatch>* batches = &instances.batches;
+  GLuint buffer = instances.buffer;
+  if (instances.num_culled > 0) {
+    instances.culled_batches.clear();
+    instances.culled_attributes.clear();
+    for (const InstanceBatch& batch : instances.batches) {
+      InstanceBatch culled_batch = batch;
+      culled_batch.first = instances.culled_attributes.size();
+      for (int i = batch.first; i < batch.first + batch.count; ++i) {
+        if (instances.visible[i]) {
+          instances.culled_attributes.push_back(instances.attributes[i]);
+        }
+      }
+      culled_batch.count =
+          instances.culled_attributes.size() - culled_batch.first;
+      if (culled_batch.count > 0) {
+        instances.culled_batches.push_back(culled_batch);
+      }
+    }
+    if (num_visible > 0) {
+      UploadToBuffer(instances.culled_attributes, &instances.culled_buffer,
+                     &instances.culled_buffer_size);
     }
+    batches = &instances.culled_batches;
+    buffer = instances.culled_buffer;
+  }
 
-    Eigen::DiagonalMatrix<float, 4, 4> scale(Vector4<float>(
-        instance.scale(0), instance.scale(1), instance.scale(2), 1.0));
-    // The pose of the geometry in the camera frame is a _scaled_
-    // transform; the geometry gets scaled, then posed in the world, and finally
-    // the camera frame.
-    SetGlModelViewMatrix(
-        shader_program,
-        X_CW * instance.X_WG.GetAsMatrix4().cast<float>() * scale);
-    glDrawElements(GL_TRIANGLES, instance.geometry.index_buffer_size,
-                   GL_UNSIGNED_INT, 0);
-  }
-  // Unbind the vertex array back to the default of 0.
+  for (const InstanceBatch& batch : *batches) {
+    const GLuint vertex_array = batch.geometry.vertex_array;
+    glBindVertexArray(vertex_array);
+    // The vertex array is shared by every engine (and clone) that uses the
+    // geometry, so it gets pointed at this engine's instance buffer each time.
+    glVertexArrayVertexBuffer(vertex_array, kInstanceBinding, buffer,
+                              batch.first * sizeof(InstanceAttributes),
+                              sizeof(InstanceAttributes));
+    if (image_type == kColor) {
+      glUniform1i(shader_program.GetUniformLocation("use_diffuse_map"),
+                  batch.diffuse_map != 0);
+      glBindTextureUnit(0, batch.diffuse_map);
+    }
+    glDrawElementsInstanced(GL_TRIANGLES, batch.geometry.index_buffer_size,
+                            GL_UNSIGNED_INT, 0, batch.count);
+  }
+}
+
+void RenderEngineGl::RenderLayers(const ShaderProgram& shader_program,
+                                  const std::vector<BatchLayer>& layers,
+                                  ImageType image_type) const {
+  const int num_layers = layers.size();
+  DRAKE_DEMAND(num_layers <= kMaxBatchLayers);
+  // The per-camera matrices, each stored as a column-major 4x4 block.
+  Eigen::Matrix<float, 4, Eigen::Dynamic> view_matrices(4, 4 * num_layers);
+  Eigen::Matrix<float, 4, Eigen::Dynamic> projection_matrices(4,
+                                                              4 * num_layers);
+  for (int i = 0; i < num_layers; ++i) {
+    const BatchLayer& layer = layers[i];
+    view_matrices.middleCols<4>(4 * i) =
+        X_CglC() * layer.X_CW.GetAsMatrix4().cast<float>();
+    projection_matrices.middleCols<4>(4 * i) =
+        CalcGlProjectionMatrix(*layer.camera, layer.clip_near, layer.clip_far);
+  }
+  glUniform1i(shader_program.GetUniformLocation("num_layers"), num_layers);
+  glUniformMatrix4fv(shader_program.GetUniformLocation("view_matrices"),
+                     num_layers, GL_FALSE, view_matrices.data());
+  glUniformMatrix4fv(shader_program.GetUniformLocation("projection_matrices"),
+                     num_layers, GL_FALSE, projection_matrices.data());
+
+  glClipControl(GL_UPPER_LEFT, GL_NEGATIVE_ONE_TO_ONE);
+  glEnable(GL_DEPTH_TEST);
+  // As in RenderAt(), only the depth buffer is cleared here; it is a layered
+  // attachment, so this clears every layer.
+  glClear(GL_DEPTH_BUFFER_BIT);
+
+  std::vector<ViewFrustum> frustums;
+  for (const BatchLayer& layer : layers) {
+    frustums.push_back(CalcViewFrustum(*layer.camera, layer.X_CW,
+                                       layer.clip_near, layer.clip_far));
+  }
+  DrawInstances(shader_program, frustums, image_type);
   glBindVertexArray(0);
   shader_program.Unuse();
 }
@@ -319,7 +760,70 @@ void RenderEngineGl::ImplementGeometry(const OpenGlGeometry& geometry,
                                        void* user_data, const Vector3d& scale) {
   const RegistrationData& data = *static_cast<RegistrationData*>(user_data);
   const RenderLabel label = GetRenderLabelOrThrow(data.properties);
-  visuals_.emplace(data.id, OpenGlInstance(geometry, data.X_WG, scale, label));
+  OpenGlInstance instance(geometry, data.X_WG, scale, label);
+
+  instance.diffuse = data.properties
+                         .GetPropertyOrDefault("phong", "diffuse",
+                                               parameters_.default_diffuse)
+                         .cast<float>();
+  const string& diffuse_map_name =
+      data.properties.GetPropertyOrDefault<string>("phong", "diffuse_map", "");
+  if (!diffuse_map_name.empty()) {
+    if (!geometry.has_tex_coord) {
+      log()->warn(
+          "Requested diffuse map {} applied to a geometry without texture "
+          "coordinates; using the diffuse color instead",
+          diffuse_map_name);
+    } else {
+      instance.diffuse_map = GetTexture(diffuse_map_name);
+      instance.diffuse_scale = data.properties
+                                   .GetPropertyOrDefault("phong",
+                                                         "diffuse_scale",
+                                                         Vector2d{1, 1})
+                                   .cast<float>();
+    }
+  }
+  visuals_.emplace(data.id, instance);
+  instances_.layout_dirty = true;
+}
+
+GLuint RenderEngineGl::GetTexture(const string& filename) {
+  auto iter = textures_.find(filename);
+  if (iter != textures_.end()) {
+    return iter->second;
+  }
+
+  png_image image;
+  std::memset(&image, 0, sizeof(image));
+  image.version = PNG_IMAGE_VERSION;
+  std::vector<png_byte> pixels;
+  bool success = png_image_begin_read_from_file(&image, filename.c_str());
+  if (success) {
+    image.format = PNG_FORMAT_RGBA;
+    pixels.resize(PNG_IMAGE_SIZE(image));
+    // The negative row stride stores the image bottom row first, matching
+    // OpenGL's texture coordinates (where the v-axis points up).
+    success = png_image_finish_read(&image, nullptr, pixels.data(),
+                                    -PNG_IMAGE_ROW_STRIDE(image), nullptr);
+  }
+  png_image_free(&image);
+  if (!success) {
+    log()->warn("Requested diffuse map could not be read: {}", filename);
+    // Don't cache the failure, so that a file that appears later is loaded.
+    return 0;
+  }
+
+  GLuint texture;
+  glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+  glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_REPEAT);
+  glTextureStorage2D(texture, 1, GL_RGBA8, image.width, image.height);
+  glTextureSubImage2D(texture, 0, 0, 0, image.width, image.height, GL_RGBA,
+                      GL_UNSIGNED_BYTE, pixels.data());
+  textures_.insert({filename, texture});
+  return texture;
 }
 
 OpenGlGeometry RenderEngineGl::GetSphere() {
@@ -404,6 +908,14 @@ const internal::ShaderProgram& RenderEngineGl::ActivateShader(
   return program;
 }
 
+const internal::ShaderProgram& RenderEngineGl::ActivateLayeredShader(
+    ImageType image_type) const {
+  opengl_context_->MakeCurrent();
+  const ShaderProgram& program = layered_shader_programs_[image_type];
+  program.Use();
+  return program;
+}
+
 std::tuple<GLint, GLenum, GLenum> RenderEngineGl::get_texture_format(
     ImageType image_type) {
   switch (image_type) {
@@ -412,6 +924,8 @@ std::tuple<GLint, GLenum, GLenum> RenderEngineGl::get_texture_format(
     case kLabel:
       // TODO(SeanCurtis-TRI): Ultimately, this should be a 16-bit, signed int.
       return std::make_tuple(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE);
+    case kColor:
+      return std::make_tuple(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE);
     case kTypeCount:
       // Not an actionable type; merely included for enum completeness.
       break;
@@ -471,60 +985,204 @@ RenderTarget RenderEngineGl::CreateRenderTarget(const CameraProperties& camera,
   return target;
 }
 
+RenderTarget RenderEngineGl::CreateLayeredRenderTarget(const BufferDim& dim,
+                                                       ImageType image_type) {
+  RenderTarget target;
+  glCreateFramebuffers(1, &target.frame_buffer);
+
+  // Attaching a whole texture array (rather than one of its layers) makes the
+  // attachment layered; the geometry shader's gl_Layer selects the layer.
+  const GLint internal_format = std::get<0>(get_texture_format(image_type));
+  glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &target.value_texture);
+  glTextureParameteri(target.value_texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTextureParameteri(target.value_texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTextureParameteri(target.value_texture, GL_TEXTURE_WRAP_S,
+                      GL_CLAMP_TO_EDGE);
+  glTextureParameteri(target.value_texture, GL_TEXTURE_WRAP_T,
+                      GL_CLAMP_TO_EDGE);
+  glTextureStorage3D(target.value_texture, 1, internal_format, dim.width(),
+                     dim.height(), kMaxBatchLayers);
+  glNamedFramebufferTexture(target.frame_buffer, GL_COLOR_ATTACHMENT0,
+                            target.value_texture, 0);
+
+  // All attachments of a layered frame buffer must be layered, so the z buffer
+  // is a depth texture array instead of a render buffer.
+  glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &target.z_buffer);
+  glTextureStorage3D(target.z_buffer, 1, GL_DEPTH_COMPONENT24, dim.width(),
+                     dim.height(), kMaxBatchLayers);
+  glNamedFramebufferTexture(target.frame_buffer, GL_DEPTH_ATTACHMENT,
+                            target.z_buffer, 0);
+
+  GLenum status =
+      glCheckNamedFramebufferStatus(target.frame_buffer, GL_FRAMEBUFFER);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    throw std::runtime_error("Layered FBO creation failed.");
+  }
+
+  GLenum buffer = GL_COLOR_ATTACHMENT0;
+  glNamedFramebufferDrawBuffers(target.frame_buffer, 1, &buffer);
+
+  return target;
+}
+
+RenderTarget RenderEngineGl::GetLayeredRenderTarget(
+    const BufferDim& dim, ImageType image_type) const {
+  std::unordered_map<BufferDim, RenderTarget>& frame_buffers =
+      layered_frame_buffers_[image_type];
+  auto iter = frame_buffers.find(dim);
+  if (iter == frame_buffers.end()) {
+    iter =
+        frame_buffers.insert({dim, CreateLayeredRenderTarget(dim, image_type)})
+            .first;
+  }
+  const RenderTarget& target = iter->second;
+  glBindFramebuffer(GL_FRAMEBUFFER, target.frame_buffer);
+  glViewport(0, 0, dim.width(), dim.height());
+  return target;
+}
+
 void RenderEngineGl::SetGlProjectionMatrix(const ShaderProgram& shader_program,
                                            const CameraProperties& camera,
                                            double clip_near,
                                            double clip_far) const {
-  DRAKE_ASSERT(clip_far > clip_near);
-  const float inverse_frustum_depth = 1 / (clip_far - clip_near);
-  // https://unspecified.wordpress.com/2012/06/21/calculating-the-gluperspective-matrix-and-other-opengl-matrix-maths/
-  // An OpenGL projection matrix maps points in a camera coordinate to a "clip
-  // coordinate", in which the projection step maps a 3D point into 2D
-  // normalized device coordinate (NDC). Effectively, image corners are mapped
-  // into a square from -1 to 1 in NDC. Hence, the clip coordinate is
-  // essentially a scaled version of the camera coordinate, where the camera
-  // image frustum is scaled into a "square" frustum.
-  //
-  // Because the xy elements of the image corner [f*w/2, f*h/2] is mapped to
-  // [fx*f*w/2, fy*f*h/2] in the "square" clip coordinate by the OpenGL
-  // projection matrix P, we have: fx*f*w/2 == fy*f*h/2, i.e. fx*w == fy*h.
-
-  const float fy = 1.0f / static_cast<float>(tan(camera.fov_y * 0.5));
-  const float fx = fy * camera.height / camera.width;
-  const float A = -(clip_near + clip_far) * inverse_frustum_depth;
-  const float B = -2.0f * clip_near * clip_far * inverse_frustum_depth;
-  Eigen::Matrix4f P;
-  // Eigen matrices are col-major, similar to OpenGL.
-  // clang-format off
-  P << fx, 0.0,  0.0, 0.0,
-      0.0, fy,   0.0, 0.0,
-      0.0, 0.0,    A,   B,
-      0.0, 0.0, -1.0, 0.0;
-  // clang-format on
+  const Eigen::Matrix4f P = CalcGlProjectionMatrix(camera, clip_near, clip_far);
   auto projection_matrix_id =
       shader_program.GetUniformLocation("projection_matrix");
   glUniformMatrix4fv(projection_matrix_id, 1, GL_FALSE, P.data());
 }
 
-void RenderEngineGl::SetGlModelViewMatrix(const ShaderProgram& shader_program,
-                                          const Eigen::Matrix4f& X_CM) const {
-  auto model_view_matrix_id =
-      shader_program.GetUniformLocation("model_view_matrix");
+void RenderEngineGl::SetGlViewMatrix(const ShaderProgram& shader_program,
+                                     const Eigen::Matrix4f& X_CW) const {
+  auto view_matrix_id = shader_program.GetUniformLocation("view_matrix");
 
-  // Our camera frame C wrt the OpenGL's camera frame Cgl.
-  static const Eigen::Matrix4f kX_CglC =
-      (Eigen::Matrix4f() << 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1)
-          .finished();
+  Eigen::Matrix4f X_CglW = X_CglC() * X_CW;
+  glUniformMatrix4fv(view_matrix_id, 1, GL_FALSE, X_CglW.data());
+}
 
-  Eigen::Matrix4f X_CglM = kX_CglC * X_CM;
-  glUniformMatrix4fv(model_view_matrix_id, 1, GL_FALSE, X_CglM.data());
+RenderEngineGl::InstanceAttributes RenderEngineGl::MakeInstanceAttributes(
+    const OpenGlInstance& instance) {
+  InstanceAttributes attributes;
+  // The pose of the geometry in the world frame is a _scaled_ transform; the
+  // geometry gets scaled, then posed in the world.
+  Eigen::DiagonalMatrix<float, 4, 4> scale(Vector4<float>(
+      instance.scale(0), instance.scale(1), instance.scale(2), 1.0));
+  Eigen::Map<Eigen::Matrix4f>(attributes.X_WM) =
+      instance.X_WG.GetAsMatrix4().cast<float>() * scale;
+  const ColorD color = RenderEngine::GetColorDFromLabel(instance.label);
+  Eigen::Map<Vector4<float>>(attributes.encoded_label) =
+      Vector4<float>(color.r, color.g, color.b, 1.f);
+  Eigen::Map<Vector4<float>>(attributes.diffuse) = instance.diffuse;
+  Eigen::Map<Vector2<float>>(attributes.uv_scale) = instance.diffuse_scale;
+  return attributes;
+}
+
+void RenderEngineGl::UpdateInstances() const {
+  Instances& instances = instances_;
+  if (instances.layout_dirty) {
+    // Group the visuals by geometry (identified by its vertex array) and
+    // diffuse map; the ordered map makes the draw order deterministic.
+    std::map<std::pair<GLuint, GLuint>, std::vector<GeometryId>> groups;
+    for (const auto& [id, instance] : visuals_) {
+      groups[{instance.geometry.vertex_array, instance.diffuse_map}].push_back(
+          id);
+    }
+    instances.batches.clear();
+    instances.attributes.clear();
+    instances.indices.clear();
+    std::vector<BoundingSphere> spheres;
+    for (const auto& [key, ids] : groups) {
+      const OpenGlInstance& first_instance = visuals_.at(ids.front());
+      instances.batches.push_back(
+          {first_instance.geometry, first_instance.diffuse_map,
+           static_cast<int>(instances.attributes.size()),
+           static_cast<int>(ids.size())});
+      for (GeometryId id : ids) {
+        const OpenGlInstance& instance = visuals_.at(id);
+        instances.indices[id] = instances.attributes.size();
+        instances.attributes.push_back(MakeInstanceAttributes(instance));
+        spheres.push_back(CalcBoundingSphere(instance));
+      }
+    }
+    instances.bounds.Rebuild(spheres);
+    instances.layout_dirty = false;
+    instances.data_dirty = true;
+  }
+
+  if (instances.data_dirty && !instances.attributes.empty()) {
+    UploadToBuffer(instances.attributes, &instances.buffer,
+                   &instances.buffer_size);
+  }
+  instances.data_dirty = false;
+}
+
+void RenderEngineGl::ReadTexture(const RenderTarget& target,
+                                 ImageType image_type, const BufferDim& dim,
+                                 GLenum format, GLenum pixel_type,
+                                 int num_bytes, void* data) const {
+  if (!parameters_.pipelined_readback) {
+    glGetTextureImage(target.value_texture, 0, format, pixel_type, num_bytes,
+                      data);
+    return;
+  }
+
+  ReadbackPipeline& pipeline = readback_pipelines_.pipelines[image_type][dim];
+  if (pipeline.pixel_buffers[0] == 0) {
+    glCreateBuffers(2, pipeline.pixel_buffers.data());
+    for (GLuint pixel_buffer : pipeline.pixel_buffers) {
+      glNamedBufferData(pixel_buffer, num_bytes, nullptr, GL_STREAM_READ);
+    }
+  }
+
+  // Queue the copy of the current image into a pixel buffer; with a pixel
+  // pack buffer bound, the data "pointer" is an offset into that buffer, and
+  // the call returns without waiting for the rendering to finish.
+  const int current = pipeline.next;
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, pipeline.pixel_buffers[current]);
+  glGetTextureImage(target.value_texture, 0, format, pixel_type, num_bytes,
+                    nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  pipeline.fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  // Copy out the image queued by the previous call; it has had the time
+  // between the two calls to finish.
+  const int ready = pipeline.has_previous ? 1 - current : current;
+  GLsync& fence = pipeline.fences[ready];
+  if (fence != nullptr) {
+    const GLuint64 kTimeoutNs = 1000000000;
+    GLenum wait_result;
+    do {
+      wait_result =
+          glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kTimeoutNs);
+    } while (wait_result == GL_TIMEOUT_EXPIRED);
+    glDeleteSync(fence);
+    fence = nullptr;
+    if (wait_result == GL_WAIT_FAILED) {
+      throw std::runtime_error(
+          "RenderEngineGl: failed waiting for a pipelined image readback");
+    }
+  }
+  const void* pixels =
+      glMapNamedBuffer(pipeline.pixel_buffers[ready], GL_READ_ONLY);
+  std::memcpy(data, pixels, num_bytes);
+  glUnmapNamedBuffer(pipeline.pixel_buffers[ready]);
+
+  pipeline.has_previous = true;
+  pipeline.next = 1 - current;
 }
 
 void RenderEngineGl::GetLabelImage(ImageLabel16I* label_image_out,
                                    const RenderTarget& target) const {
   ImageRgba8U image(label_image_out->width(), label_image_out->height());
-  glGetTextureImage(target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                    image.size() * sizeof(GLubyte), image.at(0, 0));
+  ReadTexture(target, ImageType::kLabel,
+              BufferDim(image.width(), image.height()), GL_RGBA,
+              GL_UNSIGNED_BYTE, image.size() * sizeof(GLubyte), image.at(0, 0));
+  DecodeLabelImage(image, label_image_out);
+}
+
+void RenderEngineGl::DecodeLabelImage(const ImageRgba8U& image,
+                                      ImageLabel16I* label_image_out) {
+  DRAKE_DEMAND(image.width() == label_image_out->width() &&
+               image.height() == label_image_out->height());
   ColorI color;
   for (int y = 0; y < image.height(); ++y) {
     for (int x = 0; x < image.width(); ++x) {
@@ -563,25 +1221,70 @@ OpenGlGeometry RenderEngineGl::CreateGlGeometry(const MeshData& mesh_data) {
   // Create the vertex array object (VAO).
   glCreateVertexArrays(1, &geometry.vertex_array);
 
-  const auto& vertices = mesh_data.positions;
   const auto& indices = mesh_data.indices;
-
-  // Create the vertex buffer object (VBO).
+  const int num_vertices = mesh_data.positions.rows();
+  DRAKE_DEMAND(mesh_data.normals.rows() == num_vertices);
+  geometry.has_tex_coord = mesh_data.uvs.rows() == num_vertices;
+
+  // Create the vertex buffer object (VBO). It stores all of the positions,
+  // followed by all of the normals and then all of the texture coordinates
+  // (zeros, if the mesh has none).
+  std::vector<GLfloat> vertex_data(8 * num_vertices, 0.f);
+  std::copy(mesh_data.positions.data(),
+            mesh_data.positions.data() + 3 * num_vertices, vertex_data.begin());
+  std::copy(mesh_data.normals.data(),
+            mesh_data.normals.data() + 3 * num_vertices,
+            vertex_data.begin() + 3 * num_vertices);
+  if (geometry.has_tex_coord) {
+    std::copy(mesh_data.uvs.data(), mesh_data.uvs.data() + 2 * num_vertices,
+              vertex_data.begin() + 6 * num_vertices);
+  }
   glCreateBuffers(1, &geometry.vertex_buffer);
   glNamedBufferStorage(geometry.vertex_buffer,
-                       vertices.size() * sizeof(GLfloat), vertices.data(), 0);
-  // Bind the VBO with the VAO.
-  const int kBindingIndex = 0;  // The binding point.
-  glVertexArrayVertexBuffer(geometry.vertex_array, kBindingIndex,
-                            geometry.vertex_buffer, 0, 3 * sizeof(GLfloat));
-
-  // Bind the attribute in vertex shader to the VAO at the same binding point.
-  const int kLocP_ModelAttrib = 0;  // p_Model's location in vertex shader.
-  glVertexArrayAttribFormat(geometry.vertex_array, kLocP_ModelAttrib, 3,
-                            GL_FLOAT, GL_FALSE, 0);
-  glVertexArrayAttribBinding(geometry.vertex_array, kLocP_ModelAttrib,
-                             kBindingIndex);
-  glEnableVertexArrayAttrib(geometry.vertex_array, kLocP_ModelAttrib);
+                       vertex_data.size() * sizeof(GLfloat), vertex_data.data(),
+                       0);
+
+  // Bind each section of the VBO to the VAO at its own binding point, and the
+  // corresponding attribute in the vertex shaders to that binding point. The
+  // binding points match the attributes' locations in the vertex shaders: 0
+  // for p_Model, 1 for n_Model, and 2 for uv_Model.
+  int offset = 0;
+  for (const auto& [attrib, components] :
+       {std::pair{kPositionLocation, 3}, std::pair{kNormalLocation, 3},
+        std::pair{kUvLocation, 2}}) {
+    glVertexArrayVertexBuffer(geometry.vertex_array, attrib,
+                              geometry.vertex_buffer, offset * sizeof(GLfloat),
+                              components * sizeof(GLfloat));
+    glVertexArrayAttribFormat(geometry.vertex_array, attrib, components,
+                              GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(geometry.vertex_array, attrib, attrib);
+    glEnableVertexArrayAttrib(geometry.vertex_array, attrib);
+    offset += components * num_vertices;
+  }
+
+  // The per-instance attributes advance once per instance, rather than once
+  // per vertex. Their buffer is bound by DrawInstances(); the model matrix
+  // takes one location per column.
+  std::vector<std::pair<int, int>> instance_attribs;  // (location, components)
+  for (int col = 0; col < 4; ++col) {
+    instance_attribs.emplace_back(kModelMatrixLocation + col, 4);
+  }
+  instance_attribs.emplace_back(kEncodedLabelLocation, 4);
+  instance_attribs.emplace_back(kDiffuseLocation, 4);
+  instance_attribs.emplace_back(kUvScaleLocation, 2);
+  int instance_offset = 0;
+  for (const auto& [attrib, components] : instance_attribs) {
+    glVertexArrayAttribFormat(geometry.vertex_array, attrib, components,
+                              GL_FLOAT, GL_FALSE,
+                              instance_offset * sizeof(GLfloat));
+    glVertexArrayAttribBinding(geometry.vertex_array, attrib,
+                               kInstanceBinding);
+    glEnableVertexArrayAttrib(geometry.vertex_array, attrib);
+    instance_offset += components;
+  }
+  DRAKE_DEMAND(instance_offset * sizeof(GLfloat) ==
+               sizeof(InstanceAttributes));
+  glVertexArrayBindingDivisor(geometry.vertex_array, kInstanceBinding, 1);
 
   // Create the index buffer object (IBO).
   glCreateBuffers(1, &geometry.index_buffer);
@@ -592,6 +1295,19 @@ OpenGlGeometry RenderEngineGl::CreateGlGeometry(const MeshData& mesh_data) {
 
   geometry.index_buffer_size = indices.size();
 
+  // The bounding sphere is centered on the vertices' bounding box; it doesn't
+  // need to be the smallest sphere to make culling effective.
+  if (num_vertices > 0) {
+    const Vector3<float> lower = mesh_data.positions.colwise().minCoeff();
+    const Vector3<float> upper = mesh_data.positions.colwise().maxCoeff();
+    geometry.bounds.center = 0.5f * (lower + upper);
+    geometry.bounds.radius =
+        (mesh_data.positions.rowwise() - geometry.bounds.center.transpose())
+            .rowwise()
+            .norm()
+            .maxCoeff();
+  }
+
   // Note: We won't need to call the corresponding glDeleteVertexArrays or
   // glDeleteBuffers. The meshes we store are "canonical" meshes. Even if a
   // particular GeometryId is removed, it was only referencing its corresponding
@@ -603,7 +1319,11 @@ OpenGlGeometry RenderEngineGl::CreateGlGeometry(const MeshData& mesh_data) {
 void RenderEngineGl::SetWindowVisibility(const CameraProperties& camera,
                                          bool show_window,
                                          const RenderTarget& target) const {
-  if (show_window) {
+  if (show_window && opengl_context_->is_headless()) {
+    static const logging::Warn log_once(
+        "RenderEngineGl cannot show a window when rendering headless (with "
+        "RenderEngineGlParams::egl_device); the request is ignored.");
+  } else if (show_window) {
     // Use the render target buffer as the read buffer and the default buffer
     // (0) as the draw buffer for displaying in the window. We transfer the full
     // image from source to destination. The semantics of glBlitNamedFrameBuffer
@@ -11,8 +11,10 @@
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/render/camera_properties.h"
 #include "drake/geometry/render/gl_renderer/buffer_dim.h"
+#include "drake/geometry/render/gl_renderer/frustum_culling.h"
 #include "drake/geometry/render/gl_renderer/opengl_context.h"
 #include "drake/geometry/render/gl_renderer/opengl_geometry.h"
+#include "drake/geometry/render/gl_renderer/render_engine_gl_params.h"
 #include "drake/geometry/render/gl_renderer/shader_program.h"
 #include "drake/geometry/render/gl_renderer/shape_meshes.h"
 #include "drake/geometry/render/render_engine.h"
@@ -38,19 +40,23 @@ class RenderEngineGl final : public RenderEngine {
   RenderEngineGl& operator=(RenderEngineGl&&) = delete;
   //@}}
 
-  RenderEngineGl();
+  explicit RenderEngineGl(RenderEngineGlParams params = {});
 
   ~RenderEngineGl() final;
 
   /** @see RenderEngine::UpdateViewpoint().  */
   void UpdateViewpoint(const math::RigidTransformd& X_WR) final;
 
-  /** @see RenderEngine::RenderColorImage(). Currently unimplemented. Calling
-   this will throw an exception.
+  /** @see RenderEngine::RenderColorImage(). The geometry is lit by a single
+   light at the camera's origin (a "headlight") with Lambertian shading. Its
+   color is defined by the ("phong", "diffuse") property (defaulting to
+   RenderEngineGlParams::default_diffuse), or by the ("phong", "diffuse_map")
+   PNG texture (scaled by ("phong", "diffuse_scale")) for meshes with texture
+   coordinates.
 
    Note that the display window triggered by `show_window` is shared with
    RenderLabelImage(), and only the last color or label image rendered will be
-   visible in the window (once these methods are implemented).  */
+   visible in the window.  */
   void RenderColorImage(
       const CameraProperties& camera, bool show_window,
       systems::sensors::ImageRgba8U* color_image_out) const final;
@@ -60,12 +66,11 @@ class RenderEngineGl final : public RenderEngine {
       const DepthCameraProperties& camera,
       systems::sensors::ImageDepth32F* depth_image_out) const final;
 
-  /** @see RenderEngine::RenderLabelImage(). Currently unimplemented. Calling
-   this will throw an exception.
+  /** @see RenderEngine::RenderLabelImage().
 
    Note that the display window triggered by `show_window` is shared with
    RenderColorImage(), and only the last color or label image rendered will be
-   visible in the window (once these methods are implemented).  */
+   visible in the window.  */
   void RenderLabelImage(
       const CameraProperties& camera, bool show_window,
       systems::sensors::ImageLabel16I* label_image_out) const final;
@@ -88,8 +93,12 @@ class RenderEngineGl final : public RenderEngine {
 
   // Image types available. Used to index into the image-type-dependent
   // data structures.
-  // TODO(SeanCurtis-TRI): Implement color image type: kColor.
-  enum ImageType { kLabel = 0, kDepth, kTypeCount };
+  enum ImageType { kLabel = 0, kDepth, kColor, kTypeCount };
+
+  // The maximum number of cameras rendered with a single traversal of the
+  // scene by DoRenderImages(); it bounds the size of the uniform arrays and
+  // the geometry shader output of the layered shader programs.
+  static constexpr int kMaxBatchLayers = 8;
 
   // @see RenderEngine::DoRegisterVisual().
   bool DoRegisterVisual(GeometryId id, const Shape& shape,
@@ -106,18 +115,59 @@ class RenderEngineGl final : public RenderEngine {
   // @see RenderEngine::DoClone().
   std::unique_ptr<RenderEngine> DoClone() const final;
 
+  // @see RenderEngine::DoRenderImages(). The depth and label images are
+  // grouped by image type and size, and each group of up to kMaxBatchLayers
+  // cameras is rendered into the layers of a single render target with one
+  // traversal of the scene. The color images are rendered one camera at a
+  // time. The images are always read back synchronously, regardless of
+  // RenderEngineGlParams::pipelined_readback.
+  void DoRenderImages(const ImageRenderBatch& batch) final;
+
   // Copy constructor used for cloning.
   RenderEngineGl(const RenderEngineGl& other) = default;
 
-  // Renders the object at a specific pose in the camera frame using the given
-  // shader program.
+  // A camera to render from: its intrinsics, the inverse X_CW of its pose in
+  // the world, and its clipping planes. RenderLayers() renders from one per
+  // layer of a layered render target.
+  struct BatchLayer {
+    const CameraProperties* camera{};
+    math::RigidTransformd X_CW;
+    double clip_near{};
+    double clip_far{};
+  };
+
+  // Renders the scene from the given camera using the given shader program,
+  // whose projection matrix must already match the camera (see
+  // SetCameraProperties()).
   void RenderAt(const internal::ShaderProgram& shader_program,
-                const Eigen::Matrix4f& X_CM, ImageType image_type) const;
+                const BatchLayer& camera, ImageType image_type) const;
+
+  // Draws the visuals that might be visible in at least one of the given view
+  // frustums, with one instanced draw call per InstanceBatch with a visible
+  // instance, and with the view and projection uniforms already set. It leaves
+  // the vertex array and texture bindings in an unspecified state.
+  void DrawInstances(const internal::ShaderProgram& shader_program,
+                     const std::vector<internal::ViewFrustum>& frustums,
+                     ImageType image_type) const;
+
+  // Renders the scene into layer i of the bound layered render target from
+  // the camera layers[i], traversing the scene only once. The caller is
+  // responsible for binding and clearing the target (see
+  // GetLayeredRenderTarget()), and for activating the layered shader program
+  // and setting its uniforms that are specific to the image type.
+  void RenderLayers(const internal::ShaderProgram& shader_program,
+                    const std::vector<BatchLayer>& layers,
+                    ImageType image_type) const;
 
   // Performs the common setup for all shape types.
   void ImplementGeometry(const internal::OpenGlGeometry& geometry,
                          void* user_data, const Vector3<double>& scale);
 
+  // Returns the OpenGL texture object with the contents of the named PNG file,
+  // loading it if it isn't already in textures_. Returns zero (and logs a
+  // warning) if the file can't be read.
+  GLuint GetTexture(const std::string& filename);
+
   // Provides triangle mesh definitions of the various canonical geometries
   // supported by this renderer: sphere, cylinder, half space, box, and mesh.
   // These update the stored OpenGlGeometry members of this class. They are
@@ -132,6 +182,11 @@ class RenderEngineGl final : public RenderEngine {
   // the *top* of each Render*Image() method.
   const internal::ShaderProgram& ActivateShader(ImageType image_type) const;
 
+  // Activates the shader that renders the given image type into all the layers
+  // of a layered render target at once; see RenderLayers().
+  const internal::ShaderProgram& ActivateLayeredShader(
+      ImageType image_type) const;
+
   // Given the image type, returns the texture configuration for that image
   // type. These are the key arguments for glTexImage2D based on the type of
   // image. It includes:
@@ -150,6 +205,17 @@ class RenderEngineGl final : public RenderEngine {
   static internal::RenderTarget CreateRenderTarget(
       const CameraProperties& camera, ImageType image_type);
 
+  // Creates a *new* layered render target with kMaxBatchLayers layers of the
+  // given size. Its value texture and z buffer are both 2D texture arrays.
+  static internal::RenderTarget CreateLayeredRenderTarget(
+      const internal::BufferDim& dim, ImageType image_type);
+
+  // Returns the cached layered render target for the given size and image type
+  // (creating it if necessary), bound as the current frame buffer with the
+  // matching viewport. It is _not_ threadsafe.
+  internal::RenderTarget GetLayeredRenderTarget(const internal::BufferDim& dim,
+                                                ImageType image_type) const;
+
   // Configures the projection matrix -- computes the matrix and sets the value
   // in the shader program's "projection_matrix" uniform. This value changes
   // on a *per-camera* basis.
@@ -157,11 +223,12 @@ class RenderEngineGl final : public RenderEngine {
                              const CameraProperties& camera, double clip_near,
                              double clip_far) const;
 
-  // Configures the "modelview" matrix and sets the value in the shader
-  // program's "model_view_matrix" uniform. For a single camera, this changes on
-  // a *per-geometry* basis.
-  void SetGlModelViewMatrix(const internal::ShaderProgram& shader_program,
-                            const Eigen::Matrix4f& X_CM) const;
+  // Configures the "view" matrix and sets the value in the shader program's
+  // "view_matrix" uniform. Like the projection matrix, this changes on a
+  // *per-camera* basis; the per-geometry model matrices are instance
+  // attributes (see InstanceAttributes).
+  void SetGlViewMatrix(const internal::ShaderProgram& shader_program,
+                       const Eigen::Matrix4f& X_CW) const;
 
   // Obtains the label image rendered from a specific object pose. This is
   // slower than it has to be because it does per-pixel processing on the CPU.
@@ -169,6 +236,23 @@ class RenderEngineGl final : public RenderEngine {
   void GetLabelImage(drake::systems::sensors::ImageLabel16I* label_image_out,
                      const internal::RenderTarget& target) const;
 
+  // Decodes the labels encoded as colors in `image` into `label_image_out`,
+  // which must have the same size.
+  static void DecodeLabelImage(
+      const systems::sensors::ImageRgba8U& image,
+      systems::sensors::ImageLabel16I* label_image_out);
+
+  // Copies the value texture of `target`, whose dimensions are `dim`, into
+  // `data`, which has room for `num_bytes` bytes of pixels in the given
+  // `format` and `pixel_type`. Without pipelined readback, this waits for the
+  // rendering to finish. With it, this queues the readback of the current
+  // image, and copies out the one queued by the previous call for the same
+  // image type and dimensions instead (on the first such call, it waits for
+  // the current image).
+  void ReadTexture(const internal::RenderTarget& target, ImageType image_type,
+                   const internal::BufferDim& dim, GLenum format,
+                   GLenum pixel_type, int num_bytes, void* data) const;
+
   // Configures the OpenGL properties dependent on the camera properties. This
   // updates the cache of RenderTargets (creating one for the camera if one
   // does not already exist). As such, it is _not_ threadsafe.
@@ -207,6 +291,10 @@ class RenderEngineGl final : public RenderEngine {
   // Shader programs for each image type.
   std::array<internal::ShaderProgram, kTypeCount> shader_programs_;
 
+  // The shader programs used by RenderLayers() to render a batch of cameras
+  // into a layered render target.
+  std::array<internal::ShaderProgram, kTypeCount> layered_shader_programs_;
+
   // One OpenGlGeometry per primitive type. They represent a canonical, "unit"
   // version of the primitive type. Each instance scales and poses the
   // corresponding primitive to create arbitrarily sized geometries.
@@ -224,6 +312,10 @@ class RenderEngineGl final : public RenderEngine {
   // Mapping from obj filename to the mesh loaded into an OpenGlGeometry.
   std::unordered_map<std::string, internal::OpenGlGeometry> meshes_;
 
+  // Mapping from png filename to the OpenGL texture object loaded from it.
+  // Like the meshes, the textures live as long as the OpenGL context.
+  std::unordered_map<std::string, GLuint> textures_;
+
   // These are caches of reusable RenderTargets. There is a unique render target
   // for each unique render image size (BufferDim) and output image type. They
   // are mutable so that they can be updated in what would otherwise be a const
@@ -240,6 +332,109 @@ class RenderEngineGl final : public RenderEngine {
       kTypeCount>
       frame_buffers_;
 
+  // The layered RenderTargets used by DoRenderImages(), one for each unique
+  // render image size and output image type. Like frame_buffers_, they are
+  // shared by copies of this render engine.
+  mutable std::array<
+      std::unordered_map<internal::BufferDim, internal::RenderTarget>,
+      kTypeCount>
+      layered_frame_buffers_;
+
+  // The pair of pixel buffer objects (and their fences) that pipeline the
+  // readback of one image type and size when parameters_.pipelined_readback
+  // is true. The readback of each render call is written to
+  // pixel_buffers[next], alternating between the two.
+  struct ReadbackPipeline {
+    std::array<GLuint, 2> pixel_buffers{};
+    std::array<GLsync, 2> fences{};
+    int next{0};
+    // True if pixel_buffers[1 - next] holds the image of the previous call.
+    bool has_previous{false};
+  };
+
+  // A pending readback belongs to the engine whose render call queued it, so
+  // clones start with no pipelines rather than sharing this engine's.
+  struct ReadbackPipelines {
+    ReadbackPipelines() = default;
+    ReadbackPipelines(const ReadbackPipelines&) {}
+    ReadbackPipelines& operator=(const ReadbackPipelines&) = delete;
+
+    std::array<
+        std::unordered_map<internal::BufferDim, ReadbackPipeline>, kTypeCount>
+        pipelines;
+  };
+
+  RenderEngineGlParams parameters_;
+
+  mutable ReadbackPipelines readback_pipelines_;
+
+  // The per-instance vertex attributes of one visual, as laid out in the
+  // instance buffer: its model matrix X_WM (the scaled pose of the geometry in
+  // the world, column major), its label encoded as a color, and its diffuse
+  // color and texture coordinate scale.
+  struct InstanceAttributes {
+    GLfloat X_WM[16];
+    GLfloat encoded_label[4];
+    GLfloat diffuse[4];
+    GLfloat uv_scale[2];
+  };
+
+  // The range of the instance buffer holding all of the visuals that share an
+  // OpenGlGeometry and diffuse map; they are drawn with a single instanced
+  // draw call.
+  struct InstanceBatch {
+    internal::OpenGlGeometry geometry;
+    GLuint diffuse_map{};
+    int first{};
+    int count{};
+  };
+
+  // The instance buffer for visuals_ and its CPU-side copy, and the bounding
+  // volume hierarchy used to cull the visuals outside of a camera's view.
+  // Registering or removing a visual regroups the batches and rebuilds the
+  // hierarchy; updating a pose only rewrites that visual's model matrix and
+  // refits its bounding spheres. Either way, the buffer is uploaded once by
+  // the next render call (see UpdateInstances()). Each clone has its own
+  // visuals_, so clones start with no instance buffer rather than sharing
+  // this one.
+  struct Instances {
+    Instances() = default;
+    Instances(const Instances&) {}
+    Instances& operator=(const Instances&) = delete;
+
+    GLuint buffer{0};
+    int buffer_size{0};
+    std::vector<InstanceBatch> batches;
+    std::vector<InstanceAttributes> attributes;
+    // The index in `attributes` of each visual.
+    std::unordered_map<GeometryId, int> indices;
+    // The bounding sphere of each visual in the world frame; its leaves are
+    // indexed like `attributes`.
+    internal::BoundingSphereTree bounds;
+    bool layout_dirty{true};
+    bool data_dirty{true};
+
+    // When some of the visuals are culled, DrawInstances() copies the
+    // attributes of the rest into this buffer, and draws these batches (with
+    // ranges in it) instead. The vectors are only kept to reuse their memory.
+    GLuint culled_buffer{0};
+    int culled_buffer_size{0};
+    std::vector<InstanceBatch> culled_batches;
+    std::vector<InstanceAttributes> culled_attributes;
+    std::vector<bool> visible;
+    // The number of visuals culled by the most recent DrawInstances().
+    int num_culled{0};
+  };
+
+  // Computes the instance attributes of the given visual.
+  static InstanceAttributes MakeInstanceAttributes(
+      const internal::OpenGlInstance& instance);
+
+  // Brings instances_ (and its instance buffer) up to date with visuals_.
+  void UpdateInstances() const;
+
+  mutable Instances instances_;
+
   // Mapping from GeometryId to the visual data associated with that geometry.
   // When copying the render engine, this data is copied verbatim allowing the
   // copied render engine access to the same OpenGL objects in the OpenGL
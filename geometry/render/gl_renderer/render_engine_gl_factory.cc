@@ -1,13 +1,52 @@
 #include "drake/geometry/render/gl_renderer/render_engine_gl_factory.h"
 
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
 #include "drake/geometry/render/gl_renderer/render_engine_gl.h"
 
 namespace drake {
 namespace geometry {
 namespace render {
 
-std::unique_ptr<RenderEngine> MakeRenderEngineGl() {
-  return std::make_unique<RenderEngineGl>();
+std::unique_ptr<RenderEngine> MakeRenderEngineGl(RenderEngineGlParams params) {
+  return std::make_unique<RenderEngineGl>(params);
+}
+
+int GetRenderEngineGlDeviceCount() {
+  return internal::OpenGlContext::num_egl_devices();
+}
+
+RenderEngineGlPool::RenderEngineGlPool(RenderEngineGlParams params,
+                                       std::vector<int> devices)
+    : params_(std::move(params)), devices_(std::move(devices)) {
+  const int num_devices = GetRenderEngineGlDeviceCount();
+  if (devices_.empty()) {
+    for (int i = 0; i < num_devices; ++i) {
+      devices_.push_back(i);
+    }
+  }
+  if (devices_.empty()) {
+    throw std::runtime_error(
+        "RenderEngineGlPool: no GPUs are available for headless rendering");
+  }
+  for (int device : devices_) {
+    if (device < 0 || device >= num_devices) {
+      throw std::runtime_error(fmt::format(
+          "RenderEngineGlPool: device {} is not a valid index; {} GPU(s) are "
+          "available for headless rendering",
+          device, num_devices));
+    }
+  }
+}
+
+std::unique_ptr<RenderEngine> RenderEngineGlPool::MakeRenderEngine() {
+  const int index = next_++ % static_cast<int>(devices_.size());
+  RenderEngineGlParams params = params_;
+  params.egl_device = devices_[index];
+  return MakeRenderEngineGl(params);
 }
 
 }  // namespace render
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <vector>
 
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/render/gl_renderer/render_engine_gl_params.h"
 #include "drake/geometry/render/render_engine.h"
 
 namespace drake {
@@ -12,7 +16,50 @@ namespace render {
 /** Constructs a RenderEngine implementation which uses a purely OpenGL
  renderer. The engine only works under Ubuntu. If called on a Mac, it will
  produce a "dummy" implementation.  */
-std::unique_ptr<RenderEngine> MakeRenderEngineGl();
+std::unique_ptr<RenderEngine> MakeRenderEngineGl(
+    RenderEngineGlParams params = {});
+
+/** Reports the number of GPUs on which RenderEngineGl can render headless
+ (see RenderEngineGlParams::egl_device). Reports zero if EGL device
+ enumeration is unavailable (including on a Mac).  */
+int GetRenderEngineGlDeviceCount();
+
+/** Makes headless RenderEngineGl instances, distributing them round-robin
+ across a set of GPUs. It is intended for running many camera simulations in
+ parallel, e.g., Monte Carlo runs on a multi-GPU machine without an X server:
+ each run takes its render engine(s) from a shared pool, and runs on its own
+ thread. Cameras within one simulation can likewise be spread across GPUs by
+ registering several engines from the pool (under different names) with
+ SceneGraph.
+
+ MakeRenderEngine() is threadsafe. Each engine it makes (and its clones) must
+ only be used by one thread at a time, and it is the calling thread's OpenGL
+ context that is current when the engine is made -- so make each engine on
+ the thread that renders with it.  */
+class RenderEngineGlPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RenderEngineGlPool)
+
+  /** Constructs a pool.
+   @param params   The parameters of each engine; its egl_device is ignored.
+   @param devices  The indices of the GPUs to use; if empty, all of the
+                   GetRenderEngineGlDeviceCount() GPUs are used.
+   @throws std::exception if there are no GPUs to use or if any of `devices`
+   is not a valid index.  */
+  explicit RenderEngineGlPool(RenderEngineGlParams params = {},
+                              std::vector<int> devices = {});
+
+  /** Makes an engine on the next GPU.  */
+  std::unique_ptr<RenderEngine> MakeRenderEngine();
+
+  /** The indices of the GPUs that engines are distributed across.  */
+  const std::vector<int>& devices() const { return devices_; }
+
+ private:
+  RenderEngineGlParams params_;
+  std::vector<int> devices_;
+  std::atomic<int> next_{0};
+};
 
 }  // namespace render
 }  // namespace geometry
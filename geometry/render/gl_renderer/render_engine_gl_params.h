@@ -0,0 +1,45 @@
+#pragma once
+
+#include <optional>
+
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** Construction parameters for RenderEngineGl.  */
+struct RenderEngineGlParams {
+  /** If true, the engine reads rendered images back from the GPU through a
+   pair of pixel buffer objects per image type and size, so that the CPU does
+   not wait for the rendering it has just requested. The price is one frame
+   of latency: each render call returns the image of the *previous* call with
+   the same image type and size (the very first call returns its own image).
+   Cameras that share an image type and size would receive each other's
+   images, so give each latency-tolerant camera its own render engine (i.e.,
+   its own `renderer_name`). Clones of the engine start without any pending
+   image. Images rendered in a batch by RenderEngine::RenderImages() are
+   always read back without latency.  */
+  bool pipelined_readback{false};
+
+  /** If given, the engine renders "headless" -- without any X server -- with
+   an EGL context on the GPU with this index (see
+   GetRenderEngineGlDeviceCount()). Otherwise, it uses a GLX context on the X
+   display. A headless engine has no display window, so requests to show one
+   are ignored. Engines on different GPUs can render concurrently from
+   different threads; see RenderEngineGlPool.  */
+  std::optional<int> egl_device{};
+
+  /** The rgba color to apply to the (phong, diffuse) property when none is
+   otherwise specified. The alpha channel is currently unused.  */
+  Eigen::Vector4d default_diffuse{0.9, 0.45, 0.1, 1.0};
+
+  /** The rgb color to which the color buffer is cleared (each channel in the
+   range [0, 1]). The default value (in byte values) would be
+   [204, 229, 255].  */
+  Eigen::Vector3d default_clear_color{204 / 255., 229 / 255., 255 / 255.};
+};
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -15,6 +15,17 @@ namespace internal {
 
 namespace {
 
+const char* ShaderTypeName(GLuint shader_type) {
+  switch (shader_type) {
+    case GL_VERTEX_SHADER:
+      return "vertex";
+    case GL_GEOMETRY_SHADER:
+      return "geometry";
+    default:
+      return "fragment";
+  }
+}
+
 GLuint CompileShader(GLuint shader_type, const std::string& shader_code) {
   GLuint shader_id = glCreateShader(shader_type);
   char const* source_ptr = shader_code.c_str();
@@ -25,9 +36,8 @@ GLuint CompileShader(GLuint shader_type, const std::string& shader_code) {
   GLint result{0};
   glGetShaderiv(shader_id, GL_COMPILE_STATUS, &result);
   if (!result) {
-    const std::string error_prefix =
-        fmt::format("Error compiling {} shader: ",
-                    shader_type == GL_VERTEX_SHADER ? "vertex" : "fragment");
+    const std::string error_prefix = fmt::format(
+        "Error compiling {} shader: ", ShaderTypeName(shader_type));
     std::string info("No further information available");
     int info_log_length;
     glGetShaderiv(shader_id, GL_INFO_LOG_LENGTH, &info_log_length);
@@ -52,17 +62,35 @@ void ShaderProgram::LoadFromSources(const std::string& vertex_shader_source,
   GLuint fragment_shader_id =
       CompileShader(GL_FRAGMENT_SHADER, fragment_shader_source);
 
-  // Link.
+  Link({vertex_shader_id, fragment_shader_id});
+}
+
+void ShaderProgram::LoadFromSources(const std::string& vertex_shader_source,
+                                    const std::string& geometry_shader_source,
+                                    const std::string& fragment_shader_source) {
+  // Compile.
+  GLuint vertex_shader_id =
+      CompileShader(GL_VERTEX_SHADER, vertex_shader_source);
+  GLuint geometry_shader_id =
+      CompileShader(GL_GEOMETRY_SHADER, geometry_shader_source);
+  GLuint fragment_shader_id =
+      CompileShader(GL_FRAGMENT_SHADER, fragment_shader_source);
+
+  Link({vertex_shader_id, geometry_shader_id, fragment_shader_id});
+}
+
+void ShaderProgram::Link(const std::vector<GLuint>& shader_ids) {
   program_id_ = glCreateProgram();
-  glAttachShader(program_id_, vertex_shader_id);
-  glAttachShader(program_id_, fragment_shader_id);
+  for (GLuint shader_id : shader_ids) {
+    glAttachShader(program_id_, shader_id);
+  }
   glLinkProgram(program_id_);
 
   // Clean up.
-  glDetachShader(program_id_, vertex_shader_id);
-  glDetachShader(program_id_, fragment_shader_id);
-  glDeleteShader(vertex_shader_id);
-  glDeleteShader(fragment_shader_id);
+  for (GLuint shader_id : shader_ids) {
+    glDetachShader(program_id_, shader_id);
+    glDeleteShader(shader_id);
+  }
 
   // Check.
   GLint result{0};
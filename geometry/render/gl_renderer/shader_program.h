@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
@@ -40,6 +41,22 @@ class ShaderProgram {
   void LoadFromSources(const std::string& vertex_shader_source,
                        const std::string& fragment_shader_source);
 
+  /* Loads a %ShaderProgram from GLSL code contained in the provided strings,
+   with a geometry shader between the vertex and fragment shaders.
+
+   @param vertex_shader_source    The valid GLSL source code for a vertex
+                                  shader.
+   @param geometry_shader_source  The valid GLSL source code for a geometry
+                                  shader.
+   @param fragment_shader_source  The valid GLSL source code for a fragment
+                                  shader.
+   @throws std::runtime_error if any shader source doesn't compile or the
+                              resulting program has errors.
+   */
+  void LoadFromSources(const std::string& vertex_shader_source,
+                       const std::string& geometry_shader_source,
+                       const std::string& fragment_shader_source);
+
   /* Loads a %ShaderProgram from GLSL code contained in the named files.
 
    @param vertex_shader_file    The path to a file containing valid GLSL source
@@ -74,6 +91,9 @@ class ShaderProgram {
  private:
   friend class ShaderProgramTest;
 
+  // Links the compiled shaders into this program and then deletes them.
+  void Link(const std::vector<GLuint>& shader_ids);
+
   GLuint program_id_{0};
 };
 
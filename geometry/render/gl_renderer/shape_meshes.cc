@@ -7,6 +7,7 @@
 #include <limits>
 #include <map>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -23,9 +24,7 @@ namespace internal {
 
 using Eigen::Vector2d;
 using Eigen::Vector3d;
-using std::make_pair;
 using std::map;
-using std::pair;
 using std::string;
 using std::vector;
 
@@ -71,34 +70,38 @@ MeshData LoadMeshFromObj(std::istream* input_stream,
   //
   // To accomplish this:
   //  1. Every vertex referenced by a face in the parsed OBJ is a "meta"
-  //     vertex consisting of a pair of indices: (p, n), the index in vertex
-  //     positions and normals. For example, imagine one face refers to meta
-  //     index (p, n₀) and another face refers to index (p, n₁). Although the
-  //     two faces appear to share a single vertex, those vertices have
-  //     different normals which require two different vertices in the mesh
-  //     data. We copy the vertex position and associate one copy with each
-  //     normal.
-  //  2. Given a mapping (p, n) --> i (a mapping from the meta vertex in the
-  //     parsed OBJ data to the unique index in the resultant mesh data), we
-  //     can build the faces in the final mesh data by mapping the (p, n)
-  //     pair in the OBJ face specification to the final mesh data vertex
-  //     index i.
+  //     vertex consisting of a tuple of indices: (p, n, uv), the index in
+  //     vertex positions, normals, and texture coordinates. For example,
+  //     imagine one face refers to meta index (p, n₀, uv) and another face
+  //     refers to index (p, n₁, uv). Although the two faces appear to share a
+  //     single vertex, those vertices have different normals which require
+  //     two different vertices in the mesh data. We copy the vertex position
+  //     and associate one copy with each normal.
+  //  2. Given a mapping (p, n, uv) --> i (a mapping from the meta vertex in
+  //     the parsed OBJ data to the unique index in the resultant mesh data),
+  //     we can build the faces in the final mesh data by mapping the
+  //     (p, n, uv) tuple in the OBJ face specification to the final mesh data
+  //     vertex index i.
   //  3. When done, we should have an equal number of vertex positions as
-  //     we have normals. And all indices in the faces should be valid
-  //     indices into both vectors of data.
+  //     we have normals (and texture coordinates, if the OBJ has any). And all
+  //     indices in the faces should be valid indices into all vectors of data.
   // NOTE: In the case of meta vertices (p, n₀) and (p, n₁) we are not actually
   // confirming that normals[n₀] and normals[n₁] are actually different normals;
   // we're assuming different indices implies different values.
   //
-  // TODO(SeanCurtis-TRI) Extend this to include texture coordinates (and any
-  // other per-vertex quantity we eventually support).
-
-  // The map from (p, n) --> i.
-  map<pair<int, int>, int> obj_vertex_to_new_vertex;
-  // Accumulators for vertex positions, normals, and triangles.
+  // If the OBJ has no texture coordinates at all, the resultant mesh data has
+  // none either. Otherwise, a face vertex that doesn't reference any gets the
+  // texture coordinate (0, 0).
+
+  // The map from (p, n, uv) --> i.
+  map<std::tuple<int, int, int>, int> obj_vertex_to_new_vertex;
+  // Accumulators for vertex positions, normals, texture coordinates, and
+  // triangles.
   vector<Vector3d> positions;
   vector<Vector3d> normals;
+  vector<Vector2d> uvs;
   vector<Vector3<int>> triangles;
+  const bool has_uvs = attrib.texcoords.size() > 0;
 
   // TODO(SeanCurtis-TRI) Revisit how we handle normals:
   //   1. If normals are absent, generate normals so that we get faceted meshes.
@@ -129,7 +132,9 @@ MeshData LoadMeshFromObj(std::istream* input_stream,
           throw std::runtime_error(
               fmt::format("Not all faces reference normals: {}", filename));
         }
-        const auto obj_indices = make_pair(position_index, norm_index);
+        const int uv_index = shape_mesh.indices[v_index].texcoord_index;
+        const auto obj_indices =
+            std::make_tuple(position_index, norm_index, uv_index);
         if (obj_vertex_to_new_vertex.count(obj_indices) == 0) {
           obj_vertex_to_new_vertex[obj_indices] =
               static_cast<int>(positions.size());
@@ -142,6 +147,14 @@ MeshData LoadMeshFromObj(std::istream* input_stream,
           normals.emplace_back(attrib.normals[3 * norm_index],
                                attrib.normals[3 * norm_index + 1],
                                attrib.normals[3 * norm_index + 2]);
+          if (has_uvs) {
+            if (uv_index < 0) {
+              uvs.emplace_back(0, 0);
+            } else {
+              uvs.emplace_back(attrib.texcoords[2 * uv_index],
+                               attrib.texcoords[2 * uv_index + 1]);
+            }
+          }
         }
         face_vertices[i] = obj_vertex_to_new_vertex[obj_indices];
         ++v_index;
@@ -163,6 +176,10 @@ MeshData LoadMeshFromObj(std::istream* input_stream,
   for (int n = 0; n < mesh_data.normals.rows(); ++n) {
     mesh_data.normals.row(n) = normals[n].cast<GLfloat>();
   }
+  mesh_data.uvs.resize(uvs.size(), 2);
+  for (int uv = 0; uv < mesh_data.uvs.rows(); ++uv) {
+    mesh_data.uvs.row(uv) = uvs[uv].cast<GLfloat>();
+  }
 
   return mesh_data;
 }
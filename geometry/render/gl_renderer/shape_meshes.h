@@ -12,7 +12,7 @@ namespace geometry {
 namespace render {
 namespace internal {
 
-// TODO(SeanCurtis-TRI): All of these methods ultimately need to provide
+// TODO(SeanCurtis-TRI): The primitive meshes ultimately need to provide
 //  texture coordinates.
 
 /* The data representing a mesh. The triangle mesh is defined by `indices`. Row
@@ -22,8 +22,8 @@ namespace internal {
  corresponding normal is at `normals.row(v)`, and its texture coordinates are at
  `uvs.row(v)`.
 
- For now, uvs will be empty. Only `positions`, `indices`, and `normals` are
- guaranteed. Texture coordinates will come in the near future.  */
+ Only `positions`, `indices`, and `normals` are guaranteed. `uvs` is empty if
+ the mesh has no texture coordinates (e.g., all of the primitive meshes).  */
 struct MeshData {
   Eigen::Matrix<GLfloat, Eigen::Dynamic, 3, Eigen::RowMajor> positions;
   Eigen::Matrix<GLfloat, Eigen::Dynamic, 3, Eigen::RowMajor> normals;
@@ -31,10 +31,9 @@ struct MeshData {
   Eigen::Matrix<GLuint, Eigen::Dynamic, 3, Eigen::RowMajor> indices;
 };
 
-// TODO(SeanCurtis-TRI): Also parse texture coordinates.
-
-/* Loads a mesh's vertices and indices (faces) from an OBJ description given
- in the input stream. It does not load textures. Note that while this
+/* Loads a mesh's vertices, normals, texture coordinates (if any) and indices
+ (faces) from an OBJ description given in the input stream. It does not load
+ textures. Note that while this
  functionality seems similar to ReadObjToSurfaceMesh, RenderEngineGl cannot use
  SurfaceMesh. Rendering requires normals and texture coordinates; SurfaceMesh
  was not designed with those quantities in mind.  */
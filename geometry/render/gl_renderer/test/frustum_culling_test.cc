@@ -0,0 +1,174 @@
+#include "drake/geometry/render/gl_renderer/frustum_culling.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+namespace {
+
+const float kInf = std::numeric_limits<float>::infinity();
+
+// The clip matrix of an OpenGL camera at the world origin, looking along the
+// world's -z axis with a 90 degree field of view (in both directions) and
+// clipping planes at z = -1 and z = -10, offset by `x` along the world's x
+// axis.
+Eigen::Matrix4f MakeClipMatrix(float x = 0) {
+  const float near = 1;
+  const float far = 10;
+  Eigen::Matrix4f P;
+  // clang-format off
+  P << 1, 0,                            0,                              0,
+       0, 1,                            0,                              0,
+       0, 0, -(far + near) / (far - near), -2 * far * near / (far - near),
+       0, 0,                           -1,                              0;
+  // clang-format on
+  Eigen::Matrix4f X_CW = Eigen::Matrix4f::Identity();
+  X_CW(0, 3) = -x;
+  return P * X_CW;
+}
+
+// Reports which of the spheres are not outside of all of the frustums.
+std::vector<bool> BruteForceCull(const std::vector<BoundingSphere>& spheres,
+                                 const std::vector<ViewFrustum>& frustums) {
+  std::vector<bool> visible;
+  for (const BoundingSphere& sphere : spheres) {
+    bool is_visible = false;
+    for (const ViewFrustum& frustum : frustums) {
+      is_visible |= frustum.Classify(sphere) != ViewFrustum::kOutside;
+    }
+    visible.push_back(is_visible);
+  }
+  return visible;
+}
+
+GTEST_TEST(BoundingSphereTest, Merge) {
+  const BoundingSphere a{{0, 0, 0}, 1};
+  const BoundingSphere b{{3, 0, 0}, 1};
+  const BoundingSphere ab = BoundingSphere::Merge(a, b);
+  EXPECT_TRUE(CompareMatrices(ab.center, Vector3<float>(1.5, 0, 0), 1e-6));
+  EXPECT_FLOAT_EQ(ab.radius, 2.5);
+
+  // A sphere that contains the other is the merged sphere.
+  const BoundingSphere big{{0.5, 0, 0}, 2};
+  EXPECT_EQ(BoundingSphere::Merge(a, big).radius, 2);
+  EXPECT_EQ(BoundingSphere::Merge(big, a).radius, 2);
+
+  // Concentric spheres.
+  EXPECT_EQ(BoundingSphere::Merge(a, BoundingSphere{{0, 0, 0}, 3}).radius, 3);
+
+  // An infinite sphere (the default) contains everything.
+  EXPECT_EQ(BoundingSphere::Merge(a, BoundingSphere{}).radius, kInf);
+  EXPECT_EQ(BoundingSphere::Merge(BoundingSphere{}, a).radius, kInf);
+}
+
+GTEST_TEST(ViewFrustumTest, Classify) {
+  const ViewFrustum frustum(MakeClipMatrix());
+  EXPECT_EQ(frustum.Classify({{0, 0, -5}, 1}), ViewFrustum::kInside);
+  EXPECT_EQ(frustum.Classify({{0, 0, 5}, 1}), ViewFrustum::kOutside);
+  // Straddling the near, far, and side planes.
+  EXPECT_EQ(frustum.Classify({{0, 0, -1}, 0.5}), ViewFrustum::kIntersecting);
+  EXPECT_EQ(frustum.Classify({{0, 0, -10}, 0.5}), ViewFrustum::kIntersecting);
+  EXPECT_EQ(frustum.Classify({{5, 0, -5}, 0.5}), ViewFrustum::kIntersecting);
+  EXPECT_EQ(frustum.Classify({{0, -5, -5}, 0.5}), ViewFrustum::kIntersecting);
+  // Beyond the near, far, and side planes.
+  EXPECT_EQ(frustum.Classify({{0, 0, -0.5}, 0.25}), ViewFrustum::kOutside);
+  EXPECT_EQ(frustum.Classify({{0, 0, -11}, 0.5}), ViewFrustum::kOutside);
+  EXPECT_EQ(frustum.Classify({{7, 0, -5}, 1}), ViewFrustum::kOutside);
+  EXPECT_EQ(frustum.Classify({{0, 7, -5}, 1}), ViewFrustum::kOutside);
+  // The side planes are at 45 degrees, so the distance of (7, 0, -5) from the
+  // right plane is 2 / sqrt(2); a slightly bigger sphere reaches inside.
+  EXPECT_EQ(frustum.Classify({{7, 0, -5}, 1.5}), ViewFrustum::kIntersecting);
+  // An infinite sphere is never culled.
+  EXPECT_EQ(frustum.Classify({}), ViewFrustum::kIntersecting);
+}
+
+class BoundingSphereTreeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // A row of small spheres along the x axis, in front of the camera. The
+    // frustum at the origin is 10 m wide at z = -5, so it sees about half
+    // of them.
+    for (int i = 0; i < 37; ++i) {
+      spheres_.push_back({{0.5f * i - 2, 0.1f * (i % 3), -5}, 0.2});
+    }
+    tree_.Rebuild(spheres_);
+  }
+
+  void ExpectCullMatchesBruteForce(const std::vector<ViewFrustum>& frustums) {
+    std::vector<bool> visible;
+    tree_.Cull(frustums, &visible);
+    EXPECT_EQ(visible, BruteForceCull(spheres_, frustums));
+  }
+
+  std::vector<BoundingSphere> spheres_;
+  BoundingSphereTree tree_;
+};
+
+TEST_F(BoundingSphereTreeTest, Cull) {
+  ASSERT_EQ(tree_.num_leaves(), static_cast<int>(spheres_.size()));
+  const ViewFrustum frustum(MakeClipMatrix());
+  std::vector<bool> visible;
+  tree_.Cull({frustum}, &visible);
+  int num_visible = 0;
+  for (bool v : visible) num_visible += v;
+  EXPECT_GT(num_visible, 0);
+  EXPECT_LT(num_visible, static_cast<int>(spheres_.size()));
+  ExpectCullMatchesBruteForce({frustum});
+
+  // A leaf is visible if it is in any of the frustums.
+  ExpectCullMatchesBruteForce({frustum, ViewFrustum(MakeClipMatrix(12))});
+  ExpectCullMatchesBruteForce({ViewFrustum(MakeClipMatrix(100))});
+
+  // With no frustums, nothing is visible.
+  tree_.Cull({}, &visible);
+  EXPECT_EQ(visible, std::vector<bool>(spheres_.size(), false));
+}
+
+TEST_F(BoundingSphereTreeTest, UpdateLeaf) {
+  const ViewFrustum frustum(MakeClipMatrix());
+  // Move the last (invisible) sphere in front of the camera, and the first
+  // (visible) one behind it.
+  spheres_.back().center = Vector3<float>(0, 0, -3);
+  tree_.UpdateLeaf(spheres_.size() - 1, spheres_.back());
+  spheres_.front().center = Vector3<float>(0, 0, 3);
+  tree_.UpdateLeaf(0, spheres_.front());
+  std::vector<bool> visible;
+  tree_.Cull({frustum}, &visible);
+  EXPECT_TRUE(visible.back());
+  EXPECT_FALSE(visible.front());
+  ExpectCullMatchesBruteForce({frustum});
+
+  // A leaf that becomes infinite is always visible.
+  spheres_.front() = BoundingSphere{};
+  tree_.UpdateLeaf(0, spheres_.front());
+  ExpectCullMatchesBruteForce({ViewFrustum(MakeClipMatrix(100))});
+}
+
+GTEST_TEST(BoundingSphereTreeEdgeTest, SmallTrees) {
+  const ViewFrustum frustum(MakeClipMatrix());
+  BoundingSphereTree tree;
+  std::vector<bool> visible{true};
+  tree.Cull({frustum}, &visible);
+  EXPECT_TRUE(visible.empty());
+
+  tree.Rebuild({BoundingSphere{{0, 0, -5}, 1}});
+  EXPECT_EQ(tree.num_leaves(), 1);
+  tree.Cull({frustum}, &visible);
+  EXPECT_EQ(visible, std::vector<bool>{true});
+
+  tree.Rebuild({});
+  EXPECT_EQ(tree.num_leaves(), 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -15,6 +15,15 @@ GTEST_TEST(RenderEngineGl, NoRenderEngineGlSupport) {
                               "use a different render engine.");
 }
 
+// Tests that no GPUs are reported for headless rendering, and that a pool can't
+// be constructed.
+GTEST_TEST(RenderEngineGl, NoRenderEngineGlPoolSupport) {
+  EXPECT_EQ(GetRenderEngineGlDeviceCount(), 0);
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderEngineGlPool(), std::runtime_error,
+                              "RenderEngineGl was not compiled. You'll need to "
+                              "use a different render engine.");
+}
+
 }  // namespace
 }  // namespace render
 }  // namespace geometry
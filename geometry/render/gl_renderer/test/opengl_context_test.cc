@@ -1,5 +1,7 @@
 #include "drake/geometry/render/gl_renderer/opengl_context.h"
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -50,6 +52,40 @@ GTEST_TEST(OpenGlContext, WindowVisibility) {
   EXPECT_FALSE(opengl_context.IsWindowViewable());
 }
 
+// Tests that headless contexts can be obtained on each available GPU, and that
+// they have no window. This test does nothing on a machine without EGL devices.
+// It runs on its own thread, because a thread should not switch between the
+// GLX contexts of the other tests and headless contexts.
+GTEST_TEST(OpenGlContext, HeadlessContext) {
+  std::thread thread([]() {
+    const int num_devices = OpenGlContext::num_egl_devices();
+    for (int device = 0; device < num_devices; ++device) {
+      OpenGlContext headless_context(false, device);
+      EXPECT_TRUE(headless_context.is_headless());
+      headless_context.MakeCurrent();
+      EXPECT_FALSE(glIsEnabled(GL_BLEND));
+      glEnable(GL_BLEND);
+      EXPECT_TRUE(glIsEnabled(GL_BLEND));
+
+      // There is no window to display.
+      headless_context.DisplayWindow(640, 480);
+      EXPECT_FALSE(headless_context.IsWindowViewable());
+      headless_context.HideWindow();
+      EXPECT_FALSE(headless_context.IsWindowViewable());
+
+      // Switching to another headless context and back.
+      OpenGlContext other_context(false, device);
+      EXPECT_FALSE(glIsEnabled(GL_BLEND));
+      headless_context.MakeCurrent();
+      EXPECT_TRUE(glIsEnabled(GL_BLEND));
+    }
+
+    EXPECT_THROW(OpenGlContext(false, num_devices), std::runtime_error);
+    EXPECT_THROW(OpenGlContext(false, -1), std::runtime_error);
+  });
+  thread.join();
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace render
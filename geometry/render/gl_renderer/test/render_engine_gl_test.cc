@@ -1,8 +1,12 @@
 #include "drake/geometry/render/gl_renderer/render_engine_gl.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
+#include <map>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -10,6 +14,7 @@
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
+#include "drake/geometry/render/gl_renderer/render_engine_gl_factory.h"
 #include "drake/geometry/render/render_label.h"
 #include "drake/systems/sensors/color_palette.h"
 #include "drake/systems/sensors/image.h"
@@ -37,6 +42,15 @@ class RenderEngineGlTester {
     return const_cast<RenderEngineGl&>(engine_).GetMesh(filename);
   }
 
+  // Reports the number of instanced draw calls used to render the scene.
+  int num_instance_batches() const {
+    engine_.UpdateInstances();
+    return engine_.instances_.batches.size();
+  }
+
+  // Reports the number of visuals culled by the most recent render.
+  int num_culled_instances() const { return engine_.instances_.num_culled; }
+
  private:
   const RenderEngineGl& engine_;
 };
@@ -124,6 +138,25 @@ struct RgbaColor {
   int a;
 };
 
+// Tests that the rgb channels of the pixel of `image` at `coord` each differ
+// from `expected` by no more than `tolerance`. The alpha channel must be
+// opaque.
+::testing::AssertionResult IsColorNear(const ImageRgba8U& image,
+                                       const ScreenCoord& coord,
+                                       const RgbaColor& expected,
+                                       int tolerance = 2) {
+  const RgbaColor actual(image.at(coord.x, coord.y));
+  if (std::abs(actual.r - expected.r) <= tolerance &&
+      std::abs(actual.g - expected.g) <= tolerance &&
+      std::abs(actual.b - expected.b) <= tolerance && actual.a == 255) {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure()
+         << "Expected color at " << coord << " to be (" << expected.r << ", "
+         << expected.g << ", " << expected.b << ", 255). Found (" << actual.r
+         << ", " << actual.g << ", " << actual.b << ", " << actual.a << ")";
+}
+
 class RenderEngineGlTest : public ::testing::Test {
  public:
   RenderEngineGlTest()
@@ -249,8 +282,9 @@ class RenderEngineGlTest : public ::testing::Test {
   void SetUp() override {}
 
   // All tests on this class must invoke this first.
-  void SetUp(const RigidTransformd& X_WR, bool add_terrain = false) {
-    renderer_ = make_unique<RenderEngineGl>();
+  void SetUp(const RigidTransformd& X_WR, bool add_terrain = false,
+             const RenderEngineGlParams& params = {}) {
+    renderer_ = make_unique<RenderEngineGl>(params);
     renderer_->UpdateViewpoint(X_WR);
 
     if (add_terrain) {
@@ -382,6 +416,105 @@ TEST_F(RenderEngineGlTest, TerrainTest) {
   }
 }
 
+// Tests that pipelined readback returns each image one render call late: the
+// first call returns its own image, and every later call returns the image of
+// the call before it.
+TEST_F(RenderEngineGlTest, PipelinedReadback) {
+  RenderEngineGlParams params;
+  params.pipelined_readback = true;
+  SetUp(X_WR_, true, params);
+
+  const std::array<float, 4> depths{{2.f, 2.5f, 3.f, 3.5f}};
+  Vector3d p_WR = X_WR_.translation();
+  for (int i = 0; i < static_cast<int>(depths.size()); ++i) {
+    p_WR.z() = depths[i];
+    X_WR_.set_translation(p_WR);
+    renderer_->UpdateViewpoint(X_WR_);
+    Render();
+    SCOPED_TRACE(fmt::format("PipelinedReadback: render call {}", i));
+    VerifyUniformDepth(depths[std::max(i - 1, 0)]);
+    VerifyUniformLabel(RenderLabel::kDontCare);
+  }
+
+  // A clone does not inherit the pending image; its first call returns its own
+  // image.
+  p_WR.z() = 4.f;
+  X_WR_.set_translation(p_WR);
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  RenderEngineGl* gl_clone = dynamic_cast<RenderEngineGl*>(clone.get());
+  ASSERT_NE(gl_clone, nullptr);
+  gl_clone->UpdateViewpoint(X_WR_);
+  Render(gl_clone);
+  SCOPED_TRACE("PipelinedReadback: first render call of a clone");
+  VerifyUniformDepth(4.f);
+}
+
+// Tests that RenderImages() renders each camera of a batch as if it had been
+// rendered on its own, including batches with more cameras than fit in a
+// single pass and with cameras of different sizes.
+TEST_F(RenderEngineGlTest, RenderImagesBatch) {
+  SetUp(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+
+  // Cameras at different heights above the sphere and terrain; every third
+  // camera has a smaller image.
+  const int kNumCameras = 11;
+  std::vector<DepthCameraProperties> cameras;
+  std::vector<RigidTransformd> X_WCs;
+  for (int i = 0; i < kNumCameras; ++i) {
+    const bool small = i % 3 == 2;
+    cameras.emplace_back(small ? kWidth / 2 : kWidth,
+                         small ? kHeight / 2 : kHeight, kFovY, "n/a", kZNear,
+                         kZFar);
+    RigidTransformd X_WC = X_WR_;
+    X_WC.set_translation(Vector3d(0, 0, 2 + 0.25 * i));
+    X_WCs.push_back(X_WC);
+  }
+
+  std::vector<ImageDepth32F> depths;
+  std::vector<ImageLabel16I> labels;
+  for (const auto& camera : cameras) {
+    depths.emplace_back(camera.width, camera.height);
+    labels.emplace_back(camera.width, camera.height);
+  }
+  ImageRenderBatch batch;
+  for (int i = 0; i < kNumCameras; ++i) {
+    batch.depth_images.push_back({cameras[i], X_WCs[i], &depths[i]});
+    batch.label_images.push_back({cameras[i], X_WCs[i], &labels[i]});
+  }
+  renderer_->RenderImages(batch);
+
+  for (int i = 0; i < kNumCameras; ++i) {
+    SCOPED_TRACE(fmt::format("RenderImagesBatch: camera {}", i));
+    ImageDepth32F expected_depth(cameras[i].width, cameras[i].height);
+    ImageLabel16I expected_label(cameras[i].width, cameras[i].height);
+    renderer_->UpdateViewpoint(X_WCs[i]);
+    Render(renderer_.get(), &cameras[i], &expected_depth, &expected_label);
+    for (int y = 0; y < cameras[i].height; ++y) {
+      for (int x = 0; x < cameras[i].width; ++x) {
+        ASSERT_NEAR(depths[i].at(x, y)[0], expected_depth.at(x, y)[0],
+                    kDepthTolerance)
+            << "At pixel (" << x << ", " << y << ")";
+        ASSERT_EQ(labels[i].at(x, y)[0], expected_label.at(x, y)[0])
+            << "At pixel (" << x << ", " << y << ")";
+      }
+    }
+  }
+
+  // Color images are rendered one camera at a time, but still match.
+  ImageRgba8U color(kWidth, kHeight);
+  ImageRenderBatch color_batch;
+  color_batch.color_images.push_back({camera_, X_WCs[1], &color});
+  renderer_->UpdateViewpoint(X_WR_);
+  renderer_->RenderImages(color_batch);
+  ImageRgba8U expected_color(kWidth, kHeight);
+  renderer_->UpdateViewpoint(X_WCs[1]);
+  renderer_->RenderColorImage(camera_, kShowWindow, &expected_color);
+  EXPECT_EQ(std::memcmp(color.at(0, 0), expected_color.at(0, 0),
+                        color.size() * sizeof(uint8_t)),
+            0);
+}
+
 // Performs the shape centered in the image with a box.
 TEST_F(RenderEngineGlTest, BoxTest) {
   SetUp(X_WR_, true);
@@ -974,13 +1107,291 @@ TEST_F(RenderEngineGlTest, RendererIndependence) {
   ASSERT_TRUE(ImagesExactlyEqual(reference_1, depth_));
 }
 
-TEST_F(RenderEngineGlTest, RenderColorImageThrows) {
-  RenderEngineGl engine;
-  CameraProperties camera{2, 2, M_PI, "junk"};
-  ImageRgba8U image{camera.width, camera.height};
-  DRAKE_EXPECT_THROWS_MESSAGE(engine.RenderColorImage(camera, false, &image),
-                              std::runtime_error,
-                              "RenderEngineGl cannot render color images");
+// Tests that an empty scene renders entirely as the clear color, which can be
+// configured.
+TEST_F(RenderEngineGlTest, ColorNoBody) {
+  for (const Vector3d& clear_color :
+       {RenderEngineGlParams().default_clear_color, Vector3d(0.2, 0.4, 0.6)}) {
+    RenderEngineGlParams params;
+    params.default_clear_color = clear_color;
+    SetUp(RigidTransformd::Identity(), false, params);
+    ImageRgba8U color(kWidth, kHeight);
+    renderer_->RenderColorImage(camera_, kShowWindow, &color);
+    const RgbaColor expected(Vector4d(clear_color(0), clear_color(1),
+                                      clear_color(2), 1.0));
+    for (int y = 0; y < kHeight; ++y) {
+      for (int x = 0; x < kWidth; ++x) {
+        ASSERT_TRUE(IsColorNear(color, ScreenCoord(x, y), expected, 1));
+      }
+    }
+  }
+}
+
+// Tests that geometry facing the camera gets its diffuse color -- the given
+// one for the sphere and the configurable default for the terrain -- and that
+// light falls off for surfaces that are oblique to the camera.
+TEST_F(RenderEngineGlTest, ColorDiffuse) {
+  RenderEngineGlParams params;
+  params.default_diffuse = Vector4d(0.2, 0.6, 0.4, 1.0);
+  SetUp(X_WR_, true, params);
+  ImageRgba8U color(kWidth, kHeight);
+
+  renderer_->RenderColorImage(camera_, kShowWindow, &color);
+  const RgbaColor terrain_color(params.default_diffuse);
+  EXPECT_TRUE(IsColorNear(color, GetInlier(camera_), terrain_color));
+  // The terrain is seen at an angle in the corners of the image, so it is
+  // darker there.
+  const ScreenCoord corner = GetOutliers(camera_)[0];
+  EXPECT_LT(RgbaColor(color.at(corner.x, corner.y)).g, terrain_color.g - 5);
+
+  PopulateSphereTest(renderer_.get());
+  renderer_->RenderColorImage(camera_, kShowWindow, &color);
+  EXPECT_TRUE(IsColorNear(color, GetInlier(camera_), default_color_));
+}
+
+// Tests that a mesh with texture coordinates gets the color of its diffuse
+// map, and that the diffuse color is used for a diffuse map that can't be
+// read or for a geometry without texture coordinates.
+TEST_F(RenderEngineGlTest, ColorDiffuseMap) {
+  // box.png contains a single color.
+  const RgbaColor texture_color(ColorI{4, 241, 33}, 255);
+  const std::string texture_name =
+      FindResourceOrThrow("drake/systems/sensors/test/models/meshes/box.png");
+  const std::string mesh_name =
+      FindResourceOrThrow("drake/systems/sensors/test/models/meshes/box.obj");
+
+  const Mesh mesh(mesh_name);
+  const Box box(2, 2, 2);
+  struct TestCase {
+    const Shape* shape;
+    std::string diffuse_map;
+    RgbaColor expected;
+  };
+  for (const TestCase& test_case :
+       {TestCase{&mesh, texture_name, texture_color},
+        TestCase{&mesh, "bad_path", default_color_},
+        TestCase{&box, texture_name, default_color_}}) {
+    SCOPED_TRACE(fmt::format("ColorDiffuseMap: diffuse map {} on {}",
+                             test_case.diffuse_map,
+                             test_case.shape == &mesh ? "mesh" : "box"));
+    SetUp(X_WR_, true);
+    PerceptionProperties material = simple_material();
+    material.AddProperty("phong", "diffuse_map", test_case.diffuse_map);
+    renderer_->RegisterVisual(GeometryId::get_new_id(), *test_case.shape,
+                              material, RigidTransformd::Identity(),
+                              false /* needs update */);
+    ImageRgba8U color(kWidth, kHeight);
+    renderer_->RenderColorImage(camera_, kShowWindow, &color);
+    EXPECT_TRUE(IsColorNear(color, GetInlier(camera_), test_case.expected));
+  }
+}
+
+// Tests that visuals sharing a geometry are drawn together with a single
+// instanced draw call, and that each instance still gets its own pose, scale,
+// and label -- including after poses are updated and instances are removed.
+TEST_F(RenderEngineGlTest, InstancedGeometry) {
+  SetUp(X_WR_, true);
+  RenderEngineGlTester tester(renderer_.get());
+
+  // A row of small spheres and boxes (both of which are instances of unit
+  // geometries), each with a unique label.
+  const int kNumPerShape = 5;
+  std::vector<GeometryId> ids;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  for (int i = 0; i < 2 * kNumPerShape; ++i) {
+    const bool is_sphere = i < kNumPerShape;
+    const GeometryId id = GeometryId::get_new_id();
+    PerceptionProperties material;
+    material.AddProperty("label", "id", RenderLabel(i + 1));
+    const double size = 0.05 + 0.01 * i;
+    if (is_sphere) {
+      renderer_->RegisterVisual(id, Sphere(size), material,
+                                RigidTransformd::Identity(), true);
+    } else {
+      renderer_->RegisterVisual(id, Box(size, size, size), material,
+                                RigidTransformd::Identity(), true);
+    }
+    ids.push_back(id);
+    X_WGs[id] = RigidTransformd(Vector3d(-0.9 + 0.2 * i, 0, 0.2));
+  }
+  renderer_->UpdatePoses(X_WGs);
+  // The spheres, the boxes, and the terrain.
+  EXPECT_EQ(tester.num_instance_batches(), 3);
+
+  // Counts the pixels of each label.
+  auto count_labels = [this](RenderEngineGl* renderer = nullptr) {
+    std::map<int, int> counts;
+    Render(renderer);
+    for (int y = 0; y < kHeight; ++y) {
+      for (int x = 0; x < kWidth; ++x) {
+        ++counts[label_.at(x, y)[0]];
+      }
+    }
+    return counts;
+  };
+
+  std::map<int, int> counts = count_labels();
+  for (int i = 0; i < 2 * kNumPerShape; ++i) {
+    EXPECT_GT(counts[i + 1], 0) << "Label " << i + 1;
+    // Each instance has its own scale.
+    if (i > 0 && i != kNumPerShape) {
+      EXPECT_GT(counts[i + 1], counts[i]) << "Label " << i + 1;
+    }
+  }
+
+  // Moving one instance out of view only affects that instance.
+  X_WGs[ids[1]] = RigidTransformd(Vector3d(100, 0, 0.2));
+  renderer_->UpdatePoses(X_WGs);
+  std::map<int, int> moved_counts = count_labels();
+  EXPECT_EQ(moved_counts[2], 0);
+  for (int i = 0; i < 2 * kNumPerShape; ++i) {
+    if (i != 1) EXPECT_EQ(moved_counts[i + 1], counts[i + 1]);
+  }
+
+  // Removing an instance keeps the rest of its batch.
+  renderer_->RemoveGeometry(ids[2]);
+  std::map<int, int> removed_counts = count_labels();
+  EXPECT_EQ(removed_counts[3], 0);
+  EXPECT_EQ(removed_counts[1], counts[1]);
+  EXPECT_EQ(removed_counts[4], counts[4]);
+  EXPECT_EQ(tester.num_instance_batches(), 3);
+
+  // A clone draws its own instances without disturbing the original's.
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  RenderEngineGl* gl_clone = dynamic_cast<RenderEngineGl*>(clone.get());
+  ASSERT_NE(gl_clone, nullptr);
+  gl_clone->RemoveGeometry(ids[0]);
+  std::map<int, int> clone_counts = count_labels(gl_clone);
+  EXPECT_EQ(clone_counts[1], 0);
+  EXPECT_EQ(clone_counts[4], counts[4]);
+  std::map<int, int> original_counts = count_labels();
+  EXPECT_EQ(original_counts[1], counts[1]);
+  EXPECT_EQ(original_counts[4], counts[4]);
+}
+
+// Tests that the visuals outside of a camera's view are culled, and that
+// culling doesn't change what the camera sees.
+TEST_F(RenderEngineGlTest, FrustumCulling) {
+  SetUp(X_WR_, true);
+  RenderEngineGlTester tester(renderer_.get());
+
+  // One sphere in view (label 1), a row of them far off to the side (label 2),
+  // and one above (i.e., behind) the camera (label 3).
+  const int kNumOffside = 10;
+  std::vector<GeometryId> offside_ids;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  auto add_sphere = [this, &X_WGs](int label, const Vector3d& p_WG) {
+    const GeometryId id = GeometryId::get_new_id();
+    PerceptionProperties material;
+    material.AddProperty("label", "id", RenderLabel(label));
+    renderer_->RegisterVisual(id, Sphere(0.2), material,
+                              RigidTransformd::Identity(), true);
+    X_WGs[id] = RigidTransformd(p_WG);
+    return id;
+  };
+  add_sphere(1, Vector3d(0, 0, 0.2));
+  for (int i = 0; i < kNumOffside; ++i) {
+    offside_ids.push_back(add_sphere(2, Vector3d(50 + i, 0, 0.2)));
+  }
+  add_sphere(3, Vector3d(0, 0, kDefaultDistance + 1));
+  renderer_->UpdatePoses(X_WGs);
+
+  auto count_labels = [](const ImageLabel16I& label) {
+    std::map<int, int> counts;
+    for (int y = 0; y < label.height(); ++y) {
+      for (int x = 0; x < label.width(); ++x) {
+        ++counts[label.at(x, y)[0]];
+      }
+    }
+    return counts;
+  };
+
+  Render();
+  EXPECT_EQ(tester.num_culled_instances(), kNumOffside + 1);
+  std::map<int, int> counts = count_labels(label_);
+  EXPECT_GT(counts[1], 0);
+  EXPECT_EQ(counts[2], 0);
+  EXPECT_EQ(counts[3], 0);
+
+  // Moving a sphere into view (with UpdatePoses(), which refits the bounding
+  // volumes) makes it visible.
+  X_WGs[offside_ids[0]] = RigidTransformd(Vector3d(0.5, 0, 0.2));
+  renderer_->UpdatePoses(X_WGs);
+  Render();
+  EXPECT_EQ(tester.num_culled_instances(), kNumOffside);
+  counts = count_labels(label_);
+  EXPECT_GT(counts[2], 0);
+  EXPECT_EQ(counts[3], 0);
+
+  // A batch of cameras culls the visuals outside of all of their views; each
+  // camera still only sees what's in its own view.
+  RigidTransformd X_WC = X_WR_;
+  X_WC.set_translation(Vector3d(55, 0, kDefaultDistance));
+  ImageLabel16I label_origin(kWidth, kHeight);
+  ImageLabel16I label_offside(kWidth, kHeight);
+  ImageRenderBatch batch;
+  batch.label_images.push_back({camera_, X_WR_, &label_origin});
+  batch.label_images.push_back({camera_, X_WC, &label_offside});
+  renderer_->RenderImages(batch);
+  // The offside camera sees the spheres at x = 54, 55, and 56; the others
+  // that are still offside, and the sphere behind the cameras, are culled.
+  EXPECT_EQ(tester.num_culled_instances(), 7);
+  std::map<int, int> origin_counts = count_labels(label_origin);
+  EXPECT_EQ(origin_counts[1], counts[1]);
+  EXPECT_EQ(origin_counts[2], counts[2]);
+  std::map<int, int> offside_counts = count_labels(label_offside);
+  EXPECT_EQ(offside_counts[1], 0);
+  EXPECT_GT(offside_counts[2], 0);
+}
+
+// Tests that the engines made by a RenderEngineGlPool render headless, and
+// concurrently on their own threads. This test does nothing on a machine
+// without EGL devices.
+TEST_F(RenderEngineGlTest, HeadlessPool) {
+  if (GetRenderEngineGlDeviceCount() == 0) return;
+
+  RenderEngineGlPool pool;
+  const int num_threads = 2 * pool.devices().size();
+  std::vector<GeometryId> ids;
+  for (int i = 0; i < num_threads; ++i) {
+    ids.push_back(GeometryId::get_new_id());
+  }
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([this, &pool, &ids, i]() {
+      unique_ptr<RenderEngine> engine = pool.MakeRenderEngine();
+      PerceptionProperties material;
+      material.AddProperty("label", "id", RenderLabel::kDontCare);
+      engine->RegisterVisual(ids[i], HalfSpace(), material,
+                             RigidTransformd::Identity(), false);
+      // Each thread's camera is at its own height above the terrain.
+      const double distance = 2 + 0.25 * i;
+      RigidTransformd X_WC = X_WR_;
+      X_WC.set_translation(Vector3d(0, 0, distance));
+      engine->UpdateViewpoint(X_WC);
+
+      ImageDepth32F depth(kWidth, kHeight);
+      ImageLabel16I label(kWidth, kHeight);
+      engine->RenderDepthImage(camera_, &depth);
+      // There is no window to show; the request is ignored.
+      engine->RenderLabelImage(camera_, true, &label);
+      for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+          ASSERT_NEAR(depth.at(x, y)[0], distance, kDepthTolerance)
+              << "At pixel (" << x << ", " << y << ") of thread " << i;
+          ASSERT_EQ(label.at(x, y)[0],
+                    static_cast<int>(RenderLabel::kDontCare))
+              << "At pixel (" << x << ", " << y << ") of thread " << i;
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_THROW(RenderEngineGlPool({}, {num_threads}),
+               std::runtime_error);
 }
 
 // Confirms that passing in show_window = true "works". The test can't confirm
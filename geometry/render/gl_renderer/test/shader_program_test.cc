@@ -23,6 +23,17 @@ constexpr char kVertexSource[] = R"""(
   }
 )""";
 
+constexpr char kGeometrySource[] = R"""(
+  #version 330
+  layout(points) in;
+  layout(points, max_vertices = 1) out;
+  void main() {
+    gl_Position = gl_in[0].gl_Position;
+    EmitVertex();
+    EndPrimitive();
+  }
+)""";
+
 constexpr char kFragmentSource[] = R"""(
   #version 330
   uniform float test_uniform;
@@ -67,6 +78,14 @@ TEST_F(ShaderProgramTest, LoadShaders) {
     EXPECT_NE(program_id(program), 0);
   }
 
+  {
+    // Case: Load from in-memory vertex, geometry, and fragment shaders.
+    ShaderProgram program;
+    EXPECT_NO_THROW(program.LoadFromSources(kVertexSource, kGeometrySource,
+                                            kFragmentSource));
+    EXPECT_NE(program_id(program), 0);
+  }
+
   {
     // Case: Load the same shaders from disk.
     auto write_shader = [](const string& file_name, const char* shader) {
@@ -111,6 +130,14 @@ TEST_F(ShaderProgramTest, LoadShadersError) {
         std::runtime_error,
         "Error compiling fragment shader[^]+");
   }
+  {
+    // Case: Bad geometry shader.
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        program.LoadFromSources(kVertexSource, "This is garbage",
+                                kFragmentSource),
+        std::runtime_error,
+        "Error compiling geometry shader[^]+");
+  }
   {
     // Case: Both shaders are bad. This stops at reporting the vertex error.
     DRAKE_EXPECT_THROWS_MESSAGE(
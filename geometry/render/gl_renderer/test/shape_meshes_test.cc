@@ -198,6 +198,43 @@ GTEST_TEST(LoadMeshFromObjTest, RemoveUnreferencedVertices) {
   EXPECT_EQ(mesh_data.indices.rows(), 2);
 }
 
+// Texture coordinates are a per-vertex quantity like normals: a vertex
+// position referenced with two different texture coordinates becomes two
+// vertices. Face vertices without texture coordinates get (0, 0).
+GTEST_TEST(LoadMeshFromObjTest, TextureCoordinates) {
+  std::stringstream in_stream(R"""(
+  v -1 -1 0
+  v 1 -1 0
+  v 1 1 0
+  v -1 1 0
+  vn 0 0 1
+  vt 0 0
+  vt 1 0
+  vt 1 1
+  vt 0.5 0.25
+  f 1/1/1 2/2/1 3/3/1
+  f 1/4/1 3/3/1 4//1
+  )""");
+  MeshData mesh_data = LoadMeshFromObj(&in_stream);
+  // Vertex 1 appears with two texture coordinates; vertex 3 with one.
+  EXPECT_EQ(mesh_data.positions.rows(), 5);
+  EXPECT_EQ(mesh_data.normals.rows(), 5);
+  ASSERT_EQ(mesh_data.uvs.rows(), 5);
+  EXPECT_EQ(mesh_data.indices.rows(), 2);
+
+  // The second face is (1/4, 3/3, 4/none).
+  const auto& face = mesh_data.indices.row(1);
+  EXPECT_TRUE(CompareMatrices(mesh_data.positions.row(face(0)),
+                              Vector3f(-1, -1, 0).transpose()));
+  EXPECT_TRUE(CompareMatrices(mesh_data.uvs.row(face(0)),
+                              Vector2<GLfloat>(0.5, 0.25).transpose()));
+  EXPECT_EQ(face(1), mesh_data.indices(0, 2));
+  EXPECT_TRUE(CompareMatrices(mesh_data.uvs.row(face(1)),
+                              Vector2<GLfloat>(1, 1).transpose()));
+  EXPECT_TRUE(CompareMatrices(mesh_data.uvs.row(face(2)),
+                              Vector2<GLfloat>(0, 0).transpose()));
+}
+
 // Computes the normal to the indicated triangle whose magnitude is twice the
 // triangle's area. I.e., for triangle (A, B, C), computes: (B - A) X (C - A).
 Vector3f CalcTriNormal(const MeshData& data, int tri_index) {
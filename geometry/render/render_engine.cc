@@ -81,6 +81,35 @@ RenderLabel RenderEngine::GetRenderLabelOrThrow(
   return label;
 }
 
+void RenderEngine::RenderImages(const ImageRenderBatch& batch) {
+  auto validate = [](const auto& requests, const char* image_type) {
+    for (const auto& request : requests) {
+      ThrowIfInvalid(CameraInfo(request.camera.width, request.camera.height,
+                                request.camera.fov_y),
+                     request.image, image_type);
+    }
+  };
+  validate(batch.color_images, "color");
+  validate(batch.depth_images, "depth");
+  validate(batch.label_images, "label");
+  DoRenderImages(batch);
+}
+
+void RenderEngine::DoRenderImages(const ImageRenderBatch& batch) {
+  for (const ColorImageRequest& request : batch.color_images) {
+    UpdateViewpoint(request.X_WC);
+    RenderColorImage(request.camera, false, request.image);
+  }
+  for (const DepthImageRequest& request : batch.depth_images) {
+    UpdateViewpoint(request.X_WC);
+    RenderDepthImage(request.camera, request.image);
+  }
+  for (const LabelImageRequest& request : batch.label_images) {
+    UpdateViewpoint(request.X_WC);
+    RenderLabelImage(request.camera, false, request.image);
+  }
+}
+
 void RenderEngine::DoRenderColorImage(const ColorRenderCamera& camera,
                                       ImageRgba8U* color_image_out) const {
   // TODO(SeanCurtis-TRI): Consider modifying this warning (and those for the
@@ -26,6 +26,35 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+/** One image for RenderEngine::RenderImages() to render: the camera, its pose
+ in the world frame, and the image to write.
+ @tparam CameraType  CameraProperties or DepthCameraProperties.
+ @tparam ImageType   The type of the output image.  */
+template <typename CameraType, typename ImageType>
+struct ImageRenderRequest {
+  /** The intrinsic properties of the camera.  */
+  CameraType camera;
+  /** The pose of the camera in the world frame.  */
+  math::RigidTransformd X_WC;
+  /** The rendered image.  */
+  ImageType* image{};
+};
+
+using ColorImageRequest =
+    ImageRenderRequest<CameraProperties, systems::sensors::ImageRgba8U>;
+using DepthImageRequest =
+    ImageRenderRequest<DepthCameraProperties, systems::sensors::ImageDepth32F>;
+using LabelImageRequest =
+    ImageRenderRequest<CameraProperties, systems::sensors::ImageLabel16I>;
+
+/** The collection of images rendered by a single call to
+ RenderEngine::RenderImages().  */
+struct ImageRenderBatch {
+  std::vector<ColorImageRequest> color_images;
+  std::vector<DepthImageRequest> depth_images;
+  std::vector<LabelImageRequest> label_images;
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -280,6 +309,28 @@ class RenderEngine : public ShapeReifier {
 
   //@}
 
+  /** @name Batched rendering
+
+   Rendering the images of many cameras (or several image types of a single
+   camera) one call at a time repeats the work common to all of them, e.g.,
+   traversing the scene. This method hands all of the images to the engine at
+   once so that an implementation can share that work.
+   */
+  //@{
+
+  /** Renders every image in `batch`, each from the pose of its own camera.
+   The result is the same as calling UpdateViewpoint() with each request's
+   `X_WC`, followed by the corresponding simple camera Render*Image() method
+   (without showing a window). After this call, the engine's viewpoint is
+   unspecified; call UpdateViewpoint() before rendering a single image again.
+
+   @throws std::logic_error if any request's image is `nullptr` or the size of
+                            the image doesn't match the size declared in its
+                            camera.  */
+  void RenderImages(const ImageRenderBatch& batch);
+
+  //@}
+
   /** Reports the render label value this render engine has been configured to
    use.  */
   RenderLabel default_render_label() const { return default_render_label_; }
@@ -358,6 +409,14 @@ class RenderEngine : public ShapeReifier {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** The NVI-function for rendering a batch of images. When RenderImages calls
+   this, it has already confirmed that every output image is not `nullptr` and
+   its size is consistent with its camera.
+
+   The default implementation renders the images one at a time, as described
+   in RenderImages().  */
+  virtual void DoRenderImages(const ImageRenderBatch& batch);
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -1,5 +1,8 @@
 #include "drake/geometry/render/render_engine_ospray.h"
 
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <fstream>
 #include <limits>
 #include <optional>
@@ -8,6 +11,7 @@
 
 #include <vtkCamera.h>
 #include <vtkCylinderSource.h>
+#include <vtkMatrix4x4.h>
 #include <vtkOBJReader.h>
 #include <vtkOSPRayLightNode.h>
 #include <vtkOSPRayMaterialLibrary.h>
@@ -21,6 +25,8 @@
 #include <vtkTransform.h>
 #include <vtkTransformPolyDataFilter.h>
 
+#include <fmt/format.h>
+
 #include "drake/common/text_logging.h"
 #include "drake/geometry/render/render_engine_vtk_base.h"
 #include "drake/systems/sensors/color_palette.h"
@@ -76,6 +82,32 @@ struct RegistrationData {
   std::optional<std::string> mesh_filename;
 };
 
+// Reports if the `actor`'s user transform is exactly `X_WG`.
+bool IsPosedAt(vtkActor* actor, vtkTransform* X_WG) {
+  vtkLinearTransform* current = actor->GetUserTransform();
+  if (current == nullptr) return false;
+  const vtkMatrix4x4& a = *current->GetMatrix();
+  const vtkMatrix4x4& b = *X_WG->GetMatrix();
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      if (a.GetElement(i, j) != b.GetElement(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+// Computes the mean absolute difference of the rgb channels of two rgba
+// images of the same size.
+double MeanRgbChange(const uint8_t* a, const uint8_t* b, int num_pixels) {
+  int64_t sum = 0;
+  for (int i = 0; i < num_pixels; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      sum += std::abs(static_cast<int>(a[4 * i + c]) - b[4 * i + c]);
+    }
+  }
+  return static_cast<double>(sum) / (3.0 * num_pixels);
+}
+
 std::string RemoveFileExtension(const std::string& filepath) {
   const size_t last_dot = filepath.find_last_of(".");
   if (last_dot == std::string::npos) {
@@ -89,7 +121,29 @@ std::string RemoveFileExtension(const std::string& filepath) {
 RenderEngineOspray::RenderEngineOspray(const RenderEngineOsprayParams& params)
     : RenderEngine(RenderLabel::kUnspecified),
       pipelines_{{make_unique<RenderingPipeline>()}},
-      render_mode_(params.mode) {
+      render_mode_(params.mode),
+      max_accumulated_passes_(params.max_accumulated_passes),
+      time_budget_(params.time_budget),
+      convergence_threshold_(params.convergence_threshold),
+      reuse_accumulation_(params.reuse_accumulation) {
+  if (max_accumulated_passes_ < 1) {
+    throw std::logic_error(fmt::format(
+        "RenderEngineOspray: the maximum number of accumulated passes must be "
+        "positive; got {}",
+        max_accumulated_passes_));
+  }
+  if (time_budget_ && !(*time_budget_ > 0)) {
+    throw std::logic_error(fmt::format(
+        "RenderEngineOspray: the time budget must be positive; got {}",
+        *time_budget_));
+  }
+  if (convergence_threshold_ && !(*convergence_threshold_ >= 0)) {
+    throw std::logic_error(fmt::format(
+        "RenderEngineOspray: the convergence threshold must be non-negative; "
+        "got {}",
+        *convergence_threshold_));
+  }
+
   if (params.default_diffuse) {
     default_diffuse_ = *params.default_diffuse;
   }
@@ -103,6 +157,10 @@ RenderEngineOspray::RenderEngineOspray(const RenderEngineOsprayParams& params)
 }
 
 void RenderEngineOspray::UpdateViewpoint(const RigidTransformd& X_WC) {
+  if (X_WC.IsExactlyEqualTo(X_WC_)) return;
+  X_WC_ = X_WC;
+  ResetAccumulation();
+
   vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
 
   for (const auto& pipeline : pipelines_) {
@@ -114,13 +172,55 @@ void RenderEngineOspray::UpdateViewpoint(const RigidTransformd& X_WC) {
 void RenderEngineOspray::RenderColorImage(const CameraProperties& camera,
                                           bool show_window,
                                           ImageRgba8U* color_image_out) const {
-  UpdateWindow(camera, show_window, pipelines_[ImageType::kColor].get(),
-               "Color Image");
-  PerformVtkUpdate(*pipelines_[ImageType::kColor]);
+  const RenderingPipeline& pipeline = *pipelines_[ImageType::kColor];
+  const bool same_window =
+      accumulation_.camera && accumulation_.camera->width == camera.width &&
+      accumulation_.camera->height == camera.height &&
+      accumulation_.camera->fov_y == camera.fov_y &&
+      accumulation_.show_window == show_window;
+  if (!reuse_accumulation_ || !same_window) {
+    ResetAccumulation();
+    accumulation_.camera = camera;
+    accumulation_.show_window = show_window;
+    UpdateWindow(camera, show_window, &pipeline, "Color Image");
+  }
 
+  // VTK's OSPRay renderer averages the successive frames of a renderer into
+  // its accumulation buffer until the camera is modified (see
+  // ResetAccumulation()); each call to PerformVtkUpdate() is one pass. The
+  // ray tracer is deterministic, so a single pass suffices.
   // TODO(SeanCurtis-TRI): Determine if this copies memory (and find some way
   // around copying).
-  auto& exporter = *pipelines_[ImageType::kColor]->exporter;
+  auto& exporter = *pipeline.exporter;
+  const int max_passes =
+      render_mode_ == OsprayMode::kPathTracer ? max_accumulated_passes_ : 1;
+  const int num_pixels = camera.width * camera.height;
+  const auto start = std::chrono::steady_clock::now();
+  while (!accumulation_.converged) {
+    PerformVtkUpdate(pipeline);
+    ++accumulation_.num_passes;
+    if (accumulation_.num_passes >= max_passes) {
+      accumulation_.converged = true;
+    } else if (convergence_threshold_) {
+      DRAKE_DEMAND(exporter.GetDataNumberOfScalarComponents() == 4);
+      exporter.Export(color_image_out->at(0, 0));
+      std::vector<uint8_t>& previous = accumulation_.previous_image;
+      if (accumulation_.num_passes > 1 &&
+          MeanRgbChange(previous.data(), color_image_out->at(0, 0),
+                        num_pixels) <= *convergence_threshold_) {
+        accumulation_.converged = true;
+      }
+      previous.assign(color_image_out->at(0, 0),
+                      color_image_out->at(0, 0) + 4 * num_pixels);
+    }
+    if (time_budget_) {
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      if (elapsed.count() >= *time_budget_) break;
+    }
+  }
+  if (accumulation_.converged) accumulation_.previous_image.clear();
+
   DRAKE_DEMAND(exporter.GetDataNumberOfScalarComponents() == 4);
   exporter.Export(color_image_out->at(0, 0));
 
@@ -237,6 +337,7 @@ bool RenderEngineOspray::DoRegisterVisual(
   // Note: the user_data interface on reification requires a non-const pointer.
   RegistrationData data{properties, X_FG, id};
   shape.Reify(this, &data);
+  ResetAccumulation();
   return true;
 }
 
@@ -248,16 +349,21 @@ RenderEngineOsprayParams RenderEngineOspray::get_params() const {
   return {
       render_mode_, default_diffuse_,
       Vector3d{background_color_.r, background_color_.g, background_color_.b},
-      samples_per_pixel, use_shadows};
+      samples_per_pixel, use_shadows, max_accumulated_passes_, time_budget_,
+      convergence_threshold_, reuse_accumulation_};
 }
 
 void RenderEngineOspray::DoUpdateVisualPose(GeometryId id,
                                             const RigidTransformd& X_WG) {
   vtkSmartPointer<vtkTransform> vtk_X_WG = ConvertToVtkTransform(X_WG);
+  std::array<vtkSmartPointer<vtkActor>, kNumPipelines>& actors =
+      actors_.at(id);
+  if (IsPosedAt(actors[ImageType::kColor], vtk_X_WG)) return;
+  ResetAccumulation();
   // TODO(SeanCurtis-TRI): Perhaps provide the ability to specify actors for
   //  specific pipelines; i.e. only update the color actor or only the label
   //  actor, etc.
-  for (const auto& actor : actors_.at(id)) {
+  for (const auto& actor : actors) {
     actor->SetUserTransform(vtk_X_WG);
   }
 }
@@ -274,6 +380,7 @@ bool RenderEngineOspray::DoRemoveGeometry(GeometryId id) {
     pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
   }
   actors_.erase(iter);
+  ResetAccumulation();
   return true;
 }
 
@@ -290,7 +397,12 @@ RenderEngineOspray::RenderEngineOspray(const RenderEngineOspray& other)
       pipelines_{{make_unique<RenderingPipeline>()}},
       default_diffuse_{other.default_diffuse_},
       background_color_{other.background_color_},
-      render_mode_(other.render_mode_) {
+      render_mode_(other.render_mode_),
+      max_accumulated_passes_(other.max_accumulated_passes_),
+      time_budget_(other.time_budget_),
+      convergence_threshold_(other.convergence_threshold_),
+      reuse_accumulation_(other.reuse_accumulation_),
+      X_WC_(other.X_WC_) {
   RenderEngineOsprayParams params = other.get_params();
   InitializePipelines(params.samples_per_pixel, params.use_shadows);
 
@@ -527,6 +639,15 @@ void RenderEngineOspray::PerformVtkUpdate(const RenderingPipeline& p) {
   p.filter->Update();
 }
 
+void RenderEngineOspray::ResetAccumulation() const {
+  accumulation_ = Accumulation{};
+  // Modifying the camera makes VTK's OSPRay renderer clear its accumulation
+  // buffer at its next frame.
+  for (const auto& pipeline : pipelines_) {
+    pipeline->renderer->GetActiveCamera()->Modified();
+  }
+}
+
 void RenderEngineOspray::UpdateWindow(const CameraProperties& camera,
                                       bool show_window,
                                       const RenderingPipeline* p,
@@ -2,8 +2,10 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <vtkActor.h>
 #include <vtkAutoInit.h>
@@ -117,6 +119,11 @@ class RenderEngineOspray final
   using RenderEngine::default_render_label;
   //@}
 
+  /** Returns the number of passes accumulated into the most recently rendered
+   color image (zero if no color image has been rendered yet). See
+   RenderEngineOsprayParams for progressive rendering.  */
+  int num_accumulated_passes() const { return accumulation_.num_passes; }
+
  private:
   // @see RenderEngine::DoRegisterVisual().
   bool DoRegisterVisual(GeometryId id, const Shape& shape,
@@ -176,6 +183,10 @@ class RenderEngineOspray final
 
   void SetDefaultLightPosition(const Vector3<double>& X_DL);
 
+  // Discards the passes accumulated so far (if any), so that the next color
+  // image starts a new accumulation.
+  void ResetAccumulation() const;
+
   std::array<std::unique_ptr<RenderingPipeline>, kNumPipelines> pipelines_;
 
   vtkNew<vtkOSPRayPass> ospray_;
@@ -195,6 +206,32 @@ class RenderEngineOspray final
 
   // Configuration to use path tracer or ray tracer.
   const OsprayMode render_mode_{OsprayMode::kPathTracer};
+
+  // The progressive rendering configuration; see RenderEngineOsprayParams.
+  const int max_accumulated_passes_{1};
+  const std::optional<double> time_budget_;
+  const std::optional<double> convergence_threshold_;
+  const bool reuse_accumulation_{false};
+
+  // The most recent camera pose, to detect changes of the viewpoint.
+  math::RigidTransformd X_WC_;
+
+  // The state of the progressive accumulation of the color image.
+  struct Accumulation {
+    // The window configuration the passes were rendered with; nullopt if the
+    // accumulation has been reset since.
+    std::optional<CameraProperties> camera;
+    bool show_window{false};
+    // The number of passes accumulated so far.
+    int num_passes{0};
+    // Whether no more passes are needed.
+    bool converged{false};
+    // The image of the previous pass; only used to measure convergence.
+    std::vector<uint8_t> previous_image;
+  };
+  // Mutable because rendering is const; it is reset by any change of the
+  // viewpoint or the scene.
+  mutable Accumulation accumulation_;
 };
 
 }  // namespace render
@@ -51,6 +51,41 @@ struct RenderEngineOsprayParams {
   /** Whether to turn on shadows when in the `OsprayMode::kRayTracer` rendering
    mode. It is ignored in other modes.  */
   bool use_shadows{true};
+
+  /** @name Progressive rendering
+
+   In OsprayMode::kPathTracer mode, a color image can be refined
+   progressively: each pass traces `samples_per_pixel` samples per pixel and
+   is averaged with the passes that preceded it, so the image converges as
+   passes accumulate. A color image is rendered with passes until
+   `max_accumulated_passes` passes have been accumulated, the optional
+   `time_budget` is spent, or the optional `convergence_threshold` is met,
+   whichever comes first. At least one pass is rendered whenever the
+   accumulation starts over. These parameters are ignored in other modes, in
+   which a single pass is rendered.  */
+  //@{
+
+  /** The maximum number of passes accumulated into a color image. Must be
+   positive.  */
+  int max_accumulated_passes{1};
+
+  /** The (optional) wall-clock time, in seconds, allotted to the passes of a
+   single color image. Must be positive.  */
+  std::optional<double> time_budget{};
+
+  /** The (optional) threshold on the mean absolute change of the rgb channels
+   (in byte units, [0, 255]) between two consecutive passes below which the
+   image is considered converged. Must be non-negative.  */
+  std::optional<double> convergence_threshold{};
+
+  /** If true, the accumulated passes are kept between color images as long as
+   neither the camera properties, the camera pose, nor the scene (the set of
+   geometries and their poses) changed. Successive images of a static shot
+   then continue to refine the same image rather than starting over and, once
+   it has converged, cost no more than a copy of the image. If false, every
+   color image starts a new accumulation.  */
+  bool reuse_accumulation{false};
+  //@}
 };
 
 /** Constructs a RenderEngine implementation which uses an OSPRay-based
@@ -72,6 +107,10 @@ struct RenderEngineOsprayParams {
    default color is a bright orange. This default value can be changed to a
    different value at construction.
 
+ In OsprayMode::kPathTracer mode, color images can be rendered progressively,
+ with a per-image budget of passes, time, or convergence, and static shots can
+ reuse the passes already accumulated (see RenderEngineOsprayParams).
+
  @warning This RenderEngine implementation contains a sophisticated renderer
  for advanced lighting and material affects. The above documented behavior is
  the smallest slice. In the future, the advanced features will be exposed and
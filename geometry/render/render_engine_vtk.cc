@@ -13,6 +13,7 @@
 #include <vtkOpenGLTexture.h>
 #include <vtkPNGReader.h>
 #include <vtkPlaneSource.h>
+#include <vtkPolyData.h>
 #include <vtkProperty.h>
 #include <vtkTexturedSphereSource.h>
 #include <vtkTransform.h>
@@ -99,6 +100,37 @@ struct RegistrationData {
   std::optional<std::string> mesh_filename;
 };
 
+// Returns a mapper that draws the same polygonal data as `source`. The data is
+// shared, but the copy holds its own OpenGL buffers, so that the two mappers
+// can draw in different OpenGL contexts, even on different threads. The
+// polygonal data is brought up to date here, so that drawing only reads it.
+vtkSmartPointer<vtkOpenGLPolyDataMapper> CopyMapper(vtkMapper* source) {
+  vtkPolyDataMapper* source_mapper = vtkPolyDataMapper::SafeDownCast(source);
+  DRAKE_DEMAND(source_mapper != nullptr);
+  source_mapper->Update();
+  vtkPolyData* poly_data = source_mapper->GetInput();
+  // Computes and caches the bounds that the mappers query when drawing.
+  poly_data->GetBounds();
+  vtkSmartPointer<vtkOpenGLPolyDataMapper> copy =
+      vtkSmartPointer<vtkOpenGLPolyDataMapper>::New();
+  copy->SetInputData(poly_data);
+  return copy;
+}
+
+// Returns a texture that samples the same image as `source` but which, like
+// the mappers of CopyMapper(), holds its own OpenGL state.
+vtkSmartPointer<vtkTexture> CopyTexture(vtkTexture* source) {
+  DRAKE_DEMAND(source != nullptr);
+  if (vtkAlgorithm* input = source->GetInputAlgorithm()) input->Update();
+  vtkSmartPointer<vtkOpenGLTexture> copy =
+      vtkSmartPointer<vtkOpenGLTexture>::New();
+  copy->SetInputDataObject(source->GetInputDataObject(0, 0));
+  copy->SetRepeat(source->GetRepeat());
+  copy->SetInterpolate(source->GetInterpolate());
+  copy->SetEdgeClamp(source->GetEdgeClamp());
+  return copy;
+}
+
 std::string RemoveFileExtension(const std::string& filepath) {
   const size_t last_dot = filepath.find_last_of(".");
   if (last_dot == std::string::npos) {
@@ -118,8 +150,6 @@ ShaderCallback::ShaderCallback() :
 
 }  // namespace internal
 
-vtkNew<internal::ShaderCallback> RenderEngineVtk::uniform_setting_callback_;
-
 RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
     : RenderEngine(parameters.default_label ? *parameters.default_label
                                             : RenderLabel::kUnspecified),
@@ -411,23 +441,40 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
       vtkActor& clone = *clone_actors[i];
 
       // NOTE: The clone renderer and original renderer *share* polygon data
-      // (via the shared mapper) and all textures. If the meshes or textures get
-      // modified _in place_ in a clone, the change would be visible to all
-      // copies of the renderer. If that proves to be problematic we'll have to
-      // make the copy "deeper" as appropriate.
+      // and texture images. If the meshes or textures get modified _in place_
+      // in a clone, the change would be visible to all copies of the renderer.
+      // If that proves to be problematic we'll have to make the copy "deeper"
+      // as appropriate. The mappers, textures and transforms, however, are the
+      // clone's own, so that the clone can render on a different thread than
+      // the original (see RenderEngineVtk).
       if (source.GetTexture() == nullptr) {
         clone.GetProperty()->SetColor(source.GetProperty()->GetColor());
         clone.GetProperty()->SetOpacity(source.GetProperty()->GetOpacity());
       } else {
-        clone.SetTexture(source.GetTexture());
+        clone.SetTexture(CopyTexture(source.GetTexture()));
       }
       const auto& source_textures = source.GetProperty()->GetAllTextures();
       for (auto& [name, texture] : source_textures) {
-        clone.GetProperty()->SetTexture(name.c_str(), texture);
+        clone.GetProperty()->SetTexture(name.c_str(), CopyTexture(texture));
       }
 
-      clone.SetMapper(source.GetMapper());
-      clone.SetUserTransform(source.GetUserTransform());
+      // The label actor of a geometry that is not rendered has no mapper.
+      if (source.GetMapper() != nullptr) {
+        vtkSmartPointer<vtkOpenGLPolyDataMapper> mapper =
+            CopyMapper(source.GetMapper());
+        if (i == ImageType::kDepth) {
+          mapper->SetVertexShaderCode(shaders::kDepthVS);
+          mapper->SetFragmentShaderCode(shaders::kDepthFS);
+          mapper->AddObserver(vtkCommand::UpdateShaderEvent,
+                              uniform_setting_callback_.Get());
+        }
+        clone.SetMapper(mapper.Get());
+      }
+      if (source.GetUserTransform() != nullptr) {
+        vtkNew<vtkTransform> X_WG;
+        X_WG->SetMatrix(source.GetUserMatrix());
+        clone.SetUserTransform(X_WG.Get());
+      }
       // This is necessary because *terrain* has its lighting turned off. To
       // blindly handle arbitrary actors being flagged as terrain, we need
       // to treat all actors this way.
@@ -79,6 +79,15 @@ struct RenderEngineVtkParams  {
  e.g., render label validation).
  <!-- TODO(SeanCurtis-TRI): Change this policy to be more selective when other
       renderers with different properties are introduced. -->
+
+ <h3>Rendering on multiple threads</h3>
+
+ A single %RenderEngineVtk is not thread safe, and its (offscreen) OpenGL
+ contexts should always be used from the same thread. Distinct clones, however,
+ only share the read-only meshes and texture images, and each one has its own
+ VTK pipelines and OpenGL contexts. Therefore, different clones (e.g., the ones
+ in the contexts of concurrent simulations) can render at the same time, each
+ on its own thread. See also systems::sensors::RenderThreadPool.
  */
 std::unique_ptr<RenderEngine> MakeRenderEngineVtk(
     const RenderEngineVtkParams& params);
@@ -1,5 +1,6 @@
 #include "drake/geometry/render/render_engine_ospray.h"
 
+#include <algorithm>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -944,6 +945,131 @@ TEST_F(RenderEngineOsprayTest, UnsupportedLabelAndDepth) {
       "RenderEngineOspray does not support label images");
 }
 
+// Confirms that invalid progressive rendering parameters are rejected.
+TEST_F(RenderEngineOsprayTest, ProgressiveParameterValidation) {
+  RenderEngineOsprayParams params;
+  params.max_accumulated_passes = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RenderEngineOspray{params}, std::logic_error,
+      ".*accumulated passes must be positive; got 0");
+
+  params = RenderEngineOsprayParams{};
+  params.time_budget = 0.0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RenderEngineOspray{params}, std::logic_error,
+      ".*time budget must be positive; got 0");
+
+  params = RenderEngineOsprayParams{};
+  params.convergence_threshold = -1.0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RenderEngineOspray{params}, std::logic_error,
+      ".*convergence threshold must be non-negative; got -1");
+}
+
+// Confirms that the path tracer accumulates passes across the renders of a
+// static shot, and starts over when the viewpoint, the scene or the camera
+// changes. The tiny time budget limits each render to a single pass.
+TEST_F(RenderEngineOsprayTest, ProgressiveAccumulation) {
+  RenderEngineOsprayParams params;
+  params.mode = OsprayMode::kPathTracer;
+  params.max_accumulated_passes = 3;
+  params.time_budget = 1e-9;
+  params.reuse_accumulation = true;
+  RenderEngineOspray renderer(params);
+  InitializeRenderer(X_WC_, true /* add terrain */, &renderer);
+  PopulateSphereTest(&renderer);
+  EXPECT_EQ(renderer.num_accumulated_passes(), 0);
+
+  for (int i = 1; i <= 3; ++i) {
+    Render(&renderer);
+    EXPECT_EQ(renderer.num_accumulated_passes(), i);
+  }
+
+  // Once the maximum number of passes has been reached, the image of the
+  // static shot is reused as is, even through no-op pose updates.
+  const ImageRgba8U converged = color_;
+  renderer.UpdateViewpoint(X_WC_);
+  renderer.UpdatePoses(X_WV_);
+  Render(&renderer);
+  EXPECT_EQ(renderer.num_accumulated_passes(), 3);
+  EXPECT_TRUE(std::equal(converged.at(0, 0),
+                         converged.at(0, 0) + converged.size(),
+                         color_.at(0, 0)));
+
+  // Moving the camera starts over.
+  renderer.UpdateViewpoint(
+      RigidTransformd{Vector3d{0, 0, 0.1}} * X_WC_);
+  Render(&renderer);
+  EXPECT_EQ(renderer.num_accumulated_passes(), 1);
+
+  // Moving a geometry starts over.
+  Render(&renderer);
+  EXPECT_EQ(renderer.num_accumulated_passes(), 2);
+  renderer.UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {geometry_id_, RigidTransformd{Vector3d{0, 0, 0.25}}}});
+  Render(&renderer);
+  EXPECT_EQ(renderer.num_accumulated_passes(), 1);
+
+  // Changing the camera properties starts over.
+  Render(&renderer);
+  EXPECT_EQ(renderer.num_accumulated_passes(), 2);
+  DepthCameraProperties small_camera{camera_};
+  small_camera.width /= 2;
+  small_camera.height /= 2;
+  ImageRgba8U small_color(small_camera.width, small_camera.height);
+  Render(&renderer, &small_camera, &small_color);
+  EXPECT_EQ(renderer.num_accumulated_passes(), 1);
+
+  // The clone starts its own accumulation.
+  unique_ptr<RenderEngine> clone = renderer.Clone();
+  EXPECT_EQ(
+      static_cast<RenderEngineOspray&>(*clone).num_accumulated_passes(), 0);
+}
+
+// Confirms the budgets that end the passes of a single render.
+TEST_F(RenderEngineOsprayTest, ProgressiveBudgets) {
+  RenderEngineOsprayParams params;
+  params.mode = OsprayMode::kPathTracer;
+  params.max_accumulated_passes = 3;
+
+  // Without reuse, each render accumulates the maximum number of passes.
+  {
+    RenderEngineOspray renderer(params);
+    InitializeRenderer(X_WC_, true /* add terrain */, &renderer);
+    PopulateSphereTest(&renderer);
+    for (int i = 0; i < 2; ++i) {
+      Render(&renderer);
+      EXPECT_EQ(renderer.num_accumulated_passes(), 3);
+    }
+  }
+
+  // Any two passes differ by less than the largest possible threshold.
+  {
+    params.max_accumulated_passes = 10;
+    params.convergence_threshold = 255.0;
+    RenderEngineOspray renderer(params);
+    InitializeRenderer(X_WC_, true /* add terrain */, &renderer);
+    PopulateSphereTest(&renderer);
+    Render(&renderer);
+    EXPECT_EQ(renderer.num_accumulated_passes(), 2);
+  }
+
+  // The ray tracer always renders a single pass, and reuses it for a static
+  // shot.
+  {
+    params.mode = OsprayMode::kRayTracer;
+    params.reuse_accumulation = true;
+    RenderEngineOspray renderer(params);
+    InitializeRenderer(X_WC_, true /* add terrain */, &renderer);
+    PopulateSphereTest(&renderer);
+    Render(&renderer);
+    EXPECT_EQ(renderer.num_accumulated_passes(), 1);
+    Render(&renderer);
+    EXPECT_EQ(renderer.num_accumulated_passes(), 1);
+    PerformCenterShapeTest(&renderer, "Reused ray traced image");
+  }
+}
+
 // TODO(SeanCurtis-TRI): When we have a denoiser available, test this against
 //  the pathtracer configuration and samples value.
 
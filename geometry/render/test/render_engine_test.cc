@@ -427,6 +427,46 @@ GTEST_TEST(RenderEngine, FullIntrinsicsRendering) {
   }
 }
 
+// Confirms that the default implementation of RenderImages() renders each
+// image in turn with the simple camera API, and that the images get validated.
+GTEST_TEST(RenderEngine, RenderImagesDefault) {
+  DummyRenderEngine engine;
+  const CameraProperties camera{2, 2, M_PI, "n/a"};
+  const DepthCameraProperties depth_camera{2, 2, M_PI, "n/a", 0.1, 10};
+  ImageRgba8U color(2, 2);
+  ImageDepth32F depth(2, 2);
+  ImageLabel16I label(2, 2);
+  const RigidTransformd X_WC1{Vector3d(1, 2, 3)};
+  const RigidTransformd X_WC2{Vector3d(-1, 0, 0.5)};
+
+  ImageRenderBatch batch;
+  batch.color_images.push_back({camera, X_WC1, &color});
+  batch.depth_images.push_back({depth_camera, X_WC1, &depth});
+  batch.depth_images.push_back({depth_camera, X_WC2, &depth});
+  batch.label_images.push_back({camera, X_WC1, &label});
+  batch.label_images.push_back({camera, X_WC2, &label});
+  engine.RenderImages(batch);
+  EXPECT_EQ(engine.num_simple_color_renders(), 1);
+  EXPECT_EQ(engine.num_simple_depth_renders(), 2);
+  EXPECT_EQ(engine.num_simple_label_renders(), 2);
+  // The requests are rendered in order; the last one was the second label.
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WC2.GetAsMatrix34()));
+
+  ImageLabel16I small_label(1, 2);
+  batch.label_images.push_back({camera, X_WC1, &small_label});
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages(batch), std::logic_error,
+      "The label image to write has a size different from that specified in "
+      "the camera intrinsics.*");
+  batch.label_images.back().image = nullptr;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages(batch), std::logic_error,
+      "Can't render a label image. The given output image is nullptr");
+  // Nothing got rendered from the invalid batches.
+  EXPECT_EQ(engine.num_simple_label_renders(), 2);
+}
+
 // An absolute barebones RenderEngine implementation; however it is cloneable.
 class CloneableEngine : public render::RenderEngine {
  public:
@@ -407,7 +407,7 @@ template <typename T>
 std::vector<FrameId> SceneGraph<T>::GetDynamicFrames(
     const GeometryState<T>& g_state, Role role) const {
   vector<FrameId> dynamic_frames;
-  for (const auto& pair : g_state.frames_) {
+  for (const auto& pair : g_state.topology().frames) {
     const FrameId frame_id = pair.first;
     if (frame_id == world_frame_id()) continue;
     if (g_state.NumGeometriesWithRole(frame_id, role) > 0) {
@@ -440,9 +440,9 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context,
   // Process all sources *except*:
   //   - the internal source and
   //   - sources with no frames.
-  // The internal source will be included in source_frame_id_map_ but *not* in
+  // The internal source will be included in source_frame_id_map but *not* in
   // input_source_ids_.
-  for (const auto& pair : state.source_frame_id_map_) {
+  for (const auto& pair : state.topology().source_frame_id_map) {
     if (pair.second.size() > 0) {
       SourceId source_id = pair.first;
       const auto itr = input_source_ids_.find(source_id);
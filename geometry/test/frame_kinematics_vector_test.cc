@@ -195,6 +195,28 @@ GTEST_TEST(FrameKinematicsVector, FrameIdRange) {
   for (FrameId id : ids) EXPECT_EQ(actual_ids.count(id), 1);
 }
 
+// The ids are reported in the order in which they were first set, regardless of
+// the order in which they are re-set after clear().
+GTEST_TEST(FrameKinematicsVector, FrameIdOrder) {
+  FramePoseVector<double> poses;
+  const std::vector<FrameId> ids{FrameId::get_new_id(), FrameId::get_new_id(),
+                                 FrameId::get_new_id()};
+  for (FrameId id : ids) poses.set_value(id, RigidTransformd::Identity());
+  EXPECT_EQ(poses.frame_ids(), ids);
+
+  poses.clear();
+  const RigidTransformd X_WF(Eigen::Vector3d(1, 2, 3));
+  poses.set_value(ids[2], X_WF);
+  poses.set_value(ids[0], RigidTransformd::Identity());
+  EXPECT_EQ(poses.size(), 2);
+  EXPECT_EQ(poses.frame_ids(), std::vector<FrameId>({ids[0], ids[2]}));
+  EXPECT_TRUE(poses.value(ids[2]).IsExactlyEqualTo(X_WF));
+  EXPECT_FALSE(poses.has_id(ids[1]));
+
+  poses.set_value(ids[1], RigidTransformd::Identity());
+  EXPECT_EQ(poses.frame_ids(), ids);
+}
+
 }  // namespace test
 }  // namespace geometry
 }  // namespace drake
@@ -66,32 +66,32 @@ class GeometryStateTester {
   }
 
   const unordered_map<SourceId, string>& get_source_name_map() const {
-    return state_->source_names_;
+    return state_->topology().source_names;
   }
 
   const unordered_map<SourceId, FrameIdSet>& get_source_frame_id_map() const {
-    return state_->source_frame_id_map_;
+    return state_->topology().source_frame_id_map;
   }
 
   const unordered_map<SourceId, FrameIdSet>& get_source_root_frame_map() const {
-    return state_->source_root_frame_map_;
+    return state_->topology().source_root_frame_map;
   }
 
   const unordered_map<SourceId, unordered_set<GeometryId>>&
   get_source_anchored_geometry_map() const {
-    return state_->source_anchored_geometry_map_;
+    return state_->topology().source_anchored_geometry_map;
   }
 
   const unordered_map<FrameId, InternalFrame>& get_frames() const {
-    return state_->frames_;
+    return state_->topology().frames;
   }
 
   const unordered_map<GeometryId, InternalGeometry>& get_geometries() const {
-    return state_->geometries_;
+    return state_->topology().geometries;
   }
 
   const vector<FrameId>& get_frame_index_id_map() const {
-    return state_->frame_index_to_id_map_;
+    return state_->topology().frame_index_to_id_map;
   }
 
   const IdPoseMap<T>& get_geometry_world_poses() const {
@@ -855,6 +855,54 @@ TEST_F(GeometryStateTest, Transmogrify) {
   ExpectSuccessfulTransmogrification(ad_tester, gs_tester_);
 }
 
+// Confirms that copies of a GeometryState share their registration data until
+// one of them modifies it, without the modification affecting the others.
+TEST_F(GeometryStateTest, CopiesShareRegistrationData) {
+  const SourceId s_id = SetUpSingleSourceTree(Assign::kProximity);
+  GeometryState<double> copy(geometry_state_);
+  GeometryStateTester<double> copy_tester;
+  copy_tester.set_state(&copy);
+  EXPECT_EQ(&copy_tester.get_geometries(), &gs_tester_.get_geometries());
+
+  // Transmogrification shares the data as well.
+  unique_ptr<GeometryState<AutoDiffXd>> ad_state =
+      geometry_state_.ToAutoDiffXd();
+  GeometryStateTester<AutoDiffXd> ad_tester;
+  ad_tester.set_state(ad_state.get());
+  EXPECT_EQ(&ad_tester.get_frames(), &gs_tester_.get_frames());
+
+  // Updating the poses doesn't modify the registration data.
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+  copy_tester.SetFramePoses(s_id, poses);
+  copy_tester.FinalizePoseUpdate();
+  EXPECT_EQ(&copy_tester.get_geometries(), &gs_tester_.get_geometries());
+
+  // Registering a geometry in the copy gives it its own registration data.
+  const GeometryId new_id = copy.RegisterGeometry(
+      s_id, frames_[0],
+      make_unique<GeometryInstance>(RigidTransformd::Identity(),
+                                    make_unique<Sphere>(1), "new_sphere"));
+  EXPECT_NE(&copy_tester.get_geometries(), &gs_tester_.get_geometries());
+  EXPECT_EQ(copy.get_num_geometries(),
+            geometry_state_.get_num_geometries() + 1);
+  EXPECT_EQ(gs_tester_.get_geometries().count(new_id), 0);
+  EXPECT_EQ(
+      gs_tester_.get_frames().at(frames_[0]).child_geometries().count(new_id),
+      0);
+  // The AutoDiffXd state still shares the original data.
+  EXPECT_EQ(&ad_tester.get_frames(), &gs_tester_.get_frames());
+
+  // Removing a role in the original leaves the copy unchanged.
+  EXPECT_EQ(geometry_state_.RemoveRole(s_id, geometries_[0], Role::kProximity),
+            1);
+  EXPECT_EQ(geometry_state_.GetProximityProperties(geometries_[0]), nullptr);
+  EXPECT_NE(copy.GetProximityProperties(geometries_[0]), nullptr);
+  EXPECT_NE(ad_state->GetProximityProperties(geometries_[0]), nullptr);
+}
+
 // Confirms that the actions of initializing the single-source tree leave the
 // geometry state in the expected configuration.
 TEST_F(GeometryStateTest, ValidateSingleSourceTree) {
@@ -1,6 +1,8 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <cmath>
+#include <limits>
+#include <memory>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -293,6 +295,56 @@ TEST_F(ProximityEngineMeshes, MeshComputeContactSurfacesOnly) {
   EXPECT_FALSE(engine.HasCollisions());
 }
 
+// Confirms that a Mesh with a convex approximation participates in the other
+// queries, through its convex hull or its bounding box. The mesh M is a unit
+// tetrahedron with a dent: its convex hull is the tetrahedron, and its bounding
+// box is the unit cube. The sphere S of radius 0.1 is centered at
+// (0.8, 0.8, 0.8), i.e., at the distance (2.4 - 1) / √3 from the tetrahedron,
+// and at the depth 0.2 inside the cube.
+GTEST_TEST(ProximityEngineTests, MeshConvexApproximation) {
+  const Mesh mesh{
+      drake::FindResourceOrThrow("drake/geometry/test/non_convex_mesh.obj"),
+      1.0 /* scale */};
+  const Sphere sphere{0.1};
+  const GeometryId mesh_id = GeometryId::get_new_id();
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  const unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {mesh_id, RigidTransformd::Identity()},
+      {sphere_id, RigidTransformd(Vector3d(0.8, 0.8, 0.8))}};
+  const double kInf = std::numeric_limits<double>::infinity();
+
+  auto make_engine = [&](MeshApproximation approximation) {
+    auto engine = std::make_unique<ProximityEngine<double>>();
+    ProximityProperties properties;
+    AddMeshApproximation(approximation, &properties);
+    engine->AddDynamicGeometry(mesh, X_WGs.at(mesh_id), mesh_id, properties);
+    engine->AddAnchoredGeometry(sphere, X_WGs.at(sphere_id), sphere_id,
+                                ProximityProperties());
+    engine->UpdateWorldPoses(X_WGs);
+    return engine;
+  };
+
+  const auto hull_engine = make_engine(MeshApproximation::kConvexHull);
+  // The copy has its own copy of the approximation.
+  const ProximityEngine<double> hull_copy(*hull_engine);
+  for (const ProximityEngine<double>* engine :
+       {hull_engine.get(), &hull_copy}) {
+    const auto pairs =
+        engine->ComputeSignedDistancePairwiseClosestPoints(X_WGs, kInf);
+    ASSERT_EQ(pairs.size(), 1);
+    EXPECT_NEAR(pairs[0].distance, 1.4 / std::sqrt(3.0) - 0.1, 1e-6);
+    EXPECT_EQ(engine->FindCollisionCandidates().size(), 1);
+    EXPECT_EQ(engine->ComputePointPairPenetration().size(), 0);
+    EXPECT_FALSE(engine->HasCollisions());
+  }
+
+  const auto box_engine = make_engine(MeshApproximation::kBoundingBox);
+  const auto penetrations = box_engine->ComputePointPairPenetration();
+  ASSERT_EQ(penetrations.size(), 1);
+  EXPECT_NEAR(penetrations[0].depth, 0.3, 1e-4);
+  EXPECT_TRUE(box_engine->HasCollisions());
+}
+
 // There are two axes of geometry classification that control the result of
 // ComputeContactSurfaces: anchored/dynamic and mesh/primitive. For a geometry
 // pair, these classifications can combine in different ways. Each combination
@@ -386,6 +438,10 @@ TEST_F(ProximityEngineMeshes, ComputeContactSurfaces) {
 
     const auto surfaces = engine.ComputeContactSurfaces(X_WGs);
     EXPECT_EQ(surfaces.size(), 1) << contact_pair;
+
+    // The multi-threaded evaluation covers the same geometry pairs.
+    engine.set_num_threads(2);
+    EXPECT_EQ(engine.ComputeContactSurfaces(X_WGs).size(), 1) << contact_pair;
   }
 
   // Note: it is not an error to declare a soft mesh; it will simply be ignored.
@@ -425,6 +481,9 @@ TEST_F(ProximityEngineMeshes, ComputeContactSurfaces) {
                        contact_pair.p_S1S2_W);
     EXPECT_THROW(engine.ComputeContactSurfaces(X_WGs), std::logic_error)
         << contact_pair;
+    engine.set_num_threads(2);
+    EXPECT_THROW(engine.ComputeContactSurfaces(X_WGs), std::logic_error)
+        << contact_pair;
   }
 }
 
@@ -1930,6 +1989,48 @@ unordered_map<GeometryId, RigidTransformd> MakeCollidingRing(double radius,
   return poses;
 }
 
+// Confirms that UpdateWorldPoses() keeps the broadphase consistent when only
+// some of the geometries move (their poses are the only ones refit), and when
+// most of them do.
+GTEST_TEST(ProximityEngineTests, UpdateWorldPosesOfMovedGeometries) {
+  ProximityEngine<double> engine;
+
+  const double r = 0.5;
+  const int kNumSpheres = 8;
+  unordered_map<GeometryId, RigidTransformd> poses =
+      MakeCollidingRing(r, kNumSpheres);
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    engine.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  engine.UpdateWorldPoses(poses);
+  ASSERT_EQ(engine.ComputePointPairPenetration().size(), kNumSpheres);
+
+  // Nothing moved.
+  engine.UpdateWorldPoses(poses);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), kNumSpheres);
+
+  // Moving a single sphere out of the ring removes its two contacts, and
+  // moving it back restores them.
+  const GeometryId moved_id = poses.begin()->first;
+  const RigidTransformd X_WS = poses.at(moved_id);
+  poses[moved_id] = RigidTransformd(Vector3d(0, 0, 10));
+  engine.UpdateWorldPoses(poses);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), kNumSpheres - 2);
+  poses[moved_id] = X_WS;
+  engine.UpdateWorldPoses(poses);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), kNumSpheres);
+
+  // Moving all of the spheres apart removes all contacts.
+  double z = 0;
+  for (auto& pair : poses) {
+    pair.second.set_translation(pair.second.translation() + Vector3d(0, 0, z));
+    z += 4 * r;
+  }
+  engine.UpdateWorldPoses(poses);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 0);
+}
+
 // Confirms that the ComputePointPairPenetration() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -1958,6 +2059,148 @@ GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairResultOrdering) {
   }
 }
 
+// Confirms that evaluating the narrowphase of ComputePointPairPenetration()
+// on multiple threads produces exactly the single-threaded results.
+GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairMultipleThreads) {
+  ProximityEngine<double> engine;
+  EXPECT_EQ(engine.num_threads(), 1);
+  EXPECT_THROW(engine.set_num_threads(0), std::exception);
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 12);
+
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    engine.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  // An anchored sphere, centered in the ring, that penetrates every sphere in
+  // the ring.
+  const double d = poses.begin()->second.translation().norm();
+  engine.AddAnchoredGeometry(Sphere(d - r + 0.1), {},
+                             GeometryId::get_new_id());
+  engine.UpdateWorldPoses(poses);
+  const auto expected = engine.ComputePointPairPenetration();
+  ASSERT_EQ(expected.size(), 2 * poses.size());
+
+  for (const int num_threads : {2, 5, 1000}) {
+    engine.set_num_threads(num_threads);
+    EXPECT_EQ(engine.num_threads(), num_threads);
+    const auto results = engine.ComputePointPairPenetration();
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(results[i].id_A, expected[i].id_A);
+      EXPECT_EQ(results[i].id_B, expected[i].id_B);
+      EXPECT_EQ(results[i].depth, expected[i].depth);
+      EXPECT_EQ(results[i].p_WCa, expected[i].p_WCa);
+      EXPECT_EQ(results[i].p_WCb, expected[i].p_WCb);
+      EXPECT_EQ(results[i].nhat_BA_W, expected[i].nhat_BA_W);
+    }
+  }
+
+  // The setting is preserved by copies.
+  ProximityEngine<double> copy(engine);
+  EXPECT_EQ(copy.num_threads(), 1000);
+}
+
+// Confirms that, when enabled, the collision queries report their statistics
+// without changing their results.
+GTEST_TEST(ProximityEngineTests, CollectStatistics) {
+  ProximityEngine<double> engine;
+  EXPECT_FALSE(engine.collect_statistics());
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 12);
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    engine.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  const double d = poses.begin()->second.translation().norm();
+  engine.AddAnchoredGeometry(Sphere(d - r + 0.1), {},
+                             GeometryId::get_new_id());
+  engine.UpdateWorldPoses(poses);
+  const auto expected_contacts = engine.ComputePointPairPenetration();
+  const auto expected_candidates = engine.FindCollisionCandidates();
+  // No statistics are collected by default.
+  EXPECT_EQ(engine.last_query_statistics().num_broadphase_candidates, 0);
+  EXPECT_TRUE(engine.last_query_statistics().shape_pairs.empty());
+
+  engine.set_collect_statistics(true);
+  EXPECT_TRUE(engine.collect_statistics());
+  const SortedPair<std::string> sphere_sphere("Sphere", "Sphere");
+  for (const int num_threads : {1, 3}) {
+    engine.set_num_threads(num_threads);
+    EXPECT_EQ(engine.ComputePointPairPenetration().size(),
+              expected_contacts.size());
+    const ProximityQueryStatistics stats = engine.last_query_statistics();
+    // Every colliding pair is a broadphase candidate.
+    EXPECT_GE(stats.num_broadphase_candidates,
+              static_cast<int>(expected_contacts.size()));
+    EXPECT_GE(stats.broadphase_time, 0.0);
+    EXPECT_GT(stats.narrowphase_time, 0.0);
+    ASSERT_EQ(stats.shape_pairs.size(), 1);
+    ASSERT_EQ(stats.shape_pairs.count(sphere_sphere), 1);
+    EXPECT_EQ(stats.shape_pairs.at(sphere_sphere).num_pairs,
+              stats.num_broadphase_candidates);
+    EXPECT_EQ(stats.shape_pairs.at(sphere_sphere).narrowphase_time,
+              stats.narrowphase_time);
+
+    // The candidate query covers the same broadphase candidates.
+    EXPECT_EQ(engine.FindCollisionCandidates(), expected_candidates);
+    EXPECT_EQ(engine.last_query_statistics().num_broadphase_candidates,
+              stats.num_broadphase_candidates);
+  }
+
+  // The setting is preserved by copies.
+  ProximityEngine<double> copy(engine);
+  EXPECT_TRUE(copy.collect_statistics());
+}
+
+// Confirms that the batched ComputeSignedDistanceToPoints() reports, for each
+// point, exactly the results of ComputeSignedDistanceToPoint(), regardless of
+// the number of threads.
+GTEST_TEST(SignedDistanceToPointBroadphaseTest, MultiplePoints) {
+  ProximityEngine<double> engine;
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> X_WGs = MakeCollidingRing(r, 8);
+  for (const auto& pair : X_WGs) {
+    engine.AddDynamicGeometry(Sphere(r), {}, pair.first);
+  }
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  const RigidTransformd X_WA(Translation3d{0, 0, 2});
+  X_WGs[anchored_id] = X_WA;
+  engine.AddAnchoredGeometry(Box(1, 2, 3), X_WA, anchored_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  const int num_points = 7;
+  Matrix3X<double> p_WQs(3, num_points);
+  for (int i = 0; i < num_points; ++i) {
+    p_WQs.col(i) = Vector3d(0.3 * i - 1, 0.2 * i, 0.5 * i - 1);
+  }
+  // An empty set of points has no results.
+  EXPECT_EQ(
+      engine.ComputeSignedDistanceToPoints(Matrix3X<double>(3, 0), X_WGs)
+          .size(), 0);
+
+  const double threshold = 1.5;
+  for (const int num_threads : {1, 2, 5, 1000}) {
+    engine.set_num_threads(num_threads);
+    const std::vector<std::vector<SignedDistanceToPoint<double>>> results =
+        engine.ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+    ASSERT_EQ(static_cast<int>(results.size()), num_points);
+    for (int i = 0; i < num_points; ++i) {
+      const std::vector<SignedDistanceToPoint<double>> expected =
+          engine.ComputeSignedDistanceToPoint(p_WQs.col(i), X_WGs, threshold);
+      ASSERT_EQ(results[i].size(), expected.size());
+      for (size_t j = 0; j < expected.size(); ++j) {
+        EXPECT_EQ(results[i][j].id_G, expected[j].id_G);
+        EXPECT_EQ(results[i][j].p_GN, expected[j].p_GN);
+        EXPECT_EQ(results[i][j].distance, expected[j].distance);
+        EXPECT_EQ(results[i][j].grad_W, expected[j].grad_W);
+      }
+    }
+  }
+}
+
 // Confirms that the FindCollisionCandidates() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2033,6 +2276,40 @@ GTEST_TEST(ProximityEngineTests, ComputeContactSurfacesResultOrdering) {
   }
 }
 
+// Confirms that the fallback of ComputeContactSurfacesWithFallback() reports
+// the contact manifold of two boxes, whereas ComputePointPairPenetration()
+// reports a single point pair.
+GTEST_TEST(ProximityEngineTests, ComputeContactSurfacesWithFallbackBoxBox) {
+  ProximityEngine<double> engine;
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  // Box B rests on box A, penetrating it by 1 cm and offset horizontally so
+  // that the two faces overlap in a square.
+  const unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {id_A, RigidTransformd::Identity()},
+      {id_B, RigidTransformd(Vector3d(0.25, 0.25, 0.99))}};
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(0.5, &rigid_properties);
+  engine.AddDynamicGeometry(Box(1, 1, 1), {}, id_A, rigid_properties);
+  engine.AddDynamicGeometry(Box(1, 1, 1), {}, id_B, rigid_properties);
+  engine.UpdateWorldPoses(X_WGs);
+
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 1);
+
+  vector<ContactSurface<double>> surfaces;
+  vector<PenetrationAsPointPair<double>> point_pairs;
+  engine.ComputeContactSurfacesWithFallback(X_WGs, &surfaces, &point_pairs);
+  EXPECT_EQ(surfaces.size(), 0);
+  ASSERT_EQ(point_pairs.size(), 4);
+  for (const auto& point_pair : point_pairs) {
+    EXPECT_EQ(point_pair.id_A, id_A);
+    EXPECT_EQ(point_pair.id_B, id_B);
+    EXPECT_NEAR(point_pair.depth, 0.01, 1e-12);
+    EXPECT_TRUE(CompareMatrices(point_pair.nhat_BA_W, -Vector3d::UnitZ(),
+                                1e-12));
+  }
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2089,6 +2366,26 @@ GTEST_TEST(ProximityEngineTests,
     EXPECT_EQ(points1[i].id_A, points2[i].id_A);
     EXPECT_EQ(points1[i].id_B, points2[i].id_B);
   }
+
+  // The multi-threaded evaluation reproduces the single-threaded results,
+  // in the same order.
+  for (const int num_threads : {2, 3, 100}) {
+    engine.set_num_threads(num_threads);
+    vector<ContactSurface<double>> surfaces3;
+    vector<PenetrationAsPointPair<double>> points3;
+    engine.ComputeContactSurfacesWithFallback(poses, &surfaces3, &points3);
+    ASSERT_EQ(surfaces3.size(), N / 2);
+    ASSERT_EQ(points3.size(), N / 2);
+    for (size_t i = 0; i < N / 2; ++i) {
+      EXPECT_EQ(surfaces1[i].id_M(), surfaces3[i].id_M());
+      EXPECT_EQ(surfaces1[i].id_N(), surfaces3[i].id_N());
+      EXPECT_EQ(surfaces1[i].mesh_W().num_faces(),
+                surfaces3[i].mesh_W().num_faces());
+      EXPECT_EQ(points1[i].id_A, points3[i].id_A);
+      EXPECT_EQ(points1[i].id_B, points3[i].id_B);
+      EXPECT_EQ(points1[i].depth, points3[i].depth);
+    }
+  }
 }
 
 // These tests validate collisions/distance between spheres. This does *not*
@@ -2515,8 +2812,8 @@ TEST_F(SimplePenetrationTest, ExcludeCollisionsWithin) {
   ExpectIgnoredPenetration(origin_id, collide_id, ad_engine.get());
 }
 
-// Invokes ExcludeCollisionsBetween in various scenarios which will and won't
-// generate cliques.
+// Invokes ExcludeCollisionsBetween in various scenarios. The pairs are filtered
+// directly, so no cliques are ever generated.
 TEST_F(SimplePenetrationTest, ExcludeCollisionsBetweenCliqueGeneration) {
   using PET = ProximityEngineTester;
   GeometryId dynamic1 = GeometryId::get_new_id();
@@ -2534,46 +2831,53 @@ TEST_F(SimplePenetrationTest, ExcludeCollisionsBetweenCliqueGeneration) {
   GeometryId anchored3 = GeometryId::get_new_id();
   engine_.AddAnchoredGeometry(sphere_, pose, anchored3);
 
-  int expected_clique = PET::peek_next_clique(engine_);
+  const int expected_clique = PET::peek_next_clique(engine_);
+  const bool is_anchored = false;
+  const bool is_dynamic = true;
 
-  // No dynamic geometry --> no cliques generated.
+  // No dynamic geometry.
   engine_.ExcludeCollisionsBetween({}, {anchored1}, {}, {anchored2});
   ASSERT_EQ(PET::peek_next_clique(engine_), expected_clique);
 
-  // One empty group --> no cliques generated
+  // One empty group --> nothing filtered.
   engine_.ExcludeCollisionsBetween({}, {}, {dynamic1}, {anchored1});
-  ASSERT_EQ(PET::peek_next_clique(engine_), expected_clique);
   engine_.ExcludeCollisionsBetween({dynamic1}, {anchored1}, {}, {});
   ASSERT_EQ(PET::peek_next_clique(engine_), expected_clique);
+  EXPECT_FALSE(engine_.CollisionFiltered(dynamic1, is_dynamic, anchored1,
+                                         is_anchored));
 
-  // Two groups with the same single geometry --> no cliques generated.
+  // Two groups with the same single geometry.
   engine_.ExcludeCollisionsBetween({dynamic1}, {}, {dynamic1}, {});
   ASSERT_EQ(PET::peek_next_clique(engine_), expected_clique);
 
-  // Groups with dynamic and anchored geometry -- cliques generated for (g, a)
-  // pairs but *not* (a, a) pairs: (d1, d2), (d1, a2), (d2, a1).
+  // Groups with dynamic and anchored geometry -- the (g, h) pairs across the
+  // groups are filtered, but not the pairs within a group: (d1, a1) and
+  // (d2, a2).
   engine_.ExcludeCollisionsBetween({dynamic1}, {anchored1}, {dynamic2},
                                    {anchored2});
-  expected_clique += 3;
   ASSERT_EQ(PET::peek_next_clique(engine_), expected_clique);
-
-  // Repeat previous filter declaration -- no cliques added.
-  engine_.ExcludeCollisionsBetween({dynamic1}, {anchored1}, {dynamic2},
-                                   {anchored2});
-  ASSERT_EQ(PET::peek_next_clique(engine_), expected_clique);
-
-  // Partial repeat -- add one anchored geometry to one set. One new clique for
-  // (d2, a3).
-  engine_.ExcludeCollisionsBetween({dynamic1}, {anchored1, anchored3},
-                                   {dynamic2}, {anchored2});
-  ASSERT_EQ(PET::peek_next_clique(engine_), ++expected_clique);
-
-  // Partial repeat -- add one dynamic geometry to one set. Two new cliques for
-  // (d3, d2) and (d3, a2).
+  EXPECT_TRUE(
+      engine_.CollisionFiltered(dynamic1, is_dynamic, dynamic2, is_dynamic));
+  EXPECT_TRUE(
+      engine_.CollisionFiltered(dynamic1, is_dynamic, anchored2, is_anchored));
+  EXPECT_TRUE(
+      engine_.CollisionFiltered(dynamic2, is_dynamic, anchored1, is_anchored));
+  EXPECT_FALSE(
+      engine_.CollisionFiltered(dynamic1, is_dynamic, anchored1, is_anchored));
+  EXPECT_FALSE(
+      engine_.CollisionFiltered(dynamic2, is_dynamic, anchored2, is_anchored));
+
+  // Partial repeat -- add one dynamic geometry to one set: (d3, d2) and
+  // (d3, a2) are filtered, but not (d3, d1).
   engine_.ExcludeCollisionsBetween({dynamic1, dynamic3}, {anchored1},
                                    {dynamic2}, {anchored2});
-  expected_clique += 2;
   ASSERT_EQ(PET::peek_next_clique(engine_), expected_clique);
+  EXPECT_TRUE(
+      engine_.CollisionFiltered(dynamic3, is_dynamic, dynamic2, is_dynamic));
+  EXPECT_TRUE(
+      engine_.CollisionFiltered(dynamic3, is_dynamic, anchored2, is_anchored));
+  EXPECT_FALSE(
+      engine_.CollisionFiltered(dynamic3, is_dynamic, dynamic1, is_dynamic));
 }
 
 TEST_F(SimplePenetrationTest, ExcludeCollisionsBetween) {
@@ -175,6 +175,20 @@ GTEST_TEST(ProximityPropertiesTest, AddHalfSpaceSoftProperties) {
   }
 }
 
+GTEST_TEST(ProximityPropertiesTest, AddMeshApproximation) {
+  for (MeshApproximation approximation :
+       {MeshApproximation::kConvexHull, MeshApproximation::kBoundingBox}) {
+    ProximityProperties props;
+    AddMeshApproximation(approximation, &props);
+    EXPECT_EQ(props.GetProperty<MeshApproximation>(
+                  internal::kMeshGroup, internal::kMeshApproximation),
+              approximation);
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        AddMeshApproximation(approximation, &props), std::logic_error,
+        ".+ Trying to add property \\('.+', '.+'\\).+ name already exists");
+  }
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
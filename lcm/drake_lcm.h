@@ -32,7 +32,8 @@ class DrakeLcm : public DrakeLcmInterface {
   explicit DrakeLcm(std::string lcm_url);
 
   /**
-   * A destructor that forces the receive thread to be stopped.
+   * A destructor that unsubscribes all subscriptions.  There is no receive
+   * thread; messages are only received during HandleSubscriptions().
    */
   ~DrakeLcm() override;
 
@@ -1,5 +1,6 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <limits>
@@ -109,6 +110,26 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   next_event_ = log_->readNextEvent();
 }
 
+void DrakeLcmLog::SeekToTime(double time_sec) {
+  if (is_write_) {
+    throw std::logic_error("SeekToTime is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const uint64_t timestamp = second_to_timestamp(std::max(time_sec, 0.0));
+  // LCM's seek stops as soon as it finds *some* event with the requested
+  // timestamp, which might not be the first one. Seeking just before the
+  // target and then skipping forward lands exactly on the first message at
+  // or after it. The seek only fails when it runs into the end of the file,
+  // in which case there is no next message.
+  log_->seekToTimestamp(timestamp > 0 ? timestamp - 1 : 0);
+  next_event_ = log_->readNextEvent();
+  while (next_event_ != nullptr &&
+         static_cast<uint64_t>(next_event_->timestamp) < timestamp) {
+    next_event_ = log_->readNextEvent();
+  }
+}
+
 void DrakeLcmLog::OnHandleSubscriptionsError(const std::string& error_message) {
   // We are not called via LCM C code, so it's safe to throw there.
   throw std::runtime_error(error_message);
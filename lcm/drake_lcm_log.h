@@ -103,6 +103,20 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Advances (or rewinds) the log so that the next message is the first one
+   * whose time is not less than @p time_sec, without dispatching any of the
+   * messages in between. This requires the timestamps of the log to be
+   * non-decreasing, as is the case for logs written by lcm-logger or by
+   * Publish(). The position is found by bisection of the log file, so its
+   * cost is logarithmic in the size of the log rather than linear in the
+   * number of skipped messages.
+   *
+   * @throws std::logic_error if this instance is not constructed in read-only
+   * mode.
+   */
+  void SeekToTime(double time_sec);
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
@@ -1,7 +1,9 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -53,6 +55,56 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   }
 }
 
+// Seeks forward and backward within a log with repeated timestamps.
+GTEST_TEST(LcmLogTest, SeekToTime) {
+  auto w_log = std::make_unique<DrakeLcmLog>("seek.log", true);
+  const std::string channel_name("test_channel");
+  const std::vector<double> log_times{1.0, 2.0, 2.0, 2.0, 3.0, 4.0};
+  drake::lcmt_drake_signal msg{};
+  for (int i = 0; i < static_cast<int>(log_times.size()); ++i) {
+    msg.timestamp = i;
+    Publish(w_log.get(), channel_name, msg, log_times[i]);
+  }
+  w_log.reset();
+
+  auto r_log = std::make_unique<DrakeLcmLog>("seek.log", false);
+  std::vector<int64_t> received;
+  Subscribe<drake::lcmt_drake_signal>(
+      r_log.get(), channel_name, [&received](const auto& message) {
+        received.push_back(message.timestamp);
+      });
+  auto dispatch_next = [&r_log]() {
+    r_log->DispatchMessageAndAdvanceLog(r_log->GetNextMessageTime());
+  };
+
+  // Seeking to a repeated timestamp lands on the first of its messages.
+  r_log->SeekToTime(2.0);
+  EXPECT_EQ(r_log->GetNextMessageTime(), 2.0);
+  dispatch_next();
+  EXPECT_EQ(received, std::vector<int64_t>({1}));
+
+  // Seeking between timestamps lands on the next message.
+  r_log->SeekToTime(3.5);
+  EXPECT_EQ(r_log->GetNextMessageTime(), 4.0);
+  dispatch_next();
+  EXPECT_EQ(received, std::vector<int64_t>({1, 5}));
+
+  // Seeking backward rewinds to the start.
+  r_log->SeekToTime(0.0);
+  EXPECT_EQ(r_log->GetNextMessageTime(), 1.0);
+  dispatch_next();
+  EXPECT_EQ(received, std::vector<int64_t>({1, 5, 0}));
+
+  // Seeking past the end finishes the log.
+  r_log->SeekToTime(10.0);
+  EXPECT_EQ(r_log->GetNextMessageTime(),
+            std::numeric_limits<double>::infinity());
+
+  // Seeking is only for playback.
+  DrakeLcmLog writer("seek_write.log", true);
+  EXPECT_THROW(writer.SeekToTime(1.0), std::logic_error);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -12,36 +12,55 @@ namespace drake {
 namespace manipulation {
 namespace planner {
 
-namespace internal {
-DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
-    const Eigen::Ref<const VectorX<double>>& q_current,
-    const Eigen::Ref<const VectorX<double>>& v_current,
+namespace {
+// TODO(russt): This should not be hard-coded.
+constexpr double kCartesianTrackingWeight = 100;
+
+// Expresses J_WE_W and V_WE_desired in frame E, multiplies them by the end
+// effector gains, and stores the rows with positive gains on top of
+// J_WE_E_scaled and V_WE_E_scaled. Returns the number of rows stored.
+int ScaleByEndEffectorGains(
     const math::RigidTransform<double>& X_WE,
     const Eigen::Ref<const Matrix6X<double>>& J_WE_W,
     const multibody::SpatialVelocity<double>& V_WE_desired,
-    const DifferentialInverseKinematicsParameters& parameters) {
+    const Vector6<double>& gain_E, Matrix6X<double>* J_WE_E,
+    EigenPtr<MatrixX<double>> J_WE_E_scaled,
+    EigenPtr<VectorX<double>> V_WE_E_scaled) {
   const math::RotationMatrix<double> R_EW = X_WE.rotation().transpose();
   const multibody::SpatialVelocity<double> V_WE_E = R_EW * V_WE_desired;
 
   // Rotate the 6 x n Jacobian from the world frame W to the E frame.
-  // TODO(Mitiguy) Switch to direct application of RotationMatrix multiplied by
-  // a `6 x n` array if that becomes available.
-  const int num_columns = J_WE_W.cols();
-  Matrix6X<double> J_WE_E{6, num_columns};
-  J_WE_E.topRows<3>() = R_EW * J_WE_W.topRows<3>();
-  J_WE_E.bottomRows<3>() = R_EW * J_WE_W.bottomRows<3>();
+  J_WE_E->topRows<3>().noalias() = R_EW.matrix() * J_WE_W.topRows<3>();
+  J_WE_E->bottomRows<3>().noalias() = R_EW.matrix() * J_WE_W.bottomRows<3>();
 
-  Vector6<double> V_WE_E_scaled;
-  MatrixX<double> J_WE_E_scaled{6, num_columns};
   int num_cart_constraints = 0;
   for (int i = 0; i < 6; i++) {
-    const double gain{parameters.get_end_effector_velocity_gain()(i)};
+    const double gain{gain_E(i)};
     if (gain > 0) {
-      J_WE_E_scaled.row(num_cart_constraints) = gain * J_WE_E.row(i);
-      V_WE_E_scaled(num_cart_constraints) = gain * V_WE_E[i];
+      J_WE_E_scaled->row(num_cart_constraints) = gain * J_WE_E->row(i);
+      (*V_WE_E_scaled)(num_cart_constraints) = gain * V_WE_E[i];
       num_cart_constraints++;
     }
   }
+  return num_cart_constraints;
+}
+}  // namespace
+
+namespace internal {
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const math::RigidTransform<double>& X_WE,
+    const Eigen::Ref<const Matrix6X<double>>& J_WE_W,
+    const multibody::SpatialVelocity<double>& V_WE_desired,
+    const DifferentialInverseKinematicsParameters& parameters) {
+  const int num_columns = J_WE_W.cols();
+  Matrix6X<double> J_WE_E{6, num_columns};
+  Vector6<double> V_WE_E_scaled;
+  MatrixX<double> J_WE_E_scaled{6, num_columns};
+  const int num_cart_constraints = ScaleByEndEffectorGains(
+      X_WE, J_WE_W, V_WE_desired, parameters.get_end_effector_velocity_gain(),
+      &J_WE_E, &J_WE_E_scaled, &V_WE_E_scaled);
 
   return DoDifferentialInverseKinematics(
       q_current, v_current, V_WE_E_scaled.head(num_cart_constraints),
@@ -104,140 +123,267 @@ DifferentialInverseKinematicsParameters::
       num_velocities_(num_velocities),
       nominal_joint_position_(VectorX<double>::Zero(num_positions)) {}
 
-DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
-    const Eigen::Ref<const VectorX<double>>& q_current,
-    const Eigen::Ref<const VectorX<double>>& v_current,
-    const Eigen::Ref<const VectorX<double>>& V,
-    const Eigen::Ref<const MatrixX<double>>& J,
-    const DifferentialInverseKinematicsParameters& parameters) {
-  const int num_positions = parameters.get_num_positions();
-  const int num_velocities = parameters.get_num_velocities();
-  const int num_cart_constraints = V.size();
-  DRAKE_DEMAND(q_current.size() == num_positions);
-  DRAKE_DEMAND(v_current.size() == num_velocities);
-  DRAKE_DEMAND(J.rows() == num_cart_constraints);
-  DRAKE_DEMAND(J.cols() == num_velocities);
+DifferentialInverseKinematicsSolver::DifferentialInverseKinematicsSolver(
+    const DifferentialInverseKinematicsParameters& parameters,
+    int num_cart_constraints)
+    : parameters_(parameters),
+      num_cart_constraints_(num_cart_constraints),
+      V_dir_(num_cart_constraints),
+      bound_lower_(parameters.get_num_velocities()),
+      bound_upper_(parameters.get_num_velocities()),
+      J_WE_W_(6, parameters.get_num_velocities()),
+      J_WE_E_(6, parameters.get_num_velocities()),
+      J_WE_E_scaled_(6, parameters.get_num_velocities()),
+      V_WE_E_scaled_(6) {
+  DRAKE_THROW_UNLESS(num_cart_constraints >= 0);
+  const int num_positions = parameters_.get_num_positions();
+  const int num_velocities = parameters_.get_num_velocities();
+  // A bunch of the operations below assume num_positions == num_velocities.
+  // TODO(russt): Generalize this
+  DRAKE_DEMAND(num_positions == num_velocities);
 
   const auto identity_num_positions =
       MatrixX<double>::Identity(num_positions, num_positions);
 
-  solvers::MathematicalProgram prog;
-  solvers::VectorXDecisionVariable v_next =
-      prog.NewContinuousVariables(num_velocities, "v_next");
-  solvers::VectorDecisionVariable<1> alpha =
-      prog.NewContinuousVariables<1>("alpha");
-
-  const solvers::QuadraticCost* cart_cost = nullptr;
-
-  if (num_cart_constraints > 0) {
-    VectorX<double> V_dir = V.normalized();
-    double V_mag = V.norm();
+  v_next_ = prog_.NewContinuousVariables(num_velocities, "v_next");
+  alpha_ = prog_.NewContinuousVariables<1>("alpha");
 
+  // The coefficients that depend on J, V, q_current or v_current are zero
+  // here, and are set in Solve().
+  if (num_cart_constraints_ > 0) {
     // Constrain the end effector motion to be in the direction of V,
     // and penalize magnitude difference from V.
-    MatrixX<double> A(num_cart_constraints, num_velocities + 1);
-    A.leftCols(num_velocities) = J;
-    A.rightCols(1) = -V_dir;
-    prog.AddLinearEqualityConstraint(
-        A, VectorX<double>::Zero(num_cart_constraints), {v_next, alpha});
-    // TODO(russt): This should not be hard-coded.
-    const double kCartesianTrackingWeight = 100;
-    cart_cost =
-        prog.AddQuadraticErrorCost(Vector1<double>(kCartesianTrackingWeight),
-                                   Vector1<double>(V_mag), alpha)
-            .evaluator()
-            .get();
+    cart_direction_constraint_ = prog_.AddLinearEqualityConstraint(
+        MatrixX<double>::Zero(num_cart_constraints_, num_velocities + 1),
+        VectorX<double>::Zero(num_cart_constraints_), {v_next_, alpha_});
+    cart_cost_ = prog_.AddQuadraticErrorCost(
+        Vector1<double>(kCartesianTrackingWeight), Vector1<double>(0), alpha_);
 
     // Constrain the unconstrained DoFs velocity to be small, which is used
-    // to fulfill the regularization cost.  We use the svd of J = UΣV', in
-    // which the columns of V corresponding to the small/zero singular values
-    // in Σ are the "unconstrained" degrees of freedom.  Since JacobiSVD
-    // always sorts the singular values in decreasing order, we expect these
-    // to be the last columns.  We assume that J is full row-rank, so has
-    // num_cart_constraints non-zero singular values.
-    Eigen::JacobiSVD<MatrixX<double>> svd(J, Eigen::ComputeFullV);
-    if (parameters.get_unconstrained_degrees_of_freedom_velocity_limit()) {
+    // to fulfill the regularization cost. See Solve() for how the constraint
+    // is computed from the SVD of J.
+    if (parameters_.get_unconstrained_degrees_of_freedom_velocity_limit() &&
+        num_cart_constraints_ < num_velocities) {
       const double uncon_v =
-          parameters.get_unconstrained_degrees_of_freedom_velocity_limit()
+          parameters_.get_unconstrained_degrees_of_freedom_velocity_limit()
               .value();
-      for (int i = num_cart_constraints; i < num_velocities; i++) {
-        prog.AddLinearConstraint(svd.matrixV().col(i).transpose(), -uncon_v,
-                                 uncon_v, v_next);
-      }
+      const int num_uncon = num_velocities - num_cart_constraints_;
+      unconstrained_dof_constraint_ = prog_.AddLinearConstraint(
+          MatrixX<double>::Zero(num_uncon, num_velocities),
+          VectorX<double>::Constant(num_uncon, -uncon_v),
+          VectorX<double>::Constant(num_uncon, uncon_v), v_next_);
+      svd_ = Eigen::JacobiSVD<MatrixX<double>>(
+          num_cart_constraints_, num_velocities, Eigen::ComputeFullV);
     }
   }
 
-  for (const auto& constraint : parameters.get_linear_velocity_constraints()) {
-    prog.AddConstraint(
-        solvers::Binding<solvers::LinearConstraint>(constraint, v_next));
+  for (const auto& constraint : parameters_.get_linear_velocity_constraints()) {
+    prog_.AddConstraint(
+        solvers::Binding<solvers::LinearConstraint>(constraint, v_next_));
   }
 
-  // A bunch of the operations below assume num_positions == num_velocities.
-  // TODO(russt): Generalize this
-  DRAKE_DEMAND(num_positions == num_velocities);
-
   // If redundant, add a small regularization term to q_nominal.
-  const double dt{parameters.get_timestep()};
-  if (num_cart_constraints < num_velocities) {
-    prog.AddQuadraticErrorCost(
-        identity_num_positions * dt * dt,
-        (parameters.get_nominal_joint_position() - q_current) / dt, v_next);
+  const double dt{parameters_.get_timestep()};
+  if (num_cart_constraints_ < num_velocities) {
+    nominal_cost_ = prog_.AddQuadraticErrorCost(
+        identity_num_positions * dt * dt, VectorX<double>::Zero(num_positions),
+        v_next_);
   }
 
   // Add q upper and lower joint limit.
-  if (parameters.get_joint_position_limits()) {
-    prog.AddBoundingBoxConstraint(
-        (parameters.get_joint_position_limits()->first - q_current) / dt,
-        (parameters.get_joint_position_limits()->second - q_current) / dt,
-        v_next);
+  if (parameters_.get_joint_position_limits()) {
+    joint_position_constraint_ = prog_.AddBoundingBoxConstraint(
+        VectorX<double>::Zero(num_velocities),
+        VectorX<double>::Zero(num_velocities), v_next_);
   }
 
   // Add v_next constraint.
-  if (parameters.get_joint_velocity_limits()) {
-    prog.AddBoundingBoxConstraint(
-        parameters.get_joint_velocity_limits()->first,
-        parameters.get_joint_velocity_limits()->second, v_next);
+  if (parameters_.get_joint_velocity_limits()) {
+    prog_.AddBoundingBoxConstraint(
+        parameters_.get_joint_velocity_limits()->first,
+        parameters_.get_joint_velocity_limits()->second, v_next_);
   }
 
   // Add vd constraint.
-  if (parameters.get_joint_acceleration_limits()) {
-    prog.AddLinearConstraint(
+  if (parameters_.get_joint_acceleration_limits()) {
+    joint_acceleration_constraint_ = prog_.AddLinearConstraint(
         // TODO(russt): This should be num_velocities if we generalize the
         // implementation.
-        identity_num_positions,
-        parameters.get_joint_acceleration_limits()->first * dt + v_current,
-        parameters.get_joint_acceleration_limits()->second * dt + v_current,
-        v_next);
+        identity_num_positions, VectorX<double>::Zero(num_velocities),
+        VectorX<double>::Zero(num_velocities), v_next_);
+  }
+}
+
+namespace {
+int CountPositiveGains(
+    const DifferentialInverseKinematicsParameters& parameters) {
+  return static_cast<int>(
+      (parameters.get_end_effector_velocity_gain().array() > 0).count());
+}
+}  // namespace
+
+DifferentialInverseKinematicsSolver::DifferentialInverseKinematicsSolver(
+    const DifferentialInverseKinematicsParameters& parameters)
+    : DifferentialInverseKinematicsSolver(parameters,
+                                          CountPositiveGains(parameters)) {}
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const Eigen::Ref<const VectorX<double>>& V,
+    const Eigen::Ref<const MatrixX<double>>& J) {
+  const int num_positions = parameters_.get_num_positions();
+  const int num_velocities = parameters_.get_num_velocities();
+  DRAKE_DEMAND(q_current.size() == num_positions);
+  DRAKE_DEMAND(v_current.size() == num_velocities);
+  DRAKE_DEMAND(V.size() == num_cart_constraints_);
+  DRAKE_DEMAND(J.rows() == num_cart_constraints_);
+  DRAKE_DEMAND(J.cols() == num_velocities);
+
+  if (num_cart_constraints_ > 0) {
+    V_dir_ = V;
+    V_dir_.normalize();
+    const double V_mag = V.norm();
+
+    // J * v_next - V_dir * alpha = 0.
+    solvers::LinearEqualityConstraint& cart_direction =
+        *cart_direction_constraint_->evaluator();
+    for (int i = 0; i < num_cart_constraints_; ++i) {
+      for (int j = 0; j < num_velocities; ++j) {
+        cart_direction.UpdateCoefficientEntry(i, j, J(i, j));
+      }
+      cart_direction.UpdateCoefficientEntry(i, num_velocities, -V_dir_(i));
+    }
+    // kCartesianTrackingWeight * (alpha - |V|)².
+    cart_cost_->evaluator()->update_linear_coefficient_entry(
+        0, -2 * kCartesianTrackingWeight * V_mag);
+    cart_cost_->evaluator()->update_constant_term(kCartesianTrackingWeight *
+                                                  V_mag * V_mag);
+
+    // We use the svd of J = UΣV', in which the columns of V corresponding to
+    // the small/zero singular values in Σ are the "unconstrained" degrees of
+    // freedom.  Since JacobiSVD always sorts the singular values in
+    // decreasing order, we expect these to be the last columns.  We assume
+    // that J is full row-rank, so has num_cart_constraints non-zero singular
+    // values.
+    if (unconstrained_dof_constraint_) {
+      svd_.compute(J, Eigen::ComputeFullV);
+      solvers::LinearConstraint& uncon =
+          *unconstrained_dof_constraint_->evaluator();
+      for (int i = num_cart_constraints_; i < num_velocities; i++) {
+        for (int j = 0; j < num_velocities; ++j) {
+          uncon.UpdateCoefficientEntry(i - num_cart_constraints_, j,
+                                       svd_.matrixV()(j, i));
+        }
+      }
+    }
+  }
+
+  const double dt{parameters_.get_timestep()};
+  if (nominal_cost_) {
+    // | q_current + v_next * dt - q_nominal |², written as a cost on v_next.
+    const VectorX<double>& q_nominal = parameters_.get_nominal_joint_position();
+    double constant_term{0};
+    for (int i = 0; i < num_positions; ++i) {
+      const double q_err = q_nominal(i) - q_current(i);
+      nominal_cost_->evaluator()->update_linear_coefficient_entry(
+          i, -2 * dt * q_err);
+      constant_term += q_err * q_err;
+    }
+    nominal_cost_->evaluator()->update_constant_term(constant_term);
+  }
+
+  if (joint_position_constraint_) {
+    bound_lower_ =
+        (parameters_.get_joint_position_limits()->first - q_current) / dt;
+    bound_upper_ =
+        (parameters_.get_joint_position_limits()->second - q_current) / dt;
+    joint_position_constraint_->evaluator()->set_bounds(bound_lower_,
+                                                        bound_upper_);
+  }
+
+  if (joint_acceleration_constraint_) {
+    bound_lower_ =
+        parameters_.get_joint_acceleration_limits()->first * dt + v_current;
+    bound_upper_ =
+        parameters_.get_joint_acceleration_limits()->second * dt + v_current;
+    joint_acceleration_constraint_->evaluator()->set_bounds(bound_lower_,
+                                                            bound_upper_);
   }
 
   // Solve
-  solvers::OsqpSolver solver;
-  solvers::MathematicalProgramResult result = solver.Solve(prog, {}, {});
+  solver_.Solve(prog_, {}, {}, &result_);
 
-  if (!result.is_success()) {
+  if (!result_.is_success()) {
     return {std::nullopt,
             DifferentialInverseKinematicsStatus::kNoSolutionFound};
   }
 
-  if (num_cart_constraints) {
+  if (num_cart_constraints_) {
     VectorX<double> cost(1);
-    cart_cost->Eval(result.GetSolution(alpha), &cost);
+    cart_cost_->evaluator()->Eval(result_.GetSolution(alpha_), &cost);
     const double kMaxTrackingError = 5;
     const double kMinEndEffectorVel = 1e-2;
     if (cost(0) > kMaxTrackingError &&
-        result.GetSolution(alpha)[0] <= kMinEndEffectorVel) {
+        result_.GetSolution(alpha_)[0] <= kMinEndEffectorVel) {
       // Not tracking the desired vel norm (large tracking error) and the
       // computed vel is small.
-      log()->info("v_next = {}", result.GetSolution(v_next).transpose());
-      log()->info("alpha = {}", result.GetSolution(alpha).transpose());
+      log()->info("v_next = {}", result_.GetSolution(v_next_).transpose());
+      log()->info("alpha = {}", result_.GetSolution(alpha_).transpose());
       return {std::nullopt, DifferentialInverseKinematicsStatus::kStuck};
     }
   }
 
-  return {result.GetSolution(v_next),
+  return {result_.GetSolution(v_next_),
           DifferentialInverseKinematicsStatus::kSolutionFound};
 }
 
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const multibody::MultibodyPlant<double>& robot,
+    const systems::Context<double>& context,
+    const Vector6<double>& V_WE_desired,
+    const multibody::Frame<double>& frame_E) {
+  const math::RigidTransform<double> X_WE =
+      robot.CalcRelativeTransform(context, robot.world_frame(), frame_E);
+  const multibody::Frame<double>& frame_W = robot.world_frame();
+  robot.CalcJacobianSpatialVelocity(context,
+                                    multibody::JacobianWrtVariable::kV,
+                                    frame_E, Vector3<double>::Zero(),
+                                    frame_W, frame_W, &J_WE_W_);
+  const int num_cart_constraints = ScaleByEndEffectorGains(
+      X_WE, J_WE_W_, multibody::SpatialVelocity<double>(V_WE_desired),
+      parameters_.get_end_effector_velocity_gain(), &J_WE_E_, &J_WE_E_scaled_,
+      &V_WE_E_scaled_);
+  DRAKE_DEMAND(num_cart_constraints == num_cart_constraints_);
+  return Solve(robot.GetPositions(context), robot.GetVelocities(context),
+               V_WE_E_scaled_.head(num_cart_constraints_),
+               J_WE_E_scaled_.topRows(num_cart_constraints_));
+}
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const multibody::MultibodyPlant<double>& robot,
+    const systems::Context<double>& context,
+    const Isometry3<double>& X_WE_desired,
+    const multibody::Frame<double>& frame_E) {
+  const math::RigidTransform<double> X_WE =
+      robot.EvalBodyPoseInWorld(context, frame_E.body()) *
+      frame_E.CalcPoseInBodyFrame(context);
+  const Vector6<double> V_WE_desired =
+      ComputePoseDiffInCommonFrame(X_WE.GetAsIsometry3(), X_WE_desired) /
+      parameters_.get_timestep();
+  return Solve(robot, context, V_WE_desired, frame_E);
+}
+
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const Eigen::Ref<const VectorX<double>>& V,
+    const Eigen::Ref<const MatrixX<double>>& J,
+    const DifferentialInverseKinematicsParameters& parameters) {
+  DifferentialInverseKinematicsSolver solver(parameters, V.size());
+  return solver.Solve(q_current, v_current, V, J);
+}
+
 DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const multibody::MultibodyPlant<double>& plant,
     const systems::Context<double>& context,
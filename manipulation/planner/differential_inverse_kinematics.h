@@ -16,6 +16,7 @@
 #include "drake/multibody/math/spatial_algebra.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
 
 namespace drake {
 namespace manipulation {
@@ -335,6 +336,115 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const multibody::Frame<double>& frame_E,
     const DifferentialInverseKinematicsParameters& parameters);
 
+/**
+ * Solves the same program as DoDifferentialInverseKinematics(), but builds it
+ * once and reuses it across calls, which suits control loops that solve it at
+ * a high rate with fixed parameters.
+ *
+ * The program is built in the constructor from a copy of @p parameters, so
+ * later changes to the parameters object are not seen by the solver (except
+ * through the shared linear velocity constraints). Each call to Solve() only
+ * updates the coefficients that depend on J, V, q_current and v_current, in
+ * place: the end effector direction constraint, the null space velocity limit,
+ * the nominal posture cost, and the bounds of the joint position and
+ * acceleration limits. The Jacobian buffers and the SVD workspace of J are
+ * also allocated once. The QP itself is still handed to OSQP from scratch on
+ * every call.
+ */
+class DifferentialInverseKinematicsSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DifferentialInverseKinematicsSolver)
+
+  /**
+   * Builds the program for a Jacobian with @p num_cart_constraints rows.
+   * @pre parameters.get_num_positions() == parameters.get_num_velocities().
+   * @throws std::exception if num_cart_constraints is negative.
+   */
+  DifferentialInverseKinematicsSolver(
+      const DifferentialInverseKinematicsParameters& parameters,
+      int num_cart_constraints);
+
+  /**
+   * Builds the program for tracking a frame, with one Cartesian constraint for
+   * each positive entry of parameters.get_end_effector_velocity_gain(), as
+   * in the frame-tracking overloads of DoDifferentialInverseKinematics().
+   */
+  explicit DifferentialInverseKinematicsSolver(
+      const DifferentialInverseKinematicsParameters& parameters);
+
+  /**
+   * Same as DoDifferentialInverseKinematics(q_current, v_current, V, J,
+   * parameters), with the parameters passed to the constructor.
+   * @pre V.size() == J.rows() == num_cart_constraints().
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const Eigen::Ref<const VectorX<double>>& q_current,
+      const Eigen::Ref<const VectorX<double>>& v_current,
+      const Eigen::Ref<const VectorX<double>>& V,
+      const Eigen::Ref<const MatrixX<double>>& J);
+
+  /**
+   * Same as DoDifferentialInverseKinematics(robot, context, V_WE_desired,
+   * frame_E, parameters), with the parameters passed to the constructor.
+   * @pre num_cart_constraints() is the number of positive end effector gains.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const multibody::MultibodyPlant<double>& robot,
+      const systems::Context<double>& context,
+      const Vector6<double>& V_WE_desired,
+      const multibody::Frame<double>& frame_E);
+
+  /**
+   * Same as DoDifferentialInverseKinematics(robot, context, X_WE_desired,
+   * frame_E, parameters), with the parameters passed to the constructor.
+   * @pre num_cart_constraints() is the number of positive end effector gains.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const multibody::MultibodyPlant<double>& robot,
+      const systems::Context<double>& context,
+      const Isometry3<double>& X_WE_desired,
+      const multibody::Frame<double>& frame_E);
+
+  const DifferentialInverseKinematicsParameters& parameters() const {
+    return parameters_;
+  }
+
+  int num_cart_constraints() const { return num_cart_constraints_; }
+
+ private:
+  const DifferentialInverseKinematicsParameters parameters_;
+  const int num_cart_constraints_;
+
+  solvers::MathematicalProgram prog_;
+  solvers::VectorXDecisionVariable v_next_;
+  solvers::VectorDecisionVariable<1> alpha_;
+
+  // Each of these is only added when the parameters call for it.
+  std::optional<solvers::Binding<solvers::LinearEqualityConstraint>>
+      cart_direction_constraint_;
+  std::optional<solvers::Binding<solvers::QuadraticCost>> cart_cost_;
+  std::optional<solvers::Binding<solvers::LinearConstraint>>
+      unconstrained_dof_constraint_;
+  std::optional<solvers::Binding<solvers::QuadraticCost>> nominal_cost_;
+  std::optional<solvers::Binding<solvers::BoundingBoxConstraint>>
+      joint_position_constraint_;
+  std::optional<solvers::Binding<solvers::LinearConstraint>>
+      joint_acceleration_constraint_;
+
+  Eigen::JacobiSVD<MatrixX<double>> svd_;
+  solvers::OsqpSolver solver_;
+  solvers::MathematicalProgramResult result_;
+
+  // Scratch space, sized once in the constructor.
+  VectorX<double> V_dir_;
+  VectorX<double> bound_lower_;
+  VectorX<double> bound_upper_;
+  MatrixX<double> J_WE_W_;
+  Matrix6X<double> J_WE_E_;
+  MatrixX<double> J_WE_E_scaled_;
+  VectorX<double> V_WE_E_scaled_;
+};
+
 #ifndef DRAKE_DOXYGEN_CXX
 namespace internal {
 DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
@@ -243,6 +243,36 @@ TEST_F(DifferentialInverseKinematicsTest, SimpleTracker) {
                               1e-5, MatrixCompareType::absolute));
 }
 
+TEST_F(DifferentialInverseKinematicsTest, ReusedSolver) {
+  // The stateful solver only updates its program between calls, and should
+  // agree with the stateless function at every step.
+  const VectorXd vd_limits = VectorXd::Constant(plant_->num_velocities(), 50);
+  params_->set_joint_acceleration_limits({-vd_limits, vd_limits});
+  DifferentialInverseKinematicsSolver solver(*params_);
+  EXPECT_EQ(solver.num_cart_constraints(), 6);
+
+  math::RigidTransform<double> X_WE = frame_E_->CalcPoseInWorld(*context_);
+  const math::RigidTransform<double> X_WE_desired =
+      math::RigidTransform<double>(Vector3d(-0.02, -0.01, -0.03)) * X_WE;
+  const double dt = params_->get_timestep();
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    const DifferentialInverseKinematicsResult expected =
+        DoDiffIKForRigidTransform(X_WE_desired);
+    const DifferentialInverseKinematicsResult result = solver.Solve(
+        *plant_, *context_, X_WE_desired.GetAsIsometry3(), *frame_E_);
+    ASSERT_EQ(result.status, expected.status);
+    ASSERT_EQ(result.status,
+              DifferentialInverseKinematicsStatus::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(result.joint_velocities.value(),
+                                expected.joint_velocities.value(), 1E-10));
+
+    const VectorXd q = plant_->GetPositions(*context_);
+    const VectorXd v = result.joint_velocities.value();
+    plant_->SetPositions(context_, q + v * dt);
+    plant_->SetVelocities(context_, v);
+  }
+}
+
 // Test various throw conditions.
 GTEST_TEST(DifferentialInverseKinematicsParametersTest, TestSetter) {
   DifferentialInverseKinematicsParameters dut(1, 1);
@@ -19,15 +19,18 @@ BarycentricMesh<T>::BarycentricMesh(MeshGrid input_grid)
       stride_(input_grid_.size()),
       num_interpolants_{1} {
   DRAKE_DEMAND(input_grid_.size() > 0);
+  coordinates_.reserve(input_grid_.size());
   for (int i = 0; i < get_input_size(); i++) {
     // Must define at least one mesh point per dimension.
     DRAKE_DEMAND(!input_grid_[i].empty());
+    coordinates_.emplace_back(input_grid_[i].begin(), input_grid_[i].end());
 
     // Gain one interpolant for every non-singleton dimension.
     if (input_grid_[i].size() > 1) num_interpolants_++;
 
     stride_[i] = (i == 0) ? 1 : input_grid_[i - 1].size() * stride_[i - 1];
   }
+  DRAKE_DEMAND(num_interpolants_ <= kMaxInterpolants);
 }
 
 template <typename T>
@@ -75,15 +78,25 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   DRAKE_DEMAND(input.size() == static_cast<int>(input_grid_.size()));
   DRAKE_DEMAND(mesh_indices != nullptr && weights != nullptr);
 
-  // std::pair of fractional position [0,1] and dimension index (position first,
-  // so that std::pair's default operator< works for us).
+  mesh_indices->resize(num_interpolants_);
+  weights->resize(num_interpolants_);
+
   // There is one relative position for every non-singleton input dimension.  In
   // the case of triangular meshes, there is one interpolant for every
   // non-singular dimension + one additional, so num_interpolants-1 is the size
-  // we need.
-  std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
-  // Bounding box on the input grid containing the sample input.
-  std::vector<bool> has_volume(get_input_size());
+  // we need.  To avoid any allocation, the fractional positions [0,1] are
+  // stored in (*weights)[1:] and the tagged dimension indices in
+  // (*mesh_indices)[1:] until the final weights and indices are computed.
+  auto position = [weights](int k) -> T& { return (*weights)[k + 1]; };
+  auto dimension = [mesh_indices](int k) -> int& {
+    return (*mesh_indices)[k + 1];
+  };
+  // Whether the bounding box on the input grid containing the sample input has
+  // volume in dimension i, i.e., whether input[i] lies inside the grid.
+  auto has_volume = [this, &input](int i) {
+    return input[i] > coordinates_[i].front() &&
+           input[i] <= coordinates_[i].back();
+  };
 
   int current_index = 0;
 
@@ -91,69 +104,73 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   // indices.  Set current_index to the "top right" corner index.
   int count = 0;
   for (int i = 0; i < get_input_size(); i++) {
-    const auto& coords = input_grid_[i];
+    const std::vector<double>& coords = coordinates_[i];
+    const int num_coords = coords.size();
 
     // Skip over singleton dimensions.
-    if (coords.size() == 1) continue;
-
-    // Tag the positions with the dimension index.
-    relative_position[count].second = i;
+    if (num_coords == 1) continue;
 
     // Find the right side of the bounding box.
     // Recall that lower_bound returns the first grid element that is NOT less
     // than the sample.
-    auto right_iter = coords.lower_bound(input[i]);
-    int right_index = 0;
-
-    if (right_iter == coords.end()) {
+    const int right_index =
+        std::lower_bound(coords.begin(), coords.end(), input[i]) -
+        coords.begin();
+    T relative_position;
+    if (right_index == num_coords) {
       // ... then input is off the right end of the grid;
       // move it to the right boundary.
-      has_volume[i] = false;
-      right_index = coords.size() - 1;
-      relative_position[count].first = T(1.);
-    } else if (right_iter == coords.begin()) {
+      current_index += stride_[i] * (num_coords - 1);
+      relative_position = T(1.);
+    } else if (right_index == 0) {
       // ... then input is at the first element or left of it;
       // move it to the left boundary.
-      has_volume[i] = false;
-      right_index = 0;
-      relative_position[count].first = T(1.);
+      relative_position = T(1.);
     } else {
       // ... then input is inside the grid.
-      has_volume[i] = true;
-      right_index = std::distance(coords.begin(), right_iter);
-      const T& right_value = *(right_iter);
-      const T& left_value = *(std::prev(right_iter));
-      relative_position[count].first =
-          (input[i] - left_value) / (right_value - left_value);
+      current_index += stride_[i] * right_index;
+      const T& right_value = coords[right_index];
+      const T& left_value = coords[right_index - 1];
+      relative_position = (input[i] - left_value) / (right_value - left_value);
     }
 
-    current_index += stride_[i] * right_index;
+    // Sort the dimensions by their relative position (and then by dimension
+    // index, since ties keep their order), by insertion.  We identify which
+    // triangle of the mesh we are in by moving along the faces in order of
+    // their relative position.
+    int k = count;
+    while (k > 0 && relative_position < position(k - 1)) {
+      position(k) = position(k - 1);
+      dimension(k) = dimension(k - 1);
+      --k;
+    }
+    position(k) = relative_position;
+    dimension(k) = i;
     count++;
   }
   DRAKE_ASSERT(count == (num_interpolants_ - 1));
 
-  // Sort the dimensions by their relative position.  We identify which triangle
-  // of the mesh we are in by moving along the faces in order of their relative
-  // position.
-  std::sort(relative_position.begin(), relative_position.end());
+  if (count == 0) {
+    (*mesh_indices)[0] = current_index;
+    (*weights)[0] = T(1.);
+    return;
+  }
 
-  mesh_indices->resize(num_interpolants_);
-  weights->resize(num_interpolants_);
+  // Overwrite the sorted positions and dimensions with the weights and indices,
+  // in order; entry i is only overwritten once it has been read.
+  T previous_position = position(0);
   (*mesh_indices)[0] = current_index;
-  (*weights)[0] = relative_position[0].first;
-
+  (*weights)[0] = previous_position;
   for (int i = 1; i < num_interpolants_; i++) {
-    int dim = relative_position[i - 1].second;
-    if (has_volume[dim]) {
+    const int dim = dimension(i - 1);
+    const T next_position =
+        (i == (num_interpolants_ - 1)) ? T(1.) : position(i);
+    if (has_volume(dim)) {
       current_index -= stride_[dim];
     }
     (*mesh_indices)[i] = current_index;
-    if (i == (num_interpolants_ - 1)) {
-      (*weights)[i] = 1.0 - relative_position[i - 1].first;
-    } else {
-      (*weights)[i] =
-          relative_position[i].first - relative_position[i - 1].first;
-    }
+    (*weights)[i] = next_position - previous_position;
+    previous_position = next_position;
   }
 }
 
@@ -171,6 +188,37 @@ VectorX<T> BarycentricMesh<T>::Eval(
   return EvalWithMixedScalars<T>(mesh_values, input);
 }
 
+template <typename T>
+void BarycentricMesh<T>::EvalBatch(
+    const Eigen::Ref<const MatrixX<T>>& mesh_values,
+    const Eigen::Ref<const MatrixX<T>>& inputs,
+    EigenPtr<MatrixX<T>> outputs) const {
+  DRAKE_DEMAND(outputs != nullptr);
+  DRAKE_DEMAND(inputs.rows() == get_input_size());
+  DRAKE_DEMAND(mesh_values.cols() == get_num_mesh_points());
+
+  InterpolantIndices mesh_indices(num_interpolants_);
+  InterpolantWeights weights(num_interpolants_);
+  outputs->resize(mesh_values.rows(), inputs.cols());
+  for (int j = 0; j < inputs.cols(); j++) {
+    EvalBarycentricWeights(inputs.col(j), &mesh_indices, &weights);
+    auto output = outputs->col(j);
+    output.noalias() = weights[0] * mesh_values.col(mesh_indices[0]);
+    for (int i = 1; i < num_interpolants_; i++) {
+      output.noalias() += weights[i] * mesh_values.col(mesh_indices[i]);
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> BarycentricMesh<T>::EvalBatch(
+    const Eigen::Ref<const MatrixX<T>>& mesh_values,
+    const Eigen::Ref<const MatrixX<T>>& inputs) const {
+  MatrixX<T> outputs(mesh_values.rows(), inputs.cols());
+  EvalBatch(mesh_values, inputs, &outputs);
+  return outputs;
+}
+
 template <typename T>
 MatrixX<T> BarycentricMesh<T>::MeshValuesFrom(
     const std::function<VectorX<T>(const Eigen::Ref<const VectorX<T>>&)>&
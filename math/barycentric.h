@@ -119,6 +119,25 @@ class BarycentricMesh {
   VectorX<T> Eval(const Eigen::Ref<const MatrixX<T>>& mesh_values,
                   const Eigen::Ref<const VectorX<T>>& input) const;
 
+  /// Evaluates the function at each column of @p inputs, by interpolating
+  /// between the values at @p mesh_values.  This is equivalent to calling Eval
+  /// once per column, but reuses the same scratch memory for all queries.
+  ///
+  /// @param mesh_values is a num_outputs by get_num_mesh_points() matrix
+  /// containing the points to interpolate between, as in Eval.
+  /// @param inputs is a get_input_size() by num_queries matrix, with one input
+  /// per column.
+  /// @param outputs is resized to num_outputs by num_queries, and each column
+  /// is set to the function evaluated at the corresponding column of @p inputs.
+  void EvalBatch(const Eigen::Ref<const MatrixX<T>>& mesh_values,
+                 const Eigen::Ref<const MatrixX<T>>& inputs,
+                 EigenPtr<MatrixX<T>> outputs) const;
+
+  /// Returns the function evaluated at each column of @p inputs.
+  /// @see EvalBatch
+  MatrixX<T> EvalBatch(const Eigen::Ref<const MatrixX<T>>& mesh_values,
+                       const Eigen::Ref<const MatrixX<T>>& inputs) const;
+
   /// Performs Eval, but with the possibility of the values on the mesh
   /// having a different scalar type than the values defining the mesh
   /// (symbolic::Expression containing decision variables for an optimization
@@ -134,8 +153,9 @@ class BarycentricMesh {
     DRAKE_DEMAND(input.size() == get_input_size());
     DRAKE_DEMAND(mesh_values.cols() == get_num_mesh_points());
 
-    Eigen::VectorXi mesh_indices(num_interpolants_);
-    VectorX<T> weights(num_interpolants_);
+    // These buffers are allocated on the stack.
+    InterpolantIndices mesh_indices(num_interpolants_);
+    InterpolantWeights weights(num_interpolants_);
 
     EvalBarycentricWeights(input, &mesh_indices, &weights);
 
@@ -168,8 +188,18 @@ class BarycentricMesh {
           vector_func) const;
 
  private:
+  // Every non-singleton dimension doubles the number of mesh points, so no mesh
+  // whose number of points fits in an int has more interpolants than this.
+  static constexpr int kMaxInterpolants = 32;
+  using InterpolantIndices =
+      Eigen::Matrix<int, Eigen::Dynamic, 1, 0, kMaxInterpolants, 1>;
+  using InterpolantWeights =
+      Eigen::Matrix<T, Eigen::Dynamic, 1, 0, kMaxInterpolants, 1>;
+
   MeshGrid input_grid_;      // Specifies the location of the mesh points in
                              // the input space.
+  // The coordinates of input_grid_, stored contiguously for faster lookups.
+  std::vector<std::vector<double>> coordinates_;
   std::vector<int> stride_;  // The number of elements to skip to arrive at the
                              // next value (per input dimension)
   int num_interpolants_{1};  // The number of points used in any interpolation.
@@ -105,6 +105,36 @@ T BsplineBasis<T>::EvaluateBasisFunctionI(int index,
   return EvaluateCurve(delta, parameter_value);
 }
 
+template <typename T>
+std::vector<T> BsplineBasis<T>::EvaluateActiveBasisFunctions(
+    const T& parameter_value) const {
+  DRAKE_DEMAND(parameter_value >= initial_parameter_value());
+  DRAKE_DEMAND(parameter_value <= final_parameter_value());
+  /* This is the triangular Cox-de Boor recurrence of Algorithm A2.2 in
+  Piegl and Tiller, "The NURBS Book", 2nd ed. With 𝑙 the containing interval,
+  N[r] holds the value of basis function 𝑙 - j + r for degree j. Since
+  t[𝑙] < t[𝑙 + 1], none of the denominators is zero. */
+  const std::vector<T>& t = knots();
+  const T& t_bar = parameter_value;
+  const int ell = FindContainingInterval(t_bar);
+  std::vector<T> N(order(), 0.0);
+  std::vector<T> left(order());
+  std::vector<T> right(order());
+  N[0] = 1.0;
+  for (int j = 1; j < order(); ++j) {
+    left[j] = t_bar - t[ell + 1 - j];
+    right[j] = t[ell + j] - t_bar;
+    T saved = 0.0;
+    for (int r = 0; r < j; ++r) {
+      const T temp = N[r] / (right[r + 1] + left[j - r]);
+      N[r] = saved + right[r + 1] * temp;
+      saved = left[j - r] * temp;
+    }
+    N[j] = saved;
+  }
+  return N;
+}
+
 template <typename T>
 int BsplineBasis<T>::FindContainingInterval(const T& parameter_value) const {
   DRAKE_ASSERT(parameter_value >= initial_parameter_value());
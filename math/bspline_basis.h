@@ -122,6 +122,17 @@ class BsplineBasis final {
   std::vector<int> ComputeActiveBasisFunctionIndices(
       const T& parameter_value) const;
 
+  /** Returns the values at `parameter_value` of the basis functions whose
+  indices are returned by ComputeActiveBasisFunctionIndices(parameter_value),
+  in the same order; all other basis functions are zero at this point. These
+  are also the non-zero entries of the gradient of EvaluateCurve() with
+  respect to the control points. All of them are computed at once, in
+  O(order²) operations, which is cheaper than one call to
+  EvaluateBasisFunctionI() per index.
+  @pre parameter_value ≥ initial_parameter_value()
+  @pre parameter_value ≤ final_parameter_value() */
+  std::vector<T> EvaluateActiveBasisFunctions(const T& parameter_value) const;
+
   /** Evaluates the B-spline curve defined by `this` and `control_points` at the
   given `parameter_value`.
   @param control_points Control points of the B-spline curve.
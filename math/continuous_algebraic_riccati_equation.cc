@@ -1,10 +1,70 @@
 #include "drake/math/continuous_algebraic_riccati_equation.h"
 
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/math/continuous_lyapunov_equation.h"
 
 namespace drake {
 namespace math {
+namespace {
+
+bool IsHurwitz(const Eigen::MatrixXd& A) {
+  Eigen::EigenSolver<Eigen::MatrixXd> es(A, false /* eigenvalues only */);
+  return es.info() == Eigen::Success &&
+         (A.rows() == 0 || es.eigenvalues().real().maxCoeff() < 0);
+}
+
+// Runs the Newton-Kleinman iteration from S_initial. Returns nullopt if the
+// initial gain is not stabilizing or the iteration does not converge.
+std::optional<Eigen::MatrixXd> SolveByNewtonKleinman(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::LLT<Eigen::MatrixXd>& R_cholesky,
+    const Eigen::Ref<const Eigen::MatrixXd>& S_initial) {
+  // these could be options
+  const double tolerance = 1e-10;
+  const int max_iterations = 50;
+
+  Eigen::MatrixXd S = S_initial;
+  Eigen::MatrixXd BtS = B.transpose() * S;
+  Eigen::MatrixXd K = R_cholesky.solve(BtS);
+  Eigen::MatrixXd Ac = A - B * K;
+  if (!IsHurwitz(Ac)) {
+    return std::nullopt;
+  }
+  // Each iteration solves Ac'S + S Ac + Q + K'RK = 0 for the cost-to-go S of
+  // the current gain K, and then improves the gain to K = R⁻¹B'S. The closed
+  // loop remains stable throughout, so each Lyapunov equation has a unique
+  // solution.
+  for (int iteration = 0; iteration < max_iterations; ++iteration) {
+    Eigen::MatrixXd Q_K = Q + BtS.transpose() * K;
+    Q_K = (Q_K + Q_K.transpose().eval()) / 2.0;
+    Eigen::MatrixXd S_next;
+    try {
+      S_next = RealContinuousLyapunovEquation(Ac, Q_K);
+    } catch (const std::runtime_error&) {
+      return std::nullopt;
+    }
+    S_next = (S_next + S_next.transpose().eval()) / 2.0;
+    const double change = (S_next - S).norm();
+    S = std::move(S_next);
+    if (change <= tolerance * std::max(1.0, S.norm())) {
+      return S;
+    }
+    BtS = B.transpose() * S;
+    K = R_cholesky.solve(BtS);
+    Ac = A - B * K;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
 
 Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
@@ -78,5 +138,41 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
   return ContinuousAlgebraicRiccatiEquation(A, B, Q, R_cholesky);
 }
 
+Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::LLT<Eigen::MatrixXd>& R_cholesky,
+    const Eigen::Ref<const Eigen::MatrixXd>& S_initial) {
+  const Eigen::Index n = B.rows(), m = B.cols();
+  DRAKE_DEMAND(A.rows() == n && A.cols() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(R_cholesky.matrixL().rows() == m &&
+               R_cholesky.matrixL().cols() == m);
+  DRAKE_DEMAND(S_initial.rows() == n && S_initial.cols() == n);
+  DRAKE_DEMAND(is_approx_equal_abstol(Q, Q.transpose(), 1e-10));
+
+  std::optional<Eigen::MatrixXd> S =
+      SolveByNewtonKleinman(A, B, Q, R_cholesky, S_initial);
+  if (S.has_value()) {
+    return *std::move(S);
+  }
+  return ContinuousAlgebraicRiccatiEquation(A, B, Q, R_cholesky);
+}
+
+Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& S_initial) {
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+  return ContinuousAlgebraicRiccatiEquation(A, B, Q, R_cholesky, S_initial);
+}
+
 }  // namespace math
 }  // namespace drake
@@ -32,5 +32,38 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::LLT<Eigen::MatrixXd>& R_cholesky);
 
+/// Computes the same stabilizing solution S as
+/// ContinuousAlgebraicRiccatiEquation(A, B, Q, R), but warm started from
+/// `S_initial`, e.g. the solution for nearby values of A, B, Q, and R as when
+/// recomputing the gains of a gain-scheduled controller online.
+///
+/// When the gain K₀ = R⁻¹B'S_initial stabilizes A (i.e., A - BK₀ is Hurwitz),
+/// this uses the Newton-Kleinman iteration, which solves one n x n Lyapunov
+/// equation per iteration and converges quadratically from a nearby initial
+/// guess. This is considerably cheaper than the matrix sign function iteration
+/// on the 2n x 2n Hamiltonian. Otherwise, or if the iteration fails to
+/// converge, this falls back to ContinuousAlgebraicRiccatiEquation(A, B, Q, R).
+///
+/// D. Kleinman. On an iterative technique for Riccati equation computations.
+/// IEEE Trans. Automatic Control, 13(1):114–115, 1968.
+///
+/// @throws std::runtime_error if R is not positive definite.
+Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& S_initial);
+
+/// This is functionally the same as
+/// ContinuousAlgebraicRiccatiEquation(A, B, Q, R, S_initial).
+/// The Cholesky decomposition of R is passed in instead of R.
+Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::LLT<Eigen::MatrixXd>& R_cholesky,
+    const Eigen::Ref<const Eigen::MatrixXd>& S_initial);
+
 }  // namespace math
 }  // namespace drake
@@ -1,8 +1,14 @@
 #include "drake/math/discrete_algebraic_riccati_equation.h"
 
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/math/discrete_lyapunov_equation.h"
 
 namespace drake {
 namespace math {
@@ -344,6 +350,57 @@ void reorder_eigen(Eigen::Ref<Eigen::MatrixXd> S, Eigen::Ref<Eigen::MatrixXd> T,
   if (p < n && q >= n2)
     throw std::runtime_error("fail to find enough stable eigenvalues");
 }
+
+bool IsSchurStable(const Eigen::MatrixXd& A) {
+  Eigen::EigenSolver<Eigen::MatrixXd> es(A, false /* eigenvalues only */);
+  return es.info() == Eigen::Success &&
+         (A.rows() == 0 || es.eigenvalues().cwiseAbs().maxCoeff() < 1);
+}
+
+// Runs Hewer's iteration from X_initial. Returns nullopt if the initial gain
+// is not stabilizing or the iteration does not converge.
+std::optional<Eigen::MatrixXd> SolveByHewer(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& X_initial) {
+  const double tolerance = 1e-10;
+  const int max_iterations = 50;
+
+  Eigen::MatrixXd X = X_initial;
+  auto gain = [&](const Eigen::MatrixXd& X_k) {
+    const Eigen::MatrixXd BtX = B.transpose() * X_k;
+    return Eigen::MatrixXd((R + BtX * B).llt().solve(BtX * A));
+  };
+  Eigen::MatrixXd K = gain(X);
+  Eigen::MatrixXd Ac = A - B * K;
+  if (!IsSchurStable(Ac)) {
+    return std::nullopt;
+  }
+  // Each iteration solves Ac'XAc - X + Q + K'RK = 0 for the cost-to-go X of
+  // the current gain K, and then improves the gain. The closed loop remains
+  // stable throughout, so each Stein equation has a unique solution.
+  for (int iteration = 0; iteration < max_iterations; ++iteration) {
+    Eigen::MatrixXd Q_K = Q + K.transpose() * R * K;
+    Q_K = (Q_K + Q_K.transpose().eval()) / 2.0;
+    Eigen::MatrixXd X_next;
+    try {
+      X_next = RealDiscreteLyapunovEquation(Ac, Q_K);
+    } catch (const std::runtime_error&) {
+      return std::nullopt;
+    }
+    X_next = (X_next + X_next.transpose().eval()) / 2.0;
+    const double change = (X_next - X).norm();
+    X = std::move(X_next);
+    if (change <= tolerance * std::max(1.0, X.norm())) {
+      return X;
+    }
+    K = gain(X);
+    Ac = A - B * K;
+  }
+  return std::nullopt;
+}
 }  // namespace
 
 /**
@@ -424,5 +481,33 @@ Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
   return X;
 }
 
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& X_initial) {
+  int n = B.rows(), m = B.cols();
+
+  DRAKE_DEMAND(A.rows() == n && A.cols() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(R.rows() == m && R.cols() == m);
+  DRAKE_DEMAND(X_initial.rows() == n && X_initial.cols() == n);
+  DRAKE_DEMAND(is_approx_equal_abstol(Q, Q.transpose(), 1e-10));
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(Q);
+  for (int i = 0; i < n; i++) {
+    DRAKE_THROW_UNLESS(es.eigenvalues()[i] >= 0);
+  }
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  DRAKE_THROW_UNLESS(R_cholesky.info() == Eigen::Success);
+
+  std::optional<Eigen::MatrixXd> X = SolveByHewer(A, B, Q, R, X_initial);
+  if (X.has_value()) {
+    return *std::move(X);
+  }
+  return DiscreteAlgebraicRiccatiEquation(A, B, Q, R);
+}
+
 }  // namespace math
 }  // namespace drake
@@ -27,6 +27,32 @@ Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& B,
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::Ref<const Eigen::MatrixXd>& R);
+
+/// Computes the same stabilizing solution X as
+/// DiscreteAlgebraicRiccatiEquation(A, B, Q, R), but warm started from
+/// `X_initial`, e.g. the solution for nearby values of A, B, Q, and R as when
+/// recomputing the gains of a gain-scheduled controller online.
+///
+/// When the gain K₀ = (B'X_initial B + R)⁻¹B'X_initial A stabilizes A (i.e.,
+/// all eigenvalues of A - BK₀ lie strictly inside the unit circle), this uses
+/// Hewer's Newton iteration, which solves one n x n Stein (discrete Lyapunov)
+/// equation per iteration and converges quadratically from a nearby initial
+/// guess. This avoids the QZ decomposition of the 2n x 2n symplectic pencil.
+/// Otherwise, or if the iteration fails to converge, this falls back to
+/// DiscreteAlgebraicRiccatiEquation(A, B, Q, R).
+///
+/// G. Hewer. An iterative technique for the computation of the steady state
+/// gains for the discrete optimal regulator. IEEE Trans. Automatic Control,
+/// 16(4):382–384, 1971.
+///
+/// @throws std::runtime_error if Q is not positive semi-definite.
+/// @throws std::runtime_error if R is not positive definite.
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& X_initial);
 }  // namespace math
 }  // namespace drake
 
@@ -444,6 +444,21 @@ class RigidTransform {
     return RigidTransform<T>(rotation() * other.rotation(), p_AoCo_A);
   }
 
+  /// Calculates the product of `this` inverted and another %RigidTransform.
+  /// If you consider `this` to be the transform `X_AB`, and `other` to be
+  /// `X_AC`, then this method returns `X_BC = X_AB⁻¹ * X_AC`.
+  /// This is equivalent to `inverse() * other` but it computes the result
+  /// directly as `R_BC = R_ABᵀ * R_AC` and `p_BoCo_B = R_ABᵀ * (p_AoCo_A -
+  /// p_AoBo_A)`, without forming the intermediate inverse transform.
+  /// @param[in] other %RigidTransform that post-multiplies `this` inverted.
+  /// @retval X_BC where `X_BC = this⁻¹ * other`.
+  RigidTransform<T> InvertAndCompose(const RigidTransform<T>& other) const {
+    const RotationMatrix<T>& R_AB = rotation();
+    const Vector3<T> p_BoCo_A = other.translation() - translation();
+    return RigidTransform<T>(R_AB.InvertAndCompose(other.rotation()),
+                             R_AB.matrix().transpose() * p_BoCo_A);
+  }
+
   /// Multiplies `this` %RigidTransform `X_AB` by the translation-only transform
   /// `X_BBq` and returns the %RigidTransform `X_ABq = X_AB * X_BBq`.
   /// @note The rotation matrix in the returned %RigidTransform `X_ABq` is equal
@@ -403,6 +403,21 @@ class RotationMatrix {
     return RotationMatrix<T>(matrix() * other.matrix(), true);
   }
 
+  /// Calculates the product of `this` inverted and another %RotationMatrix.
+  /// If you consider `this` to be the rotation matrix `R_AB`, and `other` to
+  /// be `R_AC`, then this method returns `R_BC = R_AB⁻¹ * R_AC`.
+  /// This is equivalent to `inverse() * other` but it exploits `R_AB⁻¹ = R_ABᵀ`
+  /// to compute the product directly from the transposed operand, without
+  /// forming (nor validating) the intermediate inverse.
+  /// @param[in] other %RotationMatrix that post-multiplies `this` inverted.
+  /// @returns rotation matrix that results from `this` inverted multiplied by
+  /// `other`.
+  /// @note It is possible (albeit improbable) to create an invalid rotation
+  /// matrix by accumulating round-off error with a large number of multiplies.
+  RotationMatrix<T> InvertAndCompose(const RotationMatrix<T>& other) const {
+    return RotationMatrix<T>(matrix().transpose() * other.matrix(), true);
+  }
+
   /// Calculates `this` rotation matrix `R_AB` multiplied by an arbitrary
   /// Vector3 expressed in the B frame.
   /// @param[in] v_B 3x1 vector that post-multiplies `this`.
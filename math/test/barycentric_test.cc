@@ -184,6 +184,48 @@ GTEST_TEST(BarycentricTest, MultidimensionalOutput) {
   EXPECT_TRUE(CompareMatrices(value, Vector2d{2.75, 6.75}, 1e-8));
 }
 
+GTEST_TEST(BarycentricTest, EvalBatch) {
+  BarycentricMesh<double> bary{{{0.0, 1.0, 3.0},  // BR
+                                {2.0},            // BR
+                                {0.0, 0.5, 1.0}}};
+
+  const int kNumOutputs = 2;
+  MatrixXd mesh(kNumOutputs, bary.get_num_mesh_points());
+  for (int i = 0; i < bary.get_num_mesh_points(); i++) {
+    mesh.col(i) = Vector2d{i, std::sqrt(i)};
+  }
+
+  // Queries inside the grid, on the grid, and outside of it.
+  MatrixXd inputs(3, 5);
+  inputs << 0.3, 1.0, 2.5, -1.0, 4.0,  // BR
+      2.0, 2.0, 1.0, 2.0, 3.0,         // BR
+      0.6, 0.5, 0.2, 0.7, 2.0;
+
+  const MatrixXd outputs = bary.EvalBatch(mesh, inputs);
+  ASSERT_EQ(outputs.rows(), kNumOutputs);
+  ASSERT_EQ(outputs.cols(), inputs.cols());
+  for (int j = 0; j < inputs.cols(); j++) {
+    EXPECT_TRUE(CompareMatrices(outputs.col(j),
+                                bary.Eval(mesh, inputs.col(j)), 1e-14));
+  }
+}
+
+GTEST_TEST(BarycentricTest, SingletonMesh) {
+  // A mesh with only singleton dimensions has a single mesh point, which is
+  // used with unit weight for every input.
+  BarycentricMesh<double> bary{{{1.0}, {2.0}}};
+  EXPECT_EQ(bary.get_num_interpolants(), 1);
+
+  Eigen::Matrix<int, 1, 1> indices;
+  Vector1d weights;
+  bary.EvalBarycentricWeights(Vector2d{3., -4.}, &indices, &weights);
+  EXPECT_EQ(indices[0], 0);
+  EXPECT_EQ(weights[0], 1.);
+
+  const MatrixXd mesh = Vector2d{5., 6.};
+  EXPECT_TRUE(CompareMatrices(bary.Eval(mesh, Vector2d{0., 0.}), mesh));
+}
+
 Vector1d my_sine(const Eigen::Ref<const Vector1d>& x) {
   return Vector1d(std::sin(x[0]));
 }
@@ -279,6 +279,33 @@ TYPED_TEST(BsplineBasisTests, EvaluateBasisFunctionIScipyComparison) {
   }
 }
 
+// Tests that EvaluateActiveBasisFunctions() matches EvaluateBasisFunctionI()
+// for the active basis functions, with knots that are repeated both at the
+// ends and in the interior.
+TYPED_TEST(BsplineBasisTests, EvaluateActiveBasisFunctions) {
+  using T = TypeParam;
+  const int order = 4;
+  const std::vector<T> knots{0, 0, 0, 0, 0.25, 0.5, 0.5, 0.75, 1, 1, 1, 1};
+  const BsplineBasis<T> basis{order, knots};
+  for (const double parameter_value : {0.0, 0.1, 0.25, 0.5, 0.6, 0.99, 1.0}) {
+    const std::vector<int> indices =
+        basis.ComputeActiveBasisFunctionIndices(parameter_value);
+    const std::vector<T> values =
+        basis.EvaluateActiveBasisFunctions(parameter_value);
+    ASSERT_EQ(values.size(), indices.size());
+    double sum = 0;
+    for (int r = 0; r < static_cast<int>(indices.size()); ++r) {
+      EXPECT_NEAR(ExtractDoubleOrThrow(values[r]),
+                  ExtractDoubleOrThrow(basis.EvaluateBasisFunctionI(
+                      indices[r], parameter_value)),
+                  1e-15);
+      sum += ExtractDoubleOrThrow(values[r]);
+    }
+    // The basis functions form a partition of unity.
+    EXPECT_NEAR(sum, 1.0, 1e-15);
+  }
+}
+
 // Tests that {initial,final}_parameter_value() behave as expected.
 TYPED_TEST(BsplineBasisTests, InitialAndFinalParameterValueTest) {
   using T = TypeParam;
@@ -60,6 +60,30 @@ GTEST_TEST(CARE, TestCare2) {
   SolveCAREandVerify(A1, B1, Q, R1);
 }
 
+GTEST_TEST(CARE, WarmStart) {
+  MatrixXd A(2, 2), B(2, 1), Q(2, 2), R(1, 1);
+  A << 0, 1, 10, 0;
+  B << 0, 1;
+  Q << 1, 0, 0, 1;
+  R << 1;
+  const MatrixXd S = ContinuousAlgebraicRiccatiEquation(A, B, Q, R);
+
+  // Warm starting from the solution for a nearby system converges to the
+  // solution for the new system.
+  MatrixXd A_new = A;
+  A_new(1, 0) = 11;
+  const MatrixXd Q_new = 2 * Q;
+  EXPECT_TRUE(CompareMatrices(
+      ContinuousAlgebraicRiccatiEquation(A_new, B, Q_new, R, S),
+      ContinuousAlgebraicRiccatiEquation(A_new, B, Q_new, R), 1E-9,
+      MatrixCompareType::relative));
+
+  // A non-stabilizing initial guess falls back to the default solver.
+  EXPECT_TRUE(CompareMatrices(
+      ContinuousAlgebraicRiccatiEquation(A, B, Q, R, MatrixXd::Zero(2, 2)), S,
+      1E-10, MatrixCompareType::absolute));
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -52,6 +52,30 @@ GTEST_TEST(DARE, SolveDAREandVerify) {
   R2 << 0.3;
   SolveDAREandVerify(A2, B2, Q2, R2);
 }
+
+GTEST_TEST(DARE, WarmStart) {
+  MatrixXd A(2, 2), B(2, 1), Q(2, 2), R(1, 1);
+  A << 1, 1, 0, 1;
+  B << 0, 1;
+  Q << 1, 0, 0, 0;
+  R << 0.3;
+  const MatrixXd X = DiscreteAlgebraicRiccatiEquation(A, B, Q, R);
+
+  // Warm starting from the solution for a nearby system converges to the
+  // solution for the new system.
+  MatrixXd A_new = A;
+  A_new(0, 1) = 1.1;
+  const MatrixXd R_new = 1.2 * R;
+  EXPECT_TRUE(CompareMatrices(
+      DiscreteAlgebraicRiccatiEquation(A_new, B, Q, R_new, X),
+      DiscreteAlgebraicRiccatiEquation(A_new, B, Q, R_new), 1E-9,
+      MatrixCompareType::relative));
+
+  // A non-stabilizing initial guess falls back to the default solver.
+  EXPECT_TRUE(CompareMatrices(
+      DiscreteAlgebraicRiccatiEquation(A, B, Q, R, MatrixXd::Zero(2, 2)), X,
+      1E-10, MatrixCompareType::absolute));
+}
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -411,6 +411,19 @@ GTEST_TEST(RigidTransform, Inverse) {
   EXPECT_TRUE(I.IsNearlyEqualTo(X_identity, 8 * kEpsilon));
 }
 
+// Tests the product of an inverted RigidTransform and another one.
+GTEST_TEST(RigidTransform, InvertAndCompose) {
+  const RigidTransform<double> X_AB = GetRigidTransformA();
+  const RigidTransform<double> X_AC = GetRigidTransformB();
+  const RigidTransform<double> X_BC = X_AB.InvertAndCompose(X_AC);
+  // As in the Inverse test, 32 * epsilon is slightly larger than the
+  // characteristic length of these transforms.
+  EXPECT_TRUE(X_BC.IsNearlyEqualTo(X_AB.inverse() * X_AC, 32 * kEpsilon));
+  EXPECT_TRUE((X_AB * X_BC).IsNearlyEqualTo(X_AC, 32 * kEpsilon));
+  EXPECT_TRUE(X_AB.InvertAndCompose(X_AB).IsNearlyEqualTo(
+      RigidTransform<double>::Identity(), 32 * kEpsilon));
+}
+
 // Tests RigidTransform multiplied by another RigidTransform
 GTEST_TEST(RigidTransform, OperatorMultiplyByRigidTransform) {
   const RigidTransform<double> X_BA = GetRigidTransformA();
@@ -335,6 +335,15 @@ GTEST_TEST(RotationMatrix, InverseAndTranspose) {
   EXPECT_TRUE(RRtranspose.IsNearlyEqualTo(I, 8 * kEpsilon));
 }
 
+GTEST_TEST(RotationMatrix, InvertAndCompose) {
+  const RotationMatrix<double> R_AB(RollPitchYaw<double>(0.2, 0.3, 0.4));
+  const RotationMatrix<double> R_AC(RollPitchYaw<double>(-0.5, -0.6, 0.9));
+  const RotationMatrix<double> R_BC = R_AB.InvertAndCompose(R_AC);
+  EXPECT_TRUE(R_BC.IsNearlyEqualTo(R_AB.inverse() * R_AC, 8 * kEpsilon));
+  EXPECT_TRUE(R_AB.InvertAndCompose(R_AB).IsNearlyEqualTo(
+      RotationMatrix<double>::Identity(), 8 * kEpsilon));
+}
+
 // Test rotation matrix multiplication and IsNearlyEqualTo.
 GTEST_TEST(RotationMatrix, OperatorMultiplyAndIsNearlyEqualTo) {
   const RollPitchYaw<double> rpy0(0.2, 0.3, 0.4);
@@ -0,0 +1,231 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/find_resource.h"
+#include "drake/math/autodiff.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::VectorXd;
+using systems::Context;
+
+/* @defgroup multibody_plant_benchmarks MultibodyPlant Benchmarks
+
+ The benchmark times the MultibodyPlant computations at the core of most
+ multibody algorithms: forward kinematics, the mass matrix, inverse dynamics,
+ the bias term, Jacobians and forward dynamics through the articulated body
+ algorithm. Each computation is timed for the scalar types double and
+ AutoDiffXd and for the models of increasing size below, selected by the
+ benchmark argument:
+
+ - __0__: the KUKA iiwa arm (7 bodies in a chain, nv = 7).
+ - __1__: the Allegro hand (a palm with four fingers, nv = 16).
+ - __2__: the Atlas humanoid (a floating base with several long branches,
+   nv = 36).
+
+ For AutoDiffXd the derivatives are taken with respect to the full state x, so
+ that the cost of the derivatives grows with the size of the model as well.
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //multibody/benchmarking:multibody_plant_benchmark
+ ```
+
+ Each line of the report names the computation, the scalar type and the model,
+ as in `MassMatrix<double>/1`. The model name and its number of
+ generalized velocities are also reported in the `label` and `nv` columns.
+ Results meant for later comparison can be saved with the standard
+ google-benchmark flags, e.g.
+ `--benchmark_out=results.json --benchmark_out_format=json`.
+
+ Before timing each computation, the state of the context is marked as changed
+ so that all of the cached kinematics it depends on are recomputed, as they
+ would be in a simulation step with a new state.
+ */
+
+struct ModelInfo {
+  const char* name;
+  const char* path;
+};
+
+const ModelInfo kModels[] = {
+    {"iiwa",
+     "drake/manipulation/models/iiwa_description/sdf/"
+     "iiwa14_no_collision.sdf"},
+    {"allegro_hand",
+     "drake/manipulation/models/allegro_hand_description/sdf/"
+     "allegro_hand_description_right.sdf"},
+    {"atlas", "drake/examples/atlas/urdf/atlas_convex_hull.urdf"},
+};
+
+// Holds one of the models above (selected by the benchmark argument) in a
+// MultibodyPlant<T>, together with a context in an arbitrary state.
+template <typename T>
+class BenchmarkModel {
+ public:
+  explicit BenchmarkModel(benchmark::State* state) {
+    const ModelInfo& model = kModels[state->range(0)];
+    auto plant_double = std::make_unique<MultibodyPlant<double>>(0.0);
+    Parser(plant_double.get())
+        .AddModelFromFile(FindResourceOrThrow(model.path));
+    plant_double->Finalize();
+
+    // The default positions (which keep the quaternions of floating bodies
+    // normalized) and arbitrary non-zero velocities.
+    const int nq = plant_double->num_positions();
+    const int nv = plant_double->num_velocities();
+    VectorXd x(nq + nv);
+    x.head(nq) =
+        plant_double->GetPositions(*plant_double->CreateDefaultContext());
+    x.tail(nv) = VectorXd::LinSpaced(nv, -1.0, 1.0);
+
+    if constexpr (std::is_same_v<T, double>) {
+      plant_ = std::move(plant_double);
+    } else {
+      plant_ = systems::System<double>::ToAutoDiffXd(*plant_double);
+    }
+    context_ = plant_->CreateDefaultContext();
+    if constexpr (std::is_same_v<T, double>) {
+      plant_->SetPositionsAndVelocities(context_.get(), x);
+    } else {
+      plant_->SetPositionsAndVelocities(context_.get(),
+                                        math::initializeAutoDiff(x));
+    }
+    if (plant_->num_actuators() > 0) {
+      plant_->get_actuation_input_port().FixValue(
+          context_.get(), VectorX<T>::Zero(plant_->num_actuators()));
+    }
+
+    state->SetLabel(model.name);
+    state->counters["nv"] = nv;
+  }
+
+  const MultibodyPlant<T>& plant() const { return *plant_; }
+  const Context<T>& context() const { return *context_; }
+  int nv() const { return plant_->num_velocities(); }
+
+  // The frame of the last body, the farthest from the world in a chain.
+  const Frame<T>& tip_frame() const {
+    return plant_->get_body(BodyIndex(plant_->num_bodies() - 1)).body_frame();
+  }
+
+  // Marks the state as changed, so that all of the cached computations that
+  // depend on it are recomputed.
+  void InvalidateState() { context_->NoteContinuousStateChange(); }
+
+ private:
+  std::unique_ptr<MultibodyPlant<T>> plant_;
+  std::unique_ptr<Context<T>> context_;
+};
+
+// Registers the benchmark `Function` for both scalar types and all models.
+#define DRAKE_MULTIBODY_BENCHMARK(Function)                   \
+  BENCHMARK_TEMPLATE(Function, double)->DenseRange(0, 2);     \
+  BENCHMARK_TEMPLATE(Function, AutoDiffXd)->DenseRange(0, 2)
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+template <typename T> void PositionKinematics(benchmark::State& state) {
+  BenchmarkModel<T> model(&state);
+  const Body<T>& tip = model.tip_frame().body();
+  for (auto _ : state) {
+    model.InvalidateState();
+    benchmark::DoNotOptimize(
+        model.plant().EvalBodyPoseInWorld(model.context(), tip));
+  }
+}
+DRAKE_MULTIBODY_BENCHMARK(PositionKinematics);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+template <typename T> void MassMatrix(benchmark::State& state) {
+  BenchmarkModel<T> model(&state);
+  MatrixX<T> M(model.nv(), model.nv());
+  for (auto _ : state) {
+    model.InvalidateState();
+    model.plant().CalcMassMatrix(model.context(), &M);
+  }
+}
+DRAKE_MULTIBODY_BENCHMARK(MassMatrix);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+template <typename T> void InverseDynamics(benchmark::State& state) {
+  BenchmarkModel<T> model(&state);
+  const VectorX<T> vdot = VectorX<T>::Zero(model.nv());
+  const MultibodyForces<T> forces(model.plant());
+  for (auto _ : state) {
+    model.InvalidateState();
+    benchmark::DoNotOptimize(
+        model.plant().CalcInverseDynamics(model.context(), vdot, forces));
+  }
+}
+DRAKE_MULTIBODY_BENCHMARK(InverseDynamics);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+template <typename T> void BiasTerm(benchmark::State& state) {
+  BenchmarkModel<T> model(&state);
+  VectorX<T> Cv(model.nv());
+  for (auto _ : state) {
+    model.InvalidateState();
+    model.plant().CalcBiasTerm(model.context(), &Cv);
+  }
+}
+DRAKE_MULTIBODY_BENCHMARK(BiasTerm);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+template <typename T> void JacobianSpatialVelocity(benchmark::State& state) {
+  BenchmarkModel<T> model(&state);
+  const Frame<T>& world_frame = model.plant().world_frame();
+  MatrixX<T> Jv_V_WB(6, model.nv());
+  for (auto _ : state) {
+    model.InvalidateState();
+    model.plant().CalcJacobianSpatialVelocity(
+        model.context(), JacobianWrtVariable::kV, model.tip_frame(),
+        Vector3<T>::Zero(), world_frame, world_frame, &Jv_V_WB);
+  }
+}
+DRAKE_MULTIBODY_BENCHMARK(JacobianSpatialVelocity);
+
+// Forward dynamics as computed for a simulation step, including the
+// evaluation of the applied forces.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+template <typename T> void ForwardDynamics(benchmark::State& state) {
+  BenchmarkModel<T> model(&state);
+  auto derivatives = model.plant().AllocateTimeDerivatives();
+  for (auto _ : state) {
+    model.InvalidateState();
+    model.plant().CalcTimeDerivatives(model.context(), derivatives.get());
+  }
+}
+DRAKE_MULTIBODY_BENCHMARK(ForwardDynamics);
+
+// The articulated body algorithm alone, for given applied forces.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+template <typename T> void ArticulatedBodyAlgorithm(benchmark::State& state) {
+  BenchmarkModel<T> model(&state);
+  MultibodyForces<T> forces(model.plant());
+  forces.mutable_generalized_forces().setConstant(1.0);
+  VectorX<T> vdot(model.nv());
+  for (auto _ : state) {
+    model.InvalidateState();
+    model.plant().CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+        model.context(), forces, &vdot);
+  }
+}
+DRAKE_MULTIBODY_BENCHMARK(ArticulatedBodyAlgorithm);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
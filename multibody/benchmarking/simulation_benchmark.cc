@@ -0,0 +1,203 @@
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/contact_results.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using geometry::HalfSpace;
+using math::RigidTransformd;
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+using systems::Simulator;
+
+/* @defgroup simulation_benchmarks Simulation Benchmarks
+
+ The benchmark times complete simulations of representative multibody
+ scenarios, including the SceneGraph queries, the contact computations and
+ the time stepping, to measure the real time factor that users would see.
+ Each iteration simulates a fixed duration of kSimulationTime seconds from the
+ same initial conditions. The first benchmark argument selects the scenario:
+
+ - __0__: the KUKA iiwa arm falling under gravity without actuation (no
+   contact).
+ - __1__: the Allegro hand falling under gravity without actuation.
+ - __2__: the Atlas humanoid dropped onto the ground, with contact.
+
+ The second benchmark argument selects the time stepping:
+
+ - __0__: a discrete MultibodyPlant with a time step of kTimeStep.
+ - __1__: a continuous MultibodyPlant integrated with the Simulator's default
+   error-controlled integrator.
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //multibody/benchmarking:simulation_benchmark
+ ```
+
+ Besides the wall clock time, each line of the report includes these
+ counters, all averaged over the iterations:
+
+ - `realtime_factor`: simulated seconds per wall clock second.
+ - `steps`: the number of discrete updates (discrete plant) or integrator
+   steps (continuous plant) per simulation.
+ - `derivative_evaluations`: the number of time derivative evaluations per
+   simulation (continuous plant only).
+ - `contacts`: the number of point contacts at the end of the simulation.
+
+ Results meant for trend tracking can be saved in JSON format with the
+ standard google-benchmark flags, e.g.
+ `--benchmark_out=results.json --benchmark_out_format=json`.
+ */
+
+constexpr double kSimulationTime = 0.1;
+constexpr double kTimeStep = 1.0e-3;
+
+struct ScenarioInfo {
+  const char* name;
+  const char* path;
+  // The height of the ground, or NaN for no ground.
+  double ground_height;
+};
+
+const ScenarioInfo kScenarios[] = {
+    {"iiwa",
+     "drake/manipulation/models/iiwa_description/sdf/"
+     "iiwa14_no_collision.sdf",
+     std::numeric_limits<double>::quiet_NaN()},
+    {"allegro_hand",
+     "drake/manipulation/models/allegro_hand_description/sdf/"
+     "allegro_hand_description_right.sdf",
+     std::numeric_limits<double>::quiet_NaN()},
+    // The ground is placed near the feet of Atlas in its default
+    // configuration, so that contact is established early in the simulation.
+    {"atlas", "drake/examples/atlas/urdf/atlas_convex_hull.urdf", -0.9},
+};
+
+// Holds the Diagram with a MultibodyPlant and a SceneGraph for one of the
+// scenarios above, together with a Simulator for it.
+class BenchmarkScenario {
+ public:
+  explicit BenchmarkScenario(benchmark::State* state) {
+    const ScenarioInfo& scenario = kScenarios[state->range(0)];
+    const bool is_discrete = state->range(1) == 0;
+    DiagramBuilder<double> builder;
+    auto items =
+        AddMultibodyPlantSceneGraph(&builder, is_discrete ? kTimeStep : 0.0);
+    plant_ = &items.plant;
+    Parser(plant_).AddModelFromFile(FindResourceOrThrow(scenario.path));
+    if (!std::isnan(scenario.ground_height)) {
+      plant_->RegisterCollisionGeometry(
+          plant_->world_body(),
+          RigidTransformd(HalfSpace::MakePose(
+              Vector3d::UnitZ(), Vector3d(0, 0, scenario.ground_height))),
+          HalfSpace(), "ground", CoulombFriction<double>(1.0, 1.0));
+    }
+    plant_->Finalize();
+    diagram_ = builder.Build();
+
+    simulator_ = std::make_unique<Simulator<double>>(*diagram_);
+    plant_context_ = &plant_->GetMyMutableContextFromRoot(
+        &simulator_->get_mutable_context());
+    if (plant_->num_actuators() > 0) {
+      plant_->get_actuation_input_port().FixValue(
+          plant_context_, VectorXd::Zero(plant_->num_actuators()));
+    }
+
+    state->SetLabel(fmt::format("{}/{}", scenario.name,
+                                is_discrete ? "discrete" : "continuous"));
+  }
+
+  // Simulates kSimulationTime seconds from the default initial conditions.
+  void Simulate() {
+    Context<double>& context = simulator_->get_mutable_context();
+    context.SetTime(0.0);
+    plant_->SetDefaultContext(plant_context_);
+    simulator_->Initialize();
+    simulator_->AdvanceTo(kSimulationTime);
+  }
+
+  // The number of discrete updates or integrator steps of the last Simulate().
+  int64_t num_steps() const {
+    return plant_->is_discrete()
+               ? simulator_->get_num_discrete_updates()
+               : simulator_->get_integrator().get_num_steps_taken();
+  }
+
+  // The number of time derivative evaluations of the last Simulate().
+  int64_t num_derivative_evaluations() const {
+    return simulator_->get_integrator().get_num_derivative_evaluations();
+  }
+
+  // The number of point contacts at the end of the last Simulate().
+  int num_contacts() const {
+    return plant_->get_contact_results_output_port()
+        .Eval<ContactResults<double>>(*plant_context_)
+        .num_point_pair_contacts();
+  }
+
+ private:
+  std::unique_ptr<Diagram<double>> diagram_;
+  MultibodyPlant<double>* plant_{};
+  std::unique_ptr<Simulator<double>> simulator_;
+  Context<double>* plant_context_{};
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+void Simulation(benchmark::State& state) {
+  BenchmarkScenario scenario(&state);
+  int64_t steps = 0;
+  int64_t derivative_evaluations = 0;
+  int contacts = 0;
+  for (auto _ : state) {
+    scenario.Simulate();
+    steps += scenario.num_steps();
+    derivative_evaluations += scenario.num_derivative_evaluations();
+    state.PauseTiming();
+    contacts += scenario.num_contacts();
+    state.ResumeTiming();
+  }
+  const double iterations = state.iterations();
+  state.counters["realtime_factor"] = benchmark::Counter(
+      kSimulationTime * iterations, benchmark::Counter::kIsRate);
+  state.counters["steps"] = steps / iterations;
+  state.counters["derivative_evaluations"] =
+      derivative_evaluations / iterations;
+  state.counters["contacts"] = contacts / iterations;
+}
+// Registers all scenarios with both discrete and continuous time stepping.
+void AllScenarios(benchmark::internal::Benchmark* benchmark) {
+  const int num_scenarios = sizeof(kScenarios) / sizeof(kScenarios[0]);
+  for (int scenario = 0; scenario < num_scenarios; ++scenario) {
+    for (int is_continuous : {0, 1}) {
+      benchmark->Args({scenario, is_continuous});
+    }
+  }
+}
+BENCHMARK(Simulation)->Apply(AllScenarios)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
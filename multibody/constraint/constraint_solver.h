@@ -97,6 +97,33 @@ class ConstraintSolver {
     /// arbitrary number of columns (denoted `m` here).
     std::function<MatrixX<T>(const MatrixX<T>&)> fast_A_solve;
   };
+
+  /// Storage that lets consecutive solves share work, e.g., the impact problem
+  /// and then the acceleration-level problem at one configuration of a rigid
+  /// contact simulation. A solve that is given a cache reuses the cached
+  /// factorization of the bilateral constraint Delassus matrix GM⁻¹Gᵀ (or
+  /// stores the one that it computes), and starts Lemke's Algorithm from the
+  /// solution of the previous LCP of the same kind when it has the same size
+  /// (falling back to a cold start if that fails).
+  struct SolveCache {
+    /// Discards the factorization of GM⁻¹Gᵀ. This must be called whenever
+    /// the bilateral constraint Jacobian G or the generalized inertia matrix M
+    /// changes (e.g., at each new configuration). The LCP solutions are kept,
+    /// since they are only used as starting points.
+    void InvalidateFactorization() { has_delassus_factorization = false; }
+
+    /// Whether `delassus_QTZ` holds the factorization to reuse.
+    bool has_delassus_factorization{false};
+
+    /// Decomposition of the Delassus matrix GM⁻¹Gᵀ.
+    Eigen::CompleteOrthogonalDecomposition<MatrixX<T>> delassus_QTZ;
+
+    /// The solution of the last impact problem LCP.
+    VectorX<T> impact_lcp_solution;
+
+    /// The solution of the last acceleration-level LCP.
+    VectorX<T> accel_lcp_solution;
+  };
   // TODO(edrumwri): Describe conditions under which it is safe to replace
   // A⁻¹ by a pseudo-inverse.
   // TODO(edrumwri): Constraint solver needs to use monogram notation throughout
@@ -345,9 +372,12 @@ class ConstraintSolver {
   ///         (due to, e.g., the effects of roundoff error in attempting to
   ///         solve a complementarity problem); in such cases, it is
   ///         recommended to increase regularization and attempt again.
+  /// @param cache If non-null, the factorizations and warm starts shared with
+  ///           other solves at the same configuration; see SolveCache.
   /// @throws std::logic_error if `cf` is null.
   void SolveImpactProblem(const ConstraintVelProblemData<T>& problem_data,
-                          VectorX<T>* cf) const;
+                          VectorX<T>* cf,
+                          SolveCache* cache = nullptr) const;
 
   /// Populates the packed constraint force vector from the solution to the
   /// linear complementarity problem (LCP) constructed using
@@ -404,9 +434,12 @@ class ConstraintSolver {
   /// @pre Constraint data has been computed.
   /// @throws std::runtime_error if the constraint forces cannot be computed
   ///         (due to, e.g., an "inconsistent" rigid contact configuration).
+  /// @param cache If non-null, the factorizations and warm starts shared with
+  ///           other solves at the same configuration; see SolveCache.
   /// @throws std::logic_error if `cf` is null.
   void SolveConstraintProblem(const ConstraintAccelProblemData<T>& problem_data,
-                              VectorX<T>* cf) const;
+                              VectorX<T>* cf,
+                              SolveCache* cache = nullptr) const;
 
   /// Computes the generalized force on the system from the constraint forces
   /// given in packed storage.
@@ -589,11 +622,13 @@ class ConstraintSolver {
       VectorX<T>* cf);
   static void ConstructLinearEquationSolversForMlcp(
       const ConstraintVelProblemData<T>& problem_data,
-      MlcpToLcpData* mlcp_to_lcp_data);
+      MlcpToLcpData* mlcp_to_lcp_data,
+      SolveCache* cache = nullptr);
   void FormAndSolveConstraintLcp(
       const ConstraintAccelProblemData<T>& problem_data,
       const VectorX<T>& trunc_neg_invA_a,
-      VectorX<T>* cf) const;
+      VectorX<T>* cf,
+      SolveCache* cache) const;
   void FormAndSolveConstraintLinearSystem(
       const ConstraintAccelProblemData<T>& problem_data,
       const VectorX<T>& trunc_neg_invA_a,
@@ -638,6 +673,23 @@ class ConstraintSolver {
       const VectorX<T>& invA_a,
       MatrixX<T>* MM, VectorX<T>* qq);
 
+  // Sets `delassus_QTZ` to the factorization of the Delassus matrix GM⁻¹Gᵀ of
+  // the bilateral constraints, reusing the one in `cache` if it has one (and
+  // storing it there otherwise).
+  template <typename ProblemData>
+  static void FactorDelassusMatrix(
+      const ProblemData& problem_data,
+      int num_generalized_velocities,
+      SolveCache* cache,
+      Eigen::CompleteOrthogonalDecomposition<MatrixX<T>>* delassus_QTZ);
+
+  // Solves the LCP (MM, qq) with Lemke's Algorithm. When `warm_start` has the
+  // size of qq, the solve starts from it, and is repeated from scratch if it
+  // fails.
+  bool SolveLcpLemkeWithWarmStart(const MatrixX<T>& MM, const VectorX<T>& qq,
+                                  const VectorX<T>& warm_start,
+                                  const T& zero_tol, VectorX<T>* zz) const;
+
   template <typename ProblemData>
   static void DetermineNewPartialInertiaSolveOperator(
     const ProblemData* problem_data,
@@ -678,6 +730,54 @@ class ConstraintSolver {
 //               where G is the constraint Jacobian corresponding to the
 //               independent constraints.
 // @param[out] A_solve The operator for solving AX = B, on return.
+template <typename T>
+template <typename ProblemData>
+void ConstraintSolver<T>::FactorDelassusMatrix(
+    const ProblemData& problem_data,
+    int num_generalized_velocities,
+    SolveCache* cache,
+    Eigen::CompleteOrthogonalDecomposition<MatrixX<T>>* delassus_QTZ) {
+  DRAKE_DEMAND(delassus_QTZ);
+  const int num_eq_constraints = problem_data.kG.size();
+  if (cache != nullptr && cache->has_delassus_factorization &&
+      cache->delassus_QTZ.rows() == num_eq_constraints) {
+    *delassus_QTZ = cache->delassus_QTZ;
+    return;
+  }
+
+  // Form the Delassus matrix for the bilateral constraints.
+  MatrixX<T> Del(num_eq_constraints, num_eq_constraints);
+  MatrixX<T> iM_GT(num_generalized_velocities, num_eq_constraints);
+  ComputeInverseInertiaTimesGT(problem_data.solve_inertia,
+                               problem_data.G_transpose_mult,
+                               num_eq_constraints, &iM_GT);
+  ComputeConstraintSpaceComplianceMatrix(problem_data.G_mult,
+                                         num_eq_constraints,
+                                         iM_GT, Del);
+
+  // Compute the complete orthogonal factorization.
+  delassus_QTZ->compute(Del);
+  if (cache != nullptr) {
+    cache->delassus_QTZ = *delassus_QTZ;
+    cache->has_delassus_factorization = true;
+  }
+}
+
+template <typename T>
+bool ConstraintSolver<T>::SolveLcpLemkeWithWarmStart(
+    const MatrixX<T>& MM, const VectorX<T>& qq, const VectorX<T>& warm_start,
+    const T& zero_tol, VectorX<T>* zz) const {
+  DRAKE_DEMAND(zz);
+  if (warm_start.size() == qq.size() && qq.size() > 0) {
+    *zz = warm_start;
+    if (lcp_.SolveLcpLemke(MM, qq, zz, -1, zero_tol))
+      return true;
+    DRAKE_LOGGER_DEBUG("Warm-started LCP solve failed; starting over.");
+  }
+  zz->resize(0);
+  return lcp_.SolveLcpLemke(MM, qq, zz, -1, zero_tol);
+}
+
 template <typename T>
 template <typename ProblemData>
 void ConstraintSolver<T>::DetermineNewPartialInertiaSolveOperator(
@@ -940,7 +1040,8 @@ template <typename T>
 void ConstraintSolver<T>::FormAndSolveConstraintLcp(
     const ConstraintAccelProblemData<T>& problem_data,
     const VectorX<T>& trunc_neg_invA_a,
-    VectorX<T>* cf) const {
+    VectorX<T>* cf,
+    SolveCache* cache) const {
   using std::max;
   using std::abs;
 
@@ -1048,7 +1149,9 @@ void ConstraintSolver<T>::FormAndSolveConstraintLcp(
 
   // Solve the LCP and compute the values of the slack variables.
   VectorX<T> zz;
-  bool success = lcp_.SolveLcpLemke(MM, qq, &zz, -1, zero_tol);
+  bool success = SolveLcpLemkeWithWarmStart(
+      MM, qq, cache != nullptr ? cache->accel_lcp_solution : VectorX<T>(),
+      zero_tol, &zz);
   VectorX<T> ww = MM * zz + qq;
   const double max_dot = (zz.size() > 0) ?
                          (zz.array() * ww.array()).abs().maxCoeff() : 0.0;
@@ -1069,6 +1172,7 @@ void ConstraintSolver<T>::FormAndSolveConstraintLcp(
           npivots * zero_tol))) {
     throw std::runtime_error("Unable to solve LCP- it may be unsolvable.");
   }
+  if (cache != nullptr) cache->accel_lcp_solution = zz;
 
   // Alias constraint force segments.
   const auto fN = zz.segment(0, num_contacts);
@@ -1086,7 +1190,8 @@ void ConstraintSolver<T>::FormAndSolveConstraintLcp(
 template <typename T>
 void ConstraintSolver<T>::SolveConstraintProblem(
     const ConstraintAccelProblemData<T>& problem_data,
-    VectorX<T>* cf) const {
+    VectorX<T>* cf,
+    SolveCache* cache) const {
   using std::max;
   using std::abs;
 
@@ -1138,18 +1243,9 @@ void ConstraintSolver<T>::SolveConstraintProblem(
   MlcpToLcpData mlcp_to_lcp_data;
 
   if (num_eq_constraints > 0) {
-    // Form the Delassus matrix for the bilateral constraints.
-    MatrixX<T> Del(num_eq_constraints, num_eq_constraints);
-    MatrixX<T> iM_GT(num_generalized_velocities, num_eq_constraints);
-    ComputeInverseInertiaTimesGT(problem_data.solve_inertia,
-                                 problem_data.G_transpose_mult,
-                                 num_eq_constraints, &iM_GT);
-    ComputeConstraintSpaceComplianceMatrix(problem_data.G_mult,
-                                           num_eq_constraints,
-                                           iM_GT, Del);
-
-    // Compute the complete orthogonal factorization.
-    mlcp_to_lcp_data.delassus_QTZ.compute(Del);
+    // Factor the Delassus matrix for the bilateral constraints.
+    FactorDelassusMatrix(problem_data, num_generalized_velocities, cache,
+                         &mlcp_to_lcp_data.delassus_QTZ);
 
     // Determine a new "inertia" solve operator, which solves AX = B, where
     // A = | M  -Gᵀ |
@@ -1188,7 +1284,7 @@ void ConstraintSolver<T>::SolveConstraintProblem(
 
   // Determine which problem formulation to use.
   if (problem_data.use_complementarity_problem_solver) {
-    FormAndSolveConstraintLcp(problem_data, trunc_neg_invA_a, cf);
+    FormAndSolveConstraintLcp(problem_data, trunc_neg_invA_a, cf, cache);
   } else {
     FormAndSolveConstraintLinearSystem(problem_data, trunc_neg_invA_a, cf);
   }
@@ -1228,7 +1324,8 @@ void ConstraintSolver<T>::SolveConstraintProblem(
 template <typename T>
 void ConstraintSolver<T>::SolveImpactProblem(
     const ConstraintVelProblemData<T>& problem_data,
-    VectorX<T>* cf) const {
+    VectorX<T>* cf,
+    SolveCache* cache) const {
   using std::max;
   using std::abs;
 
@@ -1280,7 +1377,8 @@ void ConstraintSolver<T>::SolveImpactProblem(
   // linear complementarity problem. See
   // ConstructLinearEquationSolversForMlcp() for more information.
   MlcpToLcpData mlcp_to_lcp_data;
-  ConstructLinearEquationSolversForMlcp(problem_data, &mlcp_to_lcp_data);
+  ConstructLinearEquationSolversForMlcp(problem_data, &mlcp_to_lcp_data,
+                                        cache);
 
   // Copy the problem data and then update it to account for bilateral
   // constraints.
@@ -1309,7 +1407,9 @@ void ConstraintSolver<T>::SolveImpactProblem(
 
   // Solve the LCP and compute the values of the slack variables.
   VectorX<T> zz;
-  bool success = lcp_.SolveLcpLemke(MM, qq, &zz, -1, zero_tol);
+  bool success = SolveLcpLemkeWithWarmStart(
+      MM, qq, cache != nullptr ? cache->impact_lcp_solution : VectorX<T>(),
+      zero_tol, &zz);
   VectorX<T> ww = MM * zz + qq;
   const T max_dot = (zz.size() > 0) ?
                          (zz.array() * ww.array()).abs().maxCoeff() : 0.0;
@@ -1354,6 +1454,8 @@ void ConstraintSolver<T>::SolveImpactProblem(
     }
   }
 
+  if (cache != nullptr) cache->impact_lcp_solution = zz;
+
   // Construct the packed force vector.
   PopulatePackedConstraintForcesFromLcpSolution(
       problem_data, mlcp_to_lcp_data, zz, a, cf);
@@ -1362,7 +1464,8 @@ void ConstraintSolver<T>::SolveImpactProblem(
 template <typename T>
 void ConstraintSolver<T>::ConstructLinearEquationSolversForMlcp(
     const ConstraintVelProblemData<T>& problem_data,
-    MlcpToLcpData* mlcp_to_lcp_data) {
+    MlcpToLcpData* mlcp_to_lcp_data,
+    SolveCache* cache) {
   // --------------------------------------------------------------------------
   // Using the LCP solution to solve the MLCP.
   // --------------------------------------------------------------------------
@@ -1379,21 +1482,12 @@ void ConstraintSolver<T>::ConstructLinearEquationSolversForMlcp(
   // If there are no bilateral constraints, A_solve and fast_A_solve will
   // simply point to the inertia solve operator.
 
-  // Form the Delassus matrix for the bilateral constraints.
+  // Factor the Delassus matrix for the bilateral constraints.
   const int num_generalized_velocities = problem_data.Mv.size();
   const int num_eq_constraints = problem_data.kG.size();
   if (num_eq_constraints > 0) {
-    MatrixX<T> Del(num_eq_constraints, num_eq_constraints);
-    MatrixX<T> iM_GT(num_generalized_velocities, num_eq_constraints);
-    ComputeInverseInertiaTimesGT(problem_data.solve_inertia,
-                                 problem_data.G_transpose_mult,
-                                 num_eq_constraints, &iM_GT);
-    ComputeConstraintSpaceComplianceMatrix(problem_data.G_mult,
-                                           num_eq_constraints,
-                                           iM_GT, Del);
-
-    // Compute the complete orthogonal factorization.
-    mlcp_to_lcp_data->delassus_QTZ.compute(Del);
+    FactorDelassusMatrix(problem_data, num_generalized_velocities, cache,
+                         &mlcp_to_lcp_data->delassus_QTZ);
 
     // Determine a new "inertia" solve operator, which solves AX = B, where
     // A = | M  -Gᵀ |
@@ -1708,19 +1802,26 @@ void ConstraintSolver<T>::ComputeInverseInertiaTimesGT(
   DRAKE_DEMAND(iM_GT->cols() == m);
 
   VectorX<T> basis(m);  // Basis vector.
-  VectorX<T> gT;        // Intermediate result vector.
+  MatrixX<T> GT;        // Intermediate result matrix.
 
   // Look for fast exit.
   if (m == 0)
     return;
 
   for (int i = 0; i < m; ++i) {
-    // Get the i'th column of G.
+    // Get the i'th column of Gᵀ.
     basis.setZero();
     basis[i] = 1;
-    gT = G_transpose_mult(basis);
-    iM_GT->col(i) = M_inv_mult(gT);
+    const VectorX<T> gT = G_transpose_mult(basis);
+    if (i == 0)
+      GT.resize(gT.size(), m);
+    GT.col(i) = gT;
   }
+
+  // Apply M⁻¹ to all of the columns at once, so that the inertia solve
+  // operator can process them together (e.g., with a single pass over a
+  // factorization of M).
+  *iM_GT = M_inv_mult(GT);
 }
 
 // Checks the validity of the constraint matrix. This operation is relatively
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/examples/rod2d/rod2d.h"
 #include "drake/solvers/unrevised_lemke_solver.h"
 
@@ -2852,6 +2853,79 @@ TEST_F(Constraint2DSolverTest, BilateralOnly) {
               eps_ * cf.size());
 }
 
+// Tests that solves sharing a cache reuse its factorization and warm starts,
+// and give the same constraint forces as solves without a cache.
+TEST_F(Constraint2DSolverTest, SolveCache) {
+  SetRodToSlidingImpactingVerticalConfig(kSlideRight);
+  rod_->set_mu_coulomb(0.1);
+  CalcConstraintProblemDataForImpact(vel_data_.get());
+
+  // Add a bilateral constraint on the angular velocity.
+  vel_data_->kG.setZero(1);
+  vel_data_->G_mult = [](const VectorX<double>& w) -> VectorX<double> {
+    VectorX<double> result(1);
+    result[0] = w[2];
+    return result;
+  };
+  vel_data_->G_transpose_mult =
+      [this](const VectorX<double>& f) -> VectorX<double> {
+    VectorX<double> result = VectorX<double>::Zero(get_rod_num_coordinates());
+    result[2] = f[0];
+    return result;
+  };
+
+  VectorX<double> cf_expected;
+  solver_.SolveImpactProblem(*vel_data_, &cf_expected);
+
+  ConstraintSolver<double>::SolveCache cache;
+  VectorX<double> cf;
+  solver_.SolveImpactProblem(*vel_data_, &cf, &cache);
+  EXPECT_TRUE(cache.has_delassus_factorization);
+  EXPECT_EQ(cache.delassus_QTZ.rows(), 1);
+  EXPECT_GT(cache.impact_lcp_solution.size(), 0);
+  EXPECT_TRUE(CompareMatrices(cf, cf_expected, eps_));
+
+  // The second solve reuses the factorization and starts from the previous
+  // solution.
+  solver_.SolveImpactProblem(*vel_data_, &cf, &cache);
+  EXPECT_TRUE(CompareMatrices(cf, cf_expected, eps_));
+
+  // A factorization that has been invalidated is recomputed.
+  vel_data_->G_mult = [](const VectorX<double>& w) -> VectorX<double> {
+    VectorX<double> result(1);
+    result[0] = 2 * w[2];
+    return result;
+  };
+  vel_data_->G_transpose_mult =
+      [this](const VectorX<double>& f) -> VectorX<double> {
+    VectorX<double> result = VectorX<double>::Zero(get_rod_num_coordinates());
+    result[2] = 2 * f[0];
+    return result;
+  };
+  solver_.SolveImpactProblem(*vel_data_, &cf_expected);
+  cache.InvalidateFactorization();
+  EXPECT_FALSE(cache.has_delassus_factorization);
+  solver_.SolveImpactProblem(*vel_data_, &cf, &cache);
+  EXPECT_TRUE(CompareMatrices(cf, cf_expected, eps_));
+
+  // The acceleration-level problem keeps its own warm start.
+  rod_->set_mu_coulomb(0.0);
+  rod_->set_mu_static(15.0);
+  SetRodToRestingHorizontalConfig();
+  CalcConstraintAccelProblemData(accel_data_.get());
+  accel_data_->use_complementarity_problem_solver = true;
+  accel_data_->tau[0] += 100;
+  VectorX<double> cf_accel_expected, cf_accel;
+  solver_.SolveConstraintProblem(*accel_data_, &cf_accel_expected);
+  ConstraintSolver<double>::SolveCache accel_cache;
+  for (int i = 0; i < 2; ++i) {
+    solver_.SolveConstraintProblem(*accel_data_, &cf_accel, &accel_cache);
+    EXPECT_TRUE(CompareMatrices(cf_accel, cf_accel_expected, eps_));
+  }
+  EXPECT_GT(accel_cache.accel_lcp_solution.size(), 0);
+  EXPECT_EQ(accel_cache.impact_lcp_solution.size(), 0);
+}
+
 }  // namespace
 }  // namespace constraint
 }  // namespace multibody
@@ -0,0 +1,116 @@
+#include "drake/multibody/contact_solvers/delassus_operator.h"
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+template <typename T>
+DelassusOperator<T>::DelassusOperator(const std::string& name,
+                                      const LinearOperator<T>* Jc,
+                                      const LinearOperator<T>* Ainv)
+    : LinearOperator<T>(name), Jc_(Jc), Ainv_(Ainv) {
+  DRAKE_DEMAND(Jc != nullptr);
+  DRAKE_DEMAND(Ainv != nullptr);
+  DRAKE_DEMAND(Ainv->rows() == Ainv->cols());
+  DRAKE_DEMAND(Jc->cols() == Ainv->rows());
+  DRAKE_DEMAND(Jc->rows() % 3 == 0);
+  JcT_x_.resize(Ainv->rows());
+  Ainv_JcT_x_.resize(Ainv->rows());
+}
+
+template <typename T>
+void DelassusOperator<T>::CalcDiagonalBlocks(
+    std::vector<Matrix3<T>>* W_blocks) const {
+  DRAKE_DEMAND(W_blocks != nullptr);
+  const int nc = num_contacts();
+  const int nv = Ainv_->rows();
+  W_blocks->resize(nc);
+
+  Eigen::SparseVector<T> ej(rows());
+  // N.B. ej.makeCompressed() is not available for SparseVector.
+  ej.coeffRef(0) = 1.0;  // Effectively allocate one non-zero entry.
+  Eigen::SparseVector<T> JcT_ej(nv);
+  Eigen::SparseVector<T> Ainv_JcT_ej(nv);
+  Eigen::SparseVector<T> W_ej(rows());
+  for (int i = 0; i < nc; ++i) {
+    Matrix3<T>& Wii = (*W_blocks)[i];
+    Wii.setZero();
+    for (int k = 0; k < 3; ++k) {
+      // By changing the inner index, we change what entry is the non-zero with
+      // value 1.0.
+      *ej.innerIndexPtr() = 3 * i + k;
+      Jc_->MultiplyByTranspose(ej, &JcT_ej);
+      Ainv_->Multiply(JcT_ej, &Ainv_JcT_ej);
+      Jc_->Multiply(Ainv_JcT_ej, &W_ej);
+      // Only the three rows for the i-th contact are kept.
+      for (typename Eigen::SparseVector<T>::InnerIterator it(W_ej); it; ++it) {
+        const int r = it.index() - 3 * i;
+        if (0 <= r && r < 3) Wii(r, k) = it.value();
+      }
+    }
+  }
+}
+
+template <typename T>
+void DelassusOperator<T>::DoMultiply(
+    const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+    Eigen::SparseVector<T>* y) const {
+  const int nv = Ainv_->rows();
+  Eigen::SparseVector<T> JcT_x(nv);
+  Eigen::SparseVector<T> Ainv_JcT_x(nv);
+  Jc_->MultiplyByTranspose(x, &JcT_x);
+  Ainv_->Multiply(JcT_x, &Ainv_JcT_x);
+  Jc_->Multiply(Ainv_JcT_x, y);
+}
+
+template <typename T>
+void DelassusOperator<T>::DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                                     VectorX<T>* y) const {
+  Jc_->MultiplyByTranspose(x, &JcT_x_);
+  Ainv_->Multiply(JcT_x_, &Ainv_JcT_x_);
+  Jc_->Multiply(Ainv_JcT_x_, y);
+}
+
+template <typename T>
+void DelassusOperator<T>::DoMultiplyByTranspose(
+    const Eigen::SparseVector<T>& x, Eigen::SparseVector<T>* y) const {
+  // W is symmetric.
+  DoMultiply(x, y);
+}
+
+template <typename T>
+void DelassusOperator<T>::DoMultiplyByTranspose(const VectorX<T>& x,
+                                                VectorX<T>* y) const {
+  // W is symmetric.
+  DoMultiply(x, y);
+}
+
+template <typename T>
+void DelassusOperator<T>::DoAssembleMatrix(Eigen::SparseMatrix<T>* A) const {
+  const int n = rows();
+  const int nv = Ainv_->rows();
+  Eigen::SparseVector<T> ej(n);
+  ej.coeffRef(0) = 1.0;
+  Eigen::SparseVector<T> JcT_ej(nv);
+  Eigen::SparseVector<T> Ainv_JcT_ej(nv);
+  Eigen::SparseVector<T> W_ej(n);
+  for (int j = 0; j < n; ++j) {
+    *ej.innerIndexPtr() = j;
+    Jc_->MultiplyByTranspose(ej, &JcT_ej);
+    Ainv_->Multiply(JcT_ej, &Ainv_JcT_ej);
+    Jc_->Multiply(Ainv_JcT_ej, &W_ej);
+    A->col(j) = W_ej;
+  }
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::DelassusOperator)
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/contact_solvers/linear_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+/// A LinearOperator for the Delassus operator W = Jc⋅A⁻¹⋅Jcᵀ that never forms
+/// W nor A⁻¹. The product W⋅x is computed as the sequence of products
+/// Jcᵀ⋅x, A⁻¹⋅(Jcᵀ⋅x) and Jc⋅(A⁻¹⋅Jcᵀ⋅x), with the operators provided at
+/// construction. Therefore, its cost is that of applying Jc twice plus that
+/// of applying A⁻¹ once. For a MultibodyPlant, A⁻¹ = M⁻¹ is applied with a
+/// factorization that exploits the tree topology of the model, and Jc is
+/// sparse, leading to a cost that scales linearly with the number of contacts
+/// and (for bounded tree depth) with the number of generalized velocities.
+///
+/// Since A is symmetric, so is W and MultiplyByTranspose() is the same as
+/// Multiply().
+///
+/// In addition, CalcDiagonalBlocks() computes the 3x3 diagonal blocks Wᵢᵢ for
+/// each contact point, of use as a cheap block-diagonal approximation of W
+/// (e.g. as a preconditioner or as the scaling in projected iterative methods)
+/// without forming the off-diagonal blocks.
+///
+/// @tparam_nonsymbolic_scalar
+template <typename T>
+class DelassusOperator final : public LinearOperator<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DelassusOperator)
+
+  /// Constructs the Delassus operator with the given `name` for the contact
+  /// Jacobian `Jc`, of size 3nc x nv, and the inverse of the dynamics matrix
+  /// `Ainv`, of size nv x nv. See ContactSolver for details.
+  /// This class keeps references to `Jc` and `Ainv` and therefore it is
+  /// required that they outlive this object.
+  /// @pre Jc and Ainv are not nullptr.
+  /// @pre Jc->cols() == Ainv->rows() == Ainv->cols() and Jc->rows() is a
+  /// multiple of 3.
+  /// @pre Jc implements MultiplyByTranspose().
+  DelassusOperator(const std::string& name, const LinearOperator<T>* Jc,
+                   const LinearOperator<T>* Ainv);
+
+  ~DelassusOperator() = default;
+
+  int rows() const final { return Jc_->rows(); }
+  int cols() const final { return Jc_->rows(); }
+
+  /// Returns the number of contacts nc.
+  int num_contacts() const { return Jc_->rows() / 3; }
+
+  /// Computes the 3x3 diagonal block Wᵢᵢ = Jcᵢ⋅A⁻¹⋅Jcᵢᵀ for each contact,
+  /// with Jcᵢ the three rows of Jc for the i-th contact. This costs three
+  /// applications of W per contact.
+  /// @pre W_blocks is not nullptr.
+  void CalcDiagonalBlocks(std::vector<Matrix3<T>>* W_blocks) const;
+
+ private:
+  void DoMultiply(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+                  Eigen::SparseVector<T>* y) const final;
+  void DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                  VectorX<T>* y) const final;
+  void DoMultiplyByTranspose(const Eigen::SparseVector<T>& x,
+                             Eigen::SparseVector<T>* y) const final;
+  void DoMultiplyByTranspose(const VectorX<T>& x, VectorX<T>* y) const final;
+  void DoAssembleMatrix(Eigen::SparseMatrix<T>* A) const final;
+
+  const LinearOperator<T>* Jc_{nullptr};
+  const LinearOperator<T>* Ainv_{nullptr};
+  // Workspace for dense products, of size nv.
+  mutable VectorX<T> JcT_x_;
+  mutable VectorX<T> Ainv_JcT_x_;
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::DelassusOperator)
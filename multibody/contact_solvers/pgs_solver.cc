@@ -0,0 +1,150 @@
+#include "drake/multibody/contact_solvers/pgs_solver.h"
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/extract_double.h"
+#include "drake/multibody/contact_solvers/contact_solver_utils.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+template <typename T>
+ContactSolverStatus PgsSolver<T>::SolveWithGuess(
+    const T& time_step, const SystemDynamicsData<T>& dynamics_data,
+    const PointContactData<T>& contact_data, const VectorX<T>&,
+    ContactSolverResults<T>* results) {
+  DRAKE_DEMAND(results != nullptr);
+  const int nv = dynamics_data.num_velocities();
+  const int nc = contact_data.num_contacts();
+  const int nc3 = 3 * nc;
+
+  // Aliases to problem data.
+  const LinearOperator<T>& Ainv = dynamics_data.get_Ainv();
+  const VectorX<T>& v_star = dynamics_data.get_v_star();
+  const LinearOperator<T>& Jc = contact_data.get_Jc();
+  const VectorX<T>& mu = contact_data.get_mu();
+
+  stats_ = PgsSolverIterationStats{};
+  results->Resize(nv, nc);
+  if (nc == 0) {
+    gamma_.resize(0);
+    results->v_next = v_star;
+    results->tau_contact.setZero();
+    return ContactSolverStatus::kSuccess;
+  }
+
+  // Warm start with the impulses from the previous solve, if any.
+  if (gamma_.size() != nc3) gamma_ = VectorX<T>::Zero(nc3);
+
+  W_.resize(nc3, nc3);
+  ContactSolver<T>::FormDelassusOperatorMatrix(Jc, Ainv, Jc, &W_);
+  W_.makeCompressed();
+
+  // Inverse of the isotropic approximation of each diagonal block of W.
+  // Contacts with a zero diagonal block do not involve any degrees of freedom
+  // and their impulses are left at zero.
+  VectorX<T> Dinv(nc);
+  for (int i = 0; i < nc; ++i) {
+    const int i3 = 3 * i;
+    const T d = (W_.coeff(i3, i3) + W_.coeff(i3 + 1, i3 + 1) +
+                 W_.coeff(i3 + 2, i3 + 2)) / 3.0;
+    Dinv(i) = d > 0 ? T(1.0 / d) : T(0.0);
+    if (Dinv(i) == 0) gamma_.template segment<3>(i3).setZero();
+  }
+
+  // Contact velocities for the initial guess, vc = W⋅γ + vc*.
+  vc_.resize(nc3);
+  Jc.Multiply(v_star, &vc_);
+  vc_ += W_ * gamma_;
+
+  const double omega = parameters_.relaxation;
+  VectorX<T> vc_previous(nc3);
+  VectorX<T> gamma_previous(nc3);
+  bool converged = false;
+  for (int k = 0; k < parameters_.max_iterations && !converged; ++k) {
+    vc_previous = vc_;
+    gamma_previous = gamma_;
+    for (int i = 0; i < nc; ++i) {
+      if (Dinv(i) == 0) continue;
+      const int i3 = 3 * i;
+      const Vector3<T> gamma_i = gamma_.template segment<3>(i3);
+      Vector3<T> gamma_i_next =
+          gamma_i - omega * Dinv(i) * vc_.template segment<3>(i3);
+      ProjectImpulse(mu(i), gamma_i_next);
+      const Vector3<T> delta_gamma_i = gamma_i_next - gamma_i;
+      gamma_.template segment<3>(i3) = gamma_i_next;
+      // Update the contact velocities, vc += W.col(j)⋅Δγⱼ, only visiting the
+      // non-zeros of the three columns of the i-th contact.
+      for (int j = 0; j < 3; ++j) {
+        if (delta_gamma_i(j) == 0) continue;
+        using InnerIterator = typename Eigen::SparseMatrix<T>::InnerIterator;
+        for (InnerIterator it(W_, i3 + j); it; ++it) {
+          vc_(it.row()) += it.value() * delta_gamma_i(j);
+        }
+      }
+    }
+
+    stats_.iterations = k + 1;
+    stats_.vc_error = ExtractDoubleOrThrow((vc_ - vc_previous).norm());
+    stats_.gamma_error =
+        ExtractDoubleOrThrow((gamma_ - gamma_previous).norm());
+    const double vc_tolerance =
+        parameters_.abs_tolerance +
+        parameters_.rel_tolerance * ExtractDoubleOrThrow(vc_.norm());
+    const double gamma_tolerance =
+        parameters_.abs_tolerance +
+        parameters_.rel_tolerance * ExtractDoubleOrThrow(gamma_.norm());
+    converged = stats_.vc_error <= vc_tolerance &&
+                stats_.gamma_error <= gamma_tolerance;
+  }
+
+  // Generalized velocities, v = v* + A⁻¹⋅Jcᵀ⋅γ.
+  tau_c_.resize(nv);
+  dv_.resize(nv);
+  Jc.MultiplyByTranspose(gamma_, &tau_c_);
+  Ainv.Multiply(tau_c_, &dv_);
+
+  // Pack solution as ContactSolverResults.
+  // N.B. While the solver works with impulses, results are reported as
+  // forces.
+  results->v_next = v_star + dv_;
+  ExtractNormal(vc_, &results->vn);
+  ExtractTangent(vc_, &results->vt);
+  ExtractNormal(gamma_, &results->fn);
+  ExtractTangent(gamma_, &results->ft);
+  results->fn /= time_step;
+  results->ft /= time_step;
+  results->tau_contact = tau_c_ / time_step;
+
+  return converged ? ContactSolverStatus::kSuccess
+                   : ContactSolverStatus::kFailure;
+}
+
+template <typename T>
+void PgsSolver<T>::ProjectImpulse(const T& mu, Eigen::Ref<Vector3<T>> gamma) {
+  const T& gn = gamma(2);
+  const T gt_norm = gamma.template head<2>().norm();
+  if (gt_norm <= mu * gn) {
+    // Inside the friction cone.
+    return;
+  }
+  if (mu * gt_norm <= -gn) {
+    // Inside the polar cone, the projection is the apex.
+    gamma.setZero();
+    return;
+  }
+  // Project onto the boundary of the cone, ‖γt‖ = μ⋅γn. Notice that
+  // gt_norm > 0 since otherwise one of the two previous conditions holds.
+  const T gn_projected = (mu * gt_norm + gn) / (1.0 + mu * mu);
+  gamma.template head<2>() *= mu * gn_projected / gt_norm;
+  gamma(2) = gn_projected;
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::PgsSolver)
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/contact_solvers/contact_solver.h"
+#include "drake/multibody/contact_solvers/contact_solver_results.h"
+#include "drake/multibody/contact_solvers/point_contact_data.h"
+#include "drake/multibody/contact_solvers/system_dynamics_data.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+// Parameters that control the iterations of PgsSolver.
+struct PgsSolverParameters {
+  // Over-relaxation factor ω, in (0, 2). Values larger than one can speed up
+  // convergence, values smaller than one can help stabilize it.
+  double relaxation{1.0};
+  // Absolute contact velocity tolerance, in m/s. It is also used as an
+  // absolute impulse tolerance, in N⋅s.
+  double abs_tolerance{1.0e-6};
+  // Relative tolerance, dimensionless.
+  double rel_tolerance{1.0e-4};
+  // Maximum number of Gauss-Seidel sweeps over all contacts.
+  int max_iterations{100};
+};
+
+// Statistics of the last call to PgsSolver::SolveWithGuess().
+struct PgsSolverIterationStats {
+  // Number of Gauss-Seidel sweeps performed.
+  int iterations{0};
+  // Norm of the change in contact velocities in the last sweep.
+  double vc_error{0.0};
+  // Norm of the change in contact impulses in the last sweep.
+  double gamma_error{0.0};
+};
+
+// A block projected Gauss-Seidel (PGS) contact solver.
+//
+// Using the notation in ContactSolver's documentation, PgsSolver solves for
+// the contact impulses γ of the velocity level problem: <pre>
+//   vc = W⋅γ + vc*
+//   γᵢ ∈ Fᵢ
+// </pre>
+// where `W = Jc⋅A⁻¹⋅Jcᵀ` is the Delassus operator, vc* = Jc⋅v* are the
+// contact velocities in the absence of contact and Fᵢ = {γᵢ | ‖γtᵢ‖ ≤ μᵢγnᵢ}
+// is the friction cone of the i-th contact. The velocity v is then recovered
+// as v = v* + A⁻¹⋅Jcᵀ⋅γ. W is formed once per solve, as a sparse matrix, with
+// ContactSolver::FormDelassusOperatorMatrix(). Since two contacts only couple
+// when they share a body (or a kinematic path to the world), W is typically
+// very sparse for large piles of objects.
+//
+// Each sweep visits the contacts in order and, for the i-th contact, computes
+// the 3D block update <pre>
+//   γᵢ ← P_Fᵢ(γᵢ − ω⋅dᵢ⁻¹⋅vcᵢ)
+// </pre>
+// where dᵢ = tr(Wᵢᵢ)/3 is an isotropic approximation of the diagonal block
+// Wᵢᵢ, ω is the relaxation factor and P_Fᵢ is the Euclidean projection onto
+// the friction cone. The contact velocities are then updated with the block
+// column of W for the i-th contact, at a cost proportional to its number of
+// non-zeros. Therefore, the cost of a sweep is proportional to the number of
+// non-zeros in W and the cost per time step is bounded by
+// PgsSolverParameters::max_iterations sweeps.
+//
+// This is the convex relaxation of Coulomb friction of [Anitescu, 2006]: while
+// sliding, contacts separate with a normal velocity vn = μ⋅‖vt‖ proportional
+// to the slip velocity. This artifact is of order O(dt) and, for most
+// applications, not noticeable.
+//
+// The contact data phi0, stiffness and dissipation are not used, i.e. contact
+// is modeled as rigid at the velocity level and penetration is not corrected.
+//
+// The impulses of the previous solve are used as the initial guess when the
+// number of contacts has not changed, which is a good guess for resting
+// contact since the contact set and ordering are usually stable from one time
+// step to the next. Otherwise the solver starts from zero impulses. The
+// guess for velocities, v_guess, is ignored.
+//
+// - [Anitescu, 2006] Anitescu, M., 2006. Optimization-based simulation of
+// nonsmooth rigid multibody dynamics. Mathematical Programming, 105(1),
+// pp.113-143.
+//
+// @tparam_nonsymbolic_scalar
+template <typename T>
+class PgsSolver final : public ContactSolver<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PgsSolver);
+
+  PgsSolver() = default;
+
+  ~PgsSolver() final = default;
+
+  // @pre parameters.relaxation is in (0, 2).
+  // @pre parameters.max_iterations is positive.
+  void set_parameters(const PgsSolverParameters& parameters) {
+    DRAKE_DEMAND(0 < parameters.relaxation && parameters.relaxation < 2);
+    DRAKE_DEMAND(parameters.max_iterations > 0);
+    parameters_ = parameters;
+  }
+
+  const PgsSolverParameters& get_parameters() const { return parameters_; }
+
+  const PgsSolverIterationStats& get_iteration_stats() const { return stats_; }
+
+  // Returns ContactSolverStatus::kFailure if the solver did not converge to
+  // the requested tolerances within PgsSolverParameters::max_iterations
+  // sweeps.
+  ContactSolverStatus SolveWithGuess(const T& time_step,
+                                     const SystemDynamicsData<T>& dynamics_data,
+                                     const PointContactData<T>& contact_data,
+                                     const VectorX<T>& v_guess,
+                                     ContactSolverResults<T>* results) final;
+
+ private:
+  // Projects the impulse γ = (γt, γn) onto the friction cone with
+  // coefficient of friction mu, in place.
+  static void ProjectImpulse(const T& mu, Eigen::Ref<Vector3<T>> gamma);
+
+  PgsSolverParameters parameters_;
+  PgsSolverIterationStats stats_;
+  // The solver's state, used to warm start the next solve.
+  VectorX<T> gamma_;
+  // Scratch workspace, kept to avoid heap allocations between solves.
+  Eigen::SparseMatrix<T> W_;
+  VectorX<T> vc_;
+  VectorX<T> tau_c_;
+  VectorX<T> dv_;
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::PgsSolver)
@@ -0,0 +1,111 @@
+#include "drake/multibody/contact_solvers/delassus_operator.h"
+
+#include <vector>
+
+#include <Eigen/SparseCore>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/contact_solvers/sparse_linear_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+using SparseVectord = Eigen::SparseVector<double>;
+
+constexpr double kTolerance = 1.0e-13;
+
+class DelassusOperatorTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // A contact Jacobian for nc = 3 contacts and nv = 5 velocities, where the
+    // second contact does not involve the first two velocities.
+    MatrixXd Jc = MatrixXd::Zero(9, 5);
+    Jc.topRows<3>() << 1.0, 0.5, 0.0, 0.0, 0.0,
+                       0.0, 1.0, 0.0, 0.0, 2.0,
+                       0.3, 0.0, 1.0, 0.0, 0.0;
+    Jc.middleRows<3>(3) << 0.0, 0.0, 1.0, 0.2, 0.0,
+                           0.0, 0.0, 0.0, 1.0, 0.0,
+                           0.0, 0.0, 0.0, 0.4, 1.0;
+    Jc.bottomRows<3>() << 0.0, 1.0, 0.0, 0.0, 0.0,
+                          1.0, 0.0, 0.0, 0.0, 0.0,
+                          0.0, 0.0, 0.0, 0.0, 1.0;
+    // An SPD matrix with some sparsity.
+    MatrixXd Ainv = MatrixXd::Identity(5, 5);
+    Ainv(0, 1) = Ainv(1, 0) = 0.3;
+    Ainv(3, 4) = Ainv(4, 3) = -0.2;
+    Ainv(2, 2) = 2.0;
+
+    Jc_ = Jc.sparseView();
+    Ainv_ = Ainv.sparseView();
+    W_expected_ = Jc * Ainv * Jc.transpose();
+  }
+
+ protected:
+  SparseMatrixd Jc_;
+  SparseMatrixd Ainv_;
+  MatrixXd W_expected_;
+};
+
+TEST_F(DelassusOperatorTest, Multiply) {
+  const SparseLinearOperator<double> Jc_op("Jc", &Jc_);
+  const SparseLinearOperator<double> Ainv_op("Ainv", &Ainv_);
+  const DelassusOperator<double> W_op("W", &Jc_op, &Ainv_op);
+  EXPECT_EQ(W_op.name(), "W");
+  EXPECT_EQ(W_op.rows(), 9);
+  EXPECT_EQ(W_op.cols(), 9);
+  EXPECT_EQ(W_op.num_contacts(), 3);
+
+  const VectorXd x = VectorXd::LinSpaced(9, -1.0, 2.0);
+  VectorXd y(9);
+  W_op.Multiply(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, W_expected_ * x, kTolerance));
+  W_op.MultiplyByTranspose(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, W_expected_ * x, kTolerance));
+
+  SparseVectord xs(9);
+  xs.coeffRef(1) = 2.0;
+  xs.coeffRef(7) = -1.0;
+  SparseVectord ys(9);
+  W_op.Multiply(xs, &ys);
+  EXPECT_TRUE(CompareMatrices(VectorXd(ys), W_expected_ * VectorXd(xs),
+                              kTolerance));
+  W_op.MultiplyByTranspose(xs, &ys);
+  EXPECT_TRUE(CompareMatrices(VectorXd(ys), W_expected_ * VectorXd(xs),
+                              kTolerance));
+}
+
+TEST_F(DelassusOperatorTest, AssembleMatrix) {
+  const SparseLinearOperator<double> Jc_op("Jc", &Jc_);
+  const SparseLinearOperator<double> Ainv_op("Ainv", &Ainv_);
+  const DelassusOperator<double> W_op("W", &Jc_op, &Ainv_op);
+  SparseMatrixd W(9, 9);
+  W_op.AssembleMatrix(&W);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(W), W_expected_, kTolerance));
+}
+
+TEST_F(DelassusOperatorTest, DiagonalBlocks) {
+  const SparseLinearOperator<double> Jc_op("Jc", &Jc_);
+  const SparseLinearOperator<double> Ainv_op("Ainv", &Ainv_);
+  const DelassusOperator<double> W_op("W", &Jc_op, &Ainv_op);
+  std::vector<Matrix3<double>> W_blocks;
+  W_op.CalcDiagonalBlocks(&W_blocks);
+  ASSERT_EQ(W_blocks.size(), 3u);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(CompareMatrices(W_blocks[i],
+                                W_expected_.block<3, 3>(3 * i, 3 * i),
+                                kTolerance));
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,185 @@
+#include "drake/multibody/contact_solvers/pgs_solver.h"
+
+#include <vector>
+
+#include <Eigen/SparseCore>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/contact_solvers/sparse_linear_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+
+constexpr double kTimeStep = 1.0e-3;
+constexpr double kTolerance = 1.0e-10;
+
+// Returns the sparse matrix k⋅I of size n.
+SparseMatrixd MakeScaledIdentity(int n, double k) {
+  SparseMatrixd A(n, n);
+  A.setIdentity();
+  return A * k;
+}
+
+// Problem data for a single particle of mass m, with nv = 3, in contact at nc
+// points. All contact points have the same contact frame and their velocity
+// equals the velocity of the particle. That is, the contact Jacobian Jc
+// stacks nc identity matrices.
+class ParticleProblem {
+ public:
+  ParticleProblem(double mass, int num_contacts, const Vector3d& v_star,
+                  double mu)
+      : Ainv_(MakeScaledIdentity(3, 1.0 / mass)),
+        Jc_(3 * num_contacts, 3),
+        v_star_(v_star),
+        phi0_(VectorXd::Zero(num_contacts)),
+        stiffness_(VectorXd::Zero(num_contacts)),
+        dissipation_(VectorXd::Zero(num_contacts)),
+        mu_(VectorXd::Constant(num_contacts, mu)) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < num_contacts; ++i) {
+      for (int j = 0; j < 3; ++j) triplets.emplace_back(3 * i + j, j, 1.0);
+    }
+    Jc_.setFromTriplets(triplets.begin(), triplets.end());
+  }
+
+  ContactSolverStatus Solve(PgsSolver<double>* solver,
+                            ContactSolverResults<double>* results) const {
+    const SparseLinearOperator<double> Ainv_op("Ainv", &Ainv_);
+    const SparseLinearOperator<double> Jc_op("Jc", &Jc_);
+    const SystemDynamicsData<double> dynamics_data(&Ainv_op, &v_star_);
+    const PointContactData<double> contact_data(&phi0_, &Jc_op, &stiffness_,
+                                                &dissipation_, &mu_);
+    return solver->SolveWithGuess(kTimeStep, dynamics_data, contact_data,
+                                  v_star_, results);
+  }
+
+ private:
+  SparseMatrixd Ainv_;
+  SparseMatrixd Jc_;
+  VectorXd v_star_;
+  VectorXd phi0_;
+  VectorXd stiffness_;
+  VectorXd dissipation_;
+  VectorXd mu_;
+};
+
+// A particle moving towards the ground with a small tangential velocity comes
+// to rest.
+GTEST_TEST(PgsSolverTest, Stiction) {
+  const double mass = 2.0;
+  const ParticleProblem problem(mass, 1, Vector3d(0.1, 0.0, -1.0), 0.5);
+  PgsSolver<double> solver;
+  ContactSolverResults<double> results;
+  ASSERT_EQ(problem.Solve(&solver, &results), ContactSolverStatus::kSuccess);
+
+  EXPECT_TRUE(CompareMatrices(results.v_next, Vector3d::Zero(), kTolerance));
+  EXPECT_NEAR(results.fn(0), mass * 1.0 / kTimeStep, kTolerance / kTimeStep);
+  EXPECT_TRUE(CompareMatrices(results.ft,
+                              Eigen::Vector2d(-mass * 0.1 / kTimeStep, 0.0),
+                              kTolerance / kTimeStep));
+  EXPECT_TRUE(CompareMatrices(results.tau_contact,
+                              -mass * Vector3d(0.1, 0.0, -1.0) / kTimeStep,
+                              kTolerance / kTimeStep));
+  // With a single contact and an isotropic W, a single sweep finds the
+  // solution and a second one verifies convergence.
+  EXPECT_EQ(solver.get_iteration_stats().iterations, 2);
+}
+
+// The friction cone bounds the friction impulse. For the convex relaxation of
+// Coulomb friction we expect the contact to separate with a normal velocity
+// vn = μ⋅‖vt‖.
+GTEST_TEST(PgsSolverTest, Sliding) {
+  const double mu = 0.5;
+  const ParticleProblem problem(1.0, 1, Vector3d(1.0, 0.0, -1.0), mu);
+  PgsSolver<double> solver;
+  ContactSolverResults<double> results;
+  ASSERT_EQ(problem.Solve(&solver, &results), ContactSolverStatus::kSuccess);
+
+  EXPECT_NEAR(results.ft.norm(), mu * results.fn(0), kTolerance);
+  EXPECT_LT(results.ft(0), 0.0);
+  EXPECT_GT(results.vt(0), 0.0);
+  EXPECT_NEAR(results.vn(0), mu * results.vt.norm(), kTolerance);
+  EXPECT_TRUE(CompareMatrices(results.v_next, Vector3d(0.4, 0.0, 0.2),
+                              kTolerance));
+}
+
+// No impulses are needed for a separating contact.
+GTEST_TEST(PgsSolverTest, Separating) {
+  const Vector3d v_star(0.3, 0.0, 1.0);
+  const ParticleProblem problem(1.0, 1, v_star, 0.5);
+  PgsSolver<double> solver;
+  ContactSolverResults<double> results;
+  ASSERT_EQ(problem.Solve(&solver, &results), ContactSolverStatus::kSuccess);
+  EXPECT_EQ(results.fn(0), 0.0);
+  EXPECT_EQ(results.ft.norm(), 0.0);
+  EXPECT_TRUE(CompareMatrices(results.v_next, v_star));
+}
+
+GTEST_TEST(PgsSolverTest, NoContacts) {
+  const Vector3d v_star(0.3, 0.0, -1.0);
+  const ParticleProblem problem(1.0, 0, v_star, 0.5);
+  PgsSolver<double> solver;
+  ContactSolverResults<double> results;
+  ASSERT_EQ(problem.Solve(&solver, &results), ContactSolverStatus::kSuccess);
+  EXPECT_EQ(results.fn.size(), 0);
+  EXPECT_TRUE(CompareMatrices(results.v_next, v_star));
+  EXPECT_TRUE(CompareMatrices(results.tau_contact, Vector3d::Zero()));
+  EXPECT_EQ(solver.get_iteration_stats().iterations, 0);
+}
+
+// Several contacts on the same particle couple through W. The impulses are not
+// unique but the velocity is. The impulses of the previous solve are a good
+// initial guess for the next one.
+GTEST_TEST(PgsSolverTest, CoupledContactsAndWarmStart) {
+  const double mass = 1.5;
+  const ParticleProblem problem(mass, 4, Vector3d(0.1, 0.05, -1.0), 0.5);
+  PgsSolver<double> solver;
+  PgsSolverParameters parameters;
+  parameters.abs_tolerance = 1.0e-12;
+  parameters.rel_tolerance = 1.0e-12;
+  parameters.max_iterations = 1000;
+  solver.set_parameters(parameters);
+  ContactSolverResults<double> results;
+  ASSERT_EQ(problem.Solve(&solver, &results), ContactSolverStatus::kSuccess);
+  // The first contact stops the particle in the first sweep, and the second
+  // sweep verifies convergence.
+  EXPECT_EQ(solver.get_iteration_stats().iterations, 2);
+
+  EXPECT_TRUE(CompareMatrices(results.v_next, Vector3d::Zero(), 1.0e-10));
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_GE(results.fn(i), 0.0);
+    EXPECT_LE(results.ft.segment<2>(2 * i).norm(),
+              0.5 * results.fn(i) * (1.0 + 1.0e-12));
+  }
+  // The total impulse stops the particle.
+  EXPECT_NEAR(results.fn.sum() * kTimeStep, mass * 1.0, 1.0e-10);
+
+  // Warm starting from the previous solution converges immediately.
+  ASSERT_EQ(problem.Solve(&solver, &results), ContactSolverStatus::kSuccess);
+  EXPECT_EQ(solver.get_iteration_stats().iterations, 1);
+}
+
+GTEST_TEST(PgsSolverTest, MaxIterations) {
+  const ParticleProblem problem(1.0, 4, Vector3d(0.1, 0.05, -1.0), 0.5);
+  PgsSolver<double> solver;
+  PgsSolverParameters parameters;
+  parameters.max_iterations = 1;
+  solver.set_parameters(parameters);
+  ContactSolverResults<double> results;
+  EXPECT_EQ(problem.Solve(&solver, &results), ContactSolverStatus::kFailure);
+  EXPECT_EQ(solver.get_iteration_stats().iterations, 1);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -381,10 +381,12 @@ GlobalInverseKinematics::AddWorldOrientationConstraint(
   return prog_.AddLinearConstraint(rotation_matrix_err.trace(), lb, 3);
 }
 
-void GlobalInverseKinematics::AddPostureCost(
+void GlobalInverseKinematics::CalcPostureCostCoefficients(
     const Eigen::Ref<const Eigen::VectorXd>& q_desired,
     const Eigen::Ref<const Eigen::VectorXd>& body_position_cost,
-    const Eigen::Ref<const Eigen::VectorXd>& body_orientation_cost) {
+    const Eigen::Ref<const Eigen::VectorXd>& body_orientation_cost,
+    Eigen::VectorXd* cost_coefficients, double* cost_constant,
+    Eigen::VectorXd* p_WBo_desired) const {
   const int num_bodies = plant_.num_bodies();
   if (body_position_cost.rows() != num_bodies) {
     std::ostringstream oss;
@@ -411,42 +413,116 @@ void GlobalInverseKinematics::AddPostureCost(
   auto context = plant_.CreateDefaultContext();
   plant_.SetPositions(context.get(), q_desired);
 
-  // Sum up the orientation error for each body to orient_err_sum.
-  Expression orient_err_sum(0);
-  // p_WBo_err(i) is the slack variable, representing the position error for
-  // the (i+1)'th body, which is the Euclidean distance from the body origin
-  // position, to the desired position.
-  solvers::VectorXDecisionVariable p_WBo_err =
-      prog_.NewContinuousVariables(num_bodies - 1, "p_WBo_error");
+  cost_coefficients->resize(10 * (num_bodies - 1));
+  p_WBo_desired->resize(3 * (num_bodies - 1));
+  *cost_constant = 0;
   for (int i = 1; i < num_bodies; ++i) {
     // body 0 is the world. There is no position or orientation error on the
     // world, so we just skip i = 0 and start from i = 1.
     const auto& X_WB_desired = plant_.CalcRelativeTransform(
         *context, plant_.world_frame(),
         plant_.get_body(BodyIndex{i}).body_frame());
-    // Add the constraint p_WBo_err(i-1) >= body_position_cost(i) *
-    // |p_WBo(i) - p_WBo_desired(i) |
-    Vector4<symbolic::Expression> pos_error_expr;
-    pos_error_expr << p_WBo_err(i - 1),
-        body_position_cost(i) * (p_WBo_[i] - X_WB_desired.translation());
-    prog_.AddLorentzConeConstraint(pos_error_expr);
+    p_WBo_desired->segment<3>(3 * (i - 1)) = X_WB_desired.translation();
+    // The position error on body i is body_position_cost(i) * p_WBo_err(i-1),
+    // where p_WBo_err(i-1) >= |p_WBo(i) - p_WBo_desired(i)|.
+    (*cost_coefficients)(i - 1) = body_position_cost(i);
 
     // The orientation error is on the angle θ between the body orientation and
     // the desired orientation, namely 1 - cos(θ).
     // cos(θ) can be computed as (trace( R_WB_desired * R_WB_[i]ᵀ) - 1) / 2
     // To see how the angle is computed from a rotation matrix, please refer to
     // http://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToAngle/
-    orient_err_sum +=
-        body_orientation_cost(i) *
-        (1 -
-         ((X_WB_desired.rotation().matrix() * R_WB_[i].transpose()).trace() -
-          1) /
-             2);
+    // Expanding the trace, the orientation error is
+    // 3/2 - 1/2 * sum_jk R_WB_desired(j, k) * R_WB_[i](j, k).
+    const Matrix3d& R_WB_desired = X_WB_desired.rotation().matrix();
+    cost_coefficients->segment<9>(num_bodies - 1 + 9 * (i - 1)) =
+        -0.5 * body_orientation_cost(i) *
+        Eigen::Map<const Eigen::Matrix<double, 9, 1>>(R_WB_desired.data());
+    *cost_constant += 1.5 * body_orientation_cost(i);
   }
+}
+
+void GlobalInverseKinematics::AddPostureCost(
+    const Eigen::Ref<const Eigen::VectorXd>& q_desired,
+    const Eigen::Ref<const Eigen::VectorXd>& body_position_cost,
+    const Eigen::Ref<const Eigen::VectorXd>& body_orientation_cost) {
+  Eigen::VectorXd cost_coefficients;
+  double cost_constant;
+  Eigen::VectorXd p_WBo_desired;
+  CalcPostureCostCoefficients(q_desired, body_position_cost,
+                              body_orientation_cost, &cost_coefficients,
+                              &cost_constant, &p_WBo_desired);
+
+  const int num_bodies = plant_.num_bodies();
+  // p_WBo_err(i) is the slack variable, representing the position error for
+  // the (i+1)'th body, which is the Euclidean distance from the body origin
+  // position, to the desired position.
+  solvers::VectorXDecisionVariable p_WBo_err =
+      prog_.NewContinuousVariables(num_bodies - 1, "p_WBo_error");
+  // p_WBo_delta.segment<3>(3 * i) is the offset of the (i+1)'th body origin
+  // from its desired position. The desired position only enters the program
+  // through the linear equality constraint below, so that UpdatePostureCost()
+  // can change it without touching the Lorentz cone constraints.
+  solvers::VectorXDecisionVariable p_WBo_delta =
+      prog_.NewContinuousVariables(3 * (num_bodies - 1), "p_WBo_delta");
+  solvers::VectorXDecisionVariable p_WBo_all(3 * (num_bodies - 1));
+  solvers::VectorXDecisionVariable R_WB_all(9 * (num_bodies - 1));
+  for (int i = 1; i < num_bodies; ++i) {
+    p_WBo_all.segment<3>(3 * (i - 1)) = p_WBo_[i];
+    R_WB_all.segment<9>(9 * (i - 1)) =
+        Eigen::Map<const solvers::VectorDecisionVariable<9>>(R_WB_[i].data());
+    // Add the constraint p_WBo_err(i-1) >= |p_WBo_delta(i-1)|.
+    Vector4<symbolic::Expression> pos_error_expr;
+    pos_error_expr << p_WBo_err(i - 1),
+        p_WBo_delta.segment<3>(3 * (i - 1)).cast<symbolic::Expression>();
+    prog_.AddLorentzConeConstraint(pos_error_expr);
+  }
+  Eigen::MatrixXd A_desired_position(3 * (num_bodies - 1),
+                                     6 * (num_bodies - 1));
+  A_desired_position << Eigen::MatrixXd::Identity(3 * (num_bodies - 1),
+                                                  3 * (num_bodies - 1)),
+      -Eigen::MatrixXd::Identity(3 * (num_bodies - 1), 3 * (num_bodies - 1));
+  auto desired_position = prog_.AddLinearEqualityConstraint(
+      A_desired_position, p_WBo_desired, {p_WBo_all, p_WBo_delta});
 
   // The total cost is the summation of the position error and the orientation
   // error.
-  prog_.AddCost(p_WBo_err.cast<Expression>().sum() + orient_err_sum);
+  auto cost = prog_.AddLinearCost(cost_coefficients, cost_constant,
+                                  {p_WBo_err, R_WB_all});
+  posture_cost_.emplace(PostureCost{cost, desired_position});
+}
+
+void GlobalInverseKinematics::UpdatePostureCost(
+    const Eigen::Ref<const Eigen::VectorXd>& q_desired,
+    const Eigen::Ref<const Eigen::VectorXd>& body_position_cost,
+    const Eigen::Ref<const Eigen::VectorXd>& body_orientation_cost) {
+  if (!posture_cost_.has_value()) {
+    throw std::runtime_error(
+        "UpdatePostureCost(): call AddPostureCost() first.");
+  }
+  Eigen::VectorXd cost_coefficients;
+  double cost_constant;
+  Eigen::VectorXd p_WBo_desired;
+  CalcPostureCostCoefficients(q_desired, body_position_cost,
+                              body_orientation_cost, &cost_coefficients,
+                              &cost_constant, &p_WBo_desired);
+  posture_cost_->cost.evaluator()->UpdateCoefficients(cost_coefficients,
+                                                      cost_constant);
+  posture_cost_->desired_position.evaluator()->set_bounds(p_WBo_desired,
+                                                          p_WBo_desired);
+}
+
+void GlobalInverseKinematics::SetInitialGuessFromSolution(
+    const solvers::MathematicalProgramResult& result) {
+  // Decision variables are only ever appended to prog_, so the first
+  // result.get_x_val().rows() variables are the ones solved for in `result`.
+  const Eigen::VectorXd& x_val = result.get_x_val();
+  if (x_val.rows() > prog_.num_vars()) {
+    throw std::runtime_error(
+        "SetInitialGuessFromSolution(): result has more decision variables "
+        "than prog().");
+  }
+  prog_.SetInitialGuess(prog_.decision_variables().head(x_val.rows()), x_val);
 }
 
 solvers::VectorXDecisionVariable
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <unordered_set>
 #include <vector>
 
@@ -21,6 +22,17 @@ namespace multibody {
  * The approach is described in Global Inverse Kinematics via Mixed-integer
  * Convex Optimization by Hongkai Dai, Gregory Izatt and Russ Tedrake,
  * International Journal of Robotics Research, 2019.
+ *
+ * The mixed-integer relaxation of SO(3) is built once in the constructor, so
+ * one instance can be reused to solve many nearby queries on the same robot.
+ * Between solves, update the per-query data in place instead of adding new
+ * costs and constraints: change the bounds of the bindings returned by
+ * AddWorldPositionConstraint() and AddWorldOrientationConstraint() with
+ * set_bounds(), re-target the posture cost with UpdatePostureCost(), and seed
+ * the next solve with SetInitialGuessFromSolution(), which hands the previous
+ * integer assignment to a mixed-integer solver (such as Gurobi) as a start.
+ * To stop a query at the first integer-feasible solution, set the solver's own
+ * termination options, for example Gurobi's "SolutionLimit".
  */
 class GlobalInverseKinematics {
  public:
@@ -217,6 +229,30 @@ class GlobalInverseKinematics {
       const Eigen::Ref<const Eigen::VectorXd>& body_position_cost,
       const Eigen::Ref<const Eigen::VectorXd>& body_orientation_cost);
 
+  /**
+   * Changes the desired posture and the weights of the posture cost added by
+   * the most recent call to AddPostureCost(), without adding any new decision
+   * variables, costs or constraints to the program. The arguments and their
+   * preconditions are the same as in AddPostureCost().
+   * @throws std::runtime_error if AddPostureCost() has not been called, or if
+   * the preconditions are not satisfied.
+   */
+  void UpdatePostureCost(
+      const Eigen::Ref<const Eigen::VectorXd>& q_desired,
+      const Eigen::Ref<const Eigen::VectorXd>& body_position_cost,
+      const Eigen::Ref<const Eigen::VectorXd>& body_orientation_cost);
+
+  /**
+   * Sets the initial guess of prog() to the solution of a previous solve of
+   * this same program, including the values of the binary variables in the
+   * mixed-integer relaxation of SO(3). Mixed-integer solvers use this as a
+   * start (for Gurobi, it provides the incumbent before the root node), which
+   * helps when the new query is close to the previous one. Decision variables
+   * added to prog() after `result` was computed keep their current guess.
+   */
+  void SetInitialGuessFromSolution(
+      const solvers::MathematicalProgramResult& result);
+
   /**
    * Constrain the point `Q` lying within one of the convex polytopes.
    * Each convex polytope Pᵢ is represented by its vertices as
@@ -338,6 +374,28 @@ class GlobalInverseKinematics {
       Eigen::Ref<Eigen::VectorXd> q,
       std::vector<Eigen::Matrix3d>* reconstruct_R_WB) const;
 
+  // Checks the arguments of AddPostureCost(), and computes the coefficients of
+  // the posture cost for the desired posture `q_desired`. `cost_coefficients`
+  // and `cost_constant` are for the linear cost on
+  // [p_WBo_err; R_WB_[1](:); ...; R_WB_[n-1](:)], and `p_WBo_desired` stacks
+  // the desired position of each body other than the world.
+  void CalcPostureCostCoefficients(
+      const Eigen::Ref<const Eigen::VectorXd>& q_desired,
+      const Eigen::Ref<const Eigen::VectorXd>& body_position_cost,
+      const Eigen::Ref<const Eigen::VectorXd>& body_orientation_cost,
+      Eigen::VectorXd* cost_coefficients, double* cost_constant,
+      Eigen::VectorXd* p_WBo_desired) const;
+
+  // The bindings of the posture cost, kept so that UpdatePostureCost() can
+  // change them in place.
+  struct PostureCost {
+    // The linear cost on [p_WBo_err; R_WB_[1](:); ...; R_WB_[n-1](:)].
+    solvers::Binding<solvers::LinearCost> cost;
+    // p_WBo_[i] - p_WBo_delta[i] = p_WBo_desired[i], for every body i except
+    // the world. The slack p_WBo_err[i] is bounded below by |p_WBo_delta[i]|.
+    solvers::Binding<solvers::LinearEqualityConstraint> desired_position;
+  };
+
   solvers::MathematicalProgram prog_;
 
   const MultibodyPlant<double>& plant_;
@@ -358,6 +416,9 @@ class GlobalInverseKinematics {
   // p_WBo_[i] is the position of the origin Bo of body frame B for the i'th
   // body, measured and expressed in the world frame.
   std::vector<solvers::VectorDecisionVariable<3>> p_WBo_;
+
+  // The posture cost added by the most recent call to AddPostureCost().
+  std::optional<PostureCost> posture_cost_;
 };
 }  // namespace multibody
 }  // namespace drake
@@ -1,23 +1,77 @@
 #include "drake/multibody/inverse_kinematics/kinematic_constraint_utilities.h"
 
+#include <algorithm>
+
 namespace drake {
 namespace multibody {
 namespace internal {
+namespace {
+// Returns the number of columns of math::autoDiffToGradientMatrix(x), without
+// allocating that matrix.
+int NumDerivatives(const Eigen::Ref<const VectorX<AutoDiffXd>>& x) {
+  int result = 0;
+  for (int i = 0; i < x.rows(); ++i) {
+    const int size = x.data()[i].derivatives().size();
+    result = std::max(result, size);
+  }
+  return result;
+}
+}  // namespace
+
+// These functions are called on every constraint evaluation, so they compare
+// entry by entry rather than materializing the value and gradient matrices.
+// Entries are accessed through data() because the coefficient accessors of a
+// read-only Ref return AutoDiffXd by value, copying the derivatives.
 bool AreAutoDiffVecXdEqual(const Eigen::Ref<const VectorX<AutoDiffXd>>& a,
                            const Eigen::Ref<const VectorX<AutoDiffXd>>& b) {
   if (a.rows() != b.rows()) {
     return false;
   }
-  if (math::autoDiffToValueMatrix(a) != math::autoDiffToValueMatrix(b)) {
+  for (int i = 0; i < a.rows(); ++i) {
+    if (a.data()[i].value() != b.data()[i].value()) {
+      return false;
+    }
+  }
+  if (NumDerivatives(a) != NumDerivatives(b)) {
     return false;
   }
-  const Eigen::MatrixXd a_gradient = math::autoDiffToGradientMatrix(a);
-  const Eigen::MatrixXd b_gradient = math::autoDiffToGradientMatrix(b);
-  if (a_gradient.rows() != b_gradient.rows() ||
-      a_gradient.cols() != b_gradient.cols()) {
+  for (int i = 0; i < a.rows(); ++i) {
+    const Eigen::VectorXd& a_derivatives = a.data()[i].derivatives();
+    const Eigen::VectorXd& b_derivatives = b.data()[i].derivatives();
+    // An empty derivatives vector stands for a row of zeros in the gradient
+    // matrix.
+    if (a_derivatives.size() == b_derivatives.size()) {
+      if (a_derivatives != b_derivatives) {
+        return false;
+      }
+    } else if (a_derivatives.size() == 0) {
+      if (!(b_derivatives.array() == 0).all()) {
+        return false;
+      }
+    } else if (b_derivatives.size() == 0) {
+      if (!(a_derivatives.array() == 0).all()) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ReuseContextDerivativesIfSameValues(
+    const Eigen::Ref<const AutoDiffVecXd>& x_context,
+    Eigen::Ref<AutoDiffVecXd> x) {
+  if (x.rows() != x_context.rows()) {
     return false;
   }
-  return a_gradient == b_gradient;
+  for (int i = 0; i < x.rows(); ++i) {
+    if (x.data()[i].value() != x_context.data()[i].value()) {
+      return false;
+    }
+  }
+  x = x_context;
+  return true;
 }
 
 void UpdateContextConfiguration(drake::systems::Context<double>* context,
@@ -32,8 +86,15 @@ void UpdateContextConfiguration(drake::systems::Context<double>* context,
 void UpdateContextConfiguration(drake::systems::Context<double>* context,
                                 const MultibodyPlant<double>& plant,
                                 const Eigen::Ref<const AutoDiffVecXd>& q) {
-  return UpdateContextConfiguration(context, plant,
-                                    math::autoDiffToValueMatrix(q));
+  DRAKE_ASSERT(context);
+  const auto q_context = plant.GetPositions(*context);
+  bool same = q.rows() == q_context.rows();
+  for (int i = 0; same && i < q.rows(); ++i) {
+    same = q.data()[i].value() == q_context(i);
+  }
+  if (!same) {
+    plant.SetPositions(context, math::autoDiffToValueMatrix(q));
+  }
 }
 
 void UpdateContextConfiguration(systems::Context<AutoDiffXd>* context,
@@ -45,6 +106,25 @@ void UpdateContextConfiguration(systems::Context<AutoDiffXd>* context,
   }
 }
 
+void UpdateContextPositionsAndVelocities(
+    systems::Context<AutoDiffXd>* context,
+    const MultibodyPlant<AutoDiffXd>& plant,
+    const Eigen::Ref<const AutoDiffVecXd>& q,
+    const Eigen::Ref<const AutoDiffVecXd>& v) {
+  DRAKE_ASSERT(context);
+  const bool same_q = AreAutoDiffVecXdEqual(q, plant.GetPositions(*context));
+  const bool same_v = AreAutoDiffVecXdEqual(v, plant.GetVelocities(*context));
+  if (!same_q && !same_v) {
+    AutoDiffVecXd qv(q.rows() + v.rows());
+    qv << q, v;
+    plant.SetPositionsAndVelocities(context, qv);
+  } else if (!same_q) {
+    plant.SetPositions(context, q);
+  } else if (!same_v) {
+    plant.SetVelocities(context, v);
+  }
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -18,6 +18,22 @@ namespace internal {
 bool AreAutoDiffVecXdEqual(const Eigen::Ref<const AutoDiffVecXd>& a,
                            const Eigen::Ref<const AutoDiffVecXd>& b);
 
+/**
+ * Evaluators on a MultibodyPlant<AutoDiffXd> typically compute values only by
+ * evaluating their AutoDiffXd overload at x.cast<AutoDiffXd>(). The empty
+ * derivatives of such an `x` differ from the derivatives that a previous
+ * gradient evaluation stored in a shared context, and would dirty the
+ * context's cache even at the same point. Since values do not depend on
+ * derivatives, if the values of `x` equal those of `x_context` (e.g. the
+ * positions stored in the context) this copies `x_context` into `x`, so that
+ * the subsequent comparison against the context succeeds and the cached
+ * kinematics and dynamics are reused. Otherwise `x` is left unchanged.
+ * @returns true if `x` was overwritten.
+ */
+bool ReuseContextDerivativesIfSameValues(
+    const Eigen::Ref<const AutoDiffVecXd>& x_context,
+    Eigen::Ref<AutoDiffVecXd> x);
+
 /**
  * Check if the generalized positions in @p context are the same as @p q.
  * If they are not the same, then reset @p context's generalized positions
@@ -37,6 +53,18 @@ void UpdateContextConfiguration(systems::Context<AutoDiffXd>* context,
                                 const MultibodyPlant<AutoDiffXd>& plant,
                                 const Eigen::Ref<const AutoDiffVecXd>& q);
 
+/**
+ * Like UpdateContextConfiguration(), for both the generalized positions @p q
+ * and the generalized velocities @p v. Only the ones that differ from those in
+ * @p context are set, and when both differ they are set with a single call so
+ * that the cache entries depending on them are invalidated once.
+ */
+void UpdateContextPositionsAndVelocities(
+    systems::Context<AutoDiffXd>* context,
+    const MultibodyPlant<AutoDiffXd>& plant,
+    const Eigen::Ref<const AutoDiffVecXd>& q,
+    const Eigen::Ref<const AutoDiffVecXd>& v);
+
 /**
  * Normalize an Eigen vector of doubles. This function is used in the
  * constructor of some kinematic constraints.
@@ -1,6 +1,7 @@
 #include "drake/multibody/inverse_kinematics/minimum_distance_constraint.h"
 
 #include <limits>
+#include <type_traits>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -12,11 +13,54 @@ namespace drake {
 namespace multibody {
 using internal::RefFromPtrOrThrow;
 
+namespace {
+// Returns the signed distance pairs closer than influence_distance, reusing
+// the ones in `cache` when they were computed for the same plant positions and
+// influence distance. The geometries that are not moved by the plant are
+// assumed not to have moved in between.
+const std::vector<geometry::SignedDistancePair<double>>& SignedDistancePairs(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& context,
+    const geometry::QueryObject<double>& query_object,
+    double influence_distance, internal::SignedDistancePairsCache* cache,
+    std::vector<geometry::SignedDistancePair<double>>* storage) {
+  if (cache == nullptr) {
+    *storage = query_object.ComputeSignedDistancePairwiseClosestPoints(
+        influence_distance);
+    return *storage;
+  }
+  const auto& q = plant.GetPositions(context);
+  if (!cache->valid || cache->influence_distance != influence_distance ||
+      cache->q != q) {
+    cache->pairs = query_object.ComputeSignedDistancePairwiseClosestPoints(
+        influence_distance);
+    cache->q = q;
+    cache->influence_distance = influence_distance;
+    cache->valid = true;
+  }
+  return cache->pairs;
+}
+
+// The pairs computed with MultibodyPlant<AutoDiffXd> carry the derivatives of
+// the context, so they are never cached.
+const std::vector<geometry::SignedDistancePair<AutoDiffXd>>&
+SignedDistancePairs(
+    const MultibodyPlant<AutoDiffXd>&, const systems::Context<AutoDiffXd>&,
+    const geometry::QueryObject<AutoDiffXd>& query_object,
+    double influence_distance, internal::SignedDistancePairsCache*,
+    std::vector<geometry::SignedDistancePair<AutoDiffXd>>* storage) {
+  *storage = query_object.ComputeSignedDistancePairwiseClosestPoints(
+      influence_distance);
+  return *storage;
+}
+}  // namespace
+
 template <typename T, typename S>
 VectorX<S> Distances(const MultibodyPlant<T>& plant,
                      systems::Context<T>* context,
                      const Eigen::Ref<const VectorX<S>>& q,
-                     double influence_distance) {
+                     double influence_distance,
+                     internal::SignedDistancePairsCache* cache) {
   internal::UpdateContextConfiguration(context, plant, q);
   const auto& query_port = plant.get_geometry_query_input_port();
   if (!query_port.HasValue(*context)) {
@@ -30,9 +74,10 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
   const auto& query_object =
       query_port.template Eval<geometry::QueryObject<T>>(*context);
 
-  const std::vector<geometry::SignedDistancePair<T>> signed_distance_pairs =
-      query_object.ComputeSignedDistancePairwiseClosestPoints(
-          influence_distance);
+  std::vector<geometry::SignedDistancePair<T>> storage;
+  const std::vector<geometry::SignedDistancePair<T>>& signed_distance_pairs =
+      SignedDistancePairs(plant, *context, query_object, influence_distance,
+                          cache, &storage);
   VectorX<S> distances(signed_distance_pairs.size());
   int distance_count{0};
   for (const auto& signed_distance_pair : signed_distance_pairs) {
@@ -86,16 +131,20 @@ void MinimumDistanceConstraint::Initialize(
           .inspector()
           .GetCollisionCandidates()
           .size();
+  internal::SignedDistancePairsCache* const cache =
+      std::is_same_v<T, double> ? &signed_distance_pairs_cache_ : nullptr;
   minimum_value_constraint_ = std::make_unique<solvers::MinimumValueConstraint>(
       this->num_vars(), minimum_distance, influence_distance_offset,
       num_collision_candidates,
-      [&plant, plant_context](const auto& x, double influence_distance) {
+      [&plant, plant_context, cache](const auto& x,
+                                     double influence_distance) {
         return Distances<T, AutoDiffXd>(plant, plant_context, x,
-                                        influence_distance);
+                                        influence_distance, cache);
       },
-      [&plant, plant_context](const auto& x, double influence_distance) {
+      [&plant, plant_context, cache](const auto& x,
+                                     double influence_distance) {
         return Distances<T, double>(plant, plant_context, x,
-                                    influence_distance);
+                                    influence_distance, cache);
       });
   this->set_bounds(minimum_value_constraint_->lower_bound(),
                    minimum_value_constraint_->upper_bound());
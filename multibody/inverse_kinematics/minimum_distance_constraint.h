@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/constraint.h"
 #include "drake/solvers/minimum_value_constraint.h"
@@ -10,6 +11,17 @@
 
 namespace drake {
 namespace multibody {
+namespace internal {
+/* The signed distance pairs from the most recent query of a
+MinimumDistanceConstraint on a MultibodyPlant<double>, together with the
+plant positions and the influence distance they were computed for. */
+struct SignedDistancePairsCache {
+  bool valid{false};
+  Eigen::VectorXd q;
+  double influence_distance{};
+  std::vector<geometry::SignedDistancePair<double>> pairs;
+};
+}  // namespace internal
 
 /** Computes the penalty function φ(x) and its derivatives dφ(x)/dx. Valid
 penalty functions must meet the following criteria:
@@ -141,6 +153,10 @@ class MinimumDistanceConstraint final : public solvers::Constraint {
 
   const multibody::MultibodyPlant<double>* const plant_double_;
   systems::Context<double>* const plant_context_double_;
+  // Only used with plant_double_. Solvers typically evaluate the constraint
+  // with both double and AutoDiffXd at the same q; both evaluations query the
+  // same double-valued geometry, so the second one reuses these pairs.
+  internal::SignedDistancePairsCache signed_distance_pairs_cache_;
   std::unique_ptr<solvers::MinimumValueConstraint> minimum_value_constraint_;
   const multibody::MultibodyPlant<AutoDiffXd>* const plant_autodiff_;
   systems::Context<AutoDiffXd>* const plant_context_autodiff_;
@@ -0,0 +1,94 @@
+#include "drake/multibody/inverse_kinematics/multi_start_inverse_kinematics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/parallel_for.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/solver_interface.h"
+
+namespace drake {
+namespace multibody {
+
+std::vector<MultiStartInverseKinematicsSolution>
+SolveMultiStartInverseKinematics(
+    const MultibodyPlant<double>& plant,
+    const std::function<void(InverseKinematics*)>& add_constraints,
+    const std::vector<Eigen::VectorXd>& q_seeds,
+    const MultiStartInverseKinematicsOptions& options) {
+  if (options.num_threads < 1) {
+    throw std::runtime_error(
+        "SolveMultiStartInverseKinematics(): num_threads should be positive.");
+  }
+  for (int i = 0; i < static_cast<int>(q_seeds.size()); ++i) {
+    if (q_seeds[i].rows() != plant.num_positions()) {
+      std::ostringstream oss;
+      oss << "SolveMultiStartInverseKinematics(): q_seeds[" << i << "] has "
+          << q_seeds[i].rows() << " rows, but the plant has "
+          << plant.num_positions() << " positions.";
+      throw std::runtime_error(oss.str());
+    }
+  }
+
+  const int num_seeds = q_seeds.size();
+  std::atomic<bool> found_success{false};
+  std::vector<std::vector<MultiStartInverseKinematicsSolution>>
+      thread_solutions(std::min(std::max(num_seeds, 1), options.num_threads));
+  drake::internal::StaticParallelForRange(
+      num_seeds, options.num_threads, [&](int thread_num, int begin, int end) {
+        // The InverseKinematics object owns the plant context that its
+        // constraints evaluate with, so each thread needs its own.
+        InverseKinematics ik(plant, options.with_joint_limits);
+        add_constraints(&ik);
+        const std::unique_ptr<solvers::SolverInterface> solver =
+            solvers::MakeSolver(options.solver_id.has_value()
+                                    ? *options.solver_id
+                                    : solvers::ChooseBestSolver(ik.prog()));
+        Eigen::VectorXd initial_guess = ik.prog().initial_guess();
+        for (int i = begin; i < end; ++i) {
+          if (options.stop_at_first_success && found_success) {
+            break;
+          }
+          ik.prog().SetDecisionVariableValueInVector(ik.q(), q_seeds[i],
+                                                     &initial_guess);
+          MultiStartInverseKinematicsSolution solution;
+          solution.seed_index = i;
+          solver->Solve(ik.prog(), initial_guess, options.solver_options,
+                        &solution.result);
+          solution.q = solution.result.GetSolution(ik.q());
+          if (solution.result.is_success()) {
+            found_success = true;
+          }
+          thread_solutions[thread_num].push_back(std::move(solution));
+        }
+      });
+
+  // Concatenating in thread order keeps the solutions in seed order, so the
+  // stable sort below breaks ties by seed index.
+  std::vector<MultiStartInverseKinematicsSolution> solutions;
+  solutions.reserve(num_seeds);
+  for (auto& thread_solution : thread_solutions) {
+    std::move(thread_solution.begin(), thread_solution.end(),
+              std::back_inserter(solutions));
+  }
+  std::stable_sort(solutions.begin(), solutions.end(),
+                   [](const MultiStartInverseKinematicsSolution& a,
+                      const MultiStartInverseKinematicsSolution& b) {
+                     const bool a_success = a.result.is_success();
+                     const bool b_success = b.result.is_success();
+                     if (a_success && b_success) {
+                       return a.result.get_optimal_cost() <
+                              b.result.get_optimal_cost();
+                     }
+                     return a_success && !b_success;
+                   });
+  return solutions;
+}
+
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_id.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace multibody {
+
+/** Options for SolveMultiStartInverseKinematics(). */
+struct MultiStartInverseKinematicsOptions {
+  // This constructor is needed, otherwise the compiler complains.
+  MultiStartInverseKinematicsOptions() {}
+
+  /** The number of threads that solve seeds concurrently. Each thread builds
+   * its own InverseKinematics problem (and hence its own plant context) once,
+   * and reuses it for all of the seeds assigned to it. */
+  int num_threads{1};
+
+  /** If true, stop solving the remaining seeds as soon as one seed solves
+   * successfully. Seeds that are already being solved on other threads run to
+   * completion, so more than one successful solution might be returned. */
+  bool stop_at_first_success{false};
+
+  /** Passed to the InverseKinematics constructor. */
+  bool with_joint_limits{true};
+
+  /** The solver used for every seed. If empty, the solver is chosen by
+   * solvers::ChooseBestSolver(). The solver must be safe to run concurrently
+   * on different programs when num_threads > 1. */
+  std::optional<solvers::SolverId> solver_id;
+
+  /** The options passed to the solver for every seed. */
+  std::optional<solvers::SolverOptions> solver_options;
+};
+
+/** The solution of SolveMultiStartInverseKinematics() from one seed. */
+struct MultiStartInverseKinematicsSolution {
+  /** The index of the seed in `q_seeds`. */
+  int seed_index{};
+  /** The generalized positions in the solution. */
+  Eigen::VectorXd q;
+  /** The result of solving the InverseKinematics program from this seed. */
+  solvers::MathematicalProgramResult result;
+};
+
+/**
+ * Solves the same inverse kinematics problem from each of the seeds in
+ * `q_seeds`, to escape the local minima of a nonlinear solver.
+ *
+ * The problem is built by calling `add_constraints` on an InverseKinematics
+ * object constructed for `plant`; it should add the kinematic constraints and
+ * costs from the plant frames, and must not depend on which seed is solved.
+ * This happens once per thread (not once per seed), and the solver starts from
+ * the seed for InverseKinematics::q(), and from the program's initial guess for
+ * any other decision variables.
+ *
+ * @returns The solutions, ranked such that the successful ones come first in
+ * ascending order of their optimal cost, followed by the unsuccessful ones in
+ * the order of their seeds. With `options.stop_at_first_success`, the seeds
+ * that were skipped have no solution.
+ * @throws std::runtime_error if a seed does not have plant.num_positions()
+ * rows, or if `options.num_threads` < 1.
+ * @note Since the plant is constructed without a context from a Diagram,
+ * collision related constraints (such as AddMinimumDistanceConstraint) are not
+ * supported.
+ */
+std::vector<MultiStartInverseKinematicsSolution>
+SolveMultiStartInverseKinematics(
+    const MultibodyPlant<double>& plant,
+    const std::function<void(InverseKinematics*)>& add_constraints,
+    const std::vector<Eigen::VectorXd>& q_seeds,
+    const MultiStartInverseKinematicsOptions& options =
+        MultiStartInverseKinematicsOptions());
+
+}  // namespace multibody
+}  // namespace drake
@@ -133,6 +133,72 @@ TEST_F(KukaTest, ReachableWithCost) {
     EXPECT_LE((q_w_cost - q).norm(), (q_no_cost - q).norm());
   }
 }
+
+TEST_F(KukaTest, ReuseForNearbyQueries) {
+  // Solve two nearby queries with the same GlobalInverseKinematics object.
+  // The second query only updates the existing constraints and cost.
+  const auto& joint_lb = plant_->GetPositionLowerLimits();
+  const auto& joint_ub = plant_->GetPositionUpperLimits();
+  DRAKE_DEMAND(plant_->num_positions() == 7);
+  Eigen::Matrix<double, 7, 1> q1 = joint_lb;
+  for (int i = 0; i < 7; ++i) {
+    q1(i) += (joint_ub(i) - joint_lb(i)) * i / 10.0;
+  }
+  Eigen::Matrix<double, 7, 1> q2 = q1;
+  q2(0) += 0.05;
+  q2(3) -= 0.05;
+  auto context = plant_->CreateDefaultContext();
+  auto ee_pose = [&](const Eigen::VectorXd& q) {
+    plant_->SetPositions(context.get(), q);
+    return plant_->CalcRelativeTransform(
+        *context, plant_->world_frame(),
+        plant_->get_body(BodyIndex{ee_idx_}).body_frame());
+  };
+
+  const Eigen::VectorXd body_cost =
+      Eigen::VectorXd::Constant(plant_->num_bodies(), 1);
+  EXPECT_THROW(global_ik_.UpdatePostureCost(q1, body_cost, body_cost),
+               std::runtime_error);
+
+  const math::RigidTransformd X_WE1 = ee_pose(q1);
+  auto position_constraint = global_ik_.AddWorldPositionConstraint(
+      ee_idx_, Vector3d::Zero(), X_WE1.translation(), X_WE1.translation());
+  global_ik_.AddPostureCost(q1, body_cost, body_cost);
+
+  const int num_vars = global_ik_.prog().num_vars();
+  const int num_costs = global_ik_.prog().GetAllCosts().size();
+  const int num_constraints = global_ik_.prog().GetAllConstraints().size();
+
+  solvers::GurobiSolver gurobi_solver;
+  solvers::MathematicalProgramResult result;
+  if (gurobi_solver.available()) {
+    result = gurobi_solver.Solve(global_ik_.prog(), {}, {});
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(CompareMatrices(
+        global_ik_.ReconstructGeneralizedPositionSolution(result), q1, 1E-2,
+        MatrixCompareType::absolute));
+  }
+
+  // Move to the second query in place.
+  const math::RigidTransformd X_WE2 = ee_pose(q2);
+  position_constraint.evaluator()->set_bounds(X_WE2.translation(),
+                                              X_WE2.translation());
+  global_ik_.UpdatePostureCost(q2, body_cost, body_cost);
+  EXPECT_EQ(global_ik_.prog().num_vars(), num_vars);
+  EXPECT_EQ(global_ik_.prog().GetAllCosts().size(), num_costs);
+  EXPECT_EQ(global_ik_.prog().GetAllConstraints().size(), num_constraints);
+
+  if (gurobi_solver.available()) {
+    global_ik_.SetInitialGuessFromSolution(result);
+    EXPECT_TRUE(CompareMatrices(global_ik_.prog().initial_guess(),
+                                result.get_x_val()));
+    result = gurobi_solver.Solve(global_ik_.prog(), {}, {});
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(CompareMatrices(
+        global_ik_.ReconstructGeneralizedPositionSolution(result), q2, 1E-2,
+        MatrixCompareType::absolute));
+  }
+}
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -0,0 +1,117 @@
+#include "drake/multibody/inverse_kinematics/kinematic_constraint_utilities.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+GTEST_TEST(KinematicConstraintUtilitiesTest, AreAutoDiffVecXdEqual) {
+  AutoDiffVecXd a(2);
+  a(0) = AutoDiffXd(1.0, Vector2d(1.0, 2.0));
+  a(1) = AutoDiffXd(2.0, Vector2d(3.0, 4.0));
+  AutoDiffVecXd b = a;
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(a, b));
+
+  // Different values.
+  b(1).value() = 3.0;
+  EXPECT_FALSE(AreAutoDiffVecXdEqual(a, b));
+
+  // Different derivatives.
+  b = a;
+  b(1).derivatives()(1) = 5.0;
+  EXPECT_FALSE(AreAutoDiffVecXdEqual(a, b));
+
+  // Different sizes.
+  EXPECT_FALSE(AreAutoDiffVecXdEqual(a, b.head(1)));
+
+  // An empty derivatives vector equals a vector of zeros of the same size as
+  // the other entries' derivatives, as in math::autoDiffToGradientMatrix().
+  a(1).derivatives() = Vector2d::Zero();
+  b = a;
+  b(1).derivatives().resize(0);
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(a, b));
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(b, a));
+  a(1).derivatives() = Vector2d(0.0, 1.0);
+  EXPECT_FALSE(AreAutoDiffVecXdEqual(a, b));
+  EXPECT_FALSE(AreAutoDiffVecXdEqual(b, a));
+
+  // The gradient matrices have a different number of columns.
+  a = AutoDiffVecXd::Zero(2);
+  b = AutoDiffVecXd::Zero(2);
+  a(0).derivatives() = Vector2d::Zero();
+  EXPECT_FALSE(AreAutoDiffVecXdEqual(a, b));
+}
+
+// The comparison is performed on every constraint evaluation and must not
+// allocate.
+GTEST_TEST(KinematicConstraintUtilitiesTest, AreAutoDiffVecXdEqualNoHeap) {
+  const AutoDiffVecXd a =
+      math::initializeAutoDiff(VectorXd::LinSpaced(7, 0.0, 1.0));
+  const AutoDiffVecXd b = a;
+  test::LimitMalloc guard;
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(a, b));
+}
+
+GTEST_TEST(KinematicConstraintUtilitiesTest,
+           ReuseContextDerivativesIfSameValues) {
+  const AutoDiffVecXd x_context =
+      math::initializeAutoDiff(Eigen::Vector3d(1.0, 2.0, 3.0));
+  // As in x.cast<AutoDiffXd>(), the derivatives are empty.
+  AutoDiffVecXd x = VectorXd::LinSpaced(5, 0.0, 4.0).cast<AutoDiffXd>();
+
+  // Different values leave x unchanged.
+  EXPECT_FALSE(ReuseContextDerivativesIfSameValues(x_context, x.head(3)));
+  EXPECT_EQ(x(1).value(), 1.0);
+  EXPECT_EQ(x(1).derivatives().size(), 0);
+
+  // Same values adopt the derivatives in x_context.
+  EXPECT_TRUE(ReuseContextDerivativesIfSameValues(x_context, x.segment(1, 3)));
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(x.segment(1, 3), x_context));
+  EXPECT_EQ(x(0).derivatives().size(), 0);
+  EXPECT_EQ(x(4).derivatives().size(), 0);
+
+  // Different sizes.
+  EXPECT_FALSE(ReuseContextDerivativesIfSameValues(x_context, x.head(2)));
+}
+
+GTEST_TEST(KinematicConstraintUtilitiesTest,
+           UpdateContextPositionsAndVelocities) {
+  const auto plant = ConstructTwoFreeBodiesPlant<AutoDiffXd>();
+  auto context = plant->CreateDefaultContext();
+  const int nq = plant->num_positions();
+  const int nv = plant->num_velocities();
+  const AutoDiffVecXd qv = math::initializeAutoDiff(
+      VectorXd::LinSpaced(nq + nv, 0.1, 1.0));
+  AutoDiffVecXd q = qv.head(nq);
+  AutoDiffVecXd v = qv.tail(nv);
+
+  // Both q and v change.
+  UpdateContextPositionsAndVelocities(context.get(), *plant, q, v);
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(plant->GetPositions(*context), q));
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(plant->GetVelocities(*context), v));
+
+  // Only v changes.
+  v(0).value() = 2.0;
+  UpdateContextPositionsAndVelocities(context.get(), *plant, q, v);
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(plant->GetPositions(*context), q));
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(plant->GetVelocities(*context), v));
+
+  // Only q changes.
+  q(1).derivatives()(0) = 3.0;
+  UpdateContextPositionsAndVelocities(context.get(), *plant, q, v);
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(plant->GetPositions(*context), q));
+  EXPECT_TRUE(AreAutoDiffVecXdEqual(plant->GetVelocities(*context), v));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -157,6 +157,42 @@ TEST_F(TwoFreeSpheresMinimumDistanceTest, QuadraticallySmoothedHingePenalty) {
   CheckConstraintEval(constraint);
 }
 
+TEST_F(TwoFreeSpheresMinimumDistanceTest, ReuseDistanceQuery) {
+  // Evaluating with double and then AutoDiffXd at the same q reuses the
+  // signed distance pairs of the first evaluation. Check against a constraint
+  // that has not evaluated anything yet.
+  const double minimum_distance(0.1);
+  const MinimumDistanceConstraint constraint(plant_double_, minimum_distance,
+                                             plant_context_double_);
+  const MinimumDistanceConstraint fresh_constraint(
+      plant_double_, minimum_distance, plant_context_double_);
+  const Eigen::Vector3d p_WB1(0.1, 0.2, 0.3);
+  auto make_q = [&p_WB1, this](double distance) {
+    const Eigen::Vector3d p_WB2 =
+        p_WB1 + Eigen::Vector3d(1.0 / 3, 2.0 / 3, 2.0 / 3) *
+                    (radius1_ + radius2_ + distance);
+    Eigen::Matrix<double, kNumPositionsForTwoFreeBodies, 1> q;
+    q << 1, 0, 0, 0, p_WB1, 1, 0, 0, 0, p_WB2;
+    return q;
+  };
+  const auto q1 = make_q(0.5 * minimum_distance);
+  const auto q2 = make_q(2 * minimum_distance);
+  Eigen::VectorXd y_double(1);
+  constraint.Eval(q1, &y_double);
+  constraint.Eval(q2, &y_double);
+  for (const auto& q : {q2, q1}) {
+    const Eigen::Matrix<AutoDiffXd, kNumPositionsForTwoFreeBodies, 1>
+        q_autodiff = math::initializeAutoDiff(q);
+    AutoDiffVecXd y_autodiff(1);
+    constraint.Eval(q_autodiff, &y_autodiff);
+    AutoDiffVecXd y_autodiff_expected(1);
+    fresh_constraint.Eval(q_autodiff, &y_autodiff_expected);
+    EXPECT_EQ(y_autodiff(0).value(), y_autodiff_expected(0).value());
+    EXPECT_TRUE(CompareMatrices(y_autodiff(0).derivatives(),
+                                y_autodiff_expected(0).derivatives()));
+  }
+}
+
 GTEST_TEST(MinimumDistanceConstraintTest,
            MultibodyPlantWithouthGeometrySource) {
   auto plant = ConstructTwoFreeBodiesPlant<double>();
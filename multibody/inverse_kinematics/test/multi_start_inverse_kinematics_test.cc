@@ -0,0 +1,121 @@
+#include "drake/multibody/inverse_kinematics/multi_start_inverse_kinematics.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+class MultiStartInverseKinematicsTest : public ::testing::Test {
+ public:
+  MultiStartInverseKinematicsTest()
+      : plant_(ConstructIiwaPlant(
+            FindResourceOrThrow("drake/manipulation/models/iiwa_description/"
+                                "sdf/iiwa14_no_collision.sdf"),
+            0.01)),
+        ee_frame_(plant_->GetFrameByName("iiwa_link_7")) {
+    // Ask the end effector to reach the position it has at q_target.
+    Eigen::VectorXd q_target(7);
+    q_target << 0.3, 0.5, -0.2, -1.2, 0.1, 0.4, 0;
+    auto context = plant_->CreateDefaultContext();
+    plant_->SetPositions(context.get(), q_target);
+    plant_->CalcPointsPositions(*context, ee_frame_, Eigen::Vector3d::Zero(),
+                                plant_->world_frame(), &p_WE_);
+
+    const Eigen::VectorXd lower = plant_->GetPositionLowerLimits();
+    const Eigen::VectorXd upper = plant_->GetPositionUpperLimits();
+    for (double ratio : {0.5, 0.2, 0.8, 0.35}) {
+      q_seeds_.push_back(lower + ratio * (upper - lower));
+    }
+  }
+
+  void AddConstraints(InverseKinematics* ik) const {
+    ik->AddPositionConstraint(ee_frame_, Eigen::Vector3d::Zero(),
+                              plant_->world_frame(), p_WE_, p_WE_);
+    ik->get_mutable_prog()->AddQuadraticErrorCost(
+        Eigen::MatrixXd::Identity(7, 7), Eigen::VectorXd::Zero(7), ik->q());
+  }
+
+  void CheckSolution(const MultiStartInverseKinematicsSolution& solution) {
+    auto context = plant_->CreateDefaultContext();
+    plant_->SetPositions(context.get(), solution.q);
+    Eigen::Vector3d p_WE;
+    plant_->CalcPointsPositions(*context, ee_frame_, Eigen::Vector3d::Zero(),
+                                plant_->world_frame(), &p_WE);
+    EXPECT_TRUE(CompareMatrices(p_WE, p_WE_, 1E-5));
+  }
+
+ protected:
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  const Frame<double>& ee_frame_;
+  Eigen::Vector3d p_WE_;
+  std::vector<Eigen::VectorXd> q_seeds_;
+};
+
+TEST_F(MultiStartInverseKinematicsTest, RankedSolutions) {
+  auto add_constraints = [this](InverseKinematics* ik) {
+    AddConstraints(ik);
+  };
+  for (int num_threads : {1, 3}) {
+    MultiStartInverseKinematicsOptions options;
+    options.num_threads = num_threads;
+    const auto solutions = SolveMultiStartInverseKinematics(
+        *plant_, add_constraints, q_seeds_, options);
+    ASSERT_EQ(solutions.size(), q_seeds_.size());
+    ASSERT_TRUE(solutions[0].result.is_success());
+    std::vector<bool> seed_solved(q_seeds_.size(), false);
+    for (int i = 0; i < static_cast<int>(solutions.size()); ++i) {
+      seed_solved[solutions[i].seed_index] = true;
+      if (!solutions[i].result.is_success()) {
+        continue;
+      }
+      CheckSolution(solutions[i]);
+      if (i > 0) {
+        EXPECT_TRUE(solutions[i - 1].result.is_success());
+        EXPECT_LE(solutions[i - 1].result.get_optimal_cost(),
+                  solutions[i].result.get_optimal_cost());
+      }
+    }
+    for (bool solved : seed_solved) {
+      EXPECT_TRUE(solved);
+    }
+  }
+}
+
+TEST_F(MultiStartInverseKinematicsTest, StopAtFirstSuccess) {
+  MultiStartInverseKinematicsOptions options;
+  options.stop_at_first_success = true;
+  const auto solutions = SolveMultiStartInverseKinematics(
+      *plant_, [this](InverseKinematics* ik) { AddConstraints(ik); },
+      q_seeds_, options);
+  ASSERT_FALSE(solutions.empty());
+  ASSERT_TRUE(solutions[0].result.is_success());
+  CheckSolution(solutions[0]);
+  // With a single thread, no seed is solved after the first success.
+  int num_success = 0;
+  for (const auto& solution : solutions) {
+    num_success += solution.result.is_success();
+  }
+  EXPECT_EQ(num_success, 1);
+  EXPECT_LE(solutions.size(), q_seeds_.size());
+}
+
+TEST_F(MultiStartInverseKinematicsTest, BadArguments) {
+  auto add_constraints = [this](InverseKinematics* ik) {
+    AddConstraints(ik);
+  };
+  EXPECT_THROW(SolveMultiStartInverseKinematics(*plant_, add_constraints,
+                                                {Eigen::VectorXd::Zero(6)}),
+               std::runtime_error);
+  MultiStartInverseKinematicsOptions options;
+  options.num_threads = 0;
+  EXPECT_THROW(SolveMultiStartInverseKinematics(*plant_, add_constraints,
+                                                q_seeds_, options),
+               std::runtime_error);
+}
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
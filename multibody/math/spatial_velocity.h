@@ -159,6 +159,63 @@ class SpatialVelocity : public SpatialVector<SpatialVelocity, T> {
     return SpatialVelocity<T>(*this).ShiftInPlace(p_BpBq_E);
   }
 
+  /// Performs a rigid in-place shift of each column of 6 x n matrix
+  /// `V_ABp_E_all` as if each column were a %SpatialVelocity. The spatial
+  /// velocities are those of a frame B at a point P of B, and we shift them
+  /// to point Q of B by modifying the translational velocity appropriately
+  /// (angular velocities are unchanged). Hence on output the matrix should be
+  /// renamed V_ABq_E_all (conceptually). The first three elements of each
+  /// column must store the angular (rotational) component while the last
+  /// three elements store the translational component. All quantities are
+  /// expressed in the same common frame E.
+  ///
+  /// All columns are shifted at once with a single column-wise cross product,
+  /// which is cheaper than shifting each column as a separate
+  /// %SpatialVelocity, e.g. when shifting the columns of a Jacobian.
+  ///
+  /// @param[in,out] V_ABp_E_all
+  ///   A 6 x n matrix of spatial velocities at point Bp on input, shifted to
+  ///   point Bq on output.
+  /// @param[in] p_BpBq_E
+  ///   The vector from point Bp to point Bq.
+  ///
+  /// @pre Columns are spatial velocities with angular velocity first, then
+  ///   translational velocity.
+  /// @see ShiftInPlace(const Vector3<T>&) for details.
+  static void ShiftInPlace(EigenPtr<Matrix6X<T>> V_ABp_E_all,
+                           const Vector3<T>& p_BpBq_E) {
+    DRAKE_ASSERT(V_ABp_E_all != nullptr);  // ASSERT because inner loop method.
+    V_ABp_E_all->template bottomRows<3>() +=
+        V_ABp_E_all->template topRows<3>().colwise().cross(p_BpBq_E);
+    // V_ABp_E_all should now be called V_ABq_E_all.
+  }
+
+  /// Performs a rigid shift of each column of 6 x n matrix `V_ABp_E_all` into
+  /// `V_ABq_E_all` as if each column were a %SpatialVelocity. See
+  /// ShiftInPlace(EigenPtr<Matrix6X<T>>, const Vector3<T>&) for details.
+  ///
+  /// @param[in] V_ABp_E_all
+  ///   A 6 x n matrix of spatial velocities of frame B at point Bp.
+  /// @param[in] p_BpBq_E
+  ///   The vector from point Bp to point Bq.
+  /// @param[out] V_ABq_E_all
+  ///   A 6 x n matrix of spatial velocities shifted from Bp to Bq.
+  ///
+  /// @pre Columns are spatial velocities with angular velocity first, then
+  ///   translational velocity.
+  /// @pre V_ABq_E_all must be non-null and point to a 6 x n matrix (same size
+  ///   as the input matrix).
+  static void Shift(const Eigen::Ref<const Matrix6X<T>>& V_ABp_E_all,
+                    const Vector3<T>& p_BpBq_E,
+                    EigenPtr<Matrix6X<T>> V_ABq_E_all) {
+    DRAKE_DEMAND(V_ABq_E_all != nullptr);
+    DRAKE_DEMAND(V_ABq_E_all->cols() == V_ABp_E_all.cols());
+    V_ABq_E_all->template topRows<3>() = V_ABp_E_all.template topRows<3>();
+    V_ABq_E_all->template bottomRows<3>() =
+        V_ABp_E_all.template bottomRows<3>() +
+        V_ABp_E_all.template topRows<3>().colwise().cross(p_BpBq_E);
+  }
+
   /// This method composes `this` spatial velocity `V_WP` of a frame P measured
   /// in a frame W, with that of a third frame B moving in P with spatial
   /// velocity `V_PB`. The result is the spatial velocity `V_WB` of frame B
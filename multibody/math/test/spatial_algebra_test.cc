@@ -453,6 +453,26 @@ TYPED_TEST(SpatialVelocityTest, ShiftOperation) {
   // Verify the result: V_XZ = V_XYz + V_YZ = V_XY.Shift(p_YZ) + V_YZ
   SpatialVelocity<T> expected_V_XZ_A = expected_V_XYz_A + V_YZ_A;
   EXPECT_TRUE(V_XZ_A.IsApprox(expected_V_XZ_A));
+
+  // Shift a matrix storing a spatial velocity in each column, first with the
+  // not-in-place Shift() method.
+  constexpr int num_velocities = 3;
+  Matrix6X<T> Vmatrix_XY_A(6, num_velocities);
+  Vmatrix_XY_A.col(0) = V_XY_A.get_coeffs();
+  Vmatrix_XY_A.col(1) = V_YZ_A.get_coeffs();
+  Vmatrix_XY_A.col(2) = (V_XY_A + V_YZ_A).get_coeffs();
+  Eigen::Matrix<T, 6, num_velocities> Vmatrix_XYz_A;
+  SpatialVelocity<T>::Shift(Vmatrix_XY_A, p_YZ_A, &Vmatrix_XYz_A);
+  for (int j = 0; j < num_velocities; ++j) {
+    const SpatialVelocity<T> Vj_XY_A(Vmatrix_XY_A.col(j));
+    const SpatialVelocity<T> Vj_XYz_A(Vmatrix_XYz_A.col(j));
+    EXPECT_TRUE(Vj_XYz_A.IsApprox(Vj_XY_A.Shift(p_YZ_A)));
+  }
+
+  // Now shift it back using the ShiftInPlace() method.
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  SpatialVelocity<T>::ShiftInPlace(&Vmatrix_XYz_A, -p_YZ_A);
+  EXPECT_TRUE(CompareMatrices(Vmatrix_XYz_A, Vmatrix_XY_A, kTolerance));
 }
 
 // Tests operator+().
@@ -40,8 +40,17 @@ ManipulatorEquationConstraint::ManipulatorEquationConstraint(
 
 void ManipulatorEquationConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  const int num_positions = plant_->num_positions();
+  const int num_velocities = plant_->num_velocities();
+  AutoDiffVecXd x_autodiff = x.cast<AutoDiffXd>();
+  internal::ReuseContextDerivativesIfSameValues(
+      plant_->GetPositions(*context_),
+      x_autodiff.segment(num_velocities, num_positions));
+  internal::ReuseContextDerivativesIfSameValues(
+      plant_->GetVelocities(*context_),
+      x_autodiff.segment(num_velocities + num_positions, num_velocities));
   AutoDiffVecXd y_autodiff(num_constraints());
-  DoEval(x.cast<AutoDiffXd>(), &y_autodiff);
+  DoEval(x_autodiff, &y_autodiff);
   *y = math::autoDiffToValueMatrix(y_autodiff);
 }
 
@@ -65,16 +74,8 @@ void ManipulatorEquationConstraint::DoEval(
 
   *y = B_actuation_ * u_next;
 
-  // TODO(rcory): Use UpdateContextConfiguration when it supports
-  //  MultibodyPlant<AutoDiffXd> and Context<AutoDiffXd>
-  if (!internal::AreAutoDiffVecXdEqual(q_next,
-                                       plant_->GetPositions(*context_))) {
-    plant_->SetPositions(context_, q_next);
-  }
-  if (!internal::AreAutoDiffVecXdEqual(v_next,
-                                       plant_->GetVelocities(*context_))) {
-    plant_->SetVelocities(context_, v_next);
-  }
+  internal::UpdateContextPositionsAndVelocities(context_, *plant_, q_next,
+                                                v_next);
   *y += plant_->CalcGravityGeneralizedForces(*context_);  // g(q[n+1])
 
   // Calc the bias term C(qₙ₊₁, vₙ₊₁)
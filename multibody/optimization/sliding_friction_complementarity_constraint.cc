@@ -118,8 +118,17 @@ void SlidingFrictionComplementarityNonlinearConstraint::
 
 void SlidingFrictionComplementarityNonlinearConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  const auto& plant = contact_wrench_evaluator_->plant();
+  const systems::Context<AutoDiffXd>& context =
+      contact_wrench_evaluator_->context();
+  AutoDiffVecXd x_autodiff = x.cast<AutoDiffXd>();
+  internal::ReuseContextDerivativesIfSameValues(
+      plant.GetPositions(context), x_autodiff.head(plant.num_positions()));
+  internal::ReuseContextDerivativesIfSameValues(
+      plant.GetVelocities(context),
+      x_autodiff.segment(plant.num_positions(), plant.num_velocities()));
   AutoDiffVecXd y_autodiff;
-  Eval(x.cast<AutoDiffXd>(), &y_autodiff);
+  Eval(x_autodiff, &y_autodiff);
   *y = math::autoDiffToValueMatrix(y_autodiff);
 }
 
@@ -135,12 +144,7 @@ void SlidingFrictionComplementarityNonlinearConstraint::DoEval(
   systems::Context<AutoDiffXd>& context =
       const_cast<systems::Context<AutoDiffXd>&>(
           contact_wrench_evaluator_->context());
-  if (!internal::AreAutoDiffVecXdEqual(q, plant.GetPositions(context))) {
-    plant.SetPositions(&context, q);
-  }
-  if (!internal::AreAutoDiffVecXdEqual(v, plant.GetVelocities(context))) {
-    plant.SetVelocities(&context, v);
-  }
+  internal::UpdateContextPositionsAndVelocities(&context, plant, q, v);
 
   // Compute the contact wrench F_AB_W
   AutoDiffVecXd F_AB_W;
@@ -36,8 +36,12 @@ StaticEquilibriumConstraint::StaticEquilibriumConstraint(
 
 void StaticEquilibriumConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  AutoDiffVecXd x_autodiff = x.cast<AutoDiffXd>();
+  internal::ReuseContextDerivativesIfSameValues(
+      plant_->GetPositions(*context_),
+      x_autodiff.head(plant_->num_positions()));
   AutoDiffVecXd y_autodiff(num_constraints());
-  DoEval(x.cast<AutoDiffXd>(), &y_autodiff);
+  DoEval(x_autodiff, &y_autodiff);
   *y = math::autoDiffToValueMatrix(y_autodiff);
 }
 
@@ -47,11 +51,7 @@ void StaticEquilibriumConstraint::DoEval(
   const auto& u =
       x.segment(plant_->num_positions(), plant_->num_actuated_dofs());
   *y = B_actuation_ * u;
-  // TODO(hongkai.dai): Use UpdateContextConfiguration when it supports
-  // MultibodyPlant<AutoDiffXd> and Context<AutoDiffXd>
-  if (!internal::AreAutoDiffVecXdEqual(q, plant_->GetPositions(*context_))) {
-    plant_->SetPositions(context_, q);
-  }
+  internal::UpdateContextConfiguration(context_, *plant_, q);
   *y += plant_->CalcGravityGeneralizedForces(*context_);
   const auto& query_port = plant_->get_geometry_query_input_port();
   if (!query_port.HasValue(*context_)) {
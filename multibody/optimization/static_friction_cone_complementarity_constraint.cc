@@ -50,8 +50,13 @@ StaticFrictionConeComplementarityNonlinearConstraint::MakeBinding(
 
 void StaticFrictionConeComplementarityNonlinearConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  const auto& plant = contact_wrench_evaluator_->plant();
+  AutoDiffVecXd x_autodiff = x.cast<AutoDiffXd>();
+  internal::ReuseContextDerivativesIfSameValues(
+      plant.GetPositions(contact_wrench_evaluator_->context()),
+      x_autodiff.head(plant.num_positions()));
   AutoDiffVecXd y_autodiff(num_constraints());
-  DoEval(x.cast<AutoDiffXd>(), &y_autodiff);
+  DoEval(x_autodiff, &y_autodiff);
   *y = math::autoDiffToValueMatrix(y_autodiff);
 }
 
@@ -73,9 +78,7 @@ void StaticFrictionConeComplementarityNonlinearConstraint::DoEval(
       // context, this const_cast wouldn't be necessary.
       const_cast<systems::Context<AutoDiffXd>&>(
           contact_wrench_evaluator_->context());
-  if (!internal::AreAutoDiffVecXdEqual(q, plant.GetPositions(context))) {
-    plant.SetPositions(&context, q);
-  }
+  internal::UpdateContextConfiguration(&context, plant, q);
 
   // Compute the contact wrench F_AB_W
   AutoDiffVecXd F_AB_W;
@@ -20,8 +20,13 @@ StaticFrictionConeConstraint::StaticFrictionConeConstraint(
 
 void StaticFrictionConeConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  const auto& plant = contact_wrench_evaluator_->plant();
+  AutoDiffVecXd x_autodiff = x.cast<AutoDiffXd>();
+  internal::ReuseContextDerivativesIfSameValues(
+      plant.GetPositions(contact_wrench_evaluator_->context()),
+      x_autodiff.head(plant.num_positions()));
   AutoDiffVecXd y_autodiff(num_constraints());
-  DoEval(x.cast<AutoDiffXd>(), &y_autodiff);
+  DoEval(x_autodiff, &y_autodiff);
   *y = math::autoDiffToValueMatrix(y_autodiff);
 }
 
@@ -35,9 +40,7 @@ void StaticFrictionConeConstraint::DoEval(
   systems::Context<AutoDiffXd>& context =
       const_cast<systems::Context<AutoDiffXd>&>(
           contact_wrench_evaluator_->context());
-  if (!internal::AreAutoDiffVecXdEqual(q, plant.GetPositions(context))) {
-    plant.SetPositions(&context, q);
-  }
+  internal::UpdateContextConfiguration(&context, plant, q);
   // Compute the contact wrench F_Cb_W = [τ; f] where we only enforce
   // constraints on f
   AutoDiffVecXd F_Cb_W;
@@ -40,6 +40,12 @@ using math::RigidTransformd;
 using math::RotationMatrixd;
 using std::unique_ptr;
 
+struct SdfFileCache::Entry {
+  sdf::Root root;
+  // The directory holding the file, see LoadSdf().
+  std::string root_dir;
+};
+
 // Unnamed namespace for free functions local to this file.
 namespace {
 // Given an ignition::math::Inertial object, extract a RotationalInertia object
@@ -452,6 +458,21 @@ std::string LoadSdf(
   return root_dir;
 }
 
+// Returns the sdf::Root for `data_source`. When `data_source` is a file and
+// `cache` is non-null, the root is looked up in (or added to) `cache`;
+// otherwise it is loaded into `storage`. Sets `root_dir` as LoadSdf() above.
+const sdf::Root& LoadSdf(
+    const DataSource& data_source, SdfFileCache* cache,
+    sdf::Root* storage, std::string* root_dir) {
+  if (cache != nullptr && data_source.file_name) {
+    const SdfFileCache::Entry& entry = cache->Load(*data_source.file_name);
+    *root_dir = entry.root_dir;
+    return entry.root;
+  }
+  *root_dir = LoadSdf(storage, data_source);
+  return *storage;
+}
+
 struct LinkInfo {
   const RigidBody<double>* body{};
   RigidTransformd X_WL;
@@ -795,13 +816,15 @@ ModelInstanceIndex AddModelFromSdf(
     const std::string& model_name_in,
     const PackageMap& package_map,
     MultibodyPlant<double>* plant,
-    geometry::SceneGraph<double>* scene_graph) {
+    geometry::SceneGraph<double>* scene_graph,
+    SdfFileCache* cache) {
   DRAKE_THROW_UNLESS(plant != nullptr);
   DRAKE_THROW_UNLESS(!plant->is_finalized());
 
-  sdf::Root root;
-
-  std::string root_dir = LoadSdf(&root, data_source);
+  sdf::Root uncached_root;
+  std::string root_dir;
+  const sdf::Root& root =
+      LoadSdf(data_source, cache, &uncached_root, &root_dir);
 
   if (root.ModelCount() != 1) {
     throw std::runtime_error("File must have a single <model> element.");
@@ -825,13 +848,15 @@ std::vector<ModelInstanceIndex> AddModelsFromSdf(
     const DataSource& data_source,
     const PackageMap& package_map,
     MultibodyPlant<double>* plant,
-    geometry::SceneGraph<double>* scene_graph) {
+    geometry::SceneGraph<double>* scene_graph,
+    SdfFileCache* cache) {
   DRAKE_THROW_UNLESS(plant != nullptr);
   DRAKE_THROW_UNLESS(!plant->is_finalized());
 
-  sdf::Root root;
-
-  std::string root_dir = LoadSdf(&root, data_source);
+  sdf::Root uncached_root;
+  std::string root_dir;
+  const sdf::Root& root =
+      LoadSdf(data_source, cache, &uncached_root, &root_dir);
 
   // Throw an error if there are no models or worlds.
   if (root.ModelCount() == 0 && root.WorldCount() == 0) {
@@ -892,6 +917,23 @@ std::vector<ModelInstanceIndex> AddModelsFromSdf(
   return model_instances;
 }
 
+SdfFileCache::SdfFileCache() = default;
+
+SdfFileCache::~SdfFileCache() = default;
+
+const SdfFileCache::Entry& SdfFileCache::Load(const std::string& file_name) {
+  const std::string full_path = GetFullPath(file_name);
+  std::unique_ptr<Entry>& entry = entries_[full_path];
+  if (entry == nullptr) {
+    auto new_entry = std::make_unique<Entry>();
+    DataSource data_source;
+    data_source.file_name = &full_path;
+    new_entry->root_dir = LoadSdf(&new_entry->root, data_source);
+    entry = std::move(new_entry);
+  }
+  return *entry;
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "drake/common/drake_copyable.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/package_map.h"
@@ -13,6 +16,31 @@ namespace drake {
 namespace multibody {
 namespace internal {
 
+/// Retains the parsed SDF files, keyed by their full path, so that a file that
+/// is added more than once (e.g., for many instances of the same object) is
+/// only loaded and validated once. The files are assumed to not change for the
+/// lifetime of the cache.
+class SdfFileCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SdfFileCache)
+
+  SdfFileCache();
+  ~SdfFileCache();
+
+  /// The parsed contents of a file (defined in detail_sdf_parser.cc, so that
+  /// this header does not depend on sdformat).
+  struct Entry;
+
+  /// Returns the parsed contents of the file `file_name`, loading it upon
+  /// first use.
+  /// @throws std::runtime_error if the file is not in accordance with the SDF
+  /// specification.
+  const Entry& Load(const std::string& file_name);
+
+ private:
+  std::map<std::string, std::unique_ptr<Entry>> entries_;
+};
+
 /// Parses a `<model>` element from the SDF file specified by `file_name` and
 /// adds it to `plant`. The SDF file can only contain a single `<model>`
 /// element. `<world>` elements (used for instance to specify gravity) are
@@ -39,13 +67,17 @@ namespace internal {
 /// @param scene_graph
 ///   A pointer to a mutable SceneGraph object used for geometry registration
 ///   (either to model visual or contact geometry).  May be nullptr.
+/// @param cache
+///   If non-null and `data_source` is a file, the cache that is used to look
+///   up (or retain) the parsed file.
 /// @returns The model instance index for the newly added model.
 ModelInstanceIndex AddModelFromSdf(
     const DataSource& data_source,
     const std::string& model_name,
     const PackageMap& package_map,
     MultibodyPlant<double>* plant,
-    geometry::SceneGraph<double>* scene_graph = nullptr);
+    geometry::SceneGraph<double>* scene_graph = nullptr,
+    SdfFileCache* cache = nullptr);
 
 /// Parses all `<model>` elements from the SDF file specified by `file_name`
 /// and adds them to `plant`. The SDF file can contain multiple `<model>`
@@ -69,12 +101,16 @@ ModelInstanceIndex AddModelFromSdf(
 /// @param scene_graph
 ///   A pointer to a mutable SceneGraph object used for geometry registration
 ///   (either to model visual or contact geometry).  May be nullptr.
+/// @param cache
+///   If non-null and `data_source` is a file, the cache that is used to look
+///   up (or retain) the parsed file.
 /// @returns The set of model instance indices for the newly added models.
 std::vector<ModelInstanceIndex> AddModelsFromSdf(
     const DataSource& data_source,
     const PackageMap& package_map,
     MultibodyPlant<double>* plant,
-    geometry::SceneGraph<double>* scene_graph = nullptr);
+    geometry::SceneGraph<double>* scene_graph = nullptr,
+    SdfFileCache* cache = nullptr);
 
 }  // namespace internal
 }  // namespace multibody
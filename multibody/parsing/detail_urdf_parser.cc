@@ -739,26 +739,16 @@ ModelInstanceIndex ParseUrdf(
   return model_instance;
 }
 
-}  // namespace
-
-ModelInstanceIndex AddModelFromUrdf(
-    const DataSource& data_source,
-    const std::string& model_name_in,
-    const PackageMap& package_map,
-    MultibodyPlant<double>* plant,
-    geometry::SceneGraph<double>* scene_graph) {
-  DRAKE_THROW_UNLESS(plant != nullptr);
-  DRAKE_THROW_UNLESS(!plant->is_finalized());
-  data_source.DemandExactlyOne();
-
+// Opens the URDF file or string of `data_source` and feeds it into the XML
+// parser. Returns the directory in which to search for files referenced within
+// the URDF.
+std::string LoadUrdf(XMLDocument* xml_doc, const DataSource& data_source) {
   // When the data_source is a filename, we'll use its parent directory to be
   // the root directory to search for files referenced within the URDF file.
   // If data_source is a string, this will remain unset and relative-path
   // resources that would otherwise require a root directory will not be found.
   std::string root_dir;
 
-  // Opens the URDF file and feeds it into the XML parser.
-  XMLDocument xml_doc;
   if (data_source.file_name) {
     const std::string full_path = GetFullPath(*data_source.file_name);
     size_t found = full_path.find_last_of("/\\");
@@ -769,28 +759,77 @@ ModelInstanceIndex AddModelFromUrdf(
       // using drake::filesystem for path manipulation, not string searching.
       root_dir = ".";
     }
-    xml_doc.LoadFile(full_path.c_str());
-    if (xml_doc.ErrorID()) {
+    xml_doc->LoadFile(full_path.c_str());
+    if (xml_doc->ErrorID()) {
       throw std::runtime_error(fmt::format(
           "Failed to parse XML file {}:\n{}",
-          full_path, xml_doc.ErrorName()));
+          full_path, xml_doc->ErrorName()));
     }
   } else {
     DRAKE_DEMAND(data_source.file_contents);
-    xml_doc.Parse(data_source.file_contents->c_str());
-    if (xml_doc.ErrorID()) {
+    xml_doc->Parse(data_source.file_contents->c_str());
+    if (xml_doc->ErrorID()) {
       throw std::runtime_error(fmt::format(
           "Failed to parse XML string: {}",
-          xml_doc.ErrorName()));
+          xml_doc->ErrorName()));
     }
   }
+  return root_dir;
+}
+
+}  // namespace
+
+struct UrdfFileCache::Entry {
+  XMLDocument xml_doc;
+  // The directory holding the file, see LoadUrdf().
+  std::string root_dir;
+};
+
+ModelInstanceIndex AddModelFromUrdf(
+    const DataSource& data_source,
+    const std::string& model_name_in,
+    const PackageMap& package_map,
+    MultibodyPlant<double>* plant,
+    geometry::SceneGraph<double>* scene_graph,
+    UrdfFileCache* cache) {
+  DRAKE_THROW_UNLESS(plant != nullptr);
+  DRAKE_THROW_UNLESS(!plant->is_finalized());
+  data_source.DemandExactlyOne();
+
+  XMLDocument uncached_xml_doc;
+  XMLDocument* xml_doc = &uncached_xml_doc;
+  std::string root_dir;
+  if (cache != nullptr && data_source.file_name) {
+    UrdfFileCache::Entry& entry = cache->Load(*data_source.file_name);
+    xml_doc = &entry.xml_doc;
+    root_dir = entry.root_dir;
+  } else {
+    root_dir = LoadUrdf(&uncached_xml_doc, data_source);
+  }
 
   if (scene_graph != nullptr && !plant->geometry_source_is_registered()) {
     plant->RegisterAsSourceForSceneGraph(scene_graph);
   }
 
   return ParseUrdf(model_name_in, package_map, root_dir,
-                   &xml_doc, plant);
+                   xml_doc, plant);
+}
+
+UrdfFileCache::UrdfFileCache() = default;
+
+UrdfFileCache::~UrdfFileCache() = default;
+
+UrdfFileCache::Entry& UrdfFileCache::Load(const std::string& file_name) {
+  const std::string full_path = GetFullPath(file_name);
+  std::unique_ptr<Entry>& entry = entries_[full_path];
+  if (entry == nullptr) {
+    auto new_entry = std::make_unique<Entry>();
+    DataSource data_source;
+    data_source.file_name = &full_path;
+    new_entry->root_dir = LoadUrdf(&new_entry->xml_doc, data_source);
+    entry = std::move(new_entry);
+  }
+  return *entry;
 }
 
 }  // namespace internal
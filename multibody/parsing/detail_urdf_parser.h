@@ -1,7 +1,10 @@
 #pragma once
 
+#include <map>
+#include <memory>
 #include <string>
 
+#include "drake/common/drake_copyable.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/package_map.h"
@@ -12,6 +15,30 @@ namespace drake {
 namespace multibody {
 namespace internal {
 
+/// Retains the parsed URDF files, keyed by their full path, so that a file
+/// that is added more than once (e.g., for many instances of the same object)
+/// is only read and parsed once. The files are assumed to not change for the
+/// lifetime of the cache.
+class UrdfFileCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(UrdfFileCache)
+
+  UrdfFileCache();
+  ~UrdfFileCache();
+
+  /// The parsed contents of a file (defined in detail_urdf_parser.cc, so that
+  /// this header does not depend on tinyxml2).
+  struct Entry;
+
+  /// Returns the parsed contents of the file `file_name`, loading it upon
+  /// first use.
+  /// @throws std::runtime_error if the file is not valid XML.
+  Entry& Load(const std::string& file_name);
+
+ private:
+  std::map<std::string, std::unique_ptr<Entry>> entries_;
+};
+
 /// Parses a `<robot>` element from the URDF file specified by @p file_name and
 /// adds it to @p plant.  A new model instance will be added to @p plant.
 ///
@@ -30,13 +57,17 @@ namespace internal {
 /// @param scene_graph
 ///   A pointer to a mutable SceneGraph object used for geometry registration
 ///   (either to model visual or contact geometry).  May be nullptr.
+/// @param cache
+///   If non-null and `data_source` is a file, the cache that is used to look
+///   up (or retain) the parsed file.
 /// @returns The model instance index for the newly added model.
 ModelInstanceIndex AddModelFromUrdf(
     const DataSource& data_source,
     const std::string& model_name,
     const PackageMap& package_map,
     MultibodyPlant<double>* plant,
-    geometry::SceneGraph<double>* scene_graph = nullptr);
+    geometry::SceneGraph<double>* scene_graph = nullptr,
+    UrdfFileCache* cache = nullptr);
 
 }  // namespace internal
 }  // namespace multibody
@@ -150,6 +150,12 @@ void PackageMap::PopulateUpstreamToDrakeHelper(
     return;
   }
 
+  // If this directory (and therefore all of its parents) was already searched,
+  // then there is nothing new to add.
+  if (!upstream_searched_directories_.insert(directory).second) {
+    return;
+  }
+
   // If there is a new package.xml file, then add it.
   if (auto filename = GetPackageXmlFile(directory)) {
     const string package_name = GetPackageName(filename->string());
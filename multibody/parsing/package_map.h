@@ -1,6 +1,7 @@
 #pragma once
 
 #include <map>
+#include <set>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -61,6 +62,11 @@ class PackageMap {
   /// `package.xml` files. If @p model_file is not in `drake`, this
   /// method returns without doing anything.
   ///
+  /// Each directory is only searched once per PackageMap, so that repeated
+  /// calls for models in the same directory tree (as when loading many models
+  /// of the same package) don't repeatedly crawl and parse the same
+  /// `package.xml` files.
+  ///
   /// @param[in] model_file The model file whose directory is the start of the
   /// search for `package.xml` files. This file must be an SDF or URDF file.
   void PopulateUpstreamToDrake(const std::string& model_file);
@@ -95,6 +101,11 @@ class PackageMap {
   // The key is the name of a ROS package and the value is the package's
   // directory.
   std::map<std::string, std::string> map_;
+
+  // The directories already searched by PopulateUpstreamToDrakeHelper(). Since
+  // the search continues up to the drake root, the parents of a searched
+  // directory have been searched as well.
+  std::set<std::string> upstream_searched_directories_;
 };
 
 }  // namespace multibody
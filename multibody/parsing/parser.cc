@@ -16,10 +16,14 @@ using internal::DataSource;
 Parser::Parser(
     MultibodyPlant<double>* plant,
     geometry::SceneGraph<double>* scene_graph)
-    : plant_(plant), scene_graph_(scene_graph) {
+    : plant_(plant), scene_graph_(scene_graph),
+      sdf_cache_(std::make_unique<internal::SdfFileCache>()),
+      urdf_cache_(std::make_unique<internal::UrdfFileCache>()) {
   DRAKE_THROW_UNLESS(plant != nullptr);
 }
 
+Parser::~Parser() = default;
+
 namespace {
 enum class FileType { kSdf, kUrdf };
 FileType DetermineFileType(const std::string& file_name) {
@@ -46,10 +50,11 @@ std::vector<ModelInstanceIndex> Parser::AddAllModelsFromFile(
   const FileType type = DetermineFileType(file_name);
   if (type == FileType::kSdf) {
     return AddModelsFromSdf(
-        data_source, package_map_, plant_, scene_graph_);
+        data_source, package_map_, plant_, scene_graph_, sdf_cache_.get());
   } else {
     return {AddModelFromUrdf(
-        data_source, {}, package_map_, plant_, scene_graph_)};
+        data_source, {}, package_map_, plant_, scene_graph_,
+        urdf_cache_.get())};
   }
 }
 
@@ -64,10 +69,12 @@ ModelInstanceIndex Parser::AddModelFromFile(
   const FileType type = DetermineFileType(file_name);
   if (type == FileType::kSdf) {
     return AddModelFromSdf(
-        data_source, model_name, package_map_, plant_, scene_graph_);
+        data_source, model_name, package_map_, plant_, scene_graph_,
+        sdf_cache_.get());
   } else {
     return AddModelFromUrdf(
-        data_source, model_name, package_map_, plant_, scene_graph_);
+        data_source, model_name, package_map_, plant_, scene_graph_,
+        urdf_cache_.get());
   }
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -10,9 +11,18 @@
 
 namespace drake {
 namespace multibody {
+namespace internal {
+class SdfFileCache;
+class UrdfFileCache;
+}  // namespace internal
 
 /// Parses SDF and URDF input files into a MultibodyPlant and (optionally) a
 /// SceneGraph.
+///
+/// A Parser parses each file only once: adding the same file again (e.g., for
+/// many instances of the same object) reuses the parsed contents of the file.
+/// Therefore, the files should not be modified while they are in use by a
+/// Parser.
 class Parser final {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Parser)
@@ -30,6 +40,8 @@ class Parser final {
     MultibodyPlant<double>* plant,
     geometry::SceneGraph<double>* scene_graph = nullptr);
 
+  ~Parser();
+
   /// Gets a mutable reference to the PackageMap used by this parser.
   PackageMap& package_map() { return package_map_; }
 
@@ -84,6 +96,10 @@ class Parser final {
   PackageMap package_map_;
   MultibodyPlant<double>* const plant_;
   geometry::SceneGraph<double>* const scene_graph_;
+  // The files parsed by this parser, so that adding the same file repeatedly
+  // only parses it once.
+  std::unique_ptr<internal::SdfFileCache> sdf_cache_;
+  std::unique_ptr<internal::UrdfFileCache> urdf_cache_;
 };
 
 }  // namespace multibody
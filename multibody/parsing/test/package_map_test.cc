@@ -130,6 +130,14 @@ GTEST_TEST(PackageMapTest, TestPopulateUpstreamToDrake) {
   // Call it again to exercise the "don't add things twice" code.
   package_map.PopulateUpstreamToDrake(sdf_file_name);
   VerifyMatch(package_map, expected_packages);
+
+  // A map that has already searched the directories above the package still
+  // finds the package when searching from within it.
+  PackageMap other_map;
+  other_map.PopulateUpstreamToDrake(root_path + "package_map_test.sdf");
+  EXPECT_FALSE(other_map.Contains("package_map_test_package_a"));
+  other_map.PopulateUpstreamToDrake(sdf_file_name);
+  VerifyMatch(other_map, expected_packages);
 }
 
 // Tests that PackageMap can be populated from an env var.
@@ -2,7 +2,9 @@
 
 #include <fstream>
 #include <sstream>
+#include <vector>
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_assert.h"
@@ -56,6 +58,32 @@ GTEST_TEST(FileParserTest, BasicTest) {
   }
 }
 
+// Adding the same file many times reuses its parsed contents; check that every
+// instance is complete nonetheless.
+GTEST_TEST(FileParserTest, RepeatedFileTest) {
+  for (const char* const file_name :
+       {"drake/multibody/benchmarks/acrobot/acrobot.sdf",
+        "drake/multibody/benchmarks/acrobot/acrobot.urdf"}) {
+    MultibodyPlant<double> plant(0.0);
+    Parser dut(&plant);
+    const int num_instances = 5;
+    std::vector<ModelInstanceIndex> instances;
+    for (int i = 0; i < num_instances; ++i) {
+      instances.push_back(dut.AddModelFromFile(
+          FindResourceOrThrow(file_name), fmt::format("acrobot{}", i)));
+    }
+    plant.Finalize();
+    EXPECT_EQ(plant.num_bodies(), 1 + 2 * num_instances);
+    for (int i = 0; i < num_instances; ++i) {
+      EXPECT_EQ(plant.GetModelInstanceName(instances[i]),
+                fmt::format("acrobot{}", i));
+      EXPECT_TRUE(plant.HasBodyNamed("Link1", instances[i]));
+      EXPECT_TRUE(plant.HasBodyNamed("Link2", instances[i]));
+      EXPECT_TRUE(plant.HasJointNamed("ShoulderJoint", instances[i]));
+    }
+  }
+}
+
 GTEST_TEST(FileParserTest, BasicStringTest) {
   const std::string sdf_name = FindResourceOrThrow(
       "drake/multibody/benchmarks/acrobot/acrobot.sdf");
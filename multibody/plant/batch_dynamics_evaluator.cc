@@ -0,0 +1,184 @@
+#include "drake/multibody/plant/batch_dynamics_evaluator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+BatchDynamicsEvaluator<T>::BatchDynamicsEvaluator(
+    const MultibodyPlant<T>* plant)
+    : plant_(plant) {
+  DRAKE_THROW_UNLESS(plant != nullptr);
+  DRAKE_THROW_UNLESS(plant->is_finalized());
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(
+        "BatchDynamicsEvaluator::set_num_threads(): num_threads should be "
+        "positive.");
+  }
+  num_threads_ = num_threads;
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::BatchCalcMassMatrix(
+    const Eigen::Ref<const MatrixX<T>>& q_samples,
+    std::vector<MatrixX<T>>* M) {
+  DRAKE_THROW_UNLESS(M != nullptr);
+  DRAKE_THROW_UNLESS(q_samples.rows() == plant_->num_positions());
+  const int nv = plant_->num_velocities();
+  M->resize(q_samples.cols());
+  for (MatrixX<T>& M_n : *M) M_n.resize(nv, nv);
+  ForEachSample(q_samples.cols(), [&](int n, Workspace* workspace) {
+    plant_->SetPositions(workspace->context.get(), q_samples.col(n));
+    plant_->CalcMassMatrix(*workspace->context, &(*M)[n]);
+  });
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::BatchCalcInverseDynamics(
+    const Eigen::Ref<const MatrixX<T>>& q_samples,
+    const Eigen::Ref<const MatrixX<T>>& v_samples,
+    const Eigen::Ref<const MatrixX<T>>& vdot_samples, MatrixX<T>* tau) {
+  DRAKE_THROW_UNLESS(tau != nullptr);
+  DRAKE_THROW_UNLESS(q_samples.rows() == plant_->num_positions());
+  DRAKE_THROW_UNLESS(v_samples.rows() == plant_->num_velocities());
+  DRAKE_THROW_UNLESS(vdot_samples.rows() == plant_->num_velocities());
+  DRAKE_THROW_UNLESS(v_samples.cols() == q_samples.cols());
+  DRAKE_THROW_UNLESS(vdot_samples.cols() == q_samples.cols());
+  tau->resize(plant_->num_velocities(), q_samples.cols());
+  ForEachSample(q_samples.cols(), [&](int n, Workspace* workspace) {
+    systems::Context<T>* context = workspace->context.get();
+    plant_->SetPositions(context, q_samples.col(n));
+    plant_->SetVelocities(context, v_samples.col(n));
+    plant_->CalcForceElementsContribution(*context, workspace->forces.get());
+    tau->col(n) = plant_->CalcInverseDynamics(*context, vdot_samples.col(n),
+                                              *workspace->forces);
+  });
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::BatchCalcForwardDynamics(
+    const Eigen::Ref<const MatrixX<T>>& q_samples,
+    const Eigen::Ref<const MatrixX<T>>& v_samples,
+    const Eigen::Ref<const MatrixX<T>>& tau_samples, MatrixX<T>* vdot) {
+  DRAKE_THROW_UNLESS(vdot != nullptr);
+  ThrowIfInvalidStates(q_samples, v_samples, tau_samples);
+  vdot->resize(plant_->num_velocities(), q_samples.cols());
+  ForEachSample(q_samples.cols(), [&](int n, Workspace* workspace) {
+    CalcForwardDynamics(q_samples.col(n), v_samples.col(n),
+                        tau_samples.col(n), workspace);
+    vdot->col(n) = workspace->vdot;
+  });
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::BatchCalcSemiExplicitEulerStep(
+    double h, const Eigen::Ref<const MatrixX<T>>& q_samples,
+    const Eigen::Ref<const MatrixX<T>>& v_samples,
+    const Eigen::Ref<const MatrixX<T>>& tau_samples, MatrixX<T>* x_next) {
+  DRAKE_THROW_UNLESS(h > 0);
+  DRAKE_THROW_UNLESS(x_next != nullptr);
+  ThrowIfInvalidStates(q_samples, v_samples, tau_samples);
+  const int nq = plant_->num_positions();
+  const int nv = plant_->num_velocities();
+  x_next->resize(nq + nv, q_samples.cols());
+  ForEachSample(q_samples.cols(), [&](int n, Workspace* workspace) {
+    CalcForwardDynamics(q_samples.col(n), v_samples.col(n),
+                        tau_samples.col(n), workspace);
+    auto v_next = x_next->col(n).tail(nv);
+    v_next = v_samples.col(n) + h * workspace->vdot;
+    // The context stores qₙ, as needed for N(qₙ).
+    plant_->MapVelocityToQDot(*workspace->context, v_next, &workspace->qdot);
+    x_next->col(n).head(nq) = q_samples.col(n) + h * workspace->qdot;
+  });
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::BatchCalcJacobianSpatialVelocity(
+    const Eigen::Ref<const MatrixX<T>>& q_samples,
+    JacobianWrtVariable with_respect_to, const Frame<T>& frame_B,
+    const Eigen::Ref<const Vector3<T>>& p_BoBp_B, const Frame<T>& frame_A,
+    const Frame<T>& frame_E, std::vector<MatrixX<T>>* Js_V_ABp_E) {
+  DRAKE_THROW_UNLESS(Js_V_ABp_E != nullptr);
+  DRAKE_THROW_UNLESS(q_samples.rows() == plant_->num_positions());
+  const int num_columns = with_respect_to == JacobianWrtVariable::kQDot
+                              ? plant_->num_positions()
+                              : plant_->num_velocities();
+  Js_V_ABp_E->resize(q_samples.cols());
+  for (MatrixX<T>& J_n : *Js_V_ABp_E) J_n.resize(6, num_columns);
+  ForEachSample(q_samples.cols(), [&](int n, Workspace* workspace) {
+    plant_->SetPositions(workspace->context.get(), q_samples.col(n));
+    plant_->CalcJacobianSpatialVelocity(*workspace->context, with_respect_to,
+                                        frame_B, p_BoBp_B, frame_A, frame_E,
+                                        &(*Js_V_ABp_E)[n]);
+  });
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::ThrowIfInvalidStates(
+    const Eigen::Ref<const MatrixX<T>>& q_samples,
+    const Eigen::Ref<const MatrixX<T>>& v_samples,
+    const Eigen::Ref<const MatrixX<T>>& tau_samples) const {
+  DRAKE_THROW_UNLESS(q_samples.rows() == plant_->num_positions());
+  DRAKE_THROW_UNLESS(v_samples.rows() == plant_->num_velocities());
+  DRAKE_THROW_UNLESS(tau_samples.rows() == plant_->num_velocities());
+  DRAKE_THROW_UNLESS(v_samples.cols() == q_samples.cols());
+  DRAKE_THROW_UNLESS(tau_samples.cols() == q_samples.cols());
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::CalcForwardDynamics(
+    const Eigen::Ref<const VectorX<T>>& q,
+    const Eigen::Ref<const VectorX<T>>& v,
+    const Eigen::Ref<const VectorX<T>>& tau, Workspace* workspace) const {
+  systems::Context<T>* context = workspace->context.get();
+  plant_->SetPositions(context, q);
+  plant_->SetVelocities(context, v);
+  plant_->CalcForceElementsContribution(*context, workspace->forces.get());
+  workspace->forces->mutable_generalized_forces() += tau;
+  plant_->CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+      *context, *workspace->forces, &workspace->vdot);
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::AllocateWorkspaces(int num_workspaces) {
+  while (static_cast<int>(workspaces_.size()) < num_workspaces) {
+    Workspace workspace;
+    workspace.context = plant_->CreateDefaultContext();
+    workspace.forces = std::make_unique<MultibodyForces<T>>(*plant_);
+    workspace.vdot.resize(plant_->num_velocities());
+    workspace.qdot.resize(plant_->num_positions());
+    workspaces_.push_back(std::move(workspace));
+  }
+}
+
+template <typename T>
+template <typename Calc>
+void BatchDynamicsEvaluator<T>::ForEachSample(int num_samples,
+                                              const Calc& calc) {
+  // The workspaces are allocated on the calling thread, so that the parallel
+  // loop below only reads the plant and writes into disjoint storage.
+  AllocateWorkspaces(std::min(num_threads_, num_samples));
+  drake::internal::StaticParallelForRange(
+      num_samples, num_threads_, [&](int thread_num, int begin, int end) {
+        Workspace* workspace = &workspaces_[thread_num];
+        for (int n = begin; n < end; ++n) {
+          calc(n, workspace);
+        }
+      });
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BatchDynamicsEvaluator)
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/multibody_forces.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+/// Computes the mass matrix, the inverse and forward dynamics and Jacobians of
+/// a MultibodyPlant for many configurations in a single call, for instance to
+/// generate datasets, to evaluate a controller offline or to step many
+/// environments at once (see BatchCalcSemiExplicitEulerStep()). This avoids the
+/// per-call overhead of looping over the configurations in a scripting
+/// language, and the configurations can optionally be processed on several
+/// threads, see set_num_threads(). See ForwardKinematicsEvaluator for the
+/// poses of the bodies.
+///
+/// Each method takes the configurations as a matrix with one configuration
+/// per column. Each one is set into a scratch Context owned by this object,
+/// whose parameters are those of a default Context of the plant, and which is
+/// otherwise unaffected by the state of the plant's other Contexts.
+///
+/// @tparam_default_scalar
+template <typename T>
+class BatchDynamicsEvaluator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchDynamicsEvaluator)
+
+  /// Constructs an evaluator for the given `plant`, which is aliased and must
+  /// outlive this object.
+  /// @throws std::exception if `plant` is nullptr or not finalized.
+  explicit BatchDynamicsEvaluator(const MultibodyPlant<T>* plant);
+
+  /// Returns the plant given at construction.
+  const MultibodyPlant<T>& plant() const { return *plant_; }
+
+  /// Sets the number of threads used by the Batch methods. Each thread
+  /// processes a contiguous block of configurations with its own scratch
+  /// Context. The default of 1 processes the configurations sequentially on
+  /// the calling thread.
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_threads(int num_threads);
+
+  /// Returns the number of threads used by the Batch methods.
+  /// @see set_num_threads().
+  int num_threads() const { return num_threads_; }
+
+  /// Computes the mass matrix M(q) for N configurations, as
+  /// MultibodyPlant::CalcMassMatrix() does.
+  /// @param[in] q_samples A `plant().num_positions() x N` matrix, with the
+  ///   generalized positions of one configuration per column.
+  /// @param[out] M On output, it has size N and stores the
+  ///   `plant().num_velocities()` square mass matrix for the configuration in
+  ///   column `n` in `M[n]`. Its storage is reused if it already has the right
+  ///   sizes.
+  /// @throws std::exception if `M` is nullptr or if `q_samples` does not have
+  ///   `plant().num_positions()` rows.
+  void BatchCalcMassMatrix(const Eigen::Ref<const MatrixX<T>>& q_samples,
+                           std::vector<MatrixX<T>>* M);
+
+  /// Computes the generalized forces tau that produce the generalized
+  /// accelerations v̇ for N states, as MultibodyPlant::CalcInverseDynamics()
+  /// does. The forces of the plant's force elements (e.g., gravity) are
+  /// applied, as computed by MultibodyPlant::CalcForceElementsContribution(),
+  /// but no other forces are.
+  /// @param[in] q_samples A `plant().num_positions() x N` matrix, with the
+  ///   generalized positions of one state per column.
+  /// @param[in] v_samples A `plant().num_velocities() x N` matrix, with the
+  ///   generalized velocities of one state per column.
+  /// @param[in] vdot_samples A `plant().num_velocities() x N` matrix, with the
+  ///   generalized accelerations for each state.
+  /// @param[out] tau On output, the `plant().num_velocities() x N` matrix of
+  ///   the generalized forces for each state.
+  /// @throws std::exception if `tau` is nullptr or if the sizes of the samples
+  ///   are inconsistent with the plant or with each other.
+  void BatchCalcInverseDynamics(
+      const Eigen::Ref<const MatrixX<T>>& q_samples,
+      const Eigen::Ref<const MatrixX<T>>& v_samples,
+      const Eigen::Ref<const MatrixX<T>>& vdot_samples, MatrixX<T>* tau);
+
+  /// Computes the generalized accelerations v̇ for N states and applied
+  /// generalized forces, as
+  /// MultibodyPlant::CalcForwardDynamicsViaArticulatedBodyAlgorithm() does,
+  /// in `O(n)` per state. The forces of the plant's force elements (e.g.,
+  /// gravity) are applied together with `tau_samples`, as for
+  /// BatchCalcInverseDynamics(), and therefore the two methods are inverse of
+  /// each other.
+  /// @param[in] q_samples A `plant().num_positions() x N` matrix, with the
+  ///   generalized positions of one state per column.
+  /// @param[in] v_samples A `plant().num_velocities() x N` matrix, with the
+  ///   generalized velocities of one state per column.
+  /// @param[in] tau_samples A `plant().num_velocities() x N` matrix, with the
+  ///   applied generalized forces for each state.
+  /// @param[out] vdot On output, the `plant().num_velocities() x N` matrix of
+  ///   the generalized accelerations for each state.
+  /// @throws std::exception if `vdot` is nullptr or if the sizes of the
+  ///   samples are inconsistent with the plant or with each other.
+  void BatchCalcForwardDynamics(
+      const Eigen::Ref<const MatrixX<T>>& q_samples,
+      const Eigen::Ref<const MatrixX<T>>& v_samples,
+      const Eigen::Ref<const MatrixX<T>>& tau_samples, MatrixX<T>* vdot);
+
+  /// Advances N states by a time step `h` of the semi-explicit Euler scheme
+  /// <pre>
+  ///   vₙ₊₁ = vₙ + h v̇(qₙ, vₙ, τₙ)
+  ///   qₙ₊₁ = qₙ + h N(qₙ) vₙ₊₁
+  /// </pre>
+  /// with the accelerations v̇ of BatchCalcForwardDynamics(). This is intended
+  /// to step many environments of the same model in lock-step with the state
+  /// of all environments kept in matrices, e.g. for reinforcement learning.
+  /// Quaternions are not normalized. Only the forces of the force elements
+  /// and `tau_samples` are applied; in particular, there is no contact, see
+  /// MultibodyPlant::CalcDiscreteVariableUpdatesBatch() for the full discrete
+  /// dynamics of a discrete plant.
+  /// @param[in] h The time step, positive.
+  /// @param[in] q_samples A `plant().num_positions() x N` matrix, with the
+  ///   generalized positions of one state per column.
+  /// @param[in] v_samples A `plant().num_velocities() x N` matrix, with the
+  ///   generalized velocities of one state per column.
+  /// @param[in] tau_samples A `plant().num_velocities() x N` matrix, with the
+  ///   applied generalized forces for each state.
+  /// @param[out] x_next On output, the `plant().num_multibody_states() x N`
+  ///   matrix with the next state `[qₙ₊₁; vₙ₊₁]` for each state, in the
+  ///   layout of MultibodyPlant::CalcDiscreteVariableUpdatesBatch().
+  /// @throws std::exception if `h` is not positive, if `x_next` is nullptr
+  ///   or if the sizes of the samples are inconsistent with the plant or with
+  ///   each other.
+  void BatchCalcSemiExplicitEulerStep(
+      double h, const Eigen::Ref<const MatrixX<T>>& q_samples,
+      const Eigen::Ref<const MatrixX<T>>& v_samples,
+      const Eigen::Ref<const MatrixX<T>>& tau_samples, MatrixX<T>* x_next);
+
+  /// Computes the spatial velocity Jacobian of a point Bp of a frame B, in a
+  /// frame A and expressed in a frame E, for N configurations, as
+  /// MultibodyPlant::CalcJacobianSpatialVelocity() does.
+  /// @param[in] q_samples A `plant().num_positions() x N` matrix, with the
+  ///   generalized positions of one configuration per column.
+  /// @param[out] Js_V_ABp_E On output, it has size N and stores the Jacobian
+  ///   for the configuration in column `n` in `Js_V_ABp_E[n]`, with 6 rows and
+  ///   either `plant().num_positions()` or `plant().num_velocities()` columns
+  ///   depending on `with_respect_to`. Its storage is reused if it already has
+  ///   the right sizes.
+  /// See MultibodyPlant::CalcJacobianSpatialVelocity() for the other
+  /// parameters.
+  /// @throws std::exception if `Js_V_ABp_E` is nullptr or if `q_samples` does
+  ///   not have `plant().num_positions()` rows.
+  void BatchCalcJacobianSpatialVelocity(
+      const Eigen::Ref<const MatrixX<T>>& q_samples,
+      JacobianWrtVariable with_respect_to, const Frame<T>& frame_B,
+      const Eigen::Ref<const Vector3<T>>& p_BoBp_B, const Frame<T>& frame_A,
+      const Frame<T>& frame_E, std::vector<MatrixX<T>>* Js_V_ABp_E);
+
+ private:
+  // The scratch storage of a single thread.
+  struct Workspace {
+    std::unique_ptr<systems::Context<T>> context;
+    std::unique_ptr<MultibodyForces<T>> forces;
+    VectorX<T> vdot;
+    VectorX<T> qdot;
+  };
+
+  // Throws if the sizes of the samples of states and generalized forces are
+  // inconsistent with the plant or with each other.
+  void ThrowIfInvalidStates(
+      const Eigen::Ref<const MatrixX<T>>& q_samples,
+      const Eigen::Ref<const MatrixX<T>>& v_samples,
+      const Eigen::Ref<const MatrixX<T>>& tau_samples) const;
+
+  // Computes into `workspace->vdot` the generalized accelerations for the
+  // state (q, v) and the applied generalized forces `tau`, leaving the state
+  // set in `workspace->context`.
+  void CalcForwardDynamics(const Eigen::Ref<const VectorX<T>>& q,
+                           const Eigen::Ref<const VectorX<T>>& v,
+                           const Eigen::Ref<const VectorX<T>>& tau,
+                           Workspace* workspace) const;
+
+  // Appends workspaces to workspaces_ until it has at least `num_workspaces`.
+  void AllocateWorkspaces(int num_workspaces);
+
+  // Calls `calc(n, workspace)` for each of the `num_samples` samples, on
+  // num_threads() threads, with one workspace per thread.
+  template <typename Calc>
+  void ForEachSample(int num_samples, const Calc& calc);
+
+  const MultibodyPlant<T>* const plant_;
+  int num_threads_{1};
+  // One workspace per thread, allocated as needed.
+  std::vector<Workspace> workspaces_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BatchDynamicsEvaluator)
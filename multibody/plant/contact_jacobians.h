@@ -2,6 +2,8 @@
 
 #include <vector>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
 #include "drake/math/rotation_matrix.h"
@@ -40,8 +42,10 @@ struct ContactJacobians {
   /// `Jc` is a matrix of size `3⋅nc x nv` such that `vc = Jc⋅v` concatenates
   /// the full 3D contact velocities. Refer to
   /// contact_solvers::MergeNormalAndTangent() for details on the specific
-  /// layout of vc.
-  MatrixX<T> Jc;
+  /// layout of vc. The rows of each contact only store the columns of the
+  /// generalized velocities along the kinematic paths of the two bodies in
+  /// contact, all other entries being zero.
+  Eigen::SparseMatrix<T> Jc;
 
   /// List of contact frames orientation R_WC in the world frame W for each
   /// contact pair.
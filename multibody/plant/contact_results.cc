@@ -21,28 +21,34 @@ ContactResults<T>::ContactResults(const ContactResults<T>& contact_results) {
 template <typename T>
 ContactResults<T>& ContactResults<T>::operator=(
     const ContactResults<T>& contact_results) {
+  if (this == &contact_results) return *this;
+
   // Make the type a vector of const pointers if we can.
   if (contact_results.num_hydroelastic_contacts() == 0) {
     hydroelastic_contact_info_ =
         std::vector<const HydroelasticContactInfo<T>*>();
+  } else if (contact_results.hydroelastic_contact_vector_ownership_mode() ==
+             kOwnsCopies) {
+    // The copies owned by contact_results are immutable; share them.
+    hydroelastic_contact_info_ = contact_results.hydroelastic_contact_info_;
   } else {
     // If this currently holds pointers, we need to change the type.
     if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
       hydroelastic_contact_info_ =
-          std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>();
+          std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>();
     }
 
     // Copy the HydroelasticContactInfo data.
-    std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>&
+    std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>&
         hydroelastic_contact_vector =
-            hydroelastic_contact_vector_of_unique_ptrs();
+            hydroelastic_contact_vector_of_shared_ptrs();
     hydroelastic_contact_vector.resize(
         contact_results.num_hydroelastic_contacts());
     for (int i = 0; i < contact_results.num_hydroelastic_contacts(); ++i) {
       const HydroelasticContactInfo<T>& contact_info =
           contact_results.hydroelastic_contact_info(i);
       hydroelastic_contact_vector[i] =
-          std::make_unique<HydroelasticContactInfo<T>>(contact_info);
+          std::make_shared<const HydroelasticContactInfo<T>>(contact_info);
     }
   }
 
@@ -57,7 +63,7 @@ void ContactResults<T>::Clear() {
   if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
     hydroelastic_contact_vector_of_pointers().clear();
   } else {
-    hydroelastic_contact_vector_of_unique_ptrs().clear();
+    hydroelastic_contact_vector_of_shared_ptrs().clear();
   }
 }
 
@@ -75,7 +81,7 @@ ContactResults<T>::hydroelastic_contact_info(int i) const {
   if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
     return *hydroelastic_contact_vector_of_pointers()[i];
   } else {
-    return *hydroelastic_contact_vector_of_unique_ptrs()[i];
+    return *hydroelastic_contact_vector_of_shared_ptrs()[i];
   }
 }
 
@@ -94,7 +100,7 @@ int ContactResults<T>::num_hydroelastic_contacts() const {
     return static_cast<int>(hydroelastic_contact_vector_of_pointers().size());
   } else {
     return static_cast<int>(
-        hydroelastic_contact_vector_of_unique_ptrs().size());
+        hydroelastic_contact_vector_of_shared_ptrs().size());
   }
 }
 
@@ -11,8 +11,9 @@ using systems::Context;
 
 template <typename T>
 ContactResultsToLcmSystem<T>::ContactResultsToLcmSystem(
-    const MultibodyPlant<T>& plant)
-    : systems::LeafSystem<T>() {
+    const MultibodyPlant<T>& plant,
+    HydroelasticContactVisualizationDetail hydroelastic_detail)
+    : systems::LeafSystem<T>(), hydroelastic_detail_(hydroelastic_detail) {
   DRAKE_DEMAND(plant.is_finalized());
   const int body_count = plant.num_bodies();
 
@@ -102,9 +103,14 @@ void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
     const geometry::ContactSurface<T>& contact_surface =
         hydroelastic_contact_info.contact_surface();
     const geometry::SurfaceMesh<T>& mesh_W = contact_surface.mesh_W();
-    surface_msg.num_triangles = mesh_W.num_faces();
+    const bool write_mesh = hydroelastic_detail_ !=
+                            HydroelasticContactVisualizationDetail::kWrenchOnly;
+    const bool write_quadrature_points =
+        hydroelastic_detail_ == HydroelasticContactVisualizationDetail::kFull;
+    surface_msg.num_triangles = write_mesh ? mesh_W.num_faces() : 0;
     surface_msg.triangles.resize(surface_msg.num_triangles);
-    surface_msg.num_quadrature_points = quadrature_point_data.size();
+    surface_msg.num_quadrature_points =
+        write_quadrature_points ? quadrature_point_data.size() : 0;
     surface_msg.quadrature_point_data.resize(surface_msg.num_quadrature_points);
 
     write_double3(contact_surface.mesh_W().centroid(), surface_msg.centroid_W);
@@ -113,24 +119,26 @@ void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
     write_double3(hydroelastic_contact_info.F_Ac_W().rotational(),
                   surface_msg.moment_C_W);
 
-    // Write all quadrature points on the contact surface.
-    const int num_quadrature_points_per_tri =
-        surface_msg.num_quadrature_points / surface_msg.num_triangles;
-    for (int j = 0; j < surface_msg.num_quadrature_points; ++j) {
-      // Verify the ordering is consistent with that advertised.
-      DRAKE_DEMAND(quadrature_point_data[j].face_index ==
-                   j / num_quadrature_points_per_tri);
-
-      lcmt_hydroelastic_quadrature_per_point_data_for_viz& quad_data_msg =
-          surface_msg.quadrature_point_data[j];
-      write_double3(quadrature_point_data[j].p_WQ, quad_data_msg.p_WQ);
-      write_double3(quadrature_point_data[j].vt_BqAq_W,
-                    quad_data_msg.vt_BqAq_W);
-      write_double3(quadrature_point_data[j].traction_Aq_W,
-                    quad_data_msg.traction_Aq_W);
+    // Write all quadrature points on the contact surface, if requested.
+    if (surface_msg.num_quadrature_points > 0) {
+      const int num_quadrature_points_per_tri =
+          surface_msg.num_quadrature_points / surface_msg.num_triangles;
+      for (int j = 0; j < surface_msg.num_quadrature_points; ++j) {
+        // Verify the ordering is consistent with that advertised.
+        DRAKE_DEMAND(quadrature_point_data[j].face_index ==
+                     j / num_quadrature_points_per_tri);
+
+        lcmt_hydroelastic_quadrature_per_point_data_for_viz& quad_data_msg =
+            surface_msg.quadrature_point_data[j];
+        write_double3(quadrature_point_data[j].p_WQ, quad_data_msg.p_WQ);
+        write_double3(quadrature_point_data[j].vt_BqAq_W,
+                      quad_data_msg.vt_BqAq_W);
+        write_double3(quadrature_point_data[j].traction_Aq_W,
+                      quad_data_msg.traction_Aq_W);
+      }
     }
 
-    // Loop through each contact triangle on the contact surface.
+    // Loop through each contact triangle on the contact surface, if requested.
     for (geometry::SurfaceFaceIndex j(0); j < surface_msg.num_triangles; ++j) {
       lcmt_hydroelastic_contact_surface_tri_for_viz& tri_msg =
           surface_msg.triangles[j];
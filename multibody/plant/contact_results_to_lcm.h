@@ -19,6 +19,21 @@
 namespace drake {
 namespace multibody {
 
+/** Specifies how much of each hydroelastic contact ContactResultsToLcmSystem
+ encodes. The contact surface meshes and, even more so, the per quadrature point
+ data can make up most of an lcmt_contact_results_for_viz message; omitting
+ them reduces the cost of encoding and publishing the message. */
+enum class HydroelasticContactVisualizationDetail {
+  /** Encodes the spatial force at the centroid, the contact surface mesh with
+   its pressures, and the data at each quadrature point. */
+  kFull,
+  /** Encodes the spatial force at the centroid and the contact surface mesh
+   with its pressures, but no quadrature point data. */
+  kNoQuadraturePoints,
+  /** Only encodes the spatial force at the centroid. */
+  kWrenchOnly,
+};
+
 /** A System that encodes ContactResults into a lcmt_contact_results_for_viz
  message. It has a single input port with type ContactResults<T> and a single
  output port with lcmt_contact_results_for_viz.
@@ -32,16 +47,27 @@ class ContactResultsToLcmSystem final : public systems::LeafSystem<T> {
 
   /** Constructs a ContactResultsToLcmSystem.
    @param plant The MultibodyPlant that the ContactResults are generated from.
+   @param hydroelastic_detail How much of each hydroelastic contact is encoded.
    @pre The `plant` must be finalized already. The input port of this system
         must be connected to the corresponding output port of `plant`
         (either directly or from an exported port in a Diagram).
   */
-  explicit ContactResultsToLcmSystem(const MultibodyPlant<T>& plant);
+  explicit ContactResultsToLcmSystem(
+      const MultibodyPlant<T>& plant,
+      HydroelasticContactVisualizationDetail hydroelastic_detail =
+          HydroelasticContactVisualizationDetail::kFull);
 
   /** Scalar-converting copy constructor.  */
   template <typename U>
   explicit ContactResultsToLcmSystem(const ContactResultsToLcmSystem<U>& other)
-      : systems::LeafSystem<T>(), body_names_(other.body_names_) {}
+      : systems::LeafSystem<T>(),
+        hydroelastic_detail_(other.hydroelastic_detail_),
+        body_names_(other.body_names_) {}
+
+  /** Returns how much of each hydroelastic contact is encoded. */
+  HydroelasticContactVisualizationDetail hydroelastic_detail() const {
+    return hydroelastic_detail_;
+  }
 
   const systems::InputPort<T>& get_contact_result_input_port() const;
   const systems::OutputPort<T>& get_lcm_message_output_port() const;
@@ -58,6 +84,9 @@ class ContactResultsToLcmSystem final : public systems::LeafSystem<T> {
   systems::InputPortIndex contact_result_input_port_index_;
   systems::OutputPortIndex message_output_port_index_;
 
+  const HydroelasticContactVisualizationDetail hydroelastic_detail_{
+      HydroelasticContactVisualizationDetail::kFull};
+
   // A mapping from geometry IDs to body indices.
   std::unordered_map<geometry::GeometryId, std::string>
       geometry_id_to_body_name_map_;
@@ -0,0 +1,100 @@
+#include "drake/multibody/plant/forward_kinematics_evaluator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+ForwardKinematicsEvaluator<T>::ForwardKinematicsEvaluator(
+    const MultibodyPlant<T>* plant)
+    : plant_(plant) {
+  DRAKE_THROW_UNLESS(plant != nullptr);
+  DRAKE_THROW_UNLESS(plant->is_finalized());
+}
+
+template <typename T>
+void ForwardKinematicsEvaluator<T>::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(
+        "ForwardKinematicsEvaluator::set_num_threads(): num_threads should be "
+        "positive.");
+  }
+  num_threads_ = num_threads;
+}
+
+template <typename T>
+void ForwardKinematicsEvaluator<T>::CalcBodyPosesInWorld(
+    const Eigen::Ref<const VectorX<T>>& q,
+    std::vector<math::RigidTransform<T>>* X_WB) {
+  DRAKE_THROW_UNLESS(X_WB != nullptr);
+  DRAKE_THROW_UNLESS(q.size() == plant_->num_positions());
+  X_WB->resize(plant_->num_bodies());
+  AllocateWorkspaces(1);
+  CalcBodyPosesInWorld(q, &workspaces_[0], X_WB->data());
+}
+
+template <typename T>
+void ForwardKinematicsEvaluator<T>::BatchCalcBodyPosesInWorld(
+    const Eigen::Ref<const MatrixX<T>>& q_samples,
+    std::vector<math::RigidTransform<T>>* X_WB) {
+  DRAKE_THROW_UNLESS(X_WB != nullptr);
+  DRAKE_THROW_UNLESS(q_samples.rows() == plant_->num_positions());
+  const int num_samples = q_samples.cols();
+  const int num_bodies = plant_->num_bodies();
+  X_WB->resize(num_samples * num_bodies);
+  // The workspaces are allocated on the calling thread, so that the parallel
+  // loop below only reads the plant and writes into disjoint storage.
+  AllocateWorkspaces(std::min(num_threads_, num_samples));
+  drake::internal::StaticParallelForRange(
+      num_samples, num_threads_, [&](int thread_num, int begin, int end) {
+        Workspace* workspace = &workspaces_[thread_num];
+        for (int n = begin; n < end; ++n) {
+          CalcBodyPosesInWorld(q_samples.col(n), workspace,
+                               X_WB->data() + n * num_bodies);
+        }
+      });
+}
+
+template <typename T>
+void ForwardKinematicsEvaluator<T>::AllocateWorkspaces(int num_workspaces) {
+  const internal::MultibodyTree<T>& tree = internal::GetInternalTree(*plant_);
+  while (static_cast<int>(workspaces_.size()) < num_workspaces) {
+    Workspace workspace;
+    workspace.context = plant_->CreateDefaultContext();
+    workspace.state = &workspace.context->get_mutable_state();
+    workspace.pc = std::make_unique<internal::PositionKinematicsCache<T>>(
+        tree.get_topology());
+    workspaces_.push_back(std::move(workspace));
+  }
+}
+
+template <typename T>
+void ForwardKinematicsEvaluator<T>::CalcBodyPosesInWorld(
+    const Eigen::Ref<const VectorX<T>>& q, Workspace* workspace,
+    math::RigidTransform<T>* X_WB_begin) const {
+  const internal::MultibodyTree<T>& tree = internal::GetInternalTree(*plant_);
+  // The scratch context is private to this class and none of its cache
+  // entries are ever evaluated, so q is written into its state directly,
+  // without notifying the cache of the change. The kinematics are then
+  // computed straight into our own cache.
+  plant_->GetMutablePositions(*workspace->context, workspace->state) = q;
+  tree.CalcPositionKinematicsCache(*workspace->context, workspace->pc.get());
+  for (BodyIndex body_index(0); body_index < plant_->num_bodies();
+       ++body_index) {
+    const internal::BodyNodeIndex node_index =
+        tree.get_body(body_index).node_index();
+    X_WB_begin[body_index] = workspace->pc->get_X_WB(node_index);
+  }
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::ForwardKinematicsEvaluator)
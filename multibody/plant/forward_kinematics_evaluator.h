@@ -0,0 +1,111 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/position_kinematics_cache.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+/// Computes the poses in the world frame of all the bodies of a
+/// MultibodyPlant for many configurations q, for instance to sample the
+/// workspace of a robot or to generate datasets.
+///
+/// Computing the poses for a configuration through the systems framework, as
+/// in: @code
+///   plant.SetPositions(context, q);
+///   plant.EvalBodyPoseInWorld(*context, body);
+/// @endcode
+/// invalidates and refills the caches of `context` for every configuration.
+/// This class instead owns a scratch Context and a position kinematics cache,
+/// and computes the position kinematics for each configuration directly into
+/// that cache, bypassing the cache bookkeeping of the Context. Configurations
+/// can optionally be processed on several threads, see set_num_threads().
+///
+/// Only the generalized positions of the plant's state are used. Parameters
+/// (e.g. the poses of fixed offset frames) are taken from a default Context
+/// of the plant.
+///
+/// @tparam_default_scalar
+template <typename T>
+class ForwardKinematicsEvaluator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ForwardKinematicsEvaluator)
+
+  /// Constructs an evaluator for the given `plant`, which is aliased and must
+  /// outlive this object.
+  /// @throws std::exception if `plant` is nullptr or not finalized.
+  explicit ForwardKinematicsEvaluator(const MultibodyPlant<T>* plant);
+
+  /// Returns the plant given at construction.
+  const MultibodyPlant<T>& plant() const { return *plant_; }
+
+  /// Sets the number of threads used by BatchCalcBodyPosesInWorld(). Each
+  /// thread processes a contiguous block of configurations with its own
+  /// scratch Context. The default of 1 processes the configurations
+  /// sequentially on the calling thread.
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_threads(int num_threads);
+
+  /// Returns the number of threads used by BatchCalcBodyPosesInWorld().
+  /// @see set_num_threads().
+  int num_threads() const { return num_threads_; }
+
+  /// Computes the pose X_WB of each body B in the world frame W for the
+  /// generalized positions `q`.
+  /// @param[in] q The generalized positions of the plant.
+  /// @param[out] X_WB On output, it has size `plant().num_bodies()` and stores
+  ///   the pose of the body with BodyIndex `i` in `X_WB[i]`.
+  /// @throws std::exception if `X_WB` is nullptr or if the size of `q` is not
+  ///   `plant().num_positions()`.
+  void CalcBodyPosesInWorld(const Eigen::Ref<const VectorX<T>>& q,
+                            std::vector<math::RigidTransform<T>>* X_WB);
+
+  /// Batched variant of CalcBodyPosesInWorld() for N configurations.
+  /// @param[in] q_samples A `plant().num_positions() x N` matrix, with the
+  ///   generalized positions of one configuration per column.
+  /// @param[out] X_WB On output, it has size `N * plant().num_bodies()` and
+  ///   stores the pose of the body with BodyIndex `i` for the configuration in
+  ///   column `n` in `X_WB[n * plant().num_bodies() + i]`. Its storage is
+  ///   reused if it already has the right size.
+  /// @throws std::exception if `X_WB` is nullptr or if `q_samples` does not
+  ///   have `plant().num_positions()` rows.
+  void BatchCalcBodyPosesInWorld(const Eigen::Ref<const MatrixX<T>>& q_samples,
+                                 std::vector<math::RigidTransform<T>>* X_WB);
+
+ private:
+  // The scratch storage of a single thread.
+  struct Workspace {
+    std::unique_ptr<systems::Context<T>> context;
+    // The state of `context`, written without invalidating its cache.
+    systems::State<T>* state{};
+    std::unique_ptr<internal::PositionKinematicsCache<T>> pc;
+  };
+
+  // Appends workspaces to workspaces_ until it has at least `num_workspaces`.
+  void AllocateWorkspaces(int num_workspaces);
+
+  // Computes the body poses for `q` with the scratch storage `workspace` into
+  // the `plant().num_bodies()` entries of X_WB starting at `X_WB_begin`.
+  void CalcBodyPosesInWorld(const Eigen::Ref<const VectorX<T>>& q,
+                            Workspace* workspace,
+                            math::RigidTransform<T>* X_WB_begin) const;
+
+  const MultibodyPlant<T>* const plant_;
+  int num_threads_{1};
+  // One workspace per thread, allocated as needed.
+  std::vector<Workspace> workspaces_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::ForwardKinematicsEvaluator)
@@ -9,7 +9,6 @@
 #include "drake/math/orthonormal_basis.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/triangle_quadrature/gaussian_triangle_quadrature_rule.h"
-#include "drake/multibody/triangle_quadrature/triangle_quadrature.h"
 
 namespace drake {
 
@@ -44,39 +43,45 @@ void HydroelasticTractionCalculator<T>::
   // model) might see benefit from a higher-order quadrature.
   const GaussianTriangleQuadratureRule gaussian(2 /* order */);
 
+  const std::vector<Eigen::Vector2d>& quadrature_points =
+      gaussian.quadrature_points();
+  const std::vector<double>& weights = gaussian.weights();
+  DRAKE_DEMAND(quadrature_points.size() == weights.size());
+  const int num_quadrature_points = static_cast<int>(weights.size());
+  DRAKE_DEMAND(num_quadrature_points >= 1);
+
   // We'll be accumulating force on body A at the surface centroid C,
   // triangle-by-triangle.
   F_Ac_W->SetZero();
 
   // Reserve enough memory to keep from doing repeated heap allocations in the
   // quadrature process.
+  const int num_faces = data.surface.mesh_W().num_faces();
   traction_at_quadrature_points->clear();
-  traction_at_quadrature_points->reserve(data.surface.mesh_W().num_faces());
-
-  // Integrate the tractions over all triangles in the contact surface.
-  for (SurfaceFaceIndex i(0); i < data.surface.mesh_W().num_faces(); ++i) {
-    // Construct the function to be integrated over triangle i.
-    // TODO(sherm1) Pull functor creation out of the loop (not a good idea to
-    //              create a new functor for every i).
-    std::function<SpatialForce<T>(const Vector3<T>&)> traction_Ac_W =
-        [this, &data, i, dissipation, mu_coulomb,
-         traction_at_quadrature_points](const Vector3<T>& Q_barycentric) {
-          traction_at_quadrature_points->emplace_back(CalcTractionAtPoint(
-              data, i, Q_barycentric, dissipation, mu_coulomb));
-          const HydroelasticQuadraturePointData<T>& traction_output =
-              traction_at_quadrature_points->back();
-          return ComputeSpatialTractionAtAcFromTractionAtAq(
-              data, traction_output.p_WQ, traction_output.traction_Aq_W);
-        };
-
-    // Compute the integral over the triangle to get a force from the
-    // tractions (force/area) at the Gauss points (shifted to C).
-    const SpatialForce<T> Fi_Ac_W =  // Force from triangle i.
-        TriangleQuadrature<SpatialForce<T>, T>::Integrate(
-            traction_Ac_W, gaussian, data.surface.mesh_W().area(i));
-
-    // Update the spatial force at the centroid.
-    (*F_Ac_W) += Fi_Ac_W;
+  traction_at_quadrature_points->reserve(num_faces * num_quadrature_points);
+
+  // Integrate the tractions over all triangles in the contact surface. This
+  // is the quadrature of TriangleQuadrature::Integrate(), written out so that
+  // the hot loop doesn't construct a std::function for every triangle.
+  for (SurfaceFaceIndex i(0); i < num_faces; ++i) {
+    // The tractions (force/area) at the Gauss points, shifted to C.
+    SpatialForce<T> Fti_Ac_W = SpatialForce<T>::Zero();
+    for (int q = 0; q < num_quadrature_points; ++q) {
+      const Eigen::Vector2d& b = quadrature_points[q];
+      const typename SurfaceMesh<T>::Barycentric Q_barycentric(
+          b[0], b[1], 1 - b[0] - b[1]);
+      traction_at_quadrature_points->emplace_back(CalcTractionAtPoint(
+          data, i, Q_barycentric, dissipation, mu_coulomb));
+      const HydroelasticQuadraturePointData<T>& traction_output =
+          traction_at_quadrature_points->back();
+      Fti_Ac_W += ComputeSpatialTractionAtAcFromTractionAtAq(
+                      data, traction_output.p_WQ,
+                      traction_output.traction_Aq_W) *
+                  weights[q];
+    }
+
+    // Update the spatial force at the centroid with the force from triangle i.
+    (*F_Ac_W) += Fti_Ac_W * data.surface.mesh_W().area(i);
   }
 }
 
@@ -1,14 +1,19 @@
 #include "drake/multibody/plant/multibody_plant.h"
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
 #include "drake/geometry/frame_kinematics_vector.h"
@@ -24,6 +29,7 @@
 #include "drake/multibody/plant/discrete_contact_pair.h"
 #include "drake/multibody/plant/externally_applied_spatial_force.h"
 #include "drake/multibody/plant/hydroelastic_traction_calculator.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/prismatic_joint.h"
 #include "drake/multibody/tree/revolute_joint.h"
 
@@ -240,6 +246,29 @@ struct JointLimitsPenaltyParametersEstimator {
 
 namespace {
 
+// Adds the wall clock time elapsed during its lifetime to `*seconds`. It does
+// nothing when `seconds` is nullptr.
+class ScopedTimer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedTimer)
+
+  explicit ScopedTimer(double* seconds) : seconds_(seconds) {
+    if (seconds_ != nullptr) start_ = Clock::now();
+  }
+
+  ~ScopedTimer() {
+    if (seconds_ != nullptr) {
+      *seconds_ +=
+          std::chrono::duration<double>(Clock::now() - start_).count();
+    }
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  double* const seconds_;
+  Clock::time_point start_;
+};
+
 // Hack to fully qualify frame names, pending resolution of #9128. Used by
 // geometry registration routines.
 template <typename T>
@@ -899,26 +928,57 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     const systems::Context<T>& context,
     const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
     MatrixX<T>* Jn_ptr, MatrixX<T>* Jt_ptr,
-    std::vector<RotationMatrix<T>>* R_WC_set) const {
+    std::vector<RotationMatrix<T>>* R_WC_set,
+    Eigen::SparseMatrix<T>* Jc_ptr) const {
   DRAKE_DEMAND(Jn_ptr != nullptr);
   DRAKE_DEMAND(Jt_ptr != nullptr);
 
   const int num_contacts = contact_pairs.size();
+  const int nv = num_velocities();
 
   // Jn is defined such that vn = Jn * v, with vn of size nc.
   auto& Jn = *Jn_ptr;
-  Jn.resize(num_contacts, num_velocities());
+  Jn.setZero(num_contacts, nv);
 
   // Jt is defined such that vt = Jt * v, with vt of size 2nc.
   auto& Jt = *Jt_ptr;
-  Jt.resize(2 * num_contacts, num_velocities());
+  Jt.setZero(2 * num_contacts, nv);
 
   if (R_WC_set != nullptr) R_WC_set->clear();
+  if (Jc_ptr != nullptr) Jc_ptr->resize(3 * num_contacts, nv);
 
-  // Quick no-op exit. Notice we did resize Jn, Jt and R_WC_set to be zero
+  // Quick no-op exit. Notice we did resize Jn, Jt, R_WC_set and Jc to be zero
   // sized.
   if (num_contacts == 0) return;
 
+  // The Jacobian of a point of a body B only has non-zero entries in the
+  // columns of the generalized velocities of the mobilizers along the path
+  // from the world to B. Therefore, for each contact, only the columns of the
+  // paths to bodies A and B are filled in, and Jc stores only those.
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+  std::vector<bool> is_path_velocity(nv, false);
+  std::vector<int> path_velocities;
+  const auto add_path_velocities = [&](const Body<T>& body) {
+    for (internal::BodyNodeIndex node = body.node_index();
+         node > internal::BodyNodeIndex(0);
+         node = topology.get_body_node(node).parent_body_node) {
+      const internal::BodyNodeTopology& node_topology =
+          topology.get_body_node(node);
+      for (int i = 0; i < node_topology.num_mobilizer_velocities; ++i) {
+        const int v = node_topology.mobilizer_velocities_start_in_v + i;
+        if (is_path_velocity[v]) continue;
+        is_path_velocity[v] = true;
+        path_velocities.push_back(v);
+      }
+    }
+  };
+  std::vector<Eigen::Triplet<T>> Jc_triplets;
+
+  // Workspace for the translational velocity Jacobians.
+  Matrix3X<T> Jv_WAc(3, nv);
+  Matrix3X<T> Jv_WBc(3, nv);
+
   const Frame<T>& frame_W = world_frame();
   for (int icontact = 0; icontact < num_contacts; ++icontact) {
     const auto& point_pair = contact_pairs[icontact];
@@ -939,7 +999,6 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     // translational velocity Jacobian in the world frame W with respect to
     // generalized velocities v).  Note: Ac's translational velocity in W can
     // be written in terms of this Jacobian as v_WAc = Jv_v_WAc * v.
-    Matrix3X<T> Jv_WAc(3, this->num_velocities());
     internal_tree().CalcJacobianTranslationalVelocity(context,
                                                       JacobianWrtVariable::kV,
                                                       bodyA.body_frame(),
@@ -951,7 +1010,6 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
 
     // Similarly, for point Bc (origin of frame B shifted to C), calculate
     // Jv_v_WBc (Bc's translational velocity Jacobian in W with respect to v).
-    Matrix3X<T> Jv_WBc(3, this->num_velocities());
     internal_tree().CalcJacobianTranslationalVelocity(context,
                                                       JacobianWrtVariable::kV,
                                                       bodyB.body_frame(),
@@ -961,19 +1019,6 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
                                                       frame_W,
                                                       &Jv_WBc);
 
-    // Computation of the normal separation velocities Jacobian Jn:
-    //
-    // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // From where the separation velocity is computed as
-    //   vn = -v_AcBc_W.dot(nhat_BA_W) = -nhat_BA_Wᵀ⋅v_AcBc_W
-    // where the negative sign stems from the sign convention for vn and xdot.
-    // This can be written in terms of the Jacobians as
-    //   vn = -nhat_BA_Wᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jn.row(icontact) = nhat_BA_W.transpose() * (Jv_WAc - Jv_WBc);
-
-    // Computation of the tangential velocities Jacobian Jt:
-    //
     // Compute the orientation of a contact frame C at the contact point such
     // that the z-axis Cz equals to nhat_BA_W. The tangent vectors are
     // arbitrary, with the only requirement being that they form a valid right
@@ -986,14 +1031,44 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     const Vector3<T> that1_W = R_WC.matrix().col(0);  // that1 = Cx.
     const Vector3<T> that2_W = R_WC.matrix().col(1);  // that2 = Cy.
 
-    // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // The first two components of this velocity in C corresponds to the
-    // tangential velocities in a plane normal to nhat_BA.
-    //   vx_AcBc_C = that1⋅v_AcBc = that1ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    //   vy_AcBc_C = that2⋅v_AcBc = that2ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jt.row(2 * icontact)     = that1_W.transpose() * (Jv_WBc - Jv_WAc);
-    Jt.row(2 * icontact + 1) = that2_W.transpose() * (Jv_WBc - Jv_WAc);
+    path_velocities.clear();
+    add_path_velocities(bodyA);
+    add_path_velocities(bodyB);
+    for (int v : path_velocities) {
+      is_path_velocity[v] = false;
+      // The velocity of Bc relative to Ac is
+      //   v_AcBc_W = v_WBc - v_WAc.
+      const Vector3<T> J_AcBc_W = Jv_WBc.col(v) - Jv_WAc.col(v);
+
+      // Computation of the normal separation velocities Jacobian Jn:
+      //
+      // The separation velocity is computed as
+      //   vn = -v_AcBc_W.dot(nhat_BA_W) = -nhat_BA_Wᵀ⋅v_AcBc_W
+      // where the negative sign stems from the sign convention for vn and
+      // xdot. This can be written in terms of the Jacobians as
+      //   vn = -nhat_BA_Wᵀ⋅(Jv_WBc - Jv_WAc)⋅v
+      Jn(icontact, v) = -nhat_BA_W.dot(J_AcBc_W);
+
+      // Computation of the tangential velocities Jacobian Jt:
+      //
+      // The first two components of v_AcBc in C corresponds to the tangential
+      // velocities in a plane normal to nhat_BA.
+      //   vx_AcBc_C = that1⋅v_AcBc = that1ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
+      //   vy_AcBc_C = that2⋅v_AcBc = that2ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
+      Jt(2 * icontact, v) = that1_W.dot(J_AcBc_W);
+      Jt(2 * icontact + 1, v) = that2_W.dot(J_AcBc_W);
+
+      // Jc stacks the tangential and normal rows of each contact, see
+      // contact_solvers::MergeNormalAndTangent().
+      if (Jc_ptr != nullptr) {
+        Jc_triplets.emplace_back(3 * icontact, v, Jt(2 * icontact, v));
+        Jc_triplets.emplace_back(3 * icontact + 1, v, Jt(2 * icontact + 1, v));
+        Jc_triplets.emplace_back(3 * icontact + 2, v, Jn(icontact, v));
+      }
+    }
+  }
+  if (Jc_ptr != nullptr) {
+    Jc_ptr->setFromTriplets(Jc_triplets.begin(), Jc_triplets.end());
   }
 }
 
@@ -1379,6 +1454,8 @@ void MultibodyPlant<T>::CalcContactResultsDiscrete(
     ContactResults<T>* contact_results) const {
   DRAKE_DEMAND(contact_results != nullptr);
   if (num_collision_geometries() == 0) return;
+  const ScopedTimer timer(discrete_update_timer(
+      &DiscreteUpdateTimingStatistics::contact_results_time));
 
   const std::vector<PenetrationAsPointPair<T>>& point_pairs =
       EvalPointPairPenetrations(context);
@@ -1749,12 +1826,13 @@ VectorX<T> MultibodyPlant<T>::AssembleActuationInput(
 
 template<typename T>
 TamsiSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
-    int num_substeps,
+    TamsiSolver<T>* solver, int num_substeps,
     const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
     const VectorX<T>& minus_tau,
     const VectorX<T>& stiffness, const VectorX<T>& damping,
     const VectorX<T>& mu,
-    const VectorX<T>& v0, const VectorX<T>& fn0) const {
+    const VectorX<T>& v0, const VectorX<T>& fn0,
+    const std::vector<TamsiSolverContactId>& contact_ids) const {
 
   const double dt = time_step_;  // just a shorter alias.
   const double dt_substep = dt / num_substeps;
@@ -1772,18 +1850,19 @@ TamsiSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
     VectorX<T> p_star_substep = M0 * v0_substep - dt_substep * minus_tau;
 
     // Update the data.
-    tamsi_solver_->SetTwoWayCoupledProblemData(
+    solver->SetTwoWayCoupledProblemData(
         &M0, &Jn, &Jt,
         &p_star_substep, &fn0_substep,
         &stiffness, &damping, &mu);
+    solver->SetContactIdentifiers(contact_ids);
 
-    info = tamsi_solver_->SolveWithGuess(dt_substep, v0_substep);
+    info = solver->SolveWithGuess(dt_substep, v0_substep);
 
     // Break the sub-stepping loop on failure and return the info result.
     if (info != TamsiSolverResult::kSuccess) break;
 
     // Update previous time step to new solution.
-    v0_substep = tamsi_solver_->get_generalized_velocities();
+    v0_substep = solver->get_generalized_velocities();
 
     // TAMSI updates each normal force according to:
     //   fₙ = (1 − d vₙ)₊ (fₙ₀ − h k vₙ)₊
@@ -1792,8 +1871,7 @@ TamsiSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
     // The input fₙ₀ to the solver is the undamped (no dissipation) term only.
     // We must update fₙ₀ for each substep accordingly, i.e:
     //   fₙ₀(next) = (fₙ₀(previous) − h k vₙ(next))₊
-    const auto vn_substep =
-        tamsi_solver_->get_normal_velocities();
+    const auto vn_substep = solver->get_normal_velocities();
     fn0_substep = fn0_substep.array() -
                   dt_substep * stiffness.array() * vn_substep.array();
     fn0_substep = fn0_substep.cwiseMax(T(0.0));
@@ -1807,6 +1885,8 @@ void MultibodyPlant<T>::CalcContactSurfaces(
     const drake::systems::Context<T>& context,
     std::vector<ContactSurface<T>>* contact_surfaces) const {
   DRAKE_DEMAND(contact_surfaces);
+  const ScopedTimer timer(discrete_update_timer(
+      &DiscreteUpdateTimingStatistics::contact_surfaces_time));
 
   const auto& query_object = EvalGeometryQueryInput(context);
 
@@ -1828,6 +1908,8 @@ void MultibodyPlant<double>::CalcHydroelasticWithFallback(
   DRAKE_DEMAND(data != nullptr);
 
   if (num_collision_geometries() > 0) {
+    const ScopedTimer timer(discrete_update_timer(
+        &DiscreteUpdateTimingStatistics::contact_surfaces_time));
     const auto &query_object = EvalGeometryQueryInput(context);
     data->contact_surfaces.clear();
     data->point_pairs.clear();
@@ -1852,6 +1934,8 @@ std::vector<internal::DiscreteContactPair<T>>
 MultibodyPlant<T>::CalcDiscreteContactPairs(
     const systems::Context<T>& context) const {
   if (num_collision_geometries() == 0) return {};
+  const ScopedTimer timer(discrete_update_timer(
+      &DiscreteUpdateTimingStatistics::discrete_contact_pairs_time));
 
   // Only numeric values are supported. We detect that T is a Drake numeric type
   // using scalar_predicate::is_bool. That is true for numeric types and false
@@ -1921,7 +2005,8 @@ void MultibodyPlant<T>::CalcTamsiResults(
     const drake::systems::Context<T>& context0,
     contact_solvers::internal::ContactSolverResults<T>* results) const {
   // Assert this method was called on a context storing discrete state.
-  DRAKE_ASSERT(context0.num_discrete_state_groups() == 1);
+  DRAKE_ASSERT(context0.num_discrete_state_groups() ==
+               (body_sleeping_parameters_ ? 2 : 1));
   DRAKE_ASSERT(context0.num_continuous_states() == 0);
 
   const int nq = this->num_positions();
@@ -1929,6 +2014,8 @@ void MultibodyPlant<T>::CalcTamsiResults(
 
   // Quick exit if there are no moving objects.
   if (nv == 0) return;
+  const ScopedTimer timer(discrete_update_timer(
+      &DiscreteUpdateTimingStatistics::contact_solver_time));
 
   // Get the system state as raw Eigen vectors
   // (solution at the previous time step).
@@ -1998,27 +2085,325 @@ void MultibodyPlant<T>::CalcTamsiResults(
     CallContactSolver(context0.get_time(), v0, M0, minus_tau, phi0,
                       contact_jacobians.Jc, stiffness, damping, mu, results);
   } else {
-    CallTamsiSolver(context0.get_time(), v0, M0, minus_tau, fn0,
-                    contact_jacobians.Jn, contact_jacobians.Jt, stiffness,
-                    damping, mu, results);
+    // Identify contact points so that TAMSI can warm start from the contact
+    // forces of the previous step. Point contact produces a single contact
+    // point per geometry pair.
+    std::vector<TamsiSolverContactId> contact_ids(num_contacts);
+    for (int i = 0; i < num_contacts; ++i) {
+      contact_ids[i].id_A = contact_pairs[i].id_A.get_value();
+      contact_ids[i].id_B = contact_pairs[i].id_B.get_value();
+    }
+    const std::vector<bool> sleeping_trees =
+        CalcSleepingTrees(context0, contact_pairs);
+    if (!contact_islands_enabled_ &&
+        std::find(sleeping_trees.begin(), sleeping_trees.end(), true) ==
+            sleeping_trees.end()) {
+      CallTamsiSolver(tamsi_solver_.get(), context0.get_time(), v0, M0,
+                      minus_tau, fn0, contact_jacobians.Jn,
+                      contact_jacobians.Jt, stiffness, damping, mu,
+                      contact_ids, results);
+    } else {
+      // The awake trees with generalized velocities, grouped into their
+      // contact islands, or into a single island without contact islands.
+      const internal::MultibodyTreeTopology& topology =
+          internal_tree().get_topology();
+      const std::vector<int> tree_islands =
+          contact_islands_enabled_
+              ? CalcTreeIslands(contact_pairs)
+              : std::vector<int>(topology.num_trees(), 0);
+      std::vector<std::vector<int>> islands;
+      std::vector<int> island_index(topology.num_trees(), -1);
+      for (int tree = 0; tree < topology.num_trees(); ++tree) {
+        if (sleeping_trees[tree] || topology.tree_velocities(tree).empty()) {
+          continue;
+        }
+        int& index = island_index[tree_islands[tree]];
+        if (index < 0) {
+          index = islands.size();
+          islands.emplace_back();
+        }
+        islands[index].push_back(tree);
+      }
+      CallTamsiSolverForIslands(
+          islands, contact_pairs, context0.get_time(), v0, M0, minus_tau,
+          fn0, contact_jacobians.Jn, contact_jacobians.Jt, stiffness, damping,
+          mu, contact_ids, results);
+    }
   }
 }
 
 template <typename T>
-void MultibodyPlant<T>::CallTamsiSolver(
+void MultibodyPlant<T>::set_body_sleeping_parameters(
+    const std::optional<BodySleepingParameters>& parameters) {
+  DRAKE_MBP_THROW_IF_FINALIZED();
+  DRAKE_THROW_UNLESS(is_discrete());
+  if (parameters) {
+    DRAKE_THROW_UNLESS(parameters->velocity_threshold > 0);
+    DRAKE_THROW_UNLESS(parameters->num_steps_to_sleep > 0);
+  }
+  body_sleeping_parameters_ = parameters;
+}
+
+template <typename T>
+void MultibodyPlant<T>::set_contact_islands_enabled(bool enabled) {
+  DRAKE_MBP_THROW_IF_FINALIZED();
+  DRAKE_THROW_UNLESS(is_discrete());
+  contact_islands_enabled_ = enabled;
+}
+
+template <typename T>
+void MultibodyPlant<T>::set_contact_island_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  contact_island_num_threads_ = num_threads;
+}
+
+template <typename T>
+bool MultibodyPlant<T>::IsBodySleeping(const systems::Context<T>& context,
+                                       const Body<T>& body) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  this->ValidateContext(context);
+  if (!body_sleeping_parameters_) return false;
+  const int tree =
+      internal_tree().get_topology().body_node_tree(body.node_index());
+  if (tree < 0) return false;
+  return CalcSleepingTrees(context, CalcDiscreteContactPairs(context))[tree];
+}
+
+template <typename T>
+int MultibodyPlant<T>::GetMovingTreeOfGeometry(
+    geometry::GeometryId geometry_id) const {
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+  const Body<T>& body = get_body(geometry_id_to_body_index_.at(geometry_id));
+  const int tree = topology.body_node_tree(body.node_index());
+  if (tree < 0 || topology.tree_velocities(tree).empty()) return -1;
+  return tree;
+}
+
+template <typename T>
+std::vector<int> MultibodyPlant<T>::CalcTreeIslands(
+    const std::vector<internal::DiscreteContactPair<T>>& contact_pairs) const {
+  // Groups the moving trees in contact into islands, with a union-find forest
+  // in which island_parent[tree] == tree for the representative tree of each
+  // island.
+  const int num_trees = internal_tree().get_topology().num_trees();
+  std::vector<int> island_parent(num_trees);
+  std::iota(island_parent.begin(), island_parent.end(), 0);
+  const auto find_island = [&island_parent](int tree) {
+    while (island_parent[tree] != tree) {
+      island_parent[tree] = island_parent[island_parent[tree]];
+      tree = island_parent[tree];
+    }
+    return tree;
+  };
+  for (const internal::DiscreteContactPair<T>& pair : contact_pairs) {
+    const int tree_A = GetMovingTreeOfGeometry(pair.id_A);
+    const int tree_B = GetMovingTreeOfGeometry(pair.id_B);
+    if (tree_A < 0 || tree_B < 0) continue;
+    // The smallest tree represents the island, so that the islands do not
+    // depend on the order of the contact pairs.
+    const int island_A = find_island(tree_A);
+    const int island_B = find_island(tree_B);
+    island_parent[std::max(island_A, island_B)] = std::min(island_A, island_B);
+  }
+  for (int tree = 0; tree < num_trees; ++tree) {
+    island_parent[tree] = find_island(tree);
+  }
+  return island_parent;
+}
+
+template <typename T>
+std::vector<bool> MultibodyPlant<T>::CalcSleepingTrees(
+    const systems::Context<T>& context,
+    const std::vector<internal::DiscreteContactPair<T>>& contact_pairs) const {
+  const int num_trees = internal_tree().get_topology().num_trees();
+  std::vector<bool> sleeping_trees(num_trees, false);
+  if (!body_sleeping_parameters_ || contact_solver_ != nullptr) {
+    return sleeping_trees;
+  }
+  const std::vector<int> tree_islands = CalcTreeIslands(contact_pairs);
+
+  // An island sleeps when all of its trees were at rest long enough, and are
+  // still at rest in `context` (their velocities might have been set).
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+  const VectorX<T>& num_steps_at_rest =
+      context.get_discrete_state(body_sleeping_state_index_).get_value();
+  const VectorX<T> v = GetVelocities(context);
+  std::vector<bool> is_island_at_rest(num_trees, true);
+  for (int tree = 0; tree < num_trees; ++tree) {
+    bool is_at_rest = tree_can_sleep_[tree] &&
+                      ExtractDoubleOrThrow(num_steps_at_rest[tree]) >=
+                          body_sleeping_parameters_->num_steps_to_sleep;
+    for (int i : topology.tree_velocities(tree)) {
+      if (!is_at_rest) break;
+      is_at_rest = std::abs(ExtractDoubleOrThrow(v[i])) <
+                   body_sleeping_parameters_->velocity_threshold;
+    }
+    if (!is_at_rest) is_island_at_rest[tree_islands[tree]] = false;
+  }
+  for (int tree = 0; tree < num_trees; ++tree) {
+    sleeping_trees[tree] =
+        tree_can_sleep_[tree] && is_island_at_rest[tree_islands[tree]];
+  }
+  return sleeping_trees;
+}
+
+template <typename T>
+void MultibodyPlant<T>::CallTamsiSolverForIslands(
+    const std::vector<std::vector<int>>& islands,
+    const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
     const T& time0, const VectorX<T>& v0, const MatrixX<T>& M0,
     const VectorX<T>& minus_tau, const VectorX<T>& fn0, const MatrixX<T>& Jn,
     const MatrixX<T>& Jt, const VectorX<T>& stiffness,
     const VectorX<T>& damping, const VectorX<T>& mu,
+    const std::vector<TamsiSolverContactId>& contact_ids,
+    contact_solvers::internal::ContactSolverResults<T>* results) const {
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+  const int nv = num_velocities();
+  const int num_contacts = contact_pairs.size();
+  const int num_islands = islands.size();
+
+  // The generalized velocities of each island, in increasing order.
+  std::vector<int> island_of_tree(topology.num_trees(), -1);
+  std::vector<std::vector<int>> island_velocities(num_islands);
+  for (int k = 0; k < num_islands; ++k) {
+    for (int tree : islands[k]) {
+      island_of_tree[tree] = k;
+      const std::vector<int>& v = topology.tree_velocities(tree);
+      island_velocities[k].insert(island_velocities[k].end(), v.begin(),
+                                  v.end());
+    }
+    std::sort(island_velocities[k].begin(), island_velocities[k].end());
+  }
+
+  // The contacts of each island. Since the islands are not in contact with
+  // each other, these do not involve the velocities of other islands.
+  const auto find_island = [&](geometry::GeometryId geometry_id) {
+    const int tree = GetMovingTreeOfGeometry(geometry_id);
+    return tree >= 0 ? island_of_tree[tree] : -1;
+  };
+  std::vector<std::vector<int>> island_contacts(num_islands);
+  for (int i = 0; i < num_contacts; ++i) {
+    const int island_A = find_island(contact_pairs[i].id_A);
+    const int island_B = find_island(contact_pairs[i].id_B);
+    DRAKE_ASSERT(island_A < 0 || island_B < 0 || island_A == island_B);
+    const int island = std::max(island_A, island_B);
+    if (island >= 0) island_contacts[island].push_back(i);
+  }
+
+  // The solvers are prepared on the calling thread, so that the parallel loop
+  // below only writes into the storage of its own islands.
+  if (island_tamsi_solvers_.empty()) {
+    island_tamsi_solvers_.resize(topology.num_trees());
+    island_tamsi_solver_num_velocities_.resize(topology.num_trees(), -1);
+  }
+  for (int k = 0; k < num_islands; ++k) {
+    const int key = islands[k].front();
+    const int island_nv = island_velocities[k].size();
+    if (island_tamsi_solver_num_velocities_[key] != island_nv) {
+      island_tamsi_solvers_[key] = std::make_unique<TamsiSolver<T>>(island_nv);
+      island_tamsi_solver_num_velocities_[key] = island_nv;
+    }
+    island_tamsi_solvers_[key]->set_solver_parameters(
+        tamsi_solver_->get_solver_parameters());
+  }
+
+  // Solves the problem restricted to each island.
+  std::vector<contact_solvers::internal::ContactSolverResults<T>>
+      island_results(num_islands);
+  const auto solve_island = [&](int k) {
+    const std::vector<int>& velocities = island_velocities[k];
+    const std::vector<int>& contacts = island_contacts[k];
+    const int island_nv = velocities.size();
+    const int island_nc = contacts.size();
+    MatrixX<T> M0_island(island_nv, island_nv);
+    VectorX<T> v0_island(island_nv);
+    VectorX<T> minus_tau_island(island_nv);
+    for (int j = 0; j < island_nv; ++j) {
+      for (int i = 0; i < island_nv; ++i) {
+        M0_island(i, j) = M0(velocities[i], velocities[j]);
+      }
+      v0_island[j] = v0[velocities[j]];
+      minus_tau_island[j] = minus_tau[velocities[j]];
+    }
+    MatrixX<T> Jn_island(island_nc, island_nv);
+    MatrixX<T> Jt_island(2 * island_nc, island_nv);
+    VectorX<T> fn0_island(island_nc);
+    VectorX<T> stiffness_island(island_nc);
+    VectorX<T> damping_island(island_nc);
+    VectorX<T> mu_island(island_nc);
+    std::vector<TamsiSolverContactId> contact_ids_island(island_nc);
+    for (int c = 0; c < island_nc; ++c) {
+      const int i = contacts[c];
+      for (int j = 0; j < island_nv; ++j) {
+        Jn_island(c, j) = Jn(i, velocities[j]);
+        Jt_island(2 * c, j) = Jt(2 * i, velocities[j]);
+        Jt_island(2 * c + 1, j) = Jt(2 * i + 1, velocities[j]);
+      }
+      fn0_island[c] = fn0[i];
+      stiffness_island[c] = stiffness[i];
+      damping_island[c] = damping[i];
+      mu_island[c] = mu[i];
+      contact_ids_island[c] = contact_ids[i];
+    }
+    CallTamsiSolver(island_tamsi_solvers_[islands[k].front()].get(), time0,
+                    v0_island, M0_island, minus_tau_island, fn0_island,
+                    Jn_island, Jt_island, stiffness_island, damping_island,
+                    mu_island, contact_ids_island, &island_results[k]);
+  };
+  drake::internal::StaticParallelForRange(
+      num_islands, contact_island_num_threads_,
+      [&](int, int begin, int end) {
+        for (int k = begin; k < end; ++k) solve_island(k);
+      });
+
+  // Scatters the results back into the full problem.
+  results->Resize(nv, num_contacts);
+  results->v_next.setZero();
+  results->tau_contact.setZero();
+  results->fn.setZero();
+  results->ft.setZero();
+  results->vn.setZero();
+  results->vt.setZero();
+  for (int k = 0; k < num_islands; ++k) {
+    const std::vector<int>& velocities = island_velocities[k];
+    const std::vector<int>& contacts = island_contacts[k];
+    const contact_solvers::internal::ContactSolverResults<T>& island_result =
+        island_results[k];
+    for (int j = 0; j < static_cast<int>(velocities.size()); ++j) {
+      results->v_next[velocities[j]] = island_result.v_next[j];
+      results->tau_contact[velocities[j]] = island_result.tau_contact[j];
+    }
+    for (int c = 0; c < static_cast<int>(contacts.size()); ++c) {
+      const int i = contacts[c];
+      results->fn[i] = island_result.fn[c];
+      results->vn[i] = island_result.vn[c];
+      results->ft.template segment<2>(2 * i) =
+          island_result.ft.template segment<2>(2 * c);
+      results->vt.template segment<2>(2 * i) =
+          island_result.vt.template segment<2>(2 * c);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyPlant<T>::CallTamsiSolver(
+    TamsiSolver<T>* solver, const T& time0, const VectorX<T>& v0,
+    const MatrixX<T>& M0, const VectorX<T>& minus_tau, const VectorX<T>& fn0,
+    const MatrixX<T>& Jn, const MatrixX<T>& Jt, const VectorX<T>& stiffness,
+    const VectorX<T>& damping, const VectorX<T>& mu,
+    const std::vector<TamsiSolverContactId>& contact_ids,
     contact_solvers::internal::ContactSolverResults<T>* results) const {
   // Solve for v and the contact forces.
   TamsiSolverResult info{TamsiSolverResult::kMaxIterationsReached};
 
-  TamsiSolverParameters params = tamsi_solver_->get_solver_parameters();
+  TamsiSolverParameters params = solver->get_solver_parameters();
   // A nicely converged NR iteration should not take more than 20 iterations.
   // Otherwise we attempt a smaller time step.
   params.max_iterations = 20;
-  tamsi_solver_->set_solver_parameters(params);
+  solver->set_solver_parameters(params);
 
   // We attempt to compute the update during the time interval dt using a
   // progressively larger number of sub-steps (i.e each using a smaller time
@@ -2031,8 +2416,8 @@ void MultibodyPlant<T>::CallTamsiSolver(
   int num_substeps = 0;
   do {
     ++num_substeps;
-    info = SolveUsingSubStepping(num_substeps, M0, Jn, Jt, minus_tau, stiffness,
-                                 damping, mu, v0, fn0);
+    info = SolveUsingSubStepping(solver, num_substeps, M0, Jn, Jt, minus_tau,
+                                 stiffness, damping, mu, v0, fn0, contact_ids);
   } while (info != TamsiSolverResult::kSuccess &&
            num_substeps < kNumMaxSubTimeSteps);
 
@@ -2060,19 +2445,20 @@ void MultibodyPlant<T>::CallTamsiSolver(
   // file for analysis.
 
   // Update the results.
-  results->v_next = tamsi_solver_->get_generalized_velocities();
-  results->fn = tamsi_solver_->get_normal_forces();
-  results->ft = tamsi_solver_->get_friction_forces();
-  results->vn = tamsi_solver_->get_normal_velocities();
-  results->vt = tamsi_solver_->get_tangential_velocities();
-  results->tau_contact = tamsi_solver_->get_generalized_contact_forces();
+  results->v_next = solver->get_generalized_velocities();
+  results->fn = solver->get_normal_forces();
+  results->ft = solver->get_friction_forces();
+  results->vn = solver->get_normal_velocities();
+  results->vt = solver->get_tangential_velocities();
+  results->tau_contact = solver->get_generalized_contact_forces();
 }
 
 template <>
 void MultibodyPlant<symbolic::Expression>::CallContactSolver(
     const symbolic::Expression&, const VectorX<symbolic::Expression>&,
     const MatrixX<symbolic::Expression>&, const VectorX<symbolic::Expression>&,
-    const VectorX<symbolic::Expression>&, const MatrixX<symbolic::Expression>&,
+    const VectorX<symbolic::Expression>&,
+    const Eigen::SparseMatrix<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&, const VectorX<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&,
     contact_solvers::internal::ContactSolverResults<symbolic::Expression>*)
@@ -2084,28 +2470,25 @@ void MultibodyPlant<symbolic::Expression>::CallContactSolver(
 template <typename T>
 void MultibodyPlant<T>::CallContactSolver(
     const T& time0, const VectorX<T>& v0, const MatrixX<T>& M0,
-    const VectorX<T>& minus_tau, const VectorX<T>& phi0, const MatrixX<T>& Jc,
-    const VectorX<T>& stiffness, const VectorX<T>& damping,
-    const VectorX<T>& mu,
+    const VectorX<T>& minus_tau, const VectorX<T>& phi0,
+    const Eigen::SparseMatrix<T>& Jc, const VectorX<T>& stiffness,
+    const VectorX<T>& damping, const VectorX<T>& mu,
     contact_solvers::internal::ContactSolverResults<T>* results) const {
-  // Tolerance larger than machine epsilon by an arbitrary factor. Just large
-  // enough so that entries close to machine epsilon, due to round-off errors,
-  // still get pruned.
-  const double kPruneTolerance = 20 * std::numeric_limits<double>::epsilon();
-  // TODO(amcastro-tri): Here MultibodyPlant should provide an actual O(n)
-  // operator per #12210.
-  const Eigen::SparseMatrix<T> Jc_sparse = Jc.sparseView(kPruneTolerance);
-  const contact_solvers::internal::SparseLinearOperator<T> Jc_op("Jc",
-                                                                 &Jc_sparse);
+  // Jc is assembled with only the columns along the kinematic paths of the
+  // bodies in contact, see CalcNormalAndTangentContactJacobians().
+  const contact_solvers::internal::SparseLinearOperator<T> Jc_op("Jc", &Jc);
 
+  // M⁻¹ is applied with the LTDL factorization of M0, which exploits the
+  // sparsity induced by the tree topology of the model. See
+  // MassMatrixFactorization for details.
   class MassMatrixInverseOperator
       : public contact_solvers::internal::LinearOperator<T> {
    public:
-    MassMatrixInverseOperator(const std::string& name, const MatrixX<T>* M)
-        : contact_solvers::internal::LinearOperator<T>(name) {
-      DRAKE_DEMAND(M != nullptr);
-      nv_ = M->rows();
-      M_ldlt_ = M->ldlt();
+    MassMatrixInverseOperator(const std::string& name,
+                              MassMatrixFactorization<T> M_factorization)
+        : contact_solvers::internal::LinearOperator<T>(name),
+          M_factorization_(std::move(M_factorization)) {
+      nv_ = M_factorization_.size();
       // TODO(sherm1) Eliminate heap allocation.
       tmp_.resize(nv_);
     }
@@ -2118,17 +2501,19 @@ void MultibodyPlant<T>::CallContactSolver(
     void DoMultiply(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
                     Eigen::SparseVector<T>* y) const final {
       tmp_ = VectorX<T>(x);
-      *y = M_ldlt_.solve(tmp_).sparseView();
+      *y = M_factorization_.Solve(tmp_).sparseView();
     }
     void DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
                     VectorX<T>* y) const final {
-      *y = M_ldlt_.solve(x);
+      *y = M_factorization_.Solve(x);
     }
     int nv_;
     mutable VectorX<T> tmp_;  // temporary workspace.
-    Eigen::LDLT<MatrixX<T>> M_ldlt_;
+    MassMatrixFactorization<T> M_factorization_;
   };
-  MassMatrixInverseOperator Minv_op("Minv", &M0);
+  MassMatrixInverseOperator Minv_op(
+      "Minv", MassMatrixFactorization<T>(
+                  M0, internal_tree().CalcVelocityParents()));
 
   // Perform the "predictor" step, in the absence of contact forces. See
   // ContactSolver's class documentation for details.
@@ -2308,10 +2693,12 @@ void MultibodyPlant<T>::DoCalcForwardDynamicsDiscrete(
 }
 
 template<typename T>
-void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
+void MultibodyPlant<T>::CalcNextDiscreteState(
     const drake::systems::Context<T>& context0,
-    const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>&,
-    drake::systems::DiscreteValues<T>* updates) const {
+    EigenPtr<VectorX<T>> x_next) const {
+  DRAKE_DEMAND(x_next != nullptr);
+  DRAKE_DEMAND(x_next->size() == this->num_multibody_states());
+
   // Get the system state as raw Eigen vectors
   // (solution at the previous time step).
   auto x0 = context0.get_discrete_state(0).get_value();
@@ -2325,15 +2712,79 @@ void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
   // TODO(amcastro-tri): Consider replacing this by:
   //   const VectorX<T>& v_next = solver_results.v_next;
   // to avoid additional vector operations.
-  const VectorX<T>& v_next = v0 + time_step() * vdot;
+  // With body sleeping this is done, so that the sleeping trees, whose
+  // velocities are exactly zero, do not drift due to round-off errors.
+  const VectorX<T>& v_next = body_sleeping_parameters_
+                                 ? EvalTamsiResults(context0).v_next
+                                 : VectorX<T>(v0 + time_step() * vdot);
 
   VectorX<T> qdot_next(this->num_positions());
   MapVelocityToQDot(context0, v_next, &qdot_next);
-  VectorX<T> q_next = q0 + time_step() * qdot_next;
+  x_next->topRows(this->num_positions()) = q0 + time_step() * qdot_next;
+  x_next->bottomRows(this->num_velocities()) = v_next;
+}
 
+template<typename T>
+void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
+    const drake::systems::Context<T>& context0,
+    const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>&,
+    drake::systems::DiscreteValues<T>* updates) const {
+  const ScopedTimer timer(discrete_update_timer(
+      &DiscreteUpdateTimingStatistics::discrete_update_time));
+  if (discrete_update_timing_enabled_) {
+    ++discrete_update_timing_statistics_.num_discrete_updates;
+  }
   VectorX<T> x_next(this->num_multibody_states());
-  x_next << q_next, v_next;
+  CalcNextDiscreteState(context0, &x_next);
   updates->get_mutable_vector(0).SetFromVector(x_next);
+
+  if (body_sleeping_parameters_) {
+    // Counts the consecutive updates at rest of each tree. The velocities of
+    // the sleeping trees are zero, and so these remain at rest.
+    const internal::MultibodyTreeTopology& topology =
+        internal_tree().get_topology();
+    const VectorX<T>& num_steps_at_rest =
+        context0.get_discrete_state(body_sleeping_state_index_).get_value();
+    auto v_next = x_next.tail(this->num_velocities());
+    BasicVector<T>& num_steps_at_rest_next =
+        updates->get_mutable_vector(body_sleeping_state_index_);
+    for (int tree = 0; tree < topology.num_trees(); ++tree) {
+      bool is_at_rest = tree_can_sleep_[tree];
+      for (int v : topology.tree_velocities(tree)) {
+        if (!is_at_rest) break;
+        is_at_rest = std::abs(ExtractDoubleOrThrow(v_next[v])) <
+                     body_sleeping_parameters_->velocity_threshold;
+      }
+      // The count saturates once the tree can sleep.
+      const double count = ExtractDoubleOrThrow(num_steps_at_rest[tree]);
+      num_steps_at_rest_next[tree] =
+          is_at_rest
+              ? std::min(count + 1,
+                         1.0 * body_sleeping_parameters_->num_steps_to_sleep)
+              : 0.0;
+    }
+  }
+}
+
+template<typename T>
+void MultibodyPlant<T>::CalcDiscreteVariableUpdatesBatch(
+    const std::vector<const systems::Context<T>*>& contexts,
+    MatrixX<T>* x_next) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(is_discrete());
+  DRAKE_THROW_UNLESS(x_next != nullptr);
+  // Validate every context up front so that a bad entry does not leave
+  // x_next partially written.
+  for (const systems::Context<T>* context : contexts) {
+    DRAKE_THROW_UNLESS(context != nullptr);
+    this->ValidateContext(*context);
+  }
+  const int num_environments = contexts.size();
+  x_next->resize(this->num_multibody_states(), num_environments);
+  for (int i = 0; i < num_environments; ++i) {
+    auto x_next_i = x_next->col(i);
+    CalcNextDiscreteState(*contexts[i], &x_next_i);
+  }
 }
 
 template<typename T>
@@ -2345,6 +2796,30 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
     this->DeclarePeriodicDiscreteUpdate(time_step_);
   }
 
+  if (body_sleeping_parameters_) {
+    // Only trees with a free body at the root and without actuators can sleep.
+    // The roots of the trees are the children of the world, in order.
+    const internal::MultibodyTreeTopology& topology =
+        internal_tree().get_topology();
+    const std::vector<internal::BodyNodeIndex>& tree_roots =
+        topology.get_body_node(internal::BodyNodeIndex(0)).child_nodes;
+    DRAKE_DEMAND(static_cast<int>(tree_roots.size()) == topology.num_trees());
+    tree_can_sleep_.resize(topology.num_trees());
+    for (int tree = 0; tree < topology.num_trees(); ++tree) {
+      const BodyIndex root = topology.get_body_node(tree_roots[tree]).body;
+      tree_can_sleep_[tree] = get_body(root).is_floating();
+    }
+    for (JointActuatorIndex actuator_index(0);
+         actuator_index < num_actuators(); ++actuator_index) {
+      const Body<T>& body =
+          get_joint_actuator(actuator_index).joint().child_body();
+      tree_can_sleep_[topology.body_node_tree(body.node_index())] = false;
+    }
+    // The number of consecutive discrete updates each tree has been at rest.
+    body_sleeping_state_index_ =
+        this->DeclareDiscreteState(topology.num_trees());
+  }
+
   DeclareCacheEntries();
 
   // Declare per model instance actuation ports.
@@ -2602,19 +3077,12 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
         // TODO(amcastro-tri): consider caching contact_pairs.
         const std::vector<internal::DiscreteContactPair<T>> contact_pairs =
             CalcDiscreteContactPairs(context);
+        const ScopedTimer timer(discrete_update_timer(
+            &DiscreteUpdateTimingStatistics::contact_jacobians_time));
         this->CalcNormalAndTangentContactJacobians(
             context, contact_pairs,
             &contact_jacobians_cache.Jn, &contact_jacobians_cache.Jt,
-            &contact_jacobians_cache.R_WC_list);
-        auto& Jc = contact_jacobians_cache.Jc;
-        const auto& Jn = contact_jacobians_cache.Jn;
-        const auto& Jt = contact_jacobians_cache.Jt;
-        Jc.resize(3 * Jn.rows(), num_velocities());
-        for (int i = 0; i < Jn.rows(); ++i) {
-          Jc.row(3 * i) = Jt.row(2 * i);
-          Jc.row(3 * i + 1) = Jt.row(2 * i + 1);
-          Jc.row(3 * i + 2) = Jn.row(i);
-        }
+            &contact_jacobians_cache.R_WC_list, &contact_jacobians_cache.Jc);
       },
       // We explicitly declare the configuration dependence even though the
       // Eval() above implicitly evaluates configuration dependent cache
@@ -2969,8 +3437,7 @@ void MultibodyPlant<T>::CalcFramePoseOutput(
 
     // NOTE: The GeometryFrames for each body were registered in the world
     // frame, so we report poses in the world frame.
-    poses->set_value(body_index_to_frame_id_.at(body_index),
-                     pc.get_X_WB(body.node_index()));
+    poses->set_value(it.second, pc.get_X_WB(body.node_index()));
   }
 }
 
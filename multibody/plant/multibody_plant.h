@@ -85,6 +85,52 @@ enum class ContactModel {
   kHydroelasticWithFallback
 };
 
+/// Wall clock times, in seconds, spent by a discrete MultibodyPlant in the main
+/// stages of its discrete updates. They are accumulated while timing is enabled
+/// with MultibodyPlant::set_discrete_update_timing_enabled().
+///
+/// The stages are nested: the time of each discrete update includes the time
+/// of all the stages evaluated within it, and the contact solver time includes
+/// the time spent computing contact pairs and contact Jacobians when these are
+/// not already cached. Stages evaluated outside a discrete update, e.g. when
+/// the contact results output port is evaluated, are also accumulated.
+struct DiscreteUpdateTimingStatistics {
+  /// The number of timed discrete updates.
+  int num_discrete_updates{0};
+
+  /// The total time spent in discrete updates.
+  double discrete_update_time{0};
+
+  /// The total time spent computing discrete contact pairs, including the
+  /// point contact geometric queries.
+  double discrete_contact_pairs_time{0};
+
+  /// The total time spent computing hydroelastic contact surfaces.
+  double contact_surfaces_time{0};
+
+  /// The total time spent computing contact Jacobians.
+  double contact_jacobians_time{0};
+
+  /// The total time spent computing the contact solver results, including the
+  /// TAMSI iterations.
+  double contact_solver_time{0};
+
+  /// The total time spent computing ContactResults from the solver results.
+  double contact_results_time{0};
+};
+
+/// The parameters of the body sleeping of a discrete MultibodyPlant, see
+/// MultibodyPlant::set_body_sleeping_parameters().
+struct BodySleepingParameters {
+  /// A tree of bodies is at rest after a discrete update when the magnitude of
+  /// each of its generalized velocities is below this threshold.
+  double velocity_threshold{1e-3};
+
+  /// The number of consecutive discrete updates that a tree must be at rest
+  /// before it can sleep.
+  int num_steps_to_sleep{10};
+};
+
 /// @cond
 // Helper macro to throw an exception within methods that should not be called
 // post-finalize.
@@ -782,6 +828,10 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     X_WB_default_list_ = other.X_WB_default_list_;
     contact_model_ = other.contact_model_;
     penetration_allowance_ = other.penetration_allowance_;
+    discrete_update_timing_enabled_ = other.discrete_update_timing_enabled_;
+    body_sleeping_parameters_ = other.body_sleeping_parameters_;
+    contact_islands_enabled_ = other.contact_islands_enabled_;
+    contact_island_num_threads_ = other.contact_island_num_threads_;
     DeclareSceneGraphPorts();
 
     // MultibodyTree::CloneToScalar() already called MultibodyTree::Finalize()
@@ -1656,6 +1706,139 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   }
   /// @} <!-- Contact modeling -->
 
+  /// @name                   Performance statistics
+  /// A discrete %MultibodyPlant can time the main stages of its discrete
+  /// updates, to find out which of them dominates the cost of a time step. See
+  /// DiscreteUpdateTimingStatistics for details. Timing is disabled by default
+  /// and adds no overhead while disabled. The statistics are stored in the
+  /// plant rather than in a Context, and therefore timing should not be enabled
+  /// while this plant is used from multiple threads.
+  /// @{
+
+  /// Enables or disables the timing of discrete updates. Enabling timing does
+  /// not reset the statistics accumulated so far.
+  /// @throws std::exception if `this` plant is not discrete.
+  void set_discrete_update_timing_enabled(bool enabled) {
+    DRAKE_THROW_UNLESS(is_discrete());
+    discrete_update_timing_enabled_ = enabled;
+  }
+
+  /// Returns `true` if the timing of discrete updates is enabled.
+  bool get_discrete_update_timing_enabled() const {
+    return discrete_update_timing_enabled_;
+  }
+
+  /// Returns the timing statistics accumulated since the last call to
+  /// ResetDiscreteUpdateTimingStatistics().
+  const DiscreteUpdateTimingStatistics&
+  get_discrete_update_timing_statistics() const {
+    return discrete_update_timing_statistics_;
+  }
+
+  /// Resets all timing statistics to zero.
+  void ResetDiscreteUpdateTimingStatistics() {
+    discrete_update_timing_statistics_ = {};
+  }
+  /// @} <!-- Performance statistics -->
+
+  /// @anchor mbp_body_sleeping
+  /// @name                   Body sleeping
+  /// In scenes where most free bodies are at rest, e.g. objects in a bin, a
+  /// discrete %MultibodyPlant can put the resting bodies to sleep so that they
+  /// are excluded from the contact solve. Body sleeping is disabled by default.
+  ///
+  /// Sleeping applies to the trees of the model, each formed by a child body
+  /// of the world and all of its outboard bodies. Only trees whose root is a
+  /// free body and that have no actuated joints can sleep. A tree is at rest
+  /// after a discrete update when all of its generalized velocities are below
+  /// BodySleepingParameters::velocity_threshold in magnitude. The plant counts
+  /// the consecutive updates each tree has been at rest in an additional group
+  /// of its discrete state.
+  ///
+  /// At each discrete update, the trees in contact with each other, directly
+  /// or through other trees, form a contact island. Contact with the world or
+  /// with anchored bodies does not join islands. An island sleeps when all of
+  /// its trees can sleep and have been at rest for at least
+  /// BodySleepingParameters::num_steps_to_sleep updates. The generalized
+  /// velocities of a sleeping tree are set to zero, its generalized positions
+  /// do not change and its contacts are excluded from the contact solve, with
+  /// zero forces reported in the contact results. A sleeping tree wakes up as
+  /// soon as its island is awake, i.e. when it is in contact with an awake
+  /// tree or when the velocities of a tree of the island are set above the
+  /// threshold, and it stays awake while it is not at rest. Forces applied
+  /// through the input ports do not wake up a sleeping tree.
+  ///
+  /// Sleeping is only applied when the discrete updates use the TAMSI solver,
+  /// i.e. not with set_contact_solver().
+  /// @{
+
+  /// Enables body sleeping with the given `parameters`, or disables it when
+  /// `parameters` is std::nullopt.
+  /// @throws std::exception if `this` plant is not discrete, if it is
+  ///   finalized, or if the parameters are not positive.
+  void set_body_sleeping_parameters(
+      const std::optional<BodySleepingParameters>& parameters);
+
+  /// Returns the parameters set with set_body_sleeping_parameters(), or
+  /// std::nullopt if body sleeping is disabled.
+  const std::optional<BodySleepingParameters>& get_body_sleeping_parameters()
+      const {
+    return body_sleeping_parameters_;
+  }
+
+  /// Returns `true` if `body` sleeps during the discrete update of `context`,
+  /// i.e. if the generalized velocities of its tree are frozen at zero. This
+  /// is always `false` when body sleeping is disabled.
+  /// @throws std::exception if called pre-finalize.
+  bool IsBodySleeping(const systems::Context<T>& context,
+                      const Body<T>& body) const;
+  /// @} <!-- Body sleeping -->
+
+  /// @name                   Contact islands
+  /// Scenes often comprise groups of bodies that do not interact with each
+  /// other, e.g. objects in separate bins or separate robots. A discrete
+  /// %MultibodyPlant can solve the contact problem of each of these groups
+  /// independently, and optionally in parallel, so that the cost of the
+  /// contact solve grows with the size of the groups rather than with the size
+  /// of the whole scene. This is disabled by default.
+  ///
+  /// At each discrete update, the trees of the model that are in contact with
+  /// each other, directly or through other trees, form a contact island, see
+  /// @ref mbp_body_sleeping "Body sleeping" for the definition of the trees.
+  /// A tree that is not in contact with another tree forms an island on its
+  /// own. Since the trees of different islands are coupled neither by the mass
+  /// matrix nor by contact, each island is solved with its own TAMSI problem
+  /// and the results are assembled into the results of the whole plant. These
+  /// match the results of a single solve of the whole plant up to the solver
+  /// tolerances, and do not depend on the number of threads.
+  ///
+  /// Contact islands are only used when the discrete updates use the TAMSI
+  /// solver, i.e. not with set_contact_solver().
+  /// @{
+
+  /// Enables or disables the independent solve of each contact island.
+  /// @throws std::exception if `this` plant is not discrete or if it is
+  ///   finalized.
+  void set_contact_islands_enabled(bool enabled);
+
+  /// Returns `true` if the contact islands are solved independently.
+  /// @see set_contact_islands_enabled().
+  bool get_contact_islands_enabled() const { return contact_islands_enabled_; }
+
+  /// Sets the number of threads used to solve the contact islands, when
+  /// enabled with set_contact_islands_enabled(). The default of 1 solves the
+  /// islands sequentially on the calling thread. This can be called
+  /// post-finalize, since it does not change the results.
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_contact_island_num_threads(int num_threads);
+
+  /// Returns the number of threads used to solve the contact islands.
+  /// @see set_contact_island_num_threads().
+  int get_contact_island_num_threads() const {
+    return contact_island_num_threads_;
+  }
+  /// @} <!-- Contact islands -->
+
   /// @anchor mbp_state_accessors_and_mutators
   /// @name               State accessors and mutators
   /// The following state methods allow getting and setting the kinematic state
@@ -1944,6 +2127,7 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
           context, state, internal_tree().get_body(index),
           X_WB_default_list_[index].template cast<T>());
     }
+    ResetBodySleepingState(state);
   }
 
   /// Assigns random values to all elements of the state, by drawing samples
@@ -1958,6 +2142,7 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     DRAKE_MBP_THROW_IF_NOT_FINALIZED();
     CheckValidState(state);
     internal_tree().SetRandomState(context, state, generator);
+    ResetBodySleepingState(state);
   }
 
   /// Returns a vector of actuation values for `model_instance` from a
@@ -2480,6 +2665,137 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
         context, known_vdot, external_forces);
   }
 
+  /// Computes the partial derivatives of the inverse dynamics generalized
+  /// forces <pre>
+  ///   tau_id(q, v, v̇) = M(q)v̇ + C(q, v)v - tau_g(q)
+  /// </pre>
+  /// with respect to the generalized positions q and velocities v, where
+  /// `tau_g(q)` are the generalized forces due to gravity, see
+  /// CalcGravityGeneralizedForces(). These are the rigid body dynamics terms
+  /// only; forces from force elements, joint damping, actuation and contact
+  /// are not included. The partial derivative with respect to v̇ is the mass
+  /// matrix, see CalcMassMatrix().
+  ///
+  /// The derivatives are computed analytically by differentiating the
+  /// recursive Newton-Euler algorithm [Carpentier 2018], in `O(n²)` time
+  /// with n the number of generalized velocities. This is much faster than
+  /// evaluating CalcInverseDynamics() on an AutoDiffXd model.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] known_vdot
+  ///   A vector with the known generalized accelerations `vdot` for the full
+  ///   model.
+  /// @param[out] dtau_dq
+  ///   On output, the `nv x nq` matrix ∂tau_id/∂q. It must be a valid
+  ///   (non-null) pointer to a properly sized matrix.
+  /// @param[out] dtau_dv
+  ///   On output, the `nv x nv` matrix ∂tau_id/∂v. It must be a valid
+  ///   (non-null) pointer to a properly sized matrix.
+  ///
+  /// @throws std::exception if the model has a joint other than a
+  ///   RevoluteJoint, a PrismaticJoint or a WeldJoint (which implies that
+  ///   nq = nv), including the joint of a floating base.
+  ///
+  /// - [Carpentier 2018] Carpentier, J. and Mansard, N., 2018. Analytical
+  ///   derivatives of rigid body dynamics algorithms. In Robotics: Science
+  ///   and Systems.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv) const {
+    DRAKE_DEMAND(dtau_dq != nullptr);
+    DRAKE_DEMAND(dtau_dv != nullptr);
+    internal_tree().CalcInverseDynamicsDerivatives(
+        context, known_vdot, dtau_dq, dtau_dv);
+  }
+
+  /// Computes the generalized accelerations v̇ that satisfy the equations of
+  /// motion <pre>
+  ///   M(q) v̇ + C(q, v) v = tau_app + ∑ (Jv_V_WBᵀ(q) ⋅ Fapp_Bo_W)
+  /// </pre>
+  /// for the state stored in `context` and the applied forces `forces`, which
+  /// store the generalized forces `tau_app` and the spatial forces
+  /// `Fapp_Bo_W`, see CalcInverseDynamics(). Unlike the dynamics of the full
+  /// model, only `forces` are applied; use e.g.
+  /// CalcForceElementsContribution() to include the forces due to force
+  /// elements, including gravity.
+  ///
+  /// The accelerations are computed in `O(n)` with the Articulated Body
+  /// Algorithm. Its tip-to-base pass computing the articulated body inertias,
+  /// which only depend on q, is cached in `context`, and so are the terms that
+  /// only depend on q and v. Therefore repeated calls with the same `context`
+  /// and different `forces` (e.g. within the iterations of an implicit time
+  /// stepping scheme) only perform the passes that depend on `forces`.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] forces
+  ///   The applied forces. It must be compatible with this model, per
+  ///   MultibodyForces::CheckHasRightSizeForModel().
+  /// @param[out] vdot
+  ///   On output, the generalized accelerations v̇. It must be a valid
+  ///   (non-null) pointer to a vector of size num_velocities().
+  /// @throws std::exception if `forces` is not compatible with this model or
+  ///   if `vdot` is nullptr or not of size num_velocities().
+  void CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+      const systems::Context<T>& context, const MultibodyForces<T>& forces,
+      EigenPtr<VectorX<T>> vdot) const {
+    DRAKE_THROW_UNLESS(vdot != nullptr);
+    DRAKE_THROW_UNLESS(vdot->size() == num_velocities());
+    // TODO(amcastro-tri): Heap allocation here. Get rid of it.
+    internal::AccelerationKinematicsCache<T> ac(
+        internal_tree().get_topology());
+    internal_tree().CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+        context, forces, &ac);
+    *vdot = ac.get_vdot();
+  }
+
+  /// Computes the generalized accelerations <pre>
+  ///   v̇(q, v) = M(q)⁻¹ (tau_applied + tau_g(q) - C(q, v)v)
+  /// </pre>
+  /// for a given vector of applied generalized forces `tau_applied`, together
+  /// with their partial derivatives with respect to the generalized positions
+  /// q and velocities v, holding `tau_applied` fixed. As for
+  /// CalcInverseDynamicsDerivatives(), only the rigid body dynamics terms and
+  /// gravity are included; in particular, the accelerations differ from those
+  /// of the full model when it also has force elements, joint damping or
+  /// contact (the forces from those can be included in `tau_applied`, but
+  /// their derivatives are not). The partial derivative with respect to
+  /// `tau_applied` is M(q)⁻¹.
+  ///
+  /// The derivatives are obtained from those of the inverse dynamics as <pre>
+  ///   ∂v̇/∂x = -M(q)⁻¹ ∂tau_id/∂x(q, v, v̇),  for x = q and x = v,
+  /// </pre>
+  /// see [Carpentier 2018], at the cost of a single factorization of the mass
+  /// matrix.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] tau_applied
+  ///   The vector of applied generalized forces, of size num_velocities().
+  /// @param[out] vdot
+  ///   On output, the generalized accelerations v̇. It must be a valid
+  ///   (non-null) pointer to a vector of size num_velocities().
+  /// @param[out] dvdot_dq
+  ///   On output, the `nv x nq` matrix ∂v̇/∂q. It must be a valid (non-null)
+  ///   pointer to a properly sized matrix.
+  /// @param[out] dvdot_dv
+  ///   On output, the `nv x nv` matrix ∂v̇/∂v. It must be a valid (non-null)
+  ///   pointer to a properly sized matrix.
+  ///
+  /// @throws std::exception for the same models as
+  /// CalcInverseDynamicsDerivatives().
+  void CalcForwardDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& tau_applied,
+      EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+      EigenPtr<MatrixX<T>> dvdot_dv) const {
+    DRAKE_DEMAND(vdot != nullptr);
+    DRAKE_DEMAND(dvdot_dq != nullptr);
+    DRAKE_DEMAND(dvdot_dv != nullptr);
+    internal_tree().CalcForwardDynamicsDerivatives(
+        context, tau_applied, vdot, dvdot_dq, dvdot_dv);
+  }
+
   /// Computes the combined force contribution of ForceElement objects in the
   /// model. A ForceElement can apply forces as a spatial force per body or as
   /// generalized forces, depending on the ForceElement model.
@@ -2588,6 +2904,34 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     DRAKE_DEMAND(v != nullptr);
     internal_tree().MapQDotToVelocity(context, qdot, v);
   }
+
+  /// (Advanced) Batched discrete update for a discrete %MultibodyPlant (see
+  /// is_discrete()). For each context in `contexts`, this method computes the
+  /// state `[q; v]` that results from advancing that context by a single
+  /// time step, exactly as a periodic discrete update of `this` plant would.
+  /// This is intended for applications that step many independent
+  /// environments of the same model in lock-step (e.g. reinforcement
+  /// learning), where it avoids the per-context event dispatch and
+  /// DiscreteValues bookkeeping of calling CalcDiscreteVariableUpdates() once
+  /// per environment.
+  ///
+  /// The results are returned in structure-of-arrays form: on output,
+  /// `x_next` has num_multibody_states() rows and `contexts.size()` columns,
+  /// with column `i` storing the next state for `contexts[i]`. The state
+  /// stored in each context is not modified; use
+  /// SetPositionsAndVelocities() to commit the new states.
+  ///
+  /// @note The environments are stepped in order, on the calling thread,
+  /// since the plant's discrete solver is shared by all contexts.
+  /// @note With body sleeping (see set_body_sleeping_parameters()), the
+  /// sleeping state of each context is used but not advanced, since only
+  /// `[q; v]` is returned.
+  /// @throws std::exception if the plant is not discrete, if `x_next` is
+  /// nullptr, or if any entry of `contexts` is nullptr or does not belong to
+  /// `this` plant.
+  void CalcDiscreteVariableUpdatesBatch(
+      const std::vector<const systems::Context<T>*>& contexts,
+      MatrixX<T>* x_next) const;
   /// @} <!-- Kinematic and dynamic computations -->
 
   /// @anchor mbp_system_matrix_computations
@@ -2662,6 +3006,24 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrix(context, M);
   }
 
+  /// Computes a factorization of the mass matrix `M(q)` of the model, as a
+  /// function of the generalized positions q stored in `context`, that exploits
+  /// the sparsity of `M(q)` induced by the tree topology of the model. For
+  /// models with branches, such as legged robots or several arms on a mobile
+  /// base, this is much cheaper than a dense factorization of the result of
+  /// CalcMassMatrix(), and so is solving `M(q) x = b` with
+  /// MassMatrixFactorization::Solve(). See MassMatrixFactorization for
+  /// details.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @throws std::exception if `M(q)` is not positive definite (only checked
+  ///   for scalar types that can be compared).
+  MassMatrixFactorization<T> CalcMassMatrixFactorization(
+      const systems::Context<T>& context) const {
+    return internal_tree().CalcMassMatrixFactorization(context);
+  }
+
   /// Computes the bias term `C(q, v)v` containing Coriolis, centripetal, and
   /// gyroscopic effects in the multibody equations of motion: <pre>
   ///   M(q) v̇ + C(q, v) v = tau_app + ∑ (Jv_V_WBᵀ(q) ⋅ Fapp_Bo_W)
@@ -2920,6 +3282,45 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
         Js_v_ABi_E);
   }
 
+  /// Batched variant of CalcJacobianAngularVelocity() and
+  /// CalcJacobianTranslationalVelocity() for many lists of points, each fixed
+  /// to its own frame B. For each entry of `points`, this method computes
+  /// J𝑠_w_AB_E, frame B's angular velocity Jacobian in frame A, and
+  /// J𝑠_v_ABi_E, the translational velocity Jacobian in frame A of each point
+  /// Bi. Together, they form the spatial velocity Jacobian of each point Bi
+  /// (see CalcJacobianSpatialVelocity()).
+  ///
+  /// The kinematics are evaluated once for all entries, and only the
+  /// mobilizers on the kinematic path between frames A and B are visited for
+  /// each entry. The Jacobians are stored in a block-sparse form, see
+  /// SparsePointsJacobian: only the columns for the speeds 𝑠 of the mobilizers
+  /// on that path are stored, together with their indices in 𝑠. All other
+  /// columns are zero. When `jacobians` is reused across calls (e.g. once per
+  /// time step) with the same frames and number of points, its storage is
+  /// reused as well.
+  ///
+  /// @param[in] context The state of the multibody system.
+  /// @param[in] with_respect_to Enum equal to JacobianWrtVariable::kQDot or
+  /// JacobianWrtVariable::kV, indicating whether the Jacobians are partial
+  /// derivatives with respect to 𝑠 = q̇ (time-derivatives of generalized
+  /// positions) or with respect to 𝑠 = v (generalized velocities).
+  /// @param[in] points The lists of points Bi. Each lists the positions
+  /// `p_BoBi_B` of its points in its own frame B.
+  /// @param[in] frame_A The frame that measures `w_AB` and `v_ABi`.
+  /// @param[in] frame_E The frame in which the Jacobians are expressed.
+  /// @param[out] jacobians On output, it has the same size as `points` and its
+  /// k-th entry stores the Jacobians for the k-th entry in `points`.
+  /// @throws std::exception if `jacobians` is nullptr or if the frame of any
+  /// entry in `points` is nullptr.
+  void CalcSparsePointsJacobians(
+      const systems::Context<T>& context, JacobianWrtVariable with_respect_to,
+      const std::vector<PointsOnFrame<T>>& points, const Frame<T>& frame_A,
+      const Frame<T>& frame_E,
+      std::vector<SparsePointsJacobian<T>>* jacobians) const {
+    internal_tree().CalcSparsePointsJacobians(context, with_respect_to, points,
+                                              frame_A, frame_E, jacobians);
+  }
+
   /// This method computes J𝑠_v_ACcm_E, point Ccm's translational velocity
   /// Jacobian in frame A with respect to "speeds" 𝑠, expressed in frame E,
   /// where point Ccm is the composite center of mass of the system of all
@@ -3850,17 +4251,28 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
       const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>& events,
       drake::systems::DiscreteValues<T>* updates) const override;
 
+  // Computes the state x_next = [q_next; v_next] for a discrete update of
+  // `context0`. Used by both DoCalcDiscreteVariableUpdates() and
+  // CalcDiscreteVariableUpdatesBatch().
+  void CalcNextDiscreteState(const systems::Context<T>& context0,
+                             EigenPtr<VectorX<T>> x_next) const;
+
   // Helper method used within DoCalcDiscreteVariableUpdates() to update
   // generalized velocities from previous step value v0 to next step value v.
+  // The update is computed with `solver`, see CallTamsiSolver().
   // This helper uses num_substeps within a time interval of duration dt
   // to perform the update using a step size dt_substep = dt/num_substeps.
   // During the time span dt the problem data M, Jn, Jt and minus_tau, are
   // approximated to be constant, a first order approximation.
+  // `contact_ids` identifies each contact point so that TamsiSolver can warm
+  // start from the contact forces of the previous solve, see
+  // TamsiSolver::SetContactIdentifiers().
   TamsiSolverResult SolveUsingSubStepping(
-      int num_substeps, const MatrixX<T>& M0, const MatrixX<T>& Jn,
-      const MatrixX<T>& Jt, const VectorX<T>& minus_tau,
+      TamsiSolver<T>* solver, int num_substeps, const MatrixX<T>& M0,
+      const MatrixX<T>& Jn, const MatrixX<T>& Jt, const VectorX<T>& minus_tau,
       const VectorX<T>& stiffness, const VectorX<T>& damping,
-      const VectorX<T>& mu, const VectorX<T>& v0, const VectorX<T>& fn0) const;
+      const VectorX<T>& mu, const VectorX<T>& v0, const VectorX<T>& fn0,
+      const std::vector<TamsiSolverContactId>& contact_ids) const;
 
   // This method uses the time stepping method described in
   // TamsiSolver to advance the model's state stored in
@@ -3911,6 +4323,15 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
       const drake::systems::Context<T>& context,
       internal::HydroelasticFallbackCacheData<T>* data) const;
 
+  // Returns the `stage` entry of discrete_update_timing_statistics_, to be
+  // timed with a ScopedTimer, or nullptr when timing is disabled.
+  double* discrete_update_timer(
+      double DiscreteUpdateTimingStatistics::*stage) const {
+    return discrete_update_timing_enabled_
+               ? &(discrete_update_timing_statistics_.*stage)
+               : nullptr;
+  }
+
   // Depending on the ContactModel, this method performs point contact and
   // hydroelastic queries and prepares the results in the form of a list of
   // DiscreteContactPair to be consummed by our discrete solvers.
@@ -4164,11 +4585,19 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // R_WC_set will contain the orientation R_WC (with columns Cx, Cy, Cz) in the
   // world using the mean of the pair of witnesses for point_pairs_set[i] as the
   // contact point.
+  //
+  // If the optional argument Jc is non-null, on output it stores the full
+  // contact Jacobian of size 3⋅nc×nv described in ContactJacobians::Jc.
+  //
+  // The rows of a contact only have non-zero entries in the columns of the
+  // generalized velocities along the kinematic paths from the world to the two
+  // bodies in contact. Only these are computed, and stored in Jc.
   void CalcNormalAndTangentContactJacobians(
       const systems::Context<T>& context,
       const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
       MatrixX<T>* Jn, MatrixX<T>* Jt,
-      std::vector<math::RotationMatrix<T>>* R_WC_set = nullptr) const;
+      std::vector<math::RotationMatrix<T>>* R_WC_set = nullptr,
+      Eigen::SparseMatrix<T>* Jc = nullptr) const;
 
   // Evaluates the contact Jacobians for the given state of the plant stored in
   // `context`.
@@ -4218,20 +4647,66 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
                               joint.child_body().index());
   }
 
-  // Helper to invoke our TamsiSolver.
+  // Helper to invoke `solver`, either tamsi_solver_ or the solver of a contact
+  // island.
   void CallTamsiSolver(
+      TamsiSolver<T>* solver, const T& time0, const VectorX<T>& v0,
+      const MatrixX<T>& M0, const VectorX<T>& minus_tau, const VectorX<T>& fn0,
+      const MatrixX<T>& Jn, const MatrixX<T>& Jt, const VectorX<T>& stiffness,
+      const VectorX<T>& damping, const VectorX<T>& mu,
+      const std::vector<TamsiSolverContactId>& contact_ids,
+      contact_solvers::internal::ContactSolverResults<T>* results) const;
+
+  // Helper to invoke a TamsiSolver for each of the problems restricted to the
+  // trees of one of the `islands`, each given as its trees in increasing
+  // order, on contact_island_num_threads() threads. The islands must not be
+  // in contact with each other. The results of the full problem are stored in
+  // `results`, with zero velocities for the trees that do not belong to an
+  // island and zero forces for the contacts that do not involve one.
+  void CallTamsiSolverForIslands(
+      const std::vector<std::vector<int>>& islands,
+      const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
       const T& time0, const VectorX<T>& v0, const MatrixX<T>& M0,
       const VectorX<T>& minus_tau, const VectorX<T>& fn0, const MatrixX<T>& Jn,
       const MatrixX<T>& Jt, const VectorX<T>& stiffness,
       const VectorX<T>& damping, const VectorX<T>& mu,
+      const std::vector<TamsiSolverContactId>& contact_ids,
       contact_solvers::internal::ContactSolverResults<T>* results) const;
 
+  // Returns, for each tree of the model (see
+  // MultibodyTreeTopology::num_trees()), the smallest tree of its contact
+  // island given `contact_pairs`. Contact with the world or with anchored
+  // bodies does not join islands.
+  std::vector<int> CalcTreeIslands(
+      const std::vector<internal::DiscreteContactPair<T>>& contact_pairs) const;
+
+  // Returns, for each tree of the model (see
+  // MultibodyTreeTopology::num_trees()), whether it sleeps during the discrete
+  // update of `context`, given its `contact_pairs`. See
+  // set_body_sleeping_parameters() for the rules. All entries are `false` when
+  // body sleeping is disabled.
+  std::vector<bool> CalcSleepingTrees(
+      const systems::Context<T>& context,
+      const std::vector<internal::DiscreteContactPair<T>>& contact_pairs) const;
+
+  // Wakes up all trees in `state`, when body sleeping is enabled.
+  void ResetBodySleepingState(systems::State<T>* state) const {
+    if (body_sleeping_parameters_) {
+      state->get_mutable_discrete_state(body_sleeping_state_index_).SetZero();
+    }
+  }
+
+  // Returns the tree of the body with `geometry_id`, or -1 if the body does
+  // not belong to a tree with generalized velocities (the world or an anchored
+  // body).
+  int GetMovingTreeOfGeometry(geometry::GeometryId geometry_id) const;
+
   // Helper to invoke ContactSolver when one is available.
   void CallContactSolver(
       const T& time0, const VectorX<T>& v0, const MatrixX<T>& M0,
-      const VectorX<T>& minus_tau, const VectorX<T>& phi0, const MatrixX<T>& Jc,
-      const VectorX<T>& stiffness, const VectorX<T>& damping,
-      const VectorX<T>& mu,
+      const VectorX<T>& minus_tau, const VectorX<T>& phi0,
+      const Eigen::SparseMatrix<T>& Jc, const VectorX<T>& stiffness,
+      const VectorX<T>& damping, const VectorX<T>& mu,
       contact_solvers::internal::ContactSolverResults<T>* results) const;
 
   // Geometry source identifier for this system to interact with geometry
@@ -4445,6 +4920,30 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // The solver used when the plant is modeled as a discrete system.
   std::unique_ptr<TamsiSolver<T>> tamsi_solver_;
 
+  // Body sleeping, see set_body_sleeping_parameters().
+  std::optional<BodySleepingParameters> body_sleeping_parameters_;
+  // The discrete state group with the number of consecutive updates at rest of
+  // each tree, only declared when body sleeping is enabled.
+  systems::DiscreteStateIndex body_sleeping_state_index_;
+  // Whether each tree can sleep, indexed by tree, computed at Finalize().
+  std::vector<bool> tree_can_sleep_;
+
+  // Contact islands, see set_contact_islands_enabled().
+  bool contact_islands_enabled_{false};
+  int contact_island_num_threads_{1};
+  // The solvers of the problems restricted to an island, indexed by the
+  // smallest tree of the island so that an island keeps its solver, and thus
+  // its warm start, across updates. A solver is re-created when the number of
+  // generalized velocities of its island changes. Without contact islands,
+  // the awake trees are solved as a single island.
+  mutable std::vector<std::unique_ptr<TamsiSolver<T>>> island_tamsi_solvers_;
+  mutable std::vector<int> island_tamsi_solver_num_velocities_;
+
+  // Timing of the discrete updates, see set_discrete_update_timing_enabled().
+  // The statistics are mutable since they are updated by const Calc methods.
+  bool discrete_update_timing_enabled_{false};
+  mutable DiscreteUpdateTimingStatistics discrete_update_timing_statistics_;
+
   // When not the nullptr, this is the solver to be used for discrete updates.
   std::unique_ptr<contact_solvers::internal::ContactSolver<T>> contact_solver_;
 
@@ -4620,7 +5119,8 @@ template <>
 void MultibodyPlant<symbolic::Expression>::CallContactSolver(
     const symbolic::Expression&, const VectorX<symbolic::Expression>&,
     const MatrixX<symbolic::Expression>&, const VectorX<symbolic::Expression>&,
-    const VectorX<symbolic::Expression>&, const MatrixX<symbolic::Expression>&,
+    const VectorX<symbolic::Expression>&,
+    const Eigen::SparseMatrix<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&, const VectorX<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&,
     contact_solvers::internal::ContactSolverResults<symbolic::Expression>*)
@@ -3,9 +3,15 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
 #include "drake/common/extract_double.h"
 
 namespace drake {
@@ -243,8 +249,191 @@ T TalsLimiter<T>::SolveQuadraticForTheSmallestPositiveRoot(
   return alpha;
 }
 
+// Products and linear solves used by the Newton-Raphson iteration of
+// TamsiSolver<double> with sparse copies of the problem data, see
+// TamsiSolverParameters::use_sparse_linear_algebra. The sparsity pattern of
+// the Newton-Raphson Jacobian only depends on that of M, Jn and Jt, and
+// therefore its symbolic analysis is performed only once per solve.
+class TamsiSolverSparseLinearAlgebra {
+ public:
+  TamsiSolverSparseLinearAlgebra() = default;
+
+  // Makes sparse copies of the problem data for a new solve.
+  void SetProblemData(
+      const Eigen::Ref<const MatrixX<double>>& M,
+      const Eigen::Ref<const MatrixX<double>>& Jn,
+      const Eigen::Ref<const MatrixX<double>>& Jt, bool two_way_coupling) {
+    M_ = M.sparseView();
+    Jn_ = Jn.sparseView();
+    Jt_ = Jt.sparseView();
+    JnT_ = Jn_.transpose();
+    JtT_ = Jt_.transpose();
+    two_way_coupling_ = two_way_coupling;
+    pattern_is_analyzed_ = false;
+  }
+
+  const Eigen::SparseMatrix<double>& M() const { return M_; }
+  const Eigen::SparseMatrix<double>& Jn() const { return Jn_; }
+  const Eigen::SparseMatrix<double>& Jt() const { return Jt_; }
+
+  // Computes the Newton-Raphson update Δv = −J⁻¹R, where R is the `residual`.
+  // See TamsiSolver::CalcJacobian() for the definition of the Newton-Raphson
+  // Jacobian J. Returns false if the factorization of J fails.
+  bool CalcNewtonStep(
+      double dt, const std::vector<Matrix2<double>>& dft_dvt,
+      const Eigen::Ref<const VectorX<double>>& dfn_dvn,
+      const Eigen::Ref<const VectorX<double>>& t_hat,
+      const Eigen::Ref<const VectorX<double>>& mu_vt,
+      const Eigen::Ref<const VectorX<double>>& residual,
+      EigenPtr<VectorX<double>> Delta_v) {
+    const int nc = Jn_.rows();
+    const int nf = 2 * nc;
+
+    // With D = diag(dft_dvt), the (2nc x 2nc) block diagonal matrix with
+    // dft_dvt in each 2x2 diagonal entry, we have Gt = −D Jt − T Gn, where
+    // the (2nc x nc) matrix T stores μ t̂ for each contact point in its column.
+    // We store all entries of D, even if zero, so that the sparsity pattern of
+    // J does not change between iterations.
+    triplets_.clear();
+    for (int ic = 0; ic < nc; ++ic) {
+      const int ik = 2 * ic;
+      for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2; ++j) {
+          triplets_.emplace_back(ik + i, ik + j, dft_dvt[ic](i, j));
+        }
+      }
+    }
+    D_.resize(nf, nf);
+    D_.setFromTriplets(triplets_.begin(), triplets_.end());
+
+    // J = M − δt Jₜᵀ Gt − δt Jₙᵀ Gn.
+    if (two_way_coupling_) {
+      triplets_.clear();
+      for (int ic = 0; ic < nc; ++ic) {
+        const int ik = 2 * ic;
+        triplets_.emplace_back(ik, ic, mu_vt(ic) * t_hat(ik));
+        triplets_.emplace_back(ik + 1, ic, mu_vt(ic) * t_hat(ik + 1));
+      }
+      T_.resize(nf, nc);
+      T_.setFromTriplets(triplets_.begin(), triplets_.end());
+      Gn_ = dfn_dvn.asDiagonal() * Jn_;
+      minus_Gt_ = D_ * Jt_ + T_ * Gn_;
+      J_ = M_ + dt * (JtT_ * minus_Gt_) - dt * (JnT_ * Gn_);
+    } else {
+      minus_Gt_ = D_ * Jt_;
+      J_ = M_ + dt * (JtT_ * minus_Gt_);
+    }
+
+    // J is symmetric for the one-way coupled scheme.
+    if (two_way_coupling_) {
+      if (!pattern_is_analyzed_) J_lu_.analyzePattern(J_);
+      pattern_is_analyzed_ = true;
+      J_lu_.factorize(J_);
+      if (J_lu_.info() != Eigen::Success) return false;
+      *Delta_v = J_lu_.solve(-residual);
+    } else {
+      if (!pattern_is_analyzed_) J_ldlt_.analyzePattern(J_);
+      pattern_is_analyzed_ = true;
+      J_ldlt_.factorize(J_);
+      if (J_ldlt_.info() != Eigen::Success) return false;
+      *Delta_v = J_ldlt_.solve(-residual);
+    }
+    return true;
+  }
+
+  // Solves J X = B using the factorization of the Jacobian J from the last
+  // call to CalcNewtonStep().
+  MatrixX<double> SolveWithJacobian(
+      const Eigen::Ref<const MatrixX<double>>& B) const {
+    if (two_way_coupling_) return J_lu_.solve(B);
+    return J_ldlt_.solve(B);
+  }
+
+ private:
+  Eigen::SparseMatrix<double> M_;
+  Eigen::SparseMatrix<double> Jn_;
+  Eigen::SparseMatrix<double> Jt_;
+  Eigen::SparseMatrix<double> JnT_;
+  Eigen::SparseMatrix<double> JtT_;
+  bool two_way_coupling_{false};
+
+  // Workspace for CalcNewtonStep().
+  std::vector<Eigen::Triplet<double>> triplets_;
+  Eigen::SparseMatrix<double> D_;
+  Eigen::SparseMatrix<double> T_;
+  Eigen::SparseMatrix<double> Gn_;
+  Eigen::SparseMatrix<double> minus_Gt_;
+  Eigen::SparseMatrix<double> J_;
+  bool pattern_is_analyzed_{false};
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> J_ldlt_;
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> J_lu_;
+};
+
 }  // namespace internal
 
+// Products and linear solves used by the Newton-Raphson iteration with the
+// dense problem data, for any scalar type. See
+// internal::TamsiSolverSparseLinearAlgebra for its sparse counterpart.
+template <typename T>
+class TamsiSolver<T>::DenseLinearAlgebra {
+ public:
+  explicit DenseLinearAlgebra(const TamsiSolver<T>& solver)
+      : solver_(solver),
+        M_(solver.problem_data_aliases_.M()),
+        Jn_(solver.problem_data_aliases_.Jn()),
+        Jt_(solver.problem_data_aliases_.Jt()) {}
+
+  const Eigen::Ref<const MatrixX<T>>& M() const { return M_; }
+  const Eigen::Ref<const MatrixX<T>>& Jn() const { return Jn_; }
+  const Eigen::Ref<const MatrixX<T>>& Jt() const { return Jt_; }
+
+  // Computes the Newton-Raphson update Δv = −J⁻¹R, where R is the `residual`.
+  // Returns false if the factorization of J fails.
+  bool CalcNewtonStep(
+      double dt, const std::vector<Matrix2<T>>& dft_dvt,
+      const Eigen::Ref<const VectorX<T>>& dfn_dvn,
+      const Eigen::Ref<const VectorX<T>>& t_hat,
+      const Eigen::Ref<const VectorX<T>>& mu_vt,
+      const Eigen::Ref<const VectorX<T>>& residual,
+      EigenPtr<VectorX<T>> Delta_v) const {
+    auto& J = solver_.fixed_size_workspace_.mutable_J();
+    auto Gn = solver_.variable_size_workspace_.mutable_Gn();
+
+    // We use the chain rule to compute Gn = ∇ᵥfₙ. Since ∇ᵥvₙ = Jn, we have:
+    if (solver_.has_two_way_coupling()) {
+      Gn = dfn_dvn.asDiagonal() * Jn_;
+    }
+
+    // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
+    solver_.CalcJacobian(M_, Jn_, Jt_, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
+
+    // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
+    // Since we are in a non-linear iteration, an approximate cheap solution
+    // is probably best.
+    // TODO(amcastro-tri): Consider using a matrix-free iterative method to
+    // avoid computing M and J. CG and the Krylov family can be matrix-free.
+    if (solver_.has_two_way_coupling()) {
+      auto& J_lu = solver_.fixed_size_workspace_.mutable_J_lu();
+      J_lu.compute(J);  // Update factorization.
+      *Delta_v = J_lu.solve(-residual);
+    } else {
+      auto& J_ldlt = solver_.fixed_size_workspace_.mutable_J_ldlt();
+      J_ldlt.compute(J);  // Update factorization.
+      if (J_ldlt.info() != Eigen::Success) {
+        return false;
+      }
+      *Delta_v = J_ldlt.solve(-residual);
+    }
+    return true;
+  }
+
+ private:
+  const TamsiSolver<T>& solver_;
+  const Eigen::Ref<const MatrixX<T>> M_;
+  const Eigen::Ref<const MatrixX<T>> Jn_;
+  const Eigen::Ref<const MatrixX<T>> Jt_;
+};
+
 template <typename T>
 TamsiSolver<T>::TamsiSolver(int nv) :
     nv_(nv),
@@ -257,6 +446,9 @@ TamsiSolver<T>::TamsiSolver(int nv) :
   DRAKE_THROW_UNLESS(nv >= 0);
 }
 
+template <typename T>
+TamsiSolver<T>::~TamsiSolver() = default;
+
 template <typename T>
 void TamsiSolver<T>::SetOneWayCoupledProblemData(
     EigenPtr<const MatrixX<T>> M,
@@ -273,6 +465,9 @@ void TamsiSolver<T>::SetOneWayCoupledProblemData(
   // Keep references to the problem data.
   problem_data_aliases_.SetOneWayCoupledData(M, Jn, Jt, p_star, fn, mu);
   variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  // Identifiers, if any, apply to the previous problem data.
+  contact_ids_.clear();
+  solution_factorization_ = JacobianFactorization::kNone;
 }
 
 template <typename T>
@@ -295,6 +490,16 @@ void TamsiSolver<T>::SetTwoWayCoupledProblemData(
   problem_data_aliases_.SetTwoWayCoupledData(M, Jn, Jt, p_star, fn0, stiffness,
                                              dissipation, mu);
   variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  // Identifiers, if any, apply to the previous problem data.
+  contact_ids_.clear();
+  solution_factorization_ = JacobianFactorization::kNone;
+}
+
+template <typename T>
+void TamsiSolver<T>::SetContactIdentifiers(
+    std::vector<TamsiSolverContactId> ids) {
+  DRAKE_THROW_UNLESS(static_cast<int>(ids.size()) == nc_);
+  contact_ids_ = std::move(ids);
 }
 
 template <typename T>
@@ -458,18 +663,18 @@ void TamsiSolver<T>::CalcFrictionForcesGradient(
 template <typename T>
 void TamsiSolver<T>::CalcNormalForces(
     const Eigen::Ref<const VectorX<T>>& vn,
-    const Eigen::Ref<const MatrixX<T>>& Jn,
     double dt,
-    // We change from fn/Gn in the header to fn_ptr, Gn_ptr here to avoid name
-    // clashes with local variables.
+    // We change from fn/dfn_dvn in the header to fn_ptr, dfn_dvn_ptr here to
+    // avoid name clashes with local variables.
     EigenPtr<VectorX<T>> fn_ptr,
-    EigenPtr<MatrixX<T>> Gn_ptr) const {
+    EigenPtr<VectorX<T>> dfn_dvn_ptr) const {
   using std::max;
   const int nc = nc_;  // Number of contact points.
 
   if (!has_two_way_coupling()) {
     // Copy the input normal force (i.e. it is fixed).
     *fn_ptr = problem_data_aliases_.fn();
+    dfn_dvn_ptr->setZero();
     return;
   }
 
@@ -508,13 +713,9 @@ void TamsiSolver<T>::CalcNormalForces(
   // function of vₙ (on a per contact basis, that's why the use of .array()
   // operations below). dfₙ/dvₙ = -d⋅H(1 − d vₙ)⋅(fₙ₀ − h k vₙ)₊  - h⋅k⋅(1 − d
   // vₙ)₊⋅H(fₙ₀ − h k vₙ) Note that dfₙ/dvₙ < 0 always.
-  const VectorX<T> dfn_dvn = -(
+  *dfn_dvn_ptr = -(
       dissipation.array() * H_damping_factor.array() * undamped_fn.array() +
       dt * stiffness.array() * damping_factor.array() * H_undamped_fn.array());
-
-  // We use the chain rule to compute Gn = ∇ᵥfₙ. Since ∇ᵥvₙ = Jn, we have:
-  auto& Gn = *Gn_ptr;
-  Gn = dfn_dvn.asDiagonal() * Jn;
 }
 
 template <typename T>
@@ -610,6 +811,8 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   // Clear statistics so that we can update them with new ones for this call to
   // SolveWithGuess().
   statistics_.Reset();
+  solution_factorization_ = JacobianFactorization::kNone;
+  solution_dt_ = dt;
 
   // If there are no contact points return a zero generalized friction force
   // vector, i.e. tau_f = 0.
@@ -620,13 +823,127 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     const auto p_star = problem_data_aliases_.p_star();
     auto& v = fixed_size_workspace_.mutable_v();
     // With no friction forces Eq. (3) in the documentation reduces to
-    // M vˢ⁺¹ = p*.
-    v = M.ldlt().solve(p_star);
+    // M vˢ⁺¹ = p*. The Newton-Raphson Jacobian is J = M.
+    auto& J_ldlt = fixed_size_workspace_.mutable_J_ldlt();
+    J_ldlt.compute(M);
+    v = J_ldlt.solve(p_star);
+    solution_factorization_ = JacobianFactorization::kDenseLdlt;
     // "One iteration" with exactly "zero" vt_error.
     statistics_.Update(0.0);
+    RecordWarmStartForces();
     return TamsiSolverResult::kSuccess;
   }
 
+  // Start from the contact forces of the previous solve when available.
+  const VectorX<T>* v_initial = &v_guess;
+  statistics_.num_warm_started_contacts =
+      CalcWarmStartGuess(dt, v_guess, &fixed_size_workspace_.mutable_v());
+  if (statistics_.num_warm_started_contacts > 0) {
+    v_initial = &fixed_size_workspace_.mutable_v();
+  }
+
+  if constexpr (std::is_same_v<T, double>) {
+    if (parameters_.use_sparse_linear_algebra) {
+      if (sparse_linear_algebra_ == nullptr) {
+        sparse_linear_algebra_ =
+            std::make_unique<internal::TamsiSolverSparseLinearAlgebra>();
+      }
+      sparse_linear_algebra_->SetProblemData(
+          problem_data_aliases_.M(), problem_data_aliases_.Jn(),
+          problem_data_aliases_.Jt(), has_two_way_coupling());
+      const TamsiSolverResult result =
+          DoSolveWithGuess(dt, *v_initial, sparse_linear_algebra_.get());
+      if (result == TamsiSolverResult::kSuccess) {
+        solution_factorization_ = JacobianFactorization::kSparse;
+      }
+      return result;
+    }
+  }
+  DenseLinearAlgebra dense_linear_algebra(*this);
+  const TamsiSolverResult result =
+      DoSolveWithGuess(dt, *v_initial, &dense_linear_algebra);
+  if (result == TamsiSolverResult::kSuccess) {
+    solution_factorization_ = has_two_way_coupling()
+                                  ? JacobianFactorization::kDenseLu
+                                  : JacobianFactorization::kDenseLdlt;
+  }
+  return result;
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcVelocitiesSensitivity(
+    const Eigen::Ref<const MatrixX<T>>& dp_star_dtheta,
+    const Eigen::Ref<const MatrixX<T>>& dfn_dtheta,
+    MatrixX<T>* dv_dtheta) const {
+  DRAKE_THROW_UNLESS(dv_dtheta != nullptr);
+  if (solution_factorization_ == JacobianFactorization::kNone) {
+    throw std::logic_error(
+        "TamsiSolver::CalcVelocitiesSensitivity(): there is no successful "
+        "solve for the current problem data.");
+  }
+  const int k = dp_star_dtheta.cols();
+  DRAKE_THROW_UNLESS(dp_star_dtheta.rows() == nv_);
+  DRAKE_THROW_UNLESS(dfn_dtheta.rows() == nc_ && dfn_dtheta.cols() == k);
+  const double dt = solution_dt_;
+
+  // The right hand side −∂R/∂θ = ∂p*/∂θ + δt (Jₙᵀ + Jₜᵀ ∂fₜ/∂fₙ) ∂fₙ/∂θ,
+  // with fₜ = −μ(vₜ) t̂ fₙ for each contact point.
+  MatrixX<T> rhs = dp_star_dtheta;
+  if (nc_ > 0) {
+    const auto Jn = problem_data_aliases_.Jn();
+    const auto Jt = problem_data_aliases_.Jt();
+    const auto mu_vt = variable_size_workspace_.mutable_mu();
+    const auto t_hat = variable_size_workspace_.mutable_t_hat();
+
+    // The partial derivatives ∂fₙ/∂θ at fixed v. For the two-way coupled
+    // scheme fₙ = (1 − d vₙ)₊ (fₙ₀ − δt k vₙ)₊, see CalcNormalForces().
+    MatrixX<T> dfn = dfn_dtheta;
+    if (has_two_way_coupling()) {
+      const auto vn = variable_size_workspace_.vn();
+      const auto& fn0 = problem_data_aliases_.fn0();
+      const auto& stiffness = problem_data_aliases_.stiffness();
+      const auto& dissipation = problem_data_aliases_.dissipation();
+      for (int ic = 0; ic < nc_; ++ic) {
+        const T damping_factor = 1.0 - dissipation(ic) * vn(ic);
+        const T undamped_fn = fn0(ic) - dt * stiffness(ic) * vn(ic);
+        if (damping_factor >= 0 && undamped_fn >= 0) {
+          dfn.row(ic) *= damping_factor;
+        } else {
+          dfn.row(ic).setZero();
+        }
+      }
+    }
+    MatrixX<T> dft(2 * nc_, k);
+    for (int ic = 0; ic < nc_; ++ic) {
+      dft.template middleRows<2>(2 * ic) =
+          -mu_vt(ic) * t_hat.template segment<2>(2 * ic) * dfn.row(ic);
+    }
+    rhs += dt * (Jn.transpose() * dfn + Jt.transpose() * dft);
+  }
+
+  switch (solution_factorization_) {
+    case JacobianFactorization::kDenseLdlt:
+      *dv_dtheta = fixed_size_workspace_.mutable_J_ldlt().solve(rhs);
+      break;
+    case JacobianFactorization::kDenseLu:
+      *dv_dtheta = fixed_size_workspace_.mutable_J_lu().solve(rhs);
+      break;
+    case JacobianFactorization::kSparse:
+      if constexpr (std::is_same_v<T, double>) {
+        *dv_dtheta = sparse_linear_algebra_->SolveWithJacobian(rhs);
+        break;
+      }
+      DRAKE_UNREACHABLE();
+    case JacobianFactorization::kNone:
+      DRAKE_UNREACHABLE();
+  }
+}
+
+template <typename T>
+template <class LinearAlgebra>
+TamsiSolverResult TamsiSolver<T>::DoSolveWithGuess(
+    double dt, const VectorX<T>& v_guess,
+    LinearAlgebra* linear_algebra) const {
   // Solver parameters.
   const int max_iterations = parameters_.max_iterations;
   // Tolerance used to monitor the convergence of the contact velocities in both
@@ -637,16 +954,15 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
       parameters_.relative_tolerance * parameters_.stiction_tolerance;
 
   // Convenient aliases to problem data.
-  const auto M = problem_data_aliases_.M();
-  const auto Jn = problem_data_aliases_.Jn();
-  const auto Jt = problem_data_aliases_.Jt();
+  const auto& M = linear_algebra->M();
+  const auto& Jn = linear_algebra->Jn();
+  const auto& Jt = linear_algebra->Jt();
   const auto p_star = problem_data_aliases_.p_star();
 
   // Convenient aliases to fixed size workspace variables.
   auto& v = fixed_size_workspace_.mutable_v();
   auto& Delta_v = fixed_size_workspace_.mutable_Delta_v();
   auto& residual = fixed_size_workspace_.mutable_residual();
-  auto& J = fixed_size_workspace_.mutable_J();
   auto& tau_f = fixed_size_workspace_.mutable_tau_f();
   auto& tau = fixed_size_workspace_.mutable_tau();
 
@@ -658,7 +974,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   auto Delta_vn = variable_size_workspace_.mutable_Delta_vn();
   auto Delta_vt = variable_size_workspace_.mutable_Delta_vt();
   auto& dft_dvt = variable_size_workspace_.mutable_dft_dvt();
-  auto Gn = variable_size_workspace_.mutable_Gn();
+  auto dfn_dvn = variable_size_workspace_.mutable_dfn_dvn();
   auto mu_vt = variable_size_workspace_.mutable_mu();
   auto t_hat = variable_size_workspace_.mutable_t_hat();
   auto fn = variable_size_workspace_.mutable_fn();
@@ -677,7 +993,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     vn = Jn * v;
     vt = Jt * v;
 
-    CalcNormalForces(vn, Jn, dt, &fn, &Gn);
+    CalcNormalForces(vn, dt, &fn, &dfn_dvn);
 
     // Update v_slip, t_hat, mus and ft as a function of vt and fn.
     CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mu_vt, &ft);
@@ -689,6 +1005,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
       // Update generalized forces and return.
       tau_f = Jt.transpose() * ft;
       tau = tau_f + Jn.transpose() * fn;
+      RecordWarmStartForces();
       return TamsiSolverResult::kSuccess;
     }
 
@@ -700,25 +1017,10 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // t_hat and v_slip.
     CalcFrictionForcesGradient(fn, mu_vt, t_hat, v_slip, &dft_dvt);
 
-    // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
-    CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
-
-    // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
-    // Since we are in a non-linear iteration, an approximate cheap solution
-    // is probably best.
-    // TODO(amcastro-tri): Consider using a matrix-free iterative method to
-    // avoid computing M and J. CG and the Krylov family can be matrix-free.
-    if (has_two_way_coupling()) {
-      auto& J_lu = fixed_size_workspace_.mutable_J_lu();
-      J_lu.compute(J);  // Update factorization.
-      Delta_v = J_lu.solve(-residual);
-    } else {
-      auto& J_ldlt = fixed_size_workspace_.mutable_J_ldlt();
-      J_ldlt.compute(J);  // Update factorization.
-      if (J_ldlt.info() != Eigen::Success) {
-        return TamsiSolverResult::kLinearSolverFailed;
-      }
-      Delta_v = J_ldlt.solve(-residual);
+    // Newton-Raphson update Δv = −J⁻¹R, with J = ∇ᵥR.
+    if (!linear_algebra->CalcNewtonStep(dt, dft_dvt, dfn_dvn, t_hat, mu_vt,
+                                        residual, &Delta_v)) {
+      return TamsiSolverResult::kLinearSolverFailed;
     }
 
     // Since we keep Jt constant we have that:
@@ -754,6 +1056,68 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   return TamsiSolverResult::kMaxIterationsReached;
 }
 
+template <typename T>
+int TamsiSolver<T>::CalcWarmStartGuess(
+    double dt, const VectorX<T>& v_guess, VectorX<T>* v_initial) const {
+  if (contact_ids_.empty() || warm_start_forces_.empty()) return 0;
+
+  const int nc = nc_;
+  // Contact forces at the persistent contact points, zero otherwise. For the
+  // one-way coupled scheme the normal forces are known.
+  VectorX<T> fn_guess = VectorX<T>::Zero(nc);
+  if (!has_two_way_coupling()) fn_guess = problem_data_aliases_.fn();
+  VectorX<T> ft_guess = VectorX<T>::Zero(2 * nc);
+  int num_warm_started_contacts = 0;
+  for (int ic = 0; ic < nc; ++ic) {
+    const auto it = warm_start_forces_.find(contact_ids_[ic]);
+    if (it == warm_start_forces_.end()) continue;
+    // In stiction, the slip velocity is proportional to the friction force
+    // with a very large gain, vₛ/(μfₙ). A change in the forcing then changes
+    // the friction force with very little change in velocity, and the
+    // velocities that result from the recorded forces are a worse guess than
+    // v_guess.
+    if (it->second.in_stiction) return 0;
+    ++num_warm_started_contacts;
+    ft_guess.template segment<2>(2 * ic) = it->second.ft;
+    if (has_two_way_coupling()) fn_guess(ic) = it->second.fn;
+  }
+  if (num_warm_started_contacts == 0) return 0;
+
+  // The generalized velocities that result from the guessed forces,
+  // M⁻¹(p* + δt Jₙᵀ fₙ⁰ + δt Jₜᵀ fₜ⁰).
+  const auto M = problem_data_aliases_.M();
+  const auto Jn = problem_data_aliases_.Jn();
+  const auto Jt = problem_data_aliases_.Jt();
+  const auto p_star = problem_data_aliases_.p_star();
+  const VectorX<T> Delta_v =
+      M.ldlt().solve(p_star + dt * Jn.transpose() * fn_guess +
+                     dt * Jt.transpose() * ft_guess) -
+      v_guess;
+
+  // A sliding contact that comes to a stop sees its friction force vanish
+  // within the step and thus the recorded force overshoots. Therefore we limit
+  // the change from v_guess as we do for Newton-Raphson updates, see
+  // CalcAlpha().
+  const VectorX<T> vt_guess = Jt * v_guess;
+  const T alpha = CalcAlpha(vt_guess, Jt * Delta_v);
+  *v_initial = v_guess + alpha * Delta_v;
+  return num_warm_started_contacts;
+}
+
+template <typename T>
+void TamsiSolver<T>::RecordWarmStartForces() const {
+  // N.B. clear() keeps the map's buckets, avoiding re-allocations.
+  warm_start_forces_.clear();
+  const auto fn = variable_size_workspace_.fn();
+  const auto ft = variable_size_workspace_.ft();
+  const auto v_slip = variable_size_workspace_.mutable_v_slip();
+  for (int ic = 0; ic < static_cast<int>(contact_ids_.size()); ++ic) {
+    warm_start_forces_[contact_ids_[ic]] = {
+        ft.template segment<2>(2 * ic), fn(ic),
+        ExtractDoubleOrThrow(v_slip(ic)) < parameters_.stiction_tolerance};
+  }
+}
+
 template <typename T>
 T TamsiSolver<T>::RegularizedFriction(const T& s, const T& mu) {
   DRAKE_ASSERT(s >= 0);
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
@@ -8,11 +10,16 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/hash.h"
 
 namespace drake {
 namespace multibody {
 namespace internal {
 
+// Forward declaration of the sparse linear algebra used by TamsiSolver when
+// TamsiSolverParameters::use_sparse_linear_algebra is true.
+class TamsiSolverSparseLinearAlgebra;
+
 /// This struct implements the Transition-Aware Line Search (TALS) algorithm as
 /// described in @ref castro_etal_2019 "[Castro et al., 2019]".
 /// TamsiSolver performs a Newton-Raphson iteration, and at each kth iteration,
@@ -223,6 +230,53 @@ struct TamsiSolverParameters {
   /// solver. We choose a conservative number by default that we found to work
   /// well in most practical problems of interest.
   double theta_max{M_PI / 3.0};
+
+  /// (Advanced) When `true`, TamsiSolver exploits the sparsity of the problem
+  /// data. The contact Jacobians of multibody systems are typically very
+  /// sparse, given that the velocity at a contact point only depends on the
+  /// generalized velocities of the bodies along the paths from the two bodies
+  /// in contact to the world (tree-sparsity). Similarly, the mass matrix is
+  /// block diagonal for systems made of several independent trees, such as a
+  /// robot manipulating free objects. In this mode the solver keeps sparse
+  /// copies of M, Jₙ and Jₜ, forms the Newton-Raphson Jacobian with sparse
+  /// products and factorizes it with a sparse direct method (LDLT for one-way
+  /// coupled problems and LU for two-way coupled problems). The cost per
+  /// iteration then scales with the number of non-zeros rather than with nv³.
+  /// This pays off for problems with many generalized velocities and contact
+  /// points, while the dense default is faster for small problems.
+  /// Sparse linear algebra is only supported for T = double; this parameter
+  /// is ignored for other scalar types.
+  bool use_sparse_linear_algebra{false};
+};
+
+/// (Advanced) Identifies a contact point across successive solves, so that
+/// TamsiSolver can warm start a solve with the contact forces of a previous
+/// one. See TamsiSolver::SetContactIdentifiers().
+struct TamsiSolverContactId {
+  /// Implements the @ref hash_append concept.
+  template <class HashAlgorithm>
+  friend void hash_append(HashAlgorithm& hasher,
+                          const TamsiSolverContactId& item) noexcept {
+    using drake::hash_append;
+    hash_append(hasher, item.id_A);
+    hash_append(hasher, item.id_B);
+    hash_append(hasher, item.feature);
+  }
+
+  bool operator==(const TamsiSolverContactId& other) const {
+    return id_A == other.id_A && id_B == other.id_B &&
+           feature == other.feature;
+  }
+
+  /// Identifiers of the first and second objects in contact, typically the
+  /// values of their geometry ids. The order of the two objects must be the
+  /// same in each solve, since it defines the sign of the contact frame.
+  int64_t id_A{0};
+  int64_t id_B{0};
+  /// Distinguishes the contact points between the same two objects, e.g. the
+  /// index of a local feature or of a quadrature point. Zero when there is a
+  /// single contact point per pair of objects.
+  int feature{0};
 };
 
 /// Struct used to store information about the iteration process performed by
@@ -231,6 +285,7 @@ struct TamsiSolverIterationStats {
   /// (Internal) Used by TamsiSolver to reset statistics.
   void Reset() {
     num_iterations = 0;
+    num_warm_started_contacts = 0;
     // Clear does not change a std::vector "capacity", and therefore there's
     // no reallocation (or deallocation) that could affect performance.
     residuals.clear();
@@ -246,6 +301,11 @@ struct TamsiSolverIterationStats {
   /// solve.
   int num_iterations{0};
 
+  /// The number of contact points whose contact forces were known from a
+  /// previous solve and used to warm start the last TamsiSolver solve. See
+  /// TamsiSolver::SetContactIdentifiers().
+  int num_warm_started_contacts{0};
+
   /// Returns the residual in the tangential velocities, in m/s. Upon
   /// convergence of the solver this value should be smaller than
   /// Parameters::tolerance times Parameters::stiction_tolerance.
@@ -511,6 +571,8 @@ class TamsiSolver {
   /// @throws std::exception if nv is non-positive.
   explicit TamsiSolver(int nv);
 
+  ~TamsiSolver();
+
   // TODO(amcastro-tri): submit a separate reformat PR changing /// by /**.
   /// Sets data for the problem to be solved as outlined by Eq. (3) in this
   /// class's documentation: <pre>
@@ -609,6 +671,39 @@ class TamsiSolver {
       EigenPtr<const VectorX<T>> fn0, EigenPtr<const VectorX<T>> stiffness,
       EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu);
 
+  /// (Advanced) Sets identifiers for the contact points in the problem data
+  /// last set with SetOneWayCoupledProblemData() or
+  /// SetTwoWayCoupledProblemData(), so that the solver can warm start from
+  /// the contact forces of previous solves. `ids[i]` identifies the i-th
+  /// contact point and identifiers must be unique.
+  ///
+  /// After each successful call to SolveWithGuess(), the solver records the
+  /// normal and friction forces of each identified contact point (replacing
+  /// the forces previously recorded). The next call to SolveWithGuess()
+  /// starts the iteration from the generalized velocities that result from
+  /// applying the recorded forces to the contact points that persist (those
+  /// with a recorded identifier) and no force to the new ones, i.e.
+  /// v⁰ = M⁻¹(p* + δt Jₙᵀ fₙ⁰ + δt Jₜᵀ fₜ⁰). The change from `v_guess` is
+  /// limited as described in TamsiSolverParameters::theta_max. For sliding
+  /// contacts, whose friction forces are known up to their direction, this
+  /// guess accounts for the change of the velocities during the step that
+  /// `v_guess` (typically the previous step velocities) misses.
+  /// However, in stiction the slip velocity is a steep function of the
+  /// friction force. Therefore, `v_guess` is used instead whenever a
+  /// persistent contact point was in stiction, as well as when no contact
+  /// point persists. TamsiSolverIterationStats::num_warm_started_contacts
+  /// reports the number of contact points used for warm starting.
+  /// Recorded friction forces are expressed in the contact frames of the
+  /// previous solve; their tangent directions should therefore vary
+  /// smoothly with the contact configuration.
+  ///
+  /// Identifiers only apply to the current problem data and must be set again
+  /// each time new problem data is set. Solving without identifiers discards
+  /// the recorded forces.
+  /// @throws std::exception if `ids` is not of size `nc`, the number of
+  /// contact points in the problem data.
+  void SetContactIdentifiers(std::vector<TamsiSolverContactId> ids);
+
   /// Given an initial guess `v_guess`, this method uses a Newton-Raphson
   /// iteration to find a solution for the generalized velocities satisfying
   /// either Eq. (3) when one-way coupling is used or Eq. (10) when two-way
@@ -622,7 +717,9 @@ class TamsiSolver {
   ///
   /// @param[in] dt The time step used advance the solution in time.
   /// @param[in] v_guess The initial guess used in by the Newton-Raphson
-  /// iteration. Typically, the previous time step velocities.
+  /// iteration. Typically, the previous time step velocities. Replaced with
+  /// a warm start guess when contact identifiers are available, see
+  /// SetContactIdentifiers().
   ///
   /// @throws std::logic_error if `v_guess` is not of size `nv`, the number of
   /// generalized velocities specified at construction.
@@ -685,6 +782,47 @@ class TamsiSolver {
 
   /// @}
 
+  /// (Advanced) Computes the sensitivities of the generalized velocities
+  /// found by the last successful call to SolveWithGuess() with respect to a
+  /// set of `k` parameters θ, using the implicit function theorem. The
+  /// velocities v satisfy R(v, θ) = 0 with the Newton-Raphson residual <pre>
+  ///   R(v, θ) = M v − p*(θ) − δt [Jₙᵀ fₙ(v, θ) + Jₜᵀ fₜ(v, fₙ(v, θ))]
+  /// </pre>
+  /// and therefore their sensitivities are the solution of <pre>
+  ///   J ∂v/∂θ = ∂p*/∂θ + δt (Jₙᵀ + Jₜᵀ ∂fₜ/∂fₙ) ∂fₙ/∂θ
+  /// </pre>
+  /// where J = ∇ᵥR is the Newton-Raphson Jacobian. The solver reuses the
+  /// factorization of J from its last Newton-Raphson iteration, and thus the
+  /// sensitivities cost one linear solve with `k` right hand sides rather
+  /// than the differentiation of the entire iteration with automatic
+  /// differentiation. Since the last iterate is within the solver's tolerance
+  /// of the solution, so is the Jacobian used.
+  ///
+  /// The chain rule then gives the sensitivities with respect to the state
+  /// and inputs of a time step. For `p* = M vˢ + δt τˢ` and actuation
+  /// `τˢ = B u`, ∂p*/∂vˢ = M + δt ∂τˢ/∂vˢ and ∂p*/∂u = δt B, while the
+  /// positions qˢ enter through τˢ and through the normal forces, e.g.
+  /// fₙ₀ = k xˢ(qˢ) for the two-way coupled scheme. The problem data M, Jₙ
+  /// and Jₜ are held fixed, i.e. these sensitivities do not include the
+  /// derivatives of M(qˢ), Jₙ(qˢ) and Jₜ(qˢ) with respect to qˢ.
+  ///
+  /// @param[in] dp_star_dtheta
+  ///   The sensitivities ∂p*/∂θ, of size `nv x k`.
+  /// @param[in] dfn_dtheta
+  ///   The sensitivities of the normal forces `fn` set with
+  ///   SetOneWayCoupledProblemData(), or of the normal forces `fn0` set with
+  ///   SetTwoWayCoupledProblemData(), of size `nc x k`.
+  /// @param[out] dv_dtheta
+  ///   The sensitivities ∂v/∂θ, resized to `nv x k`.
+  ///
+  /// @throws std::exception if the last call to SolveWithGuess() did not
+  /// succeed, if the problem data was set again since then or if the sizes
+  /// of the arguments are not consistent as described above.
+  void CalcVelocitiesSensitivity(
+      const Eigen::Ref<const MatrixX<T>>& dp_star_dtheta,
+      const Eigen::Ref<const MatrixX<T>>& dfn_dtheta,
+      MatrixX<T>* dv_dtheta) const;
+
   /// Returns statistics recorded during the last call to SolveWithGuess().
   /// See IterationStats for details.
   const TamsiSolverIterationStats& get_iteration_statistics() const {
@@ -711,6 +849,10 @@ class TamsiSolver {
   // Helper class for unit testing.
   friend class TamsiSolverTester;
 
+  // The dense linear algebra used by the Newton-Raphson iteration, see
+  // DoSolveWithGuess().
+  class DenseLinearAlgebra;
+
   // Contains all the references that define the problem to be solved.
   // These references must remain valid at least from the time they are set with
   // SetOneWayCoupledProblemData() and until SolveWithGuess() returns.
@@ -926,6 +1068,7 @@ class TamsiSolver {
       v_slip_.resize(nc);
       mus_.resize(nc);
       dft_dv_.resize(nc);
+      dfn_dvn_.resize(nc);
       Gn_.resize(nc, nv);
     }
 
@@ -1014,6 +1157,12 @@ class TamsiSolver {
       return mus_.segment(0, nc_);
     }
 
+    // Returns a mutable reference to the vector containing the derivative
+    // dfₙ/dvₙ of the normal force at each contact point, of size nc.
+    Eigen::VectorBlock<VectorX<T>> mutable_dfn_dvn() {
+      return dfn_dvn_.segment(0, nc_);
+    }
+
     // Returns a mutable reference to the gradient Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹)
     // with respect to the generalized velocites v.
     Eigen::Block<MatrixX<T>> mutable_Gn() {
@@ -1040,6 +1189,7 @@ class TamsiSolver {
     VectorX<T> mus_;       // (modified) regularized friction, in ℝⁿᶜ.
     // Vector of size nc storing ∂fₜ/∂vₜ (in ℝ²ˣ²) for each contact point.
     std::vector<Matrix2<T>> dft_dv_;
+    VectorX<T> dfn_dvn_;   // dfₙ/dvₙ, in ℝⁿᶜ.
     MatrixX<T> Gn_;        // ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹), in ℝⁿᶜˣⁿᵛ
   };
 
@@ -1054,14 +1204,15 @@ class TamsiSolver {
   //       k(vₙ) = k (1 − d vₙ)₊
   // where `x₊` is max(x, 0) and k and d are the stiffness and
   // dissipation coefficients for a given contact point, respectively.
-  // In addition, this method also computes the gradient
-  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹).
+  // In addition, this method also computes the derivative dfn_dvn = dfₙ/dvₙ
+  // at each contact point, from which the gradient Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹) is
+  // obtained as Gn = diag(dfn_dvn) Jn. For the one-way coupled scheme dfn_dvn
+  // is zero.
   void CalcNormalForces(
       const Eigen::Ref<const VectorX<T>>& vn,
-      const Eigen::Ref<const MatrixX<T>>& Jn,
       double dt,
       EigenPtr<VectorX<T>> fn,
-      EigenPtr<MatrixX<T>> Gn) const;
+      EigenPtr<VectorX<T>> dfn_dvn) const;
 
   // Helper to compute fₜ(vₜ) = −vₜ/‖vₜ‖ₛ μ(‖vₜ‖ₛ) fₙ, where ‖vₜ‖ₛ
   // is the "soft norm" of vₜ. In addition this method computes
@@ -1134,6 +1285,26 @@ class TamsiSolver {
   // s = ‖v‖ / vₛ.
   static T RegularizedFrictionDerivative(const T& speed_BcAc, const T& mu);
 
+  // Computes into v_initial the warm start guess described in
+  // SetContactIdentifiers(), starting from v_guess, and returns the number of
+  // contact points that were warm started. v_initial is left unchanged if
+  // that number is zero.
+  int CalcWarmStartGuess(double dt, const VectorX<T>& v_guess,
+                         VectorX<T>* v_initial) const;
+
+  // Records the contact forces of the last solve for each contact point with
+  // an identifier, discarding previously recorded forces.
+  void RecordWarmStartForces() const;
+
+  // Performs the Newton-Raphson iteration for SolveWithGuess(), with the
+  // products and factorizations involving the problem matrices provided by
+  // `linear_algebra`, either a DenseLinearAlgebra or a
+  // TamsiSolverSparseLinearAlgebra.
+  template <class LinearAlgebra>
+  TamsiSolverResult DoSolveWithGuess(
+      double dt, const VectorX<T>& v_guess,
+      LinearAlgebra* linear_algebra) const;
+
   int nv_;  // Number of generalized velocities.
   int nc_;  // Number of contact points.
 
@@ -1142,6 +1313,35 @@ class TamsiSolver {
   ProblemDataAliases problem_data_aliases_;
   mutable FixedSizeWorkspace fixed_size_workspace_;
   mutable VariableSizeWorkspace variable_size_workspace_;
+  // Allocated on the first solve with sparse linear algebra, so that storage
+  // is reused by later solves.
+  mutable std::unique_ptr<internal::TamsiSolverSparseLinearAlgebra>
+      sparse_linear_algebra_;
+
+  // The factorization of the Newton-Raphson Jacobian that the last successful
+  // solve left in the workspaces, used by CalcVelocitiesSensitivity().
+  enum class JacobianFactorization { kNone, kDenseLdlt, kDenseLu, kSparse };
+  mutable JacobianFactorization solution_factorization_{
+      JacobianFactorization::kNone};
+  // The time step of the last successful solve.
+  mutable double solution_dt_{0.0};
+
+  // Identifiers of the contact points in the current problem data, see
+  // SetContactIdentifiers(). Empty if not provided.
+  std::vector<TamsiSolverContactId> contact_ids_;
+  // The contact forces recorded for warm starting, see
+  // SetContactIdentifiers().
+  struct WarmStartForces {
+    Vector2<T> ft;
+    T fn;
+    // True if the slip velocity was within the stiction tolerance.
+    bool in_stiction{false};
+  };
+  // The contact forces of each contact point identified in the last
+  // successful solve.
+  mutable std::unordered_map<TamsiSolverContactId, WarmStartForces,
+                             DefaultHash>
+      warm_start_forces_;
 
   // Precomputed value of cos(theta_max), used by TalsLimiter.
   double cos_theta_max_{std::cos(parameters_.theta_max)};
@@ -0,0 +1,197 @@
+#include "drake/multibody/plant/batch_dynamics_evaluator.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/parsing/parser.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+class BatchDynamicsEvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // A floating iiwa arm, so that q includes a quaternion and nq != nv.
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    Parser(plant_.get())
+        .AddModelFromFile(FindResourceOrThrow(
+            "drake/manipulation/models/iiwa_description/sdf/"
+            "iiwa14_no_collision.sdf"));
+    plant_->Finalize();
+    context_ = plant_->CreateDefaultContext();
+
+    // Arbitrary states, each with a normalized quaternion.
+    const int kNumSamples = 5;
+    const int nq = plant_->num_positions();
+    const int nv = plant_->num_velocities();
+    q_samples_ = MatrixXd::Zero(nq, kNumSamples);
+    v_samples_ = MatrixXd::Zero(nv, kNumSamples);
+    vdot_samples_ = MatrixXd::Zero(nv, kNumSamples);
+    for (int n = 0; n < kNumSamples; ++n) {
+      q_samples_.col(n) = VectorXd::LinSpaced(nq, -1.0, 0.5 * n);
+      q_samples_.col(n).head<4>().normalize();
+      v_samples_.col(n) = VectorXd::LinSpaced(nv, 0.1 * n, 1.0);
+      vdot_samples_.col(n) = VectorXd::LinSpaced(nv, 2.0, -0.3 * n);
+    }
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  MatrixXd q_samples_;
+  MatrixXd v_samples_;
+  MatrixXd vdot_samples_;
+};
+
+TEST_F(BatchDynamicsEvaluatorTest, BatchCalcMassMatrix) {
+  BatchDynamicsEvaluator<double> dut(plant_.get());
+  EXPECT_EQ(&dut.plant(), plant_.get());
+  EXPECT_EQ(dut.num_threads(), 1);
+  // More threads than samples are allowed.
+  for (int num_threads : {1, 3, 8}) {
+    dut.set_num_threads(num_threads);
+    EXPECT_EQ(dut.num_threads(), num_threads);
+    std::vector<MatrixXd> M;
+    dut.BatchCalcMassMatrix(q_samples_, &M);
+    ASSERT_EQ(M.size(), q_samples_.cols());
+    for (int n = 0; n < q_samples_.cols(); ++n) {
+      plant_->SetPositions(context_.get(), q_samples_.col(n));
+      MatrixXd M_expected(plant_->num_velocities(), plant_->num_velocities());
+      plant_->CalcMassMatrix(*context_, &M_expected);
+      EXPECT_TRUE(CompareMatrices(M[n], M_expected, 1e-14));
+    }
+  }
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, BatchCalcInverseDynamics) {
+  BatchDynamicsEvaluator<double> dut(plant_.get());
+  dut.set_num_threads(2);
+  MatrixXd tau;
+  dut.BatchCalcInverseDynamics(q_samples_, v_samples_, vdot_samples_, &tau);
+  ASSERT_EQ(tau.rows(), plant_->num_velocities());
+  ASSERT_EQ(tau.cols(), q_samples_.cols());
+  MultibodyForces<double> forces(*plant_);
+  for (int n = 0; n < q_samples_.cols(); ++n) {
+    plant_->SetPositions(context_.get(), q_samples_.col(n));
+    plant_->SetVelocities(context_.get(), v_samples_.col(n));
+    plant_->CalcForceElementsContribution(*context_, &forces);
+    const VectorXd tau_expected = plant_->CalcInverseDynamics(
+        *context_, vdot_samples_.col(n), forces);
+    EXPECT_TRUE(CompareMatrices(tau.col(n), tau_expected, 1e-12));
+  }
+  // Gravity is included.
+  EXPECT_GT(plant_->CalcGravityGeneralizedForces(*context_).norm(), 1.0);
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, BatchCalcForwardDynamics) {
+  BatchDynamicsEvaluator<double> dut(plant_.get());
+  dut.set_num_threads(2);
+  // The forward dynamics of the inverse dynamics gives back the accelerations.
+  MatrixXd tau;
+  dut.BatchCalcInverseDynamics(q_samples_, v_samples_, vdot_samples_, &tau);
+  MatrixXd vdot;
+  dut.BatchCalcForwardDynamics(q_samples_, v_samples_, tau, &vdot);
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_samples_, 1e-10));
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, BatchCalcSemiExplicitEulerStep) {
+  BatchDynamicsEvaluator<double> dut(plant_.get());
+  dut.set_num_threads(2);
+  const double h = 1e-3;
+  const MatrixXd tau = 0.5 * vdot_samples_;
+  MatrixXd x_next;
+  dut.BatchCalcSemiExplicitEulerStep(h, q_samples_, v_samples_, tau, &x_next);
+  const int nq = plant_->num_positions();
+  const int nv = plant_->num_velocities();
+  ASSERT_EQ(x_next.rows(), plant_->num_multibody_states());
+  ASSERT_EQ(x_next.cols(), q_samples_.cols());
+  MultibodyForces<double> forces(*plant_);
+  for (int n = 0; n < q_samples_.cols(); ++n) {
+    plant_->SetPositions(context_.get(), q_samples_.col(n));
+    plant_->SetVelocities(context_.get(), v_samples_.col(n));
+    plant_->CalcForceElementsContribution(*context_, &forces);
+    forces.mutable_generalized_forces() += tau.col(n);
+    VectorXd vdot(nv);
+    plant_->CalcForwardDynamicsViaArticulatedBodyAlgorithm(*context_, forces,
+                                                           &vdot);
+    const VectorXd v_next = v_samples_.col(n) + h * vdot;
+    VectorXd qdot(nq);
+    plant_->MapVelocityToQDot(*context_, v_next, &qdot);
+    EXPECT_TRUE(CompareMatrices(x_next.col(n).tail(nv), v_next, 1e-14));
+    EXPECT_TRUE(CompareMatrices(x_next.col(n).head(nq),
+                                q_samples_.col(n) + h * qdot, 1e-14));
+  }
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, BatchCalcJacobianSpatialVelocity) {
+  BatchDynamicsEvaluator<double> dut(plant_.get());
+  dut.set_num_threads(2);
+  const Frame<double>& frame_B = plant_->GetFrameByName("iiwa_link_7");
+  const Frame<double>& frame_W = plant_->world_frame();
+  const Vector3d p_BoBp_B(0.1, 0.2, 0.3);
+  for (JacobianWrtVariable wrt :
+       {JacobianWrtVariable::kQDot, JacobianWrtVariable::kV}) {
+    std::vector<MatrixXd> J;
+    dut.BatchCalcJacobianSpatialVelocity(q_samples_, wrt, frame_B, p_BoBp_B,
+                                         frame_W, frame_W, &J);
+    ASSERT_EQ(J.size(), q_samples_.cols());
+    for (int n = 0; n < q_samples_.cols(); ++n) {
+      plant_->SetPositions(context_.get(), q_samples_.col(n));
+      MatrixXd J_expected(6, wrt == JacobianWrtVariable::kQDot
+                                 ? plant_->num_positions()
+                                 : plant_->num_velocities());
+      plant_->CalcJacobianSpatialVelocity(*context_, wrt, frame_B, p_BoBp_B,
+                                          frame_W, frame_W, &J_expected);
+      EXPECT_TRUE(CompareMatrices(J[n], J_expected, 1e-14));
+    }
+  }
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, BadArguments) {
+  EXPECT_THROW(BatchDynamicsEvaluator<double>(nullptr), std::exception);
+  MultibodyPlant<double> unfinalized(0.0);
+  EXPECT_THROW(BatchDynamicsEvaluator<double>{&unfinalized}, std::exception);
+
+  BatchDynamicsEvaluator<double> dut(plant_.get());
+  EXPECT_THROW(dut.set_num_threads(0), std::exception);
+  std::vector<MatrixXd> M;
+  EXPECT_THROW(dut.BatchCalcMassMatrix(MatrixXd::Zero(2, 3), &M),
+               std::exception);
+  EXPECT_THROW(dut.BatchCalcMassMatrix(q_samples_, nullptr), std::exception);
+  MatrixXd tau;
+  EXPECT_THROW(dut.BatchCalcInverseDynamics(q_samples_, v_samples_,
+                                            vdot_samples_.leftCols(1), &tau),
+               std::exception);
+  EXPECT_THROW(dut.BatchCalcInverseDynamics(q_samples_, q_samples_,
+                                            vdot_samples_, &tau),
+               std::exception);
+  EXPECT_THROW(dut.BatchCalcInverseDynamics(q_samples_, v_samples_,
+                                            vdot_samples_, nullptr),
+               std::exception);
+  MatrixXd vdot;
+  EXPECT_THROW(dut.BatchCalcForwardDynamics(q_samples_, v_samples_,
+                                            vdot_samples_.leftCols(1), &vdot),
+               std::exception);
+  EXPECT_THROW(dut.BatchCalcForwardDynamics(q_samples_, v_samples_,
+                                            vdot_samples_, nullptr),
+               std::exception);
+  MatrixXd x_next;
+  EXPECT_THROW(dut.BatchCalcSemiExplicitEulerStep(
+                   0.0, q_samples_, v_samples_, vdot_samples_, &x_next),
+               std::exception);
+  EXPECT_THROW(dut.BatchCalcSemiExplicitEulerStep(
+                   1e-3, q_samples_, v_samples_, vdot_samples_, nullptr),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
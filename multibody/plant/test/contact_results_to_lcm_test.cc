@@ -450,6 +450,57 @@ GTEST_TEST(ContactResultsToLcmTest, HydroelasticContactResults) {
   }
 }
 
+// Verifies that the hydroelastic contact data is omitted as requested.
+GTEST_TEST(ContactResultsToLcmTest, HydroelasticContactVisualizationDetail) {
+  DiagramBuilder<double> builder;
+  MultibodyPlant<double>* plant;
+  geometry::SceneGraph<double>* scene_graph;
+  std::tie(plant, scene_graph) = AddMultibodyPlantSceneGraph(&builder, 0.0);
+  benchmarks::inclined_plane::AddInclinedPlaneWithBlockToPlant(
+      0.0 /* gravity */, 0.0 /* plane angle */,
+      {} /* default plane "dimensions" */, CoulombFriction<double>(),
+      CoulombFriction<double>(), 1.0 /* block mass */,
+      Vector3<double>(1.0, 1.0, 1.0) /* block dimensions */,
+      false /* no spheres */, plant);
+  plant->Finalize();
+
+  std::unique_ptr<ContactSurface<double>> contact_surface;
+  std::unique_ptr<HydroelasticContactInfo<double>> contact_info;
+  const ContactResults<double> contact_results =
+      GenerateHydroelasticContactResults(*plant, &contact_surface,
+                                         &contact_info);
+
+  for (const auto detail :
+       {HydroelasticContactVisualizationDetail::kNoQuadraturePoints,
+        HydroelasticContactVisualizationDetail::kWrenchOnly}) {
+    ContactResultsToLcmSystem<double> dut(*plant, detail);
+    EXPECT_EQ(dut.hydroelastic_detail(), detail);
+    std::unique_ptr<Context<double>> context = dut.CreateDefaultContext();
+    dut.get_contact_result_input_port().FixValue(context.get(),
+                                                 contact_results);
+    const lcmt_contact_results_for_viz& lcm_message =
+        dut.get_lcm_message_output_port().Eval<lcmt_contact_results_for_viz>(
+            *context);
+    ASSERT_EQ(lcm_message.num_hydroelastic_contacts, 1);
+    const lcmt_hydroelastic_contact_surface_for_viz& surface_msg =
+        lcm_message.hydroelastic_contacts[0];
+
+    const Vector3<double> force_C_W(surface_msg.force_C_W[0],
+                                    surface_msg.force_C_W[1],
+                                    surface_msg.force_C_W[2]);
+    EXPECT_EQ(force_C_W, MakeSpatialForce().translational());
+    EXPECT_EQ(surface_msg.num_quadrature_points, 0);
+    EXPECT_TRUE(surface_msg.quadrature_point_data.empty());
+    if (detail == HydroelasticContactVisualizationDetail::kWrenchOnly) {
+      EXPECT_EQ(surface_msg.num_triangles, 0);
+      EXPECT_TRUE(surface_msg.triangles.empty());
+    } else {
+      EXPECT_EQ(surface_msg.num_triangles,
+                contact_surface->mesh_W().num_faces());
+    }
+  }
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -0,0 +1,106 @@
+#include "drake/multibody/plant/forward_kinematics_evaluator.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/parsing/parser.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using math::RigidTransformd;
+
+class ForwardKinematicsEvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // A floating iiwa arm, so that q includes a quaternion.
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    Parser(plant_.get())
+        .AddModelFromFile(FindResourceOrThrow(
+            "drake/manipulation/models/iiwa_description/sdf/"
+            "iiwa14_no_collision.sdf"));
+    plant_->Finalize();
+    context_ = plant_->CreateDefaultContext();
+
+    // Arbitrary configurations, each with a normalized quaternion.
+    const int kNumSamples = 5;
+    q_samples_ = MatrixXd::Zero(plant_->num_positions(), kNumSamples);
+    for (int n = 0; n < kNumSamples; ++n) {
+      q_samples_.col(n) =
+          Eigen::VectorXd::LinSpaced(plant_->num_positions(), -1.0, 0.5 * n);
+      q_samples_.col(n).head<4>().normalize();
+    }
+  }
+
+  // Verifies that `X_WB` stores the poses of all bodies for the configuration
+  // in column `n` of q_samples_, as computed by MultibodyPlant.
+  void ExpectPosesForSample(const RigidTransformd* X_WB, int n) {
+    plant_->SetPositions(context_.get(), q_samples_.col(n));
+    for (BodyIndex i(0); i < plant_->num_bodies(); ++i) {
+      const RigidTransformd& X_WB_expected =
+          plant_->EvalBodyPoseInWorld(*context_, plant_->get_body(i));
+      EXPECT_TRUE(CompareMatrices(X_WB[i].GetAsMatrix34(),
+                                  X_WB_expected.GetAsMatrix34(), 1e-14));
+    }
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  MatrixXd q_samples_;
+};
+
+TEST_F(ForwardKinematicsEvaluatorTest, CalcBodyPosesInWorld) {
+  ForwardKinematicsEvaluator<double> dut(plant_.get());
+  EXPECT_EQ(&dut.plant(), plant_.get());
+  std::vector<RigidTransformd> X_WB;
+  for (int n = 0; n < q_samples_.cols(); ++n) {
+    dut.CalcBodyPosesInWorld(q_samples_.col(n), &X_WB);
+    ASSERT_EQ(X_WB.size(), plant_->num_bodies());
+    ExpectPosesForSample(X_WB.data(), n);
+  }
+}
+
+TEST_F(ForwardKinematicsEvaluatorTest, BatchCalcBodyPosesInWorld) {
+  ForwardKinematicsEvaluator<double> dut(plant_.get());
+  EXPECT_EQ(dut.num_threads(), 1);
+  // More threads than samples are allowed.
+  for (int num_threads : {1, 3, 8}) {
+    dut.set_num_threads(num_threads);
+    EXPECT_EQ(dut.num_threads(), num_threads);
+    std::vector<RigidTransformd> X_WB;
+    dut.BatchCalcBodyPosesInWorld(q_samples_, &X_WB);
+    ASSERT_EQ(X_WB.size(), q_samples_.cols() * plant_->num_bodies());
+    for (int n = 0; n < q_samples_.cols(); ++n) {
+      ExpectPosesForSample(X_WB.data() + n * plant_->num_bodies(), n);
+    }
+  }
+}
+
+TEST_F(ForwardKinematicsEvaluatorTest, BadArguments) {
+  EXPECT_THROW(ForwardKinematicsEvaluator<double>(nullptr), std::exception);
+  MultibodyPlant<double> unfinalized(0.0);
+  EXPECT_THROW(ForwardKinematicsEvaluator<double>{&unfinalized},
+               std::exception);
+
+  ForwardKinematicsEvaluator<double> dut(plant_.get());
+  EXPECT_THROW(dut.set_num_threads(0), std::exception);
+  std::vector<RigidTransformd> X_WB;
+  EXPECT_THROW(dut.CalcBodyPosesInWorld(Eigen::VectorXd::Zero(2), &X_WB),
+               std::exception);
+  EXPECT_THROW(dut.CalcBodyPosesInWorld(q_samples_.col(0), nullptr),
+               std::exception);
+  EXPECT_THROW(dut.BatchCalcBodyPosesInWorld(MatrixXd::Zero(2, 3), &X_WB),
+               std::exception);
+  EXPECT_THROW(dut.BatchCalcBodyPosesInWorld(q_samples_, nullptr),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,167 @@
+#include <limits>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using multibody::Parser;
+using systems::Context;
+
+namespace multibody {
+namespace {
+
+const char kArmSdfPath[] =
+    "drake/manipulation/models/iiwa_description/sdf/iiwa14_no_collision.sdf";
+const char kWsg50SdfPath[] =
+    "drake/manipulation/models/wsg_50_description/sdf/schunk_wsg_50.sdf";
+
+// We verify the analytical derivatives of inverse and forward dynamics against
+// those computed with automatic differentiation. The model is a KUKA iiwa arm
+// welded to the world, with a Schunk WSG gripper welded to its end effector.
+// Therefore the model has revolute, prismatic and weld joints.
+class MultibodyPlantDynamicsDerivativesTests : public ::testing::Test {
+ public:
+  void SetUp() override {
+    Parser parser(&plant_);
+    const ModelInstanceIndex arm_model =
+        parser.AddModelFromFile(FindResourceOrThrow(kArmSdfPath));
+    const ModelInstanceIndex gripper_model =
+        parser.AddModelFromFile(FindResourceOrThrow(kWsg50SdfPath));
+    const auto& base_body = plant_.GetBodyByName("iiwa_link_0", arm_model);
+    const auto& end_effector = plant_.GetBodyByName("iiwa_link_7", arm_model);
+    const auto& gripper_body = plant_.GetBodyByName("body", gripper_model);
+    plant_.WeldFrames(plant_.world_frame(), base_body.body_frame());
+    plant_.WeldFrames(end_effector.body_frame(), gripper_body.body_frame());
+    plant_.Finalize();
+    context_ = plant_.CreateDefaultContext();
+
+    plant_autodiff_ = systems::System<double>::ToAutoDiffXd(plant_);
+    context_autodiff_ = plant_autodiff_->CreateDefaultContext();
+
+    // An arbitrary state with non-zero entries.
+    const int nv = plant_.num_velocities();
+    ASSERT_EQ(plant_.num_positions(), nv);
+    q_ = VectorXd::LinSpaced(nv, -1.2, 1.5);
+    v_ = VectorXd::LinSpaced(nv, 0.8, -0.9);
+    vdot_ = VectorXd::LinSpaced(nv, 2.0, -1.0);
+    plant_.SetPositions(context_.get(), q_);
+    plant_.SetVelocities(context_.get(), v_);
+  }
+
+  // Sets the state of the AutoDiffXd model to x = [q; v] with the gradients
+  // of the identity.
+  void SetAutoDiffState() {
+    const int nv = plant_.num_velocities();
+    VectorXd x(2 * nv);
+    x << q_, v_;
+    const VectorX<AutoDiffXd> x_autodiff = math::initializeAutoDiff(x);
+    plant_autodiff_->SetPositions(context_autodiff_.get(),
+                                  x_autodiff.head(nv));
+    plant_autodiff_->SetVelocities(context_autodiff_.get(),
+                                   x_autodiff.tail(nv));
+  }
+
+  // Computes tau_id = M(q)v̇ + C(q, v)v - tau_g(q) on the AutoDiffXd model.
+  VectorX<AutoDiffXd> CalcInverseDynamicsAutoDiff(
+      const VectorX<AutoDiffXd>& vdot) const {
+    const MultibodyForces<AutoDiffXd> forces(*plant_autodiff_);
+    return plant_autodiff_->CalcInverseDynamics(*context_autodiff_, vdot,
+                                                forces) -
+           plant_autodiff_->CalcGravityGeneralizedForces(*context_autodiff_);
+  }
+
+ protected:
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_autodiff_;
+  std::unique_ptr<Context<AutoDiffXd>> context_autodiff_;
+  VectorXd q_, v_, vdot_;
+};
+
+TEST_F(MultibodyPlantDynamicsDerivativesTests, InverseDynamics) {
+  const int nv = plant_.num_velocities();
+  MatrixXd dtau_dq(nv, nv);
+  MatrixXd dtau_dv(nv, nv);
+  plant_.CalcInverseDynamicsDerivatives(*context_, vdot_, &dtau_dq, &dtau_dv);
+
+  SetAutoDiffState();
+  const VectorX<AutoDiffXd> tau_autodiff =
+      CalcInverseDynamicsAutoDiff(vdot_.cast<AutoDiffXd>());
+  const MatrixXd dtau_dx = math::autoDiffToGradientMatrix(tau_autodiff);
+
+  const double kTolerance = 1.0e-12 * dtau_dx.norm();
+  EXPECT_TRUE(CompareMatrices(dtau_dq, dtau_dx.leftCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, dtau_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+}
+
+TEST_F(MultibodyPlantDynamicsDerivativesTests, ForwardDynamics) {
+  const int nv = plant_.num_velocities();
+  const VectorXd tau = VectorXd::LinSpaced(nv, -3.0, 3.0);
+  VectorXd vdot(nv);
+  MatrixXd dvdot_dq(nv, nv);
+  MatrixXd dvdot_dv(nv, nv);
+  plant_.CalcForwardDynamicsDerivatives(*context_, tau, &vdot, &dvdot_dq,
+                                        &dvdot_dv);
+
+  // v̇ = M⁻¹(tau + tau_g - Cv), on the AutoDiffXd model.
+  SetAutoDiffState();
+  MatrixX<AutoDiffXd> M(nv, nv);
+  plant_autodiff_->CalcMassMatrix(*context_autodiff_, &M);
+  VectorX<AutoDiffXd> Cv(nv);
+  plant_autodiff_->CalcBiasTerm(*context_autodiff_, &Cv);
+  const VectorX<AutoDiffXd> vdot_autodiff = M.ldlt().solve(
+      tau.cast<AutoDiffXd>() +
+      plant_autodiff_->CalcGravityGeneralizedForces(*context_autodiff_) - Cv);
+  const MatrixXd dvdot_dx = math::autoDiffToGradientMatrix(vdot_autodiff);
+
+  const double kTolerance = 1.0e-10;
+  EXPECT_TRUE(CompareMatrices(vdot, math::autoDiffToValueMatrix(vdot_autodiff),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dvdot_dq, dvdot_dx.leftCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dvdot_dv, dvdot_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+
+  // The accelerations satisfy the inverse dynamics with the applied forces.
+  const MultibodyForces<double> forces(plant_);
+  const VectorXd tau_id = plant_.CalcInverseDynamics(*context_, vdot, forces) -
+                          plant_.CalcGravityGeneralizedForces(*context_);
+  EXPECT_TRUE(CompareMatrices(tau_id, tau, kTolerance,
+                              MatrixCompareType::relative));
+}
+
+// Analytical derivatives are not available for a floating base.
+GTEST_TEST(MultibodyPlantDynamicsDerivatives, FloatingBaseThrows) {
+  MultibodyPlant<double> plant(0.0);
+  Parser(&plant).AddModelFromFile(FindResourceOrThrow(kArmSdfPath));
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  MatrixXd dtau_dq(nv, nq);
+  MatrixXd dtau_dv(nv, nv);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant.CalcInverseDynamicsDerivatives(*context, VectorXd::Zero(nv),
+                                           &dtau_dq, &dtau_dv),
+      std::exception,
+      ".*mobilizer of body 'iiwa_link_0' is not supported.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
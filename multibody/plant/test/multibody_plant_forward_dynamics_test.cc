@@ -1,4 +1,6 @@
 #include <limits>
+#include <stdexcept>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -147,6 +149,99 @@ TEST_F(KukaIiwaModelForwardDynamicsTests, ForwardDynamicsTest) {
   CompareForwardDynamics(q, qdot);
 }
 
+// Verifies the forward dynamics for given applied forces, and that the
+// articulated body inertias are reused across velocities and forces.
+TEST_F(KukaIiwaModelForwardDynamicsTests, ForwardDynamicsWithGivenForces) {
+  SetArbitraryConfiguration();
+  const int nv = plant_->num_velocities();
+
+  // With the forces of the force elements (here only gravity) the
+  // accelerations match those of the full model.
+  MultibodyForces<double> forces(*plant_);
+  plant_->CalcForceElementsContribution(*context_, &forces);
+  VectorX<double> vdot(nv);
+  plant_->CalcForwardDynamicsViaArticulatedBodyAlgorithm(*context_, forces,
+                                                         &vdot);
+  const VectorX<double> vdot_expected =
+      MultibodyPlantTester::CalcGeneralizedAccelerations(*plant_, *context_);
+  MatrixX<double> M(nv, nv);
+  plant_->CalcMassMatrix(*context_, &M);
+  const double kRelativeTolerance = kEpsilon / M.llt().rcond();
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_expected, kRelativeTolerance,
+                              MatrixCompareType::relative));
+
+  // Additional generalized forces tau accelerate the model by M⁻¹ tau.
+  const VectorX<double> tau = VectorX<double>::LinSpaced(nv, -2.0, 3.0);
+  forces.mutable_generalized_forces() += tau;
+  VectorX<double> vdot_with_tau(nv);
+  plant_->CalcForwardDynamicsViaArticulatedBodyAlgorithm(*context_, forces,
+                                                         &vdot_with_tau);
+  EXPECT_TRUE(CompareMatrices(vdot_with_tau - vdot, M.llt().solve(tau),
+                              kRelativeTolerance,
+                              MatrixCompareType::relative));
+
+  // The articulated body inertias only depend on q and the parameters.
+  const systems::CacheEntry* abi_entry = nullptr;
+  for (systems::CacheIndex i(0); i < plant_->num_cache_entries(); ++i) {
+    if (plant_->get_cache_entry(i).description() ==
+        "Articulated Body Inertia") {
+      abi_entry = &plant_->get_cache_entry(i);
+    }
+  }
+  ASSERT_NE(abi_entry, nullptr);
+  EXPECT_FALSE(abi_entry->is_out_of_date(*context_));
+  plant_->SetVelocities(context_.get(), VectorX<double>::Zero(nv));
+  context_->SetAccuracy(1e-4);
+  EXPECT_FALSE(abi_entry->is_out_of_date(*context_));
+  plant_->SetPositions(context_.get(), plant_->GetPositions(*context_));
+  EXPECT_TRUE(abi_entry->is_out_of_date(*context_));
+
+  EXPECT_THROW(plant_->CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+                   *context_, forces, nullptr),
+               std::exception);
+}
+
+// Verifies that changing the mass of a body only invalidates the cache entries
+// that depend on the mass properties, while changing the pose of a fixed
+// offset frame also invalidates the kinematics.
+TEST_F(KukaIiwaModelForwardDynamicsTests, ParameterInvalidation) {
+  SetArbitraryConfiguration();
+  auto get_entry = [this](const std::string& description) {
+    for (systems::CacheIndex i(0); i < plant_->num_cache_entries(); ++i) {
+      if (plant_->get_cache_entry(i).description() == description) {
+        return &plant_->get_cache_entry(i);
+      }
+    }
+    throw std::logic_error("No cache entry named " + description);
+  };
+  const systems::CacheEntry* position_kinematics =
+      get_entry("position kinematics");
+  const systems::CacheEntry* spatial_inertias =
+      get_entry("spatial inertia in world (M_B_W)");
+  const systems::CacheEntry* abi = get_entry("Articulated Body Inertia");
+  const VectorX<double> vdot =
+      MultibodyPlantTester::CalcGeneralizedAccelerations(*plant_, *context_);
+  EXPECT_FALSE(position_kinematics->is_out_of_date(*context_));
+  EXPECT_FALSE(spatial_inertias->is_out_of_date(*context_));
+  EXPECT_FALSE(abi->is_out_of_date(*context_));
+
+  const RigidBody<double>& link = plant_->GetRigidBodyByName("iiwa_link_3");
+  link.SetMass(context_.get(), 2.0 * link.get_mass(*context_));
+  EXPECT_FALSE(position_kinematics->is_out_of_date(*context_));
+  EXPECT_TRUE(spatial_inertias->is_out_of_date(*context_));
+  EXPECT_TRUE(abi->is_out_of_date(*context_));
+  // The new mass is accounted for.
+  const VectorX<double> vdot_heavier =
+      MultibodyPlantTester::CalcGeneralizedAccelerations(*plant_, *context_);
+  EXPECT_FALSE(CompareMatrices(vdot_heavier, vdot, 1e-6));
+
+  const auto& frame_H =
+      dynamic_cast<const FixedOffsetFrame<double>&>(*frame_H_);
+  frame_H.SetPoseInBodyFrame(context_.get(), math::RigidTransformd::Identity());
+  EXPECT_TRUE(position_kinematics->is_out_of_date(*context_));
+  EXPECT_TRUE(spatial_inertias->is_out_of_date(*context_));
+}
+
 // For complex articulated systems such as a humanoid robot, round-off errors
 // might accumulate leading to (close to, by machine epsilon) unphysical ABIs in
 // the Articulated Body Algorithm. See related issue #12640.
@@ -119,6 +119,31 @@ TEST_F(HydroelasticContactResultsOutputTester, ContactSurfaceEquivalent) {
       contact_results().contact_surface().Equal(contact_surfaces.front()));
 }
 
+// Checks that copying the contact results from the output port copies the
+// hydroelastic contact info, whereas copies of that copy share it.
+TEST_F(HydroelasticContactResultsOutputTester, CopySemantics) {
+  const ContactResults<double>& output =
+      plant_->get_contact_results_output_port().Eval<ContactResults<double>>(
+          *plant_context_);
+  const ContactResults<double> copy(output);
+  ASSERT_EQ(copy.num_hydroelastic_contacts(), 1);
+  EXPECT_NE(&copy.hydroelastic_contact_info(0),
+            &output.hydroelastic_contact_info(0));
+  EXPECT_TRUE(copy.hydroelastic_contact_info(0).contact_surface().Equal(
+      output.hydroelastic_contact_info(0).contact_surface()));
+
+  ContactResults<double> copy_of_copy;
+  copy_of_copy = copy;
+  ASSERT_EQ(copy_of_copy.num_hydroelastic_contacts(), 1);
+  EXPECT_EQ(&copy_of_copy.hydroelastic_contact_info(0),
+            &copy.hydroelastic_contact_info(0));
+
+  // Clearing a copy does not affect the other copies.
+  copy_of_copy.Clear();
+  EXPECT_EQ(copy_of_copy.num_hydroelastic_contacts(), 0);
+  EXPECT_EQ(copy.num_hydroelastic_contacts(), 1);
+}
+
 // Checks that the spatial force (applied at the centroid) from the output port
 // is consistent with the ball state that we have set.
 TEST_F(HydroelasticContactResultsOutputTester, SpatialForceAtCentroid) {
@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -280,6 +282,94 @@ TEST_F(KukaIiwaModelTests, CalcJacobianTranslationalVelocityB) {
                               kTolerance, MatrixCompareType::relative));
 }
 
+// Verifies that the batched CalcSparsePointsJacobians() matches, entry by
+// entry, the Jacobians computed by CalcJacobianAngularVelocity() and
+// CalcJacobianTranslationalVelocity(), and that only the columns for the
+// mobilizers between frames A and B are stored.
+TEST_F(KukaIiwaModelTests, CalcSparsePointsJacobians) {
+  SetArbitraryConfiguration();
+
+  const Frame<double>& frame_W = plant_->world_frame();
+  const Frame<double>& frame_A =
+      plant_->GetBodyByName("iiwa_link_3").body_frame();
+  const Frame<double>& frame_E =
+      plant_->GetBodyByName("iiwa_link_5").body_frame();
+  const Frame<double>& frame_E7 = end_effector_link_->body_frame();
+
+  std::vector<PointsOnFrame<double>> points(4);
+  points[0].frame_B = &frame_E7;
+  points[0].p_BoBi_B.resize(3, 2);
+  points[0].p_BoBi_B.col(0) << 0.1, -0.05, 0.02;
+  points[0].p_BoBi_B.col(1) << 0.2, 0.3, -0.15;
+  points[1].frame_B = frame_H_;
+  points[1].p_BoBi_B = Vector3d(-0.1, 0.2, 0.05);
+  // Frame B inboard of frame A.
+  points[2].frame_B = &frame_W;
+  points[2].p_BoBi_B = Vector3d(0.3, 0.1, -0.2);
+  // Frame B is frame A.
+  points[3].frame_B = &frame_A;
+  points[3].p_BoBi_B = Vector3d(0.1, 0.1, 0.1);
+
+  // The arm joints 4 to 7 are outboard of frame A. The floating base and
+  // joints 1 to 3 are between frame A and the world.
+  const int kNumArmJointsOutboardOfA = 4;
+
+  std::vector<SparsePointsJacobian<double>> jacobians;
+  for (const JacobianWrtVariable with_respect_to :
+       {JacobianWrtVariable::kV, JacobianWrtVariable::kQDot}) {
+    const bool is_wrt_qdot = with_respect_to == JacobianWrtVariable::kQDot;
+    const int num_columns =
+        is_wrt_qdot ? plant_->num_positions() : plant_->num_velocities();
+    const int num_base_columns = is_wrt_qdot ? 7 : 6;
+    plant_->CalcSparsePointsJacobians(*context_, with_respect_to, points,
+                                      frame_A, frame_E, &jacobians);
+    ASSERT_EQ(jacobians.size(), points.size());
+    EXPECT_EQ(jacobians[0].columns.size(), kNumArmJointsOutboardOfA);
+    EXPECT_EQ(jacobians[1].columns.size(), kNumArmJointsOutboardOfA);
+    EXPECT_EQ(jacobians[2].columns.size(), num_base_columns + 3);
+    EXPECT_EQ(jacobians[3].columns.size(), 0);
+
+    for (size_t k = 0; k < points.size(); ++k) {
+      const Frame<double>& frame_B = *points[k].frame_B;
+      const int num_points = points[k].p_BoBi_B.cols();
+      const SparsePointsJacobian<double>& jacobian = jacobians[k];
+      EXPECT_TRUE(std::is_sorted(jacobian.columns.begin(),
+                                 jacobian.columns.end()));
+
+      Matrix3X<double> Js_w_AB_E(3, num_columns);
+      plant_->CalcJacobianAngularVelocity(*context_, with_respect_to, frame_B,
+                                          frame_A, frame_E, &Js_w_AB_E);
+      MatrixXd Js_v_ABi_E(3 * num_points, num_columns);
+      plant_->CalcJacobianTranslationalVelocity(
+          *context_, with_respect_to, frame_B, points[k].p_BoBi_B, frame_A,
+          frame_E, &Js_v_ABi_E);
+
+      // Scatter the stored columns into dense Jacobians.
+      Matrix3X<double> Js_w_AB_E_sparse = Matrix3X<double>::Zero(3,
+                                                                 num_columns);
+      MatrixXd Js_v_ABi_E_sparse = MatrixXd::Zero(3 * num_points, num_columns);
+      for (size_t c = 0; c < jacobian.columns.size(); ++c) {
+        Js_w_AB_E_sparse.col(jacobian.columns[c]) = jacobian.Js_w_AB_E.col(c);
+        Js_v_ABi_E_sparse.col(jacobian.columns[c]) =
+            jacobian.Js_v_ABi_E.col(c);
+      }
+      const double kTolerance = 32 * std::numeric_limits<double>::epsilon();
+      EXPECT_TRUE(CompareMatrices(Js_w_AB_E_sparse, Js_w_AB_E, kTolerance));
+      EXPECT_TRUE(CompareMatrices(Js_v_ABi_E_sparse, Js_v_ABi_E, kTolerance));
+    }
+  }
+
+  EXPECT_THROW(plant_->CalcSparsePointsJacobians(
+                   *context_, JacobianWrtVariable::kV, points, frame_A,
+                   frame_E, nullptr),
+               std::exception);
+  points[1].frame_B = nullptr;
+  EXPECT_THROW(plant_->CalcSparsePointsJacobians(
+                   *context_, JacobianWrtVariable::kV, points, frame_A,
+                   frame_E, &jacobians),
+               std::exception);
+}
+
 // Fixture for a two degree-of-freedom pendulum having two links A and B.
 // Link A is connected to world (frame W) with a z-axis pin joint (PinJoint1).
 // Link B is connected to link A with another z-axis pin joint (PinJoint2).
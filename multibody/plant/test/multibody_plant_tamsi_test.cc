@@ -1,9 +1,11 @@
 #include <memory>
+#include <string>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
@@ -70,6 +72,318 @@ GTEST_TEST(MbpWithTamsiSolver, FixedWorld) {
       diagram->CalcDiscreteVariableUpdates(*context, new_discrete_state.get()));
 }
 
+// Verifies that the batched discrete update produces, for each context, the
+// same result as the regular (per context) discrete update.
+GTEST_TEST(MbpWithTamsiSolver, CalcDiscreteVariableUpdatesBatch) {
+  const double discrete_update_period = 1.0e-3;
+  MultibodyPlant<double> plant(discrete_update_period);
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::MakeFromCentralInertia(
+          2.0, Vector3d::Zero(), UnitInertia<double>::SolidBox(0.1, 0.2, 0.3));
+  plant.AddRigidBody("box", M_BBo_B);
+  plant.Finalize();
+
+  const int num_environments = 3;
+  std::vector<std::unique_ptr<Context<double>>> owned_contexts;
+  std::vector<const Context<double>*> contexts;
+  for (int i = 0; i < num_environments; ++i) {
+    owned_contexts.push_back(plant.CreateDefaultContext());
+    Context<double>* context = owned_contexts.back().get();
+    VectorX<double> v(plant.num_velocities());
+    v << 0.1 * i, 0.2, -0.3 * i, 1.0, 2.0 * i, -3.0;
+    plant.SetVelocities(context, v);
+    contexts.push_back(context);
+  }
+
+  MatrixX<double> x_next;
+  plant.CalcDiscreteVariableUpdatesBatch(contexts, &x_next);
+  ASSERT_EQ(x_next.rows(), plant.num_multibody_states());
+  ASSERT_EQ(x_next.cols(), num_environments);
+
+  auto updates = plant.AllocateDiscreteVariables();
+  for (int i = 0; i < num_environments; ++i) {
+    plant.CalcDiscreteVariableUpdates(*contexts[i], updates.get());
+    EXPECT_EQ(x_next.col(i), updates->get_vector().get_value());
+  }
+
+  // Contexts that belong to a different system are rejected.
+  MultibodyPlant<double> other_plant(discrete_update_period);
+  other_plant.Finalize();
+  auto other_context = other_plant.CreateDefaultContext();
+  contexts.push_back(other_context.get());
+  EXPECT_THROW(plant.CalcDiscreteVariableUpdatesBatch(contexts, &x_next),
+               std::exception);
+
+  // The batched update is only supported for discrete models.
+  MultibodyPlant<double> continuous_plant(0.0);
+  continuous_plant.Finalize();
+  auto continuous_context = continuous_plant.CreateDefaultContext();
+  EXPECT_THROW(continuous_plant.CalcDiscreteVariableUpdatesBatch(
+                   {continuous_context.get()}, &x_next),
+               std::exception);
+}
+
+// Verifies that, when enabled, the plant accumulates the time spent in each of
+// the stages of its discrete updates.
+GTEST_TEST(MbpWithTamsiSolver, DiscreteUpdateTimingStatistics) {
+  systems::DiagramBuilder<double> builder;
+  auto items = AddMultibodyPlantSceneGraph(&builder, 1.0e-3);
+  MultibodyPlant<double>& plant = items.plant;
+  const double radius = 0.1;
+  const RigidBody<double>& ball = plant.AddRigidBody(
+      "ball", SpatialInertia<double>::MakeFromCentralInertia(
+                  1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(
+                                             radius)));
+  const CoulombFriction<double> friction(0.5, 0.5);
+  plant.RegisterCollisionGeometry(ball, RigidTransformd::Identity(),
+                                  geometry::Sphere(radius), "ball", friction);
+  plant.RegisterCollisionGeometry(plant.world_body(),
+                                  RigidTransformd::Identity(),
+                                  geometry::HalfSpace(), "ground", friction);
+  plant.Finalize();
+  auto diagram = builder.Build();
+
+  auto context = diagram->CreateDefaultContext();
+  Context<double>& plant_context =
+      plant.GetMyMutableContextFromRoot(context.get());
+  // Place the ball so that it penetrates the ground.
+  plant.SetFreeBodyPose(&plant_context, ball,
+                        RigidTransformd(Vector3d(0.0, 0.0, 0.9 * radius)));
+  auto updates = diagram->AllocateDiscreteVariables();
+
+  // Timing is disabled by default.
+  EXPECT_FALSE(plant.get_discrete_update_timing_enabled());
+  diagram->CalcDiscreteVariableUpdates(*context, updates.get());
+  EXPECT_EQ(plant.get_discrete_update_timing_statistics().num_discrete_updates,
+            0);
+  EXPECT_EQ(plant.get_discrete_update_timing_statistics().discrete_update_time,
+            0.0);
+
+  plant.set_discrete_update_timing_enabled(true);
+  EXPECT_TRUE(plant.get_discrete_update_timing_enabled());
+  // Invalidate the cached contact solver results so that they are recomputed.
+  plant.SetFreeBodyPose(&plant_context, ball,
+                        RigidTransformd(Vector3d(0.0, 0.0, 0.8 * radius)));
+  diagram->CalcDiscreteVariableUpdates(*context, updates.get());
+  plant.get_contact_results_output_port().Eval<ContactResults<double>>(
+      plant_context);
+  {
+    const DiscreteUpdateTimingStatistics& stats =
+        plant.get_discrete_update_timing_statistics();
+    EXPECT_EQ(stats.num_discrete_updates, 1);
+    EXPECT_GT(stats.discrete_update_time, 0.0);
+    EXPECT_GT(stats.discrete_contact_pairs_time, 0.0);
+    EXPECT_GT(stats.contact_jacobians_time, 0.0);
+    EXPECT_GT(stats.contact_solver_time, 0.0);
+    EXPECT_GT(stats.contact_results_time, 0.0);
+    // There is no hydroelastic contact with the default contact model.
+    EXPECT_EQ(stats.contact_surfaces_time, 0.0);
+    // The contact solver is evaluated within the discrete update.
+    EXPECT_LE(stats.contact_solver_time, stats.discrete_update_time);
+  }
+
+  plant.ResetDiscreteUpdateTimingStatistics();
+  EXPECT_EQ(plant.get_discrete_update_timing_statistics().num_discrete_updates,
+            0);
+  EXPECT_EQ(plant.get_discrete_update_timing_statistics().contact_solver_time,
+            0.0);
+
+  // Timing is only supported for discrete models.
+  MultibodyPlant<double> continuous_plant(0.0);
+  EXPECT_THROW(continuous_plant.set_discrete_update_timing_enabled(true),
+               std::exception);
+}
+
+// Verifies that a free body at rest on the ground goes to sleep, that its
+// state is then frozen, and that it wakes up when disturbed.
+GTEST_TEST(MbpWithTamsiSolver, BodySleeping) {
+  systems::DiagramBuilder<double> builder;
+  auto items = AddMultibodyPlantSceneGraph(&builder, 1.0e-3);
+  MultibodyPlant<double>& plant = items.plant;
+  const double radius = 0.1;
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::MakeFromCentralInertia(
+          1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(radius));
+  const RigidBody<double>& ball = plant.AddRigidBody("ball", M_BBo_B);
+  const RigidBody<double>& other_ball = plant.AddRigidBody("other", M_BBo_B);
+  const CoulombFriction<double> friction(0.5, 0.5);
+  plant.RegisterCollisionGeometry(ball, RigidTransformd::Identity(),
+                                  geometry::Sphere(radius), "ball", friction);
+  plant.RegisterCollisionGeometry(other_ball, RigidTransformd::Identity(),
+                                  geometry::Sphere(radius), "other", friction);
+  plant.RegisterCollisionGeometry(plant.world_body(),
+                                  RigidTransformd::Identity(),
+                                  geometry::HalfSpace(), "ground", friction);
+  EXPECT_FALSE(plant.get_body_sleeping_parameters().has_value());
+  BodySleepingParameters parameters;
+  parameters.velocity_threshold = 1.0e-2;
+  parameters.num_steps_to_sleep = 5;
+  plant.set_body_sleeping_parameters(parameters);
+  plant.Finalize();
+  ASSERT_TRUE(plant.get_body_sleeping_parameters().has_value());
+  EXPECT_EQ(plant.get_body_sleeping_parameters()->num_steps_to_sleep, 5);
+  auto diagram = builder.Build();
+
+  auto context = diagram->CreateDefaultContext();
+  Context<double>& plant_context =
+      plant.GetMyMutableContextFromRoot(context.get());
+  // The sleeping state is a second group of discrete state.
+  EXPECT_EQ(plant_context.num_discrete_state_groups(), 2);
+  // The ball rests on the ground, while the other ball is far away and falls.
+  plant.SetFreeBodyPose(&plant_context, ball,
+                        RigidTransformd(Vector3d(0.0, 0.0, radius)));
+  plant.SetFreeBodyPose(&plant_context, other_ball,
+                        RigidTransformd(Vector3d(1.0, 0.0, 100.0)));
+  EXPECT_FALSE(plant.IsBodySleeping(plant_context, ball));
+  EXPECT_FALSE(plant.IsBodySleeping(plant_context, plant.world_body()));
+
+  auto updates = diagram->AllocateDiscreteVariables();
+  const auto step = [&]() {
+    diagram->CalcDiscreteVariableUpdates(*context, updates.get());
+    context->get_mutable_discrete_state().SetFrom(*updates);
+  };
+  for (int i = 0; i < 2000 && !plant.IsBodySleeping(plant_context, ball);
+       ++i) {
+    step();
+  }
+  ASSERT_TRUE(plant.IsBodySleeping(plant_context, ball));
+  // A falling body does not sleep.
+  EXPECT_FALSE(plant.IsBodySleeping(plant_context, other_ball));
+
+  // The state of the sleeping ball is frozen, while the other ball falls.
+  const RigidTransformd X_WB = plant.EvalBodyPoseInWorld(plant_context, ball);
+  const double z_other =
+      plant.EvalBodyPoseInWorld(plant_context, other_ball).translation().z();
+  for (int i = 0; i < 10; ++i) step();
+  EXPECT_TRUE(plant.IsBodySleeping(plant_context, ball));
+  EXPECT_TRUE(plant.EvalBodyPoseInWorld(plant_context, ball).IsExactlyEqualTo(
+      X_WB));
+  EXPECT_TRUE(CompareMatrices(
+      plant.EvalBodySpatialVelocityInWorld(plant_context, ball).get_coeffs(),
+      Vector6<double>::Zero()));
+  EXPECT_LT(
+      plant.EvalBodyPoseInWorld(plant_context, other_ball).translation().z(),
+      z_other);
+
+  // An awake body in contact wakes up the sleeping ball deterministically.
+  plant.SetFreeBodyPose(&plant_context, other_ball,
+                        RigidTransformd(Vector3d(0.0, 0.0, 2.9 * radius)));
+  EXPECT_FALSE(plant.IsBodySleeping(plant_context, ball));
+  step();
+  EXPECT_FALSE(plant.IsBodySleeping(plant_context, ball));
+
+  // The default state is awake.
+  plant.SetDefaultContext(&plant_context);
+  EXPECT_TRUE(CompareMatrices(plant_context.get_discrete_state(1).get_value(),
+                              Eigen::Vector2d::Zero()));
+
+  // Sleeping can only be configured pre-finalize, for discrete models, and
+  // with positive parameters.
+  EXPECT_THROW(plant.set_body_sleeping_parameters(std::nullopt),
+               std::exception);
+  MultibodyPlant<double> continuous_plant(0.0);
+  EXPECT_THROW(continuous_plant.set_body_sleeping_parameters(parameters),
+               std::exception);
+  MultibodyPlant<double> discrete_plant(1.0e-3);
+  parameters.num_steps_to_sleep = 0;
+  EXPECT_THROW(discrete_plant.set_body_sleeping_parameters(parameters),
+               std::exception);
+}
+
+// Compares the discrete updates of a scene with separate groups of bodies
+// when its contact islands are solved independently, on several threads, with
+// those of a single solve.
+GTEST_TEST(MbpWithTamsiSolver, ContactIslands) {
+  const double radius = 0.1;
+  const auto make_diagram = [radius](bool islands_enabled,
+                                     MultibodyPlant<double>** plant_out) {
+    systems::DiagramBuilder<double> builder;
+    auto items = AddMultibodyPlantSceneGraph(&builder, 1.0e-3);
+    MultibodyPlant<double>& plant = items.plant;
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::MakeFromCentralInertia(
+            1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(radius));
+    const CoulombFriction<double> friction(0.5, 0.5);
+    // Three stacks of two balls each.
+    for (int i = 0; i < 6; ++i) {
+      const RigidBody<double>& ball =
+          plant.AddRigidBody("ball" + std::to_string(i), M_BBo_B);
+      plant.RegisterCollisionGeometry(ball, RigidTransformd::Identity(),
+                                      geometry::Sphere(radius),
+                                      "ball" + std::to_string(i), friction);
+    }
+    plant.RegisterCollisionGeometry(plant.world_body(),
+                                    RigidTransformd::Identity(),
+                                    geometry::HalfSpace(), "ground", friction);
+    EXPECT_FALSE(plant.get_contact_islands_enabled());
+    plant.set_contact_islands_enabled(islands_enabled);
+    plant.Finalize();
+    EXPECT_EQ(plant.get_contact_islands_enabled(), islands_enabled);
+    *plant_out = &plant;
+    return builder.Build();
+  };
+
+  MultibodyPlant<double>* plant{};
+  MultibodyPlant<double>* expected_plant{};
+  auto diagram = make_diagram(true, &plant);
+  auto expected_diagram = make_diagram(false, &expected_plant);
+  EXPECT_EQ(plant->get_contact_island_num_threads(), 1);
+  plant->set_contact_island_num_threads(2);
+  EXPECT_EQ(plant->get_contact_island_num_threads(), 2);
+
+  auto context = diagram->CreateDefaultContext();
+  auto expected_context = expected_diagram->CreateDefaultContext();
+  for (auto [p, c] : {std::make_pair(plant, context.get()),
+                      std::make_pair(expected_plant, expected_context.get())}) {
+    Context<double>& plant_context = p->GetMyMutableContextFromRoot(c);
+    for (int i = 0; i < 6; ++i) {
+      const Vector3d p_WB(i / 2, 0.0, (i % 2 == 0 ? 0.99 : 2.95) * radius);
+      p->SetFreeBodyPose(&plant_context,
+                         p->GetBodyByName("ball" + std::to_string(i)),
+                         RigidTransformd(p_WB));
+    }
+  }
+
+  auto updates = diagram->AllocateDiscreteVariables();
+  auto expected_updates = expected_diagram->AllocateDiscreteVariables();
+  for (int step = 0; step < 100; ++step) {
+    diagram->CalcDiscreteVariableUpdates(*context, updates.get());
+    expected_diagram->CalcDiscreteVariableUpdates(*expected_context,
+                                                  expected_updates.get());
+    ASSERT_TRUE(CompareMatrices(updates->get_vector(0).get_value(),
+                                expected_updates->get_vector(0).get_value(),
+                                1.0e-6));
+    context->get_mutable_discrete_state().SetFrom(*updates);
+    expected_context->get_mutable_discrete_state().SetFrom(*expected_updates);
+  }
+
+  // The contact results are assembled from those of the islands.
+  const ContactResults<double>& contact_results =
+      plant->get_contact_results_output_port().Eval<ContactResults<double>>(
+          plant->GetMyContextFromRoot(*context));
+  const ContactResults<double>& expected_contact_results =
+      expected_plant->get_contact_results_output_port()
+          .Eval<ContactResults<double>>(
+              expected_plant->GetMyContextFromRoot(*expected_context));
+  ASSERT_EQ(contact_results.num_point_pair_contacts(),
+            expected_contact_results.num_point_pair_contacts());
+  EXPECT_EQ(contact_results.num_point_pair_contacts(), 6);
+  for (int i = 0; i < contact_results.num_point_pair_contacts(); ++i) {
+    EXPECT_TRUE(CompareMatrices(
+        contact_results.point_pair_contact_info(i).contact_force(),
+        expected_contact_results.point_pair_contact_info(i).contact_force(),
+        1.0e-4));
+  }
+
+  // Islands can only be configured pre-finalize, for discrete models, with a
+  // positive number of threads.
+  EXPECT_THROW(plant->set_contact_islands_enabled(false), std::exception);
+  EXPECT_THROW(plant->set_contact_island_num_threads(0), std::exception);
+  MultibodyPlant<double> continuous_plant(0.0);
+  EXPECT_THROW(continuous_plant.set_contact_islands_enabled(true),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
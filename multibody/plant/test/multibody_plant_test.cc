@@ -103,7 +103,8 @@ class MultibodyPlantTester {
       const MultibodyPlant<double>& plant, const Context<double>& context,
       const std::vector<PenetrationAsPointPair<double>>& point_pairs,
       MatrixX<double>* Jn, MatrixX<double>* Jt,
-      std::vector<RotationMatrix<double>>* R_WC_set) {
+      std::vector<RotationMatrix<double>>* R_WC_set,
+      Eigen::SparseMatrix<double>* Jc = nullptr) {
     // We first convert point contact pairs to discrete contact pairs.
     std::vector<internal::DiscreteContactPair<double>> discrete_pairs;
     for (const PenetrationAsPointPair<double>& pair : point_pairs) {
@@ -117,7 +118,7 @@ class MultibodyPlantTester {
           {pair.id_A, pair.id_B, p_WC, pair.nhat_BA_W, fn0, k, d});
     }
     plant.CalcNormalAndTangentContactJacobians(
-        context, discrete_pairs, Jn, Jt, R_WC_set);
+        context, discrete_pairs, Jn, Jt, R_WC_set, Jc);
   }
 
   static const geometry::QueryObject<double>& EvalGeometryQueryInput(
@@ -2353,8 +2354,9 @@ TEST_F(MultibodyPlantContactJacobianTests, NormalAndTangentJacobian) {
 
   // Compute separation velocities Jacobian.
   MatrixX<double> N, D;
+  Eigen::SparseMatrix<double> Jc;
   MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
-          plant_, *context_, penetrations_, &N, &D, &R_WC_set);
+          plant_, *context_, penetrations_, &N, &D, &R_WC_set, &Jc);
 
   // Assert Jt has the right sizes.
   const int nv = plant_.num_velocities();
@@ -2366,6 +2368,17 @@ TEST_F(MultibodyPlantContactJacobianTests, NormalAndTangentJacobian) {
   ASSERT_EQ(D.rows(), 2 * nc);
   ASSERT_EQ(D.cols(), nv);
 
+  // The full Jacobian stacks the tangential and normal rows of each contact.
+  ASSERT_EQ(Jc.rows(), 3 * nc);
+  ASSERT_EQ(Jc.cols(), nv);
+  MatrixX<double> Jc_expected(3 * nc, nv);
+  for (int i = 0; i < nc; ++i) {
+    Jc_expected.row(3 * i) = D.row(2 * i);
+    Jc_expected.row(3 * i + 1) = D.row(2 * i + 1);
+    Jc_expected.row(3 * i + 2) = N.row(i);
+  }
+  EXPECT_TRUE(CompareMatrices(MatrixX<double>(Jc), Jc_expected));
+
   // Scalar convert the plant and its context_.
   unique_ptr<MultibodyPlant<AutoDiffXd>> plant_autodiff;
   unique_ptr<Context<AutoDiffXd>> context_autodiff;
@@ -6,6 +6,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/multibody/plant/test/tamsi_solver_test_util.h"
 
 namespace drake {
@@ -32,6 +33,7 @@ class TamsiSolverTester {
     auto vt = solver.variable_size_workspace_.mutable_vt();
     auto fn = solver.variable_size_workspace_.mutable_fn();
     auto ft = solver.variable_size_workspace_.mutable_ft();
+    auto dfn_dvn = solver.variable_size_workspace_.mutable_dfn_dvn();
     auto Gn = solver.variable_size_workspace_.mutable_Gn();
     auto mus = solver.variable_size_workspace_.mutable_mu();
     auto t_hat = solver.variable_size_workspace_.mutable_t_hat();
@@ -44,7 +46,8 @@ class TamsiSolverTester {
 
     // Computes friction forces fn and gradients Gn as a function of x, vn,
     // Jn and dt.
-    solver.CalcNormalForces(vn, Jn, dt, &fn, &Gn);
+    solver.CalcNormalForces(vn, dt, &fn, &dfn_dvn);
+    Gn = dfn_dvn.asDiagonal() * Jn;
 
     // Tangential velocity.
     vt = Jt * v;
@@ -72,6 +75,55 @@ class TamsiSolverTester {
 };
 namespace {
 
+// Computes the sensitivities ∂v/∂θ = −J⁻¹ ∂R/∂θ of the solution `v` of a TAMSI
+// problem with respect to θ = [p*, fₙ] for the one-way coupled scheme or
+// θ = [p*, fₙ₀] for the two-way coupled scheme, with fₙ₀ = k x₀. The Jacobian
+// J = ∇ᵥR is computed with automatic differentiation. The residual R is linear
+// in p* and fₙ and, away from the kinks of the normal force law, in x₀.
+// Therefore differences of residuals give ∂R/∂θ to round-off.
+MatrixX<double> CalcVelocitiesSensitivityFromResidual(
+    const MatrixX<double>& M, const MatrixX<double>& Jn,
+    const MatrixX<double>& Jt, const VectorX<double>& p_star,
+    const VectorX<double>& x0, const VectorX<double>& mu,
+    const VectorX<double>& fn, const VectorX<double>& stiffness,
+    const VectorX<double>& dissipation, double dt, double v_stiction,
+    double epsilon_v, bool two_way_coupling, const VectorX<double>& v) {
+  const int nv = v.size();
+  const int nc = mu.size();
+  const MatrixX<double> J =
+      two_way_coupling
+          ? test::CalcTwoWayCoupledJacobianWithAutoDiff(
+                M, Jn, Jt, p_star, x0, mu, stiffness, dissipation, dt,
+                v_stiction, epsilon_v, v)
+          : test::CalcOneWayCoupledJacobianWithAutoDiff(
+                M, Jn, Jt, p_star, mu, fn, dt, v_stiction, epsilon_v, v);
+  auto calc_residual = [&](const VectorX<double>& x0_theta,
+                           const VectorX<double>& fn_theta) {
+    return test::CalcResidual(M, Jn, Jt, p_star, x0_theta, mu, fn_theta,
+                              stiffness, dissipation, dt, v_stiction,
+                              epsilon_v, two_way_coupling, v);
+  };
+  const VectorX<double> residual = calc_residual(x0, fn);
+  MatrixX<double> dR_dtheta(nv, nv + nc);
+  dR_dtheta.leftCols(nv) = -MatrixX<double>::Identity(nv, nv);
+  for (int ic = 0; ic < nc; ++ic) {
+    VectorX<double> x0_theta = x0;
+    VectorX<double> fn_theta = fn;
+    // The change in fₙ (or fₙ₀).
+    double delta_fn = 1.0;
+    if (two_way_coupling) {
+      const double delta_x0 = 1.0e-6 * x0(ic);
+      x0_theta(ic) += delta_x0;
+      delta_fn = stiffness(ic) * delta_x0;
+    } else {
+      fn_theta(ic) += delta_fn;
+    }
+    dR_dtheta.col(nv + ic) =
+        (calc_residual(x0_theta, fn_theta) - residual) / delta_fn;
+  }
+  return -J.lu().solve(dR_dtheta);
+}
+
 // A test fixture to test TalsLimiter for a very standard
 // configuration of parameters.
 class DirectionLimiter : public ::testing::Test {
@@ -708,6 +760,170 @@ TEST_F(PizzaSaver, LargeAppliedMoment) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// Solves a problem made of several pizza savers, some in stiction and some
+// sliding, with both dense and sparse linear algebra. The resulting block
+// diagonal problem is the kind of problem for which sparse linear algebra pays
+// off, and both solvers must agree to round-off.
+TEST_F(PizzaSaver, SparseLinearAlgebra) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.5;     // Friction coefficient.
+  const int num_savers = 8;
+  const int nv = num_savers * nv_;
+  const int nc = num_savers * nc_;
+
+  MatrixX<double> M = MatrixX<double>::Zero(nv, nv);
+  MatrixX<double> Jn = MatrixX<double>::Zero(nc, nv);
+  MatrixX<double> Jt = MatrixX<double>::Zero(2 * nc, nv);
+  VectorX<double> p_star(nv);
+  VectorX<double> fn(nc);
+  VectorX<double> mu_vector = VectorX<double>::Constant(nc, mu);
+  for (int i = 0; i < num_savers; ++i) {
+    // Applied moments below and above M_transition = 5.0.
+    const double Mz = 1.0 + i;
+    const Vector3<double> tau(0.0, 0.0, Mz);
+    SetProblem(Vector3<double>::Zero(), tau, mu, M_PI / 5 * i, dt);
+    M.block(nv_ * i, nv_ * i, nv_, nv_) = M_;
+    Jt.block(2 * nc_ * i, nv_ * i, 2 * nc_, nv_) = Jt_;
+    p_star.segment(nv_ * i, nv_) = p_star_;
+    fn.segment(nc_ * i, nc_) = fn_;
+  }
+
+  TamsiSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+  parameters.relative_tolerance = 1.0e-4;
+  TamsiSolver<double> dense_solver(nv);
+  dense_solver.set_solver_parameters(parameters);
+  parameters.use_sparse_linear_algebra = true;
+  TamsiSolver<double> sparse_solver(nv);
+  sparse_solver.set_solver_parameters(parameters);
+
+  const VectorX<double> v0 = VectorX<double>::Zero(nv);
+  for (TamsiSolver<double>* solver : {&dense_solver, &sparse_solver}) {
+    solver->SetOneWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &fn,
+                                        &mu_vector);
+    ASSERT_EQ(solver->SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+  }
+
+  EXPECT_EQ(sparse_solver.get_iteration_statistics().num_iterations,
+            dense_solver.get_iteration_statistics().num_iterations);
+  const double kTolerance = 1.0e-12;
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_generalized_velocities(),
+                              dense_solver.get_generalized_velocities(),
+                              kTolerance, MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_generalized_friction_forces(),
+                              dense_solver.get_generalized_friction_forces(),
+                              kTolerance, MatrixCompareType::absolute));
+}
+
+// Time steps the pizza saver under a varying applied moment, with and
+// without warm starting from the forces of the previous step. The saver
+// alternates between sliding and stiction. Both simulations must agree to
+// within the solver's tolerance, and warm starting must take fewer
+// iterations.
+TEST_F(PizzaSaver, WarmStart) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.5;     // Friction coefficient.
+  const double theta = M_PI / 5;
+  const int num_steps = 20;
+  // Contact point C is a "new" contact at this step.
+  const int new_contact_step = 5;
+
+  TamsiSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-4;
+  solver_.set_solver_parameters(parameters);
+
+  int total_iterations[2] = {0, 0};
+  int num_warm_started_steps = 0;
+  VectorX<double> v_final[2];
+  for (bool warm_start : {false, true}) {
+    Vector3<double> v0 = Vector3<double>::Zero();
+    for (int step = 0; step < num_steps; ++step) {
+      // Applied moments above and below M_transition = 5.0.
+      const Vector3<double> tau(0.0, 0.0, 4.0 + 2.0 * std::sin(0.3 * step));
+      SetProblem(v0, tau, mu, theta, dt);
+      if (warm_start) {
+        std::vector<TamsiSolverContactId> ids{
+            {1, 2, 0}, {1, 3, 0}, {1, 4, step == new_contact_step ? 1 : 0}};
+        solver_.SetContactIdentifiers(ids);
+      }
+      ASSERT_EQ(solver_.SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+      const auto& stats = solver_.get_iteration_statistics();
+      total_iterations[warm_start] += stats.num_iterations;
+      if (stats.num_warm_started_contacts > 0) ++num_warm_started_steps;
+      if (!warm_start || step == 0) {
+        EXPECT_EQ(stats.num_warm_started_contacts, 0);
+      } else if (step == new_contact_step || step == new_contact_step + 1) {
+        EXPECT_LE(stats.num_warm_started_contacts, 2);
+      }
+      v0 = solver_.get_generalized_velocities();
+    }
+    v_final[warm_start] = v0;
+  }
+  EXPECT_GT(num_warm_started_steps, 0);
+  EXPECT_LT(total_iterations[true], total_iterations[false]);
+  EXPECT_TRUE(CompareMatrices(v_final[true], v_final[false],
+                              parameters.relative_tolerance *
+                                  parameters.stiction_tolerance,
+                              MatrixCompareType::absolute));
+}
+
+// Verifies the sensitivities of the solution with respect to p* and fₙ, both
+// in stiction and sliding and with both dense and sparse linear algebra.
+TEST_F(PizzaSaver, VelocitiesSensitivity) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.5;     // Friction coefficient.
+  const double theta = M_PI / 5;
+  // Parameters θ = [p*, fₙ].
+  const int num_parameters = nv_ + nc_;
+  MatrixX<double> dp_star = MatrixX<double>::Zero(nv_, num_parameters);
+  dp_star.leftCols(nv_).setIdentity();
+  MatrixX<double> dfn = MatrixX<double>::Zero(nc_, num_parameters);
+  dfn.rightCols(nc_).setIdentity();
+  MatrixX<double> dv;
+
+  // There is no solution yet.
+  SetProblem(Vector3<double>::Zero(), Vector3<double>::Zero(), mu, theta, dt);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_.CalcVelocitiesSensitivity(dp_star, dfn, &dv), std::exception,
+      ".*no successful solve.*");
+
+  TamsiSolverParameters parameters;  // Default parameters.
+  // A tight tolerance, since the sensitivities are computed with the
+  // Newton-Raphson Jacobian of the last iterate.
+  parameters.relative_tolerance = 1.0e-6;
+  for (bool use_sparse_linear_algebra : {false, true}) {
+    parameters.use_sparse_linear_algebra = use_sparse_linear_algebra;
+    solver_.set_solver_parameters(parameters);
+    // Applied moments below and above M_transition = 5.0.
+    for (double Mz : {3.0, 6.0}) {
+      const Vector3<double> v0 = Vector3<double>::Zero();
+      SetProblem(v0, Vector3<double>(0.0, 0.0, Mz), mu, theta, dt);
+      ASSERT_EQ(solver_.SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+      solver_.CalcVelocitiesSensitivity(dp_star, dfn, &dv);
+
+      const VectorX<double>& v = solver_.get_generalized_velocities();
+      const double v_stiction = parameters.stiction_tolerance;
+      const double epsilon_v = v_stiction * parameters.relative_tolerance;
+      const VectorX<double> not_used;
+      const MatrixX<double> dv_expected =
+          CalcVelocitiesSensitivityFromResidual(
+              M_, Jn_, Jt_, p_star_, not_used, mu_, fn_, not_used, not_used,
+              dt, v_stiction, epsilon_v, false, v);
+      EXPECT_TRUE(CompareMatrices(dv, dv_expected, 1.0e-5 * dv_expected.norm(),
+                                  MatrixCompareType::absolute));
+    }
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_.CalcVelocitiesSensitivity(dp_star, dfn.leftCols(nv_), &dv),
+      std::exception, ".*dfn_dtheta.cols\\(\\) == k.*");
+  // Setting new problem data invalidates the solution.
+  SetProblem(Vector3<double>::Zero(), Vector3<double>::Zero(), mu, theta, dt);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_.CalcVelocitiesSensitivity(dp_star, dfn, &dv), std::exception,
+      ".*no successful solve.*");
+}
+
 // Verify the solver behaves correctly when the problem data contains no
 // contact points.
 TEST_F(PizzaSaver, NoContact) {
@@ -1100,6 +1316,115 @@ TEST_F(RollingCylinder, SlidingAfterImpact) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// Verifies the sensitivities of the solution with respect to p* and fₙ₀ after
+// impact, both rolling and sliding and with both dense and sparse linear
+// algebra.
+TEST_F(RollingCylinder, VelocitiesSensitivity) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.1;     // Friction coefficient.
+  const double h0 = 0.5;     // Initial height, so that vy at impact is 3 m/s.
+  const Vector3<double> tau(0.0, -m_ * g_, 0.0);
+
+  TamsiSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+  parameters.relative_tolerance = 1.0e-6;
+  for (bool use_sparse_linear_algebra : {false, true}) {
+    parameters.use_sparse_linear_algebra = use_sparse_linear_algebra;
+    solver_.set_solver_parameters(parameters);
+    // Initial horizontal velocities below and above vx_transition = 0.6 m/s.
+    for (double vx0 : {0.5, 1.0}) {
+      const Vector3<double> v0(vx0, -sqrt(2.0 * g_ * h0), 0.0);
+      SetImpactProblem(v0, tau, mu, h0, dt);
+      ASSERT_EQ(solver_.SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+
+      // Parameters θ = [p*, fₙ₀].
+      const int num_parameters = nv_ + nc_;
+      MatrixX<double> dp_star = MatrixX<double>::Zero(nv_, num_parameters);
+      dp_star.leftCols(nv_).setIdentity();
+      MatrixX<double> dfn0 = MatrixX<double>::Zero(nc_, num_parameters);
+      dfn0.rightCols(nc_).setIdentity();
+      MatrixX<double> dv;
+      solver_.CalcVelocitiesSensitivity(dp_star, dfn0, &dv);
+
+      const VectorX<double>& v = solver_.get_generalized_velocities();
+      const double v_stiction = parameters.stiction_tolerance;
+      const double epsilon_v = v_stiction * parameters.relative_tolerance;
+      const VectorX<double> not_used;
+      const MatrixX<double> dv_expected =
+          CalcVelocitiesSensitivityFromResidual(
+              M_, Jn_, Jt_, p_star_, x0_, mu_vector_, not_used, stiffness_,
+              dissipation_, dt, v_stiction, epsilon_v, true, v);
+      EXPECT_TRUE(CompareMatrices(dv, dv_expected, 1.0e-5 * dv_expected.norm(),
+                                  MatrixCompareType::absolute));
+    }
+  }
+}
+
+// Solves a problem made of several cylinders, some rolling and some sliding
+// after impact, with both dense and sparse linear algebra. Both solvers must
+// agree to round-off.
+TEST_F(RollingCylinder, SparseLinearAlgebra) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.1;     // Friction coefficient.
+  const double h0 = 0.5;     // Initial height, so that vy at impact is 3 m/s.
+  const Vector3<double> tau(0.0, -m_ * g_, 0.0);
+  const int num_cylinders = 8;
+  const int nv = num_cylinders * nv_;
+  const int nc = num_cylinders;
+
+  MatrixX<double> M = MatrixX<double>::Zero(nv, nv);
+  MatrixX<double> Jn = MatrixX<double>::Zero(nc, nv);
+  MatrixX<double> Jt = MatrixX<double>::Zero(2 * nc, nv);
+  VectorX<double> p_star(nv);
+  VectorX<double> fn0(nc);
+  VectorX<double> stiffness(nc);
+  VectorX<double> dissipation(nc);
+  VectorX<double> mu_vector = VectorX<double>::Constant(nc, mu);
+  VectorX<double> v0(nv);
+  for (int i = 0; i < num_cylinders; ++i) {
+    // Initial horizontal velocities below and above vx_transition = 0.6 m/s.
+    const Vector3<double> v0_i(0.2 + 0.1 * i, -sqrt(2.0 * g_ * h0), 0.0);
+    SetImpactProblem(v0_i, tau, mu, h0, dt);
+    M.block(nv_ * i, nv_ * i, nv_, nv_) = M_;
+    Jn.block(i, nv_ * i, 1, nv_) = Jn_;
+    Jt.block(2 * i, nv_ * i, 2, nv_) = Jt_;
+    p_star.segment(nv_ * i, nv_) = p_star_;
+    fn0(i) = fn0_(0);
+    stiffness(i) = stiffness_(0);
+    dissipation(i) = dissipation_(0);
+    v0.segment(nv_ * i, nv_) = v0_i;
+  }
+
+  TamsiSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+  TamsiSolver<double> dense_solver(nv);
+  dense_solver.set_solver_parameters(parameters);
+  parameters.use_sparse_linear_algebra = true;
+  TamsiSolver<double> sparse_solver(nv);
+  sparse_solver.set_solver_parameters(parameters);
+
+  for (TamsiSolver<double>* solver : {&dense_solver, &sparse_solver}) {
+    solver->SetTwoWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &fn0,
+                                        &stiffness, &dissipation, &mu_vector);
+    ASSERT_EQ(solver->SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+  }
+
+  EXPECT_EQ(sparse_solver.get_iteration_statistics().num_iterations,
+            dense_solver.get_iteration_statistics().num_iterations);
+  const double kTolerance = 1.0e-12;
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_generalized_velocities(),
+                              dense_solver.get_generalized_velocities(),
+                              kTolerance, MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_normal_forces(),
+                              dense_solver.get_normal_forces(),
+                              kTolerance * stiffness(0),
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_generalized_friction_forces(),
+                              dense_solver.get_generalized_friction_forces(),
+                              kTolerance * stiffness(0),
+                              MatrixCompareType::absolute));
+}
+
 GTEST_TEST(EmptyWorld, Solve) {
   const int nv = 0;
   TamsiSolver<double> solver{nv};
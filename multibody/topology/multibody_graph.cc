@@ -239,26 +239,27 @@ std::set<BodyIndex> MultibodyGraph::FindBodiesWeldedTo(
     BodyIndex body_index) const {
   DRAKE_THROW_UNLESS(body_index.is_valid() && body_index < num_bodies());
 
-  // TODO(amcastro-tri): Notice that "subgraphs" will get compute with every
-  // call to FindBodiesWeldedTo(). Consider storing this for subsequent calls if
-  // it becomes a performance bottleneck.
-  const std::vector<std::set<BodyIndex>> subgraphs =
-      FindSubgraphsOfWeldedBodies();
-
-  // Find subgraph that contains this body_index.
-  // TODO(amcastro-tri): Consider storing within Body the subgraph it belongs to
-  // if performance becomes an issue.
-  auto predicate = [body_index](auto& subgraph) {
-    return subgraph.count(body_index) > 0;
-  };
-  auto subgraph_iter =
-      std::find_if(subgraphs.begin(), subgraphs.end(), predicate);
-
-  // If body_index is a valid index to a body in this graph, then it MUST belong
-  // to one of the subgraphs. We verify this explicitly.
-  DRAKE_DEMAND(subgraph_iter != subgraphs.end());
-
-  return *subgraph_iter;
+  // Only the bodies reachable from body_index through weld joints are visited,
+  // rather than partitioning the whole graph with
+  // FindSubgraphsOfWeldedBodies(). The cost is therefore proportional to the
+  // size of the returned set and the joints of its bodies.
+  std::set<BodyIndex> welded_bodies{body_index};
+  std::vector<BodyIndex> to_visit{body_index};
+  while (!to_visit.empty()) {
+    const Body& body = get_body(to_visit.back());
+    to_visit.pop_back();
+    for (JointIndex joint_index : body.joints()) {
+      const Joint& joint = get_joint(joint_index);
+      if (joint.type_index() != weld_type_index()) continue;
+      const BodyIndex sibling_index = joint.parent_body() == body.index()
+                                          ? joint.child_body()
+                                          : joint.parent_body();
+      if (welded_bodies.insert(sibling_index).second) {
+        to_visit.push_back(sibling_index);
+      }
+    }
+  }
+  return welded_bodies;
 }
 
 }  // namespace internal
@@ -207,40 +207,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
   void CalcPositionKinematicsCache_BaseToTip(
       const systems::Context<T>& context,
       PositionKinematicsCache<T>* pc) const {
-    // This method must not be called for the "world" body node.
-    DRAKE_ASSERT(topology_.body != world_index());
-
-    DRAKE_ASSERT(pc != nullptr);
-
-    // Update mobilizer' position dependent kinematics.
-    CalcAcrossMobilizerPositionKinematicsCache(context, pc);
-
-    // This computes into the PositionKinematicsCache:
-    // - X_PB(qb_P, qm_B, qb_B)
-    // - X_WB(q(W:P), qb_P, qm_B, qb_B)
-    // where qb_P are the generalized coordinates associated with body P, qm_B
-    // the generalized coordinates associated with this node's mobilizer and
-    // qb_B the generalized coordinates associated with body B. q(W:P) denotes
-    // all generalized positions in the kinematics path between the world and
-    // the parent body P.
-    // It assumes:
-    // - Body B already updated the pose `X_BM(qb_B)` of the inboard
-    //   mobilizer M.
-    // - We are in a base-to-tip recursion and therefore `X_PF(qb_P)` and `X_WP`
-    //   have already been updated.
-    CalcAcrossMobilizerBodyPoses_BaseToTip(context, pc);
-
-    // TODO(amcastro-tri):
-    // Update Body specific kinematics. These include:
-    // - p_PB_W: vector from P to B to perform shift operations.
-    // - com_W: center of mass.
-    // - M_Bo_W: Spatial inertia.
-
-    // TODO(amcastro-tri):
-    // With H_FM(qm) already in the cache (computed by
-    // Mobilizer::UpdatePositionKinematicsCache()) update the cache
-    // entries for H_PB_W, the hinge matrix for the SpatialVelocity jump between
-    // body B and its parent body P expressed in the world frame W.
+    DoCalcPositionKinematicsCache_BaseToTip(context, pc);
   }
 
   /// This method is used by MultibodyTree within a base-to-tip loop to compute
@@ -271,96 +238,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
       const PositionKinematicsCache<T>& pc,
       const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
       VelocityKinematicsCache<T>* vc) const {
-    // This method must not be called for the "world" body node.
-    DRAKE_ASSERT(topology_.body != world_index());
-
-    DRAKE_ASSERT(vc != nullptr);
-    DRAKE_DEMAND(H_PB_W.rows() == 6);
-    DRAKE_DEMAND(H_PB_W.cols() == get_num_mobilizer_velocities());
-
-    // As a guideline for developers, a summary of the computations performed in
-    // this method is provided:
-    // Notation:
-    //  - B body frame associated with this node.
-    //  - P ("parent") body frame associated with this node's parent.
-    //  - F mobilizer inboard frame attached to body P.
-    //  - M mobilizer outboard frame attached to body B.
-    // The goal is computing the spatial velocity V_WB of body B measured in the
-    // world frame W. The calculation is recursive and assumes the spatial
-    // velocity V_WP of the inboard body P is already computed. These spatial
-    // velocities are related by the recursive relation:
-    //   V_WB = V_WPb + V_PB_W (Eq. 5.6 in Jain (2010), p. 77)              (1)
-    // where Pb is a frame aligned with P but with its origin shifted from Po
-    // to B's origin Bo. Then V_WPb is the spatial velocity of frame Pb,
-    // measured and expressed in the world frame W. Then since V_PB's
-    // translational component is also for the point Bo, we can add these
-    // spatial velocities. Therefore we need to develop expressions for the two
-    // terms (V_WPb and V_PB_W) in Eq. (1).
-    //
-    // Computation of V_PB_W:
-    // This can be split as:
-    //   V_PB_W = V_PFb_W + V_FMb_W + V_MB_W                                (2)
-    // where Fb and Mb are frames aligned rigidly with F and M but with their
-    // origins at Bo. Assuming body P a rigid body V_PFb_W = 0 and assuming B
-    // a rigid body V_MB_W = 0, but that won't be true for flexible bodies.
-    // TODO(amcastro-tri): incorporate terms for flexible bodies below.
-    // Therefore for rigid bodies V_PB_W = V_FMb_W, which can be computed from
-    // the spatial velocity measured in frame F (as provided by mobilizer's
-    // methods)
-    //   V_FMb_W = R_WF * V_FMb = R_WF * V_FM.Shift(p_MoBo_F)               (3)
-    // arriving to the desired result:
-    //   V_PB_W = R_WF * V_FM.Shift(p_MoBo_F)                               (4)
-    //
-    // V_FM is immediately available from this node's mobilizer with the method
-    // CalcAcrossMobilizerSpatialVelocity() which computes M's spatial velocity
-    // in F by V_FM = H_FM * vm, where H_FM is the mobilizer's hinge matrix.
-    //
-    // Computation of V_WPb:
-    // This can be computed by a simple shift operation from V_WP:
-    //   V_WPb = V_WP.Shift(p_PoBo_W)                                       (5)
-    //
-    // Note:
-    // It is very common to find treatments in which the body frame B is
-    // coincident with the outboard frame M, that is B ≡ M, leading to slightly
-    // simpler recursive relations (for instance, see Section 3.3.2 in
-    // Jain (2010).) where p_MoBo_F = 0 and thus V_PB_W = V_FM_W. Here we relax
-    // this restriction in preparation of the more general case considering
-    // flexible bodies.
-
-    // Generalized velocities local to this node's mobilizer.
-    const auto& vm = this->get_mobilizer_velocities(context);
-
-    // =========================================================================
-    // Computation of V_PB_W in Eq. (1). See summary at the top of this method.
-
-    // Update V_FM using the operator V_FM = H_FM * vm:
-    SpatialVelocity<T>& V_FM = get_mutable_V_FM(vc);
-    V_FM = get_mobilizer().CalcAcrossMobilizerSpatialVelocity(context, vm);
-
-    // Compute V_PB_W = R_WF * V_FM.Shift(p_MoBo_F), Eq. (4).
-    // Side note to developers: in operator form for rigid bodies this would be
-    //   V_PB_W = R_WF * phiT_MB_F * V_FM
-    //          = R_WF * phiT_MB_F * H_FM * vm
-    //          = H_PB_W * vm
-    // where H_PB_W = R_WF * phiT_MB_F * H_FM.
-    SpatialVelocity<T>& V_PB_W = get_mutable_V_PB_W(vc);
-    V_PB_W.get_coeffs() = H_PB_W * vm;
-
-    // =========================================================================
-    // Computation of V_WPb in Eq. (1). See summary at the top of this method.
-
-    // Shift vector between the parent body P and this node's body B,
-    // expressed in the world frame W.
-    const Vector3<T>& p_PB_W = get_p_PoBo_W(pc);
-
-    // Since we are in a base-to-tip recursion the parent body P's spatial
-    // velocity is already available in the cache.
-    const SpatialVelocity<T>& V_WP = get_V_WP(*vc);
-
-    // =========================================================================
-    // Update velocity V_WB of this node's body B in the world frame. Using the
-    // recursive Eq. (1). See summary at the top of this method.
-    get_mutable_V_WB(vc) = V_WP.ComposeWithMovingFrameVelocity(p_PB_W, V_PB_W);
+    DoCalcVelocityKinematicsCache_BaseToTip(context, pc, H_PB_W, vc);
   }
 
   /// This method is used by MultibodyTree within a base-to-tip loop to compute
@@ -413,143 +291,8 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
       const VelocityKinematicsCache<T>* vc,
       const VectorX<T>& mbt_vdot,
       std::vector<SpatialAcceleration<T>>* A_WB_array_ptr) const {
-    // This method must not be called for the "world" body node.
-    DRAKE_DEMAND(topology_.body != world_index());
-    DRAKE_DEMAND(A_WB_array_ptr != nullptr);
-    std::vector<SpatialAcceleration<T>>& A_WB_array = *A_WB_array_ptr;
-
-    // As a guideline for developers, a summary of the computations performed in
-    // this method is provided:
-    // Notation:
-    //  - B body frame associated with this node.
-    //  - P ("parent") body frame associated with this node's parent.
-    //  - F mobilizer inboard frame attached to body P.
-    //  - M mobilizer outboard frame attached to body B.
-    // The goal is computing the spatial acceleration A_WB of body B measured in
-    // the world frame W. The calculation is recursive and assumes the spatial
-    // acceleration A_WP of the inboard body P is already computed.
-    // The spatial velocities of P and B are related by the recursive relation
-    // (computation is performed by CalcVelocityKinematicsCache_BaseToTip():
-    //   V_WB = V_WPb + V_PB_W (Eq. 5.6 in Jain (2010), p. 77)
-    //        = V_WP.ComposeWithMovingFrameVelocity(p_PB_W, V_PB_W)         (1)
-    // where Pb is a frame aligned with P but with its origin shifted from Po
-    // to B's origin Bo. Then V_WPb is the spatial velocity of frame Pb,
-    // measured and expressed in the world frame W.
-    //
-    // In the same way the parent body P velocity V_WP can be composed with body
-    // B's velocity V_PB in P, the acceleration A_WB can be obtained by
-    // composing A_WP with A_PB:
-    //  A_WB = A_WP.ComposeWithMovingFrameAcceleration(
-    //      p_PB_W, w_WP, V_PB_W, A_PB_W);                                  (2)
-    // which includes both centrifugal and coriolis terms. For details on this
-    // operation refer to the documentation for
-    // SpatialAcceleration::ComposeWithMovingFrameAcceleration().
-    //
-    // By recursive precondition, this method was already called on all
-    // predecessor nodes in the tree and therefore the acceleration A_WP is
-    // already available.
-    // V_WP (i.e. w_WP) and V_PB_W were computed in the velocity kinematics pass
-    // and are therefore available in the VelocityKinematicsCache vc.
-    //
-    // Therefore, all that is left is computing A_PB_W = DtP(V_PB)_W.
-    // The acceleration of B in P is:
-    //   A_PB = DtP(V_PB) = DtF(V_FMb) = A_FM.Shift(p_MB, w_FM)             (3)
-    // which expressed in the world frame leads to (see note below):
-    //   A_PB_W = R_WF * A_FM.Shift(p_MB_F, w_FM)                           (4)
-    // where R_WF is the rotation matrix from F to W and A_FM expressed in the
-    // inboard frame F is the direct result from
-    // Mobilizer::CalcAcrossMobilizerAcceleration().
-    //
-    // * Note:
-    //     The rigid body assumption is made in Eq. (3) in two places:
-    //       1. DtP() = DtF() since V_PF = 0.
-    //       2. V_PB = V_FMb since V_PB = V_PFb + V_FMb + V_MB but since P is
-    //          assumed rigid V_PF = 0 and since B is assumed rigid V_MB = 0.
-
-    // Body for this node. Its body frame is also referred to as B whenever no
-    // ambiguity can arise.
-    const Body<T>& body_B = body();
-
-    // Body for this node's parent, or the parent body P. Its body frame is
-    // also referred to as P whenever no ambiguity can arise.
-    const Body<T>& body_P = parent_body();
-
-    // Inboard frame F of this node's mobilizer.
-    const Frame<T>& frame_F = inboard_frame();
-    DRAKE_ASSERT(frame_F.body().index() == body_P.index());
-    // Outboard frame M of this node's mobilizer.
-    const Frame<T>& frame_M = outboard_frame();
-    DRAKE_ASSERT(frame_M.body().index() == body_B.index());
-
-    // =========================================================================
-    // Computation of A_PB = DtP(V_PB), Eq. (4).
-
-    // TODO(amcastro-tri): consider caching these. Especially true if bodies are
-    // flexible. Also used in velocity kinematics.
-    const math::RotationMatrix<T> R_PF =
-        frame_F.CalcRotationMatrixInBodyFrame(context);
-    const math::RigidTransform<T> X_MB =
-        frame_M.CalcPoseInBodyFrame(context).inverse();
-
-    // Form the rotation matrix relating the world frame W and parent body P.
-    // Available since we are called within a base-to-tip recursion.
-    const math::RotationMatrix<T>& R_WP = get_R_WP(pc);
-
-    // Orientation (rotation) of frame F with respect to the world frame W.
-    // TODO(amcastro-tri): consider caching X_WF since it is also used to
-    // compute H_PB_W.
-    const math::RotationMatrix<T> R_WF = R_WP * R_PF;
-
-    // Vector from Mo to Bo expressed in frame F as needed below:
-    // TODO(amcastro-tri): consider caching this since it is also used to
-    // compute H_PB_W.
-    const math::RotationMatrix<T>& R_FM = get_X_FM(pc).rotation();
-    const Vector3<T>& p_MB_M = X_MB.translation();
-    const Vector3<T> p_MB_F = R_FM * p_MB_M;
-
-    // Generalized velocities' time derivatives local to this node's mobilizer.
-    const auto& vmdot = this->get_mobilizer_velocities(mbt_vdot);
-
-    // Operator A_FM = H_FM * vmdot + Hdot_FM * vm
-    SpatialAcceleration<T> A_FM =
-        get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(context, vmdot);
-
-    // =========================================================================
-    // Compose acceleration A_WP of P in W with acceleration A_PB of B in P,
-    // Eq. (2)
-
-    // Obtains a const reference to the parent acceleration from A_WB_array.
-    const SpatialAcceleration<T>& A_WP = get_A_WP_from_array(A_WB_array);
-
-    // Shift vector between the parent body P and this node's body B,
-    // expressed in the world frame W.
-    const Vector3<T>& p_PB_W = get_p_PoBo_W(pc);
-
-    if (vc != nullptr) {
-      // Since we are in a base-to-tip recursion the parent body P's spatial
-      // velocity is already available in the cache.
-      const SpatialVelocity<T>& V_WP = get_V_WP(*vc);
-
-      // For body B, only the spatial velocity V_PB_W is already available in
-      // the cache. The acceleration A_PB_W was computed above.
-      const SpatialVelocity<T>& V_PB_W = get_V_PB_W(*vc);
-
-      // Across mobilizer velocity is available from the velocity kinematics.
-      const SpatialVelocity<T>& V_FM = get_V_FM(*vc);
-
-      const SpatialAcceleration<T> A_PB_W =
-          R_WF * A_FM.Shift(p_MB_F, V_FM.rotational());  // Eq. (4)
-
-      // Velocities are non-zero.
-      get_mutable_A_WB_from_array(&A_WB_array) =
-          A_WP.ComposeWithMovingFrameAcceleration(p_PB_W, V_WP.rotational(),
-                                                  V_PB_W, A_PB_W);
-    } else {
-      const SpatialAcceleration<T> A_PB_W =
-          R_WF * A_FM.Shift(p_MB_F);  // Eq. (4), with w_FM = 0.
-      // Velocities are zero. No need to compute terms that become zero.
-      get_mutable_A_WB_from_array(&A_WB_array) = A_WP.Shift(p_PB_W) + A_PB_W;
-    }
+    DoCalcSpatialAcceleration_BaseToTip(context, pc, vc, mbt_vdot,
+                                        A_WB_array_ptr);
   }
 
   /// Computes the generalized forces `tau` for a single BodyNode.
@@ -631,158 +374,9 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
       const Eigen::Ref<const VectorX<T>>& tau_applied,
       std::vector<SpatialForce<T>>* F_BMo_W_array_ptr,
       EigenPtr<VectorX<T>> tau_array) const {
-    DRAKE_DEMAND(F_BMo_W_array_ptr != nullptr);
-    std::vector<SpatialForce<T>>& F_BMo_W_array = *F_BMo_W_array_ptr;
-    DRAKE_DEMAND(
-        tau_applied.size() == get_num_mobilizer_velocities() ||
-        tau_applied.size() == 0);
-    DRAKE_DEMAND(tau_array != nullptr);
-    DRAKE_DEMAND(tau_array->size() ==
-        this->get_parent_tree().num_velocities());
-
-    // As a guideline for developers, a summary of the computations performed in
-    // this method is provided:
-    // Notation:
-    //  - B body frame associated with this node.
-    //  - P ("parent") body frame associated with this node's parent.
-    //  - F mobilizer inboard frame attached to body P.
-    //  - M mobilizer outboard frame attached to body B.
-    //  - Mo The origin of the outboard (or mobilized) frame of the mobilizer
-    //       attached to body B.
-    //  - C within a loop over children, one of body B's children.
-    //  - Mc The origin of the outboard (or mobilized) frame of the mobilizer
-    //       attached to body C.
-    // The goal is computing the spatial force F_BMo_W (on body B applied at its
-    // mobilized frame origin Mo) exerted by its inboard mobilizer that is
-    // required to produce the spatial acceleration A_WB. The generalized forces
-    // are then obtained as the projection of the spatial force F_BMo in the
-    // direction of this node's mobilizer motion. That is, the generalized
-    // forces correspond to the working components of the spatial force living
-    // in the motion sub-space of this node's mobilizer.
-    // The calculation is recursive (from tip-to-base) and assumes the spatial
-    // force F_CMc on body C at Mc is already computed in F_BMo_W_array_ptr.
-    //
-    // The spatial force through body B's inboard mobilizer is obtained from a
-    // force balance (essentially the F = m * a for rigid bodies, see
-    // [Jain 2010, Eq. 2.26, p. 27] for a derivation):
-    //   Ftot_BBo_W = M_Bo_W * A_WB + Fb_Bo_W                                (1)
-    // where Fb_Bo_W contains the velocity dependent gyroscopic terms,
-    // Ftot_BBo_W is the total spatial force on body B, applied at its origin Bo
-    // and quantities are expressed in the world frame W (though the
-    // expressed-in frame is not needed in a coordinate-free form.)
-    //
-    // The total spatial force on body B is the combined effect of externally
-    // applied spatial forces Fapp_BMo on body B at Mo and spatial forces
-    // induced by its inboard and outboard mobilizers. On its mobilized frame M,
-    // in coordinate-free form:
-    //   Ftot_BMo = Fapp_BMo + F_BMo - Σᵢ(F_CiMo)                           (2)
-    // where F_CiMo is the spatial force on the i-th child body Ci due to its
-    // inboard mobilizer which, by action/reaction, applies to body B as
-    // -F_CiMo, hence the negative sign in the summation above. The applied
-    // spatial force Fapp_BMo at Mo is obtained by shifting the applied force
-    // Fapp_Bo from Bo to Mo as Fapp_BMo.Shift(p_BoMo).
-    // Therefore, spatial force F_BMo due to body B's mobilizer is:
-    //   F_BMo = Ftot_BMo + Σᵢ(F_CiMo) - Fapp_BMo                           (3)
-    // The projection of this force on the motion sub-space of this node's
-    // mobilizer corresponds to the generalized force tau:
-    //  tau = H_FMᵀ * F_BMo_F                                               (4)
-    // where the spatial force F_BMo must be re-expressed in the inboard frame F
-    // before the projection can be performed.
-
-    // This node's body B.
-    const Body<T>& body_B = body();
-
-    // Input spatial acceleration for this node's body B.
-    const SpatialAcceleration<T>& A_WB = get_A_WB_from_array(A_WB_array);
-
-    // Total spatial force on body B producing acceleration A_WB.
-    SpatialForce<T> Ftot_BBo_W;
-    CalcBodySpatialForceGivenItsSpatialAcceleration(M_B_W_cache, Fb_Bo_W_cache,
-                                                    A_WB, &Ftot_BBo_W);
-
-    // Compute shift vector from Bo to Mo expressed in the world frame W.
-    const Frame<T>& frame_M = outboard_frame();
-    DRAKE_DEMAND(frame_M.body().index() == body_B.index());
-    const math::RigidTransform<T> X_BM = frame_M.CalcPoseInBodyFrame(context);
-    const Vector3<T>& p_BoMo_B = X_BM.translation();
-    const math::RigidTransform<T>& X_WB = get_X_WB(pc);
-    const math::RotationMatrix<T>& R_WB = X_WB.rotation();
-    const Vector3<T> p_BoMo_W = R_WB * p_BoMo_B;
-
-    // Output spatial force that would need to be exerted by this node's
-    // mobilizer in order to attain the prescribed acceleration A_WB.
-    SpatialForce<T>& F_BMo_W = F_BMo_W_array[this->index()];
-
-    // Ensure this method was not called with an Fapplied_Bo_W being an entry
-    // into F_BMo_W_array, otherwise we would be overwriting Fapplied_Bo_W.
-    DRAKE_DEMAND(&F_BMo_W != &Fapplied_Bo_W);
-
-    // Shift spatial force on B to Mo.
-    F_BMo_W = Ftot_BBo_W.Shift(p_BoMo_W);
-    for (const BodyNode<T>* child_node : children_) {
-      BodyNodeIndex child_node_index = child_node->index();
-
-      // Shift vector from Bo to Co, expressed in the world frame W.
-      const Vector3<T>& p_BoCo_W = child_node->get_p_PoBo_W(pc);
-
-      // p_CoMc_W:
-      const Frame<T>& frame_Mc = child_node->outboard_frame();
-      const math::RotationMatrix<T>& R_WC = child_node->get_X_WB(pc).rotation();
-      const math::RigidTransform<T> X_CMc =
-          frame_Mc.CalcPoseInBodyFrame(context);
-      const Vector3<T>& p_CoMc_W = R_WC * X_CMc.translation();
-
-      // Shift position vector from child C outboard mobilizer frame Mc to body
-      // B outboard mobilizer Mc. p_MoMc_W:
-      // Since p_BoMo = p_BoCo + p_CoMc + p_McMo, we have:
-      const Vector3<T> p_McMo_W = p_BoMo_W - p_BoCo_W - p_CoMc_W;
-
-      // Spatial force on the child body C at the origin Mc of the outboard
-      // mobilizer frame for the child body.
-      // A little note for how to read the next line: the frames for
-      // F_BMo_W_array are:
-      //  - B this node's body.
-      //  - Mo body B's inboard frame origin.
-      // However, when indexing by child_node_index:
-      //  - B becomes C, the child node's body.
-      //  - Mo becomes Mc, body C's inboard frame origin.
-      const SpatialForce<T>& F_CMc_W = F_BMo_W_array[child_node_index];
-
-      // Shift to this node's mobilizer origin Mo (still, F_CMo is the force
-      // acting on the child body C):
-      const SpatialForce<T>& F_CMo_W = F_CMc_W.Shift(p_McMo_W);
-      // From Eq. (3), this force is added (with positive sign) to the force
-      // applied by this body's mobilizer:
-      F_BMo_W += F_CMo_W;
-    }
-    // Add applied forces contribution.
-    F_BMo_W -= Fapplied_Bo_W.Shift(p_BoMo_W);
-
-    // Re-express F_BMo_W in the inboard frame F before projecting it onto the
-    // sub-space generated by H_FM(q).
-    const math::RotationMatrix<T> R_PF =
-        inboard_frame().CalcRotationMatrixInBodyFrame(context);
-    const math::RotationMatrix<T>& R_WP = get_R_WP(pc);
-    // TODO(amcastro-tri): consider caching R_WF since also used in position and
-    // velocity kinematics.
-    const math::RotationMatrix<T> R_WF = R_WP * R_PF;
-    const SpatialForce<T> F_BMo_F = R_WF.inverse() * F_BMo_W;
-
-    // Generalized velocities and forces use the same indexing.
-    auto tau = get_mutable_generalized_forces_from_array(tau_array);
-
-    // Demand that tau_applied is not an entry of tau. It would otherwise get
-    // overwritten.
-    DRAKE_DEMAND(tau.data() != tau_applied.data());
-
-    // The generalized forces on the mobilizer correspond to the active
-    // components of the spatial force performing work. Therefore we need to
-    // project F_BMo along the directions of motion.
-    // Project as: tau = H_FMᵀ(q) * F_BMo_F, Eq. (4).
-    get_mobilizer().ProjectSpatialForce(context, F_BMo_F, tau);
-
-    // Include the contribution of applied generalized forces.
-    if (tau_applied.size() != 0) tau -= tau_applied;
+    DoCalcInverseDynamics_TipToBase(context, pc, M_B_W_cache, Fb_Bo_W_cache,
+                                    A_WB_array, Fapplied_Bo_W, tau_applied,
+                                    F_BMo_W_array_ptr, tau_array);
   }
 
   /// Returns the topology information for this body node.
@@ -805,48 +399,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
       const systems::Context<T>& context,
       const PositionKinematicsCache<T>& pc,
       EigenPtr<MatrixX<T>> H_PB_W) const {
-    // Checks on the input arguments.
-    DRAKE_DEMAND(topology_.body != world_index());
-    DRAKE_DEMAND(H_PB_W != nullptr);
-    DRAKE_DEMAND(H_PB_W->rows() == 6);
-    DRAKE_DEMAND(H_PB_W->cols() == get_num_mobilizer_velocities());
-
-    // Inboard frame F of this node's mobilizer.
-    const Frame<T>& frame_F = inboard_frame();
-    // Outboard frame M of this node's mobilizer.
-    const Frame<T>& frame_M = outboard_frame();
-
-    const math::RotationMatrix<T> R_PF =
-        frame_F.CalcRotationMatrixInBodyFrame(context);
-    const math::RigidTransform<T> X_MB =
-        frame_M.CalcPoseInBodyFrame(context).inverse();
-
-    // Form the rotation matrix relating the world frame W and parent body P.
-    const math::RotationMatrix<T>& R_WP = get_R_WP(pc);
-
-    // Orientation (rotation) of frame F with respect to the world frame W.
-    const math::RotationMatrix<T> R_WF = R_WP * R_PF;
-
-    // Vector from Mo to Bo expressed in frame F as needed below:
-    const math::RotationMatrix<T>& R_FM = get_X_FM(pc).rotation();
-    const Vector3<T>& p_MB_M = X_MB.translation();
-    const Vector3<T> p_MB_F = R_FM * p_MB_M;
-
-    // Compute the imob-th column in J_PB_W:
-    VectorUpTo6<T> v = VectorUpTo6<T>::Zero(get_num_mobilizer_velocities());
-    // We compute H_FM(q) one column at a time by calling the multiplication by
-    // H_FM operation on a vector of generalized velocities which is zero except
-    // for its imob-th component, which is one.
-    for (int imob = 0; imob < get_num_mobilizer_velocities(); ++imob) {
-      v(imob) = 1.0;
-      // Compute the imob-th column of H_FM:
-      const SpatialVelocity<T> Himob_FM =
-          get_mobilizer().CalcAcrossMobilizerSpatialVelocity(context, v);
-      v(imob) = 0.0;
-      // V_PB_W = V_PFb_W + V_FMb_W + V_MB_W = V_FMb_W =
-      //         = R_WF * V_FM.Shift(p_MoBo_F)
-      H_PB_W->col(imob) = (R_WF * Himob_FM.Shift(p_MB_F)).get_coeffs();
-    }
+    DoCalcAcrossNodeJacobianWrtVExpressedInWorld(context, pc, H_PB_W);
   }
 
   /// Helper method to retrieve a Jacobian matrix with respect to generalized
@@ -1161,182 +714,762 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
 
     const int nv = get_num_mobilizer_velocities();
 
-    // These terms do not show up for zero mobilities (weld).
-    if (nv != 0) {
-      // Compute the articulated body inertia innovations generalized force,
-      // e_B,
-      // according to (4).
-      VectorUpTo6<T>& e_B = get_mutable_e_B(aba_force_cache);
-      e_B = tau_applied - H_PB_W.transpose() * Z_Bo_W.get_coeffs();
+    // These terms do not show up for zero mobilities (weld).
+    if (nv != 0) {
+      // Compute the articulated body inertia innovations generalized force,
+      // e_B,
+      // according to (4).
+      VectorUpTo6<T>& e_B = get_mutable_e_B(aba_force_cache);
+      e_B = tau_applied - H_PB_W.transpose() * Z_Bo_W.get_coeffs();
+
+      // Get the Kalman gain from cache.
+      const Matrix6xUpTo6<T>& g_PB_W = get_g_PB_W(abic);
+
+      // Compute the projected articulated body force bias Zplus_PB_W.
+      get_mutable_Zplus_PB_W(aba_force_cache) +=
+          SpatialForce<T>(g_PB_W * e_B);
+    }
+  }
+
+  /// This method is used by MultibodyTree within a base-to-tip loop to compute
+  /// the generalized accelerations `vdot` and the spatial accelerations `A_WB`.
+  /// Please refer to @ref internal_forward_dynamics
+  /// "Articulated Body Algorithm Forward Dynamics" for further mathematical
+  /// background and implementation details.
+  ///
+  /// @param[in] context
+  ///   The context with the state of the MultibodyTree model.
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with `context`.
+  /// @param[in] abic
+  ///   An already updated articulated body inertia cache in sync with
+  ///   `context`.
+  /// @param[in] aba_force_cache
+  ///   An already updated articulated body algorithm cache in sync with
+  ///   `context`.
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix that relates to the spatial velocity `V_PB_W`
+  ///   of this node's body B in its parent node body P, expressed in the world
+  ///   frame W, with this node's generalized velocities (or mobilities) `v_B`
+  ///   by `V_PB_W = H_PB_W⋅v_B`.
+  /// @param[in] Ab_WB
+  ///   The spatial acceleration bias term `Ab_WB` as it appears in the
+  ///   acceleration level motion constraint imposed by body B's mobilizer
+  ///   `A_WB = Aplus_WB + Ab_WB + H_PB_W * vdot_B`.
+  ///   See @ref abi_computing_accelerations for further details.
+  /// @param[out] ac
+  ///   A pointer to a valid, non nullptr, acceleration kinematics cache.
+  ///
+  /// @pre pc, vc, and abic previously computed to be in sync with `context.
+  /// @pre CalcArticulatedBodyAccelerations_BaseToTip() must have already been
+  /// called for the parent node (and, by recursive precondition, all
+  /// predecessor nodes in the tree.)
+  /// @throws when called on the _root_ node of `ac` or `vdot` is nullptr.
+  void CalcArticulatedBodyAccelerations_BaseToTip(
+      const systems::Context<T>& /* context */,
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abic,
+      const ArticulatedBodyForceCache<T>& aba_force_cache,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      const SpatialAcceleration<T>& Ab_WB,
+      AccelerationKinematicsCache<T>* ac) const {
+    DRAKE_THROW_UNLESS(ac != nullptr);
+
+    // As a guideline for developers, please refer to @ref
+    // abi_computing_accelerations for a detailed description of the algorithm
+    // and the notation in use.
+
+    // Get the spatial acceleration of the parent.
+    const SpatialAcceleration<T>& A_WP = parent_node_->get_A_WB(*ac);
+
+    // Shift vector p_PoBo_W from the parent origin to the body origin.
+    const Vector3<T>& p_PoBo_W = get_p_PoBo_W(pc);
+
+    const int nv = get_num_mobilizer_velocities();
+
+    // Rigidly shift the acceleration of the parent node.
+    const SpatialAcceleration<T> Aplus_WB = SpatialAcceleration<T>(
+        A_WP.rotational(),
+        A_WP.translational() + A_WP.rotational().cross(p_PoBo_W));
+
+    SpatialAcceleration<T>& A_WB = get_mutable_A_WB(ac);
+    A_WB = Aplus_WB + Ab_WB;
+
+    // These quantities do not contribute when nv = 0. We skip them since Eigen
+    // does not allow certain operations on zero-sized objects.
+    if (nv != 0) {
+      // Compute nu_B, the articulated body inertia innovations generalized
+      // acceleration.
+      const VectorUpTo6<T> nu_B =
+          get_ldlt_D_B(abic).solve(get_e_B(aba_force_cache));
+
+      // Mutable reference to the generalized acceleration.
+      auto vmdot = get_mutable_accelerations(ac);
+      const Matrix6xUpTo6<T>& g_PB_W = get_g_PB_W(abic);
+      vmdot = nu_B - g_PB_W.transpose() * A_WB.get_coeffs();
+
+      // Update with vmdot term the spatial acceleration of the current body.
+      A_WB += SpatialAcceleration<T>(H_PB_W * vmdot);
+    }
+  }
+
+  /// This method is used by MultibodyTree within a tip-to-base loop to compute
+  /// the composite body inertia of each body in the system.
+  ///
+  /// @param[in] M_B_W Spatial inertia for the body B associated with this node.
+  /// About B's origin Bo and expressed in the world frame W.
+  /// @param[in] pc Position kinematics cache.
+  /// @param[in] Mc_B_W_all Vector storing the composite body inertia for all
+  /// bodies in the multibody system. It must contain already up-to-date
+  /// composite body inertias for all the children of `this` node.
+  /// @param[out] Mc_B_W The composite body inertia for `this` node. It must be
+  /// non-nullptr.
+  /// @pre CalcCompositeBodyInertia_TipToBase() must have already been called
+  /// for the children nodes (and, by recursive precondition, all outboard nodes
+  /// in the tree.)
+  void CalcCompositeBodyInertia_TipToBase(
+      const SpatialInertia<T>& M_B_W,
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<SpatialInertia<T>>& Mc_B_W_all,
+      SpatialInertia<T>* Mc_B_W) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_THROW_UNLESS(Mc_B_W != nullptr);
+
+    // Composite body inertia R_B_W for this node B, about its frame's origin
+    // Bo, and expressed in the world frame W. Here we adopt the notation used
+    // in Jain's book.
+    *Mc_B_W = M_B_W;
+    // Add composite body inertia contributions from all children.
+    for (const BodyNode<T>* child : children_) {
+      // Shift vector p_CoBo_W.
+      const Vector3<T>& p_BoCo_W = child->get_p_PoBo_W(pc);
+      const Vector3<T> p_CoBo_W = -p_BoCo_W;
+
+      // Composite body inertia for outboard child body C, about Co, expressed
+      // in W.
+      const SpatialInertia<T>& Mc_CCo_W = Mc_B_W_all[child->index()];
+
+      // Shift to Bo and add it to the composite body inertia of B.
+      *Mc_B_W += Mc_CCo_W.Shift(p_CoBo_W);
+    }
+  }
+
+  /// Computes the spatial acceleration bias `Ab_WB(q, v)` for `this` node, a
+  /// function of both configuration q and velocities v. This term appears in
+  /// the acceleration level motion constraint imposed by body B's mobilizer
+  /// `A_WB = Aplus_WB + Ab_WB + H_PB_W * vdot_B`. Refer to
+  /// @ref abi_computing_accelerations for a detailed description and
+  /// derivation.
+  /// @param[in] context The context with the state of the MultibodyTree model.
+  /// @param[in] pc An already updated position kinematics cache in sync with
+  ///   `context`.
+  /// @param[in] vc An already updated velocity kinematics cache in sync with
+  ///   `context`.
+  /// @param[out] Ab_WB The spatial acceleration bias for this node, measured
+  ///   and expressed in the world frame W. Must be non nullptr.
+  ///
+  /// @pre pc and vc previously computed to be in sync with `context.
+  ///
+  /// @throws when `Ab_WB` is nullptr.
+  void CalcSpatialAccelerationBias(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      SpatialAcceleration<T>* Ab_WB) const {
+    DoCalcSpatialAccelerationBias(context, pc, vc, Ab_WB);
+  }
+
+ protected:
+  /// Returns the inboard frame F of this node's mobilizer.
+  /// @throws std::runtime_error if called on the root node corresponding to
+  /// the _world_ body.
+  const Frame<T>& inboard_frame() const {
+    return get_mobilizer().inboard_frame();
+  }
+
+  /// Returns the outboard frame M of this node's mobilizer.
+  /// @throws std::runtime_error if called on the root node corresponding to
+  /// the _world_ body.
+  const Frame<T>& outboard_frame() const {
+    return get_mobilizer().outboard_frame();
+  }
+
+  // NVIs for the recursive passes above. Their default implementations call
+  // the corresponding *Impl() kernel below through the Mobilizer<T> interface
+  // and therefore pay for a virtual call per mobilizer operation.
+  // SpecializedBodyNode (see body_node_impl.h) overrides them to call the
+  // kernels with the concrete mobilizer type instead, so that the compiler can
+  // inline the joint kinematics into the recursion.
+  virtual void DoCalcPositionKinematicsCache_BaseToTip(
+      const systems::Context<T>& context,
+      PositionKinematicsCache<T>* pc) const {
+    CalcPositionKinematicsCache_BaseToTipImpl(get_mobilizer(), context, pc);
+  }
+
+  virtual void DoCalcVelocityKinematicsCache_BaseToTip(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      VelocityKinematicsCache<T>* vc) const {
+    CalcVelocityKinematicsCache_BaseToTipImpl(get_mobilizer(), context, pc,
+                                              H_PB_W, vc);
+  }
+
+  virtual void DoCalcSpatialAcceleration_BaseToTip(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>* vc,
+      const VectorX<T>& mbt_vdot,
+      std::vector<SpatialAcceleration<T>>* A_WB_array_ptr) const {
+    CalcSpatialAcceleration_BaseToTipImpl(get_mobilizer(), context, pc, vc,
+                                          mbt_vdot, A_WB_array_ptr);
+  }
+
+  virtual void DoCalcInverseDynamics_TipToBase(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<SpatialInertia<T>>& M_B_W_cache,
+      const std::vector<SpatialForce<T>>* Fb_Bo_W_cache,
+      const std::vector<SpatialAcceleration<T>>& A_WB_array,
+      const SpatialForce<T>& Fapplied_Bo_W,
+      const Eigen::Ref<const VectorX<T>>& tau_applied,
+      std::vector<SpatialForce<T>>* F_BMo_W_array_ptr,
+      EigenPtr<VectorX<T>> tau_array) const {
+    CalcInverseDynamics_TipToBaseImpl(
+        get_mobilizer(), context, pc, M_B_W_cache, Fb_Bo_W_cache, A_WB_array,
+        Fapplied_Bo_W, tau_applied, F_BMo_W_array_ptr, tau_array);
+  }
+
+  virtual void DoCalcAcrossNodeJacobianWrtVExpressedInWorld(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      EigenPtr<MatrixX<T>> H_PB_W) const {
+    CalcAcrossNodeJacobianWrtVExpressedInWorldImpl(get_mobilizer(), context,
+                                                   pc, H_PB_W);
+  }
+
+  virtual void DoCalcSpatialAccelerationBias(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      SpatialAcceleration<T>* Ab_WB) const {
+    CalcSpatialAccelerationBiasImpl(get_mobilizer(), context, pc, vc, Ab_WB);
+  }
+
+  // Kernels for the recursive passes documented in the public section above,
+  // templated on the static type of `mobilizer`. That is either Mobilizer<T>
+  // or the concrete (final) class of get_mobilizer(), which `mobilizer` must
+  // be.
+  template <class MobilizerType>
+  void CalcPositionKinematicsCache_BaseToTipImpl(
+      const MobilizerType& mobilizer,
+      const systems::Context<T>& context,
+      PositionKinematicsCache<T>* pc) const {
+    // This method must not be called for the "world" body node.
+    DRAKE_ASSERT(topology_.body != world_index());
+
+    DRAKE_ASSERT(pc != nullptr);
+
+    // Update mobilizer' position dependent kinematics.
+    CalcAcrossMobilizerPositionKinematicsCache(mobilizer, context, pc);
+
+    // This computes into the PositionKinematicsCache:
+    // - X_PB(qb_P, qm_B, qb_B)
+    // - X_WB(q(W:P), qb_P, qm_B, qb_B)
+    // where qb_P are the generalized coordinates associated with body P, qm_B
+    // the generalized coordinates associated with this node's mobilizer and
+    // qb_B the generalized coordinates associated with body B. q(W:P) denotes
+    // all generalized positions in the kinematics path between the world and
+    // the parent body P.
+    // It assumes:
+    // - Body B already updated the pose `X_BM(qb_B)` of the inboard
+    //   mobilizer M.
+    // - We are in a base-to-tip recursion and therefore `X_PF(qb_P)` and `X_WP`
+    //   have already been updated.
+    CalcAcrossMobilizerBodyPoses_BaseToTip(context, pc);
+
+    // TODO(amcastro-tri):
+    // Update Body specific kinematics. These include:
+    // - p_PB_W: vector from P to B to perform shift operations.
+    // - com_W: center of mass.
+    // - M_Bo_W: Spatial inertia.
+
+    // TODO(amcastro-tri):
+    // With H_FM(qm) already in the cache (computed by
+    // Mobilizer::UpdatePositionKinematicsCache()) update the cache
+    // entries for H_PB_W, the hinge matrix for the SpatialVelocity jump between
+    // body B and its parent body P expressed in the world frame W.
+  }
+
+  template <class MobilizerType>
+  void CalcVelocityKinematicsCache_BaseToTipImpl(
+      const MobilizerType& mobilizer,
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      VelocityKinematicsCache<T>* vc) const {
+    // This method must not be called for the "world" body node.
+    DRAKE_ASSERT(topology_.body != world_index());
+
+    DRAKE_ASSERT(vc != nullptr);
+    DRAKE_DEMAND(H_PB_W.rows() == 6);
+    DRAKE_DEMAND(H_PB_W.cols() == get_num_mobilizer_velocities());
+
+    // As a guideline for developers, a summary of the computations performed in
+    // this method is provided:
+    // Notation:
+    //  - B body frame associated with this node.
+    //  - P ("parent") body frame associated with this node's parent.
+    //  - F mobilizer inboard frame attached to body P.
+    //  - M mobilizer outboard frame attached to body B.
+    // The goal is computing the spatial velocity V_WB of body B measured in the
+    // world frame W. The calculation is recursive and assumes the spatial
+    // velocity V_WP of the inboard body P is already computed. These spatial
+    // velocities are related by the recursive relation:
+    //   V_WB = V_WPb + V_PB_W (Eq. 5.6 in Jain (2010), p. 77)              (1)
+    // where Pb is a frame aligned with P but with its origin shifted from Po
+    // to B's origin Bo. Then V_WPb is the spatial velocity of frame Pb,
+    // measured and expressed in the world frame W. Then since V_PB's
+    // translational component is also for the point Bo, we can add these
+    // spatial velocities. Therefore we need to develop expressions for the two
+    // terms (V_WPb and V_PB_W) in Eq. (1).
+    //
+    // Computation of V_PB_W:
+    // This can be split as:
+    //   V_PB_W = V_PFb_W + V_FMb_W + V_MB_W                                (2)
+    // where Fb and Mb are frames aligned rigidly with F and M but with their
+    // origins at Bo. Assuming body P a rigid body V_PFb_W = 0 and assuming B
+    // a rigid body V_MB_W = 0, but that won't be true for flexible bodies.
+    // TODO(amcastro-tri): incorporate terms for flexible bodies below.
+    // Therefore for rigid bodies V_PB_W = V_FMb_W, which can be computed from
+    // the spatial velocity measured in frame F (as provided by mobilizer's
+    // methods)
+    //   V_FMb_W = R_WF * V_FMb = R_WF * V_FM.Shift(p_MoBo_F)               (3)
+    // arriving to the desired result:
+    //   V_PB_W = R_WF * V_FM.Shift(p_MoBo_F)                               (4)
+    //
+    // V_FM is immediately available from this node's mobilizer with the method
+    // CalcAcrossMobilizerSpatialVelocity() which computes M's spatial velocity
+    // in F by V_FM = H_FM * vm, where H_FM is the mobilizer's hinge matrix.
+    //
+    // Computation of V_WPb:
+    // This can be computed by a simple shift operation from V_WP:
+    //   V_WPb = V_WP.Shift(p_PoBo_W)                                       (5)
+    //
+    // Note:
+    // It is very common to find treatments in which the body frame B is
+    // coincident with the outboard frame M, that is B ≡ M, leading to slightly
+    // simpler recursive relations (for instance, see Section 3.3.2 in
+    // Jain (2010).) where p_MoBo_F = 0 and thus V_PB_W = V_FM_W. Here we relax
+    // this restriction in preparation of the more general case considering
+    // flexible bodies.
+
+    // Generalized velocities local to this node's mobilizer.
+    const auto& vm = this->get_mobilizer_velocities(context);
+
+    // =========================================================================
+    // Computation of V_PB_W in Eq. (1). See summary at the top of this method.
+
+    // Update V_FM using the operator V_FM = H_FM * vm:
+    SpatialVelocity<T>& V_FM = get_mutable_V_FM(vc);
+    V_FM = mobilizer.CalcAcrossMobilizerSpatialVelocity(context, vm);
+
+    // Compute V_PB_W = R_WF * V_FM.Shift(p_MoBo_F), Eq. (4).
+    // Side note to developers: in operator form for rigid bodies this would be
+    //   V_PB_W = R_WF * phiT_MB_F * V_FM
+    //          = R_WF * phiT_MB_F * H_FM * vm
+    //          = H_PB_W * vm
+    // where H_PB_W = R_WF * phiT_MB_F * H_FM.
+    SpatialVelocity<T>& V_PB_W = get_mutable_V_PB_W(vc);
+    V_PB_W.get_coeffs() = H_PB_W * vm;
+
+    // =========================================================================
+    // Computation of V_WPb in Eq. (1). See summary at the top of this method.
+
+    // Shift vector between the parent body P and this node's body B,
+    // expressed in the world frame W.
+    const Vector3<T>& p_PB_W = get_p_PoBo_W(pc);
+
+    // Since we are in a base-to-tip recursion the parent body P's spatial
+    // velocity is already available in the cache.
+    const SpatialVelocity<T>& V_WP = get_V_WP(*vc);
+
+    // =========================================================================
+    // Update velocity V_WB of this node's body B in the world frame. Using the
+    // recursive Eq. (1). See summary at the top of this method.
+    get_mutable_V_WB(vc) = V_WP.ComposeWithMovingFrameVelocity(p_PB_W, V_PB_W);
+  }
+
+  template <class MobilizerType>
+  void CalcSpatialAcceleration_BaseToTipImpl(
+      const MobilizerType& mobilizer,
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>* vc,
+      const VectorX<T>& mbt_vdot,
+      std::vector<SpatialAcceleration<T>>* A_WB_array_ptr) const {
+    // This method must not be called for the "world" body node.
+    DRAKE_DEMAND(topology_.body != world_index());
+    DRAKE_DEMAND(A_WB_array_ptr != nullptr);
+    std::vector<SpatialAcceleration<T>>& A_WB_array = *A_WB_array_ptr;
+
+    // As a guideline for developers, a summary of the computations performed in
+    // this method is provided:
+    // Notation:
+    //  - B body frame associated with this node.
+    //  - P ("parent") body frame associated with this node's parent.
+    //  - F mobilizer inboard frame attached to body P.
+    //  - M mobilizer outboard frame attached to body B.
+    // The goal is computing the spatial acceleration A_WB of body B measured in
+    // the world frame W. The calculation is recursive and assumes the spatial
+    // acceleration A_WP of the inboard body P is already computed.
+    // The spatial velocities of P and B are related by the recursive relation
+    // (computation is performed by CalcVelocityKinematicsCache_BaseToTip():
+    //   V_WB = V_WPb + V_PB_W (Eq. 5.6 in Jain (2010), p. 77)
+    //        = V_WP.ComposeWithMovingFrameVelocity(p_PB_W, V_PB_W)         (1)
+    // where Pb is a frame aligned with P but with its origin shifted from Po
+    // to B's origin Bo. Then V_WPb is the spatial velocity of frame Pb,
+    // measured and expressed in the world frame W.
+    //
+    // In the same way the parent body P velocity V_WP can be composed with body
+    // B's velocity V_PB in P, the acceleration A_WB can be obtained by
+    // composing A_WP with A_PB:
+    //  A_WB = A_WP.ComposeWithMovingFrameAcceleration(
+    //      p_PB_W, w_WP, V_PB_W, A_PB_W);                                  (2)
+    // which includes both centrifugal and coriolis terms. For details on this
+    // operation refer to the documentation for
+    // SpatialAcceleration::ComposeWithMovingFrameAcceleration().
+    //
+    // By recursive precondition, this method was already called on all
+    // predecessor nodes in the tree and therefore the acceleration A_WP is
+    // already available.
+    // V_WP (i.e. w_WP) and V_PB_W were computed in the velocity kinematics pass
+    // and are therefore available in the VelocityKinematicsCache vc.
+    //
+    // Therefore, all that is left is computing A_PB_W = DtP(V_PB)_W.
+    // The acceleration of B in P is:
+    //   A_PB = DtP(V_PB) = DtF(V_FMb) = A_FM.Shift(p_MB, w_FM)             (3)
+    // which expressed in the world frame leads to (see note below):
+    //   A_PB_W = R_WF * A_FM.Shift(p_MB_F, w_FM)                           (4)
+    // where R_WF is the rotation matrix from F to W and A_FM expressed in the
+    // inboard frame F is the direct result from
+    // Mobilizer::CalcAcrossMobilizerAcceleration().
+    //
+    // * Note:
+    //     The rigid body assumption is made in Eq. (3) in two places:
+    //       1. DtP() = DtF() since V_PF = 0.
+    //       2. V_PB = V_FMb since V_PB = V_PFb + V_FMb + V_MB but since P is
+    //          assumed rigid V_PF = 0 and since B is assumed rigid V_MB = 0.
+
+    // Body for this node. Its body frame is also referred to as B whenever no
+    // ambiguity can arise.
+    const Body<T>& body_B = body();
+
+    // Body for this node's parent, or the parent body P. Its body frame is
+    // also referred to as P whenever no ambiguity can arise.
+    const Body<T>& body_P = parent_body();
+
+    // Inboard frame F of this node's mobilizer.
+    const Frame<T>& frame_F = inboard_frame();
+    DRAKE_ASSERT(frame_F.body().index() == body_P.index());
+    // Outboard frame M of this node's mobilizer.
+    const Frame<T>& frame_M = outboard_frame();
+    DRAKE_ASSERT(frame_M.body().index() == body_B.index());
+
+    // =========================================================================
+    // Computation of A_PB = DtP(V_PB), Eq. (4).
+
+    // These are computed with the position kinematics.
+    const math::RotationMatrix<T>& R_PF = get_R_PF(pc);
+    const math::RigidTransform<T>& X_MB = get_X_MB(pc);
+
+    // Form the rotation matrix relating the world frame W and parent body P.
+    // Available since we are called within a base-to-tip recursion.
+    const math::RotationMatrix<T>& R_WP = get_R_WP(pc);
+
+    // Orientation (rotation) of frame F with respect to the world frame W.
+    // TODO(amcastro-tri): consider caching X_WF since it is also used to
+    // compute H_PB_W.
+    const math::RotationMatrix<T> R_WF = R_WP * R_PF;
+
+    // Vector from Mo to Bo expressed in frame F as needed below:
+    // TODO(amcastro-tri): consider caching this since it is also used to
+    // compute H_PB_W.
+    const math::RotationMatrix<T>& R_FM = get_X_FM(pc).rotation();
+    const Vector3<T>& p_MB_M = X_MB.translation();
+    const Vector3<T> p_MB_F = R_FM * p_MB_M;
+
+    // Generalized velocities' time derivatives local to this node's mobilizer.
+    const auto& vmdot = this->get_mobilizer_velocities(mbt_vdot);
+
+    // Operator A_FM = H_FM * vmdot + Hdot_FM * vm
+    SpatialAcceleration<T> A_FM =
+        mobilizer.CalcAcrossMobilizerSpatialAcceleration(context, vmdot);
+
+    // =========================================================================
+    // Compose acceleration A_WP of P in W with acceleration A_PB of B in P,
+    // Eq. (2)
+
+    // Obtains a const reference to the parent acceleration from A_WB_array.
+    const SpatialAcceleration<T>& A_WP = get_A_WP_from_array(A_WB_array);
+
+    // Shift vector between the parent body P and this node's body B,
+    // expressed in the world frame W.
+    const Vector3<T>& p_PB_W = get_p_PoBo_W(pc);
+
+    if (vc != nullptr) {
+      // Since we are in a base-to-tip recursion the parent body P's spatial
+      // velocity is already available in the cache.
+      const SpatialVelocity<T>& V_WP = get_V_WP(*vc);
+
+      // For body B, only the spatial velocity V_PB_W is already available in
+      // the cache. The acceleration A_PB_W was computed above.
+      const SpatialVelocity<T>& V_PB_W = get_V_PB_W(*vc);
+
+      // Across mobilizer velocity is available from the velocity kinematics.
+      const SpatialVelocity<T>& V_FM = get_V_FM(*vc);
+
+      const SpatialAcceleration<T> A_PB_W =
+          R_WF * A_FM.Shift(p_MB_F, V_FM.rotational());  // Eq. (4)
+
+      // Velocities are non-zero.
+      get_mutable_A_WB_from_array(&A_WB_array) =
+          A_WP.ComposeWithMovingFrameAcceleration(p_PB_W, V_WP.rotational(),
+                                                  V_PB_W, A_PB_W);
+    } else {
+      const SpatialAcceleration<T> A_PB_W =
+          R_WF * A_FM.Shift(p_MB_F);  // Eq. (4), with w_FM = 0.
+      // Velocities are zero. No need to compute terms that become zero.
+      get_mutable_A_WB_from_array(&A_WB_array) = A_WP.Shift(p_PB_W) + A_PB_W;
+    }
+  }
+
+  template <class MobilizerType>
+  void CalcInverseDynamics_TipToBaseImpl(
+      const MobilizerType& mobilizer,
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<SpatialInertia<T>>& M_B_W_cache,
+      const std::vector<SpatialForce<T>>* Fb_Bo_W_cache,
+      const std::vector<SpatialAcceleration<T>>& A_WB_array,
+      const SpatialForce<T>& Fapplied_Bo_W,
+      const Eigen::Ref<const VectorX<T>>& tau_applied,
+      std::vector<SpatialForce<T>>* F_BMo_W_array_ptr,
+      EigenPtr<VectorX<T>> tau_array) const {
+    DRAKE_DEMAND(F_BMo_W_array_ptr != nullptr);
+    std::vector<SpatialForce<T>>& F_BMo_W_array = *F_BMo_W_array_ptr;
+    DRAKE_DEMAND(
+        tau_applied.size() == get_num_mobilizer_velocities() ||
+        tau_applied.size() == 0);
+    DRAKE_DEMAND(tau_array != nullptr);
+    DRAKE_DEMAND(tau_array->size() ==
+        this->get_parent_tree().num_velocities());
+
+    // As a guideline for developers, a summary of the computations performed in
+    // this method is provided:
+    // Notation:
+    //  - B body frame associated with this node.
+    //  - P ("parent") body frame associated with this node's parent.
+    //  - F mobilizer inboard frame attached to body P.
+    //  - M mobilizer outboard frame attached to body B.
+    //  - Mo The origin of the outboard (or mobilized) frame of the mobilizer
+    //       attached to body B.
+    //  - C within a loop over children, one of body B's children.
+    //  - Mc The origin of the outboard (or mobilized) frame of the mobilizer
+    //       attached to body C.
+    // The goal is computing the spatial force F_BMo_W (on body B applied at its
+    // mobilized frame origin Mo) exerted by its inboard mobilizer that is
+    // required to produce the spatial acceleration A_WB. The generalized forces
+    // are then obtained as the projection of the spatial force F_BMo in the
+    // direction of this node's mobilizer motion. That is, the generalized
+    // forces correspond to the working components of the spatial force living
+    // in the motion sub-space of this node's mobilizer.
+    // The calculation is recursive (from tip-to-base) and assumes the spatial
+    // force F_CMc on body C at Mc is already computed in F_BMo_W_array_ptr.
+    //
+    // The spatial force through body B's inboard mobilizer is obtained from a
+    // force balance (essentially the F = m * a for rigid bodies, see
+    // [Jain 2010, Eq. 2.26, p. 27] for a derivation):
+    //   Ftot_BBo_W = M_Bo_W * A_WB + Fb_Bo_W                                (1)
+    // where Fb_Bo_W contains the velocity dependent gyroscopic terms,
+    // Ftot_BBo_W is the total spatial force on body B, applied at its origin Bo
+    // and quantities are expressed in the world frame W (though the
+    // expressed-in frame is not needed in a coordinate-free form.)
+    //
+    // The total spatial force on body B is the combined effect of externally
+    // applied spatial forces Fapp_BMo on body B at Mo and spatial forces
+    // induced by its inboard and outboard mobilizers. On its mobilized frame M,
+    // in coordinate-free form:
+    //   Ftot_BMo = Fapp_BMo + F_BMo - Σᵢ(F_CiMo)                           (2)
+    // where F_CiMo is the spatial force on the i-th child body Ci due to its
+    // inboard mobilizer which, by action/reaction, applies to body B as
+    // -F_CiMo, hence the negative sign in the summation above. The applied
+    // spatial force Fapp_BMo at Mo is obtained by shifting the applied force
+    // Fapp_Bo from Bo to Mo as Fapp_BMo.Shift(p_BoMo).
+    // Therefore, spatial force F_BMo due to body B's mobilizer is:
+    //   F_BMo = Ftot_BMo + Σᵢ(F_CiMo) - Fapp_BMo                           (3)
+    // The projection of this force on the motion sub-space of this node's
+    // mobilizer corresponds to the generalized force tau:
+    //  tau = H_FMᵀ * F_BMo_F                                               (4)
+    // where the spatial force F_BMo must be re-expressed in the inboard frame F
+    // before the projection can be performed.
+
+    // This node's body B.
+    const Body<T>& body_B = body();
+
+    // Input spatial acceleration for this node's body B.
+    const SpatialAcceleration<T>& A_WB = get_A_WB_from_array(A_WB_array);
+
+    // Total spatial force on body B producing acceleration A_WB.
+    SpatialForce<T> Ftot_BBo_W;
+    CalcBodySpatialForceGivenItsSpatialAcceleration(M_B_W_cache, Fb_Bo_W_cache,
+                                                    A_WB, &Ftot_BBo_W);
+
+    // Compute shift vector from Bo to Mo expressed in the world frame W.
+    const Frame<T>& frame_M = outboard_frame();
+    DRAKE_DEMAND(frame_M.body().index() == body_B.index());
+    const math::RigidTransform<T> X_BM = frame_M.CalcPoseInBodyFrame(context);
+    const Vector3<T>& p_BoMo_B = X_BM.translation();
+    const math::RigidTransform<T>& X_WB = get_X_WB(pc);
+    const math::RotationMatrix<T>& R_WB = X_WB.rotation();
+    const Vector3<T> p_BoMo_W = R_WB * p_BoMo_B;
+
+    // Output spatial force that would need to be exerted by this node's
+    // mobilizer in order to attain the prescribed acceleration A_WB.
+    SpatialForce<T>& F_BMo_W = F_BMo_W_array[this->index()];
 
-      // Get the Kalman gain from cache.
-      const Matrix6xUpTo6<T>& g_PB_W = get_g_PB_W(abic);
+    // Ensure this method was not called with an Fapplied_Bo_W being an entry
+    // into F_BMo_W_array, otherwise we would be overwriting Fapplied_Bo_W.
+    DRAKE_DEMAND(&F_BMo_W != &Fapplied_Bo_W);
 
-      // Compute the projected articulated body force bias Zplus_PB_W.
-      get_mutable_Zplus_PB_W(aba_force_cache) +=
-          SpatialForce<T>(g_PB_W * e_B);
-    }
-  }
+    // Shift spatial force on B to Mo.
+    F_BMo_W = Ftot_BBo_W.Shift(p_BoMo_W);
+    for (const BodyNode<T>* child_node : children_) {
+      BodyNodeIndex child_node_index = child_node->index();
 
-  /// This method is used by MultibodyTree within a base-to-tip loop to compute
-  /// the generalized accelerations `vdot` and the spatial accelerations `A_WB`.
-  /// Please refer to @ref internal_forward_dynamics
-  /// "Articulated Body Algorithm Forward Dynamics" for further mathematical
-  /// background and implementation details.
-  ///
-  /// @param[in] context
-  ///   The context with the state of the MultibodyTree model.
-  /// @param[in] pc
-  ///   An already updated position kinematics cache in sync with `context`.
-  /// @param[in] abic
-  ///   An already updated articulated body inertia cache in sync with
-  ///   `context`.
-  /// @param[in] aba_force_cache
-  ///   An already updated articulated body algorithm cache in sync with
-  ///   `context`.
-  /// @param[in] H_PB_W
-  ///   The hinge mapping matrix that relates to the spatial velocity `V_PB_W`
-  ///   of this node's body B in its parent node body P, expressed in the world
-  ///   frame W, with this node's generalized velocities (or mobilities) `v_B`
-  ///   by `V_PB_W = H_PB_W⋅v_B`.
-  /// @param[in] Ab_WB
-  ///   The spatial acceleration bias term `Ab_WB` as it appears in the
-  ///   acceleration level motion constraint imposed by body B's mobilizer
-  ///   `A_WB = Aplus_WB + Ab_WB + H_PB_W * vdot_B`.
-  ///   See @ref abi_computing_accelerations for further details.
-  /// @param[out] ac
-  ///   A pointer to a valid, non nullptr, acceleration kinematics cache.
-  ///
-  /// @pre pc, vc, and abic previously computed to be in sync with `context.
-  /// @pre CalcArticulatedBodyAccelerations_BaseToTip() must have already been
-  /// called for the parent node (and, by recursive precondition, all
-  /// predecessor nodes in the tree.)
-  /// @throws when called on the _root_ node of `ac` or `vdot` is nullptr.
-  void CalcArticulatedBodyAccelerations_BaseToTip(
-      const systems::Context<T>& /* context */,
-      const PositionKinematicsCache<T>& pc,
-      const ArticulatedBodyInertiaCache<T>& abic,
-      const ArticulatedBodyForceCache<T>& aba_force_cache,
-      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
-      const SpatialAcceleration<T>& Ab_WB,
-      AccelerationKinematicsCache<T>* ac) const {
-    DRAKE_THROW_UNLESS(ac != nullptr);
+      // Shift vector from Bo to Co, expressed in the world frame W.
+      const Vector3<T>& p_BoCo_W = child_node->get_p_PoBo_W(pc);
 
-    // As a guideline for developers, please refer to @ref
-    // abi_computing_accelerations for a detailed description of the algorithm
-    // and the notation in use.
+      // p_CoMc_W:
+      const Frame<T>& frame_Mc = child_node->outboard_frame();
+      const math::RotationMatrix<T>& R_WC = child_node->get_X_WB(pc).rotation();
+      const math::RigidTransform<T> X_CMc =
+          frame_Mc.CalcPoseInBodyFrame(context);
+      const Vector3<T>& p_CoMc_W = R_WC * X_CMc.translation();
 
-    // Get the spatial acceleration of the parent.
-    const SpatialAcceleration<T>& A_WP = parent_node_->get_A_WB(*ac);
+      // Shift position vector from child C outboard mobilizer frame Mc to body
+      // B outboard mobilizer Mc. p_MoMc_W:
+      // Since p_BoMo = p_BoCo + p_CoMc + p_McMo, we have:
+      const Vector3<T> p_McMo_W = p_BoMo_W - p_BoCo_W - p_CoMc_W;
 
-    // Shift vector p_PoBo_W from the parent origin to the body origin.
-    const Vector3<T>& p_PoBo_W = get_p_PoBo_W(pc);
+      // Spatial force on the child body C at the origin Mc of the outboard
+      // mobilizer frame for the child body.
+      // A little note for how to read the next line: the frames for
+      // F_BMo_W_array are:
+      //  - B this node's body.
+      //  - Mo body B's inboard frame origin.
+      // However, when indexing by child_node_index:
+      //  - B becomes C, the child node's body.
+      //  - Mo becomes Mc, body C's inboard frame origin.
+      const SpatialForce<T>& F_CMc_W = F_BMo_W_array[child_node_index];
 
-    const int nv = get_num_mobilizer_velocities();
+      // Shift to this node's mobilizer origin Mo (still, F_CMo is the force
+      // acting on the child body C):
+      const SpatialForce<T>& F_CMo_W = F_CMc_W.Shift(p_McMo_W);
+      // From Eq. (3), this force is added (with positive sign) to the force
+      // applied by this body's mobilizer:
+      F_BMo_W += F_CMo_W;
+    }
+    // Add applied forces contribution.
+    F_BMo_W -= Fapplied_Bo_W.Shift(p_BoMo_W);
 
-    // Rigidly shift the acceleration of the parent node.
-    const SpatialAcceleration<T> Aplus_WB = SpatialAcceleration<T>(
-        A_WP.rotational(),
-        A_WP.translational() + A_WP.rotational().cross(p_PoBo_W));
+    // Re-express F_BMo_W in the inboard frame F before projecting it onto the
+    // sub-space generated by H_FM(q).
+    const math::RotationMatrix<T>& R_PF = get_R_PF(pc);
+    const math::RotationMatrix<T>& R_WP = get_R_WP(pc);
+    // TODO(amcastro-tri): consider caching R_WF since also used in position and
+    // velocity kinematics.
+    const math::RotationMatrix<T> R_WF = R_WP * R_PF;
+    const SpatialForce<T> F_BMo_F = R_WF.inverse() * F_BMo_W;
 
-    SpatialAcceleration<T>& A_WB = get_mutable_A_WB(ac);
-    A_WB = Aplus_WB + Ab_WB;
+    // Generalized velocities and forces use the same indexing.
+    auto tau = get_mutable_generalized_forces_from_array(tau_array);
 
-    // These quantities do not contribute when nv = 0. We skip them since Eigen
-    // does not allow certain operations on zero-sized objects.
-    if (nv != 0) {
-      // Compute nu_B, the articulated body inertia innovations generalized
-      // acceleration.
-      const VectorUpTo6<T> nu_B =
-          get_ldlt_D_B(abic).solve(get_e_B(aba_force_cache));
+    // Demand that tau_applied is not an entry of tau. It would otherwise get
+    // overwritten.
+    DRAKE_DEMAND(tau.data() != tau_applied.data());
 
-      // Mutable reference to the generalized acceleration.
-      auto vmdot = get_mutable_accelerations(ac);
-      const Matrix6xUpTo6<T>& g_PB_W = get_g_PB_W(abic);
-      vmdot = nu_B - g_PB_W.transpose() * A_WB.get_coeffs();
+    // The generalized forces on the mobilizer correspond to the active
+    // components of the spatial force performing work. Therefore we need to
+    // project F_BMo along the directions of motion.
+    // Project as: tau = H_FMᵀ(q) * F_BMo_F, Eq. (4).
+    mobilizer.ProjectSpatialForce(context, F_BMo_F, tau);
 
-      // Update with vmdot term the spatial acceleration of the current body.
-      A_WB += SpatialAcceleration<T>(H_PB_W * vmdot);
-    }
+    // Include the contribution of applied generalized forces.
+    if (tau_applied.size() != 0) tau -= tau_applied;
   }
 
-  /// This method is used by MultibodyTree within a tip-to-base loop to compute
-  /// the composite body inertia of each body in the system.
-  ///
-  /// @param[in] M_B_W Spatial inertia for the body B associated with this node.
-  /// About B's origin Bo and expressed in the world frame W.
-  /// @param[in] pc Position kinematics cache.
-  /// @param[in] Mc_B_W_all Vector storing the composite body inertia for all
-  /// bodies in the multibody system. It must contain already up-to-date
-  /// composite body inertias for all the children of `this` node.
-  /// @param[out] Mc_B_W The composite body inertia for `this` node. It must be
-  /// non-nullptr.
-  /// @pre CalcCompositeBodyInertia_TipToBase() must have already been called
-  /// for the children nodes (and, by recursive precondition, all outboard nodes
-  /// in the tree.)
-  void CalcCompositeBodyInertia_TipToBase(
-      const SpatialInertia<T>& M_B_W,
+  template <class MobilizerType>
+  void CalcAcrossNodeJacobianWrtVExpressedInWorldImpl(
+      const MobilizerType& mobilizer,
+      const systems::Context<T>& context,
       const PositionKinematicsCache<T>& pc,
-      const std::vector<SpatialInertia<T>>& Mc_B_W_all,
-      SpatialInertia<T>* Mc_B_W) const {
-    DRAKE_THROW_UNLESS(topology_.body != world_index());
-    DRAKE_THROW_UNLESS(Mc_B_W != nullptr);
+      EigenPtr<MatrixX<T>> H_PB_W) const {
+    // Checks on the input arguments.
+    DRAKE_DEMAND(topology_.body != world_index());
+    DRAKE_DEMAND(H_PB_W != nullptr);
+    DRAKE_DEMAND(H_PB_W->rows() == 6);
+    DRAKE_DEMAND(H_PB_W->cols() == get_num_mobilizer_velocities());
 
-    // Composite body inertia R_B_W for this node B, about its frame's origin
-    // Bo, and expressed in the world frame W. Here we adopt the notation used
-    // in Jain's book.
-    *Mc_B_W = M_B_W;
-    // Add composite body inertia contributions from all children.
-    for (const BodyNode<T>* child : children_) {
-      // Shift vector p_CoBo_W.
-      const Vector3<T>& p_BoCo_W = child->get_p_PoBo_W(pc);
-      const Vector3<T> p_CoBo_W = -p_BoCo_W;
+    // The offsets of this node's mobilizer frames F and M in their bodies.
+    const math::RotationMatrix<T>& R_PF = get_R_PF(pc);
+    const math::RigidTransform<T>& X_MB = get_X_MB(pc);
 
-      // Composite body inertia for outboard child body C, about Co, expressed
-      // in W.
-      const SpatialInertia<T>& Mc_CCo_W = Mc_B_W_all[child->index()];
+    // Form the rotation matrix relating the world frame W and parent body P.
+    const math::RotationMatrix<T>& R_WP = get_R_WP(pc);
 
-      // Shift to Bo and add it to the composite body inertia of B.
-      *Mc_B_W += Mc_CCo_W.Shift(p_CoBo_W);
+    // Orientation (rotation) of frame F with respect to the world frame W.
+    const math::RotationMatrix<T> R_WF = R_WP * R_PF;
+
+    // Vector from Mo to Bo expressed in frame F as needed below:
+    const math::RotationMatrix<T>& R_FM = get_X_FM(pc).rotation();
+    const Vector3<T>& p_MB_M = X_MB.translation();
+    const Vector3<T> p_MB_F = R_FM * p_MB_M;
+
+    // Compute the imob-th column in J_PB_W:
+    VectorUpTo6<T> v = VectorUpTo6<T>::Zero(get_num_mobilizer_velocities());
+    // We compute H_FM(q) one column at a time by calling the multiplication by
+    // H_FM operation on a vector of generalized velocities which is zero except
+    // for its imob-th component, which is one.
+    for (int imob = 0; imob < get_num_mobilizer_velocities(); ++imob) {
+      v(imob) = 1.0;
+      // Compute the imob-th column of H_FM:
+      const SpatialVelocity<T> Himob_FM =
+          mobilizer.CalcAcrossMobilizerSpatialVelocity(context, v);
+      v(imob) = 0.0;
+      // V_PB_W = V_PFb_W + V_FMb_W + V_MB_W = V_FMb_W =
+      //         = R_WF * V_FM.Shift(p_MoBo_F)
+      H_PB_W->col(imob) = (R_WF * Himob_FM.Shift(p_MB_F)).get_coeffs();
     }
   }
 
-  /// Computes the spatial acceleration bias `Ab_WB(q, v)` for `this` node, a
-  /// function of both configuration q and velocities v. This term appears in
-  /// the acceleration level motion constraint imposed by body B's mobilizer
-  /// `A_WB = Aplus_WB + Ab_WB + H_PB_W * vdot_B`. Refer to
-  /// @ref abi_computing_accelerations for a detailed description and
-  /// derivation.
-  /// @param[in] context The context with the state of the MultibodyTree model.
-  /// @param[in] pc An already updated position kinematics cache in sync with
-  ///   `context`.
-  /// @param[in] vc An already updated velocity kinematics cache in sync with
-  ///   `context`.
-  /// @param[out] Ab_WB The spatial acceleration bias for this node, measured
-  ///   and expressed in the world frame W. Must be non nullptr.
-  ///
-  /// @pre pc and vc previously computed to be in sync with `context.
-  ///
-  /// @throws when `Ab_WB` is nullptr.
-  void CalcSpatialAccelerationBias(const systems::Context<T>& context,
-                                   const PositionKinematicsCache<T>& pc,
-                                   const VelocityKinematicsCache<T>& vc,
-                                   SpatialAcceleration<T>* Ab_WB) const {
+  template <class MobilizerType>
+  void CalcSpatialAccelerationBiasImpl(
+      const MobilizerType& mobilizer,
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      SpatialAcceleration<T>* Ab_WB) const {
     DRAKE_THROW_UNLESS(Ab_WB != nullptr);
     // As a guideline for developers, please refer to @ref
     // abi_computing_accelerations for a detailed description and derivation of
     // Ab_WB.
 
     Ab_WB->SetZero();
-    // Inboard frame F and outboard frame M of this node's mobilizer.
-    const Frame<T>& frame_F = inboard_frame();
-    const Frame<T>& frame_M = outboard_frame();
 
-    // Compute R_PF and X_MB.
-    const math::RotationMatrix<T> R_PF =
-        frame_F.CalcRotationMatrixInBodyFrame(context);
-    const math::RigidTransform<T> X_MB =
-        frame_M.CalcPoseInBodyFrame(context).inverse();
+    // R_PF and X_MB are computed with the position kinematics.
+    const math::RotationMatrix<T>& R_PF = get_R_PF(pc);
+    const math::RigidTransform<T>& X_MB = get_X_MB(pc);
 
     // Parent position in the world is available from the position kinematics.
     const math::RotationMatrix<T>& R_WP = get_R_WP(pc);
@@ -1363,7 +1496,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     const VectorUpTo6<T> vmdot_zero =
         VectorUpTo6<T>::Zero(get_num_mobilizer_velocities());
     const SpatialAcceleration<T> Ab_FM =
-        get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(context,
+        mobilizer.CalcAcrossMobilizerSpatialAcceleration(context,
                                                                vmdot_zero);
 
     // Due to the fact that frames P and F are on the same rigid body, we have
@@ -1402,21 +1535,6 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
         w_WP.cross(v_WB - v_WP + v_PB_W) + Ab_PB_W.translational());
   }
 
- protected:
-  /// Returns the inboard frame F of this node's mobilizer.
-  /// @throws std::runtime_error if called on the root node corresponding to
-  /// the _world_ body.
-  const Frame<T>& inboard_frame() const {
-    return get_mobilizer().inboard_frame();
-  }
-
-  /// Returns the outboard frame M of this node's mobilizer.
-  /// @throws std::runtime_error if called on the root node corresponding to
-  /// the _world_ body.
-  const Frame<T>& outboard_frame() const {
-    return get_mobilizer().outboard_frame();
-  }
-
  private:
   // Returns the index to the parent body of the body associated with this node.
   // For the root node, corresponding to the world body, this method returns an
@@ -1489,6 +1607,20 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     return pc->get_mutable_X_FM(topology_.index);
   }
 
+  // Returns a const reference to the pose of body B as measured and expressed
+  // in the outboard frame M of this node's mobilizer.
+  const math::RigidTransform<T>& get_X_MB(
+      const PositionKinematicsCache<T>& pc) const {
+    return pc.get_X_MB(topology_.index);
+  }
+
+  // Returns a const reference to the orientation of the inboard frame F of
+  // this node's mobilizer in the parent body frame P.
+  const math::RotationMatrix<T>& get_R_PF(
+      const PositionKinematicsCache<T>& pc) const {
+    return pc.get_R_PF(topology_.index);
+  }
+
   // Returns a const reference to the pose of body B as measured and expressed
   // in the frame of the parent body P.
   const math::RigidTransform<T>& get_X_PB(
@@ -1801,31 +1933,46 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     // - X_FM(qm_B)
     // - X_WP(q(W:B)), where q(W:B) includes all positions in the kinematics
     //                 path from body B to the world W.
-    const math::RigidTransform<T> X_MB =
-        frame_M.CalcPoseInBodyFrame(context).inverse();
     const math::RigidTransform<T>& X_FM =
         get_X_FM(*pc);  // mobilizer.Eval_X_FM(ctx)
     const math::RigidTransform<T>& X_WP =
         get_X_WP(*pc);  // body_P.EvalPoseInWorld(ctx)
 
     // Output (updating a cache entry):
+    // - X_MB(qb_B) and R_PF(qb_P), for the velocity and acceleration
+    //   recursions.
     // - X_PB(qf_P, qr_B, qf_B)
     // - X_WB(q(W:P), qf_P, qr_B, qf_B)
+    math::RigidTransform<T>& X_MB = pc->get_mutable_X_MB(topology_.index);
+    math::RotationMatrix<T>& R_PF = pc->get_mutable_R_PF(topology_.index);
     math::RigidTransform<T>& X_PB = get_mutable_X_PB(pc);
     math::RigidTransform<T>& X_WB =
         get_mutable_X_WB(pc);  // body_B.EvalPoseInWorld(ctx)
 
-    // TODO(amcastro-tri): Consider logic for the common case B = M.
-    // In that case X_FB = X_FM as suggested by setting X_MB = Id.
-    const math::RigidTransform<T> X_FB = X_FM * X_MB;
+    // In the common case that M is the body frame B, X_MB is the identity and
+    // X_FB = X_FM; likewise, X_PB = X_FB when F is the body frame P. These
+    // cases skip querying the frames and composing with identity transforms.
+    math::RigidTransform<T> X_FB;
+    if (frame_M.is_body_frame()) {
+      X_MB.SetIdentity();
+      X_FB = X_FM;
+    } else {
+      X_MB = frame_M.CalcPoseInBodyFrame(context).inverse();
+      X_FB = X_FM * X_MB;
+    }
 
     // Given the pose X_FB of body frame B measured in the mobilizer inboard
     // frame F, we can ask frame F (who's parent body is P) for the pose of body
     // B measured in the frame of the parent body P.
-    // In the particular case F = B, this method directly returns X_FB.
     // For flexible bodies this gives the chance to frame F to pull its pose
     // from the context.
-    X_PB = frame_F.CalcOffsetPoseInBody(context, X_FB);
+    if (frame_F.is_body_frame()) {
+      R_PF = math::RotationMatrix<T>::Identity();
+      X_PB = X_FB;
+    } else {
+      R_PF = frame_F.CalcRotationMatrixInBodyFrame(context);
+      X_PB = frame_F.CalcOffsetPoseInBody(context, X_FB);
+    }
 
     X_WB = X_WP * X_PB;
 
@@ -1853,12 +2000,14 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
   // quantities associated with `this` mobilizer. MultibodyTree will always
   // provide a valid PositionKinematicsCache pointer, otherwise this method
   // aborts in Debug builds.
+  template <class MobilizerType>
   void CalcAcrossMobilizerPositionKinematicsCache(
+      const MobilizerType& mobilizer,
       const systems::Context<T>& context,
       PositionKinematicsCache<T>* pc) const {
     DRAKE_ASSERT(pc != nullptr);
     math::RigidTransform<T>& X_FM = get_mutable_X_FM(pc);
-    X_FM = get_mobilizer().CalcAcrossMobilizerTransform(context);
+    X_FM = mobilizer.CalcAcrossMobilizerTransform(context);
   }
 
   // This method computes the total force Ftot_BBo on body B that must be
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/tree/body_node.h"
 #include "drake/multibody/tree/mobilizer.h"
@@ -48,6 +51,96 @@ class BodyNodeImpl : public BodyNode<T> {
   // using fixed-size Eigen matrices.
 };
 
+/// For internal use only of the MultibodyTree implementation.
+/// %SpecializedBodyNode is a BodyNode for a mobilizer whose concrete class
+/// `ConcreteMobilizer<T>` is known at compile time. It implements the
+/// recursive passes of BodyNode (the position, velocity and acceleration
+/// kinematics, the inverse dynamics, the across-node Jacobian and the
+/// articulated body spatial acceleration bias) by calling the mobilizer's
+/// kinematics on `ConcreteMobilizer<T>` rather than on the Mobilizer<T>
+/// interface. Since concrete mobilizers are `final`, these calls are resolved
+/// statically, and when this class is instantiated in the translation unit
+/// that defines the mobilizer's kinematics (see the implementations of
+/// Mobilizer::CreateBodyNode()), the compiler can inline them into each pass.
+///
+/// @tparam ConcreteMobilizer A `final` mobilizer class template, e.g.
+///   RevoluteMobilizer.
+template <typename T, template <typename> class ConcreteMobilizer>
+class SpecializedBodyNode final : public BodyNode<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SpecializedBodyNode)
+
+  /// Creates the node for `body` and its inboard `mobilizer`, whose concrete
+  /// type must be `ConcreteMobilizer<T>`. See the BodyNodeImpl constructor for
+  /// the meaning of the parameters.
+  SpecializedBodyNode(const internal::BodyNode<T>* parent_node,
+                      const Body<T>* body,
+                      const ConcreteMobilizer<T>* mobilizer)
+      : BodyNode<T>(parent_node, body, mobilizer), mobilizer_(*mobilizer) {
+    static_assert(std::is_final_v<ConcreteMobilizer<T>>,
+                  "Only final mobilizers devirtualize their kinematics.");
+  }
+
+ private:
+  void DoCalcPositionKinematicsCache_BaseToTip(
+      const systems::Context<T>& context,
+      PositionKinematicsCache<T>* pc) const final {
+    this->CalcPositionKinematicsCache_BaseToTipImpl(mobilizer_, context, pc);
+  }
+
+  void DoCalcVelocityKinematicsCache_BaseToTip(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      VelocityKinematicsCache<T>* vc) const final {
+    this->CalcVelocityKinematicsCache_BaseToTipImpl(mobilizer_, context, pc,
+                                                    H_PB_W, vc);
+  }
+
+  void DoCalcSpatialAcceleration_BaseToTip(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>* vc,
+      const VectorX<T>& mbt_vdot,
+      std::vector<SpatialAcceleration<T>>* A_WB_array_ptr) const final {
+    this->CalcSpatialAcceleration_BaseToTipImpl(mobilizer_, context, pc, vc,
+                                                mbt_vdot, A_WB_array_ptr);
+  }
+
+  void DoCalcInverseDynamics_TipToBase(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<SpatialInertia<T>>& M_B_W_cache,
+      const std::vector<SpatialForce<T>>* Fb_Bo_W_cache,
+      const std::vector<SpatialAcceleration<T>>& A_WB_array,
+      const SpatialForce<T>& Fapplied_Bo_W,
+      const Eigen::Ref<const VectorX<T>>& tau_applied,
+      std::vector<SpatialForce<T>>* F_BMo_W_array_ptr,
+      EigenPtr<VectorX<T>> tau_array) const final {
+    this->CalcInverseDynamics_TipToBaseImpl(
+        mobilizer_, context, pc, M_B_W_cache, Fb_Bo_W_cache, A_WB_array,
+        Fapplied_Bo_W, tau_applied, F_BMo_W_array_ptr, tau_array);
+  }
+
+  void DoCalcAcrossNodeJacobianWrtVExpressedInWorld(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      EigenPtr<MatrixX<T>> H_PB_W) const final {
+    this->CalcAcrossNodeJacobianWrtVExpressedInWorldImpl(mobilizer_, context,
+                                                         pc, H_PB_W);
+  }
+
+  void DoCalcSpatialAccelerationBias(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      SpatialAcceleration<T>* Ab_WB) const final {
+    this->CalcSpatialAccelerationBiasImpl(mobilizer_, context, pc, vc, Ab_WB);
+  }
+
+  const ConcreteMobilizer<T>& mobilizer_;
+};
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
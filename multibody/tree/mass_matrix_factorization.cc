@@ -0,0 +1,106 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_bool.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(MatrixX<T> M,
+                                                    std::vector<int> parents)
+    : LD_(std::move(M)), parents_(std::move(parents)) {
+  const int n = size();
+  DRAKE_THROW_UNLESS(LD_.rows() == n && LD_.cols() == n);
+  for (int i = 0; i < n; ++i) {
+    DRAKE_THROW_UNLESS(-1 <= parents_[i] && parents_[i] < i);
+  }
+
+  // This is the LTDL factorization in Table 6.3 of [Featherstone 2008]. For
+  // each velocity k, from the tips to the base, it eliminates the entries in
+  // row k of the lower triangle, which are only non-zero for the ancestors of
+  // k. The ancestors i of k are visited by following the chain of parents.
+  for (int k = n - 1; k >= 0; --k) {
+    const T& D_k = LD_(k, k);
+    if constexpr (scalar_predicate<T>::is_bool) {
+      if (!(D_k > 0)) {
+        throw std::runtime_error(fmt::format(
+            "MassMatrixFactorization: the mass matrix is not positive "
+            "definite; the pivot for generalized velocity {} is not positive.",
+            k));
+      }
+    }
+    for (int i = parents_[k]; i != -1; i = parents_[i]) {
+      const T a = LD_(k, i) / D_k;
+      for (int j = i; j != -1; j = parents_[j]) {
+        LD_(i, j) -= LD_(k, j) * a;
+      }
+      LD_(k, i) = a;
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::matrixL() const {
+  const int n = size();
+  MatrixX<T> L = MatrixX<T>::Identity(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = parents_[i]; j != -1; j = parents_[j]) {
+      L(i, j) = LD_(i, j);
+    }
+  }
+  return L;
+}
+
+template <typename T>
+VectorX<T> MassMatrixFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  DRAKE_THROW_UNLESS(b.size() == size());
+  VectorX<T> x = b;
+  SolveColumnInPlace(&x);
+  return x;
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveInPlace(EigenPtr<MatrixX<T>> B) const {
+  DRAKE_THROW_UNLESS(B != nullptr);
+  DRAKE_THROW_UNLESS(B->rows() == size());
+  for (int c = 0; c < B->cols(); ++c) {
+    auto x = B->col(c);
+    SolveColumnInPlace(&x);
+  }
+}
+
+template <typename T>
+template <typename Derived>
+void MassMatrixFactorization<T>::SolveColumnInPlace(
+    Eigen::MatrixBase<Derived>* x_ptr) const {
+  Eigen::MatrixBase<Derived>& x = *x_ptr;
+  const int n = size();
+  // Since M = Lᵀ D L, we solve Lᵀ y = b, D z = y and L x = z in turn, in
+  // place. Only the entries of L along the chains of parents are visited.
+  for (int i = n - 1; i >= 0; --i) {
+    for (int j = parents_[i]; j != -1; j = parents_[j]) {
+      x(j) -= LD_(i, j) * x(i);
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    x(i) /= LD_(i, i);
+  }
+  for (int i = 0; i < n; ++i) {
+    for (int j = parents_[i]; j != -1; j = parents_[j]) {
+      x(i) -= LD_(i, j) * x(j);
+    }
+  }
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::MassMatrixFactorization)
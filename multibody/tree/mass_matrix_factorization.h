@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+
+/// A factorization of the mass matrix M(q) of a multibody model that exploits
+/// the sparsity induced by the model's tree topology. The factorization is
+/// <pre>
+///   M = Lᵀ D L
+/// </pre>
+/// where D is diagonal and L is unit lower triangular. Two generalized
+/// velocities i and j only couple in M (Mᵢⱼ ≠ 0) when one of them is an
+/// ancestor of the other, i.e. when it belongs to the same mobilizer or to a
+/// mobilizer inboard of the other's. This sparsity pattern is preserved by the
+/// factorization, so that Lᵢⱼ ≠ 0 (for i ≠ j) only when j is an ancestor of i.
+/// Therefore, for a tree of n generalized velocities with maximum depth d
+/// (counted in generalized velocities), the factorization costs O(n d²) and a
+/// solve costs O(n d), rather than the O(n³) and O(n²) of a dense
+/// factorization. Refer to Section 6.5 of [Featherstone 2008] for details on
+/// this "LTDL" factorization.
+///
+/// The topology is described by the parent of each generalized velocity: the
+/// parent of velocity i (with i > 0) is either the previous velocity of the
+/// same mobilizer or, for the first velocity of a mobilizer, the last velocity
+/// of the closest inboard mobilizer with velocities. Generalized velocities
+/// must be ordered so that parents precede their children, as is the case for
+/// the velocities of a MultibodyPlant.
+///
+/// Use MultibodyPlant::CalcMassMatrixFactorization() to compute the
+/// factorization for a given state.
+///
+/// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+///                       algorithms. Springer.
+///
+/// @tparam_default_scalar
+template <typename T>
+class MassMatrixFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MassMatrixFactorization)
+
+  /// Factorizes the mass matrix `M` of a tree with the given `parents`.
+  /// @param[in] M
+  ///   The n x n mass matrix. Only its entries Mᵢⱼ with j an ancestor of i (or
+  ///   j = i) are read, all other entries are assumed to be zero.
+  /// @param[in] parents
+  ///   A vector of size n, with `parents[i]` the parent of generalized velocity
+  ///   i, or -1 if it has none. See the class documentation.
+  /// @throws std::exception if the size of `M` and `parents` are inconsistent
+  ///   or if `parents[i]` is not in [-1, i).
+  /// @throws std::exception if, for scalar types that can be compared, M is
+  ///   not positive definite.
+  MassMatrixFactorization(MatrixX<T> M, std::vector<int> parents);
+
+  /// Returns the size n of the factorized matrix.
+  int size() const { return static_cast<int>(parents_.size()); }
+
+  /// Returns the parent of each generalized velocity, as given at
+  /// construction.
+  const std::vector<int>& parents() const { return parents_; }
+
+  /// Returns the unit lower triangular factor L, as a dense matrix.
+  MatrixX<T> matrixL() const;
+
+  /// Returns the diagonal of D.
+  VectorX<T> vectorD() const { return LD_.diagonal(); }
+
+  /// Solves M x = b.
+  /// @throws std::exception if the size of `b` is not size().
+  VectorX<T> Solve(const Eigen::Ref<const VectorX<T>>& b) const;
+
+  /// Overwrites each column b of `B` with the solution x of M x = b.
+  /// @throws std::exception if `B` is nullptr or if its number of rows is not
+  ///   size().
+  void SolveInPlace(EigenPtr<MatrixX<T>> B) const;
+
+ private:
+  // Solves M x = b for a single column, in place.
+  template <typename Derived>
+  void SolveColumnInPlace(Eigen::MatrixBase<Derived>* x) const;
+
+  // D is stored in the diagonal and L in the entries (i, j) with j an ancestor
+  // of i. All other entries are meaningless.
+  MatrixX<T> LD_;
+  std::vector<int> parents_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::MassMatrixFactorization)
@@ -295,6 +295,16 @@ class Mobilizer : public MultibodyElement<Mobilizer, T, MobilizerIndex> {
   /// Returns `true` if `this` uses a quaternion parametrization of rotations.
   virtual bool has_quaternion_dofs() const { return false; }
 
+  /// Returns `true` if `this` mobilizer's generalized velocities equal the
+  /// time derivatives of its generalized positions, v = q̇, and each of its
+  /// generalized velocities moves the outboard frame M along a screw axis that
+  /// is fixed in the inboard frame F, independent of q. Revolute, prismatic
+  /// and weld mobilizers have this property. MultibodyTree's analytical
+  /// dynamics derivatives, see
+  /// MultibodyTree::CalcInverseDynamicsDerivatives(), are only available for
+  /// models in which every mobilizer has it.
+  virtual bool has_fixed_screw_axes() const { return false; }
+
   /// Returns the topology information for this mobilizer. Users should not
   /// need to call this method since MobilizerTopology is an internal
   /// bookkeeping detail.
@@ -578,9 +578,9 @@ Eigen::VectorBlock<const VectorX<T>>
 MultibodyTree<T>::get_discrete_state_vector(
     const systems::Context<T>& context) const {
   DRAKE_ASSERT(is_state_discrete());
-  DRAKE_ASSERT(context.num_discrete_state_groups() == 1);
+  DRAKE_ASSERT(context.num_discrete_state_groups() >= 1);
   const systems::BasicVector<T>& discrete_state_vector =
-      context.get_discrete_state(0);  // Only q and v.
+      context.get_discrete_state(0);  // Group 0 stores q and v.
   DRAKE_ASSERT(discrete_state_vector.size() ==
                num_positions() + num_velocities());
   return discrete_state_vector.get_value();
@@ -592,9 +592,9 @@ MultibodyTree<T>::get_mutable_discrete_state_vector(
     systems::Context<T>* context) const {
   DRAKE_ASSERT(context != nullptr);
   DRAKE_ASSERT(is_state_discrete());
-  DRAKE_ASSERT(context->num_discrete_state_groups() == 1);
+  DRAKE_ASSERT(context->num_discrete_state_groups() >= 1);
   systems::BasicVector<T>& discrete_state_vector =
-      context->get_mutable_discrete_state(0);  // Only q and v.
+      context->get_mutable_discrete_state(0);  // Group 0 stores q and v.
   DRAKE_ASSERT(discrete_state_vector.size() ==
                num_positions() + num_velocities());
   return discrete_state_vector.get_mutable_value();
@@ -606,9 +606,9 @@ MultibodyTree<T>::get_mutable_discrete_state_vector(
     systems::State<T>* state) const {
   DRAKE_ASSERT(state != nullptr);
   DRAKE_ASSERT(is_state_discrete());
-  DRAKE_ASSERT(state->get_discrete_state().num_groups() == 1);
+  DRAKE_ASSERT(state->get_discrete_state().num_groups() >= 1);
   systems::BasicVector<T>& discrete_state_vector =
-      state->get_mutable_discrete_state(0);  // Only q and v.
+      state->get_mutable_discrete_state(0);  // Group 0 stores q and v.
   DRAKE_ASSERT(discrete_state_vector.size() ==
       num_positions() + num_velocities());
   return discrete_state_vector.get_mutable_value();
@@ -1,5 +1,6 @@
 #include "drake/multibody/tree/multibody_tree.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -1103,6 +1104,43 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   }
 }
 
+template <typename T>
+MassMatrixFactorization<T> MultibodyTree<T>::CalcMassMatrixFactorization(
+    const systems::Context<T>& context) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  const int nv = num_velocities();
+  MatrixX<T> M(nv, nv);
+  CalcMassMatrix(context, &M);
+  return MassMatrixFactorization<T>(std::move(M), CalcVelocityParents());
+}
+
+template <typename T>
+std::vector<int> MultibodyTree<T>::CalcVelocityParents() const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  // The parent of the first velocity of a node is the last velocity of its
+  // closest inboard node with velocities (welds have none). Nodes are ordered
+  // base to tip and so are their velocities.
+  std::vector<int> parents(num_velocities(), -1);
+  for (BodyNodeIndex node_index(1); node_index < num_bodies(); ++node_index) {
+    const BodyNode<T>& node = *body_nodes_[node_index];
+    const int nm = node.get_num_mobilizer_velocities();
+    if (nm == 0) continue;
+    // The world's node has no velocities and no parent.
+    const BodyNode<T>* inboard_node = node.parent_body_node();
+    while (inboard_node->get_num_mobilizer_velocities() == 0 &&
+           inboard_node->parent_body_node() != nullptr) {
+      inboard_node = inboard_node->parent_body_node();
+    }
+    const int start = node.velocity_start();
+    if (inboard_node->get_num_mobilizer_velocities() > 0) {
+      parents[start] = inboard_node->velocity_start() +
+                       inboard_node->get_num_mobilizer_velocities() - 1;
+    }
+    for (int i = 1; i < nm; ++i) parents[start + i] = start + i - 1;
+  }
+  return parents;
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(
     const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const {
@@ -1129,6 +1167,240 @@ VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
   return VectorX<T>::Zero(num_velocities());
 }
 
+namespace {
+
+// Computes the spatial cross product m1 × m2 of two spatial motion vectors,
+// both about the same point and expressed in the same frame.
+template <typename T>
+Vector6<T> CrossMotion(const Vector6<T>& m1, const Vector6<T>& m2) {
+  const auto w1 = m1.template head<3>();
+  const auto v1 = m1.template tail<3>();
+  const auto w2 = m2.template head<3>();
+  const auto v2 = m2.template tail<3>();
+  Vector6<T> result;
+  result << w1.cross(w2), w1.cross(v2) + v1.cross(w2);
+  return result;
+}
+
+// Computes the spatial cross product m ×* f of a spatial motion vector m with
+// a spatial force vector f, both about the same point and expressed in the
+// same frame.
+template <typename T>
+Vector6<T> CrossForce(const Vector6<T>& m, const Vector6<T>& f) {
+  const auto w = m.template head<3>();
+  const auto v = m.template tail<3>();
+  const auto n = f.template head<3>();
+  const auto k = f.template tail<3>();
+  Vector6<T> result;
+  result << w.cross(n) + v.cross(k), w.cross(k);
+  return result;
+}
+
+}  // namespace
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  ThrowIfDynamicsDerivativesNotSupported(__func__);
+  const int nv = num_velocities();
+  DRAKE_DEMAND(known_vdot.size() == nv);
+  DRAKE_DEMAND(dtau_dq != nullptr);
+  DRAKE_DEMAND(dtau_dq->rows() == nv && dtau_dq->cols() == num_positions());
+  DRAKE_DEMAND(dtau_dv != nullptr);
+  DRAKE_DEMAND(dtau_dv->rows() == nv && dtau_dv->cols() == nv);
+
+  // This method differentiates the recursive Newton-Euler algorithm along the
+  // lines of [Carpentier 2018]. Since every mobilizer has fixed screw axes
+  // (and therefore q̇ = v, with nq = nv), the algorithm is simplest when all
+  // spatial quantities are taken about the world origin Wo and expressed in
+  // the world frame W (i.e., in Plücker coordinates). With that choice:
+  // - The hinge matrix column Sₖ (about Wo) of the k-th generalized velocity
+  //   moves rigidly with the body on which its mobilizer's inboard frame is
+  //   fixed. Therefore ∂Sₖ/∂qᵢ = Sᵢ × Sₖ if qᵢ belongs to a mobilizer inboard
+  //   of Sₖ's mobilizer and zero otherwise.
+  // - Similarly, the spatial inertia I_B (about Wo) of body B changes as
+  //   ∂I_B/∂qᵢ = Sᵢ ×* I_B - I_B Sᵢ× if qᵢ belongs to a mobilizer on the path
+  //   from the world to B (including B's own inboard mobilizer).
+  // - The Newton-Euler recursion itself reads:
+  //     V_B = V_P + ∑ₖ Sₖ vₖ,
+  //     A_B = A_P + ∑ₖ (Sₖ v̇ₖ + V_B × Sₖ vₖ),
+  //     f_B = I_B A_B + V_B ×* I_B V_B,
+  //     F_B = f_B + ∑ F_C,  τₖ = Sₖᵀ F_B,
+  //   where the sums over k are over the mobilizer of body B with parent P,
+  //   the sum over C is over B's children and gravity is included with the
+  //   fictitious acceleration A_W = [0; -g] of the world.
+  // We differentiate each of these expressions with respect to q and v, one
+  // column per generalized coordinate, during the same base-to-tip and
+  // tip-to-base passes that evaluate them.
+  //
+  // - [Carpentier 2018] Carpentier, J. and Mansard, N., 2018. Analytical
+  //   derivatives of rigid body dynamics algorithms. In Robotics: Science and
+  //   Systems.
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
+  const std::vector<SpatialInertia<T>>& M_B_W_cache =
+      EvalSpatialInertiaInWorldCache(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const auto v = get_velocities(context);
+
+  // Per body node quantities, all about Wo and expressed in W. The 6 x nv
+  // matrices store one partial derivative per column. X_dq accumulates the
+  // hinge matrix columns of all mobilizers from the world to each body, i.e.
+  // column i of X_dq is the rigid motion of the body due to a change in qᵢ.
+  const int num_nodes = num_bodies();
+  const Matrix6X<T> zero = Matrix6X<T>::Zero(6, nv);
+  std::vector<Matrix6<T>> I_W(num_nodes);
+  std::vector<Vector6<T>> V_W(num_nodes, Vector6<T>::Zero());
+  std::vector<Vector6<T>> A_W(num_nodes, Vector6<T>::Zero());
+  std::vector<Vector6<T>> F_W(num_nodes, Vector6<T>::Zero());
+  std::vector<Matrix6X<T>> X_dq(num_nodes, zero);
+  std::vector<Matrix6X<T>> V_dq(num_nodes, zero), V_dv(num_nodes, zero);
+  std::vector<Matrix6X<T>> A_dq(num_nodes, zero), A_dv(num_nodes, zero);
+  std::vector<Matrix6X<T>> F_dq(num_nodes, zero), F_dv(num_nodes, zero);
+  // Hinge matrix columns and their derivatives, one per generalized velocity.
+  std::vector<Vector6<T>> S_W(nv);
+  std::vector<Matrix6X<T>> S_dq(nv);
+
+  const Vector3<T> g_W =
+      gravity_field_
+          ? Vector3<T>(gravity_field_->gravity_vector().template cast<T>())
+          : Vector3<T>::Zero();
+  A_W[world_body().node_index()].template tail<3>() = -g_W;
+
+  // Base-to-tip recursion, skipping the world.
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[node_index];
+      const BodyNodeIndex parent_index = node.parent_body_node()->index();
+      const int start = node.velocity_start();
+      const int nm = node.get_num_mobilizer_velocities();
+      const Vector3<T> p_BoWo_W = -pc.get_X_WB(node_index).translation();
+
+      I_W[node_index] =
+          M_B_W_cache[node_index].Shift(p_BoWo_W).CopyToFullMatrix6();
+      V_W[node_index] = vc.get_V_WB(node_index).Shift(p_BoWo_W).get_coeffs();
+      A_W[node_index] = A_W[parent_index];
+      X_dq[node_index] = X_dq[parent_index];
+      V_dq[node_index] = V_dq[parent_index];
+      V_dv[node_index] = V_dv[parent_index];
+      A_dq[node_index] = A_dq[parent_index];
+      A_dv[node_index] = A_dv[parent_index];
+
+      // Shift all hinge matrix columns of this node from Bo to Wo at once.
+      if (nm > 0) {
+        Eigen::Map<Matrix6X<T>> S_B_W(S_W[start].data(), 6, nm);
+        SpatialVelocity<T>::Shift(node.GetJacobianFromArray(H_PB_W_cache),
+                                  p_BoWo_W, &S_B_W);
+      }
+      for (int k = start; k < start + nm; ++k) {
+        S_dq[k].resize(6, nv);
+        for (int i = 0; i < nv; ++i) {
+          S_dq[k].col(i) = CrossMotion<T>(X_dq[parent_index].col(i), S_W[k]);
+        }
+        X_dq[node_index].col(k) = S_W[k];
+        V_dq[node_index] += S_dq[k] * v[k];
+        V_dv[node_index].col(k) += S_W[k];
+      }
+
+      const Vector6<T>& V = V_W[node_index];
+      for (int k = start; k < start + nm; ++k) {
+        A_W[node_index] +=
+            S_W[k] * known_vdot[k] + CrossMotion<T>(V, S_W[k]) * v[k];
+        for (int i = 0; i < nv; ++i) {
+          A_dq[node_index].col(i) +=
+              S_dq[k].col(i) * known_vdot[k] +
+              (CrossMotion<T>(V_dq[node_index].col(i), S_W[k]) +
+               CrossMotion<T>(V, S_dq[k].col(i))) * v[k];
+          A_dv[node_index].col(i) +=
+              CrossMotion<T>(V_dv[node_index].col(i), S_W[k]) * v[k];
+        }
+        A_dv[node_index].col(k) += CrossMotion<T>(V, S_W[k]);
+      }
+
+      // Newton-Euler equations for the body, and their derivatives.
+      const Matrix6<T>& I = I_W[node_index];
+      const Vector6<T>& A = A_W[node_index];
+      const Vector6<T> IV = I * V;
+      F_W[node_index] = I * A + CrossForce<T>(V, IV);
+      for (int i = 0; i < nv; ++i) {
+        // The change of I along the rigid motion X_dq.col(i) of the body,
+        // applied to a given spatial motion vector.
+        const Vector6<T> X = X_dq[node_index].col(i);
+        auto I_dq_times = [&I, &X](const Vector6<T>& m) -> Vector6<T> {
+          return CrossForce<T>(X, I * m) - I * CrossMotion<T>(X, m);
+        };
+        const Vector6<T> dV_dq = V_dq[node_index].col(i);
+        const Vector6<T> dV_dv = V_dv[node_index].col(i);
+        F_dq[node_index].col(i) =
+            I_dq_times(A) + I * A_dq[node_index].col(i) +
+            CrossForce<T>(dV_dq, IV) +
+            CrossForce<T>(V, I_dq_times(V) + I * dV_dq);
+        F_dv[node_index].col(i) = I * A_dv[node_index].col(i) +
+                                  CrossForce<T>(dV_dv, IV) +
+                                  CrossForce<T>(V, I * dV_dv);
+      }
+    }
+  }
+
+  // Tip-to-base recursion, skipping the world.
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[node_index];
+      const BodyNodeIndex parent_index = node.parent_body_node()->index();
+      const int start = node.velocity_start();
+      const int nm = node.get_num_mobilizer_velocities();
+      // At this point F_W, F_dq and F_dv for this node already include the
+      // contributions of all outboard bodies.
+      for (int k = start; k < start + nm; ++k) {
+        dtau_dq->row(k) = F_W[node_index].transpose() * S_dq[k] +
+                          S_W[k].transpose() * F_dq[node_index];
+        dtau_dv->row(k) = S_W[k].transpose() * F_dv[node_index];
+      }
+      F_W[parent_index] += F_W[node_index];
+      F_dq[parent_index] += F_dq[node_index];
+      F_dv[parent_index] += F_dv[node_index];
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& tau_applied,
+    EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+    EigenPtr<MatrixX<T>> dvdot_dv) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  ThrowIfDynamicsDerivativesNotSupported(__func__);
+  const int nv = num_velocities();
+  DRAKE_DEMAND(tau_applied.size() == nv);
+  DRAKE_DEMAND(vdot != nullptr);
+  DRAKE_DEMAND(vdot->size() == nv);
+  DRAKE_DEMAND(dvdot_dq != nullptr);
+  DRAKE_DEMAND(dvdot_dq->rows() == nv && dvdot_dq->cols() == num_positions());
+  DRAKE_DEMAND(dvdot_dv != nullptr);
+  DRAKE_DEMAND(dvdot_dv->rows() == nv && dvdot_dv->cols() == nv);
+
+  // Forward dynamics solves M(q)v̇ = tau_applied + tau_g(q) - C(q, v)v.
+  // The factorization exploits the sparsity of M(q) induced by the topology.
+  const MassMatrixFactorization<T> M_factorization =
+      CalcMassMatrixFactorization(context);
+  VectorX<T> Cv(nv);
+  CalcBiasTerm(context, &Cv);
+  *vdot = M_factorization.Solve(
+      tau_applied + CalcGravityGeneralizedForces(context) - Cv);
+
+  // Differentiating tau_id(q, v, v̇(q, v)) = tau_applied, with tau_id the
+  // inverse dynamics, leads to M ∂v̇/∂x = -∂tau_id/∂x for x = q and x = v, see
+  // [Carpentier 2018].
+  CalcInverseDynamicsDerivatives(context, *vdot, dvdot_dq, dvdot_dv);
+  M_factorization.SolveInPlace(dvdot_dq);
+  M_factorization.SolveInPlace(dvdot_dv);
+  *dvdot_dq = -*dvdot_dq;
+  *dvdot_dv = -*dvdot_dv;
+}
+
 template <typename T>
 RigidTransform<T> MultibodyTree<T>::CalcRelativeTransform(
     const systems::Context<T>& context,
@@ -1144,7 +1416,7 @@ RigidTransform<T> MultibodyTree<T>::CalcRelativeTransform(
   const RigidTransform<T>& X_WB = pc.get_X_WB(B.node_index());
   const RigidTransform<T> X_WF = X_WA * frame_F.CalcPoseInBodyFrame(context);
   const RigidTransform<T> X_WG = X_WB * frame_G.CalcPoseInBodyFrame(context);
-  return X_WF.inverse() * X_WG;  // X_FG = X_FW * X_WG;
+  return X_WF.InvertAndCompose(X_WG);  // X_FG = X_FW * X_WG;
 }
 
 template <typename T>
@@ -1164,7 +1436,7 @@ RotationMatrix<T> MultibodyTree<T>::CalcRelativeRotationMatrix(
   const RotationMatrix<T> R_BG = frame_G.CalcRotationMatrixInBodyFrame(context);
   const RotationMatrix<T> R_WF = R_WA * R_AF;
   const RotationMatrix<T> R_WG = R_WB * R_BG;
-  return R_WF.inverse() * R_WG;  // R_FG = R_FW * R_WG;
+  return R_WF.InvertAndCompose(R_WG);  // R_FG = R_FW * R_WG;
 }
 
 template <typename T>
@@ -1786,6 +2058,155 @@ void MultibodyTree<T>::CalcJacobianTranslationalVelocity(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcSparsePointsJacobians(
+    const systems::Context<T>& context,
+    const JacobianWrtVariable with_respect_to,
+    const std::vector<PointsOnFrame<T>>& points,
+    const Frame<T>& frame_A,
+    const Frame<T>& frame_E,
+    std::vector<SparsePointsJacobian<T>>* jacobians) const {
+  DRAKE_THROW_UNLESS(jacobians != nullptr);
+  for (const PointsOnFrame<T>& points_on_B : points) {
+    DRAKE_THROW_UNLESS(points_on_B.frame_B != nullptr);
+  }
+  jacobians->resize(points.size());
+  if (points.empty()) return;
+
+  const bool is_wrt_qdot = (with_respect_to == JacobianWrtVariable::kQDot);
+
+  // The kinematics, the hinge matrices, the pose of frame E and the path from
+  // frame A to the world are shared by all entries and evaluated only once.
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const bool is_E_world = frame_E.index() == world_frame().index();
+  const RotationMatrix<T> R_EW =
+      is_E_world ? RotationMatrix<T>()
+                 : CalcRelativeRotationMatrix(context, frame_E, world_frame());
+  std::vector<BodyNodeIndex> path_A;
+  topology_.GetKinematicPathToWorld(frame_A.body().node_index(), &path_A);
+
+  // When 𝑠 = q̇, the mapping v = N⁺(q)⋅q̇ of each node is computed the first
+  // time the node is visited.
+  using NplusMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, 0, 6, 7>;
+  std::vector<NplusMatrix> Nplus_cache(is_wrt_qdot ? num_bodies() : 0);
+  std::vector<bool> is_Nplus_cached(Nplus_cache.size(), false);
+
+  // Scratch storage reused across entries.
+  std::vector<BodyNodeIndex> path_B;
+  // The nodes on the path from A to B, paired with `true` for the nodes that
+  // are outboard of the common ancestor of A and B towards B.
+  std::vector<std::pair<BodyNodeIndex, bool>> path_AB;
+  Matrix3X<T> p_WoBi_W;
+
+  const auto start_in_s = [&](BodyNodeIndex node_index) {
+    const BodyNodeTopology& node_topology =
+        body_nodes_[node_index]->get_topology();
+    return is_wrt_qdot ? node_topology.mobilizer_positions_start
+                       : node_topology.mobilizer_velocities_start_in_v;
+  };
+  const auto num_in_s = [&](BodyNodeIndex node_index) {
+    const BodyNodeTopology& node_topology =
+        body_nodes_[node_index]->get_topology();
+    return is_wrt_qdot ? node_topology.num_mobilizer_positions
+                       : node_topology.num_mobilizer_velocities;
+  };
+
+  for (size_t k = 0; k < points.size(); ++k) {
+    const Frame<T>& frame_B = *points[k].frame_B;
+    const Matrix3X<T>& p_BoBi_B = points[k].p_BoBi_B;
+    const int num_points = p_BoBi_B.cols();
+    SparsePointsJacobian<T>& jacobian = (*jacobians)[k];
+
+    // The mobilizers inboard of the closest common ancestor of A and B move
+    // points Bi and the coincident points Ai in the same way. Their
+    // contributions to v_ABi = v_WBi - v_WAi cancel exactly and are skipped.
+    topology_.GetKinematicPathToWorld(frame_B.body().node_index(), &path_B);
+    size_t num_common = 1;  // The world is always common.
+    while (num_common < path_A.size() && num_common < path_B.size() &&
+           path_A[num_common] == path_B[num_common]) {
+      ++num_common;
+    }
+    path_AB.clear();
+    for (size_t i = num_common; i < path_B.size(); ++i) {
+      if (num_in_s(path_B[i]) > 0) path_AB.emplace_back(path_B[i], true);
+    }
+    for (size_t i = num_common; i < path_A.size(); ++i) {
+      if (num_in_s(path_A[i]) > 0) path_AB.emplace_back(path_A[i], false);
+    }
+    std::sort(path_AB.begin(), path_AB.end(),
+              [&](const auto& a, const auto& b) {
+                return start_in_s(a.first) < start_in_s(b.first);
+              });
+
+    int num_columns = 0;
+    for (const auto& [node_index, is_towards_B] : path_AB) {
+      num_columns += num_in_s(node_index);
+    }
+    jacobian.columns.resize(num_columns);
+    jacobian.Js_w_AB_E.resize(3, num_columns);
+    jacobian.Js_v_ABi_E.resize(3 * num_points, num_columns);
+
+    p_WoBi_W = frame_B.CalcPoseInWorld(context) * p_BoBi_B;
+
+    int column = 0;
+    for (const auto& [node_index, is_towards_B] : path_AB) {
+      const BodyNode<T>& node = *body_nodes_[node_index];
+      const int start = start_in_s(node_index);
+      const int num_node_columns = num_in_s(node_index);
+      for (int j = 0; j < num_node_columns; ++j) {
+        jacobian.columns[column + j] = start + j;
+      }
+
+      // Herein P designates the inboard (parent) body frame P and Bn the body
+      // of the current node.
+      Eigen::Map<const MatrixUpTo6<T>> H_PBn_W =
+          node.GetJacobianFromArray(H_PB_W_cache);
+      const auto Hw_PBn_W = H_PBn_W.template topRows<3>();
+      const auto Hv_PBn_W = H_PBn_W.template bottomRows<3>();
+      if (is_wrt_qdot && !is_Nplus_cached[node_index]) {
+        NplusMatrix& Nplus = Nplus_cache[node_index];
+        Nplus.resize(node.get_num_mobilizer_velocities(), num_node_columns);
+        node.get_mobilizer().CalcNplusMatrix(context, &Nplus);
+        is_Nplus_cached[node_index] = true;
+      }
+
+      // The nodes towards B contribute to v_WBi and those towards A to -v_WAi.
+      const T sign = is_towards_B ? 1.0 : -1.0;
+      auto Js_w_PBn = jacobian.Js_w_AB_E.middleCols(column, num_node_columns);
+      if (is_wrt_qdot) {
+        Js_w_PBn = sign * Hw_PBn_W * Nplus_cache[node_index];
+      } else {
+        Js_w_PBn = sign * Hw_PBn_W;
+      }
+
+      const Vector3<T>& p_WoBno = pc.get_X_WB(node.index()).translation();
+      for (int ipoint = 0; ipoint < num_points; ++ipoint) {
+        const Vector3<T> p_BnoBi_W = p_WoBi_W.col(ipoint) - p_WoBno;
+        auto Js_v_PBi = jacobian.Js_v_ABi_E.block(3 * ipoint, column, 3,
+                                                  num_node_columns);
+        if (is_wrt_qdot) {
+          Js_v_PBi = sign * (Hv_PBn_W + Hw_PBn_W.colwise().cross(p_BnoBi_W)) *
+                     Nplus_cache[node_index];
+        } else {
+          Js_v_PBi = sign * (Hv_PBn_W + Hw_PBn_W.colwise().cross(p_BnoBi_W));
+        }
+      }
+      column += num_node_columns;
+    }
+
+    // Re-express the Jacobians in frame E.
+    if (!is_E_world) {
+      jacobian.Js_w_AB_E = R_EW * jacobian.Js_w_AB_E;
+      for (int ipoint = 0; ipoint < num_points; ++ipoint) {
+        auto Js_v_ABi = jacobian.Js_v_ABi_E.middleRows(3 * ipoint, 3);
+        Js_v_ABi = R_EW * Js_v_ABi;
+      }
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
     const systems::Context<T>& context,
@@ -2071,6 +2492,20 @@ void MultibodyTree<T>::ThrowIfNotFinalized(const char* source_method) const {
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::ThrowIfDynamicsDerivativesNotSupported(
+    const char* source_method) const {
+  for (const auto& mobilizer : owned_mobilizers_) {
+    if (!mobilizer->has_fixed_screw_axes()) {
+      throw std::logic_error(
+          std::string(source_method) + "(): the inboard mobilizer of body '" +
+          mobilizer->outboard_body().name() + "' is not supported. "
+          "Analytical dynamics derivatives are only available for models "
+          "whose joints are all revolute, prismatic or weld joints.");
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
     const systems::Context<T>& context,
@@ -2193,6 +2628,18 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+    const systems::Context<T>& context, const MultibodyForces<T>& forces,
+    AccelerationKinematicsCache<T>* ac) const {
+  DRAKE_THROW_UNLESS(ac != nullptr);
+  DRAKE_THROW_UNLESS(forces.CheckHasRightSizeForModel(*this));
+  // TODO(amcastro-tri): Heap allocation here. Get rid of it.
+  ArticulatedBodyForceCache<T> aba_force_cache(get_topology());
+  CalcArticulatedBodyForceCache(context, forces, &aba_force_cache);
+  CalcArticulatedBodyAccelerations(context, aba_force_cache, ac);
+}
+
 template <typename T>
 MatrixX<double> MultibodyTree<T>::MakeStateSelectorMatrix(
     const std::vector<JointIndex>& user_to_joint_index_map) const {
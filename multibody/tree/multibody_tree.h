@@ -21,6 +21,7 @@
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
@@ -49,6 +50,36 @@ enum class JacobianWrtVariable {
   kV      ///< J = ∂V/∂v
 };
 
+/// A list of points Bi fixed to a frame B, for which a batch of Jacobians is
+/// computed by MultibodyPlant::CalcSparsePointsJacobians().
+template <typename T>
+struct PointsOnFrame {
+  /// The frame B on which the points Bi are fixed. It must not be nullptr.
+  const Frame<T>* frame_B{nullptr};
+  /// The position vectors from Bo (frame B's origin) to the points Bi,
+  /// expressed in frame B, one per column.
+  Matrix3X<T> p_BoBi_B;
+};
+
+/// The Jacobians of a list of points Bi fixed to a frame B, as computed by
+/// MultibodyPlant::CalcSparsePointsJacobians(). Only the columns of the
+/// Jacobians that are not structurally zero are stored; these are the columns
+/// for the speeds 𝑠 of the mobilizers on the kinematic path between the
+/// measured-in frame A and frame B. Column k of `Js_w_AB_E` and
+/// `Js_v_ABi_E` corresponds to column `columns[k]` of the full Jacobians.
+template <typename T>
+struct SparsePointsJacobian {
+  /// The indices of the stored columns in 𝑠, in increasing order.
+  std::vector<int> columns;
+  /// The stored columns of J𝑠_w_AB_E, frame B's angular velocity Jacobian in
+  /// frame A, expressed in frame E. Its size is `3 x columns.size()`.
+  Matrix3X<T> Js_w_AB_E;
+  /// The stored columns of J𝑠_v_ABi_E, the points Bi's translational velocity
+  /// Jacobian in frame A, expressed in frame E. Its size is
+  /// `3*p x columns.size()`, where p is the number of points Bi.
+  MatrixX<T> Js_v_ABi_E;
+};
+
 /// @cond
 // Helper macro to throw an exception within methods that should not be called
 // post-finalize.
@@ -1421,6 +1452,15 @@ class MultibodyTree {
       const Frame<T>& frame_E,
       EigenPtr<MatrixX<T>> Js_v_ABi_E) const;
 
+  /// See MultibodyPlant method.
+  void CalcSparsePointsJacobians(
+      const systems::Context<T>& context,
+      JacobianWrtVariable with_respect_to,
+      const std::vector<PointsOnFrame<T>>& points,
+      const Frame<T>& frame_A,
+      const Frame<T>& frame_E,
+      std::vector<SparsePointsJacobian<T>>* jacobians) const;
+
   /// See MultibodyPlant method.
   void CalcJacobianCenterOfMassTranslationalVelocity(
       const systems::Context<T>& context, JacobianWrtVariable with_respect_to,
@@ -1762,6 +1802,16 @@ class MultibodyTree {
   void CalcMassMatrix(const systems::Context<T>& context,
                       EigenPtr<MatrixX<T>> M) const;
 
+  /// See MultibodyPlant method.
+  MassMatrixFactorization<T> CalcMassMatrixFactorization(
+      const systems::Context<T>& context) const;
+
+  /// Returns the parent of each generalized velocity in the tree topology, as
+  /// described by MassMatrixFactorization. This only depends on the topology
+  /// of the model.
+  /// @throws std::exception if called pre-finalize.
+  std::vector<int> CalcVelocityParents() const;
+
   /// See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
@@ -1770,6 +1820,17 @@ class MultibodyTree {
   VectorX<T> CalcGravityGeneralizedForces(
       const systems::Context<T>& context) const;
 
+  /// See MultibodyPlant method.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv) const;
+
+  /// See MultibodyPlant method.
+  void CalcForwardDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& tau_applied,
+      EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+      EigenPtr<MatrixX<T>> dvdot_dv) const;
+
   /// See MultibodyPlant method.
   void MapVelocityToQDot(
       const systems::Context<T>& context,
@@ -2058,6 +2119,20 @@ class MultibodyTree {
     const ArticulatedBodyForceCache<T>& aba_force_cache,
     AccelerationKinematicsCache<T>* ac) const;
 
+  /// Computes the generalized accelerations for the state stored in `context`
+  /// and the given applied `forces` with the Articulated Body Algorithm, into
+  /// `ac`. Unlike MultibodyTreeSystem::EvalForwardDynamics(), only `forces` are
+  /// applied; forces from force elements or other sources are not added.
+  /// The articulated body inertias, which only depend on q, and the
+  /// velocity-dependent force bias terms are evaluated from the cache in
+  /// `context`. Therefore repeated calls with the same `context` but different
+  /// `forces` (e.g. within the iterations of an implicit scheme) only perform
+  /// the last two passes of the algorithm, see
+  /// CalcArticulatedBodyForceCache() and CalcArticulatedBodyAccelerations().
+  void CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+      const systems::Context<T>& context, const MultibodyForces<T>& forces,
+      AccelerationKinematicsCache<T>* ac) const;
+
   /// For a body B, computes the spatial acceleration bias term `Ab_WB` as it
   /// appears in the acceleration level motion constraint imposed by body B's
   /// mobilizer `A_WB = Aplus_WB + Ab_WB + H_PB_W * vdot_B`, with `Aplus_WB =
@@ -2647,6 +2722,12 @@ class MultibodyTree {
   // that the error message can include that detail.
   void ThrowIfNotFinalized(const char* source_method) const;
 
+  // Helper method for throwing an exception within the analytical dynamics
+  // derivatives methods when some mobilizer in the model does not have fixed
+  // screw axes, see Mobilizer::has_fixed_screw_axes(). The invoking method
+  // should pass its name so that the error message can include that detail.
+  void ThrowIfDynamicsDerivativesNotSupported(const char* source_method) const;
+
   // Evaluates the cache entry stored in context with the spatial inertias
   // M_Bo_W(q) for each body in the system. These will be updated as needed.
   const std::vector<SpatialInertia<T>>& EvalSpatialInertiaInWorldCache(
@@ -1,6 +1,7 @@
 #include "drake/multibody/tree/multibody_tree_system.h"
 
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -92,21 +93,41 @@ MultibodyTree<T>& MultibodyTreeSystem<T>::mutable_tree() const {
 
 template <typename T>
 void MultibodyTreeSystem<T>::DeclareMultibodyElementParameters() {
+  // MultibodyElement only declares numeric parameters, and those declared by
+  // each kind of element are consecutive.
+  auto add_tickets_since =
+      [this](int first_parameter,
+             std::set<systems::DependencyTicket>* tickets) {
+        for (int i = first_parameter; i < this->num_numeric_parameter_groups();
+             ++i) {
+          tickets->insert(this->numeric_parameter_ticket(
+              systems::NumericParameterIndex(i)));
+        }
+      };
+  kinematics_parameter_tickets_.clear();
+  body_parameter_tickets_.clear();
+
   // Joints.
+  int first_parameter = this->num_numeric_parameter_groups();
   for (JointIndex joint_index(0); joint_index < tree_->num_joints();
        ++joint_index) {
     mutable_tree().get_mutable_joint(joint_index).DeclareParameters(this);
   }
+  add_tickets_since(first_parameter, &kinematics_parameter_tickets_);
   // Bodies.
+  first_parameter = this->num_numeric_parameter_groups();
   for (BodyIndex body_index(0); body_index < tree_->num_bodies();
        ++body_index) {
     mutable_tree().get_mutable_body(body_index).DeclareParameters(this);
   }
+  add_tickets_since(first_parameter, &body_parameter_tickets_);
   // Frames.
+  first_parameter = this->num_numeric_parameter_groups();
   for (FrameIndex frame_index(0); frame_index < tree_->num_frames();
        ++frame_index) {
     mutable_tree().get_mutable_frame(frame_index).DeclareParameters(this);
   }
+  add_tickets_since(first_parameter, &kinematics_parameter_tickets_);
   // Force Elements.
   for (ForceElementIndex force_element_index(0);
        force_element_index < tree_->num_force_elements();
@@ -139,29 +160,56 @@ void MultibodyTreeSystem<T>::Finalize() {
                                  0 /* num_z */);
   }
 
-  // TODO(joemasterjohn): Create more granular parameter tickets for finer
-  // control over cache dependencies on parameters. For example,
-  // all_rigid_body_parameters, etc.
+  // The position and velocity kinematics only depend on the generalized
+  // positions q and velocities v and on the parameters of the joints and
+  // frames, and so does every cache entry computed from them. We state these
+  // prerequisites explicitly rather than through configuration_ticket() and
+  // kinematics_ticket(), which also include the accuracy, the miscellaneous
+  // continuous state z, all discrete and abstract state and all parameters.
+  // In discrete mode q and v are stored in a single discrete state group, so
+  // that they cannot be told apart. The mass properties additionally depend
+  // on the parameters of the bodies.
+  const systems::DependencyTicket positions_ticket =
+      is_discrete_ ? this->xd_ticket() : this->q_ticket();
+  const systems::DependencyTicket velocities_ticket =
+      is_discrete_ ? this->xd_ticket() : this->v_ticket();
 
   // Allocate position cache.
+  std::set<systems::DependencyTicket> position_kinematics_prerequisites =
+      kinematics_parameter_tickets_;
+  position_kinematics_prerequisites.insert(positions_ticket);
   cache_indexes_.position_kinematics = this->DeclareCacheEntry(
       std::string("position kinematics"),
       PositionKinematicsCache<T>(internal_tree().get_topology()),
       &MultibodyTreeSystem<T>::CalcPositionKinematicsCache,
-      {this->configuration_ticket()}).cache_index();
+      position_kinematics_prerequisites).cache_index();
 
   // Allocate cache entry to store spatial inertia M_B_W(q) for each body.
+  std::set<systems::DependencyTicket> spatial_inertia_prerequisites =
+      body_parameter_tickets_;
+  spatial_inertia_prerequisites.insert(
+      position_kinematics_cache_entry().ticket());
   cache_indexes_.spatial_inertia_in_world = this->DeclareCacheEntry(
       std::string("spatial inertia in world (M_B_W)"),
       std::vector<SpatialInertia<T>>(internal_tree().num_bodies()),
       &MultibodyTreeSystem<T>::CalcSpatialInertiasInWorld,
-      {position_kinematics_cache_entry().ticket()}).cache_index();
+      spatial_inertia_prerequisites).cache_index();
 
   // Allocate cache entry for composite-body inertias Mc_B_W(q) for each body.
   cache_indexes_.composite_body_inertia_in_world = this->DeclareCacheEntry(
       std::string("composite body inertia in world (Mc_B_W)"),
       std::vector<SpatialInertia<T>>(internal_tree().num_bodies()),
       &MultibodyTreeSystem<T>::CalcCompositeBodyInertiasInWorld,
+      {position_kinematics_cache_entry().ticket(),
+       this->cache_entry_ticket(cache_indexes_.spatial_inertia_in_world)})
+      .cache_index();
+
+  // Declare cache entry for H_PB_W(q).
+  // The type of this cache value is std::vector<Vector6<T>>.
+  cache_indexes_.across_node_jacobians = this->DeclareCacheEntry(
+      std::string("H_PB_W(q)"),
+      std::vector<Vector6<T>>(internal_tree().num_velocities()),
+      &MultibodyTreeSystem<T>::CalcAcrossNodeJacobianWrtVExpressedInWorld,
       {position_kinematics_cache_entry().ticket()}).cache_index();
 
   // Allocate velocity cache.
@@ -169,8 +217,9 @@ void MultibodyTreeSystem<T>::Finalize() {
       std::string("velocity kinematics"),
       VelocityKinematicsCache<T>(internal_tree().get_topology()),
       &MultibodyTreeSystem<T>::CalcVelocityKinematicsCache,
-      {this->kinematics_ticket()}).cache_index();
-
+      {position_kinematics_cache_entry().ticket(),
+       this->cache_entry_ticket(cache_indexes_.across_node_jacobians),
+       velocities_ticket}).cache_index();
 
   // Allocate cache entry to store Fb_Bo_W(q, v) for each body.
   cache_indexes_.dynamic_bias = this->DeclareCacheEntry(
@@ -184,32 +233,32 @@ void MultibodyTreeSystem<T>::Finalize() {
       {this->cache_entry_ticket(cache_indexes_.spatial_inertia_in_world),
        velocity_kinematics_cache_entry().ticket()}).cache_index();
 
-  // Declare cache entry for H_PB_W(q).
-  // The type of this cache value is std::vector<Vector6<T>>.
-  cache_indexes_.across_node_jacobians = this->DeclareCacheEntry(
-      std::string("H_PB_W(q)"),
-      std::vector<Vector6<T>>(internal_tree().num_velocities()),
-      &MultibodyTreeSystem<T>::CalcAcrossNodeJacobianWrtVExpressedInWorld,
-      {position_kinematics_cache_entry().ticket()}).cache_index();
-
-  // Allocate articulated body inertia cache.
+  // Allocate articulated body inertia cache. It only depends on q, so that it
+  // is reused by all evaluations of the ABA at the same configuration, with
+  // different velocities or applied forces.
   cache_indexes_.abi_cache_index = this->DeclareCacheEntry(
       std::string("Articulated Body Inertia"),
       ArticulatedBodyInertiaCache<T>(internal_tree().get_topology()),
       &MultibodyTreeSystem<T>::CalcArticulatedBodyInertiaCache,
-      {this->configuration_ticket()}).cache_index();
+      {position_kinematics_cache_entry().ticket(),
+       this->cache_entry_ticket(cache_indexes_.across_node_jacobians),
+       this->cache_entry_ticket(cache_indexes_.spatial_inertia_in_world)})
+      .cache_index();
 
   cache_indexes_.spatial_acceleration_bias = this->DeclareCacheEntry(
       std::string("spatial acceleration bias (Ab_WB)"),
       std::vector<SpatialAcceleration<T>>(internal_tree().num_bodies()),
       &MultibodyTreeSystem<T>::CalcSpatialAccelerationBias,
-      {this->kinematics_ticket()}).cache_index();
+      {position_kinematics_cache_entry().ticket(),
+       velocity_kinematics_cache_entry().ticket()}).cache_index();
 
   cache_indexes_.articulated_body_force_bias = this->DeclareCacheEntry(
       std::string("ABI force bias cache (Zb_Bo_W)"),
       std::vector<SpatialForce<T>>(internal_tree().num_bodies()),
       &MultibodyTreeSystem<T>::CalcArticulatedBodyForceBias,
-      {this->kinematics_ticket()}).cache_index();
+      {this->cache_entry_ticket(cache_indexes_.abi_cache_index),
+       this->cache_entry_ticket(cache_indexes_.spatial_acceleration_bias)})
+      .cache_index();
 
   // Articulated Body Algorithm (ABA) force cache.
   cache_indexes_.articulated_body_forces = this->DeclareCacheEntry(
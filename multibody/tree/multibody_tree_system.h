@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -431,7 +432,9 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   }
 
   // This method is called during Finalize(). It tells each MultibodyElement
-  // owned by `this` system to declare their system paramters on `this`.
+  // owned by `this` system to declare their system paramters on `this`, and
+  // records their tickets in kinematics_parameter_tickets_ and
+  // body_parameter_tickets_.
   void DeclareMultibodyElementParameters();
 
   // Allow different specializations to access each other's private data for
@@ -475,6 +478,15 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   // All MultibodyTreeSystem cache indexes are stored in cache_indexes_.
   CacheIndexes cache_indexes_;
 
+  // The tickets of the parameters declared by the joints and the frames, on
+  // which the kinematics depend, and of those declared by the bodies, on which
+  // only the mass properties depend. Cache entries depend on these rather than
+  // on all the parameters, so that e.g. changing the mass of a body doesn't
+  // invalidate the poses. The parameters of the force elements are not used by
+  // any of the cache entries declared here.
+  std::set<systems::DependencyTicket> kinematics_parameter_tickets_;
+  std::set<systems::DependencyTicket> body_parameter_tickets_;
+
   // Used to enforce "finalize once" restriction for protected-API users.
   bool already_finalized_{false};
 };
@@ -455,6 +455,11 @@ class MultibodyTreeTopology {
     if (force_elements_ != other.force_elements_) return false;
     if (joint_actuators_ != other.joint_actuators_) return false;
     if (body_nodes_ != other.body_nodes_) return false;
+    if (body_node_preorder_ != other.body_node_preorder_) return false;
+    if (body_node_subtree_size_ != other.body_node_subtree_size_) return false;
+    if (body_is_anchored_ != other.body_is_anchored_) return false;
+    if (body_node_tree_ != other.body_node_tree_) return false;
+    if (tree_velocities_ != other.tree_velocities_) return false;
 
     return true;
   }
@@ -873,6 +878,9 @@ class MultibodyTreeTopology {
       }
     }
 
+    ComputeBodyNodeAncestryAndAnchoring();
+    ComputeTrees();
+
     // We are done with a successful Finalize() and we mark it as so.
     // Do not add any more code after this!
     is_valid_ = true;
@@ -930,28 +938,61 @@ class MultibodyTreeTopology {
     DRAKE_DEMAND(get_body_node((*path_to_world)[1]).level == 1);
   }
 
+  /// Returns `true` if the body node `ancestor` is in the kinematic path from
+  /// `node` to the world, i.e. if `node` is in the subtree rooted at
+  /// `ancestor`. A node is considered to be its own ancestor.
+  /// The complexity of this operation is O(1), using the depth first numbering
+  /// of the nodes computed by Finalize().
+  bool IsBodyNodeAncestorOf(BodyNodeIndex ancestor, BodyNodeIndex node) const {
+    DRAKE_DEMAND(is_valid());
+    DRAKE_ASSERT(ancestor < get_num_body_nodes());
+    DRAKE_ASSERT(node < get_num_body_nodes());
+    const int ancestor_preorder = body_node_preorder_[ancestor];
+    const int node_preorder = body_node_preorder_[node];
+    return ancestor_preorder <= node_preorder &&
+        node_preorder < ancestor_preorder + body_node_subtree_size_[ancestor];
+  }
+
+  /// Returns the number of trees in the topology. Each child body of the world
+  /// is the root of a tree which contains all of its outboard bodies, i.e. the
+  /// trees are the subtrees that remain when the world is removed. For
+  /// instance, a model with n free bodies has n trees.
+  /// The generalized velocities of different trees are not coupled by the
+  /// mass matrix, which is therefore block diagonal with one block per tree
+  /// (for a suitable permutation of the velocities), see tree_velocities().
+  int num_trees() const {
+    DRAKE_DEMAND(is_valid());
+    return static_cast<int>(tree_velocities_.size());
+  }
+
+  /// Returns the index, in [0, num_trees()), of the tree that contains the
+  /// body node `node`, or -1 for the world's node.
+  int body_node_tree(BodyNodeIndex node) const {
+    DRAKE_DEMAND(is_valid());
+    DRAKE_ASSERT(node < get_num_body_nodes());
+    return body_node_tree_[node];
+  }
+
+  /// Returns the indexes, in increasing order, of the generalized velocities
+  /// of the mobilizers of `tree` within the vector of generalized velocities
+  /// v. These are not contiguous in general, since the velocities are
+  /// assigned to the body nodes in BFT order.
+  const std::vector<int>& tree_velocities(int tree) const {
+    DRAKE_DEMAND(is_valid());
+    DRAKE_THROW_UNLESS(0 <= tree && tree < num_trees());
+    return tree_velocities_[tree];
+  }
+
   /// Returns `true` if the body with index `body_index` is anchored to the
   /// world.
   /// A body is said to be "anchored" if its kinematics path to the world only
   /// contains weld mobilizers.
-  /// The complexity of this operation is O(depth), where "depth" refers to the
-  /// depth in the tree of the body node associated with `body_index`.
+  /// The complexity of this operation is O(1), since the result is computed
+  /// for all bodies by Finalize().
   bool IsBodyAnchored(BodyIndex body_index) const {
     DRAKE_DEMAND(is_valid());
-    const BodyTopology& body = get_body(body_index);
-    std::vector<BodyNodeIndex> path_to_world;
-    GetKinematicPathToWorld(body.body_node, &path_to_world);
-    // Skip the world at path_to_world[0].
-    for (size_t path_index = 1; path_index < path_to_world.size();
-         ++path_index) {
-      const BodyNodeTopology& node = get_body_node(path_to_world[path_index]);
-      const MobilizerTopology& mobilizer = get_mobilizer(node.mobilizer);
-      // If any of the mobilizers in the path is not a weld mobilizer, the body
-      // is not anchored.
-      if (!mobilizer.is_weld_mobilizer()) return false;
-    }
-    // If the loop above completes, then body_index is anchored to the world.
-    return true;
+    DRAKE_ASSERT(body_index < num_bodies());
+    return body_is_anchored_[body_index];
   }
 
   /// This method partitions the tree topology into sub-graphs such that two
@@ -990,24 +1031,97 @@ class MultibodyTreeTopology {
  private:
   // Returns `true` if there is _any_ mobilizer in the multibody tree
   // connecting the frames with indexes `frame` and `frame2`.
+  // Since each body has at most one inboard mobilizer, such a mobilizer can
+  // only be the inboard mobilizer of the body of either frame. Therefore this
+  // check is O(1), and adding mobilizers to a model is O(n) overall.
   bool IsThereAMobilizerBetweenFrames(
       FrameIndex frame1, FrameIndex frame2) const {
-    for (const auto& mobilizer_topology : mobilizers_) {
-      if (mobilizer_topology.connects_frames(frame1, frame2)) return true;
+    for (FrameIndex frame : {frame1, frame2}) {
+      const MobilizerIndex mobilizer =
+          bodies_[frames_[frame].body].inboard_mobilizer;
+      if (mobilizer.is_valid() &&
+          mobilizers_[mobilizer].connects_frames(frame1, frame2)) {
+        return true;
+      }
     }
     return false;
   }
 
   // Returns `true` if there is _any_ mobilizer in the multibody tree
   // connecting the bodies with indexes `body2` and `body2`.
+  // As for IsThereAMobilizerBetweenFrames(), this check is O(1).
   bool IsThereAMobilizerBetweenBodies(
       BodyIndex body1, BodyIndex body2) const {
-    for (const auto& mobilizer_topology : mobilizers_) {
-      if (mobilizer_topology.connects_bodies(body1, body2)) return true;
+    for (BodyIndex body : {body1, body2}) {
+      const MobilizerIndex mobilizer = bodies_[body].inboard_mobilizer;
+      if (mobilizer.is_valid() &&
+          mobilizers_[mobilizer].connects_bodies(body1, body2)) {
+        return true;
+      }
     }
     return false;
   }
 
+  // Helper method for Finalize(), to be called once the body nodes are created.
+  // Computes the depth first (pre-order) numbering of the body nodes and the
+  // size of the subtree rooted at each node, so that IsBodyNodeAncestorOf() is
+  // O(1), as well as whether each body is anchored to the world.
+  void ComputeBodyNodeAncestryAndAnchoring() {
+    const int num_nodes = get_num_body_nodes();
+    // In BFT order the children of a node have larger indexes than their
+    // parent. Therefore the subtree sizes accumulate in a Tip-to-Base loop, and
+    // the pre-order numbers are assigned in a Base-to-Tip loop, placing the
+    // subtrees of the children of a node one after the other.
+    body_node_subtree_size_.assign(num_nodes, 1);
+    for (BodyNodeIndex node_index(num_nodes - 1); node_index > 0;
+         --node_index) {
+      body_node_subtree_size_[body_nodes_[node_index].parent_body_node] +=
+          body_node_subtree_size_[node_index];
+    }
+    body_node_preorder_.assign(num_nodes, 0);
+    body_is_anchored_.assign(num_bodies(), false);
+    body_is_anchored_[world_index()] = true;
+    for (BodyNodeIndex node_index(0); node_index < num_nodes; ++node_index) {
+      const BodyNodeTopology& node = body_nodes_[node_index];
+      int child_preorder = body_node_preorder_[node_index] + 1;
+      for (BodyNodeIndex child_index : node.child_nodes) {
+        body_node_preorder_[child_index] = child_preorder;
+        child_preorder += body_node_subtree_size_[child_index];
+        const BodyNodeTopology& child = body_nodes_[child_index];
+        body_is_anchored_[child.body] =
+            body_is_anchored_[node.body] &&
+            mobilizers_[child.mobilizer].is_weld_mobilizer();
+      }
+    }
+  }
+
+  // Helper method for Finalize(), to be called once the generalized velocities
+  // are assigned to the body nodes. Each child of the world is the root of a
+  // tree; computes the tree of each body node and the generalized velocities
+  // of each tree.
+  void ComputeTrees() {
+    const int num_nodes = get_num_body_nodes();
+    body_node_tree_.assign(num_nodes, -1);
+    tree_velocities_.clear();
+    // Base-to-Tip loop in BFT order, skipping the world. The children of the
+    // world come first.
+    for (BodyNodeIndex node_index(1); node_index < num_nodes; ++node_index) {
+      const BodyNodeTopology& node = body_nodes_[node_index];
+      int& tree = body_node_tree_[node_index];
+      if (node.parent_body_node == BodyNodeIndex(0)) {
+        tree = static_cast<int>(tree_velocities_.size());
+        tree_velocities_.emplace_back();
+      } else {
+        tree = body_node_tree_[node.parent_body_node];
+      }
+      // In BFT order the velocities are increasing, and so is each list.
+      for (int i = 0; i < node.num_mobilizer_velocities; ++i) {
+        tree_velocities_[tree].push_back(
+            node.mobilizer_velocities_start_in_v + i);
+      }
+    }
+  }
+
   // Recursive helper method for CreateListOfWeldedBodies().
   // This method scans the children of body with parent_index. If a child is
   // welded to body with parent_index, it gets added to the parent's body welded
@@ -1055,6 +1169,22 @@ class MultibodyTreeTopology {
   std::vector<JointActuatorTopology> joint_actuators_;
   std::vector<BodyNodeTopology> body_nodes_;
 
+  // Computed by Finalize() for fast topological queries. See
+  // ComputeBodyNodeAncestryAndAnchoring().
+  // The depth first (pre-order) number of each body node, indexed by
+  // BodyNodeIndex.
+  std::vector<int> body_node_preorder_;
+  // The number of nodes in the subtree rooted at each body node, including
+  // the node itself, indexed by BodyNodeIndex.
+  std::vector<int> body_node_subtree_size_;
+  // Whether each body is anchored to the world, indexed by BodyIndex.
+  std::vector<bool> body_is_anchored_;
+  // The tree of each body node, indexed by BodyNodeIndex, with -1 for the
+  // world. See ComputeTrees().
+  std::vector<int> body_node_tree_;
+  // The generalized velocities of each tree, in increasing order.
+  std::vector<std::vector<int>> tree_velocities_;
+
   // Total number of generalized positions and velocities in the MultibodyTree
   // model.
   int num_positions_{0};
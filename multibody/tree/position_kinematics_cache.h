@@ -25,6 +25,11 @@ namespace internal {
 /// - Body frame B poses X_WB measured and expressed in the world frame W.
 /// - Pose X_FM of a mobilizer's outboard frame M measured and expressed in the
 ///   inboard frame F.
+/// - The fixed offsets of each mobilizer's frames in their bodies: the pose
+///   X_MB of body frame B in the outboard frame M, and the orientation R_PF of
+///   the inboard frame F in the parent body frame P. These are computed once
+///   per position update so that the velocity and acceleration recursions
+///   need not query the frames again.
 /// - Mobilizer's matrices H_FM (with F and M defined above) that map the
 ///   mobilizer's generalized velocities v to cross-joint spatial velocities
 ///   V_FM = H_FM * v.
@@ -109,6 +114,36 @@ class PositionKinematicsCache {
     return X_FM_pool_[body_node_index];
   }
 
+  /// For the mobilizer associated with the body node indexed by
+  /// `body_node_index`, this method returns a const reference to the pose
+  /// `X_MB` of the body frame B as measured and expressed in the mobilizer's
+  /// outboard frame M.
+  const RigidTransform<T>& get_X_MB(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return X_MB_pool_[body_node_index];
+  }
+
+  /// See documentation on the const version get_X_MB() for details.
+  RigidTransform<T>& get_mutable_X_MB(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return X_MB_pool_[body_node_index];
+  }
+
+  /// For the mobilizer associated with the body node indexed by
+  /// `body_node_index`, this method returns a const reference to the rotation
+  /// matrix `R_PF` that relates the orientation of the parent body frame P to
+  /// the mobilizer's inboard frame F.
+  const math::RotationMatrix<T>& get_R_PF(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return R_PF_pool_[body_node_index];
+  }
+
+  /// See documentation on the const version get_R_PF() for details.
+  math::RotationMatrix<T>& get_mutable_R_PF(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return R_PF_pool_[body_node_index];
+  }
+
   /// Position of node B, with index `body_node_index`, measured in the inboard
   /// body frame P, expressed in the world frame W.
   const Vector3<T>& get_p_PoBo_W(BodyNodeIndex body_node_index) const {
@@ -135,6 +170,9 @@ class PositionKinematicsCache {
   // The type of pools for storing 3D vectors.
   typedef std::vector<Vector3<T>> Vector3PoolType;
 
+  // The type of pools for storing rotation matrices.
+  typedef std::vector<math::RotationMatrix<T>> R_PoolType;
+
   // Allocates resources for this position kinematics cache.
   void Allocate() {
     X_WB_pool_.resize(num_nodes_);
@@ -151,6 +189,10 @@ class PositionKinematicsCache {
     X_MB_pool_.resize(num_nodes_);
     X_MB_pool_[world_index()] = NaNPose();  // It should never be used.
 
+    // R_PF for the world body should never be used; it is left as identity
+    // since a RotationMatrix cannot hold NaNs in Debug builds.
+    R_PF_pool_.resize(num_nodes_);
+
     p_PoBo_W_pool_.resize(num_nodes_);
     // p_PoBo_W for the world body should never be used.
     p_PoBo_W_pool_[world_index()].setConstant(
@@ -175,6 +217,7 @@ class PositionKinematicsCache {
   X_PoolType X_PB_pool_;
   X_PoolType X_FM_pool_;
   X_PoolType X_MB_pool_;
+  R_PoolType R_PF_pool_;
   Vector3PoolType p_PoBo_W_pool_;
 };
 
@@ -56,6 +56,8 @@ class PrismaticMobilizer final : public MobilizerImpl<T, 1, 1> {
   /// inboard frame F.
   const Vector3<double>& translation_axis() const { return axis_F_; }
 
+  bool has_fixed_screw_axes() const final { return true; }
+
   /// Gets the translational distance for `this` mobilizer from `context`. See
   /// class documentation for sign convention details.
   /// @param[in] context The context of the MultibodyTree this mobilizer
@@ -151,6 +153,12 @@ class PrismaticMobilizer final : public MobilizerImpl<T, 1, 1> {
       const Eigen::Ref<const VectorX<T>>& qdot,
       EigenPtr<VectorX<T>> v) const final;
 
+  /// For MultibodyTree internal use only. Creates a SpecializedBodyNode, whose
+  /// recursive passes call the kinematics of this mobilizer directly.
+  std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
+      const internal::BodyNode<T>* parent_node,
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
+
  protected:
   void DoCalcNMatrix(const systems::Context<T>& context,
                      EigenPtr<MatrixX<T>> N) const final;
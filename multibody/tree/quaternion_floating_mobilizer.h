@@ -214,6 +214,12 @@ class QuaternionFloatingMobilizer final : public MobilizerImpl<T, 7, 6> {
       const systems::Context<T>& context,
       const Eigen::Ref<const VectorX<T>>& qdot,
       EigenPtr<VectorX<T>> v) const override;
+
+  /// For MultibodyTree internal use only. Creates a SpecializedBodyNode, whose
+  /// recursive passes call the kinematics of this mobilizer directly.
+  std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
+      const internal::BodyNode<T>* parent_node,
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
   /// @}
 
  protected:
@@ -59,6 +59,8 @@ class RevoluteMobilizer final : public MobilizerImpl<T, 1, 1> {
   ///                frame F.
   const Vector3<double>& revolute_axis() const { return axis_F_; }
 
+  bool has_fixed_screw_axes() const final { return true; }
+
   /// Gets the rotation angle of `this` mobilizer from `context`. See class
   /// documentation for sign convention.
   /// @param[in] context The context of the MultibodyTree this mobilizer
@@ -150,6 +152,12 @@ class RevoluteMobilizer final : public MobilizerImpl<T, 1, 1> {
       const Eigen::Ref<const VectorX<T>>& qdot,
       EigenPtr<VectorX<T>> v) const override;
 
+  /// For MultibodyTree internal use only. Creates a SpecializedBodyNode, whose
+  /// recursive passes call the kinematics of this mobilizer directly.
+  std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
+      const internal::BodyNode<T>* parent_node,
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
+
  protected:
   void DoCalcNMatrix(const systems::Context<T>& context,
                      EigenPtr<MatrixX<T>> N) const final;
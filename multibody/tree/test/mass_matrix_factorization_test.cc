@@ -0,0 +1,163 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/tree/ball_rpy_joint.h"
+#include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/weld_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+
+constexpr double kTolerance = 1e-12;
+
+// The parents of a tree with two branches: 0 <- 1 <- 2 and 0 <- 3 <- 4, plus
+// an unconnected velocity 5.
+const std::vector<int> kParents{-1, 0, 1, 0, 3, -1};
+
+// Returns a positive definite matrix with the sparsity pattern of `parents`,
+// as Lᵀ D L for some unit lower triangular L with that pattern and a positive
+// diagonal D.
+MatrixXd MakeTreeMatrix(const std::vector<int>& parents) {
+  const int n = parents.size();
+  MatrixXd L = MatrixXd::Identity(n, n);
+  VectorXd D(n);
+  for (int i = 0; i < n; ++i) {
+    D(i) = 1.0 + 0.5 * i;
+    for (int j = parents[i]; j != -1; j = parents[j]) {
+      L(i, j) = 0.3 * (i + 1) - 0.2 * j;
+    }
+  }
+  return L.transpose() * D.asDiagonal() * L;
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, FactorAndSolve) {
+  const MatrixXd M = MakeTreeMatrix(kParents);
+  // The unrelated branches do not couple.
+  EXPECT_EQ(M(2, 4), 0.0);
+  EXPECT_EQ(M(5, 1), 0.0);
+
+  const MassMatrixFactorization<double> dut(M, kParents);
+  EXPECT_EQ(dut.size(), 6);
+  EXPECT_EQ(dut.parents(), kParents);
+  const MatrixXd L = dut.matrixL();
+  const VectorXd D = dut.vectorD();
+  EXPECT_TRUE(CompareMatrices(L.transpose() * D.asDiagonal() * L, M,
+                              kTolerance));
+  // L preserves the sparsity of M.
+  EXPECT_EQ(L(4, 1), 0.0);
+  EXPECT_EQ(L(5, 0), 0.0);
+
+  const VectorXd b = VectorXd::LinSpaced(6, -1.0, 2.0);
+  const VectorXd x = dut.Solve(b);
+  EXPECT_TRUE(CompareMatrices(x, M.ldlt().solve(b), kTolerance));
+
+  MatrixXd B = MatrixXd::Identity(6, 6);
+  dut.SolveInPlace(&B);
+  EXPECT_TRUE(CompareMatrices(M * B, MatrixXd::Identity(6, 6), kTolerance));
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, AutoDiff) {
+  const MatrixXd M = MakeTreeMatrix(kParents);
+  const MassMatrixFactorization<AutoDiffXd> dut(M.cast<AutoDiffXd>(),
+                                                kParents);
+  // With b as the independent variable, the gradient of x = M⁻¹ b is M⁻¹.
+  const VectorX<AutoDiffXd> b =
+      math::initializeAutoDiff(VectorXd::LinSpaced(6, -1.0, 2.0));
+  const VectorX<AutoDiffXd> x = dut.Solve(b);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(x),
+                              M.ldlt().solve(math::autoDiffToValueMatrix(b)),
+                              kTolerance));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(x), M.inverse(),
+                              kTolerance));
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, BadArguments) {
+  const MatrixXd M = MakeTreeMatrix(kParents);
+  // Inconsistent sizes.
+  EXPECT_THROW(MassMatrixFactorization<double>(M, {-1, 0}), std::exception);
+  // Parents must precede their children.
+  EXPECT_THROW(MassMatrixFactorization<double>(M, {-1, 2, 1, 0, 3, -1}),
+               std::exception);
+  // Not positive definite.
+  EXPECT_THROW(MassMatrixFactorization<double>(-M, kParents), std::exception);
+
+  const MassMatrixFactorization<double> dut(M, kParents);
+  EXPECT_THROW(dut.Solve(VectorXd::Zero(3)), std::exception);
+  MatrixXd B(3, 2);
+  EXPECT_THROW(dut.SolveInPlace(&B), std::exception);
+}
+
+// Verifies the factorization of the mass matrix of a branched tree, including
+// a weld joint and a multi-dof joint.
+GTEST_TEST(MassMatrixFactorizationTest, MultibodyTree) {
+  auto model = std::make_unique<internal::MultibodyTree<double>>();
+  const SpatialInertia<double> M_Bcm =
+      SpatialInertia<double>::MakeFromCentralInertia(
+          1.5, Vector3d(0.1, -0.2, 0.3),
+          RotationalInertia<double>(0.3, 0.4, 0.5));
+  const RigidBody<double>& base = model->AddBody<RigidBody>(M_Bcm);
+  const RigidBody<double>& arm1 = model->AddBody<RigidBody>(M_Bcm);
+  const RigidBody<double>& welded = model->AddBody<RigidBody>(M_Bcm);
+  const RigidBody<double>& arm2 = model->AddBody<RigidBody>(M_Bcm);
+  const RigidBody<double>& hand2 = model->AddBody<RigidBody>(M_Bcm);
+  const RigidTransformd X_PF(Vector3d(0.5, 0.0, 0.2));
+  model->AddJoint<RevoluteJoint>("base", model->world_body(), std::nullopt,
+                                 base, std::nullopt, Vector3d::UnitZ());
+  // First branch.
+  model->AddJoint<RevoluteJoint>("arm1", base, X_PF, arm1, std::nullopt,
+                                 Vector3d::UnitX());
+  // Second branch, through a weld.
+  model->AddJoint<WeldJoint>("weld", base, X_PF, welded, std::nullopt,
+                             RigidTransformd());
+  model->AddJoint<BallRpyJoint>("arm2", welded, X_PF, arm2, std::nullopt);
+  model->AddJoint<RevoluteJoint>("hand2", arm2, X_PF, hand2, std::nullopt,
+                                 Vector3d::UnitY());
+  internal::MultibodyTreeSystem<double> system(std::move(model));
+  const internal::MultibodyTree<double>& tree =
+      internal::GetInternalTree(system);
+  auto context = system.CreateDefaultContext();
+  tree.GetMutablePositionsAndVelocities(context.get())
+      .head(tree.num_positions()) =
+      VectorXd::LinSpaced(tree.num_positions(), 0.2, 1.3);
+
+  const int nv = tree.num_velocities();
+  ASSERT_EQ(nv, 6);
+  MatrixXd M(nv, nv);
+  tree.CalcMassMatrix(*context, &M);
+
+  const MassMatrixFactorization<double> dut =
+      tree.CalcMassMatrixFactorization(*context);
+  // The nodes are ordered base to tip: base, arm1, welded, arm2, hand2.
+  EXPECT_EQ(dut.parents(), std::vector<int>({-1, 0, 0, 2, 3, 4}));
+  EXPECT_EQ(tree.CalcVelocityParents(), dut.parents());
+  const MatrixXd L = dut.matrixL();
+  EXPECT_TRUE(CompareMatrices(L.transpose() * dut.vectorD().asDiagonal() * L,
+                              M, kTolerance));
+  const VectorXd b = VectorXd::LinSpaced(nv, 1.0, -1.0);
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), M.ldlt().solve(b), kTolerance));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -413,6 +413,41 @@ class TreeTopologyTests : public ::testing::Test {
     for (BodyIndex body(0); body < kNumBodies; ++body) {
       TestBodyNode(topology, body);
     }
+
+    // Verifies the O(1) ancestry query against the kinematic paths.
+    std::vector<BodyNodeIndex> path_to_world;
+    for (BodyNodeIndex node(0); node < kNumBodies; ++node) {
+      topology.GetKinematicPathToWorld(node, &path_to_world);
+      for (BodyNodeIndex ancestor(0); ancestor < kNumBodies; ++ancestor) {
+        const bool is_in_path =
+            std::find(path_to_world.begin(), path_to_world.end(), ancestor) !=
+            path_to_world.end();
+        EXPECT_EQ(topology.IsBodyNodeAncestorOf(ancestor, node), is_in_path);
+      }
+      // Each node belongs to the tree rooted at its ancestor in level 1.
+      if (node == 0) {
+        EXPECT_EQ(topology.body_node_tree(node), -1);
+      } else {
+        EXPECT_EQ(topology.body_node_tree(node),
+                  topology.body_node_tree(path_to_world[1]));
+      }
+    }
+
+    // The children of the world (bodies 4, 7 and 5) are the roots of the
+    // trees, which contain all of the velocities.
+    EXPECT_EQ(topology.num_trees(), 3);
+    std::set<int> velocities;
+    for (int tree = 0; tree < topology.num_trees(); ++tree) {
+      const std::vector<int>& tree_velocities = topology.tree_velocities(tree);
+      EXPECT_TRUE(std::is_sorted(tree_velocities.begin(),
+                                 tree_velocities.end()));
+      velocities.insert(tree_velocities.begin(), tree_velocities.end());
+    }
+    EXPECT_EQ(static_cast<int>(velocities.size()), topology.num_velocities());
+    EXPECT_EQ(topology.tree_velocities(
+                  topology.body_node_tree(
+                      topology.get_body(BodyIndex(4)).body_node)).size(),
+              4);
   }
 
  protected:
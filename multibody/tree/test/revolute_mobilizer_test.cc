@@ -5,6 +5,8 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/rigid_transform.h"
+#include "drake/multibody/tree/body_node_impl.h"
+#include "drake/multibody/tree/body_node_welded.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/test/mobilizer_tester.h"
@@ -217,6 +219,19 @@ TEST_F(RevoluteMobilizerTest, KinematicMapping) {
   EXPECT_EQ(Nplus(0, 0), 1.0);
 }
 
+// Verifies that the mobilizer creates a body node whose recursive passes are
+// specialized on RevoluteMobilizer. Their results are covered by the tests of
+// the MultibodyTree kinematics and dynamics, which go through these nodes.
+TEST_F(RevoluteMobilizerTest, CreateBodyNode) {
+  const BodyNodeWelded<double> world_node(&tree().world_body());
+  const std::unique_ptr<BodyNode<double>> node =
+      mobilizer_->CreateBodyNode(&world_node, body_, mobilizer_);
+  using RevoluteBodyNode = SpecializedBodyNode<double, RevoluteMobilizer>;
+  EXPECT_NE(dynamic_cast<const RevoluteBodyNode*>(node.get()), nullptr);
+  EXPECT_EQ(&node->get_mobilizer(), mobilizer_);
+  EXPECT_EQ(&node->body(), body_);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
@@ -406,6 +406,29 @@ TEST_F(PendulumTests, CalcMassMatrixViaInverseDynamics) {
   VerifyCalcMassMatrixViaInverseDynamics(-M_PI / 7.0, M_PI / 4.0);
 }
 
+// Verifies the offsets of the mobilizer frames that the position kinematics
+// cache stores for the velocity and acceleration recursions. The shoulder's
+// inboard frame Si is the world frame and its outboard frame So is offset from
+// L1; the elbow's inboard frame Ei is offset from L1 (by a pure translation)
+// and its outboard frame Eo is L2.
+TEST_F(PendulumTests, MobilizerFrameOffsets) {
+  pendulum_.shoulder().set_angle(context_.get(), M_PI / 3.0);
+  pendulum_.elbow().set_angle(context_.get(), M_PI / 4.0);
+  internal::PositionKinematicsCache<double> pc(tree().get_topology());
+  tree().CalcPositionKinematicsCache(*context_, &pc);
+
+  const internal::BodyNodeIndex shoulder_node =
+      pendulum_.shoulder().child_body().node_index();
+  const internal::BodyNodeIndex elbow_node =
+      pendulum_.elbow().child_body().node_index();
+  const math::RigidTransformd X_L1So(
+      Vector3d(0.0, pendulum_.half_length1(), 0.0));
+  EXPECT_TRUE(pc.get_X_MB(shoulder_node).IsExactlyEqualTo(X_L1So.inverse()));
+  EXPECT_TRUE(pc.get_R_PF(shoulder_node).IsExactlyIdentity());
+  EXPECT_TRUE(pc.get_X_MB(elbow_node).IsExactlyIdentity());
+  EXPECT_TRUE(pc.get_R_PF(elbow_node).IsExactlyIdentity());
+}
+
 // Verify the correct result from
 // UniformGravityFieldElement::CalcGravityGeneralizedForces().
 TEST_F(PendulumTests, VerifyGravityGeneralizedForces) {
@@ -37,6 +37,8 @@ class WeldMobilizer final : public MobilizerImpl<T, 0, 0> {
   /// @retval X_FM The pose of the outboard frame M in the inboard frame F.
   const math::RigidTransform<double>& get_X_FM() const { return X_FM_; }
 
+  bool has_fixed_screw_axes() const final { return true; }
+
   /// Computes the across-mobilizer transform `X_FM`, which for this mobilizer
   /// is independent of the state stored in `context`.
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
@@ -75,6 +77,12 @@ class WeldMobilizer final : public MobilizerImpl<T, 0, 0> {
       const Eigen::Ref<const VectorX<T>>& qdot,
       EigenPtr<VectorX<T>> v) const final;
 
+  /// For MultibodyTree internal use only. Creates a SpecializedBodyNode, whose
+  /// recursive passes call the kinematics of this mobilizer directly.
+  std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
+      const internal::BodyNode<T>* parent_node,
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
+
  protected:
   void DoCalcNMatrix(const systems::Context<T>& context,
                      EigenPtr<MatrixX<T>> N) const final;
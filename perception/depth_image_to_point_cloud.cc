@@ -1,11 +1,18 @@
 #include "drake/perception/depth_image_to_point_cloud.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <numeric>
 #include <optional>
+#include <stdexcept>
+#include <vector>
 
 #include "drake/common/drake_throw.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
 
+using Eigen::ArrayXf;
 using Eigen::Matrix3Xf;
 using Eigen::Vector3f;
 using drake::AbstractValue;
@@ -43,25 +50,59 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
-// TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
-// cloud output? (This would require adding support for colored point clouds,
-// because current implementation assume that an RGB image will still line up).
+// Reports true if the depth is kTooClose or kTooFar.
+template <PixelType pixel_type>
+bool IsOutOfRange(typename ImageTraits<pixel_type>::ChannelType z) {
+  return (z == ImageTraits<pixel_type>::kTooClose) ||
+         (z == ImageTraits<pixel_type>::kTooFar);
+}
+
+// Converts the depth image one row at a time, spreading the rows across
+// `num_threads` threads. Each row is first projected in bulk (which Eigen
+// vectorizes) using the rays through the pixels, and then the special depth
+// values are patched up (or skipped, with `drop_invalid_points`).
 template <PixelType pixel_type>
 void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const CameraInfo& camera_info,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
-               PointCloud* output) {
+               bool drop_invalid_points, int num_threads, PointCloud* output) {
+  using ChannelType = typename ImageTraits<pixel_type>::ChannelType;
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
 
+  const int height = depth_image.height();
+  const int width = depth_image.width();
+  auto is_valid = [](ChannelType z) {
+    return !std::isnan(z) && !IsOutOfRange<pixel_type>(z);
+  };
+
+  // The index in the point cloud of the first point of each row. When the
+  // invalid points are dropped, this requires counting the valid ones first.
+  std::vector<int> row_start(height + 1, 0);
+  if (drop_invalid_points) {
+    drake::internal::StaticParallelForRange(
+        height, num_threads, [&](int, int begin, int end) {
+          for (int v = begin; v < end; ++v) {
+            const ChannelType* row = depth_image.at(0, v);
+            row_start[v + 1] = std::count_if(row, row + width, is_valid);
+          }
+        });
+    std::partial_sum(row_start.begin(), row_start.end(), row_start.begin());
+  } else {
+    for (int v = 0; v <= height; ++v) {
+      row_start[v] = v * width;
+    }
+  }
+  const int num_points = row_start[height];
+
   // Reset the output size, if necessary.  We can leave the memory
   // uninitialized iff we are going to fill it in below.
-  if (output->size() != depth_image.size()) {
+  if (output->size() != num_points) {
     const bool skip_initialize = (output->fields().base_fields() == kXYZs);
-    output->resize(depth_image.size(), skip_initialize);
+    output->resize(num_points, skip_initialize);
   }
   Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
   std::optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
@@ -69,35 +110,63 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
     output_rgb = output->mutable_rgbs();
   }
 
-  const int height = depth_image.height();
-  const int width = depth_image.width();
+  // The ray through pixel (u, v) passes through (ray_x(u), ray_y[v], 1) in
+  // the camera frame.
   const float cx = camera_info.center_x();
   const float cy = camera_info.center_y();
   const float fx_inv = 1.f / camera_info.focal_x();
   const float fy_inv = 1.f / camera_info.focal_y();
+  ArrayXf ray_x(width);
+  for (int u = 0; u < width; ++u) {
+    ray_x(u) = (u - cx) * fx_inv;
+  }
+  std::vector<float> ray_y(height);
+  for (int v = 0; v < height; ++v) {
+    ray_y[v] = (v - cy) * fy_inv;
+  }
+
   const math::RigidTransform<float> X_PC = (camera_pose != nullptr) ?
       camera_pose->cast<float>() : math::RigidTransform<float>::Identity();
+  const Eigen::Matrix3f R_PC = X_PC.rotation().matrix();
+  const Vector3f p_PC = X_PC.translation();
 
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
-      if ((z == ImageTraits<pixel_type>::kTooClose) ||
-          (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-      } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
-      }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
-      }
-    }
-  }
+  drake::internal::StaticParallelForRange(
+      height, num_threads, [&](int, int begin, int end) {
+        Matrix3Xf p_CQ(3, width);
+        Matrix3Xf p_PQ(3, width);
+        for (int v = begin; v < end; ++v) {
+          const ChannelType* row = depth_image.at(0, v);
+          // N.B. This handles both true depths *and* NaNs; the out of range
+          // values are overwritten below.
+          const ArrayXf z =
+              Eigen::Map<const Eigen::Array<ChannelType, Eigen::Dynamic, 1>>(
+                  row, width)
+                  .template cast<float>() *
+              scale;
+          p_CQ.row(0) = (z * ray_x).matrix().transpose();
+          p_CQ.row(1) = (z * ray_y[v]).matrix().transpose();
+          p_CQ.row(2) = z.matrix().transpose();
+          p_PQ.noalias() = R_PC * p_CQ;
+          p_PQ.colwise() += p_PC;
+
+          int col = row_start[v];
+          for (int u = 0; u < width; ++u) {
+            if (drop_invalid_points && !is_valid(row[u])) continue;
+            if (IsOutOfRange<pixel_type>(row[u])) {
+              output_xyz.col(col).array() =
+                  std::numeric_limits<float>::infinity();
+            } else {
+              output_xyz.col(col) = p_PQ.col(u);
+            }
+            if (color_image) {
+              const auto color = color_image->at(u, v);
+              output_rgb->col(col) =
+                  Vector3<uint8_t>(color[0], color[1], color[2]);
+            }
+            ++col;
+          }
+        }
+      });
 }
 
 }  // namespace
@@ -133,6 +202,15 @@ DepthImageToPointCloud::DepthImageToPointCloud(
                                       : &DepthImageToPointCloud::CalcOutput16U);
 }
 
+void DepthImageToPointCloud::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(
+        "DepthImageToPointCloud::set_num_threads(): num_threads should be "
+        "positive.");
+  }
+  num_threads_ = num_threads;
+}
+
 void DepthImageToPointCloud::Convert(
     const systems::sensors::CameraInfo& camera_info,
     const std::optional<math::RigidTransformd>& camera_pose,
@@ -141,7 +219,7 @@ void DepthImageToPointCloud::Convert(
     const std::optional<float>& scale, PointCloud* output) {
   DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), false, 1, output);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -152,7 +230,7 @@ void DepthImageToPointCloud::Convert(
     const std::optional<float>& scale, PointCloud* output) {
   DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), false, 1, output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -165,7 +243,8 @@ void DepthImageToPointCloud::CalcOutput32F(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, drop_invalid_points_, num_threads_,
+            output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -178,7 +257,8 @@ void DepthImageToPointCloud::CalcOutput16U(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, drop_invalid_points_, num_threads_,
+            output);
 }
 
 }  // namespace perception
@@ -42,7 +42,8 @@ namespace perception {
 /// If a pixel is NaN, the converted point will be (NaN, NaN, NaN).  If a pixel
 /// is kTooClose or kTooFar (as defined by ImageTraits), the converted point
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
-/// the Point Cloud Library (PCL).
+/// the Point Cloud Library (PCL). Alternatively, the system can omit those
+/// points from the point cloud; see set_drop_invalid_points().
 ///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
@@ -89,6 +90,29 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
     return LeafSystem<double>::get_output_port(0);
   }
 
+  /// Sets whether the pixels that are NaN, kTooClose, or kTooFar are omitted
+  /// from the output point cloud (rather than converted to NaN or infinite
+  /// points). When they are omitted, the point cloud is smaller than the
+  /// depth image, and its points no longer correspond to pixels by index;
+  /// the colors (if any) stay with their points. The default is false.
+  void set_drop_invalid_points(bool drop_invalid_points) {
+    drop_invalid_points_ = drop_invalid_points;
+  }
+
+  /// Returns true if invalid pixels are omitted from the output point cloud.
+  /// @see set_drop_invalid_points().
+  bool drop_invalid_points() const { return drop_invalid_points_; }
+
+  /// Sets the number of threads used to convert the rows of the depth image.
+  /// The default of 1 converts them on the calling thread.
+  ///
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_threads(int num_threads);
+
+  /// Returns the number of threads used to convert the depth image.
+  /// @see set_num_threads().
+  int num_threads() const { return num_threads_; }
+
   /// Converts a depth image to a point cloud using direct arguments instead of
   /// System input and output ports.  The semantics are the same as documented
   /// in the class overview and constructor.
@@ -125,6 +149,8 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  bool drop_invalid_points_{false};
+  int num_threads_{1};
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
@@ -1,5 +1,7 @@
 #include "drake/perception/point_cloud.h"
 
+#include <algorithm>
+#include <array>
 #include <utility>
 
 #include <fmt/format.h>
@@ -235,6 +237,97 @@ void PointCloud::Expand(
   resize(new_size, skip_initialization);
 }
 
+PointCloud PointCloud::VoxelizedDownSample(double voxel_size) const {
+  DRAKE_DEMAND(has_xyzs());
+  if (!(voxel_size > 0 && std::isfinite(voxel_size))) {
+    throw std::runtime_error(fmt::format(
+        "VoxelizedDownSample: voxel_size must be positive and finite, not {}",
+        voxel_size));
+  }
+
+  // Sort the points with finite xyzs by their cell (and by their index within
+  // each cell), so that the points of each cell are contiguous. Cell
+  // coordinates are clamped so that distant points cannot overflow them.
+  const double kMaxCell = static_cast<double>(int64_t{1} << 62);
+  const Eigen::Ref<const Matrix3X<T>> xyzs_in = xyzs();
+  std::vector<std::pair<std::array<int64_t, 3>, int>> cells;
+  cells.reserve(size());
+  for (int i = 0; i < size(); ++i) {
+    const auto xyz_i = xyzs_in.col(i);
+    if (!xyz_i.allFinite()) continue;
+    std::array<int64_t, 3> cell;
+    for (int k = 0; k < 3; ++k) {
+      cell[k] = static_cast<int64_t>(std::clamp(
+          std::floor(xyz_i(k) / voxel_size), -kMaxCell, kMaxCell));
+    }
+    cells.emplace_back(cell, i);
+  }
+  std::sort(cells.begin(), cells.end());
+
+  // Find where each cell's points begin; the last entry is an end sentinel.
+  std::vector<int> starts;
+  for (int j = 0; j < static_cast<int>(cells.size()); ++j) {
+    if (j == 0 || cells[j].first != cells[j - 1].first) {
+      starts.push_back(j);
+    }
+  }
+  const int num_cells = static_cast<int>(starts.size());
+  starts.push_back(static_cast<int>(cells.size()));
+
+  PointCloud down_sampled(num_cells, fields_);
+  for (int c = 0; c < num_cells; ++c) {
+    const int begin = starts[c];
+    const int end = starts[c + 1];
+    Eigen::Vector3d xyz_sum = Eigen::Vector3d::Zero();
+    for (int j = begin; j < end; ++j) {
+      xyz_sum += xyzs_in.col(cells[j].second).cast<double>();
+    }
+    down_sampled.mutable_xyz(c) = (xyz_sum / (end - begin)).cast<T>();
+
+    if (has_normals()) {
+      // The normalized mean of unit normals is their normalized sum.
+      const Eigen::Ref<const Matrix3X<T>> normals_in = normals();
+      Eigen::Vector3d normal_sum = Eigen::Vector3d::Zero();
+      for (int j = begin; j < end; ++j) {
+        const auto normal_j = normals_in.col(cells[j].second);
+        if (normal_j.allFinite()) normal_sum += normal_j.cast<double>();
+      }
+      if (normal_sum.norm() > 0) {
+        down_sampled.mutable_normal(c) = normal_sum.normalized().cast<T>();
+      }
+    }
+
+    if (has_rgbs()) {
+      const Eigen::Ref<const Matrix3X<C>> rgbs_in = rgbs();
+      Eigen::Vector3d rgb_sum = Eigen::Vector3d::Zero();
+      for (int j = begin; j < end; ++j) {
+        rgb_sum += rgbs_in.col(cells[j].second).cast<double>();
+      }
+      down_sampled.mutable_rgb(c) =
+          (rgb_sum / (end - begin)).array().round().cast<C>().matrix();
+    }
+
+    if (has_descriptors()) {
+      const Eigen::Ref<const MatrixX<D>> descriptors_in = descriptors();
+      Eigen::VectorXd descriptor_sum =
+          Eigen::VectorXd::Zero(descriptors_in.rows());
+      int num_finite = 0;
+      for (int j = begin; j < end; ++j) {
+        const auto descriptor_j = descriptors_in.col(cells[j].second);
+        if (descriptor_j.allFinite()) {
+          descriptor_sum += descriptor_j.cast<double>();
+          ++num_finite;
+        }
+      }
+      if (num_finite > 0) {
+        down_sampled.mutable_descriptor(c) =
+            (descriptor_sum / num_finite).cast<D>();
+      }
+    }
+  }
+  return down_sampled;
+}
+
 bool PointCloud::has_xyzs() const {
   return fields_.contains(pc_flags::kXYZs);
 }
@@ -276,6 +276,23 @@ class PointCloud final {
 
   /// @}
 
+  /// @name Spatial Operations
+  /// @{
+
+  /// Returns a down-sampled point cloud, by grouping the points of this cloud
+  /// into the cells of a 3D grid of cubes with side length `voxel_size`.
+  /// Each occupied cell results in one point of the down-sampled cloud, whose
+  /// xyz is the centroid of the points in the cell. The other fields (normals,
+  /// rgbs, and descriptors) are averaged over the points in the cell whose
+  /// values are finite; averaged normals are re-normalized. The returned cloud
+  /// has the same fields as this cloud; its points are ordered by cell.
+  /// Points with non-finite xyz values are ignored.
+  /// @pre `has_xyzs()` must be true.
+  /// @throws std::exception if `voxel_size` is not positive and finite.
+  PointCloud VoxelizedDownSample(double voxel_size) const;
+
+  /// @}
+
   /// @name Fields
   /// @{
 
@@ -0,0 +1,135 @@
+#include "drake/perception/point_cloud_concatenation.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/math/rigid_transform.h"
+
+using Eigen::Matrix3f;
+using Eigen::Matrix3Xf;
+using Eigen::Vector3f;
+using drake::Value;
+using drake::math::RigidTransformd;
+
+namespace drake {
+namespace perception {
+
+PointCloudConcatenation::PointCloudConcatenation(int num_clouds,
+                                                 pc_flags::BaseFieldT fields)
+    : fields_(fields) {
+  if (num_clouds < 1) {
+    throw std::logic_error(fmt::format(
+        "PointCloudConcatenation: num_clouds should be positive, not {}",
+        num_clouds));
+  }
+  if (!(fields & pc_flags::kXYZs)) {
+    throw std::logic_error(
+        "PointCloudConcatenation: fields must include kXYZs");
+  }
+  const PointCloud model_cloud(0, fields);
+  for (int i = 0; i < num_clouds; ++i) {
+    cloud_input_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("point_cloud_{}", i),
+                                       Value<PointCloud>(model_cloud))
+            .get_index());
+    // Optional input port for the cloud's pose.
+    pose_input_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("camera_pose_{}", i),
+                                       Value<RigidTransformd>{})
+            .get_index());
+  }
+
+  concatenation_cache_index_ =
+      this->DeclareCacheEntry("concatenation", model_cloud,
+                              &PointCloudConcatenation::CalcConcatenation)
+          .cache_index();
+
+  this->DeclareAbstractOutputPort("point_cloud", model_cloud,
+                                  &PointCloudConcatenation::CalcOutput);
+}
+
+void PointCloudConcatenation::set_voxel_size(double voxel_size) {
+  if (!(voxel_size >= 0 && std::isfinite(voxel_size))) {
+    throw std::logic_error(fmt::format(
+        "PointCloudConcatenation::set_voxel_size(): voxel_size should be "
+        "non-negative and finite, not {}",
+        voxel_size));
+  }
+  voxel_size_ = voxel_size;
+}
+
+void PointCloudConcatenation::CalcConcatenation(
+    const systems::Context<double>& context, PointCloud* output) const {
+  std::vector<const PointCloud*> clouds(num_clouds());
+  int num_points = 0;
+  for (int i = 0; i < num_clouds(); ++i) {
+    clouds[i] =
+        this->EvalInputValue<PointCloud>(context, cloud_input_ports_[i]);
+    DRAKE_THROW_UNLESS(clouds[i] != nullptr);
+    clouds[i]->RequireFields(fields_);
+    num_points += clouds[i]->size();
+  }
+
+  // Every field of every point is written below, so new memory can be left
+  // uninitialized; when the total size is unchanged, no memory is touched.
+  if (output->size() != num_points) {
+    output->resize(num_points, true /* skip_initialize */);
+  }
+  Eigen::Ref<Matrix3Xf> xyzs = output->mutable_xyzs();
+
+  int offset = 0;
+  for (int i = 0; i < num_clouds(); ++i) {
+    const PointCloud& cloud = *clouds[i];
+    const int n = cloud.size();
+    const RigidTransformd* const X_PC_or_null =
+        this->EvalInputValue<RigidTransformd>(context, pose_input_ports_[i]);
+
+    if (X_PC_or_null == nullptr) {
+      xyzs.middleCols(offset, n) = cloud.xyzs();
+      if (output->has_normals()) {
+        output->mutable_normals().middleCols(offset, n) = cloud.normals();
+      }
+    } else {
+      // Transform the whole cloud in bulk (which Eigen vectorizes), and then
+      // restore the points with non-finite values; rotating an infinite point
+      // can make it NaN.
+      const Matrix3f R_PC = X_PC_or_null->rotation().matrix().cast<float>();
+      const Vector3f p_PC = X_PC_or_null->translation().cast<float>();
+      const Eigen::Ref<const Matrix3Xf> xyzs_C = cloud.xyzs();
+      auto xyzs_P = xyzs.middleCols(offset, n);
+      xyzs_P.noalias() = R_PC * xyzs_C;
+      xyzs_P.colwise() += p_PC;
+      if (!xyzs_C.allFinite()) {
+        for (int j = 0; j < n; ++j) {
+          if (!xyzs_C.col(j).allFinite()) xyzs_P.col(j) = xyzs_C.col(j);
+        }
+      }
+      if (output->has_normals()) {
+        output->mutable_normals().middleCols(offset, n).noalias() =
+            R_PC * cloud.normals();
+      }
+    }
+    if (output->has_rgbs()) {
+      output->mutable_rgbs().middleCols(offset, n) = cloud.rgbs();
+    }
+    offset += n;
+  }
+}
+
+void PointCloudConcatenation::CalcOutput(
+    const systems::Context<double>& context, PointCloud* output) const {
+  if (voxel_size_ == 0) {
+    CalcConcatenation(context, output);
+    return;
+  }
+  const PointCloud& concatenation =
+      this->get_cache_entry(concatenation_cache_index_)
+          .Eval<PointCloud>(context);
+  *output = concatenation.VoxelizedDownSample(voxel_size_);
+}
+
+}  // namespace perception
+}  // namespace drake
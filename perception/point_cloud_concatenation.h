@@ -0,0 +1,109 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace perception {
+
+/// Fuses several point clouds into one, e.g. to combine the outputs of the
+/// DepthImageToPointCloud systems of several cameras.
+///
+/// @system
+/// name: PointCloudConcatenation
+/// input_ports:
+/// - point_cloud_0
+/// - camera_pose_0 (optional)
+/// - ...
+/// - point_cloud_N-1
+/// - camera_pose_N-1 (optional)
+/// output_ports:
+/// - point_cloud
+/// @endsystem
+///
+/// Each input point cloud i comes with an optional input port that takes its
+/// pose X_PCi, as a RigidTransformd. The points of cloud i are transformed by
+/// X_PCi (the normals are rotated by it), so the output point cloud is
+/// represented in the parent frame P. If the camera_pose_i input is not
+/// connected, cloud i is taken to be represented in frame P already. The
+/// points of the output are those of cloud 0, followed by those of cloud 1,
+/// and so on; points with non-finite xyz values are copied as they are.
+///
+/// The output point cloud is written in place, so it only reallocates its
+/// storage when the total number of input points changes. Optionally, the
+/// output can be down-sampled with PointCloud::VoxelizedDownSample(); see
+/// set_voxel_size().
+///
+/// @ingroup perception_systems
+class PointCloudConcatenation final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudConcatenation)
+
+  /// Constructs the system.
+  ///
+  /// @param[in] num_clouds The number of input point clouds.
+  /// @param[in] fields The fields the output point cloud contains. Each input
+  ///   point cloud must contain (at least) these fields.
+  /// @throws std::exception if `num_clouds` is less than 1.
+  explicit PointCloudConcatenation(
+      int num_clouds, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+
+  /// Returns the number of input point clouds.
+  int num_clouds() const { return static_cast<int>(cloud_input_ports_.size()); }
+
+  /// Returns the abstract valued input port that expects the i'th PointCloud.
+  /// @pre 0 <= i < num_clouds().
+  const systems::InputPort<double>& point_cloud_input_port(int i) const {
+    return this->get_input_port(cloud_input_ports_.at(i));
+  }
+
+  /// Returns the abstract valued input port that expects X_PCi, the pose of
+  /// the i'th point cloud, as a RigidTransformd. (This input port does not
+  /// necessarily need to be connected; refer to the class overview for
+  /// details.)
+  /// @pre 0 <= i < num_clouds().
+  const systems::InputPort<double>& camera_pose_input_port(int i) const {
+    return this->get_input_port(pose_input_ports_.at(i));
+  }
+
+  /// Returns the abstract valued output port that provides a PointCloud.
+  /// Only the channels passed into the constructor argument "fields" are
+  /// present.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+  /// Sets the side length of the cells used to down-sample the output point
+  /// cloud (see PointCloud::VoxelizedDownSample()). The default of 0 does not
+  /// down-sample it.
+  ///
+  /// @throws std::exception if `voxel_size` is negative or not finite.
+  void set_voxel_size(double voxel_size);
+
+  /// Returns the side length of the cells used to down-sample the output, or
+  /// 0 if it is not down-sampled.
+  /// @see set_voxel_size().
+  double voxel_size() const { return voxel_size_; }
+
+ private:
+  // Writes the transformed input clouds into `output`, one after the other.
+  void CalcConcatenation(const systems::Context<double>& context,
+                         PointCloud* output) const;
+
+  void CalcOutput(const systems::Context<double>& context,
+                  PointCloud* output) const;
+
+  const pc_flags::BaseFieldT fields_;
+  double voxel_size_{0};
+  std::vector<systems::InputPortIndex> cloud_input_ports_;
+  std::vector<systems::InputPortIndex> pose_input_ports_;
+  // Holds the concatenated clouds when the output is down-sampled.
+  systems::CacheIndex concatenation_cache_index_{};
+};
+
+}  // namespace perception
+}  // namespace drake
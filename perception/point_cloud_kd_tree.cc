@@ -0,0 +1,154 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace perception {
+
+PointCloudKdTree::PointCloudKdTree(const PointCloud* cloud, int max_leaf_size)
+    : cloud_(cloud) {
+  DRAKE_DEMAND(cloud != nullptr);
+  DRAKE_DEMAND(cloud->has_xyzs());
+  if (max_leaf_size <= 0) {
+    throw std::runtime_error(fmt::format(
+        "PointCloudKdTree: max_leaf_size must be positive, not {}",
+        max_leaf_size));
+  }
+  const Eigen::Ref<const Matrix3X<T>> xyzs = cloud->xyzs();
+  indices_.reserve(cloud->size());
+  for (int i = 0; i < cloud->size(); ++i) {
+    if (xyzs.col(i).allFinite()) indices_.push_back(i);
+  }
+  if (indices_.empty()) return;
+  nodes_.reserve(2 * (indices_.size() / max_leaf_size) + 1);
+  Build(0, size(), max_leaf_size);
+}
+
+int PointCloudKdTree::Build(int begin, int end, int max_leaf_size) {
+  const int node = static_cast<int>(nodes_.size());
+  nodes_.push_back({});
+  nodes_[node].begin = begin;
+  nodes_[node].end = end;
+  if (end - begin <= max_leaf_size) return node;
+
+  // Split the points at their median along the axis in which they are most
+  // spread out.
+  const Eigen::Ref<const Matrix3X<T>> xyzs = cloud_->xyzs();
+  Vector3<T> lower = xyzs.col(indices_[begin]);
+  Vector3<T> upper = lower;
+  for (int i = begin + 1; i < end; ++i) {
+    lower = lower.cwiseMin(xyzs.col(indices_[i]));
+    upper = upper.cwiseMax(xyzs.col(indices_[i]));
+  }
+  int axis;
+  (upper - lower).maxCoeff(&axis);
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(indices_.begin() + begin, indices_.begin() + middle,
+                   indices_.begin() + end, [&xyzs, axis](int a, int b) {
+                     return xyzs(axis, a) < xyzs(axis, b);
+                   });
+  nodes_[node].axis = axis;
+  nodes_[node].split = xyzs(axis, indices_[middle]);
+
+  const int left = Build(begin, middle, max_leaf_size);
+  const int right = Build(middle, end, max_leaf_size);
+  nodes_[node].left = left;
+  nodes_[node].right = right;
+  return node;
+}
+
+std::vector<int> PointCloudKdTree::FindNeighborsInRadius(
+    const Vector3<T>& p, double radius) const {
+  std::vector<int> result;
+  if (nodes_.empty() || !(radius >= 0)) return result;
+  std::vector<Neighbor> neighbors;
+  SearchRadius(0, p, static_cast<T>(radius * radius), &neighbors);
+  std::sort(neighbors.begin(), neighbors.end());
+  result.reserve(neighbors.size());
+  for (const Neighbor& neighbor : neighbors) {
+    result.push_back(neighbor.second);
+  }
+  return result;
+}
+
+void PointCloudKdTree::SearchRadius(int node, const Vector3<T>& p,
+                                    T radius_squared,
+                                    std::vector<Neighbor>* neighbors) const {
+  const Node& n = nodes_[node];
+  if (n.left < 0) {
+    const Eigen::Ref<const Matrix3X<T>> xyzs = cloud_->xyzs();
+    for (int i = n.begin; i < n.end; ++i) {
+      const T distance_squared = (xyzs.col(indices_[i]) - p).squaredNorm();
+      if (distance_squared <= radius_squared) {
+        neighbors->emplace_back(distance_squared, indices_[i]);
+      }
+    }
+    return;
+  }
+  // The points on the far side of the split are at least |offset| from p.
+  const T offset = p(n.axis) - n.split;
+  const int near = offset <= 0 ? n.left : n.right;
+  const int far = offset <= 0 ? n.right : n.left;
+  SearchRadius(near, p, radius_squared, neighbors);
+  if (offset * offset <= radius_squared) {
+    SearchRadius(far, p, radius_squared, neighbors);
+  }
+}
+
+std::vector<int> PointCloudKdTree::FindNearestNeighbors(const Vector3<T>& p,
+                                                        int k) const {
+  if (k < 0) {
+    throw std::runtime_error(fmt::format(
+        "PointCloudKdTree::FindNearestNeighbors: k must be non-negative, not "
+        "{}",
+        k));
+  }
+  std::vector<int> result;
+  if (nodes_.empty() || k == 0) return result;
+  std::vector<Neighbor> neighbors;
+  neighbors.reserve(k);
+  SearchNearest(0, p, k, &neighbors);
+  std::sort_heap(neighbors.begin(), neighbors.end());
+  result.reserve(neighbors.size());
+  for (const Neighbor& neighbor : neighbors) {
+    result.push_back(neighbor.second);
+  }
+  return result;
+}
+
+void PointCloudKdTree::SearchNearest(int node, const Vector3<T>& p, int k,
+                                     std::vector<Neighbor>* neighbors) const {
+  const Node& n = nodes_[node];
+  if (n.left < 0) {
+    const Eigen::Ref<const Matrix3X<T>> xyzs = cloud_->xyzs();
+    for (int i = n.begin; i < n.end; ++i) {
+      const Neighbor candidate((xyzs.col(indices_[i]) - p).squaredNorm(),
+                               indices_[i]);
+      if (static_cast<int>(neighbors->size()) < k) {
+        neighbors->push_back(candidate);
+        std::push_heap(neighbors->begin(), neighbors->end());
+      } else if (candidate < neighbors->front()) {
+        std::pop_heap(neighbors->begin(), neighbors->end());
+        neighbors->back() = candidate;
+        std::push_heap(neighbors->begin(), neighbors->end());
+      }
+    }
+    return;
+  }
+  const T offset = p(n.axis) - n.split;
+  const int near = offset <= 0 ? n.left : n.right;
+  const int far = offset <= 0 ? n.right : n.left;
+  SearchNearest(near, p, k, neighbors);
+  if (static_cast<int>(neighbors->size()) < k ||
+      offset * offset < neighbors->front().first) {
+    SearchNearest(far, p, k, neighbors);
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
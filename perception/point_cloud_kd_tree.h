@@ -0,0 +1,96 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// A k-d tree over the xyz values of a PointCloud, for finding the points of
+/// the cloud near a query point.
+///
+/// The tree references the cloud's storage instead of copying it: it only
+/// stores a permutation of the indices of the cloud's points. Consequently,
+/// the cloud must outlive the tree, and the tree's queries are invalid once
+/// the cloud's size or xyz values change (construct a new tree instead).
+///
+/// Points with non-finite xyz values are not part of the tree, so they are
+/// never reported by the queries. The queries report points by their indices
+/// in the cloud.
+class PointCloudKdTree final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudKdTree)
+
+  using T = PointCloud::T;
+
+  /// Builds the tree over the xyz values of `cloud`.
+  /// @param cloud
+  ///    The point cloud to index, which is aliased (and must remain valid
+  ///    and unchanged for the lifetime of this object).
+  /// @param max_leaf_size
+  ///    The largest number of points in a leaf of the tree.
+  /// @pre `cloud.has_xyzs()` must be true.
+  /// @throws std::exception if `max_leaf_size` is not positive.
+  explicit PointCloudKdTree(const PointCloud* cloud, int max_leaf_size = 10);
+
+  /// Returns the indexed point cloud.
+  const PointCloud& cloud() const { return *cloud_; }
+
+  /// Returns the number of points in the tree, i.e., the number of points of
+  /// the cloud with finite xyz values.
+  int size() const { return static_cast<int>(indices_.size()); }
+
+  /// Returns the indices of the points within `radius` of `p`, ordered by
+  /// increasing distance from `p`.
+  std::vector<int> FindNeighborsInRadius(const Vector3<T>& p,
+                                         double radius) const;
+
+  /// Returns the indices of the `k` points nearest to `p`, ordered by
+  /// increasing distance from `p`; fewer than `k` indices are returned when
+  /// the tree has fewer than `k` points.
+  /// @throws std::exception if `k` is negative.
+  std::vector<int> FindNearestNeighbors(const Vector3<T>& p, int k) const;
+
+ private:
+  struct Node {
+    // The points of the node are indices_[begin, end).
+    int begin{};
+    int end{};
+    // The children of an internal node; both are -1 for a leaf. The points
+    // of `left` have p(axis) <= split, and those of `right` have
+    // p(axis) >= split.
+    int left{-1};
+    int right{-1};
+    int axis{};
+    T split{};
+  };
+
+  // A candidate neighbor, as its squared distance and its index in the cloud.
+  using Neighbor = std::pair<T, int>;
+
+  // Builds the subtree over indices_[begin, end), returning the index of its
+  // root node.
+  int Build(int begin, int end, int max_leaf_size);
+
+  void SearchRadius(int node, const Vector3<T>& p, T radius_squared,
+                    std::vector<Neighbor>* neighbors) const;
+
+  // Searches for nearer neighbors than those in the max-heap `neighbors`,
+  // which holds at most k entries.
+  void SearchNearest(int node, const Vector3<T>& p, int k,
+                     std::vector<Neighbor>* neighbors) const;
+
+  const PointCloud* const cloud_;
+  // The indices of the points with finite xyzs, permuted so that the points
+  // of each node are contiguous.
+  std::vector<int> indices_;
+  // The nodes of the tree; the root (if any) is nodes_[0].
+  std::vector<Node> nodes_;
+};
+
+}  // namespace perception
+}  // namespace drake
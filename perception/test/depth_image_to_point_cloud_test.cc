@@ -3,7 +3,9 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
@@ -482,6 +484,90 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies the System options to drop the invalid points and to use several
+// threads, against the static method's full point cloud.
+TYPED_TEST(DepthImageToPointCloudTest, DropInvalidPointsAndThreads) {
+  using TestFixturePixel = typename TestFixture::Pixel;
+  using Traits = typename TestFixture::ConfiguredImageTraits;
+  if (!TestFixture::kUseSystem) {
+    return;
+  }
+
+  static constexpr int kImageWidth = 7;
+  static constexpr int kImageHeight = 5;
+  const CameraInfo camera(kImageWidth, kImageHeight, 10.0, 12.0, 3.5, 2.5);
+  // A depth image with a mix of valid and invalid pixels (including a row
+  // with none that are valid), and a color image with a color per pixel.
+  MatrixX<TestFixturePixel> depth_matrix(kImageWidth, kImageHeight);
+  ImageRgba8U color_image(kImageWidth, kImageHeight);
+  for (int v = 0; v < kImageHeight; ++v) {
+    for (int u = 0; u < kImageWidth; ++u) {
+      TestFixturePixel depth = 1 + u + v;
+      if (v == 2 || (u + v) % 3 == 0) {
+        depth = Traits::kTooClose;
+      } else if ((u + v) % 3 == 1 && u % 2 == 0) {
+        depth = Traits::kTooFar;
+      }
+      depth_matrix(u, v) = depth;
+      color_image.at(u, v)[0] = u;
+      color_image.at(u, v)[1] = v;
+      color_image.at(u, v)[2] = u + v;
+    }
+  }
+  if (!std::is_same<TestFixturePixel, uint16_t>::value) {
+    depth_matrix(1, 0) = static_cast<TestFixturePixel>(kFloatNaN);
+  }
+  const auto depth_image = this->MakeDepthImage(depth_matrix);
+  const std::optional<ImageRgba8U> color_or_null =
+      (TestFixture::kFields & pc_flags::kRGBs)
+          ? std::optional<ImageRgba8U>(color_image)
+          : std::nullopt;
+  const auto& pose = this->random_transform_;
+
+  PointCloud full(0, TestFixture::kFields);
+  DepthImageToPointCloud::Convert(camera, pose, depth_image, color_or_null,
+                                  0.1, &full);
+  ASSERT_EQ(full.size(), kImageWidth * kImageHeight);
+  std::vector<int> valid;
+  for (int i = 0; i < full.size(); ++i) {
+    if (full.xyz(i).allFinite()) valid.push_back(i);
+  }
+  ASSERT_GT(static_cast<int>(valid.size()), 0);
+  ASSERT_LT(static_cast<int>(valid.size()), full.size());
+  PointCloud expected_valid(valid.size(), TestFixture::kFields);
+  for (int i = 0; i < static_cast<int>(valid.size()); ++i) {
+    expected_valid.mutable_xyz(i) = full.xyz(valid[i]);
+    if (TestFixture::kFields & pc_flags::kRGBs) {
+      expected_valid.mutable_rgb(i) = full.rgb(valid[i]);
+    }
+  }
+
+  DepthImageToPointCloud dut(camera, TestFixture::kConfiguredPixelType, 0.1,
+                             TestFixture::kFields);
+  EXPECT_FALSE(dut.drop_invalid_points());
+  EXPECT_EQ(dut.num_threads(), 1);
+  EXPECT_THROW(dut.set_num_threads(0), std::exception);
+  auto context = dut.CreateDefaultContext();
+  dut.depth_image_input_port().FixValue(context.get(), depth_image);
+  if (color_or_null) {
+    dut.color_image_input_port().FixValue(context.get(), *color_or_null);
+  }
+  dut.camera_pose_input_port().FixValue(context.get(), pose);
+  auto output = dut.point_cloud_output_port().Allocate();
+  for (int num_threads : {1, 2, 3, 8}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    dut.set_num_threads(num_threads);
+    dut.set_drop_invalid_points(false);
+    dut.point_cloud_output_port().Calc(*context, output.get());
+    EXPECT_TRUE(TestFixture::CompareClouds(output->get_value<PointCloud>(),
+                                           full));
+    dut.set_drop_invalid_points(true);
+    dut.point_cloud_output_port().Calc(*context, output.get());
+    EXPECT_TRUE(TestFixture::CompareClouds(output->get_value<PointCloud>(),
+                                           expected_valid));
+  }
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
@@ -0,0 +1,147 @@
+#include "drake/perception/point_cloud_concatenation.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/rigid_transform.h"
+
+using drake::math::RigidTransformd;
+using drake::math::RollPitchYawd;
+using Eigen::Matrix3Xf;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+
+namespace drake {
+namespace perception {
+namespace {
+
+constexpr float kFloatInf = std::numeric_limits<float>::infinity();
+
+class PointCloudConcatenationTest : public ::testing::Test {
+ protected:
+  PointCloudConcatenationTest()
+      : cloud_a_(2, pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs),
+        cloud_b_(3, pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs) {
+    // clang-format off
+    cloud_a_.mutable_xyzs() <<
+        0.1, 0.2,
+        0.0, 0.0,
+        1.0, 1.0;
+    cloud_b_.mutable_xyzs() <<
+        0.0, 1.0, kFloatInf,
+        0.5, 0.5, kFloatInf,
+        0.0, 0.0, kFloatInf;
+    // clang-format on
+    cloud_a_.mutable_normals().setZero();
+    cloud_a_.mutable_normals().row(2).setOnes();
+    cloud_b_.mutable_normals().setZero();
+    cloud_b_.mutable_normals().row(0).setOnes();
+    for (int i = 0; i < 2; ++i) cloud_a_.mutable_rgb(i).setConstant(10 + i);
+    for (int i = 0; i < 3; ++i) cloud_b_.mutable_rgb(i).setConstant(20 + i);
+  }
+
+  PointCloud cloud_a_;
+  PointCloud cloud_b_;
+};
+
+TEST_F(PointCloudConcatenationTest, Concatenate) {
+  const PointCloudConcatenation dut(
+      2, pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs);
+  EXPECT_EQ(dut.num_clouds(), 2);
+  EXPECT_EQ(dut.point_cloud_input_port(1).get_name(), "point_cloud_1");
+  EXPECT_EQ(dut.camera_pose_input_port(1).get_name(), "camera_pose_1");
+  EXPECT_EQ(dut.voxel_size(), 0);
+
+  auto context = dut.CreateDefaultContext();
+  dut.point_cloud_input_port(0).FixValue(context.get(), cloud_a_);
+  dut.point_cloud_input_port(1).FixValue(context.get(), cloud_b_);
+  // Only the second cloud is posed.
+  const RigidTransformd X_PB(RollPitchYawd(0, 0, M_PI / 2), Vector3d(1, 2, 3));
+  dut.camera_pose_input_port(1).FixValue(context.get(), X_PB);
+
+  const PointCloud& output =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  ASSERT_EQ(output.size(), 5);
+  Matrix3Xf xyzs_expected(3, 5);
+  // clang-format off
+  xyzs_expected <<
+      0.1, 0.2, 0.5, 0.5, kFloatInf,
+      0.0, 0.0, 2.0, 3.0, kFloatInf,
+      1.0, 1.0, 3.0, 3.0, kFloatInf;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(output.xyzs(), xyzs_expected, 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.normal(1), Vector3f(0, 0, 1), 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.normal(2), Vector3f(0, 1, 0), 1e-6));
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(output.rgb(i)(0), i < 2 ? 10 + i : 18 + i);
+  }
+}
+
+TEST_F(PointCloudConcatenationTest, ReusesOutput) {
+  const PointCloudConcatenation dut(2);
+  auto context = dut.CreateDefaultContext();
+  dut.point_cloud_input_port(0).FixValue(context.get(), cloud_a_);
+  dut.point_cloud_input_port(1).FixValue(context.get(), cloud_b_);
+  auto output = dut.point_cloud_output_port().Allocate();
+  PointCloud& cloud = output->get_mutable_value<PointCloud>();
+  dut.point_cloud_output_port().Calc(*context, output.get());
+  ASSERT_EQ(cloud.size(), 5);
+  const float* const data = cloud.xyzs().data();
+
+  // Recomputing the output with clouds of the same sizes reuses its storage.
+  cloud_a_.mutable_xyzs().setConstant(7);
+  dut.point_cloud_input_port(0).FixValue(context.get(), cloud_a_);
+  dut.point_cloud_output_port().Calc(*context, output.get());
+  EXPECT_EQ(cloud.xyzs().data(), data);
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs().leftCols(2),
+                              Matrix3Xf::Constant(3, 2, 7)));
+
+  // The output shrinks and grows with the inputs.
+  dut.point_cloud_input_port(1).FixValue(context.get(), PointCloud(0));
+  dut.point_cloud_output_port().Calc(*context, output.get());
+  EXPECT_EQ(cloud.size(), 2);
+  dut.point_cloud_input_port(1).FixValue(context.get(), cloud_b_);
+  dut.point_cloud_output_port().Calc(*context, output.get());
+  EXPECT_EQ(cloud.size(), 5);
+}
+
+TEST_F(PointCloudConcatenationTest, VoxelizedDownSample) {
+  PointCloudConcatenation dut(2, pc_flags::kXYZs | pc_flags::kRGBs);
+  dut.set_voxel_size(0.5);
+  EXPECT_EQ(dut.voxel_size(), 0.5);
+  auto context = dut.CreateDefaultContext();
+  dut.point_cloud_input_port(0).FixValue(context.get(), cloud_a_);
+  dut.point_cloud_input_port(1).FixValue(context.get(), cloud_b_);
+  const PointCloud& output =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  // The two points of cloud_a share a cell; the infinite point is dropped.
+  ASSERT_EQ(output.size(), 3);
+  EXPECT_TRUE(CompareMatrices(output.xyz(0), Vector3f(0.15, 0, 1), 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.xyz(1), Vector3f(0, 0.5, 0), 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.xyz(2), Vector3f(1, 0.5, 0), 1e-6));
+  EXPECT_EQ(output.rgb(0)(0), 11);
+  EXPECT_EQ(output.rgb(1)(0), 20);
+}
+
+TEST_F(PointCloudConcatenationTest, BadArguments) {
+  EXPECT_THROW(PointCloudConcatenation(0), std::exception);
+  EXPECT_THROW(PointCloudConcatenation(1, pc_flags::kRGBs), std::exception);
+
+  PointCloudConcatenation dut(1, pc_flags::kXYZs | pc_flags::kNormals);
+  EXPECT_THROW(dut.set_voxel_size(-1), std::exception);
+  EXPECT_THROW(dut.set_voxel_size(kFloatInf), std::exception);
+
+  // The inputs must have the output's fields.
+  auto context = dut.CreateDefaultContext();
+  dut.point_cloud_input_port(0).FixValue(context.get(), PointCloud(1));
+  EXPECT_THROW(dut.point_cloud_output_port().Eval<PointCloud>(*context),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,120 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace perception {
+namespace {
+
+using T = PointCloud::T;
+
+// Returns the indices of the points of `cloud` with finite xyzs, ordered by
+// their distance from `p`.
+std::vector<int> SortByDistance(const PointCloud& cloud, const Vector3<T>& p) {
+  std::vector<std::pair<T, int>> neighbors;
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (cloud.xyz(i).allFinite()) {
+      neighbors.emplace_back((cloud.xyz(i) - p).squaredNorm(), i);
+    }
+  }
+  std::sort(neighbors.begin(), neighbors.end());
+  std::vector<int> indices;
+  for (const auto& neighbor : neighbors) indices.push_back(neighbor.second);
+  return indices;
+}
+
+class PointCloudKdTreeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // A deterministic jumble of points in a 2 m cube, with a few invalid ones.
+    const int count = 500;
+    cloud_.resize(count);
+    for (int i = 0; i < count; ++i) {
+      cloud_.mutable_xyz(i) = Vector3<T>(std::sin(1.1 * i), std::cos(2.3 * i),
+                                         std::sin(0.7 * i + 0.3));
+    }
+    cloud_.mutable_xyz(17).setConstant(std::numeric_limits<T>::infinity());
+    cloud_.mutable_xyz(123)(1) = PointCloud::kDefaultValue;
+  }
+
+  PointCloud cloud_;
+};
+
+TEST_F(PointCloudKdTreeTest, Size) {
+  const PointCloudKdTree dut(&cloud_);
+  EXPECT_EQ(&dut.cloud(), &cloud_);
+  EXPECT_EQ(dut.size(), cloud_.size() - 2);
+}
+
+TEST_F(PointCloudKdTreeTest, FindNeighborsInRadius) {
+  for (int max_leaf_size : {1, 10, 1000}) {
+    const PointCloudKdTree dut(&cloud_, max_leaf_size);
+    for (const Vector3<T>& p :
+         {Vector3<T>(0, 0, 0), Vector3<T>(0.5, -0.2, 0.9),
+          Vector3<T>(cloud_.xyz(42)), Vector3<T>(5, 5, 5)}) {
+      for (double radius : {0.0, 0.1, 0.4, 10.0}) {
+        std::vector<int> expected = SortByDistance(cloud_, p);
+        expected.erase(
+            std::find_if(expected.begin(), expected.end(),
+                         [&](int i) {
+                           return (cloud_.xyz(i) - p).squaredNorm() >
+                                  static_cast<T>(radius * radius);
+                         }),
+            expected.end());
+        EXPECT_EQ(dut.FindNeighborsInRadius(p, radius), expected);
+      }
+    }
+    // A point of the cloud is within a zero radius of itself.
+    EXPECT_EQ(dut.FindNeighborsInRadius(cloud_.xyz(42), 0),
+              std::vector<int>{42});
+  }
+}
+
+TEST_F(PointCloudKdTreeTest, FindNearestNeighbors) {
+  for (int max_leaf_size : {1, 10, 1000}) {
+    const PointCloudKdTree dut(&cloud_, max_leaf_size);
+    for (const Vector3<T>& p :
+         {Vector3<T>(0, 0, 0), Vector3<T>(0.5, -0.2, 0.9),
+          Vector3<T>(5, 5, 5)}) {
+      const std::vector<int> sorted = SortByDistance(cloud_, p);
+      for (int k : {0, 1, 7, 100}) {
+        const std::vector<int> expected(sorted.begin(), sorted.begin() + k);
+        EXPECT_EQ(dut.FindNearestNeighbors(p, k), expected);
+      }
+      // Asking for more points than there are reports all of them.
+      EXPECT_EQ(dut.FindNearestNeighbors(p, 1000), sorted);
+    }
+  }
+}
+
+TEST_F(PointCloudKdTreeTest, BadArguments) {
+  EXPECT_THROW(PointCloudKdTree(&cloud_, 0), std::exception);
+  const PointCloudKdTree dut(&cloud_);
+  EXPECT_THROW(dut.FindNearestNeighbors(Vector3<T>::Zero(), -1),
+               std::exception);
+  EXPECT_TRUE(dut.FindNeighborsInRadius(Vector3<T>::Zero(), -1).empty());
+}
+
+GTEST_TEST(PointCloudKdTreeEdgeTest, EmptyCloud) {
+  const PointCloud empty;
+  const PointCloudKdTree dut(&empty);
+  EXPECT_EQ(dut.size(), 0);
+  EXPECT_TRUE(dut.FindNeighborsInRadius(Vector3<T>::Zero(), 1).empty());
+  EXPECT_TRUE(dut.FindNearestNeighbors(Vector3<T>::Zero(), 3).empty());
+
+  // A cloud of only invalid points is also empty.
+  const PointCloud invalid(3);
+  const PointCloudKdTree invalid_dut(&invalid);
+  EXPECT_EQ(invalid_dut.size(), 0);
+  EXPECT_TRUE(invalid_dut.FindNearestNeighbors(Vector3<T>::Zero(), 3).empty());
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
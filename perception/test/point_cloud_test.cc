@@ -1,6 +1,7 @@
 #include "drake/perception/point_cloud.h"
 
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
@@ -257,6 +258,70 @@ GTEST_TEST(PointCloudTest, Fields) {
   }
 }
 
+GTEST_TEST(PointCloudTest, VoxelizedDownSample) {
+  const auto fields = pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs |
+                      pc_flags::kDescriptorCurvature;
+  PointCloud cloud(6, fields);
+  // Two points in the cell [0, 1)³, one in [1, 2) x [0, 1)², two in
+  // [-1, 0) x [0, 1)², and one invalid point.
+  // clang-format off
+  cloud.mutable_xyzs() <<
+      0.1, 0.5, 1.5, -0.5, -0.25, PointCloud::kDefaultValue,
+      0.2, 0.6, 0.5,  0.5,  0.5,  0,
+      0.3, 0.7, 0.5,  0.5,  0.5,  0;
+  cloud.mutable_normals() <<
+      1, 0, 1, 0, PointCloud::kDefaultValue, 1,
+      0, 1, 0, 0, PointCloud::kDefaultValue, 0,
+      0, 0, 0, 1, PointCloud::kDefaultValue, 0;
+  cloud.mutable_rgbs() <<
+      10, 20, 30, 40, 50, 60,
+       0,  1,  2,  3,  4,  5,
+     255, 254, 0, 0, 0, 0;
+  cloud.mutable_descriptors() <<
+      1, 2, 3, PointCloud::kDefaultValue, PointCloud::kDefaultValue, 6;
+  // clang-format on
+
+  const PointCloud down_sampled = cloud.VoxelizedDownSample(1.0);
+  EXPECT_TRUE(down_sampled.HasExactFields(fields));
+  ASSERT_EQ(down_sampled.size(), 3);
+  // The cells are ordered by their coordinates.
+  Matrix3Xf xyzs_expected(3, 3);
+  xyzs_expected.col(0) << -0.375, 0.5, 0.5;
+  xyzs_expected.col(1) << 0.3, 0.4, 0.5;
+  xyzs_expected.col(2) << 1.5, 0.5, 0.5;
+  EXPECT_TRUE(CompareMatrices(down_sampled.xyzs(), xyzs_expected, 1e-6));
+  Matrix3Xf normals_expected(3, 3);
+  normals_expected.col(0) << 0, 0, 1;
+  normals_expected.col(1) << M_SQRT1_2, M_SQRT1_2, 0;
+  normals_expected.col(2) << 1, 0, 0;
+  EXPECT_TRUE(CompareMatrices(down_sampled.normals(), normals_expected, 1e-6));
+  EXPECT_EQ(down_sampled.rgb(0), Vector3<uint8_t>(45, 4, 0));
+  EXPECT_EQ(down_sampled.rgb(1), Vector3<uint8_t>(15, 1, 255));
+  EXPECT_EQ(down_sampled.rgb(2), Vector3<uint8_t>(30, 2, 0));
+  // A cell without any finite descriptors has the default value.
+  EXPECT_TRUE(PointCloud::IsDefaultValue(down_sampled.descriptor(0)(0)));
+  EXPECT_FLOAT_EQ(down_sampled.descriptor(1)(0), 1.5);
+  EXPECT_FLOAT_EQ(down_sampled.descriptor(2)(0), 3);
+
+  // The grid's cells have a corner at the origin, so even large cells split
+  // the points with negative and positive x.
+  const PointCloud two = cloud.VoxelizedDownSample(100.0);
+  ASSERT_EQ(two.size(), 2);
+  EXPECT_TRUE(CompareMatrices(two.xyz(0), Vector3<float>(-0.375, 0.5, 0.5),
+                              1e-6));
+  EXPECT_TRUE(CompareMatrices(two.xyz(1), Vector3<float>(0.7, 1.3 / 3, 0.5),
+                              1e-6));
+
+  // An empty cloud stays empty.
+  EXPECT_EQ(PointCloud().VoxelizedDownSample(0.1).size(), 0);
+
+  EXPECT_THROW(cloud.VoxelizedDownSample(0), std::exception);
+  EXPECT_THROW(cloud.VoxelizedDownSample(-1), std::exception);
+  EXPECT_THROW(
+      cloud.VoxelizedDownSample(std::numeric_limits<double>::infinity()),
+      std::exception);
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
@@ -2,11 +2,13 @@
 
 #include <algorithm>
 #include <limits>
+#include <optional>
 #include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -91,12 +93,13 @@ void AddVectorOfConstraintsToProgram(
   }
 }
 
-SolutionResult SolveProgramWithSolver(const MathematicalProgram& prog,
-                                      const SolverId& solver_id,
-                                      MathematicalProgramResult* result) {
+SolutionResult SolveProgramWithSolver(
+    const MathematicalProgram& prog, const SolverId& solver_id,
+    const std::optional<Eigen::VectorXd>& initial_guess,
+    MathematicalProgramResult* result) {
   std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
   DRAKE_ASSERT(solver.get());
-  solver->Solve(prog, {}, {}, result);
+  solver->Solve(prog, initial_guess, {}, result);
   return result->get_solution_result();
 }
 }  // namespace
@@ -203,7 +206,7 @@ MixedIntegerBranchAndBoundNode::ConstructRootNode(
   MixedIntegerBranchAndBoundNode* node = new MixedIntegerBranchAndBoundNode(
       new_prog, binary_variables_list, solver_id);
   node->solution_result_ = SolveProgramWithSolver(
-      *node->prog_, solver_id, node->prog_result_.get());
+      *node->prog_, solver_id, std::nullopt, node->prog_result_.get());
   if (node->solution_result_ == SolutionResult::kSolutionFound) {
     node->CheckOptimalSolutionIsIntegral();
   }
@@ -300,11 +303,24 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
+  // Warm start each child from this node's relaxation, with the branching
+  // variable moved to its fixed value. The children have the same decision
+  // variables as this node, so the solution vector can be reused as is.
+  std::optional<Eigen::VectorXd> left_initial_guess;
+  std::optional<Eigen::VectorXd> right_initial_guess;
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    const int branching_variable_index =
+        prog_->FindDecisionVariableIndex(binary_variable);
+    left_initial_guess = prog_result_->get_x_val();
+    (*left_initial_guess)(branching_variable_index) = 0;
+    right_initial_guess = prog_result_->get_x_val();
+    (*right_initial_guess)(branching_variable_index) = 1;
+  }
   left_child_->solution_result_ = SolveProgramWithSolver(
-      *left_child_->prog_, left_child_->solver_id_,
+      *left_child_->prog_, left_child_->solver_id_, left_initial_guess,
       left_child_->prog_result_.get());
   right_child_->solution_result_ = SolveProgramWithSolver(
-      *right_child_->prog_, right_child_->solver_id_,
+      *right_child_->prog_, right_child_->solver_id_, right_initial_guess,
       right_child_->prog_result_.get());
   if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
     left_child_->CheckOptimalSolutionIsIntegral();
@@ -360,20 +376,32 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
-    // found, then every leaf node is fathomed, the branch-and-bound process
-    // should terminate.
-    // TODO(hongkai.dai) We might need to have a function that picks the
-    // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
-    if (HasConverged()) {
-      return SolutionResult::kSolutionFound;
+  if (num_threads_ > 1) {
+    std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+        PickBranchingNodes(num_threads_);
+    while (!branching_nodes.empty()) {
+      BranchAndUpdateInParallel(branching_nodes);
+      if (HasConverged()) {
+        return SolutionResult::kSolutionFound;
+      }
+      branching_nodes = PickBranchingNodes(num_threads_);
+    }
+  } else {
+    MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
+    while (branching_node) {
+      // Found a branching node, branch on this node. If no branching node is
+      // found, then every leaf node is fathomed, the branch-and-bound process
+      // should terminate.
+      // TODO(hongkai.dai) We might need to have a function that picks the
+      // branching node together with the branching variable simultaneously.
+      const symbolic::Variable* branching_variable =
+          PickBranchingVariable(*branching_node);
+      BranchAndUpdate(branching_node, *branching_variable);
+      if (HasConverged()) {
+        return SolutionResult::kSolutionFound;
+      }
+      branching_node = PickBranchingNode();
     }
-    branching_node = PickBranchingNode();
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -612,6 +640,60 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+namespace {
+// Appends the non-fathomed leaf nodes of the sub tree, from left to right.
+void GetUnfathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaf_nodes) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaf_nodes->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    GetUnfathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                    leaf_nodes);
+    GetUnfathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                    leaf_nodes);
+  }
+}
+}  // namespace
+
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes(int max_num_nodes) const {
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes;
+  if (node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    // The user function picks a single node.
+    MixedIntegerBranchAndBoundNode* node = PickBranchingNode();
+    if (node) {
+      nodes.push_back(node);
+    }
+    return nodes;
+  }
+  GetUnfathomedLeafNodesInSubTree(*this, *root_, &nodes);
+  // Rank the nodes the same way PickBranchingNode() would pick the first one.
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::stable_sort(nodes.begin(), nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->prog_result()->get_optimal_cost() <
+                              b->prog_result()->get_optimal_cost();
+                     });
+  } else {
+    std::stable_sort(nodes.begin(), nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->remaining_binary_variables().size() <
+                              b->remaining_binary_variables().size();
+                     });
+  }
+  if (static_cast<int>(nodes.size()) > max_num_nodes) {
+    nodes.resize(max_num_nodes);
+  }
+  return nodes;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -656,6 +738,34 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
   node->Branch(branching_variable);
+  UpdateAfterBranch(node);
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdateInParallel(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes) {
+  const int num_nodes = static_cast<int>(nodes.size());
+  std::vector<const symbolic::Variable*> branching_variables(num_nodes);
+  for (int i = 0; i < num_nodes; ++i) {
+    branching_variables[i] = PickBranchingVariable(*nodes[i]);
+  }
+  // Each Branch() call only creates and solves the children of its own node,
+  // so distinct nodes can be branched concurrently.
+  drake::internal::StaticParallelForRange(
+      num_nodes, std::min(num_threads_, num_nodes),
+      [&nodes, &branching_variables](int, int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          nodes[i]->Branch(*branching_variables[i]);
+        }
+      });
+  // The bounds, the incumbent solutions and the user callbacks are updated
+  // on this thread, in the order the nodes were picked.
+  for (MixedIntegerBranchAndBoundNode* node : nodes) {
+    UpdateAfterBranch(node);
+  }
+}
+
+void MixedIntegerBranchAndBound::UpdateAfterBranch(
+    MixedIntegerBranchAndBoundNode* node) {
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -744,7 +854,8 @@ void MixedIntegerBranchAndBound::SearchIntegralSolutionByRounding(
                                          remaining_binary_variable);
     }
     MathematicalProgramResult result;
-    SolveProgramWithSolver(*new_prog, node.solver_id(), &result);
+    SolveProgramWithSolver(*new_prog, node.solver_id(),
+                           node.prog_result()->get_x_val(), &result);
     if (result.is_success()) {
       // Found integral solution.
       UpdateIntegralSolution(
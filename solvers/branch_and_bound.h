@@ -3,8 +3,10 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
@@ -564,6 +566,29 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /**
+   * Setter for the number of threads used to solve the node programs. The
+   * default is 1, which branches on one node at a time.
+   *
+   * With more than one thread, each iteration of Solve() picks up to
+   * num_threads un-fathomed leaf nodes, ranked by the node selection method,
+   * branches on all of them, and solves the programs of their children
+   * concurrently. The bounds, the solutions and the node callback are then
+   * updated serially, on the calling thread. With
+   * NodeSelectionMethod::kUserDefined only one node is picked per iteration.
+   * The solver passed to the constructor must support concurrent solves.
+   * @throws std::runtime_error if num_threads < 1.
+   */
+  void set_num_threads(int num_threads) {
+    if (num_threads < 1) {
+      throw std::runtime_error("num_threads should be at least 1.");
+    }
+    num_threads_ = num_threads;
+  }
+
+  /** Getter for the number of threads. */
+  int num_threads() const { return num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -573,6 +598,13 @@ class MixedIntegerBranchAndBound {
    */
   MixedIntegerBranchAndBoundNode* PickBranchingNode() const;
 
+  /**
+   * Pick at most @p max_num_nodes distinct un-fathomed leaf nodes to branch,
+   * ranked by the node selection method.
+   */
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      int max_num_nodes) const;
+
   /**
    * Pick the node with the minimal lower bound.
    */
@@ -598,6 +630,20 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on each of the distinct leaf @p nodes, solving their children
+   * concurrently on up to num_threads() threads, then update the best lower
+   * and upper bounds.
+   */
+  void BranchAndUpdateInParallel(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes);
+
+  /**
+   * Update the best lower and upper bounds and the solutions after @p node
+   * has been branched, and call the node callback on its children.
+   */
+  void UpdateAfterBranch(MixedIntegerBranchAndBoundNode* node);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -674,6 +720,8 @@ class MixedIntegerBranchAndBound {
   double absolute_gap_tol_ = 1E-2;
   double relative_gap_tol_ = 1E-2;
 
+  int num_threads_{1};
+
   VariableSelectionMethod variable_selection_method_ =
       VariableSelectionMethod::kMostAmbivalent;
 
@@ -0,0 +1,88 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <algorithm>
+#include <set>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace solvers {
+std::vector<std::vector<int>> FindChordalExtensionCliques(
+    int num_rows, const std::vector<std::pair<int, int>>& nonzeros) {
+  DRAKE_THROW_UNLESS(num_rows >= 0);
+  std::vector<std::set<int>> neighbors(num_rows);
+  for (const auto& [i, j] : nonzeros) {
+    DRAKE_THROW_UNLESS(0 <= i && i < num_rows);
+    DRAKE_THROW_UNLESS(0 <= j && j < num_rows);
+    if (i != j) {
+      neighbors[i].insert(j);
+      neighbors[j].insert(i);
+    }
+  }
+
+  // Eliminate the nodes one at a time, choosing the node with the fewest
+  // remaining neighbors. Eliminating a node connects all of its remaining
+  // neighbors (the fill-in), and the node together with those neighbors is a
+  // clique of the chordal extension. Every maximal clique is one of these
+  // candidates. A candidate can only be contained in a candidate found earlier,
+  // since a later candidate does not contain the nodes eliminated before it.
+  std::vector<std::vector<int>> cliques;
+  std::vector<bool> eliminated(num_rows, false);
+  for (int k = 0; k < num_rows; ++k) {
+    int v = -1;
+    for (int i = 0; i < num_rows; ++i) {
+      if (!eliminated[i] &&
+          (v < 0 || neighbors[i].size() < neighbors[v].size())) {
+        v = i;
+      }
+    }
+    std::vector<int> candidate(neighbors[v].begin(), neighbors[v].end());
+    for (int i : candidate) {
+      neighbors[i].erase(v);
+      for (int j : candidate) {
+        if (i != j) {
+          neighbors[i].insert(j);
+        }
+      }
+    }
+    neighbors[v].clear();
+    eliminated[v] = true;
+    candidate.insert(
+        std::lower_bound(candidate.begin(), candidate.end(), v), v);
+    const bool is_maximal = std::none_of(
+        cliques.begin(), cliques.end(), [&candidate](const auto& clique) {
+          return std::includes(clique.begin(), clique.end(), candidate.begin(),
+                               candidate.end());
+        });
+    if (is_maximal) {
+      cliques.push_back(std::move(candidate));
+    }
+  }
+  return cliques;
+}
+
+std::vector<Binding<PositiveSemidefiniteConstraint>>
+AddSparsePositiveSemidefiniteConstraint(
+    MathematicalProgram* prog,
+    const Eigen::Ref<const MatrixXDecisionVariable>& X,
+    const std::vector<std::pair<int, int>>& nonzeros) {
+  DRAKE_THROW_UNLESS(prog != nullptr);
+  DRAKE_THROW_UNLESS(X.rows() == X.cols());
+  const std::vector<std::vector<int>> cliques =
+      FindChordalExtensionCliques(X.rows(), nonzeros);
+  std::vector<Binding<PositiveSemidefiniteConstraint>> bindings;
+  bindings.reserve(cliques.size());
+  for (const auto& clique : cliques) {
+    const int clique_size = static_cast<int>(clique.size());
+    MatrixXDecisionVariable X_clique(clique_size, clique_size);
+    for (int j = 0; j < clique_size; ++j) {
+      for (int i = 0; i < clique_size; ++i) {
+        X_clique(i, j) = X(clique[i], clique[j]);
+      }
+    }
+    bindings.push_back(prog->AddPositiveSemidefiniteConstraint(X_clique));
+  }
+  return bindings;
+}
+}  // namespace solvers
+}  // namespace drake
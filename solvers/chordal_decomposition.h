@@ -0,0 +1,58 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * Computes the maximal cliques of a chordal extension of the sparsity pattern
+ * of a symmetric matrix. The sparsity pattern is the undirected graph with one
+ * node per row of the matrix, and one edge per off-diagonal non-zero entry.
+ * The chordal extension adds the fill-in edges of a greedy minimum-degree
+ * elimination ordering, which keeps the cliques small for the banded and
+ * block-arrow patterns typical of sparse semidefinite programs.
+ * @param num_rows The number of rows of the symmetric matrix.
+ * @param nonzeros The off-diagonal non-zero entries (i, j) of the matrix. It is
+ * enough to list one of (i, j) and (j, i); duplicates and diagonal entries are
+ * ignored.
+ * @return The maximal cliques, each sorted in increasing order. Every row and
+ * every entry in `nonzeros` is contained in at least one clique.
+ * @throws std::exception if an index in `nonzeros` is not in [0, num_rows).
+ */
+std::vector<std::vector<int>> FindChordalExtensionCliques(
+    int num_rows, const std::vector<std::pair<int, int>>& nonzeros);
+
+/**
+ * Adds the constraint that the symmetric matrix of decision variables X has a
+ * positive semidefinite completion, as the positive semidefinite constraints
+ * X[Cₖ, Cₖ] ⪰ 0 on the principal submatrices of X for each maximal clique Cₖ
+ * of a chordal extension of the sparsity pattern `nonzeros` (see
+ * FindChordalExtensionCliques()). By Grone's theorem, these constraints are
+ * equivalent to requiring that the entries of X in the sparsity pattern can be
+ * completed to a positive semidefinite matrix. For sparse patterns, a few small
+ * semidefinite cones are much cheaper to solve than the single large cone of
+ * AddPositiveSemidefiniteConstraint(X).
+ *
+ * This is only a valid replacement for X ⪰ 0 if the entries of X outside of
+ * the sparsity pattern do not appear in any other cost or constraint; the
+ * values of those entries in the solution are then meaningless.
+ * @param prog The program to which the constraints are added.
+ * @param X A symmetric matrix of decision variables.
+ * @param nonzeros The off-diagonal entries of X that appear in other costs or
+ * constraints, as in FindChordalExtensionCliques().
+ * @return The positive semidefinite constraints on each clique.
+ * @throws std::exception if X is not square, or if an index in `nonzeros` is
+ * out of range.
+ */
+std::vector<Binding<PositiveSemidefiniteConstraint>>
+AddSparsePositiveSemidefiniteConstraint(
+    MathematicalProgram* prog,
+    const Eigen::Ref<const MatrixXDecisionVariable>& X,
+    const std::vector<std::pair<int, int>>& nonzeros);
+}  // namespace solvers
+}  // namespace drake
@@ -244,7 +244,20 @@ void LinearConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
 
 void LinearConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                               AutoDiffVecXd* y) const {
-  DoEvalGeneric(x, y);
+  // Specialized evaluation of the constraint and its gradient, so that the
+  // gradient costs a single matrix product rather than one AutoDiffXd
+  // operation per entry of A.
+  const Eigen::MatrixXd dx = math::autoDiffToGradientMatrix(x);
+  const Eigen::VectorXd y_val = A_ * math::autoDiffToValueMatrix(x);
+
+  // If dx is the identity matrix (very common here), then skip the chain rule
+  // multiplication A * dx
+  if (dx.rows() == x.size() && dx.cols() == x.size() &&
+      dx == Eigen::MatrixXd::Identity(x.size(), x.size())) {
+    *y = math::initializeAutoDiffGivenGradientMatrix(y_val, A_);
+  } else {
+    *y = math::initializeAutoDiffGivenGradientMatrix(y_val, A_ * dx);
+  }
 }
 
 void LinearConstraint::DoEval(
@@ -438,6 +451,20 @@ ExpressionConstraint::ExpressionConstraint(
 
   derivatives_ = symbolic::Jacobian(expressions_, vars_);
 
+  // Most entries of a constraint Jacobian are typically constant (often zero),
+  // so evaluate those once here instead of walking their expression trees on
+  // every call to DoEval.
+  constant_derivatives_.setZero(derivatives_.rows(), derivatives_.cols());
+  for (int j = 0; j < derivatives_.cols(); ++j) {
+    for (int i = 0; i < derivatives_.rows(); ++i) {
+      if (is_constant(derivatives_(i, j))) {
+        constant_derivatives_(i, j) = get_constant_value(derivatives_(i, j));
+      } else {
+        nonconstant_derivative_indices_.emplace_back(i, j);
+      }
+    }
+  }
+
   // Setup the environment.
   for (int i = 0; i < vars_.size(); i++) {
     environment_.insert(vars_[i], 0.0);
@@ -471,22 +498,16 @@ void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
 
   // Evaluate value and derivatives into the output, y.
   // Using ∂yᵢ/∂zⱼ = ∑ₖ ∂fᵢ/∂xₖ ∂xₖ/∂zⱼ.
-  y->resize(num_constraints());
-  Eigen::VectorXd dyidx(x.size());
+  Eigen::VectorXd y_val(num_constraints());
   for (int i = 0; i < num_constraints(); i++) {
-    (*y)[i].value() = expressions_[i].Evaluate(environment_);
-    for (int k = 0; k < x.size(); k++) {
-      dyidx[k] = derivatives_(i, k).Evaluate(environment_);
-    }
-
-    (*y)[i].derivatives().resize(x(0).derivatives().size());
-    for (int j = 0; j < x(0).derivatives().size(); j++) {
-      (*y)[i].derivatives()[j] = 0.0;
-      for (int k = 0; k < x.size(); k++) {
-        (*y)[i].derivatives()[j] += dyidx[k] * x(k).derivatives()[j];
-      }
-    }
+    y_val[i] = expressions_[i].Evaluate(environment_);
+  }
+  Eigen::MatrixXd dydx = constant_derivatives_;
+  for (const auto& [i, k] : nonconstant_derivative_indices_) {
+    dydx(i, k) = derivatives_(i, k).Evaluate(environment_);
   }
+  *y = math::initializeAutoDiffGivenGradientMatrix(
+      y_val, dydx * math::autoDiffToGradientMatrix(x));
 }
 
 void ExpressionConstraint::DoEval(
@@ -552,6 +552,21 @@ class LinearConstraint : public Constraint {
     set_bounds(new_lb, new_ub);
   }
 
+  /**
+   * Updates the coefficient A(i, j) of the linear term, leaving the rest of
+   * the constraint unchanged. Together with UpdateLowerBound() and
+   * UpdateUpperBound(), this lets a program be built once and re-solved with
+   * new data, without copying A or allocating.
+   * @throws std::runtime_error if i or j is out of range.
+   */
+  void UpdateCoefficientEntry(int i, int j, double val) {
+    if (i < 0 || i >= A_.rows() || j < 0 || j >= A_.cols()) {
+      throw std::runtime_error(
+          "LinearConstraint: entry index is out of range");
+    }
+    A_(i, j) = val;
+  }
+
   using Constraint::set_bounds;
   using Constraint::UpdateLowerBound;
   using Constraint::UpdateUpperBound;
@@ -925,6 +940,12 @@ class ExpressionConstraint : public Constraint {
   VectorX<symbolic::Expression> expressions_{0};
   MatrixX<symbolic::Expression> derivatives_{0, 0};
 
+  // The entries of derivatives_ that are constant, evaluated once at
+  // construction, and the (row, col) indices of the remaining entries, which
+  // must be evaluated on every call.
+  Eigen::MatrixXd constant_derivatives_{0, 0};
+  std::vector<std::pair<int, int>> nonconstant_derivative_indices_;
+
   // map_var_to_index_[vars_(i).get_id()] = i.
   VectorXDecisionVariable vars_{0};
   std::unordered_map<symbolic::Variable::Id, int> map_var_to_index_;
@@ -24,7 +24,20 @@ void LinearCost::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
 }
 void LinearCost::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                         AutoDiffVecXd* y) const {
-  DoEvalGeneric(x, y);
+  // Specialized evaluation of cost and gradient, so that the gradient costs a
+  // single matrix product rather than one AutoDiffXd operation per term.
+  const MatrixXd dx = math::autoDiffToGradientMatrix(x);
+  const Vector1d result(a_.dot(drake::math::autoDiffToValueMatrix(x)) + b_);
+
+  // If dx is the identity matrix (very common here), then skip the chain rule
+  // multiplication a_ᵀ * dx
+  if (dx.rows() == x.size() && dx.cols() == x.size() &&
+      dx == MatrixXd::Identity(x.size(), x.size())) {
+    *y = math::initializeAutoDiffGivenGradientMatrix(result, a_.transpose());
+  } else {
+    *y = math::initializeAutoDiffGivenGradientMatrix(result,
+                                                     a_.transpose() * dx);
+  }
 }
 
 void LinearCost::DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
@@ -76,6 +76,22 @@ class LinearCost : public Cost {
     b_ = new_b;
   }
 
+  /**
+   * Updates the i'th entry of the linear term a, leaving the rest of the cost
+   * unchanged. Unlike UpdateCoefficients(), this neither copies nor allocates,
+   * so it suits programs that are built once and re-solved with new data.
+   * @throws std::runtime_error if i is out of range.
+   */
+  void update_coefficient_entry(int i, double val) {
+    if (i < 0 || i >= a_.rows()) {
+      throw std::runtime_error("LinearCost: entry index is out of range");
+    }
+    a_(i) = val;
+  }
+
+  /** Updates the constant term b. */
+  void update_constant_term(double new_b) { b_ = new_b; }
+
  protected:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override;
@@ -152,6 +168,34 @@ class QuadraticCost : public Cost {
     c_ = new_c;
   }
 
+  /**
+   * Updates both Q(i, j) and Q(j, i) to val, keeping Q symmetric. The rest of
+   * the cost is unchanged. Like the other entry-wise updates below, this
+   * neither copies nor allocates.
+   * @throws std::runtime_error if i or j is out of range.
+   */
+  void UpdateHessianEntry(int i, int j, double val) {
+    if (i < 0 || i >= Q_.rows() || j < 0 || j >= Q_.cols()) {
+      throw std::runtime_error("QuadraticCost: entry index is out of range");
+    }
+    Q_(i, j) = val;
+    Q_(j, i) = val;
+  }
+
+  /**
+   * Updates the i'th entry of the linear term b.
+   * @throws std::runtime_error if i is out of range.
+   */
+  void update_linear_coefficient_entry(int i, double val) {
+    if (i < 0 || i >= b_.rows()) {
+      throw std::runtime_error("QuadraticCost: entry index is out of range");
+    }
+    b_(i) = val;
+  }
+
+  /** Updates the constant term c. */
+  void update_constant_term(double new_c) { c_ = new_c; }
+
  private:
   template <typename DerivedX, typename U>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x, VectorX<U>* y) const;
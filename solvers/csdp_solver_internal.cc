@@ -5,7 +5,7 @@ namespace solvers {
 namespace internal {
 void ConvertSparseMatrixFormatToCsdpProblemData(
     const std::vector<BlockInX>& X_blocks, const Eigen::SparseMatrix<double>& C,
-    const std::vector<Eigen::SparseMatrix<double>> A,
+    const std::vector<Eigen::SparseMatrix<double>>& A,
     const Eigen::VectorXd& rhs, csdp::blockmatrix* C_csdp, double** rhs_csdp,
     csdp::constraintmatrix** constraints) {
   const int num_X_rows = C.rows();
@@ -90,63 +90,76 @@ void ConvertSparseMatrixFormatToCsdpProblemData(
   *constraints = static_cast<struct csdp::constraintmatrix*>(
       malloc((static_cast<int>(A.size()) + 1) *
              sizeof(struct csdp::constraintmatrix)));
+  // A_triplets stores the non-zero entries in the upper-triangular part of
+  // A[constraint_index], visited column by column. Since A[constraint_index]
+  // is block diagonal, the entries of each block are contiguous, and
+  // A_triplet_blocks stores the block of each entry. The row and column indices
+  // in A_triplets are the indices within that block, not the indices in the
+  // whole matrix A[constraint_index]. Both vectors are reused for all the
+  // constraints, instead of allocating a buffer for each block of X in each
+  // constraint.
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  std::vector<int> A_triplet_blocks;
   for (int constraint_index = 0; constraint_index < static_cast<int>(A.size());
        ++constraint_index) {
     (*constraints)[constraint_index + 1].blocks = nullptr;
+    const Eigen::SparseMatrix<double>& A_i = A[constraint_index];
+    A_triplets.clear();
+    A_triplet_blocks.clear();
+    for (int col_index = 0; col_index < A_i.outerSize(); ++col_index) {
+      const int block_index = X_row_to_block_index[col_index];
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A_i, col_index); it;
+           ++it) {
+        // CSDP only stores the upper-triangular part of each block.
+        if (it.row() > it.col()) {
+          break;
+        }
+        DRAKE_ASSERT(X_row_to_block_index[it.row()] == block_index);
+        A_triplets.emplace_back(it.row() - block_start_rows[block_index] + 1,
+                                it.col() - block_start_rows[block_index] + 1,
+                                it.value());
+        A_triplet_blocks.push_back(block_index);
+      }
+    }
     // Start from the last block in the block-diagonal matrix
     // A[constraint_index], we add each block in the reverse order.
-    for (int block_index = static_cast<int>(X_blocks.size() - 1);
-         block_index >= 0; --block_index) {
-      std::vector<Eigen::Triplet<double>> A_block_triplets;
-      // CSDP only stores the non-zero entries in the upper-triangular part of
-      // each block. Also the row and column indices in A_block_triplets are
-      // the indices within THIS block, not the indices in the whole matrix
-      // A[constraint_index].
-      A_block_triplets.reserve((X_blocks[block_index].num_rows + 1) *
-                               X_blocks[block_index].num_rows / 2);
-      for (int col_index = block_start_rows[block_index];
-           col_index <
-           block_start_rows[block_index] + X_blocks[block_index].num_rows;
-           ++col_index) {
-        for (Eigen::SparseMatrix<double>::InnerIterator it(A[constraint_index],
-                                                           col_index);
-             it; ++it) {
-          if (it.row() > it.col()) {
-            break;
-          }
-          A_block_triplets.emplace_back(
-              it.row() - block_start_rows[block_index] + 1,
-              it.col() - block_start_rows[block_index] + 1, it.value());
-        }
+    int block_end = static_cast<int>(A_triplets.size());
+    while (block_end > 0) {
+      const int block_index = A_triplet_blocks[block_end - 1];
+      int block_begin = block_end - 1;
+      while (block_begin > 0 &&
+             A_triplet_blocks[block_begin - 1] == block_index) {
+        --block_begin;
       }
-      if (!A_block_triplets.empty()) {
-        struct csdp::sparseblock* blockptr =
-            static_cast<struct csdp::sparseblock*>(
-                malloc(sizeof(struct csdp::sparseblock)));
-        // CSDP uses Fortran 1-indexed array.
-        blockptr->blocknum = block_index + 1;
-        blockptr->blocksize = X_blocks[block_index].num_rows;
-        // CSDP uses Fortran 1-indexed array.
-        blockptr->constraintnum = constraint_index + 1;
-        blockptr->next = nullptr;
-        blockptr->nextbyblock = nullptr;
-        blockptr->entries = static_cast<double*>(malloc(
-            (static_cast<int>(A_block_triplets.size()) + 1) * sizeof(double)));
-        blockptr->iindices = static_cast<int*>(malloc(
-            (static_cast<int>(A_block_triplets.size()) + 1) * sizeof(int)));
-        blockptr->jindices = static_cast<int*>(malloc(
-            (1 + static_cast<int>(A_block_triplets.size())) * sizeof(int)));
-        blockptr->numentries = static_cast<int>(A_block_triplets.size());
-        for (int i = 0; i < blockptr->numentries; ++i) {
-          blockptr->iindices[i + 1] = A_block_triplets[i].row();
-          blockptr->jindices[i + 1] = A_block_triplets[i].col();
-          blockptr->entries[i + 1] = A_block_triplets[i].value();
-        }
-        // Insert this block into the linked list of
-        // constraints[constraint_index + 1] blocks.
-        blockptr->next = (*constraints)[constraint_index + 1].blocks;
-        (*constraints)[constraint_index + 1].blocks = blockptr;
+      const int num_entries = block_end - block_begin;
+      struct csdp::sparseblock* blockptr =
+          static_cast<struct csdp::sparseblock*>(
+              malloc(sizeof(struct csdp::sparseblock)));
+      // CSDP uses Fortran 1-indexed array.
+      blockptr->blocknum = block_index + 1;
+      blockptr->blocksize = X_blocks[block_index].num_rows;
+      // CSDP uses Fortran 1-indexed array.
+      blockptr->constraintnum = constraint_index + 1;
+      blockptr->next = nullptr;
+      blockptr->nextbyblock = nullptr;
+      blockptr->entries =
+          static_cast<double*>(malloc((num_entries + 1) * sizeof(double)));
+      blockptr->iindices =
+          static_cast<int*>(malloc((num_entries + 1) * sizeof(int)));
+      blockptr->jindices =
+          static_cast<int*>(malloc((num_entries + 1) * sizeof(int)));
+      blockptr->numentries = num_entries;
+      for (int i = 0; i < num_entries; ++i) {
+        const Eigen::Triplet<double>& triplet = A_triplets[block_begin + i];
+        blockptr->iindices[i + 1] = triplet.row();
+        blockptr->jindices[i + 1] = triplet.col();
+        blockptr->entries[i + 1] = triplet.value();
       }
+      // Insert this block into the linked list of
+      // constraints[constraint_index + 1] blocks.
+      blockptr->next = (*constraints)[constraint_index + 1].blocks;
+      (*constraints)[constraint_index + 1].blocks = blockptr;
+      block_end = block_begin;
     }
   }
 }
@@ -38,7 +38,7 @@ namespace internal {
  */
 void ConvertSparseMatrixFormatToCsdpProblemData(
     const std::vector<BlockInX>& X_blocks, const Eigen::SparseMatrix<double>& C,
-    const std::vector<Eigen::SparseMatrix<double>> A,
+    const std::vector<Eigen::SparseMatrix<double>>& A,
     const Eigen::VectorXd& rhs, csdp::blockmatrix* C_csdp, double** rhs_csdp,
     csdp::constraintmatrix** constraints);
 
@@ -113,7 +113,8 @@ bool DenseLinearSolver::Solve(const DenseResidual& r, DenseVariable* x) const {
 
   // Compute rz - A'*(rv./mus) and store it in r1_.
   r2_ = r.v_.cwiseQuotient(mus_);
-  r1_.noalias() = r.z_ - A.transpose() * r2_;
+  r1_ = r.z_;
+  r1_.noalias() -= A.transpose() * r2_;
 
   // Solve KK'*z = rz - A'*(rv./mus)
   // where K = chol(H + sigma*I + A'*Gamma*A)
@@ -131,7 +132,8 @@ bool DenseLinearSolver::Solve(const DenseResidual& r, DenseVariable* x) const {
   x->v() = r2_.cwiseQuotient(mus_);
 
   // y = b - Az
-  x->y() = b - A * x->z();
+  x->y() = b;
+  x->y().noalias() -= A * x->z();
 
   return true;
 }
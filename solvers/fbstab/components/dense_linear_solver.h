@@ -29,7 +29,8 @@ class DenseComponentUnitTests;
  *
  * This class allocates its own workspace memory and splits step computation
  * into solve and factor steps to allow for solving with multiple
- * right hand sides.
+ * right hand sides. The workspace is allocated by the constructor, so
+ * Initialize() and Solve() do not allocate.
  *
  * This class has mutable fields and is thus not thread safe.
  *
@@ -165,7 +165,8 @@ bool RiccatiLinearSolver::Initialize(const MpcVariable& x,
         .solveInPlace<Eigen::OnTheRight>(SM_[i]);
 
     // Factor SG = chol(R - SM*SM') in place.
-    SG_[i].noalias() = R_[i] - SM_[i] * SM_[i].transpose();
+    SG_[i] = R_[i];
+    SG_[i].noalias() -= SM_[i] * SM_[i].transpose();
     Eigen::LLT<Eigen::Ref<MatrixXd>> llt2(SG_[i]);
     FBSTAB_LLT_CHECK(llt2);
 
@@ -205,7 +206,8 @@ bool RiccatiLinearSolver::Initialize(const MpcVariable& x,
       .solveInPlace<Eigen::OnTheRight>(SM_[N_]);
 
   // Compute SG = chol(R - SM*SM').
-  SG_[N_].noalias() = R_[N_] - SM_[N_] * SM_[N_].transpose();
+  SG_[N_] = R_[N_];
+  SG_[N_].noalias() -= SM_[N_] * SM_[N_].transpose();
   Eigen::LLT<Eigen::Ref<MatrixXd>> llt5(SG_[N_]);
   FBSTAB_LLT_CHECK(llt5);
 
@@ -251,8 +253,9 @@ bool RiccatiLinearSolver::Solve(const MpcResidual& r, MpcVariable* dx) const {
     SG_[i].triangularView<Eigen::Lower>().solveInPlace(tu_);
 
     const auto rlp = r2.col(i + 1);
-    th_[i + 1].noalias() = P_[i] * tu_ + AM_[i] * tx_;
-    th_[i + 1].noalias() += rlp;
+    th_[i + 1].noalias() = P_[i] * tu_;
+    th_[i + 1].noalias() += AM_[i] * tx_;
+    th_[i + 1] += rlp;
 
     // Compute h(i+1).
     const auto rxp = r1.block(0, i + 1, nx_, 1);
@@ -43,7 +43,8 @@ class MpcComponentUnitTests;
  *
  * and is used to perform the factorization efficiently. This class also
  * contains workspace memory and methods for setting up and solving the linear
- * systems.
+ * systems. All of the workspace is allocated by the constructor, so
+ * Initialize() and Solve() do not allocate.
  *
  * There is an error on page 744 of the paper in the \Delta x_k equation, It's
  * missing a residual term. This class contains mutable members as is thus not
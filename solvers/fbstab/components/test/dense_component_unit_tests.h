@@ -6,6 +6,7 @@
 #include <Eigen/Dense>
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/solvers/fbstab/components/dense_data.h"
 #include "drake/solvers/fbstab/components/dense_feasibility.h"
 #include "drake/solvers/fbstab/components/dense_linear_solver.h"
@@ -192,8 +193,12 @@ class DenseComponentUnitTests {
     DenseLinearSolver solver(n_, q_);
 
     double sigma = 0.5;
-    solver.Initialize(x, y, sigma);
-    solver.Solve(r, &y);
+    {
+      // The factor and solve steps only use preallocated workspace.
+      drake::test::LimitMalloc guard;
+      solver.Initialize(x, y, sigma);
+      solver.Solve(r, &y);
+    }
 
     // Construct the linear system
     // using the same diagonal matrices as were used in the solver.
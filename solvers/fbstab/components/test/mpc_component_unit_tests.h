@@ -6,6 +6,7 @@
 #include <Eigen/Dense>
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/solvers/fbstab/components/mpc_data.h"
 #include "drake/solvers/fbstab/components/mpc_feasibility.h"
 #include "drake/solvers/fbstab/components/mpc_residual.h"
@@ -407,7 +408,6 @@ class MpcComponentUnitTests {
     double sigma = 1.0;
 
     RiccatiLinearSolver ls(data.N_, data.nx_, data.nu_, data.nc_);
-    ls.Initialize(x, y, sigma);
 
     // Create the residual then solve.
     MpcResidual r(data.N_, data.nx_, data.nu_, data.nc_);
@@ -415,7 +415,12 @@ class MpcComponentUnitTests {
 
     MpcVariable dx(data.N_, data.nx_, data.nu_, data.nc_);
     dx.LinkData(&data);
-    ls.Solve(r, &dx);
+    {
+      // The factor and solve steps only use preallocated workspace.
+      drake::test::LimitMalloc guard;
+      ls.Initialize(x, y, sigma);
+      ls.Solve(r, &dx);
+    }
 
     int nz = data.nz_;
     int nl = data.nl_;
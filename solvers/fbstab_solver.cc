@@ -0,0 +1,235 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <cmath>
+#include <initializer_list>
+#include <variant>
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+#include "drake/solvers/fbstab/fbstab_dense.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+using fbstab::FBstabDense;
+
+// Accumulates the rows of Az <= b one scalar inequality at a time.
+struct InequalityRows {
+  void Add(const std::vector<int>& var_indices,
+           const Eigen::Ref<const Eigen::RowVectorXd>& coefficients,
+           double sign, double rhs) {
+    for (int j = 0; j < coefficients.cols(); ++j) {
+      if (coefficients(j) != 0) {
+        triplets.emplace_back(num_rows, var_indices[j],
+                              sign * coefficients(j));
+      }
+    }
+    b.push_back(sign * rhs);
+    ++num_rows;
+  }
+
+  // Adds lb <= coefficients * z <= ub, skipping infinite bounds.
+  void AddRange(const std::vector<int>& var_indices,
+                const Eigen::Ref<const Eigen::RowVectorXd>& coefficients,
+                double lb, double ub) {
+    if (!std::isinf(ub)) {
+      Add(var_indices, coefficients, 1, ub);
+    }
+    if (!std::isinf(lb)) {
+      Add(var_indices, coefficients, -1, lb);
+    }
+  }
+
+  std::vector<Eigen::Triplet<double>> triplets;
+  std::vector<double> b;
+  int num_rows{0};
+};
+
+template <typename C>
+void AddLinearConstraintRows(const MathematicalProgram& prog,
+                             const std::vector<Binding<C>>& bindings,
+                             InequalityRows* rows) {
+  for (const auto& binding : bindings) {
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    const Eigen::MatrixXd& A = binding.evaluator()->A();
+    const Eigen::VectorXd& lb = binding.evaluator()->lower_bound();
+    const Eigen::VectorXd& ub = binding.evaluator()->upper_bound();
+    for (int i = 0; i < A.rows(); ++i) {
+      rows->AddRange(var_indices, A.row(i), lb(i), ub(i));
+    }
+  }
+}
+
+SolutionResult ConvertExitFlag(fbstab::ExitFlag eflag) {
+  switch (eflag) {
+    case fbstab::ExitFlag::SUCCESS:
+      return SolutionResult::kSolutionFound;
+    case fbstab::ExitFlag::MAXITERATIONS:
+      return SolutionResult::kIterationLimit;
+    case fbstab::ExitFlag::PRIMAL_INFEASIBLE:
+    case fbstab::ExitFlag::PRIMAL_DUAL_INFEASIBLE:
+      return SolutionResult::kInfeasibleConstraints;
+    case fbstab::ExitFlag::DUAL_INFEASIBLE:
+      return SolutionResult::kUnbounded;
+    case fbstab::ExitFlag::DIVERGENCE:
+      return SolutionResult::kUnknownError;
+  }
+  return SolutionResult::kUnknownError;
+}
+
+void SetFbstabOptions(const SolverOptions& merged_options,
+                      FBstabDense* solver) {
+  for (const auto& [name, value] :
+       merged_options.GetOptionsDouble(FbstabSolver::id())) {
+    solver->UpdateOption(name.c_str(), value);
+  }
+  for (const auto& [name, value] :
+       merged_options.GetOptionsInt(FbstabSolver::id())) {
+    if (name == "check_feasibility" || name == "record_solve_time") {
+      solver->UpdateOption(name.c_str(), value != 0);
+    } else {
+      solver->UpdateOption(name.c_str(), value);
+    }
+  }
+  const auto& common_options = merged_options.common_solver_options();
+  const auto print_to_console =
+      common_options.find(CommonSolverOption::kPrintToConsole);
+  const bool verbose = print_to_console != common_options.end() &&
+                       std::get<int>(print_to_console->second) != 0;
+  solver->SetDisplayLevel(verbose ? fbstab::FBstabAlgoDense::Display::FINAL
+                                  : fbstab::FBstabAlgoDense::Display::OFF);
+}
+}  // namespace
+
+FbstabSolver::FbstabSolver()
+    : SolverBase(&id, &is_available, &is_enabled,
+                 &ProgramAttributesSatisfied) {}
+
+FbstabSolver::~FbstabSolver() = default;
+
+void FbstabSolver::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  if (!prog.GetVariableScaling().empty()) {
+    static const logging::Warn log_once(
+        "FbstabSolver doesn't support the feature of variable scaling.");
+  }
+
+  const int nz = prog.num_vars();
+
+  // Assemble the cost 1/2 z'Hz + f'z + constant_term.
+  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(nz, nz);
+  Eigen::VectorXd f = Eigen::VectorXd::Zero(nz);
+  double constant_term{0};
+  for (const auto& binding : prog.quadratic_costs()) {
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    const Eigen::MatrixXd& Q = binding.evaluator()->Q();
+    const Eigen::VectorXd& b = binding.evaluator()->b();
+    for (int i = 0; i < static_cast<int>(var_indices.size()); ++i) {
+      for (int j = 0; j < static_cast<int>(var_indices.size()); ++j) {
+        H(var_indices[i], var_indices[j]) += Q(i, j);
+      }
+      f(var_indices[i]) += b(i);
+    }
+    constant_term += binding.evaluator()->c();
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    const Eigen::VectorXd& a = binding.evaluator()->a();
+    for (int i = 0; i < static_cast<int>(var_indices.size()); ++i) {
+      f(var_indices[i]) += a(i);
+    }
+    constant_term += binding.evaluator()->b();
+  }
+
+  // Assemble the constraints Az <= b.
+  InequalityRows rows;
+  AddLinearConstraintRows(prog, prog.linear_constraints(), &rows);
+  AddLinearConstraintRows(prog, prog.linear_equality_constraints(), &rows);
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    const Eigen::VectorXd& lb = binding.evaluator()->lower_bound();
+    const Eigen::VectorXd& ub = binding.evaluator()->upper_bound();
+    for (int i = 0; i < binding.variables().rows(); ++i) {
+      rows.AddRange({prog.FindDecisionVariableIndex(binding.variables()(i))},
+                    Eigen::RowVectorXd::Ones(1), lb(i), ub(i));
+    }
+  }
+  // FBstabDense requires at least one inequality, so an unconstrained
+  // program gets the trivially satisfied 0'z <= 1.
+  if (rows.num_rows == 0) {
+    rows.b.push_back(1);
+    rows.num_rows = 1;
+  }
+  const int nv = rows.num_rows;
+  Eigen::SparseMatrix<double> A_sparse(nv, nz);
+  A_sparse.setFromTriplets(rows.triplets.begin(), rows.triplets.end());
+  const Eigen::MatrixXd A(A_sparse);
+  const Eigen::VectorXd b =
+      Eigen::Map<const Eigen::VectorXd>(rows.b.data(), nv);
+
+  FBstabDense solver(nz, nv);
+  SetFbstabOptions(merged_options, &solver);
+
+  // Warm start the primal variables from the initial guess (unset entries
+  // start at zero); the duals and constraint margins start at zero.
+  Eigen::VectorXd z = initial_guess.unaryExpr(
+      [](double val) { return std::isnan(val) ? 0.0 : val; });
+  Eigen::VectorXd v = Eigen::VectorXd::Zero(nv);
+  Eigen::VectorXd y = Eigen::VectorXd::Zero(nv);
+  const FBstabDense::QPData data{&H, &A, &f, &b};
+  const FBstabDense::QPVariable x{&z, &v, &y};
+  const fbstab::SolverOut out = solver.Solve(data, &x);
+
+  const SolutionResult solution_result = ConvertExitFlag(out.eflag);
+  result->set_x_val(z);
+  result->set_solution_result(solution_result);
+  switch (solution_result) {
+    case SolutionResult::kSolutionFound: {
+      result->set_optimal_cost(0.5 * z.dot(H * z) + f.dot(z) + constant_term);
+      break;
+    }
+    case SolutionResult::kUnbounded: {
+      result->set_optimal_cost(MathematicalProgram::kUnboundedCost);
+      break;
+    }
+    case SolutionResult::kInfeasibleConstraints: {
+      result->set_optimal_cost(MathematicalProgram::kGlobalInfeasibleCost);
+      break;
+    }
+    default: {
+      result->set_optimal_cost(NAN);
+    }
+  }
+}
+
+SolverId FbstabSolver::id() {
+  static const never_destroyed<SolverId> singleton{"FBstab"};
+  return singleton.access();
+}
+
+bool FbstabSolver::is_available() { return true; }
+
+bool FbstabSolver::is_enabled() { return true; }
+
+bool FbstabSolver::ProgramAttributesSatisfied(
+    const MathematicalProgram& prog) {
+  static const never_destroyed<ProgramAttributes> solver_capabilities(
+      std::initializer_list<ProgramAttribute>{
+          ProgramAttribute::kLinearCost, ProgramAttribute::kQuadraticCost,
+          ProgramAttribute::kLinearConstraint,
+          ProgramAttribute::kLinearEqualityConstraint});
+  return AreRequiredAttributesSupported(prog.required_capabilities(),
+                                        solver_capabilities.access());
+}
+
+}  // namespace solvers
+}  // namespace drake
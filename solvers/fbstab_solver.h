@@ -0,0 +1,54 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/solver_base.h"
+
+namespace drake {
+namespace solvers {
+
+/**
+ * Solves convex quadratic programs with the dense variant of FBstab, see
+ * solvers/fbstab/fbstab_dense.h and https://arxiv.org/pdf/1901.04046.pdf.
+ *
+ * The program is converted to
+ *
+ *     min.  1/2 z'*H*z + f'*z
+ *     s.t.  Az <= b
+ *
+ * where each linear equality (and each pair of lower and upper bounds with
+ * lb == ub) becomes a pair of opposing inequalities, and infinite bounds are
+ * dropped. The Hessian H must be positive semidefinite; this is not checked.
+ *
+ * The initial guess is used to warm start the primal variables.
+ *
+ * Integer and double options keyed by FbstabSolver::id() are forwarded to
+ * FBstabDense::UpdateOption() (for example "abs_tol", "max_newton_iters").
+ * The integer options "check_feasibility" and "record_solve_time" are
+ * interpreted as booleans. Setting CommonSolverOption::kPrintToConsole to 1
+ * prints a summary after the solve.
+ */
+class FbstabSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FbstabSolver)
+
+  FbstabSolver();
+  ~FbstabSolver() final;
+
+  /// @name Static versions of the instance methods with similar names.
+  //@{
+  static SolverId id();
+  static bool is_available();
+  static bool is_enabled();
+  static bool ProgramAttributesSatisfied(const MathematicalProgram&);
+  //@}
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+};
+
+}  // namespace solvers
+}  // namespace drake
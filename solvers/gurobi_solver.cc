@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
@@ -311,6 +312,45 @@ __attribute__((unused)) bool HasCorrectNumberOfVariables(
   return (num_vars == num_vars_expected);
 }
 
+// The data of a Gurobi model, as DoSolve() assembles it from a
+// MathematicalProgram before handing it to Gurobi in BuildGurobiModel(). A
+// persistent model (see GurobiSolver::set_use_persistent_model()) keeps the
+// data it was last built or updated from, so that UpdateGurobiModel() can push
+// to Gurobi only what differs in the data of the next program.
+struct GurobiModelData {
+  // The type, bounds and linear cost coefficient of each Gurobi variable.
+  std::vector<char> var_type;
+  std::vector<double> xlow;
+  std::vector<double> xupp;
+  std::vector<double> obj;
+  // The quadratic cost terms, as (row, column, value) triplets.
+  std::vector<int> Q_row;
+  std::vector<int> Q_col;
+  std::vector<double> Q_val;
+  // The linear constraint rows, with the Gurobi variable indices and the
+  // values of their non-zero coefficients, their senses and right-hand sides.
+  std::vector<std::vector<int>> row_ind;
+  std::vector<std::vector<double>> row_val;
+  std::vector<char> sense;
+  std::vector<double> rhs;
+  // The quadratic constraints z' * Q * z <= 0 of the second order cones, with
+  // Q in (row, column, value) triplets.
+  std::vector<std::vector<int>> qconstr_row;
+  std::vector<std::vector<int>> qconstr_col;
+  std::vector<std::vector<double>> qconstr_val;
+
+  int num_linear_constraints() const { return static_cast<int>(rhs.size()); }
+
+  // Appends the linear constraint row `sum(val[k] * x[ind[k]]) sense rhs`.
+  void AddRow(const std::vector<int>& ind, const std::vector<double>& val,
+              char row_sense, double row_rhs) {
+    row_ind.push_back(ind);
+    row_val.push_back(val);
+    sense.push_back(row_sense);
+    rhs.push_back(row_rhs);
+  }
+};
+
 /**
  * Adds a constraint of one of the following forms :
  * lb ≤ A*x ≤ ub
@@ -319,66 +359,43 @@ __attribute__((unused)) bool HasCorrectNumberOfVariables(
  *
  * @param is_equality True if the imposed constraint is
  * A*x == lb, false otherwise.
- * @return error as an integer. The full set of error values are
- * described here :
- * https://www.gurobi.com/documentation/9.0/refman/error_codes.html
  *
  * TODO(hongkai.dai): Use a sparse matrix A.
  */
 template <typename DerivedA, typename DerivedLB, typename DerivedUB>
-int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
-                        const Eigen::MatrixBase<DerivedA>& A,
-                        const Eigen::MatrixBase<DerivedLB>& lb,
-                        const Eigen::MatrixBase<DerivedUB>& ub,
-                        const Eigen::Ref<const VectorXDecisionVariable>& vars,
-                        bool is_equality, double sparseness_threshold,
-                        int* num_gurobi_linear_constraints) {
+void AddLinearConstraint(const MathematicalProgram& prog,
+                         const Eigen::MatrixBase<DerivedA>& A,
+                         const Eigen::MatrixBase<DerivedLB>& lb,
+                         const Eigen::MatrixBase<DerivedUB>& ub,
+                         const Eigen::Ref<const VectorXDecisionVariable>& vars,
+                         bool is_equality, double sparseness_threshold,
+                         GurobiModelData* data) {
   for (int i = 0; i < A.rows(); i++) {
-    int nonzero_coeff_count = 0;
-    std::vector<int> nonzero_var_index(A.cols(), 0);
-    std::vector<double> nonzero_coeff(A.cols(), 0.0);
+    std::vector<int> nonzero_var_index;
+    std::vector<double> nonzero_coeff;
 
     for (int j = 0; j < A.cols(); j++) {
       if (std::abs(A(i, j)) > sparseness_threshold) {
-        nonzero_coeff[nonzero_coeff_count] = A(i, j);
-        nonzero_var_index[nonzero_coeff_count++] =
-            prog.FindDecisionVariableIndex(vars(j));
+        nonzero_coeff.push_back(A(i, j));
+        nonzero_var_index.push_back(prog.FindDecisionVariableIndex(vars(j)));
       }
     }
     // The sense of the constraint could be ==, <= or >=
-    int error = 0;
     if (is_equality) {
       // Adds equality constraint.
-      error = GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_EQUAL, lb(i), nullptr);
-      (*num_gurobi_linear_constraints)++;
-      DRAKE_ASSERT(!error);
-      if (error) return error;
+      data->AddRow(nonzero_var_index, nonzero_coeff, GRB_EQUAL, lb(i));
     } else {
-      if (!std::isinf(ub(i)) || !std::isinf(lb(i))) {
-        if (!std::isinf(lb(i))) {
-          // Adds A.row(i)*x >= lb(i).
-          error = GRBaddconstr(model, nonzero_coeff_count,
-                               &nonzero_var_index[0], &nonzero_coeff[0],
-                               GRB_GREATER_EQUAL, lb(i), nullptr);
-          DRAKE_ASSERT(!error);
-          (*num_gurobi_linear_constraints)++;
-          if (error) return error;
-        }
-        if (!std::isinf(ub(i))) {
-          // Adds A.row(i)*x <= ub(i).
-          error =
-              GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_LESS_EQUAL, ub(i), nullptr);
-          DRAKE_ASSERT(!error);
-          (*num_gurobi_linear_constraints)++;
-          if (error) return error;
-        }
+      if (!std::isinf(lb(i))) {
+        // Adds A.row(i)*x >= lb(i).
+        data->AddRow(nonzero_var_index, nonzero_coeff, GRB_GREATER_EQUAL,
+                     lb(i));
+      }
+      if (!std::isinf(ub(i))) {
+        // Adds A.row(i)*x <= ub(i).
+        data->AddRow(nonzero_var_index, nonzero_coeff, GRB_LESS_EQUAL, ub(i));
       }
     }
   }
-  // If loop completes, no errors exist so the value '0' must be returned.
-  return 0;
 }
 
 /*
@@ -398,17 +415,16 @@ int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
  * \p sparseness_threshold, that entry is ignored.
  * @param second_order_cone_new_variable_indices. The indices of variable z in
  * the Gurobi model.
- * @param model The Gurobi model.
- * @param[in, out] num_gurobi_linear_constraints The number of linear
- * constraints stored in the gurobi model.
+ * @param[in, out] data The Gurobi model data, to which the constraints are
+ * appended.
  */
 template <typename C>
-int AddSecondOrderConeConstraints(
+void AddSecondOrderConeConstraints(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& second_order_cone_constraints,
     double sparseness_threshold,
     const std::vector<std::vector<int>>& second_order_cone_new_variable_indices,
-    GRBmodel* model, int* num_gurobi_linear_constraints) {
+    GurobiModelData* data) {
   static_assert(
       std::is_same<C, LorentzConeConstraint>::value ||
           std::is_same<C, RotatedLorentzConeConstraint>::value,
@@ -459,28 +475,9 @@ int AddSecondOrderConeConstraints(
       M_rows_col[i].push_back(xz_indices[num_x + i]);
       M_rows_val[i].push_back(1.0);
     }
-    // M_val, M_beg, M_ind stores M in compressed sparse row format.
-    std::vector<double> M_val;
-    M_val.reserve(A.nonZeros() + num_z);
-    std::vector<int> M_beg(num_z + 1);
-    std::vector<int> M_ind;
-    M_ind.reserve(A.nonZeros() + num_z);
-    int M_nonzero_count = 0;
     for (int i = 0; i < num_z; ++i) {
-      M_beg[i] = M_nonzero_count;
-      M_val.insert(M_val.end(), M_rows_val[i].begin(), M_rows_val[i].end());
-      M_ind.insert(M_ind.end(), M_rows_col[i].begin(), M_rows_col[i].end());
-      M_nonzero_count += static_cast<int>(M_rows_val[i].size());
+      data->AddRow(M_rows_col[i], M_rows_val[i], GRB_EQUAL, b(i));
     }
-    M_beg[num_z] = M_nonzero_count;
-
-    std::vector<char> sense(num_z, GRB_EQUAL);
-
-    int error = GRBaddconstrs(model, num_z, M_nonzero_count, M_beg.data(),
-                              M_ind.data(), M_val.data(), sense.data(),
-                              const_cast<double*>(b.data()), nullptr);
-    DRAKE_ASSERT(!error);
-    *num_gurobi_linear_constraints += num_z;
 
     // Gurobi uses a matrix Q to differentiate Lorentz cone and rotated Lorentz
     // cone constraint.
@@ -533,22 +530,18 @@ int AddSecondOrderConeConstraints(
       qcol[num_z - 1] = z1_index;
       qval[num_z - 1] = 1;
     }
-    error =
-        GRBaddqconstr(model, 0, nullptr, nullptr, num_Q_nonzero, qrow.data(),
-                      qcol.data(), qval.data(), GRB_LESS_EQUAL, 0.0, NULL);
-    if (error) {
-      return error;
-    }
+    data->qconstr_row.push_back(std::move(qrow));
+    data->qconstr_col.push_back(std::move(qcol));
+    data->qconstr_val.push_back(std::move(qval));
     ++second_order_cone_count;
   }
-  return 0;
 }
 
 /*
  * Add quadratic or linear costs to the optimization problem.
  */
-int AddCosts(GRBmodel* model, double* pconstant_cost,
-             const MathematicalProgram& prog, double sparseness_threshold) {
+void AddCosts(const MathematicalProgram& prog, double sparseness_threshold,
+              double* pconstant_cost, GurobiModelData* data) {
   // Aggregates the quadratic costs and linear costs in the form
   // 0.5 * x' * Q_all * x + linear_term' * x.
   using std::abs;
@@ -621,77 +614,49 @@ int AddCosts(GRBmodel* model, double* pconstant_cost,
   drake::math::SparseMatrixToRowColumnValueVectors(Q_all, Q_all_row, Q_all_col,
                                                    Q_all_val);
 
-  std::vector<int> Q_all_row_indices_int(Q_all_row.size());
-  std::vector<int> Q_all_col_indices_int(Q_all_col.size());
-  for (int i = 0; i < static_cast<int>(Q_all_row_indices_int.size()); i++) {
-    Q_all_row_indices_int[i] = static_cast<int>(Q_all_row[i]);
-    Q_all_col_indices_int[i] = static_cast<int>(Q_all_col[i]);
+  data->Q_row.resize(Q_all_row.size());
+  data->Q_col.resize(Q_all_col.size());
+  for (int i = 0; i < static_cast<int>(Q_all_row.size()); i++) {
+    data->Q_row[i] = static_cast<int>(Q_all_row[i]);
+    data->Q_col[i] = static_cast<int>(Q_all_col[i]);
   }
+  data->Q_val = std::move(Q_all_val);
 
   std::vector<Eigen::Index> linear_row;
   std::vector<Eigen::Index> linear_col;
   std::vector<double> linear_val;
   drake::math::SparseMatrixToRowColumnValueVectors(linear_terms, linear_row,
                                                    linear_col, linear_val);
-
-  std::vector<int> linear_row_indices_int(linear_row.size());
-  for (int i = 0; i < static_cast<int>(linear_row_indices_int.size()); i++) {
-    linear_row_indices_int[i] = static_cast<int>(linear_row[i]);
-  }
-
-  const int QPtermsError = GRBaddqpterms(
-      model, static_cast<int>(Q_all_row.size()), Q_all_row_indices_int.data(),
-      Q_all_col_indices_int.data(), Q_all_val.data());
-  if (QPtermsError) {
-    return QPtermsError;
-  }
   for (int i = 0; i < static_cast<int>(linear_row.size()); i++) {
-    const int LinearTermError = GRBsetdblattrarray(
-        model, "Obj", linear_row_indices_int[i], 1, linear_val.data() + i);
-    if (LinearTermError) {
-      return LinearTermError;
-    }
+    data->obj[linear_row[i]] = linear_val[i];
   }
-  // If loop completes, no errors exist so the value '0' must be returned.
-  return 0;
 }
 
 // Add both LinearConstraints and LinearEqualityConstraints to gurobi
 // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
-int ProcessLinearConstraints(
-    GRBmodel* model, const MathematicalProgram& prog,
-    double sparseness_threshold, int* num_gurobi_linear_constraints,
+void ProcessLinearConstraints(
+    const MathematicalProgram& prog, double sparseness_threshold,
+    GurobiModelData* data,
     std::unordered_map<Binding<Constraint>, int>* constraint_dual_start_row) {
   for (const auto& binding : prog.linear_equality_constraints()) {
     const auto& constraint = binding.evaluator();
 
-    constraint_dual_start_row->emplace(binding, *num_gurobi_linear_constraints);
+    constraint_dual_start_row->emplace(binding, data->num_linear_constraints());
 
-    const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
-        constraint->upper_bound(), binding.variables(), true,
-        sparseness_threshold, num_gurobi_linear_constraints);
-    if (error) {
-      return error;
-    }
+    AddLinearConstraint(prog, constraint->A(), constraint->lower_bound(),
+                        constraint->upper_bound(), binding.variables(), true,
+                        sparseness_threshold, data);
   }
 
   for (const auto& binding : prog.linear_constraints()) {
     const auto& constraint = binding.evaluator();
 
-    constraint_dual_start_row->emplace(binding, *num_gurobi_linear_constraints);
+    constraint_dual_start_row->emplace(binding, data->num_linear_constraints());
 
-    const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
-        constraint->upper_bound(), binding.variables(), false,
-        sparseness_threshold, num_gurobi_linear_constraints);
-    if (error) {
-      return error;
-    }
+    AddLinearConstraint(prog, constraint->A(), constraint->lower_bound(),
+                        constraint->upper_bound(), binding.variables(), false,
+                        sparseness_threshold, data);
   }
-
-  // If loop completes, no errors exist so the value '0' must be returned.
-  return 0;
 }
 
 // For Lorentz and rotated Lorentz cone constraints
@@ -768,6 +733,154 @@ void AddSecondOrderConeVariables(
     }
   }
 }
+
+// Creates in `model` a Gurobi model with the variables, costs and constraints
+// of `data`.
+// @return error as an integer. The full set of error values are described in
+// https://www.gurobi.com/documentation/9.0/refman/error_codes.html
+int BuildGurobiModel(GRBenv* env, const GurobiModelData& data,
+                     GRBmodel** model) {
+  const int num_vars = static_cast<int>(data.var_type.size());
+  int error = GRBnewmodel(env, model, "gurobi_model", num_vars,
+                          const_cast<double*>(data.obj.data()),
+                          const_cast<double*>(data.xlow.data()),
+                          const_cast<double*>(data.xupp.data()),
+                          const_cast<char*>(data.var_type.data()), nullptr);
+  if (error) return error;
+
+  error = GRBaddqpterms(*model, static_cast<int>(data.Q_val.size()),
+                        const_cast<int*>(data.Q_row.data()),
+                        const_cast<int*>(data.Q_col.data()),
+                        const_cast<double*>(data.Q_val.data()));
+  if (error) return error;
+
+  // Gurobi expects the linear constraints in compressed sparse row format.
+  const int num_rows = data.num_linear_constraints();
+  std::vector<int> beg(num_rows);
+  std::vector<int> ind;
+  std::vector<double> val;
+  for (int i = 0; i < num_rows; ++i) {
+    beg[i] = static_cast<int>(ind.size());
+    ind.insert(ind.end(), data.row_ind[i].begin(), data.row_ind[i].end());
+    val.insert(val.end(), data.row_val[i].begin(), data.row_val[i].end());
+  }
+  error = GRBaddconstrs(*model, num_rows, static_cast<int>(ind.size()),
+                        beg.data(), ind.data(), val.data(),
+                        const_cast<char*>(data.sense.data()),
+                        const_cast<double*>(data.rhs.data()), nullptr);
+  if (error) return error;
+
+  for (int i = 0; i < static_cast<int>(data.qconstr_val.size()); ++i) {
+    error = GRBaddqconstr(*model, 0, nullptr, nullptr,
+                          static_cast<int>(data.qconstr_val[i].size()),
+                          const_cast<int*>(data.qconstr_row[i].data()),
+                          const_cast<int*>(data.qconstr_col[i].data()),
+                          const_cast<double*>(data.qconstr_val[i].data()),
+                          GRB_LESS_EQUAL, 0.0, nullptr);
+    if (error) return error;
+  }
+  return 0;
+}
+
+// Returns true if a Gurobi model built from `previous` can be updated to
+// `data` by UpdateGurobiModel(), namely if both have the same variable types,
+// the same senses of the linear constraint rows and the same quadratic
+// constraints.
+bool HasSameStructure(const GurobiModelData& previous,
+                      const GurobiModelData& data) {
+  return previous.var_type == data.var_type && previous.sense == data.sense &&
+         previous.qconstr_row == data.qconstr_row &&
+         previous.qconstr_col == data.qconstr_col &&
+         previous.qconstr_val == data.qconstr_val;
+}
+
+// Sets the elements of the double attribute `name` of `model` for which
+// `values` differs from `previous_values`.
+int SetChangedAttributeElements(GRBmodel* model, const char* name,
+                                const std::vector<double>& previous_values,
+                                const std::vector<double>& values) {
+  DRAKE_ASSERT(previous_values.size() == values.size());
+  std::vector<int> changed_ind;
+  std::vector<double> changed_val;
+  for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+    if (values[i] != previous_values[i]) {
+      changed_ind.push_back(i);
+      changed_val.push_back(values[i]);
+    }
+  }
+  if (changed_ind.empty()) return 0;
+  return GRBsetdblattrlist(model, name, static_cast<int>(changed_ind.size()),
+                           changed_ind.data(), changed_val.data());
+}
+
+// Updates `model`, built from or last updated to `previous`, to `data`, which
+// must have the same structure (see HasSameStructure()). Only the variable
+// bounds, cost coefficients, linear constraint coefficients and right-hand
+// sides that differ are pushed to Gurobi, which lets it reuse the information
+// of its previous solve, e.g. the simplex basis.
+// @return error as an integer. The full set of error values are described in
+// https://www.gurobi.com/documentation/9.0/refman/error_codes.html
+int UpdateGurobiModel(const GurobiModelData& previous,
+                      const GurobiModelData& data, GRBmodel* model) {
+  DRAKE_ASSERT(HasSameStructure(previous, data));
+  int error =
+      SetChangedAttributeElements(model, GRB_DBL_ATTR_LB, previous.xlow,
+                                  data.xlow);
+  if (!error) {
+    error = SetChangedAttributeElements(model, GRB_DBL_ATTR_UB, previous.xupp,
+                                        data.xupp);
+  }
+  if (!error) {
+    error = SetChangedAttributeElements(model, GRB_DBL_ATTR_OBJ, previous.obj,
+                                        data.obj);
+  }
+  if (!error) {
+    error = SetChangedAttributeElements(model, GRB_DBL_ATTR_RHS, previous.rhs,
+                                        data.rhs);
+  }
+  if (error) return error;
+
+  if (previous.Q_row != data.Q_row || previous.Q_col != data.Q_col ||
+      previous.Q_val != data.Q_val) {
+    error = GRBdelq(model);
+    if (error) return error;
+    error = GRBaddqpterms(model, static_cast<int>(data.Q_val.size()),
+                          const_cast<int*>(data.Q_row.data()),
+                          const_cast<int*>(data.Q_col.data()),
+                          const_cast<double*>(data.Q_val.data()));
+    if (error) return error;
+  }
+
+  // The changed coefficients of the linear constraints, including the ones
+  // that are no longer present, which are set to zero.
+  std::vector<int> changed_row;
+  std::vector<int> changed_col;
+  std::vector<double> changed_val;
+  for (int i = 0; i < data.num_linear_constraints(); ++i) {
+    if (previous.row_ind[i] == data.row_ind[i] &&
+        previous.row_val[i] == data.row_val[i]) {
+      continue;
+    }
+    std::map<int, double> coefficients;
+    for (int k = 0; k < static_cast<int>(previous.row_ind[i].size()); ++k) {
+      coefficients[previous.row_ind[i][k]] = 0;
+    }
+    for (int k = 0; k < static_cast<int>(data.row_ind[i].size()); ++k) {
+      coefficients[data.row_ind[i][k]] += data.row_val[i][k];
+    }
+    for (const auto& [col, val] : coefficients) {
+      changed_row.push_back(i);
+      changed_col.push_back(col);
+      changed_val.push_back(val);
+    }
+  }
+  if (!changed_row.empty()) {
+    error = GRBchgcoeffs(model, static_cast<int>(changed_row.size()),
+                         changed_row.data(), changed_col.data(),
+                         changed_val.data());
+  }
+  return error;
+}
 }  // anonymous namespace
 
 bool GurobiSolver::is_available() { return true; }
@@ -814,6 +927,37 @@ std::shared_ptr<GurobiSolver::License> GurobiSolver::AcquireLicense() {
   return GetScopedSingleton<GurobiSolver::License>();
 }
 
+/*
+ * The Gurobi model kept between the calls to Solve() when
+ * set_use_persistent_model() is enabled, with the data it was last built or
+ * updated from and the solution of its last successful solve.
+ */
+class GurobiSolver::PersistentModel {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PersistentModel)
+
+  explicit PersistentModel(std::shared_ptr<License> license)
+      : license_(std::move(license)) {}
+
+  ~PersistentModel() { Free(); }
+
+  void Free() {
+    GRBfreemodel(model);
+    model = nullptr;
+    solution.clear();
+  }
+
+  GRBmodel* model{nullptr};
+  GurobiModelData data;
+  // The values of all the Gurobi variables, or empty if the model has not
+  // been solved successfully yet.
+  std::vector<double> solution;
+
+ private:
+  // Keeps the environment of `model` alive.
+  std::shared_ptr<License> license_;
+};
+
 // TODO(hongkai.dai@tri.global): break this large DoSolve function to smaller
 // ones.
 void GurobiSolver::DoSolve(
@@ -946,45 +1090,70 @@ void GurobiSolver::DoSolve(
                               &rotated_lorentz_cone_new_variable_indices,
                               &gurobi_var_type, &xlow, &xupp);
 
-  GRBmodel* model = nullptr;
-  GRBnewmodel(env, &model, "gurobi_model", num_gurobi_vars, nullptr, &xlow[0],
-              &xupp[0], gurobi_var_type.data(), nullptr);
-  ScopeExit guard([model]() {
-    GRBfreemodel(model);
-  });
+  GurobiModelData model_data;
+  model_data.var_type = std::move(gurobi_var_type);
+  model_data.xlow = std::move(xlow);
+  model_data.xupp = std::move(xupp);
+  model_data.obj.resize(num_gurobi_vars, 0.0);
 
-  int error = 0;
   // TODO(naveenoid) : This needs access externally.
   double sparseness_threshold = 1e-14;
   double constant_cost = 0;
-  if (!error) {
-    error = AddCosts(model, &constant_cost, prog, sparseness_threshold);
-  }
+  AddCosts(prog, sparseness_threshold, &constant_cost, &model_data);
 
-  int num_gurobi_linear_constraints = 0;
-  if (!error) {
-    error = ProcessLinearConstraints(model, prog, sparseness_threshold,
-                                     &num_gurobi_linear_constraints,
-                                     &constraint_dual_start_row);
-  }
+  ProcessLinearConstraints(prog, sparseness_threshold, &model_data,
+                           &constraint_dual_start_row);
 
   // Add Lorentz cone constraints.
-  if (!error) {
-    error = AddSecondOrderConeConstraints(
-        prog, prog.lorentz_cone_constraints(), sparseness_threshold,
-        lorentz_cone_new_variable_indices, model,
-        &num_gurobi_linear_constraints);
-  }
+  AddSecondOrderConeConstraints(prog, prog.lorentz_cone_constraints(),
+                                sparseness_threshold,
+                                lorentz_cone_new_variable_indices, &model_data);
 
   // Add rotated Lorentz cone constraints.
-  if (!error) {
-    error = AddSecondOrderConeConstraints(
-        prog, prog.rotated_lorentz_cone_constraints(), sparseness_threshold,
-        rotated_lorentz_cone_new_variable_indices, model,
-        &num_gurobi_linear_constraints);
+  AddSecondOrderConeConstraints(
+      prog, prog.rotated_lorentz_cone_constraints(), sparseness_threshold,
+      rotated_lorentz_cone_new_variable_indices, &model_data);
+
+  const int num_gurobi_linear_constraints =
+      model_data.num_linear_constraints();
+
+  // With a persistent model, the model of the previous solve is updated to
+  // this program if it has the same structure, and rebuilt otherwise.
+  PersistentModel* persistent = nullptr;
+  if (use_persistent_model_) {
+    if (!persistent_model_) {
+      persistent_model_ = std::make_shared<PersistentModel>(license_);
+    }
+    persistent = persistent_model_.get();
+  }
+  GRBmodel* model = nullptr;
+  int error = 0;
+  if (persistent != nullptr && persistent->model != nullptr &&
+      HasSameStructure(persistent->data, model_data) &&
+      !UpdateGurobiModel(persistent->data, model_data, persistent->model)) {
+    model = persistent->model;
+  } else {
+    if (persistent != nullptr) {
+      persistent->Free();
+    }
+    error = BuildGurobiModel(env, model_data, &model);
+    if (persistent != nullptr && !error) {
+      persistent->model = model;
+    }
+  }
+  const bool is_persistent =
+      persistent != nullptr && persistent->model != nullptr;
+  if (is_persistent) {
+    persistent->data = std::move(model_data);
   }
+  ScopeExit guard([model, is_persistent]() {
+    if (!is_persistent) {
+      GRBfreemodel(model);
+    }
+  });
 
-  DRAKE_ASSERT(HasCorrectNumberOfVariables(model, is_new_variable.size()));
+  DRAKE_ASSERT(error ||
+               HasCorrectNumberOfVariables(model, is_new_variable.size()));
 
   // The new model gets a copy of the Gurobi environment, so when we set
   // parameters, we have to be sure to set them on the model's environment,
@@ -995,6 +1164,12 @@ void GurobiSolver::DoSolve(
   GRBenv* model_env = GRBgetenv(model);
   DRAKE_DEMAND(model_env);
 
+  // A persistent model keeps the parameters of its previous solve, which are
+  // reset to only apply the options of this one.
+  if (!error && is_persistent) {
+    error = GRBresetparams(model_env);
+  }
+
   // Corresponds to no console or file logging (this is the default, which
   // can be overridden by parameters set in the MathematicalProgram).
   if (!error) {
@@ -1012,9 +1187,26 @@ void GurobiSolver::DoSolve(
     }
   }
 
-  for (int i = 0; i < static_cast<int>(prog.num_vars()); ++i) {
-    if (!error && !std::isnan(initial_guess(i))) {
-      error = GRBsetdblattrelement(model, "Start", i, initial_guess(i));
+  if (is_persistent) {
+    // Start from the solution of the previous solve, e.g. as the MIP start of
+    // a mixed-integer program, except for the variables with an initial
+    // guess.
+    std::vector<double> start = persistent->solution;
+    start.resize(num_gurobi_vars, GRB_UNDEFINED);
+    for (int i = 0; i < num_prog_vars; ++i) {
+      if (!std::isnan(initial_guess(i))) {
+        start[i] = initial_guess(i);
+      }
+    }
+    if (!error) {
+      error = GRBsetdblattrarray(model, "Start", 0, num_gurobi_vars,
+                                 start.data());
+    }
+  } else {
+    for (int i = 0; i < static_cast<int>(prog.num_vars()); ++i) {
+      if (!error && !std::isnan(initial_guess(i))) {
+        error = GRBsetdblattrelement(model, "Start", i, initial_guess(i));
+      }
     }
   }
 
@@ -1044,6 +1236,9 @@ void GurobiSolver::DoSolve(
     if (!error) {
       error = GRBsetcallbackfunc(model, &gurobi_callback, &callback_info);
     }
+  } else if (!error && is_persistent) {
+    // Unregisters the callback of a previous solve.
+    error = GRBsetcallbackfunc(model, nullptr, nullptr);
   }
 
   if (!error) {
@@ -1100,6 +1295,9 @@ void GurobiSolver::DoSolve(
       std::vector<double> solver_sol_vector(num_total_variables);
       GRBgetdblattrarray(model, GRB_DBL_ATTR_X, 0, num_total_variables,
                          solver_sol_vector.data());
+      if (is_persistent) {
+        persistent->solution = solver_sol_vector;
+      }
       Eigen::VectorXd prog_sol_vector(num_prog_vars);
       SetProgramSolutionVector(is_new_variable, solver_sol_vector,
                                &prog_sol_vector);
@@ -125,6 +125,27 @@ class GurobiSolver final : public SolverBase {
     mip_sol_callback_ = callback;
   }
 
+  /// Sets whether the Gurobi model is kept between the calls to Solve(), to
+  /// speed up the re-solves of a program whose coefficients or bounds change
+  /// between them, e.g. in model predictive control or when tightening the
+  /// bounds of a mixed-integer program. When enabled, each Solve() compares the
+  /// program with the kept model: if they have the same variables (with the
+  /// same types), the same linear constraint rows (with the same senses) and
+  /// the same (rotated) Lorentz cones, only the variable bounds, cost
+  /// coefficients and linear constraint coefficients and bounds that changed
+  /// are pushed to Gurobi; otherwise, the model is rebuilt. The solution of
+  /// the previous Solve() is also given to Gurobi as the start (i.e., the MIP
+  /// start of a mixed-integer program) of the variables whose initial guess is
+  /// NaN. The model is kept whichever program it was built from, so the same
+  /// GurobiSolver should only be used to re-solve one program, and must not be
+  /// used to solve several programs concurrently. Disabling it frees the kept
+  /// model. It is disabled by default.
+  void set_use_persistent_model(bool use_persistent_model);
+
+  /// Returns whether the Gurobi model is kept between the calls to Solve().
+  /// @see set_use_persistent_model().
+  bool use_persistent_model() const { return use_persistent_model_; }
+
   /**
    * This type contains a valid Gurobi license environment, and is only to be
    * used from AcquireLicense().
@@ -168,6 +189,11 @@ class GurobiSolver final : public SolverBase {
   // during the first call of Solve() (which avoids grabbing a Gurobi license
   // before we know that we actually want one).
   mutable std::shared_ptr<License> license_;
+  // The Gurobi model kept between the calls to Solve(), or null if none has
+  // been built yet or set_use_persistent_model() is disabled.
+  class PersistentModel;
+  bool use_persistent_model_{false};
+  mutable std::shared_ptr<PersistentModel> persistent_model_;
   // Callbacks and generic user data to pass through,
   // or NULL if no callback has been supplied.
   MipNodeCallbackFunction mip_node_callback_;
@@ -20,6 +20,13 @@ GurobiSolver::GurobiSolver()
 
 GurobiSolver::~GurobiSolver() = default;
 
+void GurobiSolver::set_use_persistent_model(bool use_persistent_model) {
+  use_persistent_model_ = use_persistent_model;
+  if (!use_persistent_model_) {
+    persistent_model_.reset();
+  }
+}
+
 SolverId GurobiSolver::id() {
   static const never_destroyed<SolverId> singleton{"Gurobi"};
   return singleton.access();
@@ -1,8 +1,10 @@
 #include "drake/solvers/ipopt_solver.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -137,7 +139,13 @@ void SetAllConstraintDualSolution(
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  const std::optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern = c.gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    *num_grad = static_cast<Index>(gradient_sparsity_pattern.value().size());
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -152,6 +160,10 @@ int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
 /// described in
 /// http://www.coin-or.org/Ipopt/documentation/node38.html#app.triplet
 ///
+/// If the constraint declares a gradient sparsity pattern, only those entries
+/// are reported, so that IPOPT's sparse linear solver sees the actual
+/// structure of the Jacobian.
+///
 /// @return the number of row/column pairs filled in.
 size_t GetGradientMatrix(
     const MathematicalProgram& prog, const Constraint& c,
@@ -160,6 +172,18 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  const std::optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern = c.gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
+      iRow[grad_index] = constraint_idx + nonzero_entry.first;
+      jCol[grad_index] =
+          prog.FindDecisionVariableIndex(variables(nonzero_entry.second));
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -232,6 +256,17 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   size_t grad_idx = 0;
 
   DRAKE_ASSERT(ty.rows() == c.num_constraints());
+  const std::optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern = c.gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
+      grad[grad_idx++] =
+          ty(nonzero_entry.first).derivatives().size() > 0
+              ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
+              : 0.0;
+    }
+    return grad_idx;
+  }
   for (int i = 0; i < ty.rows(); i++) {
     if (ty(i).derivatives().size() > 0) {
       for (int j = 0; j < variables.rows(); j++) {
@@ -296,6 +331,183 @@ struct ResultCache {
   bool grad_valid{false};
 };
 
+// The Hessian of the outputs of a cost or constraint binding with respect to
+// the decision variables, for the exact Hessian of the Lagrangian in eval_h().
+// The entries that are not identically zero are found once, by symbolic
+// differentiation of the evaluator, and are then evaluated at each x. The
+// evaluators that do not support symbolic evaluation (e.g., the ones that only
+// implement the double and AutoDiffXd versions of DoEval()) or whose outputs
+// are not differentiable symbolically instead get a dense Hessian, computed by
+// central differences of their AutoDiffXd gradients.
+class BindingHessian {
+ public:
+  // Finds the structure of the Hessian of `evaluator` bound to `variables`,
+  // and adds its entries in the lower triangle of the Hessian of the
+  // Lagrangian to `entries`, which maps each such (row, column) to its index
+  // in the values of eval_h().
+  BindingHessian(const MathematicalProgram& prog,
+                 std::shared_ptr<EvaluatorBase> evaluator,
+                 const VectorXDecisionVariable& variables,
+                 std::map<std::pair<Index, Index>, Index>* entries)
+      : evaluator_(std::move(evaluator)), variables_(variables) {
+    const int num_variables = variables_.rows();
+    variable_indices_.resize(num_variables);
+    unique_position_.resize(num_variables);
+    for (int i = 0; i < num_variables; ++i) {
+      variable_indices_[i] = prog.FindDecisionVariableIndex(variables_(i));
+      const auto it = std::find(unique_indices_.begin(), unique_indices_.end(),
+                                variable_indices_[i]);
+      unique_position_[i] = it - unique_indices_.begin();
+      if (it == unique_indices_.end()) {
+        unique_indices_.push_back(variable_indices_[i]);
+        unique_variables_.push_back(variables_(i));
+      }
+    }
+    const int num_unique = unique_indices_.size();
+
+    // Adds the (row, column) of the lower triangle for the unique variables a
+    // and b to `entries`, returning its index.
+    auto add_entry = [&](int a, int b) {
+      const Index i = unique_indices_[a];
+      const Index j = unique_indices_[b];
+      const std::pair<Index, Index> row_col(std::max(i, j), std::min(i, j));
+      return entries->emplace(row_col, static_cast<Index>(entries->size()))
+          .first->second;
+    };
+
+    try {
+      VectorX<symbolic::Expression> y;
+      evaluator_->Eval(variables_, &y);
+      std::vector<SymbolicEntry> symbolic_entries;
+      for (int k = 0; k < y.rows(); ++k) {
+        for (int a = 0; a < num_unique; ++a) {
+          const symbolic::Expression dy = y(k).Differentiate(
+              unique_variables_[a]);
+          if (is_zero(dy)) continue;
+          for (int b = 0; b < num_unique; ++b) {
+            if (unique_indices_[b] > unique_indices_[a]) continue;
+            symbolic::Expression d2y = dy.Differentiate(unique_variables_[b]);
+            if (!is_zero(d2y)) {
+              symbolic_entries.push_back({k, a, b, std::move(d2y)});
+            }
+          }
+        }
+      }
+      symbolic_entries_ = std::move(symbolic_entries);
+      is_symbolic_ = true;
+    } catch (const std::exception&) {
+      is_symbolic_ = false;
+    }
+
+    if (is_symbolic_) {
+      for (auto& entry : symbolic_entries_) {
+        entry.value_index = add_entry(entry.a, entry.b);
+      }
+    } else {
+      dense_value_indices_.resize(num_unique, num_unique);
+      for (int a = 0; a < num_unique; ++a) {
+        for (int b = 0; b < num_unique; ++b) {
+          dense_value_indices_(a, b) = add_entry(a, b);
+        }
+      }
+    }
+  }
+
+  // Adds to `values` the Hessian at `x` of the outputs of the evaluator,
+  // weighted by `weights`, one per output.
+  void AddWeightedHessian(const Eigen::VectorXd& x, const Number* weights,
+                          Number* values) const {
+    if (is_symbolic_) {
+      symbolic::Environment env;
+      for (int a = 0; a < static_cast<int>(unique_indices_.size()); ++a) {
+        env.insert(unique_variables_[a], x(unique_indices_[a]));
+      }
+      for (const auto& entry : symbolic_entries_) {
+        if (weights[entry.output] != 0) {
+          values[entry.value_index] +=
+              weights[entry.output] * entry.expression.Evaluate(env);
+        }
+      }
+      return;
+    }
+
+    const int num_unique = unique_indices_.size();
+    const Eigen::Map<const Eigen::VectorXd> w(weights,
+                                              evaluator_->num_outputs());
+    if (w.isZero()) return;
+    // The step of the central differences, which balances the truncation and
+    // the round-off errors.
+    const double kStep = std::cbrt(std::numeric_limits<double>::epsilon());
+    Eigen::VectorXd x_perturbed = x;
+    Eigen::MatrixXd H(num_unique, num_unique);
+    for (int b = 0; b < num_unique; ++b) {
+      const double x_b = x(unique_indices_[b]);
+      const double h = kStep * std::max(1.0, std::abs(x_b));
+      x_perturbed(unique_indices_[b]) = x_b + h;
+      const Eigen::MatrixXd J_plus = CalcJacobian(x_perturbed);
+      x_perturbed(unique_indices_[b]) = x_b - h;
+      const Eigen::MatrixXd J_minus = CalcJacobian(x_perturbed);
+      x_perturbed(unique_indices_[b]) = x_b;
+      H.col(b) = (J_plus - J_minus).transpose() * w / (2 * h);
+    }
+    for (int a = 0; a < num_unique; ++a) {
+      for (int b = 0; b < num_unique; ++b) {
+        if (unique_indices_[b] <= unique_indices_[a]) {
+          // Each entry of the lower triangle is added once, from the
+          // symmetric part of the differences.
+          values[dense_value_indices_(a, b)] +=
+              a == b ? H(a, a) : 0.5 * (H(a, b) + H(b, a));
+        }
+      }
+    }
+  }
+
+ private:
+  // An entry of the Hessian of one output, with respect to the unique
+  // variables a and b.
+  struct SymbolicEntry {
+    int output{};
+    int a{};
+    int b{};
+    symbolic::Expression expression;
+    Index value_index{};
+  };
+
+  // Returns the Jacobian of the outputs with respect to the unique variables.
+  Eigen::MatrixXd CalcJacobian(const Eigen::VectorXd& x) const {
+    Eigen::VectorXd this_x(variables_.rows());
+    for (int i = 0; i < variables_.rows(); ++i) {
+      this_x(i) = x(variable_indices_[i]);
+    }
+    AutoDiffVecXd y(evaluator_->num_outputs());
+    evaluator_->Eval(math::initializeAutoDiff(this_x), &y);
+    Eigen::MatrixXd J =
+        Eigen::MatrixXd::Zero(y.rows(), unique_indices_.size());
+    for (int k = 0; k < y.rows(); ++k) {
+      if (y(k).derivatives().size() == 0) continue;
+      for (int i = 0; i < variables_.rows(); ++i) {
+        J(k, unique_position_[i]) += y(k).derivatives()(i);
+      }
+    }
+    return J;
+  }
+
+  std::shared_ptr<EvaluatorBase> evaluator_;
+  VectorXDecisionVariable variables_;
+  // The index in the program of each of variables_.
+  std::vector<int> variable_indices_;
+  // The distinct variables in variables_, with their indices in the program,
+  // and the position in them of each of variables_.
+  std::vector<symbolic::Variable> unique_variables_;
+  std::vector<int> unique_indices_;
+  std::vector<int> unique_position_;
+  bool is_symbolic_{false};
+  std::vector<SymbolicEntry> symbolic_entries_;
+  // The index in the values of eval_h() of the Hessian with respect to the
+  // unique variables a and b, when it is computed by central differences.
+  Eigen::Matrix<Index, Eigen::Dynamic, Eigen::Dynamic> dense_value_indices_;
+};
+
 // The C++ interface for IPOPT is described here:
 // https://coin-or.github.io/Ipopt/INTERFACES.html#INTERFACE_CPP
 //
@@ -305,10 +517,15 @@ struct ResultCache {
 // the duration of the Solve() call.
 class IpoptSolver_NLP : public Ipopt::TNLP {
  public:
-  explicit IpoptSolver_NLP(const MathematicalProgram& problem,
-                           const Eigen::VectorXd& x_init,
-                           MathematicalProgramResult* result)
-      : problem_(&problem), x_init_{x_init}, result_(result) {}
+  // @param exact_hessian If true, the exact Hessian of the Lagrangian is
+  // provided to IPOPT through eval_h().
+  IpoptSolver_NLP(const MathematicalProgram& problem,
+                  const Eigen::VectorXd& x_init, bool exact_hessian,
+                  MathematicalProgramResult* result)
+      : problem_(&problem),
+        x_init_{x_init},
+        exact_hessian_(exact_hessian),
+        result_(result) {}
 
   virtual ~IpoptSolver_NLP() {}
 
@@ -352,6 +569,10 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     constraint_cache_.reset(new ResultCache(n, m, nnz_jac_g));
 
     nnz_h_lag = 0;
+    if (exact_hessian_) {
+      FindHessianStructure();
+      nnz_h_lag = hessian_rows_.size();
+    }
     index_style = C_STYLE;
     return true;
   }
@@ -550,6 +771,36 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     return true;
   }
 
+  virtual bool eval_h(Index n, const Number* x, bool new_x, Number obj_factor,
+                      Index m, const Number* lambda, bool new_lambda,
+                      Index nele_hess, Index* iRow, Index* jCol,
+                      Number* values) {
+    unused(new_x, m, new_lambda);
+
+    if (!exact_hessian_) {
+      return false;
+    }
+    DRAKE_ASSERT(nele_hess == static_cast<Index>(hessian_rows_.size()));
+    if (values == nullptr) {
+      DRAKE_ASSERT(iRow != nullptr);
+      DRAKE_ASSERT(jCol != nullptr);
+      std::copy(hessian_rows_.begin(), hessian_rows_.end(), iRow);
+      std::copy(hessian_cols_.begin(), hessian_cols_.end(), jCol);
+      return true;
+    }
+
+    const Eigen::VectorXd xvec = MakeEigenVector(n, x);
+    std::fill(values, values + nele_hess, 0.0);
+    for (const auto& hessian : cost_hessians_) {
+      hessian.AddWeightedHessian(xvec, &obj_factor, values);
+    }
+    for (int i = 0; i < static_cast<int>(constraint_hessians_.size()); ++i) {
+      constraint_hessians_[i].AddWeightedHessian(
+          xvec, lambda + constraint_hessian_rows_[i], values);
+    }
+    return true;
+  }
+
   virtual void finalize_solution(SolverReturn status, Index n, const Number* x,
                                  const Number* z_L, const Number* z_U, Index m,
                                  const Number* g, const Number* lambda,
@@ -616,6 +867,45 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   }
 
  private:
+  // Finds the entries of the lower triangle of the Hessian of the Lagrangian
+  // that are not identically zero, for eval_h(). The linear costs and
+  // constraints do not contribute to it.
+  void FindHessianStructure() {
+    std::map<std::pair<Index, Index>, Index> entries;
+    cost_hessians_.clear();
+    constraint_hessians_.clear();
+    constraint_hessian_rows_.clear();
+    for (const auto& binding : problem_->generic_costs()) {
+      cost_hessians_.emplace_back(*problem_, binding.evaluator(),
+                                  binding.variables(), &entries);
+    }
+    for (const auto& binding : problem_->quadratic_costs()) {
+      cost_hessians_.emplace_back(*problem_, binding.evaluator(),
+                                  binding.variables(), &entries);
+    }
+    // The constraints are in the same order as in eval_g(), where the linear
+    // constraints come last.
+    int constraint_idx = 0;
+    auto add_constraints = [&](const auto& bindings) {
+      for (const auto& binding : bindings) {
+        constraint_hessians_.emplace_back(*problem_, binding.evaluator(),
+                                          binding.variables(), &entries);
+        constraint_hessian_rows_.push_back(constraint_idx);
+        constraint_idx += binding.evaluator()->num_constraints();
+      }
+    };
+    add_constraints(problem_->generic_constraints());
+    add_constraints(problem_->lorentz_cone_constraints());
+    add_constraints(problem_->rotated_lorentz_cone_constraints());
+
+    hessian_rows_.resize(entries.size());
+    hessian_cols_.resize(entries.size());
+    for (const auto& [row_col, index] : entries) {
+      hessian_rows_[index] = row_col.first;
+      hessian_cols_[index] = row_col.second;
+    }
+  }
+
   void EvaluateCosts(Index n, const Number* x) {
     const Eigen::VectorXd xvec = MakeEigenVector(n, x);
 
@@ -696,6 +986,15 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
   Eigen::VectorXd x_init_;
+  const bool exact_hessian_;
+  // The Hessians of the costs and of the constraints, with the index of the
+  // first row of each constraint in g, and the (row, column) of each entry of
+  // the Hessian of the Lagrangian, when exact_hessian_ is true.
+  std::vector<BindingHessian> cost_hessians_;
+  std::vector<BindingHessian> constraint_hessians_;
+  std::vector<int> constraint_hessian_rows_;
+  std::vector<Index> hessian_rows_;
+  std::vector<Index> hessian_cols_;
   MathematicalProgramResult* const result_;
   // bb_con_dual_variable_indices_[constraint] maps the bounding box constraint
   // to the indices of its dual variables (one for lower bound and one for upper
@@ -853,8 +1152,13 @@ void IpoptSolver::DoSolve(
     return;
   }
 
+  const auto& options_str = merged_options.GetOptionsStr(id());
+  const auto hessian_approximation = options_str.find("hessian_approximation");
+  const bool exact_hessian = hessian_approximation != options_str.end() &&
+                             hessian_approximation->second == "exact";
+
   Ipopt::SmartPtr<IpoptSolver_NLP> nlp =
-      new IpoptSolver_NLP(prog, initial_guess, result);
+      new IpoptSolver_NLP(prog, initial_guess, exact_hessian, result);
   status = app->OptimizeTNLP(nlp);
 }
 
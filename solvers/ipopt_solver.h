@@ -40,6 +40,17 @@ struct IpoptSolverDetails {
   const char* ConvertStatusToString() const;
 };
 
+/**
+ * By default, IPOPT uses a limited-memory quasi-Newton approximation of the
+ * Hessian of the Lagrangian. Setting the IPOPT option "hessian_approximation"
+ * to "exact" instead provides it with the exact Hessian, so that it takes full
+ * Newton steps, which usually takes fewer iterations. The sparsity pattern of
+ * this Hessian is found when the solve starts, by symbolically differentiating
+ * the costs and constraints twice. The costs and constraints that cannot be
+ * evaluated or differentiated symbolically (e.g., the ones that only support
+ * double and AutoDiffXd) instead contribute a dense block computed by central
+ * differences of their AutoDiffXd gradients.
+ */
 class IpoptSolver final : public SolverBase {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IpoptSolver)
@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <array>
-#include <atomic>
 #include <cmath>
 #include <limits>
 #include <list>
@@ -15,7 +14,6 @@
 #include <Eigen/SparseCore>
 #include <mosek.h>
 
-#include "drake/common/never_destroyed.h"
 #include "drake/common/scoped_singleton.h"
 #include "drake/common/text_logging.h"
 #include "drake/solvers/mathematical_program.h"
@@ -43,6 +41,12 @@ namespace {
 // matrix variables in a special manner.
 // MatrixVariableEntry stores the data needed to refer to a particular entry of
 // a Mosek matrix variable.
+// The coefficient matrix Eₘₙ selecting the entry X̅(m, n) only depends on m, n
+// and the size of X̅, hence the id() of an entry identifies that triplet and
+// entries in different matrix variables of the same size share the same
+// coefficient matrix. Sum-of-squares programs typically contain many Gram
+// matrices of the same size, and sharing Eₘₙ among them significantly reduces
+// the number of symmetric matrices appended to the Mosek task.
 class MatrixVariableEntry {
  public:
   typedef size_t Id;
@@ -51,8 +55,7 @@ class MatrixVariableEntry {
       : bar_matrix_index_{bar_matrix_index},
         row_index_{row_index},
         col_index_{col_index},
-        num_matrix_rows_{num_matrix_rows},
-        id_{get_next_id()} {
+        num_matrix_rows_{num_matrix_rows} {
     // Mosek only stores the lower triangular part of the symmetric matrix.
     DRAKE_ASSERT(row_index_ >= col_index_);
   }
@@ -64,7 +67,13 @@ class MatrixVariableEntry {
 
   int num_matrix_rows() const { return num_matrix_rows_; }
 
-  Id id() const { return id_; }
+  // The entries of all matrices with k < num_matrix_rows() rows are numbered
+  // first, and there are ∑ₖ k(k+1)/2 = (n-1)n(n+1)/6 of them, with
+  // n = num_matrix_rows().
+  Id id() const {
+    const Id n = num_matrix_rows_;
+    return (n - 1) * n * (n + 1) / 6 + IndexInLowerTrianglePart();
+  }
 
   // Returns the index of the entry in a vector formed by stacking the lower
   // triangular part of the symmetric matrix column by column.
@@ -74,15 +83,10 @@ class MatrixVariableEntry {
   }
 
  private:
-  static size_t get_next_id() {
-    static never_destroyed<std::atomic<int>> next_id(0);
-    return next_id.access()++;
-  }
   MSKint64t bar_matrix_index_;
   MSKint32t row_index_;
   MSKint32t col_index_;
   int num_matrix_rows_;
-  Id id_;
 };
 
 // This function is used to print information for each iteration to the console,
@@ -712,20 +716,15 @@ MSKrescodee AddLinearMatrixInequalityConstraint(
     if (rescode != MSK_RES_OK) {
       return rescode;
     }
-    // Now add <Eₘₙ, X̅> = -X̅(m,n) to the linear constraint
+    // Now add -<Eₘₙ, X̅> = -X̅(m,n) to the linear constraint, reusing the
+    // matrices Eₘₙ already in the task for matrix variables of the same size.
     lower_index = 0;
     for (int j = 0; j < rows; ++j) {
       for (int i = j; i < rows; ++i) {
-        const MSKrealt val = i == j ? -1.0 : -0.5;
-        MSKint64t E_index;
-        rescode =
-            MSK_appendsparsesymmat(*task, rows, 1, &i, &j, &val, &E_index);
-        if (rescode != MSK_RES_OK) {
-          return rescode;
-        }
-        const MSKrealt weights{1.0};
-        rescode = MSK_putbaraij(*task, num_linear_constraint + lower_index,
-                                bar_X_index, 1, &E_index, &weights);
+        rescode = AddScalarTimesMatrixVariableEntryToMosek(
+            num_linear_constraint + lower_index,
+            MatrixVariableEntry(bar_X_index, i, j, rows), -1.0,
+            matrix_variable_entry_to_selection_matrix_id, task);
         if (rescode != MSK_RES_OK) {
           return rescode;
         }
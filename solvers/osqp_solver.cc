@@ -1,5 +1,8 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -252,6 +255,44 @@ void SetDualSolution(
 }
 }  // namespace
 
+namespace {
+bool HaveSameSparsityPattern(const Eigen::SparseMatrix<c_float>& M1,
+                             const Eigen::SparseMatrix<c_float>& M2) {
+  return M1.rows() == M2.rows() && M1.cols() == M2.cols() &&
+         M1.nonZeros() == M2.nonZeros() &&
+         std::equal(M1.outerIndexPtr(), M1.outerIndexPtr() + M1.cols() + 1,
+                    M2.outerIndexPtr()) &&
+         std::equal(M1.innerIndexPtr(), M1.innerIndexPtr() + M1.nonZeros(),
+                    M2.innerIndexPtr());
+}
+
+// @pre HaveSameSparsityPattern(M1, M2).
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& M1,
+                    const Eigen::SparseMatrix<c_float>& M2) {
+  return std::equal(M1.valuePtr(), M1.valuePtr() + M1.nonZeros(),
+                    M2.valuePtr());
+}
+}  // namespace
+
+struct OsqpSolver::Workspace {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  Workspace(OSQPWorkspace* work_in, Eigen::SparseMatrix<c_float> P_in,
+            Eigen::SparseMatrix<c_float> A_in, const SolverOptions& options_in)
+      : work(work_in),
+        P(std::move(P_in)),
+        A(std::move(A_in)),
+        options(options_in) {}
+
+  ~Workspace() { osqp_cleanup(work); }
+
+  OSQPWorkspace* const work;
+  // The matrices and options that `work` currently holds.
+  Eigen::SparseMatrix<c_float> P;
+  Eigen::SparseMatrix<c_float> A;
+  const SolverOptions options;
+};
+
 bool OsqpSolver::is_available() { return true; }
 
 void OsqpSolver::DoSolve(
@@ -292,38 +333,79 @@ void OsqpSolver::DoSolve(
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
+  // If any step fails, it will set the solution_result and skip other steps.
+  std::optional<SolutionResult> solution_result;
+
+  // Update the workspace of the previous solve, if it has the same structure.
+  OSQPWorkspace* work = nullptr;
+  if (reuse_workspace_ && workspace_ != nullptr &&
+      workspace_->options == merged_options &&
+      workspace_->work->data->n == prog.num_vars() &&
+      HaveSameSparsityPattern(workspace_->P, P_sparse) &&
+      HaveSameSparsityPattern(workspace_->A, A_sparse)) {
+    work = workspace_->work;
+    c_int osqp_update_err = osqp_update_lin_cost(work, q.data());
+    if (osqp_update_err == 0) {
+      osqp_update_err = osqp_update_bounds(work, l.data(), u.data());
+    }
+    // Only refactorize the KKT system if the matrices changed.
+    if (osqp_update_err == 0 && !(HaveSameValues(workspace_->P, P_sparse) &&
+                                  HaveSameValues(workspace_->A, A_sparse))) {
+      osqp_update_err = osqp_update_P_A(
+          work, P_sparse.valuePtr(), OSQP_NULL, P_sparse.nonZeros(),
+          A_sparse.valuePtr(), OSQP_NULL, A_sparse.nonZeros());
+      workspace_->P = P_sparse;
+      workspace_->A = A_sparse;
+    }
+    if (osqp_update_err != 0) {
+      solution_result = SolutionResult::kInvalidInput;
+    }
+  } else {
+    workspace_.reset();
 
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+    // Now pass the constraint and cost to osqp data.
+    OSQPData* data = nullptr;
 
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
+    // Populate data.
+    data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
 
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
+    data->n = prog.num_vars();
+    data->m = A_sparse.rows();
+    data->P = EigenSparseToCSC(P_sparse);
+    data->q = q.data();
+    data->A = EigenSparseToCSC(A_sparse);
+    data->l = l.data();
+    data->u = u.data();
 
-  SetOsqpSolverSettings(merged_options, settings);
+    // Define Solver settings as default.
+    // Problem settings
+    OSQPSettings* settings =
+        static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+    osqp_set_default_settings(settings);
 
-  // If any step fails, it will set the solution_result and skip other steps.
-  std::optional<SolutionResult> solution_result;
+    SetOsqpSolverSettings(merged_options, settings);
 
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
+    // Setup workspace. OSQP copies data and settings into the workspace.
     const c_int osqp_setup_err = osqp_setup(&work, data, settings);
     if (osqp_setup_err != 0) {
       solution_result = SolutionResult::kInvalidInput;
     }
+
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
+    c_free(settings);
+
+    if (reuse_workspace_ && work != nullptr) {
+      workspace_ = std::make_shared<Workspace>(work, P_sparse, A_sparse,
+                                               merged_options);
+    }
   }
 
   // Solve problem.
@@ -390,18 +472,14 @@ void OsqpSolver::DoSolve(
   }
   result->set_solution_result(solution_result.value());
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // Clean workspace, unless it is kept for the next solve.
+  if (workspace_ == nullptr) {
+    osqp_cleanup(work);
+  } else if (solution_result == SolutionResult::kInvalidInput) {
+    // Don't carry a workspace that failed to update or solve into the next
+    // solve.
+    workspace_.reset();
+  }
 }
 
 }  // namespace solvers
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/solver_base.h"
 
@@ -56,9 +58,36 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Enables or disables the reuse of the OSQP workspace between successive
+  /// calls to Solve() on this solver instance; it is disabled by default.
+  ///
+  /// When enabled, and a program has the same number of variables and linear
+  /// constraints, the same sparsity pattern of the quadratic cost Hessian P
+  /// and the constraint matrix A, and the same solver options as the program
+  /// of the previous call, the existing OSQP workspace is updated in place
+  /// instead of being set up again. The KKT system is only refactorized if the
+  /// values of P or A changed, and OSQP is warm-started from the previous
+  /// primal and dual solution. This suits control loops that solve a QP of
+  /// fixed structure at every tick.
+  ///
+  /// While enabled, this solver instance must not be used to solve programs
+  /// from several threads at once. Disabling the reuse releases the workspace.
+  void set_reuse_workspace(bool reuse);
+
+  /// Returns true if the OSQP workspace is reused between calls to Solve().
+  /// See set_reuse_workspace().
+  bool reuse_workspace() const { return reuse_workspace_; }
+
  private:
+  // The OSQP workspace retained between calls to DoSolve() when
+  // reuse_workspace() is true. Defined in osqp_solver.cc.
+  struct Workspace;
+
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  bool reuse_workspace_{false};
+  mutable std::shared_ptr<Workspace> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
@@ -17,6 +17,13 @@ OsqpSolver::OsqpSolver()
 
 OsqpSolver::~OsqpSolver() = default;
 
+void OsqpSolver::set_reuse_workspace(bool reuse) {
+  reuse_workspace_ = reuse;
+  if (!reuse) {
+    workspace_.reset();
+  }
+}
+
 SolverId OsqpSolver::id() {
   static const never_destroyed<SolverId> singleton{"OSQP"};
   return singleton.access();
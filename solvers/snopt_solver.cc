@@ -6,18 +6,23 @@
 #include <cstdlib>
 #include <cstring>
 #include <deque>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 // NOLINTNEXTLINE(build/include)
 #include "snopt.h"
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
@@ -217,6 +222,22 @@ namespace drake {
 namespace solvers {
 namespace {
 
+// The name of the integer option which sets the number of threads used to
+// evaluate nonlinear constraints; see the SnoptSolver class documentation.
+// This option is consumed by Drake and is not passed on to SNOPT.
+constexpr char kEvaluationThreadsOption[] = "Drake evaluation threads";
+
+// The evaluation of a single nonlinear constraint binding, prepared once per
+// solve.
+struct NonlinearConstraintTask {
+  // Bindings which share an evaluator are never evaluated concurrently.
+  const EvaluatorBase* evaluator{};
+  // Writes the value and the non-zero gradient entries of the binding into F
+  // and G, for the (unscaled) decision variable values xvec.
+  std::function<void(const Eigen::VectorXd& xvec, double F[], double G[])>
+      evaluate;
+};
+
 // This class is used for passing additional info to the snopt_userfun, which
 // evaluates the value and gradient of the cost and constraints. Apart from the
 // standard information such as decision variable values, snopt_userfun could
@@ -234,12 +255,16 @@ class SnoptUserFunInfo {
   // Pointers to the parameters ('prog' and 'nonlinear_cost_gradient_indices')
   // are retained internally, so the supplied objects must have lifetimes longer
   // than the SnoptUserFuncInfo object.
-  explicit SnoptUserFunInfo(const MathematicalProgram* prog)
+  explicit SnoptUserFunInfo(const MathematicalProgram* prog,
+                            int num_evaluation_threads)
       : this_pointer_as_int_array_(MakeThisAsInts()),
-        prog_(*prog) {}
+        prog_(*prog),
+        num_evaluation_threads_(num_evaluation_threads) {}
 
   const MathematicalProgram& mathematical_program() const { return prog_; }
 
+  int num_evaluation_threads() const { return num_evaluation_threads_; }
+
   std::set<int>& nonlinear_cost_gradient_indices() {
     return nonlinear_cost_gradient_indices_;
   }
@@ -247,6 +272,23 @@ class SnoptUserFunInfo {
     return nonlinear_cost_gradient_indices_;
   }
 
+  // The nonlinear constraint tasks, in the order of the rows of F, and their
+  // grouping by evaluator.
+  std::vector<NonlinearConstraintTask>& nonlinear_constraint_tasks() {
+    return nonlinear_constraint_tasks_;
+  }
+  const std::vector<NonlinearConstraintTask>& nonlinear_constraint_tasks()
+      const {
+    return nonlinear_constraint_tasks_;
+  }
+  std::vector<std::vector<int>>& nonlinear_constraint_task_groups() {
+    return nonlinear_constraint_task_groups_;
+  }
+  const std::vector<std::vector<int>>& nonlinear_constraint_task_groups()
+      const {
+    return nonlinear_constraint_task_groups_;
+  }
+
   int* iu() const {
     return const_cast<int*>(this_pointer_as_int_array_.data());
   }
@@ -289,7 +331,10 @@ class SnoptUserFunInfo {
 
   const std::array<int, kIntCount> this_pointer_as_int_array_;
   const MathematicalProgram& prog_;
+  const int num_evaluation_threads_;
   std::set<int> nonlinear_cost_gradient_indices_;
+  std::vector<NonlinearConstraintTask> nonlinear_constraint_tasks_;
+  std::vector<std::vector<int>> nonlinear_constraint_task_groups_;
 };
 
 // Storage that we pass in and out of SNOPT APIs.
@@ -359,84 +404,194 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
                     constraint.q().cast<AutoDiffXd>());
 }
 
+// Returns the indices in prog's decision variables of binding.variables().
+template <typename C>
+std::vector<int> GetBindingVariableIndices(const MathematicalProgram& prog,
+                                           const Binding<C>& binding) {
+  const int num_variables = binding.GetNumElements();
+  std::vector<int> binding_var_indices(num_variables);
+  for (int i = 0; i < num_variables; ++i) {
+    binding_var_indices[i] =
+        prog.FindDecisionVariableIndex(binding.variables()(i));
+  }
+  return binding_var_indices;
+}
+
+// Returns the (position in binding.variables(), scaling factor) pairs of the
+// scaled variables among @p binding_var_indices.
+std::vector<std::pair<int, double>> GetBindingVariableScaling(
+    const MathematicalProgram& prog,
+    const std::vector<int>& binding_var_indices) {
+  const auto & scale_map = prog.GetVariableScaling();
+  std::vector<std::pair<int, double>> result;
+  for (int i = 0; i < static_cast<int>(binding_var_indices.size()); ++i) {
+    auto it = scale_map.find(binding_var_indices[i]);
+    if (it != scale_map.end()) {
+      result.emplace_back(i, it->second);
+    }
+  }
+  return result;
+}
+
+// Gathers the scaled values of the bound variables from @p xvec, with an
+// identity gradient.
+AutoDiffVecXd GetScaledBindingVariables(
+    const Eigen::VectorXd& xvec, const std::vector<int>& binding_var_indices,
+    const std::vector<std::pair<int, double>>& binding_var_scaling) {
+  Eigen::VectorXd this_x(binding_var_indices.size());
+  for (int i = 0; i < this_x.size(); ++i) {
+    this_x(i) = xvec(binding_var_indices[i]);
+  }
+  AutoDiffVecXd this_x_scaled = math::initializeAutoDiff(this_x);
+  for (const auto& [i, scale] : binding_var_scaling) {
+    this_x_scaled(i) *= scale;
+  }
+  return this_x_scaled;
+}
+
+// Evaluates the value and gradient of the nonlinear constraint @p binding,
+// writing the value to F[constraint_index], F[constraint_index + 1], ... and
+// the non-zero entries of the gradient to G[grad_index], G[grad_index + 1], ...
+template <typename C>
+void EvaluateSingleNonlinearConstraintBinding(
+    const Binding<C>& binding, const std::vector<int>& binding_var_indices,
+    const std::vector<std::pair<int, double>>& binding_var_scaling,
+    size_t constraint_index, size_t grad_index, const Eigen::VectorXd& xvec,
+    double F[], double G[]) {
+  const auto& c = binding.evaluator();
+  int num_constraints = SingleNonlinearConstraintSize(*c);
+  const int num_variables = binding.GetNumElements();
+
+  AutoDiffVecXd ty;
+  ty.resize(num_constraints);
+  EvaluateSingleNonlinearConstraint(
+      *c,
+      GetScaledBindingVariables(xvec, binding_var_indices, binding_var_scaling),
+      &ty);
+
+  for (int i = 0; i < num_constraints; i++) {
+    F[constraint_index++] = ty(i).value();
+  }
+
+  const std::optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern =
+          binding.evaluator()->gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
+      G[grad_index++] =
+          ty(nonzero_entry.first).derivatives().size() > 0
+              ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
+              : 0.0;
+    }
+  } else {
+    for (int i = 0; i < num_constraints; i++) {
+      if (ty(i).derivatives().size() > 0) {
+        for (int j = 0; j < num_variables; ++j) {
+          G[grad_index++] = ty(i).derivatives()(j);
+        }
+      } else {
+        for (int j = 0; j < num_variables; ++j) {
+          G[grad_index++] = 0.0;
+        }
+      }
+    }
+  }
+}
+
 /*
- * Evaluate the value and gradients of nonlinear constraints.
+ * Prepares the evaluation of the value and gradients of nonlinear constraints.
  * The template type Binding is supposed to be a
  * MathematicalProgram::Binding<Constraint> type.
  * @param constraint_list A list of Binding<Constraint>
- * @param F The value of the constraints
- * @param G The value of the non-zero entries in the gradient
  * @param constraint_index The starting index of the constraint_list(0) in the
  * optimization problem.
  * @param grad_index The starting index of the gradient of constraint_list(0)
  * in the optimization problem.
- * @param xvec the value of the decision variables.
+ * @param tasks One task per binding is appended to this list. Running a task
+ * writes the value and gradient of its binding into F and G.
  */
 template <typename C>
-void EvaluateNonlinearConstraints(
+void AddNonlinearConstraintTasks(
     const MathematicalProgram& prog,
-    const std::vector<Binding<C>>& constraint_list, double F[], double G[],
-    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
-  const auto & scale_map = prog.GetVariableScaling();
-  Eigen::VectorXd this_x;
+    const std::vector<Binding<C>>& constraint_list, size_t* constraint_index,
+    size_t* grad_index, std::vector<NonlinearConstraintTask>* tasks) {
   for (const auto& binding : constraint_list) {
-    const auto& c = binding.evaluator();
-    int num_constraints = SingleNonlinearConstraintSize(*c);
-
-    const int num_variables = binding.GetNumElements();
-    this_x.resize(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
-    for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = xvec(binding_var_indices[i]);
-    }
-
-    // Scale this_x
-    auto this_x_scaled = math::initializeAutoDiff(this_x);
-    for (int i = 0; i < num_variables; i++) {
-      auto it = scale_map.find(binding_var_indices[i]);
-      if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
-      }
-    }
-
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty);
-
-    for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
-    }
-
+    std::vector<int> binding_var_indices =
+        GetBindingVariableIndices(prog, binding);
+    std::vector<std::pair<int, double>> binding_var_scaling =
+        GetBindingVariableScaling(prog, binding_var_indices);
+    const size_t binding_constraint_index = *constraint_index;
+    const size_t binding_grad_index = *grad_index;
+    tasks->push_back(NonlinearConstraintTask{
+        binding.evaluator().get(),
+        [&binding, binding_var_indices = std::move(binding_var_indices),
+         binding_var_scaling = std::move(binding_var_scaling),
+         binding_constraint_index, binding_grad_index](
+            const Eigen::VectorXd& xvec, double F[], double G[]) {
+          EvaluateSingleNonlinearConstraintBinding(
+              binding, binding_var_indices, binding_var_scaling,
+              binding_constraint_index, binding_grad_index, xvec, F, G);
+        }});
+
+    *constraint_index += SingleNonlinearConstraintSize(*binding.evaluator());
     const std::optional<std::vector<std::pair<int, int>>>&
         gradient_sparsity_pattern =
             binding.evaluator()->gradient_sparsity_pattern();
     if (gradient_sparsity_pattern.has_value()) {
-      for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
-        G[(*grad_index)++] =
-            ty(nonzero_entry.first).derivatives().size() > 0
-                ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
-                : 0.0;
-      }
+      *grad_index += gradient_sparsity_pattern.value().size();
     } else {
-      for (int i = 0; i < num_constraints; i++) {
-        if (ty(i).derivatives().size() > 0) {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = ty(i).derivatives()(j);
-          }
-        } else {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = 0.0;
-          }
-        }
-      }
+      *grad_index += SingleNonlinearConstraintSize(*binding.evaluator()) *
+                     binding.GetNumElements();
     }
   }
 }
 
+// Groups the indices of @p tasks by evaluator. The k'th group lists the tasks
+// sharing the k'th distinct evaluator, ordered by first appearance.
+std::vector<std::vector<int>> GroupNonlinearConstraintTasks(
+    const std::vector<NonlinearConstraintTask>& tasks) {
+  std::vector<std::vector<int>> groups;
+  std::unordered_map<const EvaluatorBase*, int> evaluator_to_group;
+  for (int i = 0; i < static_cast<int>(tasks.size()); ++i) {
+    const auto [it, inserted] =
+        evaluator_to_group.emplace(tasks[i].evaluator, groups.size());
+    if (inserted) {
+      groups.emplace_back();
+    }
+    groups[it->second].push_back(i);
+  }
+  return groups;
+}
+
+// Runs all of the nonlinear constraint tasks of @p info, on up to
+// info.num_evaluation_threads() threads. Tasks which share an evaluator run on
+// the same thread, in their original order.
+void RunNonlinearConstraintTasks(const SnoptUserFunInfo& info,
+                                 const Eigen::VectorXd& xvec, double F[],
+                                 double G[]) {
+  const std::vector<NonlinearConstraintTask>& tasks =
+      info.nonlinear_constraint_tasks();
+  const std::vector<std::vector<int>>& groups =
+      info.nonlinear_constraint_task_groups();
+  const int num_groups = groups.size();
+  const int num_threads = std::min(info.num_evaluation_threads(), num_groups);
+  if (num_threads <= 1) {
+    for (const auto& task : tasks) {
+      task.evaluate(xvec, F, G);
+    }
+    return;
+  }
+  drake::internal::StaticParallelForRange(
+      num_groups, num_threads,
+      [&tasks, &groups, &xvec, F, G](int, int begin, int end) {
+        for (int k = begin; k < end; ++k) {
+          for (const int i : groups[k]) {
+            tasks[i].evaluate(xvec, F, G);
+          }
+        }
+      });
+}
+
 // Find the variables with non-zero gradient in @p costs, and add the indices of
 // these variable to cost_gradient_indices.
 template <typename C>
@@ -562,22 +717,9 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
                             info.nonlinear_cost_gradient_indices(), F, G,
                             &grad_index);
 
-  // The constraint index starts at 1 because the cost is the
-  // first row.
-  size_t constraint_index = 1;
-  // The gradient_index also starts after the cost.
-  EvaluateNonlinearConstraints(current_problem,
-                               current_problem.generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
-  EvaluateNonlinearConstraints(current_problem,
-                               current_problem.lorentz_cone_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
-  EvaluateNonlinearConstraints(
-      current_problem, current_problem.rotated_lorentz_cone_constraints(), F, G,
-      &constraint_index, &grad_index, xvec);
-  EvaluateNonlinearConstraints(
-      current_problem, current_problem.linear_complementarity_constraints(), F,
-      G, &constraint_index, &grad_index, xvec);
+  // The nonlinear constraints occupy the rows of F after the cost, and their
+  // gradients follow the cost gradient in G.
+  RunNonlinearConstraintTasks(info, xvec, F, G);
 }
 
 /*
@@ -1024,7 +1166,17 @@ void SolveWithGivenOptions(
   SnoptSolverDetails& solver_details =
       result->SetSolverDetailsType<SnoptSolverDetails>();
 
-  SnoptUserFunInfo user_info(&prog);
+  int num_evaluation_threads = 1;
+  const auto threads_it = snopt_options_int.find(kEvaluationThreadsOption);
+  if (threads_it != snopt_options_int.end()) {
+    if (threads_it->second < 1) {
+      throw std::logic_error(fmt::format(
+          "SnoptSolver: \"{}\" must be at least 1, but is {}.",
+          kEvaluationThreadsOption, threads_it->second));
+    }
+    num_evaluation_threads = threads_it->second;
+  }
+  SnoptUserFunInfo user_info(&prog, num_evaluation_threads);
   WorkspaceStorage storage(&user_info);
   const auto & scale_map = prog.GetVariableScaling();
 
@@ -1080,6 +1232,24 @@ void SolveWithGivenOptions(
   // Update nonlinear constraints.
   user_info.nonlinear_cost_gradient_indices() =
       GetAllNonlinearCostNonzeroGradientIndices(prog);
+  {
+    // The constraint index starts at 1 because the cost is the first row. The
+    // gradient index also starts after the cost.
+    size_t constraint_index = 1;
+    size_t grad_index = user_info.nonlinear_cost_gradient_indices().size();
+    auto* tasks = &user_info.nonlinear_constraint_tasks();
+    AddNonlinearConstraintTasks(prog, prog.generic_constraints(),
+                                &constraint_index, &grad_index, tasks);
+    AddNonlinearConstraintTasks(prog, prog.lorentz_cone_constraints(),
+                                &constraint_index, &grad_index, tasks);
+    AddNonlinearConstraintTasks(prog, prog.rotated_lorentz_cone_constraints(),
+                                &constraint_index, &grad_index, tasks);
+    AddNonlinearConstraintTasks(prog,
+                                prog.linear_complementarity_constraints(),
+                                &constraint_index, &grad_index, tasks);
+    user_info.nonlinear_constraint_task_groups() =
+        GroupNonlinearConstraintTasks(*tasks);
+  }
   int num_nonlinear_constraints = 0;
   int max_num_gradients = user_info.nonlinear_cost_gradient_indices().size();
   int num_linear_constraints = 0;
@@ -1187,6 +1357,10 @@ void SolveWithGivenOptions(
   }
 
   for (const auto& it : snopt_options_int) {
+    if (it.first == kEvaluationThreadsOption) {
+      // Already handled when constructing user_info, above.
+      continue;
+    }
     int errors;
     Snopt::snseti(
         it.first.c_str(), it.first.length(), it.second, &errors,
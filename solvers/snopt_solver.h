@@ -35,6 +35,17 @@ struct SnoptSolverDetails {
   Eigen::VectorXd Fmul;
 };
 
+/**
+ * Options set through SolverOptions for this solver's id() are passed on to
+ * SNOPT, except for the integer option "Drake evaluation threads" (default 1),
+ * which is handled by Drake. When it is greater than 1, the nonlinear
+ * constraints are evaluated in parallel on up to that many threads in every
+ * SNOPT callback. Bindings which share an evaluator are always evaluated on
+ * the same thread, one after another, but distinct evaluators may be evaluated
+ * concurrently. Only enable this option when no two distinct constraints
+ * share mutable state, such as a systems::Context; the results do not depend
+ * on the number of threads.
+ */
 class SnoptSolver final : public SolverBase  {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SnoptSolver)
@@ -890,6 +890,34 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve2) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve2InParallel) {
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id());
+      EXPECT_EQ(dut.bnb()->num_threads(), 1);
+      dut.bnb()->set_num_threads(4);
+      EXPECT_EQ(dut.bnb()->num_threads(), 4);
+      dut.bnb()->SetNodeSelectionMethod(pick_node);
+      dut.bnb()->SetVariableSelectionMethod(pick_variable);
+
+      const SolutionResult solution_result = dut.bnb()->Solve();
+      EXPECT_EQ(solution_result, SolutionResult::kSolutionFound);
+      const double tol{1E-3};
+      EXPECT_NEAR(dut.bnb()->GetOptimalCost(), -13.0 / 3, tol);
+      Eigen::Matrix<double, 5, 1> x_expected0;
+      x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+      EXPECT_TRUE(CompareMatrices(dut.bnb()->GetSolution(x, 0), x_expected0,
+                                  tol, MatrixCompareType::absolute));
+    }
+  }
+
+  MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id());
+  EXPECT_THROW(dut.bnb()->set_num_threads(0), std::runtime_error);
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve3) {
   auto prog = ConstructMathematicalProgram3();
   const VectorDecisionVariable<4> x = prog->decision_variables();
@@ -0,0 +1,73 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using Cliques = std::vector<std::vector<int>>;
+
+GTEST_TEST(FindChordalExtensionCliquesTest, Tridiagonal) {
+  const Cliques cliques =
+      FindChordalExtensionCliques(5, {{1, 0}, {1, 2}, {3, 2}, {3, 4}});
+  // A path is already chordal, and its cliques are the edges.
+  EXPECT_EQ(cliques, Cliques({{0, 1}, {1, 2}, {2, 3}, {3, 4}}));
+}
+
+GTEST_TEST(FindChordalExtensionCliquesTest, Cycle) {
+  // The cycle 0-1-2-3-0 is not chordal. A single chord makes it chordal,
+  // leaving two cliques of size 3 instead of one of size 4.
+  const Cliques cliques =
+      FindChordalExtensionCliques(4, {{0, 1}, {1, 2}, {2, 3}, {3, 0}});
+  ASSERT_EQ(cliques.size(), 2u);
+  EXPECT_EQ(cliques[0], std::vector<int>({0, 1, 3}));
+  EXPECT_EQ(cliques[1], std::vector<int>({1, 2, 3}));
+}
+
+GTEST_TEST(FindChordalExtensionCliquesTest, Arrow) {
+  // Every node is connected to node 0. Duplicates and diagonal entries are
+  // ignored.
+  const Cliques cliques = FindChordalExtensionCliques(
+      4, {{0, 1}, {2, 0}, {0, 3}, {1, 0}, {2, 2}});
+  EXPECT_EQ(cliques, Cliques({{0, 1}, {0, 2}, {0, 3}}));
+}
+
+GTEST_TEST(FindChordalExtensionCliquesTest, DenseAndEmpty) {
+  EXPECT_EQ(FindChordalExtensionCliques(3, {{0, 1}, {0, 2}, {1, 2}}),
+            Cliques({{0, 1, 2}}));
+  EXPECT_EQ(FindChordalExtensionCliques(2, {}), Cliques({{0}, {1}}));
+  EXPECT_TRUE(FindChordalExtensionCliques(0, {}).empty());
+}
+
+GTEST_TEST(FindChordalExtensionCliquesTest, OutOfRange) {
+  EXPECT_THROW(FindChordalExtensionCliques(2, {{0, 2}}), std::exception);
+  EXPECT_THROW(FindChordalExtensionCliques(2, {{-1, 0}}), std::exception);
+}
+
+GTEST_TEST(AddSparsePositiveSemidefiniteConstraintTest, Tridiagonal) {
+  MathematicalProgram prog;
+  const auto X = prog.NewSymmetricContinuousVariables<4>();
+  const auto bindings = AddSparsePositiveSemidefiniteConstraint(
+      &prog, X, {{0, 1}, {1, 2}, {2, 3}});
+  ASSERT_EQ(bindings.size(), 3u);
+  EXPECT_EQ(prog.positive_semidefinite_constraints().size(), 3u);
+  for (const auto& binding : bindings) {
+    EXPECT_EQ(binding.evaluator()->matrix_rows(), 2);
+  }
+  // The clique {1, 2} constrains the submatrix X[1:3, 1:3].
+  const auto& X_12 = bindings[1].variables();
+  ASSERT_EQ(X_12.rows(), 4);
+  EXPECT_TRUE(X_12(0).equal_to(X(1, 1)));
+  EXPECT_TRUE(X_12(1).equal_to(X(2, 1)));
+  EXPECT_TRUE(X_12(2).equal_to(X(1, 2)));
+  EXPECT_TRUE(X_12(3).equal_to(X(2, 2)));
+
+  const auto X_non_square = prog.NewContinuousVariables<2, 3>();
+  EXPECT_THROW(AddSparsePositiveSemidefiniteConstraint(&prog, X_non_square, {}),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
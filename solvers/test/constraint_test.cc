@@ -86,7 +86,52 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), b3));
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
+
+  // Update a single entry of A.
+  constraint.UpdateCoefficientEntry(2, 1, 5);
+  Eigen::Matrix<double, 3, 2> A4 = A3;
+  A4(2, 1) = 5;
+  EXPECT_TRUE(CompareMatrices(constraint.A(), A4));
+  EXPECT_TRUE(CompareMatrices(constraint.lower_bound(), b3));
+  EXPECT_THROW(constraint.UpdateCoefficientEntry(3, 0, 1), std::runtime_error);
+  EXPECT_THROW(constraint.UpdateCoefficientEntry(0, 2, 1), std::runtime_error);
+}
+
+GTEST_TEST(testConstraint, testLinearConstraintAutoDiff) {
+  Eigen::Matrix<double, 3, 2> A;
+  // clang-format off
+  A << 1, 2,
+       3, 4,
+       5, 6;
+  // clang-format on
+  const LinearConstraint constraint(A, Vector3d::Zero(), Vector3d::Ones());
+  const Vector2d x0(7, 8);
+  const Vector3d y_expected = A * x0;
+  const double tol = 0;
+
+  // Test Eval with a gradient that is not the identity.
+  Eigen::Matrix2Xd x_grad(2, 3);
+  // clang-format off
+  x_grad << 1, 2, 3,
+            4, 5, 6;
+  // clang-format on
+  AutoDiffVecXd y;
+  constraint.Eval(math::initializeAutoDiffGivenGradientMatrix(x0, x_grad), &y);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y), y_expected, tol));
+  EXPECT_TRUE(
+      CompareMatrices(math::autoDiffToGradientMatrix(y), A * x_grad, tol));
+
+  // Test Eval with identity gradient.
+  constraint.Eval(math::initializeAutoDiff(x0), &y);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y), y_expected, tol));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y), A, tol));
+
+  // Test Eval with empty gradient.
+  constraint.Eval(x0.cast<AutoDiffXd>(), &y);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y), y_expected, tol));
+  EXPECT_EQ(math::autoDiffToGradientMatrix(y).size(), 0);
 }
+
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
   Eigen::Matrix2d Q;
@@ -163,6 +163,14 @@ GTEST_TEST(testCost, testLinearCost) {
   new_cost->Eval(x0, &y);
   EXPECT_NEAR(y(0), obj_expected + b, tol);
 
+  // Update single entries of the cost.
+  new_cost->update_coefficient_entry(1, 3);
+  new_cost->update_constant_term(200);
+  EXPECT_TRUE(CompareMatrices(new_cost->a(), Eigen::Vector2d(1, 3)));
+  EXPECT_EQ(new_cost->b(), 200);
+  EXPECT_THROW(new_cost->update_coefficient_entry(2, 1), runtime_error);
+  new_cost->UpdateCoefficients(a, b);
+
   new_cost->set_description("simple linear cost");
   EXPECT_EQ(
       fmt::format("{}", *new_cost),
@@ -255,6 +263,18 @@ GTEST_TEST(testCost, testQuadraticCost) {
   auto new_cost = make_shared<QuadraticCost>(Q, b, c);
   new_cost->Eval(x0, &y);
   EXPECT_NEAR(y(0), obj_expected + c, tol);
+
+  // Update single entries of the cost; Q stays symmetric.
+  new_cost->UpdateHessianEntry(0, 1, 7);
+  new_cost->update_linear_coefficient_entry(1, 8);
+  new_cost->update_constant_term(9);
+  EXPECT_EQ(new_cost->Q()(0, 1), 7);
+  EXPECT_EQ(new_cost->Q()(1, 0), 7);
+  EXPECT_EQ(new_cost->b()(1), 8);
+  EXPECT_EQ(new_cost->c(), 9);
+  EXPECT_THROW(new_cost->UpdateHessianEntry(0, 2, 1), runtime_error);
+  EXPECT_THROW(new_cost->update_linear_coefficient_entry(-1, 1),
+               runtime_error);
 }
 
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
@@ -0,0 +1,70 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+const double kInf = std::numeric_limits<double>::infinity();
+
+GTEST_TEST(FbstabSolverTest, UnconstrainedQP) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddQuadraticCost((x(0) - 1) * (x(0) - 1) + (x(1) + 2) * (x(1) + 2) + 3);
+
+  FbstabSolver solver;
+  ASSERT_TRUE(solver.available());
+  const MathematicalProgramResult result = solver.Solve(prog, {}, {});
+  EXPECT_TRUE(result.is_success());
+  const double tol = 1E-6;
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), Eigen::Vector2d(1, -2),
+                              tol, MatrixCompareType::absolute));
+  EXPECT_NEAR(result.get_optimal_cost(), 3, tol);
+  EXPECT_EQ(result.get_solver_id(), FbstabSolver::id());
+}
+
+GTEST_TEST(FbstabSolverTest, MixedConstraints) {
+  // min (x₀ - 2)² + (x₁ - 2)² + x₂²
+  // s.t. x₀ + x₁ ≤ 2
+  //      x₂ = 1
+  //      x₁ ≤ 0.5
+  // The solution is x = (1.5, 0.5, 1).
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>("x");
+  prog.AddQuadraticCost((x(0) - 2) * (x(0) - 2) + (x(1) - 2) * (x(1) - 2) +
+                        x(2) * x(2));
+  prog.AddLinearConstraint(Eigen::RowVector2d(1, 1), -kInf, 2,
+                           x.head<2>());
+  prog.AddLinearEqualityConstraint(x(2) == 1);
+  prog.AddBoundingBoxConstraint(-kInf, 0.5, x(1));
+
+  FbstabSolver solver;
+  const MathematicalProgramResult result = solver.Solve(prog, {}, {});
+  EXPECT_TRUE(result.is_success());
+  const double tol = 1E-6;
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                              Eigen::Vector3d(1.5, 0.5, 1), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_NEAR(result.get_optimal_cost(), 0.25 + 2.25 + 1, tol);
+}
+
+GTEST_TEST(FbstabSolverTest, Infeasible) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<1>("x");
+  prog.AddQuadraticCost(x(0) * x(0));
+  prog.AddBoundingBoxConstraint(1, kInf, x(0));
+  prog.AddLinearConstraint(x(0) <= -1);
+
+  FbstabSolver solver;
+  const MathematicalProgramResult result = solver.Solve(prog, {}, {});
+  EXPECT_EQ(result.get_solution_result(),
+            SolutionResult::kInfeasibleConstraints);
+}
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
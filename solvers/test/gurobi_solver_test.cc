@@ -1,5 +1,6 @@
 #include "drake/solvers/gurobi_solver.h"
 
+#include <limits>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -487,6 +488,69 @@ GTEST_TEST(GurobiTest, SOCPDualSolution2) {
   }
 }
 
+GTEST_TEST(GurobiTest, PersistentModel) {
+  // Re-solves a mixed-integer QP with a persistent model, with changed
+  // coefficients and bounds, and compares to the solutions without it.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto b = prog.NewBinaryVariables<2>();
+  VectorXDecisionVariable xb(4);
+  xb << x, b;
+  // The cost (x(0) - 1)² + (x(1) - 2)² + b(0).
+  const Eigen::Matrix4d Q = Eigen::Vector4d(2, 2, 0, 0).asDiagonal();
+  auto cost = prog.AddQuadraticCost(Q, Eigen::Vector4d(-2, -4, 1, 0), 5, xb);
+  // x(i) ≤ 3 b(i).
+  Eigen::Matrix<double, 2, 4> A;
+  A << 1, 0, -3, 0, 0, 1, 0, -3;
+  auto big_m = prog.AddLinearConstraint(
+      A, Eigen::Vector2d::Constant(-std::numeric_limits<double>::infinity()),
+      Eigen::Vector2d::Zero(), xb);
+  auto choice = prog.AddLinearConstraint(b(0) + b(1) <= 1);
+  auto bounds = prog.AddBoundingBoxConstraint(-3, 3, x);
+
+  GurobiSolver solver;
+  if (solver.available()) {
+    GurobiSolver persistent_solver;
+    EXPECT_FALSE(persistent_solver.use_persistent_model());
+    persistent_solver.set_use_persistent_model(true);
+    EXPECT_TRUE(persistent_solver.use_persistent_model());
+
+    const double tol = 1E-6;
+    auto check = [&](const Eigen::Vector2d& x_expected) {
+      const auto result = solver.Solve(prog);
+      const auto persistent_result = persistent_solver.Solve(prog);
+      ASSERT_TRUE(result.is_success());
+      ASSERT_TRUE(persistent_result.is_success());
+      EXPECT_TRUE(CompareMatrices(result.GetSolution(x), x_expected, tol));
+      EXPECT_TRUE(CompareMatrices(persistent_result.GetSolution(x),
+                                  result.GetSolution(x), tol));
+      EXPECT_NEAR(persistent_result.get_optimal_cost(),
+                  result.get_optimal_cost(), tol);
+    };
+    check(Eigen::Vector2d(0, 2));
+
+    // Changes the cost to (x(0) - 4)² + (x(1) - 1)² + b(0), for which b(0)
+    // is now chosen.
+    cost.evaluator()->UpdateCoefficients(Q, Eigen::Vector4d(-8, -2, 1, 0), 17);
+    check(Eigen::Vector2d(3, 0));
+
+    // Changes the bounds, both the variable bounds and the ones of a linear
+    // constraint.
+    bounds.evaluator()->UpdateUpperBound(Eigen::Vector2d(0.5, 3));
+    big_m.evaluator()->UpdateCoefficientEntry(0, 2, -0.2);
+    check(Eigen::Vector2d(0, 1));
+
+    // Changes the structure of the program, which rebuilds the model.
+    choice.evaluator()->UpdateLowerBound(Vector1d(1));
+    prog.AddLinearEqualityConstraint(b(0) == 1);
+    check(Eigen::Vector2d(0.2, 0));
+
+    persistent_solver.set_use_persistent_model(false);
+    EXPECT_FALSE(persistent_solver.use_persistent_model());
+    check(Eigen::Vector2d(0.2, 0));
+  }
+}
+
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
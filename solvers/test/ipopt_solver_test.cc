@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -192,6 +193,51 @@ GTEST_TEST(IpoptSolverTest, EckhardtDualSolution) {
   IpoptSolver solver;
   TestEckhardtDualSolution(solver, Eigen::Vector3d(1., 1., 5.));
 }
+// The cost (x(0) - 1)⁴ + (x(0) - x(1))², as a functor, which makes a cost that
+// cannot be evaluated symbolically.
+class QuarticCost {
+ public:
+  int numInputs() const { return 2; }
+  int numOutputs() const { return 1; }
+  template <typename T>
+  void eval(internal::VecIn<T> const& x, internal::VecOut<T>* y) const {
+    const T e0 = x(0) - 1;
+    const T e1 = x(0) - x(1);
+    y->resize(1);
+    (*y)(0) = e0 * e0 * e0 * e0 + e1 * e1;
+  }
+};
+
+GTEST_TEST(IpoptSolverTest, ExactHessian) {
+  // A convex program with costs and constraints for both the symbolic and the
+  // central differences Hessians, solved with the default limited-memory
+  // Hessian approximation and with the exact Hessian.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  prog.AddCost(QuarticCost(), x.head<2>());
+  prog.AddQuadraticCost((x(2) - 2) * (x(2) - 2));
+  prog.AddCost(exp(x(0) - x(2)));
+  prog.AddConstraint(x(0) * x(0) + x(1) * x(1) + x(2) * x(2) <= 4);
+  prog.AddLorentzConeConstraint(
+      Vector3<symbolic::Expression>(3 - x(2), x(0), x(1)));
+  prog.AddLinearConstraint(x(0) + x(1) >= 0.5);
+
+  IpoptSolver solver;
+  if (solver.available()) {
+    const Eigen::Vector3d x_init(0.5, 0.5, 0.5);
+    const auto result = solver.Solve(prog, x_init, {});
+    SolverOptions options;
+    options.SetOption(IpoptSolver::id(), "hessian_approximation", "exact");
+    const auto exact_result = solver.Solve(prog, x_init, options);
+    ASSERT_TRUE(result.is_success());
+    ASSERT_TRUE(exact_result.is_success());
+    EXPECT_TRUE(CompareMatrices(exact_result.GetSolution(x),
+                                result.GetSolution(x), 1E-6));
+    EXPECT_NEAR(exact_result.get_optimal_cost(), result.get_optimal_cost(),
+                1E-8);
+  }
+}
+
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
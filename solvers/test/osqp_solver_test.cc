@@ -1,5 +1,9 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+#include <tuple>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -141,6 +145,47 @@ GTEST_TEST(OsqpSolverTest, EqualityConstrainedQPDualSolution2) {
   TestEqualityConstrainedQPDualSolution2(solver);
 }
 
+GTEST_TEST(OsqpSolverTest, ReuseWorkspace) {
+  // min w(x₀ − a)² + (x₁ − 1)²
+  // s.t x₀ + w x₁ ≤ c
+  const double kInf = std::numeric_limits<double>::infinity();
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto cost = prog.AddQuadraticCost(Eigen::Matrix2d::Identity() * 2,
+                                    Eigen::Vector2d::Zero(), x);
+  auto constraint =
+      prog.AddLinearConstraint(Eigen::RowVector2d(1, 1), -kInf, 1, x);
+
+  OsqpSolver reusing_solver;
+  EXPECT_FALSE(reusing_solver.reuse_workspace());
+  reusing_solver.set_reuse_workspace(true);
+  EXPECT_TRUE(reusing_solver.reuse_workspace());
+  if (reusing_solver.available()) {
+    OsqpSolver fresh_solver;
+    const double tol = 1E-5;
+    // Only the vectors change in the first three programs; the last one
+    // changes the values of P and A as well.
+    const std::vector<std::tuple<double, double, double>> w_a_c{
+        {1, 2, 1}, {1, -1, 1}, {1, 3, 0.5}, {4, 3, 0.5}};
+    for (const auto& [w, a, c] : w_a_c) {
+      const Eigen::Matrix2d Q = Eigen::Vector2d(2 * w, 2).asDiagonal();
+      cost.evaluator()->UpdateCoefficients(Q,
+                                           Eigen::Vector2d(-2 * w * a, -2));
+      constraint.evaluator()->UpdateCoefficients(
+          Eigen::RowVector2d(1, w), Vector1d(-kInf), Vector1d(c));
+      const auto reused_result = reusing_solver.Solve(prog, {}, {});
+      const auto fresh_result = fresh_solver.Solve(prog, {}, {});
+      EXPECT_TRUE(reused_result.is_success());
+      EXPECT_TRUE(CompareMatrices(reused_result.GetSolution(x),
+                                  fresh_result.GetSolution(x), tol));
+      EXPECT_NEAR(reused_result.get_optimal_cost(),
+                  fresh_result.get_optimal_cost(), tol);
+    }
+  }
+  reusing_solver.set_reuse_workspace(false);
+  EXPECT_FALSE(reusing_solver.reuse_workspace());
+}
+
 GTEST_TEST(OsqpSolverTest, SolverOptionsTest) {
   MathematicalProgram prog;
   auto x = prog.NewContinuousVariables<3>();
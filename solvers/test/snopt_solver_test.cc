@@ -243,6 +243,29 @@ GTEST_TEST(SnoptTest, DistanceToTetrahedron) {
           .all());
 }
 
+// Evaluating the nonlinear constraints on several threads must not change the
+// result.
+GTEST_TEST(SnoptTest, EvaluationThreads) {
+  DistanceToTetrahedronExample prog(0.2);
+  Eigen::Matrix<double, 18, 1> x0;
+  x0 << 0, 0, 0, 0.7, 0.8, 0.9, 0.1, 0.2, 0.3, 1, 1, 1, 1, 0.4, 0.5, 0.6, 1.1,
+      1.2;
+  prog.SetInitialGuessForAllVariables(x0);
+
+  SnoptSolver solver;
+  const auto result_serial = solver.Solve(prog, {}, {});
+
+  SolverOptions options;
+  options.SetOption(SnoptSolver::id(), "Drake evaluation threads", 4);
+  const auto result_parallel = solver.Solve(prog, {}, options);
+  EXPECT_EQ(result_parallel.is_success(), result_serial.is_success());
+  EXPECT_TRUE(CompareMatrices(result_parallel.GetSolution(prog.x()),
+                              result_serial.GetSolution(prog.x()), 0.));
+
+  options.SetOption(SnoptSolver::id(), "Drake evaluation threads", 0);
+  EXPECT_THROW(solver.Solve(prog, {}, options), std::logic_error);
+}
+
 // Test if we can run several snopt solvers simultaneously on multiple threads.
 // We create a convex QP problem with a unique global optimal, starting from
 // different initial guesses, snopt should output the same result.
@@ -561,14 +561,14 @@ bool UnrevisedLemkeSolver<T>::ConstructLemkeSolution(
   // Compute the solution by pivoting the artificial variable, which was just
   // identified as the blocking variable, from the set of dependent variables
   // to the set of independent variables.
-  VectorX<T> q_prime(n);
-  if (!LemkePivot(M, q, artificial_index, zero_tol, nullptr, &q_prime))
+  q_prime_.resize(n);
+  if (!LemkePivot(M, q, artificial_index, zero_tol, nullptr, &q_prime_))
     return false;
 
   z->setZero(n);
   for (int i = 0; i < static_cast<int>(dep_variables_.size()); ++i) {
     if (dep_variables_[i].is_z())
-      (*z)[dep_variables_[i].index()] = q_prime[i];
+      (*z)[dep_variables_[i].index()] = q_prime_[i];
   }
   return true;
 }
@@ -606,7 +606,8 @@ bool UnrevisedLemkeSolver<T>::FindBlockingIndex(
   // Determine all variables within the zero tolerance of the minimum ratio,
   // while simultaneously looking for the presence of the artificial variable
   // among the (possible multiple) minima.
-  std::vector<int> blocking_indices;
+  std::vector<int>& blocking_indices = blocking_indices_;
+  blocking_indices.clear();
   for (int i = 0; i < n; ++i) {
     if (matrix_col[i] < -zero_tol) {
       DRAKE_LOGGER_DEBUG("Ratio for index {}: {}", i, ratios[i]);
@@ -793,8 +794,16 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   DRAKE_LOGGER_DEBUG("Dependent set variables: {}",
       to_string(dep_variables_));
 
-  // Pivot up to the maximum number of times.
-  VectorX<T> q_prime(n), M_prime_col(n);
+  // Pivot up to the maximum number of times. The permuted q, the driving
+  // column of the permuted M and the ratios for the minimum ratio test are
+  // stored in members so that repeated solves of problems of the same size
+  // do not allocate them again.
+  VectorX<T>& q_prime = q_prime_;
+  VectorX<T>& M_prime_col = M_prime_col_;
+  VectorX<T>& ratios = ratios_;
+  q_prime.resize(n);
+  M_prime_col.resize(n);
+  ratios.resize(n);
   while (++(*num_pivots) < max_pivots) {
     DRAKE_LOGGER_DEBUG("New driving variable {}{}",
                        ((indep_variables_[driving_index].is_z()) ? "z" : "w"),
@@ -809,9 +818,9 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     }
 
     // Find the blocking variable.
+    ratios = -(q_prime.array() / M_prime_col.array()).matrix();
     if (!FindBlockingIndex(
-        mod_zero_tol, M_prime_col,
-        -(q_prime.array() / M_prime_col.array()).matrix(), &blocking_index)) {
+        mod_zero_tol, M_prime_col, ratios, &blocking_index)) {
       z->setZero(n);
       return false;
     }
@@ -270,6 +270,8 @@ class UnrevisedLemkeSolver final : public SolverBase {
   mutable VectorX<T> q_alpha_, q_alpha_bar_, q_prime_beta_prime_,
       q_prime_alpha_bar_prime_, e_, M_prime_driving_beta_prime_,
       M_prime_driving_alpha_bar_prime_, g_alpha_, g_alpha_bar_;
+  mutable VectorX<T> q_prime_, M_prime_col_, ratios_;
+  mutable std::vector<int> blocking_indices_;
 
   // The index sets for the Lemke Algorithm and is a member variable to
   // permit warmstarting. Changing the index set between invocations of the LCP
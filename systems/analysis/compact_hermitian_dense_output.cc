@@ -0,0 +1,212 @@
+#include "drake/systems/analysis/compact_hermitian_dense_output.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Returns `state_indices`, or all the indices of a state of size `state_size`
+// if empty.
+std::vector<int> MakeStateIndices(int state_size,
+                                  std::vector<int> state_indices) {
+  DRAKE_THROW_UNLESS(state_size >= 0);
+  if (state_indices.empty()) {
+    state_indices.resize(state_size);
+    std::iota(state_indices.begin(), state_indices.end(), 0);
+  }
+  for (int index : state_indices) {
+    DRAKE_THROW_UNLESS(0 <= index && index < state_size);
+  }
+  return state_indices;
+}
+
+}  // namespace
+
+template <typename T>
+CompactHermitianDenseOutput<T>::CompactHermitianDenseOutput(
+    int state_size, std::vector<int> state_indices)
+    : state_size_(state_size),
+      state_indices_(MakeStateIndices(state_size, std::move(state_indices))),
+      num_elements_(state_indices_.size()) {}
+
+template <typename T>
+const T& CompactHermitianDenseOutput<T>::final_segment_start_time() const {
+  if (segment_first_knots_.empty()) {
+    throw std::logic_error(
+        "CompactHermitianDenseOutput::final_segment_start_time(): there are "
+        "no segments.");
+  }
+  return times_[segment_first_knots_.back()];
+}
+
+template <typename T>
+void CompactHermitianDenseOutput<T>::AppendSegment(
+    const T& start_time, const Eigen::Ref<const VectorX<T>>& start_state,
+    const Eigen::Ref<const VectorX<T>>& start_state_derivative,
+    const T& end_time, const Eigen::Ref<const VectorX<T>>& end_state,
+    const Eigen::Ref<const VectorX<T>>& end_state_derivative) {
+  DRAKE_THROW_UNLESS(start_state.size() == state_size_);
+  DRAKE_THROW_UNLESS(start_state_derivative.size() == state_size_);
+  DRAKE_THROW_UNLESS(end_state.size() == state_size_);
+  DRAKE_THROW_UNLESS(end_state_derivative.size() == state_size_);
+  if (!(ExtractDoubleOrThrow(start_time) < ExtractDoubleOrThrow(end_time))) {
+    throw std::runtime_error(fmt::format(
+        "CompactHermitianDenseOutput::AppendSegment(): the segment end time {} "
+        "is not greater than its start time {}.",
+        ExtractDoubleOrThrow(end_time), ExtractDoubleOrThrow(start_time)));
+  }
+
+  // A segment shares its start knot with the end of the previous segment,
+  // unless the output is discontinuous there.
+  bool add_start_knot = times_.empty();
+  if (!add_start_knot) {
+    if (ExtractDoubleOrThrow(start_time) !=
+        ExtractDoubleOrThrow(times_.back())) {
+      throw std::runtime_error(fmt::format(
+          "CompactHermitianDenseOutput::AppendSegment(): the segment start "
+          "time {} is not the end time {} of the output.",
+          ExtractDoubleOrThrow(start_time),
+          ExtractDoubleOrThrow(times_.back())));
+    }
+    const int last = times_.size() - 1;
+    for (int i = 0; i < num_elements_ && !add_start_knot; ++i) {
+      const int index = state_indices_[i];
+      add_start_knot =
+          ExtractDoubleOrThrow(start_state[index]) !=
+              ExtractDoubleOrThrow(knot_values(last)[i]) ||
+          ExtractDoubleOrThrow(start_state_derivative[index]) !=
+              ExtractDoubleOrThrow(knot_derivatives(last)[i]);
+    }
+  }
+  if (add_start_knot) {
+    segment_first_knots_.push_back(times_.size());
+    AppendKnot(start_time, start_state, start_state_derivative);
+  } else {
+    segment_first_knots_.push_back(times_.size() - 1);
+  }
+  segment_added_start_knot_.push_back(add_start_knot);
+  AppendKnot(end_time, end_state, end_state_derivative);
+}
+
+template <typename T>
+void CompactHermitianDenseOutput<T>::RemoveFinalSegment() {
+  if (segment_first_knots_.empty()) {
+    throw std::logic_error(
+        "CompactHermitianDenseOutput::RemoveFinalSegment(): there are no "
+        "segments.");
+  }
+  const int num_knots = segment_first_knots_.back() +
+                        (segment_added_start_knot_.back() ? 0 : 1);
+  times_.resize(num_knots);
+  knot_data_.resize(2 * num_elements_ * num_knots);
+  segment_first_knots_.pop_back();
+  segment_added_start_knot_.pop_back();
+}
+
+template <typename T>
+MatrixX<T> CompactHermitianDenseOutput<T>::EvaluateBatch(
+    const std::vector<T>& times) const {
+  this->ThrowIfOutputIsEmpty(__func__);
+  MatrixX<T> values(num_elements_, times.size());
+  int knot = 0;
+  for (int j = 0; j < static_cast<int>(times.size()); ++j) {
+    this->ThrowIfTimeIsInvalid(__func__, times[j]);
+    knot = FindKnot(times[j], knot);
+    for (int n = 0; n < num_elements_; ++n) {
+      values(n, j) = EvaluateElement(knot, times[j], n);
+    }
+  }
+  return values;
+}
+
+template <typename T>
+VectorX<T> CompactHermitianDenseOutput<T>::DoEvaluate(const T& t) const {
+  const int knot = FindKnot(t);
+  VectorX<T> value(num_elements_);
+  for (int n = 0; n < num_elements_; ++n) {
+    value[n] = EvaluateElement(knot, t, n);
+  }
+  return value;
+}
+
+template <typename T>
+T CompactHermitianDenseOutput<T>::DoEvaluateNth(const T& t, int n) const {
+  return EvaluateElement(FindKnot(t), t, n);
+}
+
+template <typename T>
+int CompactHermitianDenseOutput<T>::FindKnot(const T& t, int hint) const {
+  const double time = ExtractDoubleOrThrow(t);
+  const int num_knots = times_.size();
+  const auto time_of = [this](int k) {
+    return ExtractDoubleOrThrow(times_[k]);
+  };
+  // Sorted times only move forward by a few knots, hence the hint is tried
+  // before a binary search.
+  if (time_of(hint) <= time) {
+    for (int k = hint; k < hint + 2 && k + 1 < num_knots; ++k) {
+      if (time < time_of(k + 1)) return k;
+    }
+    if (time_of(num_knots - 1) <= time) return num_knots - 1;
+  }
+  // Binary search for the largest knot with time_of(knot) <= time, knowing
+  // that time_of(0) <= time since t is within the domain.
+  int low = 0;
+  int high = num_knots - 1;
+  while (low < high) {
+    const int mid = (low + high + 1) / 2;
+    if (time_of(mid) <= time) {
+      low = mid;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return low;
+}
+
+template <typename T>
+T CompactHermitianDenseOutput<T>::EvaluateElement(int knot, const T& t,
+                                                  int n) const {
+  // At the end time, the output is the value at the last knot.
+  if (knot + 1 == static_cast<int>(times_.size())) {
+    return knot_values(knot)[n];
+  }
+  // Cubic Hermite basis functions on [t₀, t₁], with s = (t - t₀) / h and
+  // h = t₁ - t₀. Since knot is the largest one with t₀ <= t, h > 0.
+  const T h = times_[knot + 1] - times_[knot];
+  const T s = (t - times_[knot]) / h;
+  const T s2 = s * s;
+  const T s3 = s2 * s;
+  const T h00 = 2 * s3 - 3 * s2 + 1;
+  const T h10 = s3 - 2 * s2 + s;
+  const T h01 = -2 * s3 + 3 * s2;
+  const T h11 = s3 - s2;
+  return h00 * knot_values(knot)[n] + h10 * h * knot_derivatives(knot)[n] +
+         h01 * knot_values(knot + 1)[n] +
+         h11 * h * knot_derivatives(knot + 1)[n];
+}
+
+template <typename T>
+void CompactHermitianDenseOutput<T>::AppendKnot(
+    const T& time, const Eigen::Ref<const VectorX<T>>& state,
+    const Eigen::Ref<const VectorX<T>>& state_derivative) {
+  times_.push_back(time);
+  for (int index : state_indices_) knot_data_.push_back(state[index]);
+  for (int index : state_indices_) {
+    knot_data_.push_back(state_derivative[index]);
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::systems::CompactHermitianDenseOutput)
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/analysis/dense_output.h"
+
+namespace drake {
+namespace systems {
+
+/// A DenseOutput class implementation using cubic Hermite interpolation, with a
+/// compact representation suitable to record the trajectories of long runs of
+/// high-dimensional systems.
+///
+/// The output is built from segments, typically integration steps, for which
+/// the state 𝐱 and the state time derivative d𝐱/dt are known at both ends. On
+/// each segment, the output is the cubic Hermite polynomial that interpolates
+/// these, as with PiecewisePolynomial::CubicHermite(), yielding a C1 extension
+/// of the solution 𝐱(t) (see also HermitianDenseOutput).
+///
+/// Rather than storing the coefficients of one Polynomial per element and per
+/// segment, this dense output only stores the values of 𝐱 and d𝐱/dt at the
+/// ends of the segments, which are shared by consecutive segments. These are
+/// packed into a single contiguous array, so that each step of an integration
+/// takes 2⋅n scalars and one time for n recorded elements, without per-step
+/// heap allocations. Optionally, only a subset of the elements of the state is
+/// recorded, see CompactHermitianDenseOutput().
+///
+/// Evaluations take logarithmic time in the number of segments, and
+/// EvaluateBatch() evaluates many times at once, in linear time overall when
+/// the times are sorted.
+///
+/// @tparam_default_scalar
+template <typename T>
+class CompactHermitianDenseOutput final : public DenseOutput<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CompactHermitianDenseOutput)
+
+  /// Constructs an empty output for states of size `state_size`, that records
+  /// the elements of the states with the given `state_indices`, in that order,
+  /// or all the elements if `state_indices` is empty. That is, the i-th
+  /// element of the output is the `state_indices[i]`-th element of the state.
+  /// @throws std::exception if `state_size` is negative or if an element of
+  ///   `state_indices` is not in [0, state_size).
+  explicit CompactHermitianDenseOutput(int state_size,
+                                       std::vector<int> state_indices = {});
+
+  /// Returns the size of the states given to AppendSegment().
+  int state_size() const { return state_size_; }
+
+  /// Returns the indices of the recorded elements of the state, see
+  /// CompactHermitianDenseOutput().
+  const std::vector<int>& state_indices() const { return state_indices_; }
+
+  /// Returns the number of segments appended with AppendSegment() and not
+  /// removed with RemoveFinalSegment().
+  int get_number_of_segments() const {
+    return static_cast<int>(segment_first_knots_.size());
+  }
+
+  /// Returns the start time of the last segment.
+  /// @throws std::exception if there are no segments.
+  const T& final_segment_start_time() const;
+
+  /// Appends the segment [`start_time`, `end_time`] on which the output
+  /// interpolates the `start_state` and `start_state_derivative` at
+  /// `start_time` and the `end_state` and `end_state_derivative` at
+  /// `end_time`. All the states have size state_size(), and only the elements
+  /// in state_indices() are recorded.
+  ///
+  /// Unless this output is empty, `start_time` must equal end_time(). If the
+  /// start values differ from the values at end_time(), e.g. because the state
+  /// was modified between two integration steps, the output is discontinuous
+  /// at `start_time`, where it evaluates to the start values of the new
+  /// segment.
+  ///
+  /// @throws std::exception if `end_time` is not greater than `start_time`, if
+  ///   `start_time` is not end_time() (unless empty), or if the sizes of the
+  ///   states are not state_size().
+  void AppendSegment(const T& start_time,
+                     const Eigen::Ref<const VectorX<T>>& start_state,
+                     const Eigen::Ref<const VectorX<T>>& start_state_derivative,
+                     const T& end_time,
+                     const Eigen::Ref<const VectorX<T>>& end_state,
+                     const Eigen::Ref<const VectorX<T>>& end_state_derivative);
+
+  /// Removes the last segment appended with AppendSegment().
+  /// @throws std::exception if there are no segments.
+  void RemoveFinalSegment();
+
+  /// Evaluates the output at each of the given `times`.
+  /// @returns A matrix with size() rows, whose j-th column is the value of the
+  ///   output at `times[j]`.
+  /// @throws std::exception if the output is empty or if a time is not within
+  ///   [start_time(), end_time()].
+  MatrixX<T> EvaluateBatch(const std::vector<T>& times) const;
+
+ protected:
+  VectorX<T> DoEvaluate(const T& t) const override;
+
+  T DoEvaluateNth(const T& t, int n) const override;
+
+  bool do_is_empty() const override { return times_.empty(); }
+
+  int do_size() const override { return num_elements_; }
+
+  const T& do_start_time() const override { return times_.front(); }
+
+  const T& do_end_time() const override { return times_.back(); }
+
+ private:
+  // Returns the largest knot k with times_[k] <= t, starting the search from
+  // the `hint` knot.
+  int FindKnot(const T& t, int hint = 0) const;
+
+  // Returns the value of the `n`-th output element at `t` on the segment that
+  // starts at `knot`.
+  T EvaluateElement(int knot, const T& t, int n) const;
+
+  // Appends a knot with the recorded elements of `state` and
+  // `state_derivative` at `time`.
+  void AppendKnot(const T& time, const Eigen::Ref<const VectorX<T>>& state,
+                  const Eigen::Ref<const VectorX<T>>& state_derivative);
+
+  // Returns the recorded values, or their time derivatives, at `knot`.
+  Eigen::Map<const VectorX<T>> knot_values(int knot) const {
+    return Eigen::Map<const VectorX<T>>(
+        knot_data_.data() + 2 * num_elements_ * knot, num_elements_);
+  }
+  Eigen::Map<const VectorX<T>> knot_derivatives(int knot) const {
+    return Eigen::Map<const VectorX<T>>(
+        knot_data_.data() + 2 * num_elements_ * knot + num_elements_,
+        num_elements_);
+  }
+
+  const int state_size_;
+  const std::vector<int> state_indices_;
+  const int num_elements_;
+
+  // The times of the knots, in non-decreasing order. Two consecutive knots
+  // have the same time at a discontinuity.
+  std::vector<T> times_;
+  // The recorded values followed by their time derivatives at each knot,
+  // packed knot after knot.
+  std::vector<T> knot_data_;
+  // The first knot of each segment, which is also the number of knots before
+  // the segment was appended when it added its start knot.
+  std::vector<int> segment_first_knots_;
+  // Whether each segment added its start knot (i.e. it is the first segment or
+  // starts at a discontinuity).
+  std::vector<bool> segment_added_start_knot_;
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::systems::CompactHermitianDenseOutput)
@@ -1,10 +1,12 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff_gradient.h"
 
@@ -22,6 +24,8 @@ void ImplicitIntegrator<T>::DoResetStatistics() {
 template <class T>
 void ImplicitIntegrator<T>::DoReset() {
   J_.resize(0, 0);
+  jacobian_sparsity_.reset();
+  jacobian_age_ = 0;
   DoResetCachedJacobianRelatedMatrices();
   // Call any Reset() provided by child integrator classes.
   DoImplicitIntegratorReset();
@@ -100,8 +104,9 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
   context->SetTimeAndContinuousState(t, xt);
   const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
 
-  // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
+  // Form the perturbed states, one per column.
+  MatrixX<T> X = xt.replicate(1, n);
+  VectorX<T> dx(n);
   for (int i = 0; i < n; ++i) {
     // Compute a good increment to the dimension using approximately 1/eps
     // digits of precision. Note that if |xt| is large, the increment will
@@ -121,18 +126,19 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xt_prime(i) = xt(i) + dxi;
-    dxi = xt_prime(i) - xt(i);
-
-    // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
-    //              Switch to a method that invalides just the relevant
-    //              partition, and ideally modify only the one changed element.
-    // Compute f' and set the relevant column of the Jacobian matrix.
-    context->SetTimeAndContinuousState(t, xt_prime);
-    J->col(i) = (this->EvalTimeDerivatives(*context).CopyToVector() - f) / dxi;
-
-    // Reset xt' to xt.
-    xt_prime(i) = xt(i);
+    X(i, i) = xt(i) + dxi;
+    dx(i) = X(i, i) - xt(i);
+  }
+
+  // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
+  //              Switch to a method that invalides just the relevant
+  //              partition, and ideally modify only the one changed element.
+  // Compute f' for each perturbed state and set the relevant column of the
+  // Jacobian matrix.
+  MatrixX<T> F;
+  EvalTimeDerivativesAtStates(t, X, context, &F);
+  for (int i = 0; i < n; ++i) {
+    J->col(i) = (F.col(i) - f) / dx(i);
   }
 }
 
@@ -155,12 +161,10 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
   // Initialize the Jacobian.
   J->resize(n, n);
 
-  // Evaluate f(t,xt).
-  context->SetTimeAndContinuousState(t, xt);
-  const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
-
-  // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
+  // Form the perturbed states: x + dx in columns [0, n) and x - dx in columns
+  // [n, 2n).
+  MatrixX<T> X = xt.replicate(1, 2 * n);
+  VectorX<T> dx_plus(n), dx_minus(n);
   for (int i = 0; i < n; ++i) {
     // Compute a good increment to the dimension using approximately 1/eps
     // digits of precision. Note that if |xt| is large, the increment will
@@ -180,43 +184,198 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xt_prime(i) = xt(i) + dxi;
-    const T dxi_plus = xt_prime(i) - xt(i);
-
-    // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
-    //              Switch to a method that invalides just the relevant
-    //              partition, and ideally modify only the one changed element.
-    // Compute f(x+dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_plus = this->EvalTimeDerivatives(*context).CopyToVector();
-
-    // Update xt' again, minimizing the effect of roundoff error.
-    xt_prime(i) = xt(i) - dxi;
-    const T dxi_minus = xt(i) - xt_prime(i);
-
-    // Compute f(x-dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_minus = this->EvalTimeDerivatives(
-        *context).CopyToVector();
-
-    // Set the Jacobian column.
-    J->col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
-
-    // Reset xt' to xt.
-    xt_prime(i) = xt(i);
+    X(i, i) = xt(i) + dxi;
+    dx_plus(i) = X(i, i) - xt(i);
+    X(i, n + i) = xt(i) - dxi;
+    dx_minus(i) = xt(i) - X(i, n + i);
+  }
+
+  // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
+  //              Switch to a method that invalides just the relevant
+  //              partition, and ideally modify only the one changed element.
+  // Compute f(x+dx) and f(x-dx) and set the Jacobian columns.
+  MatrixX<T> F;
+  EvalTimeDerivativesAtStates(t, X, context, &F);
+  for (int i = 0; i < n; ++i) {
+    J->col(i) = (F.col(i) - F.col(n + i)) / (dx_plus(i) + dx_minus(i));
+  }
+}
+
+template <class T>
+void ImplicitIntegrator<T>::DetectJacobianSparsity(const MatrixX<T>& J) {
+  const int n = J.cols();
+  JacobianSparsity sparsity;
+  sparsity.column_rows.resize(n);
+  std::vector<std::vector<int>> row_columns(J.rows());
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < J.rows(); ++i) {
+      if (J(i, j) != 0.0) {
+        sparsity.column_rows[j].push_back(i);
+        row_columns[i].push_back(j);
+      }
+    }
+  }
+
+  // Greedily assign each column to the first group containing no column that
+  // shares a nonzero row with it [Curtis 1974]. forbidden[g] == j indicates
+  // that group g is unavailable to column j.
+  std::vector<int> group_of_column(n, -1);
+  std::vector<int> forbidden;
+  for (int j = 0; j < n; ++j) {
+    for (int i : sparsity.column_rows[j]) {
+      for (int k : row_columns[i]) {
+        if (group_of_column[k] >= 0) forbidden[group_of_column[k]] = j;
+      }
+    }
+    const int group = static_cast<int>(
+        std::find_if(forbidden.begin(), forbidden.end(),
+                     [j](int f) { return f != j; }) - forbidden.begin());
+    if (group == static_cast<int>(forbidden.size())) {
+      forbidden.push_back(-1);
+      sparsity.column_groups.emplace_back();
+    }
+    group_of_column[j] = group;
+    sparsity.column_groups[group].push_back(j);
+  }
+
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator detected Jacobian sparsity: {} columns in {} "
+      "groups", n, sparsity.column_groups.size());
+  jacobian_sparsity_ = std::move(sparsity);
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeGroupedDiffJacobian(
+    bool central, const T& t, const VectorX<T>& xt, Context<T>* context,
+    MatrixX<T>* J) {
+  DRAKE_DEMAND(jacobian_sparsity_.has_value());
+  using std::abs;
+
+  // See ComputeForwardDiffJacobian() and ComputeCentralDiffJacobian() for the
+  // choices of epsilon and of the increments.
+  const double eps = central ?
+      std::pow(std::numeric_limits<double>::epsilon(), 5.0/12) :
+      std::sqrt(std::numeric_limits<double>::epsilon());
+
+  const int n = context->num_continuous_states();
+  DRAKE_DEMAND(static_cast<int>(jacobian_sparsity_->column_rows.size()) == n);
+
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator Compute Grouped {}diff {}-Jacobian t={}",
+      central ? "Central" : "Forward", n, t);
+
+  J->setZero(n, n);
+
+  // Evaluate f(t,xt), which only forward differencing needs.
+  VectorX<T> f;
+  if (!central) {
+    context->SetTimeAndContinuousState(t, xt);
+    f = this->EvalTimeDerivatives(*context).CopyToVector();
+  }
+
+  // Form the perturbed states, perturbing every state variable in a group at
+  // once: x + dx for group g is in column g and, for central differences,
+  // x - dx is in column num_groups + g.
+  const std::vector<std::vector<int>>& groups =
+      jacobian_sparsity_->column_groups;
+  const int num_groups = static_cast<int>(groups.size());
+  MatrixX<T> X = xt.replicate(1, central ? 2 * num_groups : num_groups);
+  VectorX<T> dx_plus(n), dx_minus(n);
+  for (int g = 0; g < num_groups; ++g) {
+    for (int j : groups[g]) {
+      const T abs_xj = abs(xt(j));
+      const T dxj = (abs_xj <= 1) ? T(eps) : T(eps * abs_xj);
+      X(j, g) = xt(j) + dxj;
+      dx_plus(j) = X(j, g) - xt(j);
+      if (central) {
+        X(j, num_groups + g) = xt(j) - dxj;
+        dx_minus(j) = xt(j) - X(j, num_groups + g);
+      }
+    }
+  }
+  MatrixX<T> F;
+  EvalTimeDerivativesAtStates(t, X, context, &F);
+
+  // No two columns in a group share a nonzero row, so each row's change is
+  // attributable to a single perturbed state variable.
+  for (int g = 0; g < num_groups; ++g) {
+    for (int j : groups[g]) {
+      for (int i : jacobian_sparsity_->column_rows[j]) {
+        (*J)(i, j) = central ?
+            T((F(i, g) - F(i, num_groups + g)) / (dx_plus(j) + dx_minus(j))) :
+            T((F(i, g) - f(i)) / dx_plus(j));
+      }
+    }
   }
 }
 
+template <class T>
+void ImplicitIntegrator<T>::EvalTimeDerivativesAtStates(
+    const T& t, const MatrixX<T>& X, Context<T>* context, MatrixX<T>* F) {
+  const int num_states = X.cols();
+  F->resize(X.rows(), num_states);
+  const int num_threads = std::min(num_jacobian_threads_, num_states);
+  if (num_threads <= 1) {
+    for (int k = 0; k < num_states; ++k) {
+      context->SetTimeAndContinuousState(t, X.col(k));
+      F->col(k) = this->EvalTimeDerivatives(*context).CopyToVector();
+    }
+    return;
+  }
+
+  // The first thread uses the integrator's context; each of the others uses a
+  // clone. Derivative evaluations are counted per thread (as in
+  // EvalTimeDerivatives()) and totaled afterward.
+  std::vector<std::unique_ptr<Context<T>>> clones(num_threads - 1);
+  for (auto& clone : clones) clone = context->Clone();
+  std::vector<int64_t> num_evaluations(num_threads, 0);
+  const System<T>& system = this->get_system();
+  const CacheEntry& entry = system.get_time_derivatives_cache_entry();
+  drake::internal::StaticParallelForRange(
+      num_states, num_threads,
+      [&](int thread_num, int begin, int end) {
+        Context<T>* worker_context =
+            (thread_num == 0) ? context : clones[thread_num - 1].get();
+        for (int k = begin; k < end; ++k) {
+          worker_context->SetTimeAndContinuousState(t, X.col(k));
+          const CacheEntryValue& value =
+              entry.get_cache_entry_value(*worker_context);
+          const int64_t serial_number_before = value.serial_number();
+          F->col(k) = system.EvalTimeDerivatives(*worker_context)
+                          .CopyToVector();
+          if (value.serial_number() != serial_number_before) {
+            ++num_evaluations[thread_num];
+          }
+        }
+      });
+  int64_t total = 0;
+  for (int64_t count : num_evaluations) total += count;
+  this->add_derivative_evaluations(total);
+}
+
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
-  LU_.compute(iteration_matrix);
+  sparse_factored_ = false;
+  if (use_sparse_factorization_) {
+    if (!sparse_LU_) {
+      sparse_LU_ =
+          std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+    }
+    const Eigen::SparseMatrix<double> A = iteration_matrix.sparseView();
+    sparse_LU_->compute(A);
+    // Fall back to the dense factorization should the sparse one fail (e.g.,
+    // for a structurally singular matrix).
+    sparse_factored_ = (sparse_LU_->info() == Eigen::Success);
+  }
+  if (!sparse_factored_) LU_.compute(iteration_matrix);
   matrix_factored_ = true;
 }
 
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_factored_) return sparse_LU_->solve(b);
   return LU_.solve(b);
 }
 
@@ -304,11 +463,19 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   [this, context, &system, &t, &x]() {
     switch (jacobian_scheme_) {
       case JacobianComputationScheme::kForwardDifference:
-        ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        if (jacobian_sparsity_) {
+          ComputeGroupedDiffJacobian(false, t, x, &*context, &J_);
+        } else {
+          ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kCentralDifference:
-        ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        if (jacobian_sparsity_) {
+          ComputeGroupedDiffJacobian(true, t, x, &*context, &J_);
+        } else {
+          ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kAutomatic:
@@ -317,6 +484,14 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
     }
   }();
 
+  // The first finite-difference Jacobian computed in sparse mode determines
+  // the sparsity pattern of all later ones.
+  if (use_sparse_jacobian_ && !jacobian_sparsity_ &&
+      jacobian_scheme_ != JacobianComputationScheme::kAutomatic &&
+      !IsBadJacobian(J_)) {
+    DetectJacobianSparsity(J_);
+  }
+
   // Use the new number of ODE evaluations to determine the number of Jacobian
   // evaluations.
   num_jacobian_function_evaluations_ += this->get_num_derivative_evaluations()
@@ -328,6 +503,7 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   // Mark the Jacobian as fresh, so that we don't recompute it unnecessarily
   // during the step.
   jacobian_is_fresh_ = true;
+  jacobian_age_ = 0;
 
   return J_;
 }
@@ -344,11 +520,38 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
   // Return immediately if full-Newton is not in use.
   if (!get_use_full_newton()) return;
 
+  iteration_matrix->set_use_sparse_factorization(use_sparse_jacobian_);
+
   // Compute the initial Jacobian and iteration matrices and factor them.
   MatrixX<T>& J = get_mutable_jacobian();
   J = CalcJacobian(t, xt);
+  FactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                        iteration_matrix);
+}
+
+template <class T>
+void ImplicitIntegrator<T>::FactorIterationMatrix(
+    const MatrixX<T>& J, const T& h,
+    const std::function<void(const MatrixX<T>&, const T&,
+        typename ImplicitIntegrator<T>::IterationMatrix*)>&
+        compute_and_factor_iteration_matrix,
+    typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
   ++num_iter_factorizations_;
   compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+  iteration_matrix->set_step_size(ExtractDoubleOrThrow(h));
+}
+
+template <class T>
+bool ImplicitIntegrator<T>::IterationMatrixStepSizeIsStale(
+    const typename ImplicitIntegrator<T>::IterationMatrix& iteration_matrix,
+    const T& h) const {
+  const double h0 = iteration_matrix.step_size();
+  // An unknown step size is never considered stale, preserving the default
+  // policy of unconditional reuse.
+  if (!(h0 > 0)) return false;
+  const double ratio = ExtractDoubleOrThrow(h) / h0;
+  return ratio < min_reuse_step_size_ratio_ ||
+         ratio > max_reuse_step_size_ratio_;
 }
 
 template <class T>
@@ -358,13 +561,15 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
         typename ImplicitIntegrator<T>::IterationMatrix*)>&
         compute_and_factor_iteration_matrix,
     typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+  iteration_matrix->set_use_sparse_factorization(use_sparse_jacobian_);
+
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
   MatrixX<T>& J = get_mutable_jacobian();
   if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
     J = CalcJacobian(t, xt);
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    FactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                          iteration_matrix);
     return true;  // Indicate success.
   }
 
@@ -381,17 +586,27 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
   // implicit Trapezoid iteration matrix is not factorized, and so this block
   // of code will factorize it.
   if (!iteration_matrix->matrix_factored()) {
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    FactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                          iteration_matrix);
     return true;  // Indicate success.
   }
 
   switch (trial) {
     case 1:
-      // For the first trial, we do nothing: this will cause the Newton-Raphson
-      // process to use the last computed (and already factored) iteration
-      // matrix. This matrix may be from a previous time-step or a previously-
-      // attempted step size.
+      // For the first trial, we usually do nothing: this will cause the
+      // Newton-Raphson process to use the last computed (and already factored)
+      // iteration matrix. This matrix may be from a previous time-step or a
+      // previously-attempted step size. The exceptions are when the user's
+      // reuse policy deems the Jacobian too old (recompute both matrices) or
+      // the factored step size too different from h (refactor only).
+      if (jacobian_age_ >= max_jacobian_age_ && !jacobian_is_fresh_) {
+        J = CalcJacobian(t, xt);
+        FactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                              iteration_matrix);
+      } else if (IterationMatrixStepSizeIsStale(*iteration_matrix, h)) {
+        FactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                              iteration_matrix);
+      }
       return true;  // Indicate success.
 
     case 2: {
@@ -416,8 +631,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
       // which requires the same iteration matrix (so the matrix is correct
       // and does not actually need recomputation).
       // In both cases, the right thing to do would be to skip to trial 3.
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      FactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                            iteration_matrix);
       return true;
     }
 
@@ -435,8 +650,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
       // Otherwise, we can reform the Jacobian matrix and refactor the
       // iteration matrix.
       J = CalcJacobian(t, xt);
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      FactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                            iteration_matrix);
       return true;
 
       case 4: {
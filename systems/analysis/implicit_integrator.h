@@ -1,15 +1,21 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/systems/analysis/integrator_base.h"
 
 namespace drake {
@@ -107,6 +113,65 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   /// @see set_use_full_newton()
   bool get_use_full_newton() const { return use_full_newton_; }
 
+  /// Sets the range of step size ratios over which a previously factored
+  /// iteration matrix may be reused without refactoring (default is
+  /// [0, ∞), i.e., always reuse). When reuse is active (see get_reuse()) and
+  /// the first Newton-Raphson attempt of a step would reuse an iteration
+  /// matrix that was formed for step size h₀, the matrix is instead reformed
+  /// (from the current Jacobian matrix) and refactored if the new step size h
+  /// gives h/h₀ outside of [`min_ratio`, `max_ratio`]. An iteration matrix
+  /// formed for a different step size slows, and can prevent, Newton-Raphson
+  /// convergence; [Hairer, 1996] uses [1, 1.2] in RADAU5 (p. 124).
+  ///
+  /// Use get_num_iteration_matrix_factorizations() and
+  /// get_num_newton_raphson_iterations() to weigh the cost of refactoring
+  /// against that of slower convergence.
+  /// @throws std::exception unless 0 ≤ `min_ratio` ≤ 1 ≤ `max_ratio`.
+  /// @note This setting does not affect VelocityImplicitEulerIntegrator, whose
+  ///       Jacobian matrices themselves depend on the step size.
+  void set_iteration_matrix_reuse_step_size_ratio_range(
+      double min_ratio, double max_ratio) {
+    DRAKE_THROW_UNLESS(0 <= min_ratio && min_ratio <= 1 && max_ratio >= 1);
+    min_reuse_step_size_ratio_ = min_ratio;
+    max_reuse_step_size_ratio_ = max_ratio;
+  }
+
+  /// Gets the smallest step size ratio over which an iteration matrix may be
+  /// reused.
+  /// @see set_iteration_matrix_reuse_step_size_ratio_range()
+  double get_iteration_matrix_reuse_min_step_size_ratio() const {
+    return min_reuse_step_size_ratio_;
+  }
+
+  /// Gets the largest step size ratio over which an iteration matrix may be
+  /// reused.
+  /// @see set_iteration_matrix_reuse_step_size_ratio_range()
+  double get_iteration_matrix_reuse_max_step_size_ratio() const {
+    return max_reuse_step_size_ratio_;
+  }
+
+  /// Sets the largest number of steps that may be taken with a Jacobian
+  /// matrix before it is recomputed, when reuse is active (default is
+  /// unlimited). A Jacobian matrix whose age (the number of successful steps
+  /// taken since it was computed) has reached `max_age` is recomputed at the
+  /// start of the next step rather than after Newton-Raphson convergence
+  /// failures. One causes a fresh Jacobian matrix at every step.
+  ///
+  /// Use get_num_jacobian_evaluations() and
+  /// get_num_derivative_evaluations_for_jacobian() to weigh the cost of
+  /// Jacobian matrices against that of convergence failures.
+  /// @throws std::exception if `max_age` is not positive.
+  /// @note This setting does not affect VelocityImplicitEulerIntegrator.
+  void set_max_jacobian_age(int max_age) {
+    DRAKE_THROW_UNLESS(max_age >= 1);
+    max_jacobian_age_ = max_age;
+  }
+
+  /// Gets the largest number of steps that may be taken with a Jacobian
+  /// matrix before it is recomputed.
+  /// @see set_max_jacobian_age()
+  int get_max_jacobian_age() const { return max_jacobian_age_; }
+
   /// Sets the Jacobian computation scheme. This function can be safely called
   /// at any time (i.e., the integrator need not be re-initialized afterward).
   /// @note Discards any already-computed Jacobian matrices if the scheme
@@ -114,6 +179,7 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   void set_jacobian_computation_scheme(JacobianComputationScheme scheme) {
     if (jacobian_scheme_ != scheme) {
       J_.resize(0, 0);
+      jacobian_sparsity_.reset();
       // Reset the Jacobian and any matrices cached by child integrators.
       DoResetCachedJacobianRelatedMatrices();
     }
@@ -123,6 +189,83 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   JacobianComputationScheme get_jacobian_computation_scheme() const {
     return jacobian_scheme_;
   }
+
+  /// (Advanced) Sets the number of threads used to evaluate the time
+  /// derivatives at the perturbed states needed to compute a Jacobian matrix
+  /// by finite differences (kForwardDifference or kCentralDifference). The
+  /// default is 1, in which case the perturbed states are evaluated one after
+  /// another on the calling thread.
+  ///
+  /// With more than one thread, the integrator's Context is cloned once for
+  /// each additional thread every time a Jacobian matrix is computed, and the
+  /// perturbed states are divided evenly among the threads. The resulting
+  /// Jacobian matrix does not depend on the number of threads.
+  ///
+  /// @warning This is only safe if the System's time derivatives can be
+  /// evaluated concurrently on distinct Contexts, i.e., the System does not
+  /// modify any data outside of the Context that it is evaluated on.
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_jacobian_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_jacobian_threads_ = num_threads;
+  }
+
+  /// Gets the number of threads used to compute finite-difference Jacobian
+  /// matrices. @see set_num_jacobian_threads()
+  int get_num_jacobian_threads() const { return num_jacobian_threads_; }
+
+  /// Sets whether the integrator exploits sparsity in the Jacobian matrix
+  /// (default is `false`). Systems made of many weakly coupled subsystems
+  /// (e.g., independent actuators and sensors) have Jacobian matrices that are
+  /// mostly zero; for such systems, turning this on can greatly reduce the
+  /// cost of both forming Jacobian matrices and factoring iteration matrices.
+  ///
+  /// When set to `true`:
+  /// - With kForwardDifference or kCentralDifference, the first Jacobian
+  ///   matrix is computed as usual and its nonzero entries are taken to be the
+  ///   sparsity pattern of every later Jacobian. The columns are partitioned
+  ///   into groups in which no two columns share a nonzero row, and each later
+  ///   Jacobian is formed by perturbing all of a group's state variables at
+  ///   once, which needs only one (forward) or two (central) derivative
+  ///   evaluations per group rather than per state variable [Curtis 1974].
+  ///   The pattern is detected anew after Reset() or a change of scheme.
+  /// - Iteration matrices are factored using a sparse LU factorization. (This
+  ///   has no effect when the scalar type is AutoDiffXd.)
+  ///
+  /// @warning A Jacobian entry that happens to be exactly zero at the time the
+  ///          pattern is detected will be treated as zero thereafter. Do not
+  ///          turn this on for systems whose coupling between state variables
+  ///          changes over time.
+  /// @note Discards any already-computed Jacobian matrices if the setting
+  ///       changes.
+  /// @note VelocityImplicitEulerIntegrator computes its own Jacobian matrices;
+  ///       for that integrator, this setting affects only the factorization.
+  ///
+  /// - [Curtis 1974] A. Curtis, M. Powell, and J. Reid. On the estimation of
+  ///                 sparse Jacobian matrices. IMA J. Appl. Math.,
+  ///                 13(1):117-119, 1974.
+  void set_use_sparse_jacobian(bool flag) {
+    if (use_sparse_jacobian_ != flag) {
+      J_.resize(0, 0);
+      jacobian_sparsity_.reset();
+      DoResetCachedJacobianRelatedMatrices();
+    }
+    use_sparse_jacobian_ = flag;
+  }
+
+  /// Gets whether the integrator exploits sparsity in the Jacobian matrix.
+  /// @see set_use_sparse_jacobian()
+  bool get_use_sparse_jacobian() const { return use_sparse_jacobian_; }
+
+  /// Returns the number of groups of columns into which the detected Jacobian
+  /// sparsity pattern was partitioned, or zero if no pattern has been
+  /// detected. Each group costs one (forward difference) or two (central
+  /// difference) derivative evaluations per Jacobian computation.
+  /// @see set_use_sparse_jacobian()
+  int get_num_jacobian_column_groups() const {
+    return jacobian_sparsity_ ?
+        static_cast<int>(jacobian_sparsity_->column_groups.size()) : 0;
+  }
   /// @}
 
   /// @name Cumulative statistics functions.
@@ -230,8 +373,28 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     /// Returns whether the iteration matrix has been set and factored.
     bool matrix_factored() const { return matrix_factored_; }
 
+    /// Records the step size for which the iteration matrix was formed, or NaN
+    /// if unknown.
+    void set_step_size(double h) { step_size_ = h; }
+
+    /// Returns the step size for which the iteration matrix was formed, or NaN
+    /// if unknown.
+    double step_size() const { return step_size_; }
+
+    /// Sets whether later calls to SetAndFactorIterationMatrix() use a sparse
+    /// LU factorization. Ignored when `T` is AutoDiffXd.
+    void set_use_sparse_factorization(bool flag) {
+      use_sparse_factorization_ = flag;
+    }
+
    private:
     bool matrix_factored_{false};
+    bool use_sparse_factorization_{false};
+    double step_size_{std::numeric_limits<double>::quiet_NaN()};
+
+    // Whether the most recent factorization is held in sparse_LU_ (rather than
+    // in LU_).
+    bool sparse_factored_{false};
 
     // A simple LU factorization is all that is needed for ImplicitIntegrator
     // templated on scalar type `double`; robustness in the solve
@@ -239,6 +402,10 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     // serves to minimize heap allocations and deallocations.
     Eigen::PartialPivLU<MatrixX<double>> LU_;
 
+    // The sparse counterpart of LU_, allocated on first use. (Eigen's SparseLU
+    // is not copyable or movable, so it is held by pointer.)
+    std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> sparse_LU_;
+
     // The only factorization supported by automatic differentiation in Eigen is
     // currently QR. When ImplicitIntegrator is templated on type AutoDiffXd,
     // this will be the factorization that is used.
@@ -452,6 +619,31 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   void ComputeAutoDiffJacobian(const System<T>& system, const T& t,
       const VectorX<T>& xt, const Context<T>& context, MatrixX<T>* J);
 
+  // Computes the Jacobian of the ordinary differential equations around time
+  // and continuous state `(t, xt)` using forward or central differences,
+  // perturbing the state variables of each group in jacobian_sparsity_ at
+  // once. Entries outside of the sparsity pattern are set to zero.
+  // @param central `true` for central differences; `false` for forward
+  //        differences.
+  // @param context the Context of the system, at time and continuous state
+  //        unknown.
+  // @param[out] J the Jacobian matrix around time and state `(t, xt)`.
+  // @pre jacobian_sparsity_ has been set.
+  // @post The continuous state will be indeterminate on return.
+  void ComputeGroupedDiffJacobian(bool central, const T& t,
+      const VectorX<T>& xt, Context<T>* context, MatrixX<T>* J);
+
+  // Evaluates the time derivatives at time `t` and at each of the continuous
+  // states given by the columns of `X`, setting the corresponding columns of
+  // `F`, using up to num_jacobian_threads_ threads. The derivative evaluation
+  // count is updated.
+  // @post The continuous state of `context` will be indeterminate on return.
+  void EvalTimeDerivativesAtStates(const T& t, const MatrixX<T>& X,
+      Context<T>* context, MatrixX<T>* F);
+
+  // Sets jacobian_sparsity_ from the nonzero entries of `J`.
+  void DetectJacobianSparsity(const MatrixX<T>& J);
+
   /// @copydoc IntegratorBase::DoStep()
   virtual bool DoImplicitIntegratorStep(const T& h) = 0;
 
@@ -488,10 +680,26 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     // let ImplicitEulerIntegrator<T> handle this flag on its own at the
     // beginning of ImplicitEulerIntegrator<T>::DoImplicitIntegratorStep().
     jacobian_is_fresh_ = !result;
+    if (result && jacobian_age_ < std::numeric_limits<int>::max())
+      ++jacobian_age_;
 
     return result;
   }
 
+  // Computes and factors the iteration matrix for step size `h` from `J`,
+  // recording `h` with the factorization.
+  void FactorIterationMatrix(const MatrixX<T>& J, const T& h,
+      const std::function<void(const MatrixX<T>& J, const T& h,
+          typename ImplicitIntegrator<T>::IterationMatrix*)>&
+      compute_and_factor_iteration_matrix,
+      typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix);
+
+  // Returns whether the reuse policy calls for the iteration matrix to be
+  // refactored for step size `h`.
+  bool IterationMatrixStepSizeIsStale(
+      const typename ImplicitIntegrator<T>::IterationMatrix& iteration_matrix,
+      const T& h) const;
+
   // The scheme to be used for computing the Jacobian matrix during the
   // nonlinear system solve process.
   JacobianComputationScheme jacobian_scheme_{
@@ -500,6 +708,27 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // The last computed Jacobian matrix.
   MatrixX<T> J_;
 
+  // The number of threads used to compute finite-difference Jacobian
+  // matrices; see set_num_jacobian_threads().
+  int num_jacobian_threads_{1};
+
+  // If set to `true`, the sparsity of the Jacobian matrix is exploited; see
+  // set_use_sparse_jacobian().
+  bool use_sparse_jacobian_{false};
+
+  // The sparsity pattern of the Jacobian matrix, along with a partition of its
+  // columns into groups such that no two columns in a group have a nonzero
+  // entry in the same row.
+  struct JacobianSparsity {
+    // The rows of the nonzero entries in each column.
+    std::vector<std::vector<int>> column_rows;
+    // The columns in each group.
+    std::vector<std::vector<int>> column_groups;
+  };
+
+  // The detected sparsity pattern, if any.
+  std::optional<JacobianSparsity> jacobian_sparsity_;
+
   // Indicates whether the Jacobian matrix is fresh. We say the Jacobian is
   // "fresh" if it was last computed at a state (t0, x0) from the beginning of
   // the current step. This indicates to MaybeFreshenMatrices that it should
@@ -516,6 +745,16 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // only ever be useful in debugging.
   bool use_full_newton_{false};
 
+  // The range of ratios of step sizes over which an iteration matrix is
+  // reused; see set_iteration_matrix_reuse_step_size_ratio_range().
+  double min_reuse_step_size_ratio_{0.0};
+  double max_reuse_step_size_ratio_{std::numeric_limits<double>::infinity()};
+
+  // The number of successful steps taken since the Jacobian matrix was last
+  // computed, and the number at which it is recomputed regardless.
+  int jacobian_age_{0};
+  int max_jacobian_age_{std::numeric_limits<int>::max()};
+
   // Various combined statistics.
   int64_t num_iter_factorizations_{0};
   int64_t num_jacobian_evaluations_{0};
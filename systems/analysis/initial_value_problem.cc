@@ -1,8 +1,14 @@
 #include "drake/systems/analysis/initial_value_problem.h"
 
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
+#include "drake/common/extract_double.h"
+#include "drake/common/parallel_for.h"
 #include "drake/systems/analysis/hermitian_dense_output.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
 #include "drake/systems/framework/continuous_state.h"
 #include "drake/systems/framework/leaf_system.h"
@@ -85,6 +91,94 @@ void OdeSystem<T>::DoCalcTimeDerivatives(
                                                 parameter_vector.get_value()));
 }
 
+// A LeafSystem subclass that integrates a batch of N copies of the ODE
+// d𝐱/dt = f(t, 𝐱; 𝐤) at once, all sharing the same parameters 𝐤. Its state is
+// the n ⨯ N matrix whose columns are the copies' states, stored column-major
+// in a single vector.
+//
+// @tparam T The ℝ domain scalar type, which must be a valid Eigen scalar.
+template <typename T>
+class BatchOdeSystem : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchOdeSystem);
+
+  typedef typename InitialValueProblem<T>::OdeFunction SystemFunction;
+
+  // Constructs a system integrating the given @p system_function from the
+  // columns of @p initial_states, parameterized as described by the
+  // @p param_model.
+  BatchOdeSystem(const SystemFunction& system_function,
+                 const MatrixX<T>& initial_states,
+                 const VectorX<T>& param_model)
+      : system_function_(system_function),
+        num_rows_(initial_states.rows()),
+        num_columns_(initial_states.cols()) {
+    this->DeclareContinuousState(BasicVector<T>(Eigen::Map<const VectorX<T>>(
+        initial_states.data(), initial_states.size())));
+    this->DeclareNumericParameter(BasicVector<T>(param_model));
+  }
+
+ protected:
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const override {
+    // These casts are safe for the reasons given in OdeSystem.
+    const BasicVector<T>& state_vector = dynamic_cast<const BasicVector<T>&>(
+        context.get_continuous_state_vector());
+    const VectorX<T>& k = context.get_numeric_parameter(0).get_value();
+    BasicVector<T>& derivatives_vector =
+        dynamic_cast<BasicVector<T>&>(derivatives->get_mutable_vector());
+
+    const Eigen::Map<const MatrixX<T>> x(
+        state_vector.get_value().data(), num_rows_, num_columns_);
+    Eigen::Map<MatrixX<T>> xdot(
+        derivatives_vector.get_mutable_value().data(), num_rows_,
+        num_columns_);
+    const T& t = context.get_time();
+    VectorX<T> x_j(num_rows_);
+    for (int j = 0; j < num_columns_; ++j) {
+      x_j = x.col(j);
+      xdot.col(j) = system_function_(t, x_j, k);
+    }
+  }
+
+ private:
+  const SystemFunction system_function_;
+  const int num_rows_;
+  const int num_columns_;
+};
+
+// Copies the step size and accuracy settings that are common to all
+// integrators from @p source to @p destination.
+template <typename T>
+void CopyIntegratorSettings(const IntegratorBase<T>& source,
+                            IntegratorBase<T>* destination) {
+  destination->set_maximum_step_size(source.get_maximum_step_size());
+  if (source.supports_error_estimation() &&
+      destination->supports_error_estimation()) {
+    destination->set_fixed_step_mode(source.get_fixed_step_mode());
+    destination->request_initial_step_size_target(
+        source.get_initial_step_size_target());
+    destination->set_target_accuracy(source.get_target_accuracy());
+  } else {
+    destination->set_fixed_step_mode(true);
+  }
+}
+
+// Sets the time, state and parameters of @p context, whose continuous state
+// and parameter vectors are those of an OdeSystem, and integrates its state
+// from time @p t0 to time @p tf with @p integrator.
+template <typename T>
+VectorX<T> IntegrateSlice(const T& t0, const T& tf, const VectorX<T>& x0,
+                          const VectorX<T>& k, Context<T>* context,
+                          IntegratorBase<T>* integrator) {
+  context->SetTime(t0);
+  context->get_mutable_continuous_state_vector().SetFromVector(x0);
+  context->get_mutable_numeric_parameter(0).SetFromVector(k);
+  integrator->Initialize();
+  integrator->IntegrateWithMultipleStepsToTime(tf);
+  return context->get_continuous_state_vector().CopyToVector();
+}
+
 }  // namespace
 
 template <typename T>
@@ -99,7 +193,8 @@ const T InitialValueProblem<T>::kMaxStepSize = static_cast<T>(1e-1);
 template <typename T>
 InitialValueProblem<T>::InitialValueProblem(const OdeFunction& ode_function,
                                             const OdeContext& default_values)
-    : default_values_(default_values), current_values_(default_values) {
+    : ode_function_(ode_function), default_values_(default_values),
+      current_values_(default_values) {
   // Checks that preconditions are met.
   if (!default_values_.t0) {
     throw std::logic_error("No default initial time t0 was given.");
@@ -120,8 +215,12 @@ InitialValueProblem<T>::InitialValueProblem(const OdeFunction& ode_function,
   context_->SetTime(default_values_.t0.value());
 
   // Instantiates an explicit RK3 integrator by default.
-  integrator_ =
-      std::make_unique<RungeKutta3Integrator<T>>(*system_, context_.get());
+  integrator_factory_ = [](const System<T>& system) {
+    return std::unique_ptr<IntegratorBase<T>>(
+        std::make_unique<RungeKutta3Integrator<T>>(system));
+  };
+  integrator_ = integrator_factory_(*system_);
+  integrator_->reset_context(context_.get());
 
   // Sets step size and accuracy defaults.
   integrator_->request_initial_step_size_target(
@@ -157,6 +256,169 @@ VectorX<T> InitialValueProblem<T>::Solve(const T& tf,
   return state_vector.get_value();
 }
 
+template <typename T>
+MatrixX<T> InitialValueProblem<T>::BatchSolve(
+    const T& tf, const MatrixX<T>& initial_states,
+    const OdeContext& values) const {
+  if (values.x0.has_value()) {
+    throw std::logic_error(
+        "IVP initial state vector x0 cannot be given"
+        " for a batched solve.");
+  }
+  if (initial_states.rows() != default_values_.x0.value().size()) {
+    throw std::logic_error(
+        "IVP initial state vectors are"
+        " of the wrong dimension.");
+  }
+  // Gets the initial time and parameters to solve with, either given or
+  // default, while checking that all preconditions hold.
+  const OdeContext safe_values = SanitizeValuesOrThrow(tf, values);
+  if (initial_states.cols() == 0) {
+    return initial_states;
+  }
+
+  const BatchOdeSystem<T> batch_system(
+      ode_function_, initial_states, safe_values.k.value());
+  std::unique_ptr<Context<T>> batch_context =
+      batch_system.CreateDefaultContext();
+  batch_context->SetTime(safe_values.t0.value());
+
+  RungeKutta3Integrator<T> batch_integrator(
+      batch_system, batch_context.get());
+  batch_integrator.set_maximum_step_size(
+      integrator_->get_maximum_step_size());
+  if (integrator_->supports_error_estimation()) {
+    batch_integrator.request_initial_step_size_target(
+        integrator_->get_initial_step_size_target());
+    batch_integrator.set_target_accuracy(integrator_->get_target_accuracy());
+  } else {
+    batch_integrator.set_fixed_step_mode(true);
+  }
+  batch_integrator.Initialize();
+  batch_integrator.IntegrateWithMultipleStepsToTime(tf);
+
+  const VectorX<T> xf =
+      batch_context->get_continuous_state_vector().CopyToVector();
+  return Eigen::Map<const MatrixX<T>>(
+      xf.data(), initial_states.rows(), initial_states.cols());
+}
+
+template <typename T>
+VectorX<T> InitialValueProblem<T>::PararealSolve(
+    const T& tf, const PararealOptions& options, const OdeContext& values,
+    PararealStatistics* statistics) const {
+  if (options.num_slices < 1 || options.num_coarse_steps_per_slice < 1 ||
+      options.max_iterations < 1 || options.num_threads < 1) {
+    throw std::logic_error(
+        "Parareal numbers of slices, coarse steps, iterations and threads"
+        " must be positive.");
+  }
+  if (!(options.convergence_tolerance >= 0.0)) {
+    throw std::logic_error(
+        "Parareal convergence tolerance must be nonnegative.");
+  }
+  // Gets all values to solve with, either given or default, while
+  // checking that all preconditions hold.
+  const OdeContext safe_values = SanitizeValuesOrThrow(tf, values);
+  const T& t0 = safe_values.t0.value();
+  const VectorX<T>& k = safe_values.k.value();
+  PararealStatistics stats;
+  if (tf == t0) {
+    stats.converged = true;
+    if (statistics != nullptr) *statistics = stats;
+    return safe_values.x0.value();
+  }
+
+  // The boundaries Tₙ of the time slices.
+  const int num_slices = options.num_slices;
+  std::vector<T> times(num_slices + 1);
+  for (int n = 0; n < num_slices; ++n) {
+    times[n] = t0 + (tf - t0) * n / num_slices;
+  }
+  times[num_slices] = tf;
+
+  // The coarse propagator G, run on this thread only.
+  std::unique_ptr<Context<T>> coarse_context = system_->CreateDefaultContext();
+  RungeKutta2Integrator<T> coarse_integrator(
+      *system_, (tf - t0) / (num_slices * options.num_coarse_steps_per_slice),
+      coarse_context.get());
+  auto coarse = [&](int n, const VectorX<T>& x) {
+    return IntegrateSlice(times[n], times[n + 1], x, k, coarse_context.get(),
+                          &coarse_integrator);
+  };
+
+  // The fine propagators F, one per thread. They are created on this thread,
+  // so that the parallel loop below only reads the system and writes into
+  // per-thread and per-slice storage.
+  const int num_threads = std::min(options.num_threads, num_slices);
+  std::vector<std::unique_ptr<Context<T>>> fine_contexts;
+  std::vector<std::unique_ptr<IntegratorBase<T>>> fine_integrators;
+  for (int i = 0; i < num_threads; ++i) {
+    fine_contexts.push_back(system_->CreateDefaultContext());
+    fine_integrators.push_back(integrator_factory_(*system_));
+    fine_integrators.back()->reset_context(fine_contexts.back().get());
+    CopyIntegratorSettings(*integrator_, fine_integrators.back().get());
+  }
+
+  // The initial states 𝐔ₙ of the slices, and the coarse and fine
+  // propagations G(𝐔ₙ₋₁) and F(𝐔ₙ₋₁) of the slices' predecessors.
+  std::vector<VectorX<T>> U(num_slices + 1);
+  std::vector<VectorX<T>> G(num_slices + 1);
+  std::vector<VectorX<T>> F(num_slices + 1);
+  U[0] = safe_values.x0.value();
+  for (int n = 0; n < num_slices; ++n) {
+    G[n + 1] = coarse(n, U[n]);
+    U[n + 1] = G[n + 1];
+  }
+
+  const int max_iterations = std::min(options.max_iterations, num_slices);
+  while (stats.num_iterations < max_iterations) {
+    // The initial states of the first num_iterations + 1 slices are those of
+    // a serial fine integration, so that only the following slices need be
+    // integrated again.
+    const int first_slice = stats.num_iterations;
+    drake::internal::StaticParallelForRange(
+        num_slices - first_slice, num_threads,
+        [&](int thread_num, int begin, int end) {
+          for (int n = first_slice + begin; n < first_slice + end; ++n) {
+            F[n + 1] = IntegrateSlice(
+                times[n], times[n + 1], U[n], k,
+                fine_contexts[thread_num].get(),
+                fine_integrators[thread_num].get());
+          }
+        });
+    stats.num_fine_slice_integrations += num_slices - first_slice;
+    ++stats.num_iterations;
+
+    // The serial correction 𝐔ₙ₊₁ = G(𝐔ₙ) + F(𝐔ₙ') - G(𝐔ₙ'), where 𝐔ₙ' is the
+    // initial state of slice n in the previous iteration. The first slice's
+    // initial state is unchanged, so that G(𝐔ₙ) = G(𝐔ₙ') there.
+    stats.final_correction = 0.0;
+    for (int n = first_slice; n < num_slices; ++n) {
+      VectorX<T> G_next = (n == first_slice) ? G[n + 1] : coarse(n, U[n]);
+      VectorX<T> U_next = G_next + F[n + 1] - G[n + 1];
+      const double change = ExtractDoubleOrThrow(
+          (U_next - U[n + 1]).template lpNorm<Eigen::Infinity>());
+      const double magnitude = ExtractDoubleOrThrow(
+          U_next.template lpNorm<Eigen::Infinity>());
+      stats.final_correction = std::max(
+          stats.final_correction, change / std::max(1.0, magnitude));
+      G[n + 1] = std::move(G_next);
+      U[n + 1] = std::move(U_next);
+    }
+    if (stats.final_correction <= options.convergence_tolerance) {
+      stats.converged = true;
+      break;
+    }
+  }
+  // After num_slices iterations, the solution is that of a serial fine
+  // integration.
+  if (stats.num_iterations == num_slices) stats.converged = true;
+
+  if (statistics != nullptr) *statistics = stats;
+  return U[num_slices];
+}
+
 template <typename T>
 void InitialValueProblem<T>::ResetCachedState(const OdeContext& values) const {
   // Sets context (initial) time.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -105,6 +106,46 @@ class InitialValueProblem {
     std::optional<VectorX<T>> k;  ///< The parameter vector 𝐤 for the IVP.
   };
 
+  /// Settings of PararealSolve().
+  struct PararealOptions {
+    /// The number of time slices of equal duration that [t₀, tf] is split
+    /// into, and thus the largest number of slices integrated in parallel.
+    int num_slices{8};
+    /// The number of fixed steps of the second order Runge-Kutta method taken
+    /// by the coarse propagator per time slice. More steps make the coarse
+    /// propagator more accurate, and thus the iterations converge faster, at
+    /// the expense of the serial part of each iteration.
+    int num_coarse_steps_per_slice{1};
+    /// The largest number of parareal iterations, i.e. of parallel fine
+    /// integrations of the slices. The solution after `num_slices` iterations
+    /// is that of a serial fine integration, so there is no reason to use a
+    /// larger value, and values that are smaller trade accuracy for speed.
+    int max_iterations{8};
+    /// The iterations stop once the largest change of the initial state of
+    /// any slice from one iteration to the next is at most this tolerance,
+    /// relative to the magnitude of that state (if larger than one) in the
+    /// infinity norm.
+    double convergence_tolerance{1e-6};
+    /// The number of threads that integrate the slices with the fine
+    /// integrator in each iteration.
+    int num_threads{1};
+  };
+
+  /// Statistics of a PararealSolve().
+  struct PararealStatistics {
+    /// The number of parareal iterations performed.
+    int num_iterations{0};
+    /// Whether the initial states of the slices converged to the convergence
+    /// tolerance within the allowed number of iterations.
+    bool converged{false};
+    /// The largest relative change of the initial state of a slice in the last
+    /// iteration.
+    double final_correction{0.0};
+    /// The total number of integrations of a time slice with the fine
+    /// integrator. A serial integration corresponds to `num_slices` of them.
+    int num_fine_slice_integrations{0};
+  };
+
   /// Constructs an IVP described by the given @p ode_function, using
   /// given @p default_values.t0 and @p default_values.x0 as initial
   /// conditions, and parameterized with @p default_values.k by default.
@@ -139,6 +180,86 @@ class InitialValueProblem {
   /// @throws std::logic_error if preconditions are not met.
   VectorX<T> Solve(const T& tf, const OdeContext& values = {}) const;
 
+  /// Solves the IVP for time @p tf from each of the given @p initial_states,
+  /// using the initial time t₀ and parameter vector 𝐤 present in @p values,
+  /// falling back to the ones given on construction if not given.
+  ///
+  /// All of the initial states are integrated together, as the columns of a
+  /// single n ⨯ N matrix-shaped state, by one RungeKutta3Integrator that
+  /// shares a single step size controller among them. This amortizes the
+  /// integrator's per-step overhead over the whole batch and lets its stage
+  /// arithmetic operate on contiguous, vectorizable storage, which makes this
+  /// considerably faster than N calls to Solve() when sampling many initial
+  /// conditions of the same ODE (e.g., for reachability analysis). That
+  /// integrator uses the step size and accuracy settings of get_integrator()
+  /// (or fixed steps of its maximum step size, if get_integrator() does not
+  /// support error estimation), but not its type. Since the step sizes are
+  /// chosen to satisfy the accuracy setting for every initial state, the
+  /// solutions are at least as accurate as those from Solve(); call Solve()
+  /// for each initial state instead to control step sizes separately.
+  ///
+  /// @param tf The IVP will be solved for this time.
+  /// @param initial_states The initial state vectors 𝐱₀, one per column.
+  /// @param values IVP initial time and parameters.
+  /// @returns The IVP solutions 𝐱(@p tf; 𝐤), one column per initial state.
+  /// @pre Given @p tf must be larger than or equal to the specified initial
+  ///      time t₀ (either given or default).
+  /// @pre The number of rows of @p initial_states must match the dimension of
+  ///      the default initial state vector given on construction.
+  /// @pre @p values.x0 is not given.
+  /// @pre If given, the dimension of the parameter vector @p values.k
+  ///      must match that of the parameter vector in the default specified
+  ///      values given on construction.
+  /// @throws std::logic_error if preconditions are not met.
+  MatrixX<T> BatchSolve(const T& tf, const MatrixX<T>& initial_states,
+                        const OdeContext& values = {}) const;
+
+  /// Solves the IVP for time @p tf as Solve() does, but with the parareal
+  /// parallel-in-time method [Lions 2001], for long integrations of smooth
+  /// ODEs whose serial integration takes too long.
+  ///
+  /// The interval [t₀, tf] is split into `N = options.num_slices` time slices
+  /// [Tₙ, Tₙ₊₁]. A cheap coarse propagator G, which takes
+  /// `options.num_coarse_steps_per_slice` fixed steps of the second order
+  /// Runge-Kutta method per slice, first proposes the initial states 𝐔ₙ of the
+  /// slices serially. Each iteration k then integrates all the slices from
+  /// their proposed initial states with the fine propagator F in parallel,
+  /// i.e. with a copy of get_integrator() per thread, and corrects the
+  /// initial states serially with <pre>
+  ///   𝐔ₙ₊₁ᵏ⁺¹ = G(𝐔ₙᵏ⁺¹) + F(𝐔ₙᵏ) - G(𝐔ₙᵏ).
+  /// </pre>
+  /// The iterations stop once the corrections are small enough, see
+  /// PararealOptions. After k iterations the first k slices are exact, so that
+  /// `N` iterations would reproduce Solve() (up to the restarts of the
+  /// integrator at each slice) at a larger cost; with K iterations, the ideal
+  /// speedup over Solve() with `N` threads is about N / K, while the error
+  /// with respect to Solve() decreases as the tolerance does.
+  ///
+  /// The copies of the integrator are of the type of get_integrator() (as
+  /// given to reset_integrator()), with the same maximum step size, fixed
+  /// step mode, and, if it supports error estimation, initial step size
+  /// target and accuracy settings. Other settings specific to the integrator
+  /// type are not copied. Unlike Solve(), this does not cache the solution.
+  ///
+  /// @param tf The IVP will be solved for this time.
+  /// @param options The parareal settings.
+  /// @param values IVP initial conditions and parameters.
+  /// @param[out] statistics If not null, on output it contains the statistics
+  ///             of the solve.
+  /// @returns The IVP solution 𝐱(@p tf; 𝐤) for 𝐱(t₀; 𝐤) = 𝐱₀.
+  /// @pre The preconditions of Solve() hold.
+  /// @pre `options.num_slices`, `options.num_coarse_steps_per_slice`,
+  ///      `options.max_iterations` and `options.num_threads` are positive and
+  ///      `options.convergence_tolerance` is nonnegative.
+  /// @throws std::logic_error if preconditions are not met.
+  ///
+  /// - [Lions 2001] J.-L. Lions, Y. Maday and G. Turinici. Résolution d'EDP
+  ///   par un schéma en temps « pararéel ». Comptes Rendus de l'Académie des
+  ///   Sciences, Series I, Mathematics 332(7), 661-668, 2001.
+  VectorX<T> PararealSolve(const T& tf, const PararealOptions& options,
+                           const OdeContext& values = {},
+                           PararealStatistics* statistics = nullptr) const;
+
   /// Solves and yields an approximation of the IVP solution x(t; 𝐤) for
   /// the closed time interval between the initial time t₀ and the given final
   /// time @p tf, using initial state 𝐱₀ and parameter vector 𝐤 present in
@@ -187,6 +308,12 @@ class InitialValueProblem {
   ///          InitialValueProblem::get_mutable_integrator().
   template <typename Integrator, typename... Args>
   Integrator* reset_integrator(Args&&... args) {
+    // Keeps a copy of the arguments to create more integrators of the same
+    // type, see PararealSolve().
+    integrator_factory_ = [args...](const System<T>& system) {
+      return std::unique_ptr<IntegratorBase<T>>(
+          std::make_unique<Integrator>(system, args...));
+    };
     integrator_ =
         std::make_unique<Integrator>(*system_, std::forward<Args>(args)...);
     integrator_->reset_context(context_.get());
@@ -220,6 +347,9 @@ class InitialValueProblem {
   //                          do not hold.
   OdeContext SanitizeValuesOrThrow(const T& tf, const OdeContext& values) const;
 
+  // The ODE function f(t, 𝐱; 𝐤), kept for batched solves.
+  const OdeFunction ode_function_;
+
   // IVP values specified by default.
   const OdeContext default_values_;
 
@@ -251,6 +381,10 @@ class InitialValueProblem {
   std::unique_ptr<System<T>> system_;
   // Numerical integrator used for IVP ODE solving.
   std::unique_ptr<IntegratorBase<T>> integrator_;
+  // Creates a new (context-less) integrator of the type of integrator_ for a
+  // system, with the constructor arguments given to reset_integrator().
+  std::function<std::unique_ptr<IntegratorBase<T>>(const System<T>&)>
+      integrator_factory_;
 };
 
 }  // namespace systems
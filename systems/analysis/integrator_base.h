@@ -13,6 +13,8 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/systems/analysis/compact_hermitian_dense_output.h"
+#include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
 #include "drake/systems/framework/vector_base.h"
@@ -859,6 +861,7 @@ class IntegratorBase {
 
     // Drops dense output, if any.
     dense_output_.reset();
+    compact_dense_output_.reset();
 
     // Integrator no longer operates in fixed step mode.
     fixed_step_mode_ = false;
@@ -1285,6 +1288,69 @@ class IntegratorBase {
     }
     return std::move(dense_output_);
   }
+
+  /**
+   Starts dense integration with a compact dense output, allocating a new
+   CompactHermitianDenseOutput for this integrator to use. This is suited to
+   record the trajectories of long runs of high-dimensional systems, since it
+   takes much less memory than the PiecewisePolynomial of
+   StartDenseIntegration(). It is independent of the latter, and both can be
+   in progress at the same time.
+
+   @param state_indices The indices of the elements of the continuous state
+          vector to record, in order, or an empty vector to record all of them.
+          See CompactHermitianDenseOutput.
+   @pre The integrator has been initialized.
+   @pre The system being integrated has continuous state.
+   @pre No compact dense integration is in progress (no compact dense output
+        is held by the integrator).
+   @throws std::logic_error if any of the preconditions is not met.
+   @throws std::exception if an element of `state_indices` is not a valid
+           index of the continuous state.
+   */
+  void StartCompactDenseIntegration(std::vector<int> state_indices = {}) {
+    if (!is_initialized()) {
+      throw std::logic_error("Integrator was not initialized.");
+    }
+    const int num_states = get_context().num_continuous_states();
+    if (num_states == 0) {
+      throw std::logic_error("System has no continuous state,"
+                             " no dense output can be built.");
+    }
+    if (get_compact_dense_output()) {
+      throw std::logic_error(
+          "Compact dense integration has been started already.");
+    }
+    compact_dense_output_ = std::make_unique<CompactHermitianDenseOutput<T>>(
+        num_states, std::move(state_indices));
+  }
+
+  /**
+   Returns a const pointer to the integrator's current compact dense output,
+   holding a representation of the continuous state trajectory since the last
+   StartCompactDenseIntegration() call (may be nullptr).
+   */
+  const CompactHermitianDenseOutput<T>* get_compact_dense_output() const {
+    return compact_dense_output_.get();
+  }
+
+  /**
+   Stops compact dense integration, yielding ownership of the current compact
+   dense output to the caller. Its domain starts at the context time of the
+   last StartCompactDenseIntegration() call and finishes at the current
+   context time.
+
+   @pre Compact dense integration is in progress, after a call to
+        StartCompactDenseIntegration().
+   @throws std::logic_error if any of the preconditions is not met.
+   */
+  std::unique_ptr<CompactHermitianDenseOutput<T>>
+  StopCompactDenseIntegration() {
+    if (!compact_dense_output_) {
+      throw std::logic_error("No compact dense integration has been started.");
+    }
+    return std::move(compact_dense_output_);
+  }
   // @}
 
   /**
@@ -1494,25 +1560,37 @@ class IntegratorBase {
     // Performs the integration step.
     if (!DoStep(h)) return false;
 
+    const ContinuousState<T>& derivatives = EvalTimeDerivatives(*context_);
+
     // Allow this update to *replace* the final segment if the start_time of
-    // this step is earlier than the current end_time of the dense output and
-    // matches the start_time of the the final segment of the dense output.
+    // this step is earlier than the current end_time of a dense output and
+    // matches the start_time of the the final segment of that dense output.
     // This happens, for instance, when the Simulator is doing WitnessFunction
     // isolation; it routinely back up the integration and try the same step
     // multiple times.  Note: we intentionally check for equality between
     // double values here.
-    if (dense_output_->get_segment_times().size() > 1 &&
-        start_time < dense_output_->end_time() &&
-        start_time == dense_output_->get_segment_times().end()[-2]) {
-      dense_output_->RemoveFinalSegment();
+    if (dense_output_) {
+      if (dense_output_->get_segment_times().size() > 1 &&
+          start_time < dense_output_->end_time() &&
+          start_time == dense_output_->get_segment_times().end()[-2]) {
+        dense_output_->RemoveFinalSegment();
+      }
+      dense_output_->ConcatenateInTime(
+          trajectories::PiecewisePolynomial<T>::CubicHermite(
+              std::vector<T>({start_time, context_->get_time()}),
+              {start_state, state.CopyToVector()},
+              {start_derivatives, derivatives.CopyToVector()}));
+    }
+    if (compact_dense_output_) {
+      if (compact_dense_output_->get_number_of_segments() > 0 &&
+          start_time < compact_dense_output_->end_time() &&
+          start_time == compact_dense_output_->final_segment_start_time()) {
+        compact_dense_output_->RemoveFinalSegment();
+      }
+      compact_dense_output_->AppendSegment(
+          start_time, start_state, start_derivatives, context_->get_time(),
+          state.CopyToVector(), derivatives.CopyToVector());
     }
-
-    const ContinuousState<T>& derivatives = EvalTimeDerivatives(*context_);
-    dense_output_->ConcatenateInTime(
-        trajectories::PiecewisePolynomial<T>::CubicHermite(
-            std::vector<T>({start_time, context_->get_time()}),
-            {start_state, state.CopyToVector()},
-            {start_derivatives, derivatives.CopyToVector()}));
     return true;
   }
 
@@ -1590,7 +1668,7 @@ class IntegratorBase {
   // @sa DoStep()
   // @sa DoDenseStep()
   bool Step(const T& h) {
-    if (get_dense_output()) {
+    if (get_dense_output() || get_compact_dense_output()) {
       return DoDenseStep(h);
     }
     return DoStep(h);
@@ -1604,6 +1682,9 @@ class IntegratorBase {
 
   // Current dense output.
   std::unique_ptr<trajectories::PiecewisePolynomial<T>> dense_output_{nullptr};
+  // Current compact dense output.
+  std::unique_ptr<CompactHermitianDenseOutput<T>> compact_dense_output_{
+      nullptr};
 
   // Runtime variables.
   // For variable step integrators, this is set at the end of each step to guide
@@ -1658,11 +1739,11 @@ class IntegratorBase {
   // generalized coordinates to generalized velocities, multiplied by the
   // change in the generalized coordinates (used in state change norm
   // calculations).
-  mutable std::unique_ptr<VectorBase<T>> pinvN_dq_change_;
+  mutable std::unique_ptr<BasicVector<T>> pinvN_dq_change_;
 
   // Vectors used in state change norm calculations.
   mutable VectorX<T> unweighted_substate_change_;
-  mutable std::unique_ptr<VectorBase<T>> weighted_q_change_;
+  mutable std::unique_ptr<BasicVector<T>> weighted_q_change_;
 
   // Variable for indicating when an integrator has been initialized.
   bool initialization_done_{false};
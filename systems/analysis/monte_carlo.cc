@@ -1,5 +1,15 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -20,9 +30,138 @@ double RandomSimulation(const SimulatorFactory& make_simulator,
   return output(system, simulator->get_context());
 }
 
+namespace {
+
+// Returns the number of worker threads to use for the requested number of
+// parallel executions and number of samples.
+int GetNumberOfThreads(int num_parallel_executions, int num_samples) {
+  DRAKE_THROW_UNLESS(num_parallel_executions >= 1 ||
+                     num_parallel_executions == kUseHardwareConcurrency);
+  int num_threads = num_parallel_executions;
+  if (num_parallel_executions == kUseHardwareConcurrency) {
+    // hardware_concurrency() is allowed to return zero when it is unknown.
+    num_threads = std::max(1, static_cast<int>(
+        std::thread::hardware_concurrency()));
+  }
+  return std::max(1, std::min(num_threads, num_samples));
+}
+
+}  // namespace
+
+namespace {
+
+// Creates the results of the samples with indices in [begin, end) out of
+// num_samples, each with its own generator seeded from @p generator (which
+// must not be null), with a zero output.  The generators of the samples are
+// created up front from the top-level generator, so that the samples do not
+// depend on the order in which the simulations are run, and the top-level
+// generator is advanced for all num_samples samples, whichever are returned.
+// A counter-based generator is only stepped once, to choose the stream that is
+// split into one substream per sample.
+std::vector<RandomSimulationResult> MakeSampleResults(
+    int num_samples, int begin, int end, RandomGenerator* generator) {
+  std::vector<RandomSimulationResult> data;
+  data.reserve(end - begin);
+  if (generator->is_counter_based()) {
+    const RandomGenerator samples_stream = generator->Split((*generator)());
+    for (int i = begin; i < end; i++) {
+      data.emplace_back(samples_stream.Split(i));
+    }
+  } else {
+    for (int i = 0; i < num_samples; i++) {
+      const RandomGenerator::result_type seed = (*generator)();
+      if (begin <= i && i < end) {
+        data.emplace_back(RandomGenerator(seed));
+      }
+    }
+  }
+  return data;
+}
+
+// Runs the simulation of each element of @p data from its generator snapshot,
+// setting its output, on up to @p num_parallel_executions threads.
+void RunSamples(const SimulatorFactory& make_simulator,
+                const ScalarSystemFunction& output, double final_time,
+                int num_parallel_executions,
+                std::vector<RandomSimulationResult>* data_ptr) {
+  std::vector<RandomSimulationResult>& data = *data_ptr;
+  const int num_samples = static_cast<int>(data.size());
+  const int num_threads =
+      GetNumberOfThreads(num_parallel_executions, num_samples);
+
+  // Runs the sample at @p index using the given (per-thread) functors.
+  auto run_sample = [&data, final_time](const SimulatorFactory& factory,
+                                        const ScalarSystemFunction& function,
+                                        int index) {
+    RandomGenerator sample_generator(data[index].generator_snapshot);
+    data[index].output =
+        RandomSimulation(factory, function, final_time, &sample_generator);
+  };
+
+  if (num_threads == 1) {
+    for (int i = 0; i < num_samples; i++) {
+      run_sample(make_simulator, output, i);
+    }
+    return;
+  }
+
+  // Each worker claims the next unclaimed sample until none remain.  Every
+  // sample writes only to its own (pre-allocated) element of data.
+  std::atomic<int> next_sample{0};
+  auto worker = [&next_sample, &run_sample, num_samples](
+                    SimulatorFactory factory, ScalarSystemFunction function) {
+    for (int i = next_sample++; i < num_samples; i = next_sample++) {
+      run_sample(factory, function, i);
+    }
+  };
+  std::vector<std::future<void>> workers;
+  workers.reserve(num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    workers.emplace_back(
+        std::async(std::launch::async, worker, make_simulator, output));
+  }
+  // Wait for every worker to finish before rethrowing any failure, so that
+  // no worker outlives the data it refers to.
+  for (auto& future : workers) {
+    future.wait();
+  }
+  for (auto& future : workers) {
+    future.get();
+  }
+}
+
+}  // namespace
+
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator) {
+    double final_time, int num_samples, RandomGenerator* generator,
+    int num_parallel_executions) {
+  return MonteCarloSimulationShard(make_simulator, output, final_time,
+                                   num_samples, 0 /* shard_index */,
+                                   1 /* num_shards */, generator,
+                                   num_parallel_executions);
+}
+
+std::pair<int, int> GetMonteCarloShardRange(int num_samples, int shard_index,
+                                            int num_shards) {
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+  DRAKE_THROW_UNLESS(num_shards >= 1);
+  DRAKE_THROW_UNLESS(0 <= shard_index && shard_index < num_shards);
+  // The products are computed in 64 bits so that they cannot overflow.
+  const int64_t n = num_samples;
+  return {static_cast<int>(n * shard_index / num_shards),
+          static_cast<int>(n * (shard_index + 1) / num_shards)};
+}
+
+std::vector<RandomSimulationResult> MonteCarloSimulationShard(
+    const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
+    double final_time, int num_samples, int shard_index, int num_shards,
+    RandomGenerator* generator, int num_parallel_executions) {
+  // Fail fast on bad arguments, before any simulation is run.
+  GetNumberOfThreads(num_parallel_executions, num_samples);
+  const auto [begin, end] =
+      GetMonteCarloShardRange(num_samples, shard_index, num_shards);
+
   std::unique_ptr<RandomGenerator> owned_generator{};
   if (generator == nullptr) {
     // Create a generator to be used for this set of tests.
@@ -30,18 +169,34 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     generator = owned_generator.get();
   }
 
-  std::vector<RandomSimulationResult> data;
-  data.reserve(num_samples);
+  std::vector<RandomSimulationResult> data =
+      MakeSampleResults(num_samples, begin, end, generator);
+  RunSamples(make_simulator, output, final_time, num_parallel_executions,
+             &data);
+  return data;
+}
 
-  // TODO(russt): Support running these in multiple threads, as they are
-  // trivially parallelizable.
-  for (int i = 0; i < num_samples; i++) {
-    RandomSimulationResult result(*generator);
-    result.output =
-        RandomSimulation(make_simulator, output, final_time, generator);
-    data.emplace_back(std::move(result));
+std::vector<RandomSimulationResult> MergeMonteCarloShards(
+    const std::vector<std::vector<RandomSimulationResult>>& shards,
+    int num_samples) {
+  const int num_shards = static_cast<int>(shards.size());
+  DRAKE_THROW_UNLESS(num_shards >= 1);
+  std::vector<RandomSimulationResult> data;
+  data.reserve(std::max(num_samples, 0));
+  for (int s = 0; s < num_shards; ++s) {
+    const auto [begin, end] =
+        GetMonteCarloShardRange(num_samples, s, num_shards);
+    if (static_cast<int>(shards[s].size()) != end - begin) {
+      throw std::logic_error(fmt::format(
+          "MergeMonteCarloShards(): shard {} of {} has {} results instead of "
+          "the {} of its samples [{}, {}) out of {}",
+          s, num_shards, shards[s].size(), end - begin, begin, end,
+          num_samples));
+    }
+    for (const RandomSimulationResult& result : shards[s]) {
+      data.push_back(result);
+    }
   }
-
   return data;
 }
 
@@ -111,6 +111,14 @@ struct RandomSimulationResult {
   double output{};
 };
 
+/// Value for MonteCarloSimulation's num_parallel_executions that runs all of
+/// the simulations serially in the calling thread.
+constexpr int kNoConcurrency = 1;
+
+/// Value for MonteCarloSimulation's num_parallel_executions that uses as many
+/// parallel executions as reported by std::thread::hardware_concurrency().
+constexpr int kUseHardwareConcurrency = -1;
+
 /**
  * Generate samples of a scalar random variable output by running many
  * random simulations drawn from independent samples of the
@@ -119,12 +127,20 @@ struct RandomSimulationResult {
  * In pseudo-code, this algorithm implements:
  * @code
  *   for i=1:num_samples
- *     const generator_snapshot = deepcopy(generator)
- *     output = RandomSimulation(..., generator)
- *     data(i) = std::pair(generator_snapshot, output)
+ *     const generator_snapshot = RandomGenerator(generator())
+ *     data(i).generator_snapshot = deepcopy(generator_snapshot)
+ *     data(i).output = RandomSimulation(..., generator_snapshot)
  *   return data
  * @endcode
  *
+ * Each simulation is given its own RandomGenerator, seeded (serially, in
+ * sample order) from the supplied @p generator.  Because the seeds do not
+ * depend on how much randomness each simulation consumes, the results are
+ * identical no matter how many parallel executions are used.  When @p
+ * generator is counter-based (see RandomGenerator::MakeCounterBased()), it is
+ * stepped only once per call, and each simulation is instead given its own
+ * substream (see RandomGenerator::Split()) of a stream chosen by that value.
+ *
  * @see RandomSimulation() for details about @p make_simulator, @p output,
  * and @p final_time.
  *
@@ -138,16 +154,96 @@ struct RandomSimulationResult {
  * future call to MonteCarloSimulation, you should make repeated uses of the
  * same RandomGenerator object.
  *
- * @returns a list of RandomSimulationResult's.
+ * @param num_parallel_executions Number of simulations to run concurrently.
+ * Use kNoConcurrency (the default) to run every simulation in the calling
+ * thread, or kUseHardwareConcurrency to use one execution per hardware
+ * thread.  When more than one execution is requested, each worker thread
+ * uses its own copy of @p make_simulator and @p output, so both must be safe
+ * to call concurrently (e.g. they must not share mutable state without
+ * synchronization).  Any exception thrown by a simulation is rethrown in the
+ * calling thread.
+ *
+ * @returns a list of RandomSimulationResult's, in sample order.
+ *
+ * @throws std::exception if num_parallel_executions is neither positive nor
+ * kUseHardwareConcurrency.
  *
  * @ingroup analysis
  */
-// TODO(russt): Consider generalizing this with options (e.g. setting the
-// number of simulators, number of samples per simulator, number of parallel
-// threads, ...).
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator = nullptr);
+    double final_time, int num_samples, RandomGenerator* generator = nullptr,
+    int num_parallel_executions = kNoConcurrency);
+
+/**
+ * Returns the range `[begin, end)` of the sample indices of shard @p
+ * shard_index, when the @p num_samples samples of a MonteCarloSimulation()
+ * are split into @p num_shards contiguous shards of nearly equal size, in
+ * sample order.  See MonteCarloSimulationShard().
+ *
+ * @throws std::exception if num_samples is negative, if num_shards is not
+ * positive, or if shard_index is not in `[0, num_shards)`.
+ *
+ * @ingroup analysis
+ */
+std::pair<int, int> GetMonteCarloShardRange(int num_samples, int shard_index,
+                                            int num_shards);
+
+/**
+ * Runs only the samples of one shard of a MonteCarloSimulation(), so that the
+ * samples can be distributed among separate processes (e.g., the jobs of a
+ * cluster), each running one or more shards, and merged afterwards with
+ * MergeMonteCarloShards().
+ *
+ * The shard covers the sample indices given by GetMonteCarloShardRange().
+ * Its results are identical to those elements of the results of
+ * MonteCarloSimulation() called with the same arguments, because the
+ * generator of each sample only depends on @p generator and on the sample's
+ * index, and @p generator is advanced exactly as MonteCarloSimulation() does.
+ * Each shard is therefore independent of the others: every process needs only
+ * the common arguments (e.g., a seed to construct @p generator) and its shard
+ * index, and a shard that was interrupted (e.g., by a preemption) can be run
+ * again on its own.  The shards need not use the same number of parallel
+ * executions.
+ *
+ * @see MonteCarloSimulation() for the other parameters.
+ *
+ * @param num_samples Number of samples of the whole (unsharded) simulation.
+ * @param shard_index The index of the shard to run, in `[0, num_shards)`.
+ * @param num_shards The number of shards the samples are split into.
+ *
+ * @returns the list of RandomSimulationResult's of the shard's samples, in
+ * sample order.
+ *
+ * @throws std::exception if num_parallel_executions is neither positive nor
+ * kUseHardwareConcurrency, or for the arguments that GetMonteCarloShardRange()
+ * rejects.
+ *
+ * @ingroup analysis
+ */
+std::vector<RandomSimulationResult> MonteCarloSimulationShard(
+    const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
+    double final_time, int num_samples, int shard_index, int num_shards,
+    RandomGenerator* generator = nullptr,
+    int num_parallel_executions = kNoConcurrency);
+
+/**
+ * Merges the results of all of the shards of a MonteCarloSimulation() of @p
+ * num_samples samples, as returned by MonteCarloSimulationShard() with
+ * `shard_index = s` in `shards[s]` for `num_shards = shards.size()`, into the
+ * results of the whole simulation, in sample order.  The merge only depends
+ * on the shard indices, not on the order in which the shards were run or
+ * completed.
+ *
+ * @throws std::exception if @p shards is empty, or if the size of any shard
+ * differs from that given by GetMonteCarloShardRange() (e.g., if a shard is
+ * missing or was only partially run).
+ *
+ * @ingroup analysis
+ */
+std::vector<RandomSimulationResult> MergeMonteCarloShards(
+    const std::vector<std::vector<RandomSimulationResult>>& shards,
+    int num_samples);
 
 }  // namespace analysis
 }  // namespace systems
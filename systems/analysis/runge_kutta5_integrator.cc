@@ -236,8 +236,9 @@ bool RungeKutta5Integrator<T>::DoStep(const T& h) {
   // If the size of the system has changed, the error estimate will no longer
   // be sized correctly. Verify that the error estimate is the correct size.
   DRAKE_DEMAND(this->get_error_estimate()->size() == xc.size());
-  this->get_mutable_error_estimate()->SetFromVector(
-      err_est_vec_->CopyToVector().cwiseAbs());
+  // Take the absolute value in place to avoid copying into a temporary.
+  err_est_vec_->get_mutable_value() = err_est_vec_->get_value().cwiseAbs();
+  this->get_mutable_error_estimate()->SetFromVector(err_est_vec_->get_value());
 
   // RK5 always succeeds in taking its desired step.
   return true;
@@ -1,5 +1,7 @@
 #include "drake/systems/analysis/simulator.h"
 
+#include <algorithm>
+#include <cmath>
 #include <thread>
 
 #include "drake/common/extract_double.h"
@@ -120,6 +122,9 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   // Allocate the witness function collection.
   witnessed_events_ = system_.AllocateCompositeEventCollection();
 
+  // Allocate the collection for the events to be handled in each step.
+  merged_events_ = system_.AllocateCompositeEventCollection();
+
   // Do any publishes last. Merge the initialization events with per-step
   // events and current_time timed events (if any). We expect all initialization
   // events to precede any per-step or timed events in the merged collection.
@@ -211,10 +216,10 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
   SimulatorStatus status(ExtractDoubleOrThrow(boundary_time));
 
   // Integrate until desired interval has completed.
-  auto merged_events = system_.AllocateCompositeEventCollection();
   DRAKE_DEMAND(timed_events_ != nullptr);
   DRAKE_DEMAND(witnessed_events_ != nullptr);
-  DRAKE_DEMAND(merged_events != nullptr);
+  DRAKE_DEMAND(merged_events_ != nullptr);
+  CompositeEventCollection<T>* const merged_events = merged_events_.get();
 
   // Clear events for the loop iteration.
   merged_events->Clear();
@@ -233,6 +238,8 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
 
     // Delay to match target realtime rate if requested and possible.
     PauseIfTooFast();
+    const bool is_paced = target_realtime_rate_ > 0;
+    const TimePoint step_wall_start = is_paced ? Clock::now() : TimePoint();
 
     // The general policy here is to do actions in decreasing order of
     // "violence" to the state, i.e. unrestricted -> discrete -> continuous ->
@@ -296,6 +303,8 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
       ++num_publishes_;
     }
 
+    if (is_paced) RecordRealtimeStepLatency(step_wall_start);
+
     CallMonitorUpdateStatusAndMaybeThrow(&status);
     if (!status.succeeded())
       break;  // Done.
@@ -369,6 +378,7 @@ std::optional<T> Simulator<T>::GetCurrentWitnessTimeIsolation() const {
 // trigger over [t0, t0 + ε], time (and corresponding state) will be advanced
 // to some tc in the open interval (t0, tf) such that no witnesses trigger
 // over [t0, tc]; in other words, we deem it "safe" to integrate to tc.
+// @param[in] wf the values of the witnesses evaluated at tf.
 // @param[in,out] triggered_witnesses on entry, the set of witness functions
 //                that triggered over [t0, tf]; on exit, the set of witness
 //                functions that triggered over [t0, tw], where tw is some time
@@ -389,15 +399,15 @@ template <class T>
 void Simulator<T>::IsolateWitnessTriggers(
     const std::vector<const WitnessFunction<T>*>& witnesses,
     const VectorX<T>& w0,
-    const T& t0, const VectorX<T>& x0, const T& tf,
+    const T& t0, const VectorX<T>& x0, const T& tf, const VectorX<T>& wf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses) {
+  using std::min;
 
   // Verify that the vector of triggered witnesses is non-null.
   DRAKE_DEMAND(triggered_witnesses);
 
-  // TODO(edrumwri): Speed this process using interpolation between states,
-  // more powerful root finding methods, and/or introducing the concept of
-  // a dead band.
+  // TODO(edrumwri): Speed this process using interpolation between states
+  // and/or introducing the concept of a dead band.
 
   // Will need to alter the context repeatedly.
   Context<T>& context = get_mutable_context();
@@ -420,20 +430,51 @@ void Simulator<T>::IsolateWitnessTriggers(
       integrator_->IntegrateNoFurtherThanTime(inf, inf, t_des);
   };
 
-  // Starting from c = (t0 + tf)/2, look for a witness function triggering
-  // over the interval [t0, tc]. Assuming a witness does trigger, c will
-  // continue moving leftward as a witness function triggers until the length of
-  // the time interval is small. If a witness fails to trigger as c moves
-  // leftward, we return, indicating that no witnesses triggered over [t0, c].
+  // Estimates the earliest time that a witness triggering over [a, b] crosses
+  // zero, by linear interpolation of its values at a and b (i.e., one secant
+  // step).
+  auto estimate_crossing = [&witnesses, &w0](
+      const T& a, const T& b, const VectorX<T>& wb) {
+    T t_est = b;
+    for (size_t i = 0; i < witnesses.size(); ++i) {
+      if (witnesses[i]->should_trigger(w0[i], wb[i])) {
+        // Triggering implies that w0[i] is nonzero and wb[i] does not have
+        // the same sign, so the fraction is in (0, 1].
+        t_est = min(t_est, a + (b - a) * w0[i] / (w0[i] - wb[i]));
+      }
+    }
+    return t_est;
+  };
+
+  // Look for a witness function triggering over the interval [t0, tc], with c
+  // moving leftward as a witness function triggers until the length of the
+  // time interval is small. If a witness fails to trigger, we return,
+  // indicating that no witnesses triggered over [t0, c]. The trial point c is
+  // chosen from the secant estimate t_est of the crossing: while t_est is far
+  // from t0, c = t_est - ε/2 lets the time advance up to just before the
+  // crossing; once t_est is within ε of t0, c = t0 + ε brackets the crossing
+  // within the isolation window (and isolation ends if it triggers there).
+  // Whenever any other secant-based trial point triggers, the next trial
+  // point is the midpoint, which guarantees that the interval shrinks at
+  // least geometrically (as for bisection alone).
   DRAKE_LOGGER_DEBUG(
       "Isolating witness functions using isolation window of {} over [{}, {}]",
       witness_iso_len.value(), t0, tf);
+  const T& epsilon = witness_iso_len.value();
   VectorX<T> wc(witnesses.size());
-  T a = t0;
+  VectorX<T> wb = wf;
+  const T a = t0;
   T b = tf;
+  bool bisect = false;
   do {
-    // Compute the midpoint and evaluate the witness functions at it.
+    // Compute the trial point and evaluate the witness functions at it.
     T c = (a + b) / 2;
+    bool within_window = false;
+    if (!bisect) {
+      const T t_est = estimate_crossing(a, b, wb);
+      within_window = !(t_est - a > epsilon);
+      c = within_window ? min(b, a + epsilon) : t_est - epsilon / 2;
+    }
     DRAKE_LOGGER_DEBUG("Integrating forward to time {}", c);
     integrate_forward(c);
 
@@ -458,10 +499,15 @@ void Simulator<T>::IsolateWitnessTriggers(
       DRAKE_LOGGER_DEBUG("No witness functions triggered up to {}", c);
       triggered_witnesses->clear();
       return;  // Time is c.
-    } else {
-      b = c;
     }
-  } while (b - a > witness_iso_len.value());
+
+    // The trial point triggered. If it lies within the isolation window, the
+    // crossing is isolated over [t0, c].
+    b = c;
+    if (within_window) break;
+    wb = wc;
+    bisect = !bisect;
+  } while (b - a > epsilon);
 
   // Determine the set of triggered witnesses.
   triggered_witnesses->clear();
@@ -472,15 +518,16 @@ void Simulator<T>::IsolateWitnessTriggers(
 }
 
 // Evaluates the given vector of witness functions.
+// The result is written to `weval`, which is resized only if necessary.
 template <class T>
-VectorX<T> Simulator<T>::EvaluateWitnessFunctions(
+void Simulator<T>::EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const {
+    const Context<T>& context, VectorX<T>* weval) const {
+  DRAKE_ASSERT(weval != nullptr);
   const System<T>& system = get_system();
-  VectorX<T> weval(witness_functions.size());
+  weval->resize(witness_functions.size());
   for (size_t i = 0; i < witness_functions.size(); ++i)
-    weval[i] = system.CalcWitnessValue(context, *witness_functions[i]);
-  return weval;
+    (*weval)[i] = system.CalcWitnessValue(context, *witness_functions[i]);
 }
 
 // Determines whether at least one of a collection of witness functions
@@ -567,14 +614,17 @@ Simulator<T>::IntegrateContinuousState(
   // Save the time and current state.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  const VectorBase<T>& xc = context.get_continuous_state().get_vector();
+  x0_.resize(xc.size());
+  xc.CopyToPreSizedVector(&x0_);
+  const VectorX<T>& x0 = x0_;
 
   // Get the set of witness functions active at the current state.
   RedetermineActiveWitnessFunctionsIfNecessary();
   const auto& witness_functions = *witness_functions_;
 
   // Evaluate the witness functions.
-  w0_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &w0_);
 
   // Attempt to integrate. Updates and boundary times are consciously
   // distinguished between. See internal documentation for
@@ -585,7 +635,7 @@ Simulator<T>::IntegrateContinuousState(
   const T tf = context.get_time();
 
   // Evaluate the witness functions again.
-  wf_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &wf_);
 
   // Triggering requires isolating the witness function time.
   if (DidWitnessTrigger(witness_functions, w0_, wf_, &triggered_witnesses_)) {
@@ -594,7 +644,7 @@ Simulator<T>::IntegrateContinuousState(
     // events are only relevant iff at least one witness function is
     // successfully isolated (see IsolateWitnessTriggers() for details).
     IsolateWitnessTriggers(
-        witness_functions, w0_, t0, x0, tf, &triggered_witnesses_);
+        witness_functions, w0_, t0, x0, tf, wf_, &triggered_witnesses_);
 
     // Store the state at x0 in the temporary continuous state. We only do this
     // if there are triggered witnesses (even though `witness_triggered` is
@@ -682,16 +732,39 @@ Simulator<T>::IntegrateContinuousState(
 }
 
 template <typename T>
-void Simulator<T>::PauseIfTooFast() const {
+void Simulator<T>::PauseIfTooFast() {
   if (target_realtime_rate_ <= 0) return;  // Run at full speed.
   const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
   const double simtime_passed = simtime_now - initial_simtime_;
   const TimePoint desired_realtime =
       initial_realtime_ + Duration(simtime_passed / target_realtime_rate_);
-  // TODO(sherm1): Could add some slop to now() and not sleep if
-  // we are already close enough. But what is a reasonable value?
-  if (desired_realtime > Clock::now())
-    std::this_thread::sleep_until(desired_realtime);
+  const TimePoint now = Clock::now();
+  if (desired_realtime > now) {
+    // Sleep through all but the last realtime_spin_duration_ of the pause,
+    // then spin, since a sleep may wake up late.
+    const TimePoint spin_start =
+        desired_realtime - Duration(realtime_spin_duration_);
+    if (spin_start > now)
+      std::this_thread::sleep_until(spin_start);
+    while (Clock::now() < desired_realtime) {}
+  } else if (simtime_passed > 0) {
+    // This step is late; we can only record that.
+    const double lateness = Duration(now - desired_realtime).count();
+    ++realtime_statistics_.num_deadline_misses;
+    realtime_statistics_.max_lateness =
+        std::max(realtime_statistics_.max_lateness, lateness);
+  }
+}
+
+template <typename T>
+void Simulator<T>::RecordRealtimeStepLatency(const TimePoint& step_start) {
+  const double microseconds = 1e6 * Duration(Clock::now() - step_start).count();
+  int bucket = 0;
+  if (microseconds >= 1) {
+    bucket = std::min(1 + static_cast<int>(std::floor(std::log2(microseconds))),
+                      SimulatorRealtimeStatistics::kNumLatencyBuckets - 1);
+  }
+  ++realtime_statistics_.step_latency_histogram[bucket];
 }
 
 template <typename T>
@@ -710,6 +783,7 @@ void Simulator<T>::ResetStatistics() {
   num_discrete_updates_ = 0;
   num_unrestricted_updates_ = 0;
   num_publishes_ = 0;
+  realtime_statistics_ = SimulatorRealtimeStatistics{};
 
   initial_simtime_ = ExtractDoubleOrThrow(get_context().get_time());
   initial_realtime_ = Clock::now();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <limits>
 #include <memory>
@@ -43,6 +44,32 @@ struct InitializeParams {
   bool suppress_initialization_events{false};
 };
 
+/// @ingroup simulation
+/// Wall-clock statistics recorded by a Simulator while it synchronizes with
+/// real time (that is, while its target realtime rate is positive).
+/// @see Simulator<T>::get_realtime_statistics().
+struct SimulatorRealtimeStatistics {
+  /// The number of entries in step_latency_histogram.
+  static constexpr int kNumLatencyBuckets = 24;
+
+  /// The number of steps that started later than the wall-clock time at which
+  /// they were due in order to keep pace with real time. (The first step after
+  /// Initialize() or ResetStatistics() defines the start of real time so
+  /// cannot be late.)
+  int64_t num_deadline_misses{0};
+
+  /// The largest amount, in seconds, by which any step started late. Zero if
+  /// no deadline was missed.
+  double max_lateness{0.0};
+
+  /// A histogram of the wall-clock time taken to compute each step, excluding
+  /// any pause to wait for real time. Entry 0 counts the steps that took less
+  /// than 1 microsecond, and entry i counts the steps that took at least
+  /// 2ⁱ⁻¹ but less than 2ⁱ microseconds. The last entry also counts every
+  /// longer step.
+  std::array<int64_t, kNumLatencyBuckets> step_latency_histogram{};
+};
+
 /** @ingroup simulation
 A class for advancing the state of hybrid dynamic systems, represented by
 `System<T>` objects, forward in time. Starting with an initial Context for a
@@ -484,6 +511,31 @@ class Simulator {
     return target_realtime_rate_;
   }
 
+  /// Sets the wall-clock time, in seconds, at the end of each pause for real
+  /// time (see set_target_realtime_rate()) that the %Simulator busy-waits
+  /// rather than sleeps. Operating system sleeps may return late by tens of
+  /// microseconds or more, so spinning through the last part of each pause
+  /// trades CPU time for more precise pacing, as is needed for
+  /// hardware-in-the-loop use. The default is zero, meaning pauses are slept
+  /// through entirely.
+  /// @throws std::exception if `spin_duration` is negative.
+  void set_realtime_spin_duration(double spin_duration) {
+    DRAKE_THROW_UNLESS(spin_duration >= 0);
+    realtime_spin_duration_ = spin_duration;
+  }
+
+  /// Returns the busy-wait duration currently in effect.
+  /// @see set_realtime_spin_duration()
+  double get_realtime_spin_duration() const { return realtime_spin_duration_; }
+
+  /// Returns the wall-clock pacing statistics recorded since the last
+  /// Initialize() or ResetStatistics() call. Statistics are only recorded for
+  /// steps taken while the target realtime rate is positive.
+  /// @see set_target_realtime_rate(), PrintSimulatorStatistics()
+  const SimulatorRealtimeStatistics& get_realtime_statistics() const {
+    return realtime_statistics_;
+  }
+
   /// Return the rate that simulated time has progressed relative to real time.
   /// A return of 1 means the simulation just matched real
   /// time, 2 means the simulation was twice as fast as real time, 0.5 means
@@ -750,7 +802,7 @@ class Simulator {
   void IsolateWitnessTriggers(
       const std::vector<const WitnessFunction<T>*>& witnesses,
       const VectorX<T>& w0,
-      const T& t0, const VectorX<T>& x0, const T& tf,
+      const T& t0, const VectorX<T>& x0, const T& tf, const VectorX<T>& wf,
       std::vector<const WitnessFunction<T>*>* triggered_witnesses);
   void PopulateEventDataForTriggeredWitness(
       const T& t0, const T& tf, const WitnessFunction<T>* witness,
@@ -760,9 +812,9 @@ class Simulator {
     const VectorX<T>& w0,
     const VectorX<T>& wf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses);
-  VectorX<T> EvaluateWitnessFunctions(
+  void EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const;
+    const Context<T>& context, VectorX<T>* weval) const;
   void RedetermineActiveWitnessFunctionsIfNecessary();
 
   // The steady_clock is immune to system clock changes so increases
@@ -772,8 +824,13 @@ class Simulator {
   using TimePoint = std::chrono::time_point<Clock, Duration>;
 
   // If the simulated time in the context is ahead of real time, pause long
-  // enough to let real time catch up (approximately).
-  void PauseIfTooFast() const;
+  // enough to let real time catch up (approximately). Otherwise, records a
+  // deadline miss if the step is late.
+  void PauseIfTooFast();
+
+  // Adds the wall-clock time elapsed since `step_start` to the step latency
+  // histogram.
+  void RecordRealtimeStepLatency(const TimePoint& step_start);
 
   // A pointer to the integrator.
   std::unique_ptr<IntegratorBase<T>> integrator_;
@@ -801,9 +858,19 @@ class Simulator {
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
   VectorX<T> w0_, wf_;
 
+  // Temporary used to save the continuous state at the start of each step.
+  VectorX<T> x0_;
+
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{internal::kDefaultTargetRealtimeRate};
 
+  // How long to busy-wait at the end of each pause for real time (user
+  // settable).
+  double realtime_spin_duration_{0.0};
+
+  // Wall-clock pacing statistics since the last statistics reset.
+  SimulatorRealtimeStatistics realtime_statistics_;
+
   bool publish_every_time_step_{internal::kDefaultPublishEveryTimeStep};
 
   bool publish_at_initialization_{internal::kDefaultPublishEveryTimeStep};
@@ -851,6 +918,11 @@ class Simulator {
   // AdvanceTo(). This collection is constructed within Initialize().
   std::unique_ptr<CompositeEventCollection<T>> witnessed_events_;
 
+  // The events to be handled at the start of each step, gathered from the
+  // three collections above. This collection is constructed within
+  // Initialize() and reused so that stepping does not allocate.
+  std::unique_ptr<CompositeEventCollection<T>> merged_events_;
+
   // Indicates when a timed or witnessed event needs to be handled on the next
   // call to AdvanceTo().
   TimeOrWitnessTriggered time_or_witness_triggered_{
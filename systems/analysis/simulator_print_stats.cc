@@ -1,7 +1,9 @@
 #include "drake/systems/analysis/simulator_print_stats.h"
 
+#include <algorithm>
 #include <regex>
 #include <string>
+#include <vector>
 
 #include <fmt/core.h>
 
@@ -9,9 +11,52 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram.h"
 
 namespace drake {
 namespace systems {
+namespace {
+
+// The number of cache entries listed by PrintSimulatorStatistics().
+constexpr int kNumCacheEntriesToPrint = 10;
+
+// The runtime statistics of a cache entry value.
+struct CacheEntryStatistics {
+  // The serial number of the value, which counts the updates of its value.
+  // After the initial allocation, these are its recomputations.
+  int64_t num_updates{};
+  // The number of prerequisite change notifications received by the value's
+  // DependencyTracker, i.e., the number of times it was invalidated.
+  int64_t num_invalidations{};
+  std::string description;
+};
+
+// Appends the statistics of each cache entry value in `context` (for `system`)
+// and its subcontexts to `entries`.
+void CollectCacheEntryStatistics(const System<double>& system,
+                                 const Context<double>& context,
+                                 std::vector<CacheEntryStatistics>* entries) {
+  const Cache& cache = context.get_cache();
+  for (CacheIndex i(0); i < cache.cache_size(); ++i) {
+    if (!cache.has_cache_entry_value(i)) continue;
+    const CacheEntryValue& value = cache.get_cache_entry_value(i);
+    if (!value.has_value()) continue;
+    const DependencyTracker& tracker = context.get_tracker(value.ticket());
+    entries->push_back({value.serial_number(),
+                        tracker.num_prerequisite_change_events(),
+                        value.GetPathDescription()});
+  }
+  const auto* diagram = dynamic_cast<const Diagram<double>*>(&system);
+  if (diagram != nullptr) {
+    for (const System<double>* subsystem : diagram->GetSystems()) {
+      CollectCacheEntryStatistics(
+          *subsystem, diagram->GetSubsystemContext(*subsystem, context),
+          entries);
+    }
+  }
+}
+
+}  // namespace
 
 void PrintSimulatorStatistics(const Simulator<double>& simulator) {
   const systems::IntegratorBase<double>& integrator =
@@ -34,6 +79,30 @@ void PrintSimulatorStatistics(const Simulator<double>& simulator) {
   fmt::print("Number of \"unrestricted\" updates = {:d}\n",
       simulator.get_num_unrestricted_updates());
 
+  if (simulator.get_target_realtime_rate() > 0) {
+    const SimulatorRealtimeStatistics& realtime =
+        simulator.get_realtime_statistics();
+    fmt::print("\nStats for real-time pacing at target rate {}:\n",
+               simulator.get_target_realtime_rate());
+    fmt::print("Actual realtime rate = {:10.6g}\n",
+               simulator.get_actual_realtime_rate());
+    fmt::print("Number of deadline misses = {:d}\n",
+               realtime.num_deadline_misses);
+    fmt::print("Largest lateness = {:10.6g} s\n", realtime.max_lateness);
+    fmt::print("Step wall-clock latency histogram:\n");
+    const auto& histogram = realtime.step_latency_histogram;
+    for (int i = 0; i < SimulatorRealtimeStatistics::kNumLatencyBuckets; ++i) {
+      if (histogram[i] == 0) continue;
+      const int64_t lower = (i == 0) ? 0 : (int64_t{1} << (i - 1));
+      if (i + 1 < SimulatorRealtimeStatistics::kNumLatencyBuckets) {
+        fmt::print("  [{}, {}) us: {:d}\n", lower, int64_t{1} << i,
+                   histogram[i]);
+      } else {
+        fmt::print("  >= {} us: {:d}\n", lower, histogram[i]);
+      }
+    }
+  }
+
   if (integrator.get_num_steps_taken() == 0) {
     fmt::print("\nNote: the following integrator took zero steps. The "
                "simulator exclusively used the discrete solver.\n");
@@ -152,6 +221,30 @@ void PrintSimulatorStatistics(const Simulator<double>& simulator) {
                  implicit_integrator->get_num_newton_raphson_iterations());
     }
   }
+
+  // An expensive entry whose number of updates follows its number of
+  // invalidations is recomputed after nearly every invalidation; when its
+  // value does not actually depend on all those changes, its prerequisites are
+  // over-broad.
+  std::vector<CacheEntryStatistics> cache_entries;
+  CollectCacheEntryStatistics(simulator.get_system(), simulator.get_context(),
+                              &cache_entries);
+  std::sort(cache_entries.begin(), cache_entries.end(),
+            [](const auto& a, const auto& b) {
+              return a.num_updates > b.num_updates;
+            });
+  const int num_to_print = std::min<int>(cache_entries.size(),
+                                         kNumCacheEntriesToPrint);
+  if (num_to_print > 0) {
+    fmt::print("\nMost updated cache entries ({} of {}):\n", num_to_print,
+               cache_entries.size());
+    for (int i = 0; i < num_to_print; ++i) {
+      fmt::print("{:d} updates, {:d} invalidations: {}\n",
+                 cache_entries[i].num_updates,
+                 cache_entries[i].num_invalidations,
+                 cache_entries[i].description);
+    }
+  }
 }
 
 }  // namespace systems
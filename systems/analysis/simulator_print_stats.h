@@ -6,7 +6,11 @@ namespace drake {
 namespace systems {
 
 /// This method outputs to stdout relevant simulation statistics for a
-/// simulator that advanced the state of a system forward in time.
+/// simulator that advanced the state of a system forward in time. These
+/// include the cache entries of the simulator's Context whose values were
+/// updated (i.e., recomputed) most often, which is a cheap first indication
+/// of where the computation goes, along with the number of times each of them
+/// was invalidated by a change to one of its prerequisites.
 /// @param[in] simulator
 ///   The simulator to output statistics for.
 void PrintSimulatorStatistics(const Simulator<double>& simulator);
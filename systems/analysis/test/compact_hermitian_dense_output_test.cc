@@ -0,0 +1,167 @@
+#include "drake/systems/analysis/compact_hermitian_dense_output.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using trajectories::PiecewisePolynomial;
+
+class CompactHermitianDenseOutputTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    times_ = {0.0, 0.3, 0.5, 1.2};
+    for (int k = 0; k < static_cast<int>(times_.size()); ++k) {
+      states_.push_back(Vector3d(k, k * k, -2.0 * k));
+      derivatives_.push_back(Vector3d(1.0, -k, 0.5 * k * k));
+    }
+  }
+
+  // Appends all the steps to `output`.
+  void AppendSteps(CompactHermitianDenseOutput<double>* output) const {
+    for (int k = 0; k + 1 < static_cast<int>(times_.size()); ++k) {
+      output->AppendSegment(times_[k], states_[k], derivatives_[k],
+                            times_[k + 1], states_[k + 1], derivatives_[k + 1]);
+    }
+  }
+
+  PiecewisePolynomial<double> MakeExpected() const {
+    std::vector<Eigen::MatrixXd> states(states_.begin(), states_.end());
+    std::vector<Eigen::MatrixXd> derivatives(derivatives_.begin(),
+                                             derivatives_.end());
+    return PiecewisePolynomial<double>::CubicHermite(times_, states,
+                                                     derivatives);
+  }
+
+  std::vector<double> times_;
+  std::vector<VectorXd> states_;
+  std::vector<VectorXd> derivatives_;
+};
+
+TEST_F(CompactHermitianDenseOutputTest, MatchesCubicHermite) {
+  CompactHermitianDenseOutput<double> dut(3);
+  EXPECT_TRUE(dut.is_empty());
+  EXPECT_EQ(dut.state_size(), 3);
+  EXPECT_EQ(dut.state_indices(), std::vector<int>({0, 1, 2}));
+  AppendSteps(&dut);
+  EXPECT_FALSE(dut.is_empty());
+  EXPECT_EQ(dut.size(), 3);
+  EXPECT_EQ(dut.get_number_of_segments(), 3);
+  EXPECT_EQ(dut.start_time(), 0.0);
+  EXPECT_EQ(dut.end_time(), 1.2);
+  EXPECT_EQ(dut.final_segment_start_time(), 0.5);
+
+  const PiecewisePolynomial<double> expected = MakeExpected();
+  std::vector<double> sample_times;
+  for (double t = 0.0; t <= 1.2; t += 0.05) sample_times.push_back(t);
+  sample_times.push_back(1.2);
+  const Eigen::MatrixXd values = dut.EvaluateBatch(sample_times);
+  ASSERT_EQ(values.rows(), 3);
+  ASSERT_EQ(values.cols(), sample_times.size());
+  for (int j = 0; j < static_cast<int>(sample_times.size()); ++j) {
+    const double t = sample_times[j];
+    const VectorXd value = expected.value(t);
+    EXPECT_TRUE(CompareMatrices(dut.Evaluate(t), value, 1e-12));
+    EXPECT_TRUE(CompareMatrices(values.col(j), value, 1e-12));
+    EXPECT_NEAR(dut.EvaluateNth(t, 1), value[1], 1e-12);
+  }
+  // Unsorted times give the same values.
+  const std::vector<double> unsorted_times{1.1, 0.1, 0.5, 0.0, 1.2};
+  const Eigen::MatrixXd unsorted_values = dut.EvaluateBatch(unsorted_times);
+  for (int j = 0; j < static_cast<int>(unsorted_times.size()); ++j) {
+    EXPECT_TRUE(CompareMatrices(unsorted_values.col(j),
+                                dut.Evaluate(unsorted_times[j])));
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Evaluate(1.5), std::runtime_error,
+                              ".*[Tt]ime.*out of.*dense output.*domain.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.EvaluateBatch({0.1, -1.0}),
+                              std::runtime_error,
+                              ".*[Tt]ime.*out of.*dense output.*domain.*");
+}
+
+TEST_F(CompactHermitianDenseOutputTest, StateSubset) {
+  CompactHermitianDenseOutput<double> dut(3, {2, 0});
+  EXPECT_EQ(dut.state_indices(), std::vector<int>({2, 0}));
+  AppendSteps(&dut);
+  EXPECT_EQ(dut.size(), 2);
+  const PiecewisePolynomial<double> expected = MakeExpected();
+  for (double t : {0.0, 0.4, 0.9, 1.2}) {
+    const Vector3d value = expected.value(t);
+    EXPECT_TRUE(CompareMatrices(dut.Evaluate(t),
+                                Eigen::Vector2d(value[2], value[0]), 1e-12));
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(CompactHermitianDenseOutput<double>(3, {3}),
+                              std::runtime_error, ".*index < state_size.*");
+}
+
+TEST_F(CompactHermitianDenseOutputTest, RemoveFinalSegment) {
+  CompactHermitianDenseOutput<double> dut(3);
+  AppendSteps(&dut);
+  dut.RemoveFinalSegment();
+  EXPECT_EQ(dut.get_number_of_segments(), 2);
+  EXPECT_EQ(dut.end_time(), 0.5);
+  // A replacement of the final segment with a shorter one.
+  dut.AppendSegment(0.5, states_[2], derivatives_[2], 0.6, states_[3],
+                    derivatives_[3]);
+  EXPECT_EQ(dut.end_time(), 0.6);
+  EXPECT_TRUE(CompareMatrices(dut.Evaluate(0.6), states_[3]));
+  EXPECT_TRUE(CompareMatrices(dut.Evaluate(0.5), states_[2]));
+
+  for (int i = 0; i < 3; ++i) dut.RemoveFinalSegment();
+  EXPECT_TRUE(dut.is_empty());
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.RemoveFinalSegment(), std::logic_error,
+                              ".*there are no segments.*");
+}
+
+TEST_F(CompactHermitianDenseOutputTest, Discontinuity) {
+  CompactHermitianDenseOutput<double> dut(3);
+  dut.AppendSegment(0.0, states_[0], derivatives_[0], 0.5, states_[1],
+                    derivatives_[1]);
+  // The state is reset at t = 0.5, e.g. by an unrestricted update.
+  dut.AppendSegment(0.5, states_[2], derivatives_[2], 1.0, states_[3],
+                    derivatives_[3]);
+  EXPECT_EQ(dut.get_number_of_segments(), 2);
+  EXPECT_TRUE(CompareMatrices(dut.Evaluate(0.5), states_[2]));
+  EXPECT_TRUE(CompareMatrices(dut.Evaluate(1.0), states_[3]));
+  const double t = 0.5 - 1e-9;
+  EXPECT_TRUE(CompareMatrices(dut.Evaluate(t), states_[1], 1e-8));
+  // Removing the final segment also removes its own start knot.
+  dut.RemoveFinalSegment();
+  EXPECT_EQ(dut.end_time(), 0.5);
+  EXPECT_TRUE(CompareMatrices(dut.Evaluate(0.5), states_[1]));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.AppendSegment(0.6, states_[1], derivatives_[1], 0.7, states_[2],
+                        derivatives_[2]),
+      std::runtime_error, ".*start time 0.6 is not the end time 0.5.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.AppendSegment(0.5, states_[1], derivatives_[1], 0.5, states_[2],
+                        derivatives_[2]),
+      std::runtime_error,
+      ".*end time 0.5 is not greater than its start time 0.5.*");
+}
+
+GTEST_TEST(CompactHermitianDenseOutputAutoDiffTest, Evaluate) {
+  CompactHermitianDenseOutput<AutoDiffXd> dut(1);
+  const VectorX<AutoDiffXd> x0 = VectorX<AutoDiffXd>::Constant(1, 1.0);
+  const VectorX<AutoDiffXd> x1 = VectorX<AutoDiffXd>::Constant(1, 2.0);
+  const VectorX<AutoDiffXd> xdot = VectorX<AutoDiffXd>::Constant(1, 1.0);
+  dut.AppendSegment(0.0, x0, xdot, 1.0, x1, xdot);
+  // The interpolant of a linear function is the function itself.
+  EXPECT_NEAR(dut.Evaluate(0.25)[0].value(), 1.25, 1e-14);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,7 +1,10 @@
 #include "drake/systems/analysis/implicit_euler_integrator.h"
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/unused.h"
 #include "drake/systems/analysis/test_utilities/implicit_integrator_test.h"
@@ -77,6 +80,190 @@ GTEST_TEST(ImplicitEulerIntegratorTest, QuadraticSystemErrorEstimatorAccuracy) {
       ImplicitEulerIntegrator<double>>::CheckGeneralStatsValidity(&ie);
 }
 
+// A discretized heat equation, ẋᵢ = k (xᵢ₋₁ - 2xᵢ + xᵢ₊₁), with the
+// boundary values held at zero. This system is stiff and its Jacobian matrix is
+// tridiagonal.
+class HeatEquationSystem final : public LeafSystem<double> {
+ public:
+  HeatEquationSystem(int num_cells, double k) : k_(k) {
+    this->DeclareContinuousState(num_cells);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const VectorX<double> x =
+        context.get_continuous_state_vector().CopyToVector();
+    const int n = x.size();
+    VectorX<double> xdot(n);
+    for (int i = 0; i < n; ++i) {
+      const double left = (i > 0) ? x[i - 1] : 0.0;
+      const double right = (i + 1 < n) ? x[i + 1] : 0.0;
+      xdot[i] = k_ * (left - 2 * x[i] + right);
+    }
+    derivatives->SetFromVector(xdot);
+  }
+
+  const double k_;
+};
+
+// Verifies that exploiting the sparsity of the Jacobian matrix gives the same
+// solution as not doing so, using fewer derivative evaluations.
+GTEST_TEST(ImplicitEulerIntegratorTest, SparseJacobian) {
+  const int n = 30;
+  HeatEquationSystem heat(n, 1e3);
+  using Scheme =
+      ImplicitIntegrator<double>::JacobianComputationScheme;
+  for (Scheme scheme :
+       {Scheme::kForwardDifference, Scheme::kCentralDifference}) {
+    VectorX<double> x_final[2];
+    int64_t num_evaluations_per_jacobian[2];
+    for (bool sparse : {false, true}) {
+      auto context = heat.CreateDefaultContext();
+      VectorX<double> x0(n);
+      for (int i = 0; i < n; ++i) x0[i] = std::sin(M_PI * (i + 1) / (n + 1));
+      context->SetContinuousState(x0);
+
+      ImplicitEulerIntegrator<double> ie(heat, context.get());
+      ie.set_jacobian_computation_scheme(scheme);
+      ie.set_use_sparse_jacobian(sparse);
+      EXPECT_EQ(ie.get_use_sparse_jacobian(), sparse);
+      ie.set_reuse(false);
+      ie.set_maximum_step_size(1e-2);
+      ie.set_fixed_step_mode(true);
+      ie.Initialize();
+      ie.IntegrateWithMultipleStepsToTime(0.1);
+
+      // The tridiagonal Jacobian's columns form three groups.
+      EXPECT_EQ(ie.get_num_jacobian_column_groups(), sparse ? 3 : 0);
+      x_final[sparse] = context->get_continuous_state_vector().CopyToVector();
+      ASSERT_GT(ie.get_num_jacobian_evaluations(), 1);
+      num_evaluations_per_jacobian[sparse] =
+          ie.get_num_derivative_evaluations_for_jacobian() /
+          ie.get_num_jacobian_evaluations();
+    }
+    EXPECT_TRUE(CompareMatrices(x_final[true], x_final[false], 1e-10));
+    EXPECT_LT(num_evaluations_per_jacobian[true],
+              num_evaluations_per_jacobian[false] / 2);
+  }
+}
+
+// Verifies that computing finite-difference Jacobians on several threads gives
+// exactly the same results, and statistics, as computing them on one.
+GTEST_TEST(ImplicitEulerIntegratorTest, ParallelJacobian) {
+  const int n = 13;
+  HeatEquationSystem heat(n, 1e3);
+  using Scheme =
+      ImplicitIntegrator<double>::JacobianComputationScheme;
+  for (Scheme scheme :
+       {Scheme::kForwardDifference, Scheme::kCentralDifference}) {
+    for (bool sparse : {false, true}) {
+      VectorX<double> x_final[2];
+      int64_t num_jacobian_evaluations[2];
+      int64_t num_derivative_evaluations[2];
+      for (int num_threads : {1, 4}) {
+        auto context = heat.CreateDefaultContext();
+        context->SetContinuousState(VectorX<double>::LinSpaced(n, 0.0, 1.0));
+        ImplicitEulerIntegrator<double> ie(heat, context.get());
+        EXPECT_EQ(ie.get_num_jacobian_threads(), 1);
+        ie.set_num_jacobian_threads(num_threads);
+        EXPECT_EQ(ie.get_num_jacobian_threads(), num_threads);
+        ie.set_jacobian_computation_scheme(scheme);
+        ie.set_use_sparse_jacobian(sparse);
+        ie.set_reuse(false);
+        ie.set_maximum_step_size(1e-2);
+        ie.set_fixed_step_mode(true);
+        ie.Initialize();
+        ie.IntegrateWithMultipleStepsToTime(0.05);
+        const int index = (num_threads > 1);
+        x_final[index] = context->get_continuous_state_vector().CopyToVector();
+        num_jacobian_evaluations[index] =
+            ie.get_num_derivative_evaluations_for_jacobian();
+        num_derivative_evaluations[index] =
+            ie.get_num_derivative_evaluations();
+      }
+      EXPECT_TRUE(CompareMatrices(x_final[0], x_final[1]));
+      EXPECT_EQ(num_jacobian_evaluations[0], num_jacobian_evaluations[1]);
+      EXPECT_EQ(num_derivative_evaluations[0], num_derivative_evaluations[1]);
+    }
+  }
+
+  auto context = heat.CreateDefaultContext();
+  ImplicitEulerIntegrator<double> ie(heat, context.get());
+  EXPECT_THROW(ie.set_num_jacobian_threads(0), std::exception);
+}
+
+// Verifies the configurable policies for reusing Jacobian and iteration
+// matrices across steps.
+GTEST_TEST(ImplicitEulerIntegratorTest, ReusePolicy) {
+  const int n = 10;
+  HeatEquationSystem heat(n, 1e3);
+  auto context = heat.CreateDefaultContext();
+  ImplicitEulerIntegrator<double> ie(heat, context.get());
+
+  // Verify defaults match documentation.
+  EXPECT_EQ(ie.get_iteration_matrix_reuse_min_step_size_ratio(), 0.0);
+  EXPECT_EQ(ie.get_iteration_matrix_reuse_max_step_size_ratio(),
+            std::numeric_limits<double>::infinity());
+  EXPECT_EQ(ie.get_max_jacobian_age(), std::numeric_limits<int>::max());
+
+  EXPECT_THROW(ie.set_iteration_matrix_reuse_step_size_ratio_range(1.1, 1.2),
+               std::exception);
+  EXPECT_THROW(ie.set_iteration_matrix_reuse_step_size_ratio_range(0.5, 0.9),
+               std::exception);
+  EXPECT_THROW(ie.set_max_jacobian_age(0), std::exception);
+
+  // Use a single iteration matrix per step size (no step doubling).
+  ie.set_use_implicit_trapezoid_error_estimation(true);
+
+  // Takes ten steps of size h followed by ten of size 2h, returning the number
+  // of iteration matrix factorizations during the latter.
+  auto integrate = [&]() {
+    context->SetTime(0.0);
+    context->SetContinuousState(VectorX<double>::Ones(n));
+    ie.set_maximum_step_size(1.0);
+    ie.set_fixed_step_mode(true);
+    ie.Initialize();
+    const double h = 1e-3;
+    int64_t num_factorizations_before_doubling{};
+    for (int i = 1; i <= 20; ++i) {
+      EXPECT_TRUE(ie.IntegrateWithSingleFixedStepToTime(
+          context->get_time() + (i <= 10 ? h : 2 * h)));
+      if (i == 10) {
+        num_factorizations_before_doubling =
+            ie.get_num_iteration_matrix_factorizations();
+      }
+    }
+    return ie.get_num_iteration_matrix_factorizations() -
+           num_factorizations_before_doubling;
+  };
+
+  // By default, a single Jacobian matrix suffices for this linear system, and
+  // the iteration matrices are reused despite the change in step size.
+  EXPECT_EQ(integrate(), 0);
+  EXPECT_EQ(ie.get_num_jacobian_evaluations(), 1);
+
+  // A bounded age forces fresh Jacobian matrices.
+  ie.set_max_jacobian_age(1);
+  integrate();
+  EXPECT_EQ(ie.get_num_jacobian_evaluations(), 20);
+  ie.set_max_jacobian_age(5);
+  integrate();
+  EXPECT_EQ(ie.get_num_jacobian_evaluations(), 4);
+
+  // Requiring the step size to be nearly unchanged forces refactorization when
+  // the step size doubles, for both the implicit Euler and the implicit
+  // trapezoid (error estimation) iteration matrices, but does not require a
+  // new Jacobian matrix.
+  ie.set_max_jacobian_age(std::numeric_limits<int>::max());
+  ie.set_iteration_matrix_reuse_step_size_ratio_range(0.9, 1.2);
+  EXPECT_EQ(ie.get_iteration_matrix_reuse_min_step_size_ratio(), 0.9);
+  EXPECT_EQ(ie.get_iteration_matrix_reuse_max_step_size_ratio(), 1.2);
+  EXPECT_EQ(integrate(), 2);
+  EXPECT_LE(ie.get_num_jacobian_evaluations(), 1);
+}
+
 // Test the implicit Euler integrator.
 typedef ::testing::Types<ImplicitEulerIntegrator<double>> MyTypes;
 INSTANTIATE_TYPED_TEST_SUITE_P(My, ImplicitIntegratorTest, MyTypes);
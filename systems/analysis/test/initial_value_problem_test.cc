@@ -73,6 +73,139 @@ GTEST_TEST(InitialValueProblemTest, SolutionUsingMultipleIntegrators) {
       k2 + (x0 - k2) * std::exp(-(t2 - t0)), kAccuracy));
 }
 
+// Checks that a batched solve agrees with solving from each initial state in
+// turn, and validates its preconditions.
+GTEST_TEST(InitialValueProblemTest, BatchSolve) {
+  const double kAccuracy = 1e-6;
+  const double kDefaultInitialTime = 0.0;
+  const VectorX<double> kDefaultInitialState = VectorX<double>::Zero(2);
+  const VectorX<double> kDefaultParameters = VectorX<double>::Constant(2, 1.0);
+  const InitialValueProblem<double>::OdeContext kDefaultValues(
+      kDefaultInitialTime, kDefaultInitialState, kDefaultParameters);
+
+  // A generic ODE d𝐱/dt = -𝐱 + 𝐤, whose solution is
+  // 𝐱(t; 𝐤) = 𝐤 + (𝐱₀ - 𝐤) * e^(-(t - t₀)).
+  InitialValueProblem<double> ivp(
+      [](const double& t, const VectorX<double>& x,
+         const VectorX<double>& k) -> VectorX<double> {
+        unused(t);
+        return -x + k;
+      }, kDefaultValues);
+  ivp.get_mutable_integrator().set_target_accuracy(kAccuracy);
+
+  const int kNumStates = 50;
+  const MatrixX<double> initial_states =
+      MatrixX<double>::Random(2, kNumStates);
+  InitialValueProblem<double>::OdeContext values;
+  values.t0 = 0.5;
+  values.k = VectorX<double>::Constant(2, 3.0).eval();
+  const double tf = 2.0;
+  const MatrixX<double> solutions =
+      ivp.BatchSolve(tf, initial_states, values);
+  ASSERT_EQ(solutions.rows(), 2);
+  ASSERT_EQ(solutions.cols(), kNumStates);
+  for (int j = 0; j < kNumStates; ++j) {
+    const VectorX<double> expected =
+        values.k.value() + (initial_states.col(j) - values.k.value()) *
+                               std::exp(-(tf - values.t0.value()));
+    EXPECT_TRUE(CompareMatrices(solutions.col(j), expected, kAccuracy));
+    InitialValueProblem<double>::OdeContext single_values = values;
+    single_values.x0 = initial_states.col(j);
+    EXPECT_TRUE(CompareMatrices(solutions.col(j),
+                                ivp.Solve(tf, single_values), kAccuracy));
+  }
+
+  // An empty batch has an empty solution.
+  EXPECT_EQ(ivp.BatchSolve(tf, MatrixX<double>(2, 0)).cols(), 0);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ivp.BatchSolve(tf, MatrixX<double>::Zero(3, 4)), std::logic_error,
+      ".*initial state.*wrong dimension.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ivp.BatchSolve(-1.0, initial_states), std::logic_error,
+      "Cannot solve IVP for.*time.*");
+  {
+    InitialValueProblem<double>::OdeContext bad_values;
+    bad_values.x0 = kDefaultInitialState;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        ivp.BatchSolve(tf, initial_states, bad_values), std::logic_error,
+        ".*x0 cannot be given.*");
+  }
+  {
+    InitialValueProblem<double>::OdeContext bad_values;
+    bad_values.k = VectorX<double>::Zero(3);
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        ivp.BatchSolve(tf, initial_states, bad_values), std::logic_error,
+        ".*parameters.*wrong dimension.*");
+  }
+}
+
+// Checks that a parareal solve converges to the solution of a serial solve with
+// the same integrator, and validates its preconditions.
+GTEST_TEST(InitialValueProblemTest, PararealSolve) {
+  // A harmonic oscillator d²p/dt² = -k₁ p, integrated over many periods.
+  const InitialValueProblem<double>::OdeContext kDefaultValues(
+      0.0, Eigen::Vector2d(1.0, 0.0), VectorX<double>::Constant(1, 4.0));
+  InitialValueProblem<double> ivp(
+      [](const double& t, const VectorX<double>& x,
+         const VectorX<double>& k) -> VectorX<double> {
+        unused(t);
+        return Eigen::Vector2d(x(1), -k(0) * x(0));
+      }, kDefaultValues);
+  // Fixed steps make the fine propagator of each slice match the steps of a
+  // serial solve.
+  ivp.reset_integrator<RungeKutta2Integrator<double>>(0.01);
+  const double tf = 10.0;
+  const VectorX<double> serial_solution = ivp.Solve(tf);
+
+  InitialValueProblem<double>::PararealOptions options;
+  options.num_slices = 20;
+  options.num_coarse_steps_per_slice = 4;
+  options.max_iterations = 20;
+  options.convergence_tolerance = 1e-10;
+  options.num_threads = 4;
+  InitialValueProblem<double>::PararealStatistics stats;
+  EXPECT_TRUE(CompareMatrices(ivp.PararealSolve(tf, options, {}, &stats),
+                              serial_solution, 1e-9));
+  EXPECT_TRUE(stats.converged);
+  EXPECT_LE(stats.final_correction, options.convergence_tolerance);
+  // Fewer iterations than slices are needed.
+  EXPECT_LT(stats.num_iterations, options.num_slices);
+
+  // Any number of threads gives the same solution.
+  options.num_threads = 1;
+  InitialValueProblem<double>::PararealStatistics serial_stats;
+  EXPECT_TRUE(CompareMatrices(ivp.PararealSolve(tf, options, {}, &serial_stats),
+                              ivp.PararealSolve(tf, options), 0.0));
+  EXPECT_EQ(serial_stats.num_iterations, stats.num_iterations);
+
+  // Limiting the iterations trades accuracy for time: after two iterations,
+  // all slices are integrated once and all but the first once more.
+  options.max_iterations = 2;
+  const VectorX<double> early_solution =
+      ivp.PararealSolve(tf, options, {}, &stats);
+  EXPECT_FALSE(stats.converged);
+  EXPECT_EQ(stats.num_iterations, 2);
+  EXPECT_EQ(stats.num_fine_slice_integrations, 39);
+  EXPECT_FALSE(CompareMatrices(early_solution, serial_solution, 1e-6));
+
+  // The initial state is returned as is at the initial time.
+  InitialValueProblem<double>::OdeContext values;
+  values.x0 = Eigen::VectorXd(Eigen::Vector2d(2.0, -1.0));
+  EXPECT_TRUE(CompareMatrices(ivp.PararealSolve(0.0, options, values),
+                              values.x0.value()));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(ivp.PararealSolve(-1.0, options),
+                              std::logic_error, "Cannot solve IVP for.*time.*");
+  options.num_slices = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(ivp.PararealSolve(tf, options), std::logic_error,
+                              ".*must be positive.*");
+  options.num_slices = 20;
+  options.convergence_tolerance = -1.0;
+  DRAKE_EXPECT_THROWS_MESSAGE(ivp.PararealSolve(tf, options), std::logic_error,
+                              ".*must be nonnegative.*");
+}
+
 // Validates preconditions when constructing any given IVP.
 GTEST_TEST(InitialValueProblemTest, ConstructionPreconditionsValidation) {
   // Defines a generic ODE d𝐱/dt = -𝐱 + 𝐤, that does not
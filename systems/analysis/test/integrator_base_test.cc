@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/systems/plants/spring_mass_system/spring_mass_system.h"
 
@@ -266,6 +267,51 @@ GTEST_TEST(IntegratorBaseTest, DenseOutputTest) {
       std::runtime_error, ".*ConcatenateInTime.*time_offset.*");
 }
 
+// Check that compact dense integration records the same trajectory as the
+// dense integration, including repeated evaluations.
+GTEST_TEST(IntegratorBaseTest, CompactDenseOutputTest) {
+  SpringMassSystem<double> spring_mass(10.0, 1.0, false);
+  std::unique_ptr<Context<double>> context = spring_mass.CreateDefaultContext();
+  spring_mass.set_position(context.get(), 0.1);
+  DummyIntegrator<double> integrator(spring_mass, context.get());
+  integrator.set_fixed_step_mode(true);
+  integrator.Initialize();
+
+  EXPECT_EQ(integrator.get_compact_dense_output(), nullptr);
+  integrator.StartDenseIntegration();
+  // Only the position and the velocity are recorded.
+  integrator.StartCompactDenseIntegration({0, 1});
+  DRAKE_EXPECT_THROWS_MESSAGE(integrator.StartCompactDenseIntegration(),
+                              std::logic_error, ".*has been started already.*");
+  const CompactHermitianDenseOutput<double>* compact_dense_output =
+      integrator.get_compact_dense_output();
+  ASSERT_NE(compact_dense_output, nullptr);
+  EXPECT_EQ(compact_dense_output->get_number_of_segments(), 0);
+  EXPECT_TRUE(integrator.IntegrateWithSingleFixedStepToTime(0.1));
+  EXPECT_TRUE(integrator.IntegrateWithSingleFixedStepToTime(0.2));
+  EXPECT_EQ(compact_dense_output->get_number_of_segments(), 2);
+
+  // Repeating a step replaces the final segment.
+  context->SetTime(0.1);
+  EXPECT_TRUE(integrator.IntegrateWithSingleFixedStepToTime(0.15));
+  EXPECT_EQ(compact_dense_output->get_number_of_segments(), 2);
+  EXPECT_EQ(compact_dense_output->start_time(), 0.0);
+  EXPECT_EQ(compact_dense_output->end_time(), 0.15);
+
+  const std::unique_ptr<trajectories::PiecewisePolynomial<double>>
+      dense_output = integrator.StopDenseIntegration();
+  const std::unique_ptr<CompactHermitianDenseOutput<double>> compact =
+      integrator.StopCompactDenseIntegration();
+  EXPECT_EQ(integrator.get_compact_dense_output(), nullptr);
+  for (double t : {0.0, 0.05, 0.1, 0.12, 0.15}) {
+    const Eigen::VectorXd x = dense_output->value(t);
+    EXPECT_TRUE(CompareMatrices(compact->Evaluate(t), x.head(2), 1e-14));
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(integrator.StopCompactDenseIntegration(),
+                              std::logic_error,
+                              "No compact dense integration.*");
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
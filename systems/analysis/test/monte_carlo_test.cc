@@ -1,6 +1,8 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -169,6 +171,157 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// Confirm that the parallel executions produce the same results (in the same
+// order) as the serial execution.
+GTEST_TEST(MonteCarloSimulationTest, ParallelMatchesSerial) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    std::normal_distribution<> distribution;
+    auto system = std::make_unique<ConstantVectorSource<double>>(
+        distribution(*generator));
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 25;
+
+  RandomGenerator serial_generator;
+  const auto serial_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &serial_generator, kNoConcurrency);
+  ASSERT_EQ(serial_results.size(), num_samples);
+
+  for (const int num_parallel_executions : {2, 4, kUseHardwareConcurrency}) {
+    RandomGenerator parallel_generator;
+    const auto parallel_results = MonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        &parallel_generator, num_parallel_executions);
+    ASSERT_EQ(parallel_results.size(), num_samples);
+    for (int i = 0; i < num_samples; ++i) {
+      EXPECT_EQ(parallel_results[i].output, serial_results[i].output);
+    }
+    // The top-level generators must also have advanced identically.
+    EXPECT_EQ(parallel_generator(), RandomGenerator(serial_generator)());
+  }
+
+  EXPECT_THROW(MonteCarloSimulation(make_simulator, &GetScalarOutput,
+                                    final_time, num_samples, nullptr, 0),
+               std::exception);
+}
+
+GTEST_TEST(MonteCarloSimulationTest, CounterBasedGenerator) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    std::normal_distribution<> distribution;
+    auto system = std::make_unique<ConstantVectorSource<double>>(
+        distribution(*generator));
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 10;
+
+  RandomGenerator serial_generator = RandomGenerator::MakeCounterBased(42);
+  const auto serial_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &serial_generator, kNoConcurrency);
+  RandomGenerator parallel_generator = RandomGenerator::MakeCounterBased(42);
+  const auto parallel_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &parallel_generator, 4);
+  ASSERT_EQ(serial_results.size(), num_samples);
+  ASSERT_EQ(parallel_results.size(), num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    EXPECT_TRUE(serial_results[i].generator_snapshot.is_counter_based());
+    EXPECT_EQ(parallel_results[i].output, serial_results[i].output);
+    if (i > 0) {
+      EXPECT_NE(serial_results[i].output, serial_results[i - 1].output);
+    }
+    // Each result can be reproduced from its snapshot.
+    RandomGenerator generator(serial_results[i].generator_snapshot);
+    EXPECT_EQ(RandomSimulation(make_simulator, &GetScalarOutput, final_time,
+                               &generator),
+              serial_results[i].output);
+  }
+
+  // Reusing the generator gives new samples.
+  const auto next_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &serial_generator, kNoConcurrency);
+  EXPECT_NE(next_results[0].output, serial_results[0].output);
+}
+
+// Confirm that the shards of a simulation, run independently and merged,
+// produce the same results as the whole simulation.
+GTEST_TEST(MonteCarloSimulationTest, ShardsMatchWhole) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    std::normal_distribution<> distribution;
+    auto system = std::make_unique<ConstantVectorSource<double>>(
+        distribution(*generator));
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 25;
+  const int num_shards = 4;
+
+  EXPECT_EQ(GetMonteCarloShardRange(num_samples, 0, num_shards),
+            std::make_pair(0, 6));
+  EXPECT_EQ(GetMonteCarloShardRange(num_samples, 3, num_shards),
+            std::make_pair(18, 25));
+  EXPECT_EQ(GetMonteCarloShardRange(2, 1, num_shards), std::make_pair(0, 1));
+  EXPECT_THROW(GetMonteCarloShardRange(num_samples, num_shards, num_shards),
+               std::exception);
+  EXPECT_THROW(GetMonteCarloShardRange(num_samples, 0, 0), std::exception);
+
+  for (const bool counter_based : {false, true}) {
+    const RandomGenerator seed_generator =
+        counter_based ? RandomGenerator::MakeCounterBased(42)
+                      : RandomGenerator(42);
+    RandomGenerator whole_generator(seed_generator);
+    const auto whole_results =
+        MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                             num_samples, &whole_generator);
+
+    // Each shard starts from a copy of the same generator, as if run by a
+    // separate process, and in any order.
+    std::vector<std::vector<RandomSimulationResult>> shards(num_shards);
+    for (const int s : {2, 0, 3, 1}) {
+      RandomGenerator shard_generator(seed_generator);
+      shards[s] = MonteCarloSimulationShard(
+          make_simulator, &GetScalarOutput, final_time, num_samples, s,
+          num_shards, &shard_generator, s % 2 == 0 ? kNoConcurrency : 3);
+      const auto [begin, end] =
+          GetMonteCarloShardRange(num_samples, s, num_shards);
+      ASSERT_EQ(shards[s].size(), end - begin);
+      // The generator is advanced as for the whole simulation.
+      EXPECT_EQ(shard_generator(), RandomGenerator(whole_generator)());
+    }
+
+    const auto merged_results = MergeMonteCarloShards(shards, num_samples);
+    ASSERT_EQ(merged_results.size(), num_samples);
+    for (int i = 0; i < num_samples; ++i) {
+      EXPECT_EQ(merged_results[i].output, whole_results[i].output);
+      RandomGenerator generator(merged_results[i].generator_snapshot);
+      EXPECT_EQ(RandomSimulation(make_simulator, &GetScalarOutput, final_time,
+                                 &generator),
+                whole_results[i].output);
+    }
+
+    // A shard that is run again gives the same results.
+    RandomGenerator rerun_generator(seed_generator);
+    const auto rerun_results = MonteCarloSimulationShard(
+        make_simulator, &GetScalarOutput, final_time, num_samples, 1,
+        num_shards, &rerun_generator);
+    ASSERT_EQ(rerun_results.size(), shards[1].size());
+    for (int i = 0; i < static_cast<int>(rerun_results.size()); ++i) {
+      EXPECT_EQ(rerun_results[i].output, shards[1][i].output);
+    }
+
+    // Missing or incomplete shards cannot be merged.
+    shards[1].pop_back();
+    EXPECT_THROW(MergeMonteCarloShards(shards, num_samples), std::exception);
+    shards.pop_back();
+    EXPECT_THROW(MergeMonteCarloShards(shards, num_samples), std::exception);
+    EXPECT_THROW(MergeMonteCarloShards({}, num_samples), std::exception);
+  }
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
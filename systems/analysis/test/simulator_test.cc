@@ -4,6 +4,7 @@
 #include <complex>
 #include <functional>
 #include <map>
+#include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -13,6 +14,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/explicit_euler_integrator.h"
 #include "drake/systems/analysis/implicit_euler_integrator.h"
@@ -969,6 +971,57 @@ GTEST_TEST(SimulatorTest, RealtimeRate) {
   EXPECT_TRUE(simulator.get_actual_realtime_rate() <= 5.1);
 }
 
+// Tests that a paced simulation records its wall-clock statistics, including
+// a deadline miss caused by a stall between steps.
+GTEST_TEST(SimulatorTest, RealtimeStatistics) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  Simulator<double> simulator(spring_mass);  // Use default Context.
+
+  EXPECT_EQ(simulator.get_realtime_spin_duration(), 0.0);
+  EXPECT_THROW(simulator.set_realtime_spin_duration(-1e-4), std::exception);
+  simulator.set_realtime_spin_duration(1e-4);
+  EXPECT_EQ(simulator.get_realtime_spin_duration(), 1e-4);
+
+  // The monitor stalls for 2 ms of wall-clock time once, halfway through.
+  // Every step takes 0.1 ms of wall-clock time at this rate, so the step
+  // after the stall will be at least 1.9 ms late.
+  bool stalled = false;
+  simulator.set_monitor([&stalled](const Context<double>& context) {
+    if (!stalled && context.get_time() >= 0.05) {
+      stalled = true;
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return EventStatus::Succeeded();
+  });
+  simulator.set_target_realtime_rate(10.);
+  simulator.get_mutable_integrator().set_maximum_step_size(0.001);
+  simulator.Initialize();
+  simulator.AdvanceTo(0.1);
+  EXPECT_TRUE(stalled);
+
+  const SimulatorRealtimeStatistics& stats =
+      simulator.get_realtime_statistics();
+  EXPECT_GE(stats.num_deadline_misses, 1);
+  EXPECT_LT(stats.num_deadline_misses, simulator.get_num_steps_taken());
+  EXPECT_GE(stats.max_lateness, 1.9e-3);
+  int64_t num_steps_recorded = 0;
+  for (int64_t count : stats.step_latency_histogram) {
+    num_steps_recorded += count;
+  }
+  EXPECT_EQ(num_steps_recorded, simulator.get_num_steps_taken());
+
+  // The statistics are reset along with the others, and aren't recorded when
+  // the simulation runs at full speed.
+  simulator.ResetStatistics();
+  simulator.set_target_realtime_rate(0.);
+  simulator.AdvanceTo(0.2);
+  EXPECT_EQ(stats.num_deadline_misses, 0);
+  EXPECT_EQ(stats.max_lateness, 0.0);
+  for (int64_t count : stats.step_latency_histogram) {
+    EXPECT_EQ(count, 0);
+  }
+}
+
 // Tests that if publishing every timestep is disabled and publish on
 // initialization is enabled, publish only happens on initialization.
 GTEST_TEST(SimulatorTest, DisablePublishEveryTimestep) {
@@ -2348,6 +2401,35 @@ GTEST_TEST(SimulatorTest, MonitorFunctionAndStatusReturn) {
 // specifies a "right now" update time while the other has an event that occurs
 // at a specified time t. We'll verify that they play well together under
 // various circumstances that can occur during Simulator::Initialize().
+// Once the first steps have been taken, advancing a continuous system in small
+// increments (as in a hard real-time control loop) must not allocate from the
+// heap: the Simulator and the error-controlled integrator reuse their
+// temporaries, and the Diagram evaluates derivatives in place.
+GTEST_TEST(SimulatorTest, SteadyStateSteppingDoesNotAllocate) {
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<ConstantVectorSource<double>>(
+      Eigen::Vector2d(1.0, -2.0));
+  auto integrator = builder.AddSystem<Integrator<double>>(2);
+  builder.Connect(*source, *integrator);
+  Simulator<double> simulator(builder.Build());
+  simulator.get_mutable_integrator().set_maximum_step_size(1e-4);
+
+  // Warm up, so that every temporary has been sized.
+  const double kPeriod = 1e-3;
+  simulator.AdvanceTo(kPeriod);
+  const int num_steps_before = simulator.get_num_steps_taken();
+
+  {
+    drake::test::LimitMalloc guard;
+    for (int i = 2; i <= 10; ++i) {
+      simulator.AdvanceTo(i * kPeriod);
+    }
+  }
+  EXPECT_GT(simulator.get_num_steps_taken(), num_steps_before);
+  EXPECT_NEAR(simulator.get_context().get_continuous_state_vector()[0],
+              10 * kPeriod, 1e-12);
+}
+
 GTEST_TEST(SimulatorTest, MissedPublishEventIssue13296) {
   // This models systems like LcmSubscriberSystem that want to generate
   // an event as soon as possible after an external message arrives. Here we
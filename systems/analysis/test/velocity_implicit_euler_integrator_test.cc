@@ -1,7 +1,11 @@
 #include "drake/systems/analysis/velocity_implicit_euler_integrator.h"
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/systems/analysis/test_utilities/implicit_integrator_test.h"
 #include "drake/systems/analysis/test_utilities/quadratic_scalar_system.h"
 
@@ -81,6 +85,132 @@ GTEST_TEST(VelocityImplicitEulerIntegratorTest,
       VelocityImplicitEulerIntegrator<double>>::CheckGeneralStatsValidity(&vie);
 }
 
+// A damped pendulum, m l² v̇ = -m g l sin(q) - b v, whose velocity dynamics
+// residual g(q, v, v̇) = m l² v̇ + m g l sin(q) + b v is nonlinear in q.
+class DampedPendulum final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DampedPendulum)
+
+  DampedPendulum() {
+    this->DeclareContinuousState(1 /* num_q */, 1 /* num_v */, 0 /* num_z */);
+  }
+
+  // Sets the mass matrix and the partial derivatives of the residual g, as
+  // VelocityImplicitEulerIntegrator::set_mechanical_jacobian_function() needs.
+  void CalcMechanicalJacobian(const Context<double>& context,
+                              Eigen::MatrixXd* M, Eigen::MatrixXd* dg_dq,
+                              Eigen::MatrixXd* dg_dv) const {
+    const double q = context.get_continuous_state().get_generalized_position()
+        .GetAtIndex(0);
+    *M = Eigen::MatrixXd::Constant(1, 1, kMass * kLength * kLength);
+    *dg_dq = Eigen::MatrixXd::Constant(
+        1, 1, kMass * kGravity * kLength * std::cos(q));
+    *dg_dv = Eigen::MatrixXd::Constant(1, 1, kDamping);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives) const final {
+    const ContinuousState<double>& state = context.get_continuous_state();
+    const double q = state[0];
+    const double v = state[1];
+    (*derivatives)[0] = v;
+    (*derivatives)[1] =
+        (-kMass * kGravity * kLength * std::sin(q) - kDamping * v) /
+        (kMass * kLength * kLength);
+  }
+
+  static constexpr double kMass = 2.0;
+  static constexpr double kLength = 0.5;
+  static constexpr double kGravity = 9.81;
+  static constexpr double kDamping = 50.0;
+};
+
+// Integrates the damped pendulum with the Jacobian from its mechanical terms
+// and with a finite difference Jacobian, and verifies that the two give the
+// same solution, with no derivative evaluations for the Jacobians in the
+// former.
+GTEST_TEST(VelocityImplicitEulerIntegratorTest, MechanicalJacobianFunction) {
+  DampedPendulum pendulum;
+  const double t_final = 1.0;
+  auto integrate = [&](bool use_mechanical_jacobian) {
+    auto context = pendulum.CreateDefaultContext();
+    context->get_mutable_continuous_state_vector().SetFromVector(
+        Eigen::Vector2d(1.2, -3.0));
+    VelocityImplicitEulerIntegrator<double> vie(pendulum, context.get());
+    if (use_mechanical_jacobian) {
+      vie.set_mechanical_jacobian_function(
+          [&pendulum](const Context<double>& c, Eigen::MatrixXd* M,
+                      Eigen::MatrixXd* dg_dq, Eigen::MatrixXd* dg_dv) {
+            pendulum.CalcMechanicalJacobian(c, M, dg_dq, dg_dv);
+          });
+      EXPECT_TRUE(vie.get_mechanical_jacobian_function() != nullptr);
+    }
+    vie.set_maximum_step_size(0.01);
+    vie.set_fixed_step_mode(true);
+    vie.set_target_accuracy(1e-8);
+    // Recompute the Jacobian at each iteration to exercise it.
+    vie.set_use_full_newton(true);
+    vie.Initialize();
+    vie.IntegrateWithMultipleStepsToTime(t_final);
+    if (use_mechanical_jacobian) {
+      EXPECT_EQ(vie.get_num_derivative_evaluations_for_jacobian(), 0);
+    } else {
+      EXPECT_GT(vie.get_num_derivative_evaluations_for_jacobian(), 0);
+    }
+    EXPECT_GT(vie.get_num_jacobian_evaluations(), 0);
+    return context->get_continuous_state_vector().CopyToVector();
+  };
+  const Eigen::VectorXd x_fd = integrate(false);
+  const Eigen::VectorXd x_mechanical = integrate(true);
+  EXPECT_TRUE(CompareMatrices(x_mechanical, x_fd, 1e-6));
+}
+
+// The Jacobian of a system with miscellaneous states z cannot be given by its
+// mechanical terms, nor can it be from wrongly sized terms.
+GTEST_TEST(VelocityImplicitEulerIntegratorTest, BadMechanicalJacobianFunction) {
+  QuadraticScalarSystem quadratic(7);
+  auto quadratic_context = quadratic.CreateDefaultContext();
+  VelocityImplicitEulerIntegrator<double> vie(quadratic,
+                                              quadratic_context.get());
+  const auto unit_terms = [](const Context<double>&, Eigen::MatrixXd* M,
+                             Eigen::MatrixXd* dg_dq, Eigen::MatrixXd* dg_dv) {
+    *M = Eigen::MatrixXd::Identity(1, 1);
+    *dg_dq = Eigen::MatrixXd::Zero(1, 1);
+    *dg_dv = Eigen::MatrixXd::Zero(1, 1);
+  };
+  vie.set_mechanical_jacobian_function(unit_terms);
+  vie.set_maximum_step_size(0.1);
+  vie.set_fixed_step_mode(true);
+  vie.Initialize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      static_cast<void>(vie.IntegrateWithSingleFixedStepToTime(0.1)),
+      std::logic_error, ".*without miscellaneous continuous states.*");
+
+  DampedPendulum pendulum;
+  auto pendulum_context = pendulum.CreateDefaultContext();
+  VelocityImplicitEulerIntegrator<double> pendulum_vie(pendulum,
+                                                       pendulum_context.get());
+  pendulum_vie.set_mechanical_jacobian_function(
+      [](const Context<double>&, Eigen::MatrixXd* M, Eigen::MatrixXd* dg_dq,
+         Eigen::MatrixXd* dg_dv) {
+        *M = Eigen::MatrixXd::Identity(2, 2);
+        *dg_dq = Eigen::MatrixXd::Zero(1, 1);
+        *dg_dv = Eigen::MatrixXd::Zero(1, 1);
+      });
+  pendulum_vie.set_maximum_step_size(0.1);
+  pendulum_vie.set_fixed_step_mode(true);
+  pendulum_vie.Initialize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      static_cast<void>(pendulum_vie.IntegrateWithSingleFixedStepToTime(0.1)),
+      std::exception, ".*M.rows\\(\\) == nv.*");
+
+  // Clearing the function restores the differentiation of the ODEs.
+  vie.set_mechanical_jacobian_function(nullptr);
+  vie.Initialize();
+  EXPECT_TRUE(vie.IntegrateWithSingleFixedStepToTime(0.1));
+}
+
 // Test Velocity-Implicit Euler integrator on common implicit tests.
 typedef ::testing::Types<VelocityImplicitEulerIntegrator<double>> MyTypes;
 INSTANTIATE_TYPED_TEST_SUITE_P(My, ImplicitIntegratorTest, MyTypes);
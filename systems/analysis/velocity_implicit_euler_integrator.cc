@@ -7,6 +7,7 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/compute_numerical_gradient.h"
@@ -89,8 +90,11 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
   // Get the existing number of ODE evaluations.
   int64_t existing_ODE_evals = this->get_num_derivative_evaluations();
 
-  // Compute the Jacobian using the selected computation scheme.
-  if (this->get_jacobian_computation_scheme() ==
+  // Compute the Jacobian from the terms of a mechanical system if given, and
+  // otherwise using the selected computation scheme.
+  if (mechanical_jacobian_ != nullptr) {
+    CalcMechanicalVelocityJacobian(t, h, y, qk, qn, Jy);
+  } else if (this->get_jacobian_computation_scheme() ==
       ImplicitIntegrator<T>::JacobianComputationScheme::kForwardDifference ||
       this->get_jacobian_computation_scheme() ==
       ImplicitIntegrator<T>::JacobianComputationScheme::kCentralDifference) {
@@ -135,6 +139,52 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
       this->get_num_derivative_evaluations() - existing_ODE_evals);
 }
 
+template <class T>
+void VelocityImplicitEulerIntegrator<T>::CalcMechanicalVelocityJacobian(
+    const T& t, const T& h, const VectorX<T>& y, const VectorX<T>& qk,
+    const VectorX<T>& qn, MatrixX<T>* Jy) {
+  DRAKE_ASSERT(qdot_ != nullptr);
+  const System<T>& system = this->get_system();
+  Context<T>* context = this->get_mutable_context();
+  const int nq = qn.size();
+  const int nv = context->get_continuous_state().num_v();
+  if (nv != y.size()) {
+    throw std::logic_error(
+        "VelocityImplicitEulerIntegrator: a mechanical Jacobian function "
+        "requires a system without miscellaneous continuous states.");
+  }
+
+  // Set the context to (t, qₖ, v) and form N(qₖ) one column at a time.
+  VectorX<T> x(nq + nv);
+  x.head(nq) = qk;
+  x.tail(nv) = y;
+  context->SetTimeAndContinuousState(t, x);
+  MatrixX<T> N(nq, nv);
+  VectorX<T> unit_v = VectorX<T>::Zero(nv);
+  for (int i = 0; i < nv; ++i) {
+    unit_v(i) = 1.0;
+    system.MapVelocityToQDot(*context, unit_v, qdot_.get());
+    N.col(i) = qdot_->get_value();
+    unit_v(i) = 0.0;
+  }
+
+  // Evaluate the terms at q = qⁿ + h N(qₖ) v.
+  context->get_mutable_continuous_state()
+      .get_mutable_generalized_position()
+      .SetFromVector(qn + h * N * y);
+  MatrixX<T> M(nv, nv);
+  MatrixX<T> dg_dq(nv, nq);
+  MatrixX<T> dg_dv(nv, nv);
+  mechanical_jacobian_(*context, &M, &dg_dq, &dg_dv);
+  DRAKE_THROW_UNLESS(M.rows() == nv && M.cols() == nv);
+  DRAKE_THROW_UNLESS(dg_dq.rows() == nv && dg_dq.cols() == nq);
+  DRAKE_THROW_UNLESS(dg_dv.rows() == nv && dg_dv.cols() == nv);
+
+  // Jₗ = -M⁻¹ (∂g/∂v + h ∂g/∂q N(qₖ)).
+  dg_dv.noalias() += h * dg_dq * N;
+  *Jy = -M.ldlt().solve(dg_dv);
+}
+
 template <class T>
 void VelocityImplicitEulerIntegrator<T>::ComputeAutoDiffVelocityJacobian(
     const T& t, const T& h, const VectorX<T>& y, const VectorX<T>& qk,
@@ -200,6 +250,9 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
     MatrixX<T>* Jy) {
   DRAKE_DEMAND(Jy != nullptr);
   DRAKE_DEMAND(iteration_matrix != nullptr);
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_jacobian());
+
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
   if (!this->get_reuse() || Jy->rows() == 0 || this->IsBadJacobian(*Jy)) {
@@ -278,6 +331,9 @@ void VelocityImplicitEulerIntegrator<T>::FreshenVelocityMatricesIfFullNewton(
   // Return immediately if full-Newton is not in use.
   if (!this->get_use_full_newton()) return;
 
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_jacobian());
+
   // Compute the initial Jacobian and iteration matrices and factor them.
   CalcVelocityJacobian(t, h, y, qk, qn, Jy);
   this->increment_num_iter_factorizations();
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
@@ -141,6 +143,67 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
                                            Context<T>* context = nullptr)
       : ImplicitIntegrator<T>(system, context) {}
 
+  /**
+   * The signature of a function that evaluates the terms of the velocity
+   * Jacobian of a mechanical system, see set_mechanical_jacobian_function().
+   */
+  using MechanicalJacobianFunction = std::function<void(
+      const Context<T>& context, MatrixX<T>* M, MatrixX<T>* dg_dq,
+      MatrixX<T>* dg_dv)>;
+
+  /**
+   * Sets a function that provides the terms of the Jacobian Jₗ(y) of Eq. (8)
+   * for a mechanical system directly, in place of the numerical or automatic
+   * differentiation selected by set_jacobian_computation_scheme(), which
+   * requires `nv + nz` (or more) evaluations of the ODEs per Jacobian.
+   *
+   * The system must not have miscellaneous states z, and its velocity
+   * dynamics must be expressible as `g(t,q,v,v̇) = M(q) v̇ - τ(t,q,v) = 0`,
+   * with `M(q)` the (invertible) mass matrix and `τ` the generalized forces.
+   * Given the `context` of the integrated system set to a time and state
+   * `(t,q,v)`, `mechanical_jacobian` must set `M` to the `nv x nv` mass matrix
+   * `M(q)`, and `dg_dq` and `dg_dv` to the `nv x nq` and `nv x nv` partial
+   * derivatives `∂g/∂q` and `∂g/∂v`, evaluated at the accelerations `v̇` of
+   * that state. Since `∂v̇/∂q = -M⁻¹ ∂g/∂q` and `∂v̇/∂v = -M⁻¹ ∂g/∂v`, the
+   * Jacobian then follows from substituting q = qⁿ + h N(qₖ) v as
+   *
+   *     Jₗ = -M⁻¹ (∂g/∂v + h ∂g/∂q N(qₖ)),
+   *
+   * where `N(qₖ)` is formed with `nv` calls to System::MapVelocityToQDot(),
+   * for only the cost of the function and of a factorization of `M`. For a
+   * MultibodyPlant, for instance, `M` is given by
+   * MultibodyPlant::CalcMassMatrix() and the partial derivatives of the rigid
+   * body dynamics and gravity by
+   * MultibodyPlant::CalcInverseDynamicsDerivatives(), from which the partial
+   * derivatives of any other applied forces (e.g., of springs and dampers)
+   * are subtracted.
+   *
+   * The terms need not be exact: an approximate Jacobian slows down the
+   * convergence of the Newton-Raphson iterations, but the solution they
+   * converge to is unchanged. The evaluations of the function count as
+   * Jacobian evaluations but not as derivative evaluations in the statistics
+   * of this integrator. An empty function restores the
+   * get_jacobian_computation_scheme() differentiation.
+   *
+   * @throws std::exception on a Jacobian evaluation if the system has
+   *   miscellaneous states z or if the function does not size its outputs as
+   *   described above.
+   */
+  void set_mechanical_jacobian_function(
+      MechanicalJacobianFunction mechanical_jacobian) {
+    mechanical_jacobian_ = std::move(mechanical_jacobian);
+    // Force the recomputation of the Jacobian cached from the previous scheme.
+    Jy_vie_.resize(0, 0);
+  }
+
+  /**
+   * Returns the function set with set_mechanical_jacobian_function(), which
+   * may be empty.
+   */
+  const MechanicalJacobianFunction& get_mechanical_jacobian_function() const {
+    return mechanical_jacobian_;
+  }
+
   /**
    * Returns true, because this integrator supports error estimation.
    */
@@ -414,7 +477,9 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // get_jacobian_computation_scheme(), which is either a first-order forward
   // difference, a second-order centered difference, or automatic
   // differentiation. See math::ComputeNumericalGradient() for more details on
-  // the first two methods.
+  // the first two methods. If a function was set with
+  // set_mechanical_jacobian_function(), we use it instead, see
+  // CalcMechanicalVelocityJacobian().
   // @param t refers to tⁿ⁺¹, the time used in the definition of ℓ(y)
   // @param h is the timestep size parameter, h, used in the definition of
   //        ℓ(y)
@@ -430,6 +495,24 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
                             const VectorX<T>& qk, const VectorX<T>& qn,
                             MatrixX<T>* Jy);
 
+  // Computes the Jacobian, Jₗ(y), of ℓ(y) with respect to y = v from the terms
+  // given by the function of set_mechanical_jacobian_function(), for a system
+  // without miscellaneous states z.
+  // @param t refers to tⁿ⁺¹, the time used in the definition of ℓ(y).
+  // @param h is the timestep size parameter, h, used in the definition of
+  //        ℓ(y).
+  // @param y is the generalized velocity around which to evaluate Jₗ(y).
+  // @param qk is qₖ, the current-iteration position used in the definition of
+  //        ℓ(y).
+  // @param qn refers to qⁿ, the initial position used in ℓ(y).
+  // @param [out] Jy is the Jacobian matrix, Jₗ(y).
+  // @note The context's time will be set to t, and its continuous state will
+  //       be indeterminate on return.
+  void CalcMechanicalVelocityJacobian(const T& t, const T& h,
+                                      const VectorX<T>& y,
+                                      const VectorX<T>& qk,
+                                      const VectorX<T>& qn, MatrixX<T>* Jy);
+
   // Uses automatic differentiation to compute the Jacobian, Jₗ(y), of the
   // function ℓ(y), used in this integrator's residual computation, with
   // respect to y, where y = (v,z). This Jacobian is then defined as:
@@ -640,6 +723,9 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // The last computed velocity+misc Jacobian matrix.
   MatrixX<T> Jy_vie_;
 
+  // The function of set_mechanical_jacobian_function(), if any.
+  MechanicalJacobianFunction mechanical_jacobian_;
+
   // Various statistics.
   int64_t num_nr_iterations_{0};
 
@@ -1,14 +1,19 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/wrap_to.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 #include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
 
 namespace drake {
 namespace systems {
@@ -35,7 +40,7 @@ FittedValueIteration(
   DRAKE_DEMAND(input_size > 0);
 
   const auto& system = simulator->get_system();
-  auto& context = simulator->get_mutable_context();
+  const auto& context = simulator->get_context();
 
   math::BarycentricMesh<double> state_mesh(state_grid);
   math::BarycentricMesh<double> input_mesh(input_grid);
@@ -66,90 +71,150 @@ FittedValueIteration(
     DRAKE_DEMAND(b.high <= *(state_grid[b.state_index].rbegin()));
   }
 
-  // The transition probabilities are represented as a sparse matrix,
-  // where Tind[input](:,state) is a list of non-zero indexes into the
-  // state_mesh, and T[input](:,state) is the associated list of coefficients.
-  // cost[input](j) is the cost of taking action input from state mesh index j.
+  DRAKE_DEMAND(options.num_threads >= 1);
+
+  // The transitions are first collected densely: Tind[input](:,state) is a
+  // list of non-zero indexes into the state_mesh, and T[input](:,state) is the
+  // associated list of coefficients. cost[input](j) is the cost of taking
+  // action input from state mesh index j.
   std::vector<Eigen::MatrixXi> Tind(num_inputs);
   std::vector<Eigen::MatrixXd> T(num_inputs);
   std::vector<Eigen::RowVectorXd> cost(num_inputs);
-
-  drake::log()->info("Computing transition and cost matrices.");
-  auto& sim_state = context.get_mutable_continuous_state_vector();
-
-  Eigen::VectorXd input_vec(input_mesh.get_input_size());
-  Eigen::VectorXd state_vec(state_mesh.get_input_size());
-
-  Eigen::VectorXi Tind_tmp(num_state_indices);
-  Eigen::VectorXd T_tmp(num_state_indices);
-
   for (int input = 0; input < num_inputs; input++) {
     Tind[input].resize(num_state_indices, num_states);
     T[input].resize(num_state_indices, num_states);
     cost[input].resize(num_states);
+  }
 
-    input_mesh.get_mesh_point(input, &input_vec);
-    input_port->FixValue(&context, input_vec);
-
-    for (int state = 0; state < num_states; state++) {
-      context.SetTime(0.0);
-      sim_state.SetFromVector(state_mesh.get_mesh_point(state));
-      simulator->Initialize();
-
-      cost[input](state) = timestep * cost_function(context);
-
-      simulator->AdvanceTo(timestep);
-      state_vec = sim_state.CopyToVector();
+  drake::log()->info("Computing transition and cost matrices.");
+  // The given simulator is used by the first thread; every other thread gets
+  // its own simulator with the same configuration.
+  const int num_threads =
+      std::min(options.num_threads, num_inputs * num_states);
+  std::vector<std::unique_ptr<Simulator<double>>> thread_simulators;
+  if (num_threads > 1) {
+    // The integrator's accuracy is only known once it has been initialized.
+    Eigen::VectorXd input_vec(input_mesh.get_input_size());
+    input_mesh.get_mesh_point(0, &input_vec);
+    input_port->FixValue(&simulator->get_mutable_context(), input_vec);
+    simulator->Initialize();
+    const SimulatorConfig config = ExtractSimulatorConfig(*simulator);
+    for (int i = 1; i < num_threads; ++i) {
+      thread_simulators.push_back(
+          std::make_unique<Simulator<double>>(system, context.Clone()));
+      ApplySimulatorConfig(thread_simulators.back().get(), config);
+    }
+  }
 
-      for (const auto& b : options.periodic_boundary_conditions) {
-        state_vec[b.state_index] =
-            math::wrap_to(state_vec[b.state_index], b.low, b.high);
+  drake::internal::StaticParallelForRange(
+      num_inputs * num_states, num_threads,
+      [&](int thread_num, int begin, int end) {
+        Simulator<double>* thread_simulator =
+            (thread_num == 0) ? simulator
+                              : thread_simulators[thread_num - 1].get();
+        auto& thread_context = thread_simulator->get_mutable_context();
+        auto& sim_state = thread_context.get_mutable_continuous_state_vector();
+
+        Eigen::VectorXd input_vec(input_mesh.get_input_size());
+        Eigen::VectorXd state_vec(state_mesh.get_input_size());
+        Eigen::VectorXi Tind_tmp(num_state_indices);
+        Eigen::VectorXd T_tmp(num_state_indices);
+
+        for (int i = begin; i < end; ++i) {
+          const int input = i / num_states;
+          const int state = i % num_states;
+          if (i == begin || state == 0) {
+            input_mesh.get_mesh_point(input, &input_vec);
+            input_port->FixValue(&thread_context, input_vec);
+          }
+
+          thread_context.SetTime(0.0);
+          sim_state.SetFromVector(state_mesh.get_mesh_point(state));
+          thread_simulator->Initialize();
+
+          cost[input](state) = timestep * cost_function(thread_context);
+
+          thread_simulator->AdvanceTo(timestep);
+          state_vec = sim_state.CopyToVector();
+
+          for (const auto& b : options.periodic_boundary_conditions) {
+            state_vec[b.state_index] =
+                math::wrap_to(state_vec[b.state_index], b.low, b.high);
+          }
+
+          state_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
+          Tind[input].col(state) = Tind_tmp;
+          T[input].col(state) = T_tmp;
+        }
+      });
+
+  // Assemble the transposed transition matrix of each input once, so that
+  // each value iteration update is a sparse matrix-vector product:
+  // Tt[input](state, j) is the weight of mesh point j in the state reached
+  // from mesh point state.
+  std::vector<Eigen::SparseMatrix<double, Eigen::RowMajor>> Tt(num_inputs);
+  {
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(num_states * num_state_indices);
+    for (int input = 0; input < num_inputs; input++) {
+      triplets.clear();
+      for (int state = 0; state < num_states; state++) {
+        for (int index = 0; index < num_state_indices; index++) {
+          if (T[input](index, state) != 0.0) {
+            triplets.emplace_back(state, Tind[input](index, state),
+                                  T[input](index, state));
+          }
+        }
       }
-
-      state_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
-      Tind[input].col(state) = Tind_tmp;
-      T[input].col(state) = T_tmp;
+      Tt[input].resize(num_states, num_states);
+      Tt[input].setFromTriplets(triplets.begin(), triplets.end());
     }
   }
+  Tind.clear();
+  T.clear();
   drake::log()->info("Done computing transition and cost matrices.");
 
   // Perform value iteration loop.
   Eigen::RowVectorXd J = Eigen::RowVectorXd::Zero(num_states);
   Eigen::RowVectorXd Jnext(num_states);
+  Eigen::RowVectorXd Q(num_states);
+  Eigen::VectorXi best_input(num_states);
   Eigen::MatrixXd Pi(input_mesh.get_input_size(), num_states);
 
   drake::log()->info("Running value iteration.");
   double max_diff = std::numeric_limits<double>::infinity();
   int iteration = 0;
   while (max_diff > options.convergence_tol) {
-    for (int state = 0; state < num_states; state++) {
-      Jnext(state) = std::numeric_limits<double>::infinity();
-
-      int best_input = 0;
-      for (int input = 0; input < num_inputs; input++) {
-        // Q(x,u) = g(x,u) + γ J(f(x,u)).
-        double Q = cost[input](state);
-        for (int index = 0; index < num_state_indices; index++) {
-          Q += options.discount_factor * T[input](index, state) *
-               J(Tind[input](index, state));
-        }
-        // Cost-to-go: J = minᵤ Q(x,u).
-        // Policy:  π(x) = argminᵤ Q(x,u).
-        if (Q < Jnext(state)) {
-          Jnext(state) = Q;
-          best_input = input;
+    Jnext.setConstant(std::numeric_limits<double>::infinity());
+    best_input.setZero();
+    for (int input = 0; input < num_inputs; input++) {
+      // Q(x,u) = g(x,u) + γ J(f(x,u)).
+      Q.transpose().noalias() = Tt[input] * J.transpose();
+      Q = cost[input] + options.discount_factor * Q;
+      // Cost-to-go: J = minᵤ Q(x,u).
+      // Policy:  π(x) = argminᵤ Q(x,u).
+      for (int state = 0; state < num_states; state++) {
+        if (Q(state) < Jnext(state)) {
+          Jnext(state) = Q(state);
+          best_input(state) = input;
         }
       }
-      Pi.col(state) = input_mesh.get_mesh_point(best_input);
+    }
+    for (int state = 0; state < num_states; state++) {
+      Pi.col(state) = input_mesh.get_mesh_point(best_input(state));
     }
     max_diff = (J - Jnext).lpNorm<Eigen::Infinity>();
-    J = Jnext;
+    J.swap(Jnext);
     iteration++;
+    drake::log()->debug("Value iteration {}: max change in J {}.", iteration,
+                        max_diff);
     if (options.visualization_callback) {
       options.visualization_callback(iteration, state_mesh, J, Pi);
     }
   }
-  drake::log()->info("Value iteration converged to requested tolerance.");
+  drake::log()->info(
+      "Value iteration converged to requested tolerance after {} iterations.",
+      iteration);
 
   // Create the policy.
   auto policy = std::make_unique<BarycentricMeshSystem<double>>(state_mesh, Pi);
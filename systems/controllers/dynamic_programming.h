@@ -66,6 +66,14 @@ struct DynamicProgrammingOptions {
   /// the dynamics of the additional state variables cannot impact the dynamics
   /// of the continuous states.  @default false.
   bool assume_non_continuous_states_are_fixed{false};
+
+  /// The number of threads used by FittedValueIteration to simulate the
+  /// transitions from the mesh points. Each additional thread uses its own
+  /// Simulator, created on a clone of the given simulator's Context and
+  /// configured with ExtractSimulatorConfig(). When this is more than one, the
+  /// System and the cost function must support concurrent evaluation on
+  /// distinct Contexts.  @default 1.
+  int num_threads{1};
 };
 
 /// Implements Fitted Value Iteration on a (triangulated) Barycentric Mesh,
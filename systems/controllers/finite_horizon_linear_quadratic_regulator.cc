@@ -1,11 +1,15 @@
 #include "drake/systems/controllers/finite_horizon_linear_quadratic_regulator.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/is_approx_equal_abstol.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
@@ -237,6 +241,164 @@ class RiccatiSystem : public LeafSystem<double> {
   const FiniteHorizonLinearQuadraticRegulatorOptions& options_;
 };
 
+// Solves the Riccati difference equation for a difference-equation system
+// with the given time_period, on the samples t0 + n * time_period for
+// n = 0, ..., num_steps.  The linearizations about the nominal trajectory are
+// computed (in parallel, when requested) before the backward recursion.
+FiniteHorizonLinearQuadraticRegulatorResult
+DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+    const System<double>& system, const Context<double>& context, double t0,
+    double tf, double time_period, const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R, const Trajectory<double>& x0,
+    const Trajectory<double>& u0,
+    const FiniteHorizonLinearQuadraticRegulatorOptions& options) {
+  const std::unique_ptr<System<AutoDiffXd>> autodiff_system =
+      System<double>::ToAutoDiffXd(system);
+  const InputPort<AutoDiffXd>* const input_port =
+      autodiff_system->get_input_port_selection(options.input_port_index);
+  DRAKE_DEMAND(input_port->get_data_type() == PortDataType::kVectorValued);
+  const int num_states = context.num_total_states();
+  const int num_inputs = input_port->size();
+  DRAKE_DEMAND(num_states > 0);
+  DRAKE_DEMAND(num_inputs > 0);
+
+  const double kSymmetryTolerance = 1e-8;
+  DRAKE_DEMAND(Q.rows() == num_states && Q.cols() == num_states);
+  DRAKE_DEMAND(math::IsPositiveDefinite(Q, 0.0, kSymmetryTolerance));
+  DRAKE_DEMAND(R.rows() == num_inputs && R.cols() == num_inputs);
+  DRAKE_DEMAND(math::IsPositiveDefinite(
+      R, std::numeric_limits<double>::epsilon(), kSymmetryTolerance));
+  const Eigen::MatrixXd N =
+      options.N ? *options.N : Eigen::MatrixXd::Zero(num_states, num_inputs);
+  DRAKE_DEMAND(N.rows() == num_states && N.cols() == num_inputs);
+  DRAKE_DEMAND(x0.rows() == num_states && x0.cols() == 1);
+  DRAKE_DEMAND(u0.rows() == num_inputs && u0.cols() == 1);
+
+  // The horizon must be a whole number of steps.
+  const int num_steps = static_cast<int>(std::round((tf - t0) / time_period));
+  DRAKE_THROW_UNLESS(num_steps > 0);
+  DRAKE_THROW_UNLESS(std::abs(num_steps * time_period - (tf - t0)) <=
+                     1e-10 * std::max(1.0, tf - t0));
+  std::vector<double> times(num_steps + 1);
+  for (int n = 0; n <= num_steps; ++n) {
+    times[n] = (n == num_steps) ? tf : t0 + n * time_period;
+  }
+
+  // Linearize x[n+1] = f(n, x[n], u[n]) about the nominal trajectory, as
+  // x[n+1] - x0[n+1] = A[n](x[n] - x0[n]) + B[n](u[n] - u0[n]) + c[n].  Each
+  // linearization only depends on its own sample, so they can be computed in
+  // any order.
+  std::vector<Eigen::MatrixXd> A(num_steps);
+  std::vector<Eigen::MatrixXd> B(num_steps);
+  std::vector<Eigen::VectorXd> c(num_steps);
+  const int num_threads = std::min(options.num_threads, num_steps);
+  DRAKE_DEMAND(num_threads >= 1);
+  drake::internal::StaticParallelForRange(
+      num_steps, num_threads, [&](int, int begin, int end) {
+        const std::unique_ptr<Context<AutoDiffXd>> autodiff_context =
+            autodiff_system->CreateDefaultContext();
+        autodiff_context->SetTimeStateAndParametersFrom(context);
+        autodiff_system->FixInputPortsFrom(system, context,
+                                           autodiff_context.get());
+        const std::unique_ptr<DiscreteValues<AutoDiffXd>> x1 =
+            autodiff_system->AllocateDiscreteVariables();
+        for (int n = begin; n < end; ++n) {
+          auto autodiff_args = math::initializeAutoDiffTuple(
+              x0.value(times[n]), u0.value(times[n]));
+          autodiff_context->SetTime(times[n]);
+          autodiff_context->SetDiscreteState(std::get<0>(autodiff_args));
+          input_port->FixValue(autodiff_context.get(),
+                               std::get<1>(autodiff_args));
+          autodiff_system->CalcDiscreteVariableUpdates(*autodiff_context,
+                                                       x1.get());
+          const VectorX<AutoDiffXd> autodiff_x1 =
+              x1->get_vector().CopyToVector();
+          const Eigen::MatrixXd AB =
+              math::autoDiffToGradientMatrix(autodiff_x1, num_states +
+                                                              num_inputs);
+          A[n] = AB.leftCols(num_states);
+          B[n] = AB.rightCols(num_inputs);
+          c[n] = math::autoDiffToValueMatrix(autodiff_x1) -
+                 x0.value(times[n + 1]);
+        }
+      });
+
+  // Desired trajectories relative to the nominal.
+  auto calc_xd0 = [&](double t) -> Eigen::VectorXd {
+    return options.xd ? (options.xd->value(t) - x0.value(t)).eval()
+                      : Eigen::VectorXd::Zero(num_states);
+  };
+  auto calc_ud0 = [&](double t) -> Eigen::VectorXd {
+    return options.ud ? (options.ud->value(t) - u0.value(t)).eval()
+                      : Eigen::VectorXd::Zero(num_inputs);
+  };
+
+  // The cost-to-go at the final time.
+  std::vector<Eigen::MatrixXd> S(num_steps + 1);
+  std::vector<Eigen::MatrixXd> sx(num_steps + 1);
+  std::vector<Eigen::MatrixXd> s0(num_steps + 1);
+  std::vector<Eigen::MatrixXd> K(num_steps + 1);
+  std::vector<Eigen::MatrixXd> k0(num_steps + 1);
+  S[num_steps] = Eigen::MatrixXd::Zero(num_states, num_states);
+  sx[num_steps] = Eigen::VectorXd::Zero(num_states);
+  s0[num_steps] = Eigen::VectorXd::Zero(1);
+  if (options.Qf) {
+    DRAKE_DEMAND(options.Qf->rows() == num_states &&
+                 options.Qf->cols() == num_states);
+    DRAKE_DEMAND(
+        math::IsPositiveDefinite(*options.Qf, 0.0, kSymmetryTolerance));
+    const Eigen::VectorXd xd0 = calc_xd0(tf);
+    S[num_steps] = *options.Qf;
+    sx[num_steps] = -(*options.Qf) * xd0;
+    s0[num_steps](0) = xd0.dot((*options.Qf) * xd0);
+  }
+
+  // The Riccati difference equation, for the cost-to-go
+  // (x-x0)'S(x-x0) + 2(x-x0)'sx + s0 and the policy u-u0 = -K(x-x0) - k0.
+  for (int n = num_steps - 1; n >= 0; --n) {
+    const Eigen::MatrixXd& Sn = S[n + 1];
+    const Eigen::VectorXd xd0 = calc_xd0(times[n]);
+    const Eigen::VectorXd ud0 = calc_ud0(times[n]);
+    const Eigen::VectorXd S_c_plus_sx = Sn * c[n] + sx[n + 1];
+
+    const Eigen::MatrixXd Ruu = R + B[n].transpose() * Sn * B[n];
+    const Eigen::MatrixXd Rux = N.transpose() + B[n].transpose() * Sn * A[n];
+    const Eigen::VectorXd ru =
+        -R * ud0 - N.transpose() * xd0 + B[n].transpose() * S_c_plus_sx;
+    const Eigen::LLT<Eigen::MatrixXd> Ruu_llt(Ruu);
+    K[n] = Ruu_llt.solve(Rux);
+    k0[n] = Ruu_llt.solve(ru);
+
+    S[n] = Q + A[n].transpose() * Sn * A[n] - Rux.transpose() * K[n];
+    // Keep S exactly symmetric.
+    S[n] = 0.5 * (S[n] + S[n].transpose()).eval();
+    sx[n] = -Q * xd0 - N * ud0 + A[n].transpose() * S_c_plus_sx -
+            Rux.transpose() * k0[n];
+    s0[n] = Vector1d(xd0.dot(Q * xd0) + ud0.dot(R * ud0) +
+                     2 * xd0.dot(N * ud0) + c[n].dot(Sn * c[n]) +
+                     2 * c[n].dot(sx[n + 1].col(0)) + s0[n + 1](0) -
+                     ru.dot(k0[n].col(0)));
+  }
+  // The policy is only used up to the last step; hold it through tf.
+  K[num_steps] = K[num_steps - 1];
+  k0[num_steps] = k0[num_steps - 1];
+
+  // Since the solution only changes at the sample times, store it as a zero
+  // order hold.
+  FiniteHorizonLinearQuadraticRegulatorResult result;
+  result.S = std::make_unique<PiecewisePolynomial<double>>(
+      PiecewisePolynomial<double>::ZeroOrderHold(times, S));
+  result.sx = std::make_unique<PiecewisePolynomial<double>>(
+      PiecewisePolynomial<double>::ZeroOrderHold(times, sx));
+  result.s0 = std::make_unique<PiecewisePolynomial<double>>(
+      PiecewisePolynomial<double>::ZeroOrderHold(times, s0));
+  result.K = std::make_unique<PiecewisePolynomial<double>>(
+      PiecewisePolynomial<double>::ZeroOrderHold(times, K));
+  result.k0 = std::make_unique<PiecewisePolynomial<double>>(
+      PiecewisePolynomial<double>::ZeroOrderHold(times, k0));
+  return result;
+}
+
 }  // namespace
 
 FiniteHorizonLinearQuadraticRegulatorResult
@@ -252,15 +414,18 @@ FiniteHorizonLinearQuadraticRegulator(
   DRAKE_DEMAND(system.num_input_ports() > 0);
   DRAKE_DEMAND(tf > t0);
   const int num_states = context.num_total_states();
+  double time_period = 0.0;
+  const bool is_discrete = system.IsDifferenceEquationSystem(&time_period);
   std::unique_ptr<PiecewisePolynomial<double>> x0;
   if (options.x0) {
     DRAKE_DEMAND(options.x0->start_time() <= t0);
     DRAKE_DEMAND(options.x0->end_time() >= tf);
-    DRAKE_DEMAND(options.x0->has_derivative());
+    DRAKE_DEMAND(is_discrete || options.x0->has_derivative());
   } else {
     // Make a constant trajectory with the state from context.
     x0 = std::make_unique<PiecewisePolynomial<double>>(
-        context.get_continuous_state_vector().CopyToVector());
+        is_discrete ? context.get_discrete_state_vector().CopyToVector()
+                    : context.get_continuous_state_vector().CopyToVector());
   }
 
   std::unique_ptr<PiecewisePolynomial<double>> u0;
@@ -274,6 +439,17 @@ FiniteHorizonLinearQuadraticRegulator(
             ->Eval(context));
   }
 
+  if (is_discrete) {
+    FiniteHorizonLinearQuadraticRegulatorResult result =
+        DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+            system, context, t0, tf, time_period, Q, R,
+            options.x0 ? *options.x0 : *x0, options.u0 ? *options.u0 : *u0,
+            options);
+    result.x0 = options.x0 ? options.x0->Clone() : std::move(x0);
+    result.u0 = options.u0 ? options.u0->Clone() : std::move(u0);
+    return result;
+  }
+
   RiccatiSystem riccati(system, context, Q, R, options.x0 ? *options.x0 : *x0,
                         options.u0 ? *options.u0 : *u0, options);
 
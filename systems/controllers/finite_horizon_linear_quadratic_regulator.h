@@ -67,6 +67,14 @@ struct FiniteHorizonLinearQuadraticRegulatorOptions {
   */
   std::variant<systems::InputPortSelection, InputPortIndex> input_port_index{
       systems::InputPortSelection::kUseFirstInputIfItExists};
+
+  /**
+  For difference-equation systems, the number of threads used to linearize the
+  system about the nominal trajectory at the sample times.  Each thread uses
+  its own Context, so the system must support concurrent evaluation on distinct
+  Contexts when this is more than one.  Unused for continuous-time systems.
+  */
+  int num_threads{1};
 };
 
 /**
@@ -91,8 +99,6 @@ struct FiniteHorizonLinearQuadraticRegulatorResult {
   copyable_unique_ptr<trajectories::Trajectory<double>> s0;
 };
 
-// TODO(russt): Add support for difference-equation systems.
-
 // TODO(russt): Add variants for specifying the cost with Q and/or R
 // trajectories, full quadratic forms, and perhaps even symbolic and/or
 // std::function cost l(t,x,u) whose's Hessian is evaluated via autodiff to give
@@ -116,6 +122,15 @@ u0(t)), and c(t) = f(t, x0(t), u0(t)) - ẋ0(t).  x0(t) and u0(t) can be
 specified in @p options, otherwise are taken to be constant trajectories with
 values given by @p context.
 
+If @p system is a difference-equation system with period h (@see
+System<T>::IsDifferenceEquationSystem()), then the Riccati difference equation
+is solved instead, for the discrete-time problem with the sum of the running
+costs at the sample times tₙ = t0 + n h, for n = 0, ..., (tf - t0)/h - 1, and
+the dynamics x[n+1] - x0(tₙ₊₁) = A[n](x[n] - x0(tₙ)) + B[n](u[n] - u0(tₙ)) +
+c[n], linearized at the sample times.  In that case tf - t0 must be a
+multiple of h, x0 need not have derivatives, and all of the result
+trajectories are zero-order holds on the sample times.
+
 @param system a System<double> representing the plant.
 @param context a Context<double> used to pass the default input, state, and
     parameters.  Note: Use @p options to specify time-varying nominal state
@@ -127,12 +142,14 @@ values given by @p context.
 @param options is the optional FiniteHorizonLinearQuadraticRegulatorOptions.
 
 @pre @p system must be a System<double> with (only) n continuous state variables
+and m inputs, or a difference-equation system with n discrete state variables
 and m inputs.  It must be convertable to System<AutoDiffXd>.
 
-@note Support for difference-equation systems (@see
-System<T>::IsDifferenceEquationSystem()) by solving the differential Riccati
-equation and richer specification of the objective are anticipated (they are
-listed in the code as TODOs).
+@throws std::exception if @p system is a difference-equation system and
+tf - t0 is not a multiple of its period.
+
+@note Richer specification of the objective is anticipated (it is listed in the
+code as a TODO).
 
 @ingroup control_systems
 */
@@ -6,7 +6,6 @@
 #include "drake/systems/controllers/inverse_dynamics.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/adder.h"
-#include "drake/systems/primitives/constant_vector_source.h"
 #include "drake/systems/primitives/demultiplexer.h"
 #include "drake/systems/primitives/pass_through.h"
 
@@ -53,9 +52,6 @@ void InverseDynamicsController<T>::SetUp(const VectorX<double>& kp,
   // Redirects estimated state input into PID and inverse dynamics.
   auto pass_through = builder.template AddSystem<PassThrough<T>>(2 * dim);
 
-  // Adds a adder to do PID's acceleration + reference acceleration.
-  auto adder = builder.template AddSystem<Adder<T>>(2, dim);
-
   // Connects estimated state to PID.
   builder.Connect(pass_through->get_output_port(),
                   pid_->get_input_port_estimated_state());
@@ -64,13 +60,6 @@ void InverseDynamicsController<T>::SetUp(const VectorX<double>& kp,
   builder.Connect(pass_through->get_output_port(),
                   inverse_dynamics->get_input_port_estimated_state());
 
-  // Adds PID's output with reference acceleration
-  builder.Connect(pid_->get_output_port_control(), adder->get_input_port(0));
-
-  // Connects desired acceleration to inverse dynamics
-  builder.Connect(adder->get_output_port(),
-                  inverse_dynamics->get_input_port_desired_acceleration());
-
   // Exposes estimated state input port.
   input_port_index_estimated_state_ =
       builder.ExportInput(pass_through->get_input_port(), "estimated_state");
@@ -80,13 +69,22 @@ void InverseDynamicsController<T>::SetUp(const VectorX<double>& kp,
       pid_->get_input_port_desired_state(), "desired_state");
 
   if (!has_reference_acceleration_) {
-    // Uses a zero constant source for reference acceleration.
-    auto zero_feedforward_acceleration =
-        builder.template AddSystem<ConstantVectorSource<T>>(
-            VectorX<T>::Zero(dim));
-    builder.Connect(zero_feedforward_acceleration->get_output_port(),
-                    adder->get_input_port(1));
+    // Without a reference acceleration, PID's output is the desired
+    // acceleration; connecting it directly avoids evaluating an adder and a
+    // zero source on every update.
+    builder.Connect(pid_->get_output_port_control(),
+                    inverse_dynamics->get_input_port_desired_acceleration());
   } else {
+    // Adds a adder to do PID's acceleration + reference acceleration.
+    auto adder = builder.template AddSystem<Adder<T>>(2, dim);
+
+    // Adds PID's output with reference acceleration
+    builder.Connect(pid_->get_output_port_control(), adder->get_input_port(0));
+
+    // Connects desired acceleration to inverse dynamics
+    builder.Connect(adder->get_output_port(),
+                    inverse_dynamics->get_input_port_desired_acceleration());
+
     // Exposes reference acceleration input port.
     input_port_index_desired_acceleration_ =
         builder.ExportInput(adder->get_input_port(1), "desired_acceleration");
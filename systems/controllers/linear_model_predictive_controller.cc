@@ -1,7 +1,10 @@
 #include "drake/systems/controllers/linear_model_predictive_controller.h"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/solvers/solve.h"
@@ -19,7 +22,7 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
     std::unique_ptr<systems::Context<double>> base_context,
     const Eigen::MatrixXd& Q, const Eigen::MatrixXd& R, double time_period,
-    double time_horizon)
+    double time_horizon, MpcFormulation formulation)
     : state_input_index_(
           this->DeclareVectorInputPort(BasicVector<T>(Q.cols())).get_index()),
       control_output_index_(
@@ -35,7 +38,8 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
       Q_(Q),
       R_(R),
       time_period_(time_period),
-      time_horizon_(time_horizon) {
+      time_horizon_(time_horizon),
+      formulation_(formulation) {
   DRAKE_DEMAND(time_period_ > 0.);
   DRAKE_DEMAND(time_horizon_ > 0.);
 
@@ -67,17 +71,110 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+
+    const int num_sample_times =
+        static_cast<int>(time_horizon_ / time_period_ + 0.5);
+    switch (formulation_) {
+      case MpcFormulation::kSparse:
+        SetupSparseQp(num_sample_times);
+        break;
+      case MpcFormulation::kCondensed:
+        SetupCondensedQp(num_sample_times);
+        break;
+    }
+  }
+}
+
+template <typename T>
+void LinearModelPredictiveController<T>::SetupSparseQp(int num_sample_times) {
+  sparse_prog_ = std::make_unique<DirectTranscription>(
+      linear_model_.get(), *base_context_, num_sample_times);
+
+  const auto state_error = sparse_prog_->state();
+  const auto input_error = sparse_prog_->input();
+
+  sparse_prog_->AddRunningCost(state_error.transpose() * Q_ * state_error +
+                               input_error.transpose() * R_ * input_error);
+
+  initial_state_constraint_ =
+      sparse_prog_
+          ->AddLinearEqualityConstraint(
+              Eigen::MatrixXd::Identity(num_states_, num_states_),
+              Eigen::VectorXd::Zero(num_states_),
+              sparse_prog_->initial_state())
+          .evaluator();
+}
+
+template <typename T>
+void LinearModelPredictiveController<T>::SetupCondensedQp(
+    int num_sample_times) {
+  // The sparse form has the running cost
+  //   h ∑ᵢ (x(i)ᵀQx(i) + u(i)ᵀRu(i)),  i = 0, ..., K - 1,
+  // with K = num_sample_times - 1 and x(i+1) = Ax(i) + Bu(i). Stacking the
+  // states gives X = Φe + ΓU, where e = x(0), Φ = [I; A; ...; Aᴷ⁻¹] and the
+  // (i, j) block of Γ is Aⁱ⁻¹⁻ʲB for j < i.
+  const int num_stages = num_sample_times - 1;
+  DRAKE_DEMAND(num_stages >= 1);
+  const int n = num_states_;
+  const int m = num_inputs_;
+  const Eigen::MatrixXd& A = linear_model_->A();
+  const Eigen::MatrixXd& B = linear_model_->B();
+  const double h = linear_model_->time_period();
+
+  // A_powers[i] = Aⁱ.
+  std::vector<Eigen::MatrixXd> A_powers(num_stages);
+  A_powers[0] = Eigen::MatrixXd::Identity(n, n);
+  for (int i = 1; i < num_stages; ++i) {
+    A_powers[i] = A * A_powers[i - 1];
+  }
+  Eigen::MatrixXd Phi(n * num_stages, n);
+  Eigen::MatrixXd Gamma = Eigen::MatrixXd::Zero(n * num_stages, m * num_stages);
+  for (int i = 0; i < num_stages; ++i) {
+    Phi.middleRows(n * i, n) = A_powers[i];
+    for (int j = 0; j < i; ++j) {
+      Gamma.block(n * i, m * j, n, m) = A_powers[i - 1 - j] * B;
+    }
+  }
+
+  // Q̅ Γ and Q̅ Φ, with Q̅ = blkdiag(Q, ..., Q).
+  Eigen::MatrixXd Q_Gamma(n * num_stages, m * num_stages);
+  Eigen::MatrixXd Q_Phi(n * num_stages, n);
+  for (int i = 0; i < num_stages; ++i) {
+    Q_Gamma.middleRows(n * i, n) = Q_ * Gamma.middleRows(n * i, n);
+    Q_Phi.middleRows(n * i, n) = Q_ * Phi.middleRows(n * i, n);
   }
+
+  Eigen::MatrixXd H = 2 * h * Gamma.transpose() * Q_Gamma;
+  for (int i = 0; i < num_stages; ++i) {
+    H.block(m * i, m * i, m, m) += 2 * h * R_;
+  }
+  condensed_linear_gain_ = 2 * h * Gamma.transpose() * Q_Phi;
+  condensed_state_cost_ = h * Phi.transpose() * Q_Phi;
+
+  condensed_prog_ = std::make_unique<solvers::MathematicalProgram>();
+  condensed_inputs_ = condensed_prog_->NewContinuousVariables(m * num_stages);
+  condensed_cost_ =
+      condensed_prog_
+          ->AddQuadraticCost(H, Eigen::VectorXd::Zero(m * num_stages),
+                             condensed_inputs_)
+          .evaluator();
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
+  DRAKE_DEMAND(linear_model_ != nullptr);
+
   const Eigen::VectorBlock<const VectorX<T>> current_state =
       get_state_port().Eval(context);
 
+  const VectorX<T> state_ref =
+      base_context_->get_discrete_state().get_vector().CopyToVector();
+  const VectorX<T> state_error = current_state - state_ref;
+
   const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+      formulation_ == MpcFormulation::kSparse ? SolveSparseQp(state_error)
+                                              : SolveCondensedQp(state_error);
 
   const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
@@ -87,30 +184,59 @@ void LinearModelPredictiveController<T>::CalcControl(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
-  DRAKE_DEMAND(linear_model_ != nullptr);
+VectorX<T> LinearModelPredictiveController<T>::SolveSparseQp(
+    const VectorX<T>& state_error) const {
+  initial_state_constraint_->set_bounds(state_error, state_error);
 
-  const int kNumSampleTimes =
-      static_cast<int>(time_horizon_ / time_period_ + 0.5);
-
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
+  std::optional<Eigen::VectorXd> initial_guess;
+  if (warm_start_.size() > 0) {
+    initial_guess = warm_start_;
+  }
+  const auto result = Solve(*sparse_prog_, initial_guess, std::nullopt);
+  DRAKE_DEMAND(result.is_success());
 
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
+  // Shift the state and input samples back by one step, repeating the last.
+  const int N = sparse_prog_->N();
+  const Eigen::MatrixXd inputs = sparse_prog_->GetInputSamples(result);
+  const Eigen::MatrixXd states = sparse_prog_->GetStateSamples(result);
+  warm_start_ = result.get_x_val();
+  for (int i = 0; i < N; ++i) {
+    const int next = std::min(i + 1, N - 1);
+    sparse_prog_->SetDecisionVariableValueInVector(
+        sparse_prog_->input(i), inputs.col(next), &warm_start_);
+    sparse_prog_->SetDecisionVariableValueInVector(
+        sparse_prog_->state(i), states.col(next), &warm_start_);
+  }
 
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
+  return inputs.col(0);
+}
 
-  const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
+template <typename T>
+VectorX<T> LinearModelPredictiveController<T>::SolveCondensedQp(
+    const VectorX<T>& state_error) const {
+  const Eigen::VectorXd linear_term = condensed_linear_gain_ * state_error;
+  for (int i = 0; i < linear_term.rows(); ++i) {
+    condensed_cost_->update_linear_coefficient_entry(i, linear_term(i));
+  }
+  condensed_cost_->update_constant_term(
+      state_error.dot(condensed_state_cost_ * state_error));
 
-  const auto result = Solve(prog);
+  std::optional<Eigen::VectorXd> initial_guess;
+  if (warm_start_.size() > 0) {
+    initial_guess = warm_start_;
+  }
+  const auto result = Solve(*condensed_prog_, initial_guess, std::nullopt);
   DRAKE_DEMAND(result.is_success());
 
-  return prog.GetInputSamples(result).col(0);
+  // Shift the stacked inputs back by one step, repeating the last.
+  const Eigen::VectorXd inputs = result.GetSolution(condensed_inputs_);
+  const int m = num_inputs_;
+  const int num_shifted = inputs.rows() - m;
+  warm_start_.resize(inputs.rows());
+  warm_start_.head(num_shifted) = inputs.tail(num_shifted);
+  warm_start_.tail(m) = inputs.tail(m);
+
+  return inputs.head(m);
 }
 
 template class LinearModelPredictiveController<double>;
@@ -4,12 +4,24 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/solvers/mathematical_program.h"
 #include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
+/// Selects how LinearModelPredictiveController poses its quadratic program.
+enum class MpcFormulation {
+  /// Keeps the states as decision variables, coupled to the inputs by one
+  /// dynamics constraint per step. The program is large but sparse.
+  kSparse,
+  /// Eliminates the states by substituting the dynamics, leaving only the
+  /// inputs as decision variables. The program is small but dense.
+  kCondensed,
+};
+
 /// Implements a basic Model Predictive Controller that linearizes the system
 /// about an equilibrium condition and regulates to the same point by solving an
 /// optimal control problem over a finite time horizon.  In particular, MPC
@@ -23,9 +35,15 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.
+///
+/// The QP is built once, at construction, in the form selected by
+/// MpcFormulation. Each control update only rewrites the data that depends on
+/// x(k) (the initial-state constraint of the sparse form, or the linear cost
+/// of the condensed form) and warm-starts the solver with the previous
+/// solution shifted by one step. Because this warm start is kept inside the
+/// controller rather than in its Context, the control output must not be
+/// evaluated concurrently.
 ///
 /// @tparam_double_only
 /// @ingroup control_systems
@@ -52,6 +70,7 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   /// @param time_period The discrete time period (in seconds) at which
   /// controller updates occur.
   /// @param time_horizon The prediction time horizon (seconds).
+  /// @param formulation Whether to solve the sparse or the condensed QP.
   ///
   /// @pre model must have discrete states of dimension num_states and inputs
   /// of dimension num_inputs.
@@ -63,7 +82,8 @@ class LinearModelPredictiveController : public LeafSystem<T> {
       std::unique_ptr<systems::System<double>> model,
       std::unique_ptr<systems::Context<double>> base_context,
       const Eigen::MatrixXd& Q, const Eigen::MatrixXd& R, double time_period,
-      double time_horizon);
+      double time_horizon,
+      MpcFormulation formulation = MpcFormulation::kSparse);
     // TODO(jadecastro) Get time_period directly from the plant model.
 
   const InputPort<T>& get_state_port() const {
@@ -76,10 +96,13 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Builds the QP for the selected formulation; called once at construction.
+  void SetupSparseQp(int num_sample_times);
+  void SetupCondensedQp(int num_sample_times);
+
+  // Solves the QP for the current state error and returns the first input.
+  VectorX<T> SolveSparseQp(const VectorX<T>& state_error) const;
+  VectorX<T> SolveCondensedQp(const VectorX<T>& state_error) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -97,8 +120,27 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   const double time_period_{};
   const double time_horizon_{};
 
+  const MpcFormulation formulation_{};
+
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The sparse QP and its initial-state constraint x(0) = x(k) - xd.
+  std::unique_ptr<trajectory_optimization::DirectTranscription> sparse_prog_;
+  std::shared_ptr<solvers::LinearEqualityConstraint> initial_state_constraint_;
+
+  // The condensed QP over the stacked inputs U. Its cost is
+  // 0.5 Uᵀ H U + (F e)ᵀ U + eᵀ G e, where e is the initial state error and
+  // only F e and eᵀ G e change between control updates.
+  std::unique_ptr<solvers::MathematicalProgram> condensed_prog_;
+  solvers::VectorXDecisionVariable condensed_inputs_;
+  std::shared_ptr<solvers::QuadraticCost> condensed_cost_;
+  Eigen::MatrixXd condensed_linear_gain_;  // F
+  Eigen::MatrixXd condensed_state_cost_;   // G
+
+  // The previous solution shifted by one step, used as the next initial guess.
+  // Empty until the first solve.
+  mutable Eigen::VectorXd warm_start_;
 };
 
 }  // namespace controllers
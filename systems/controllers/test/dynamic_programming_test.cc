@@ -65,6 +65,44 @@ GTEST_TEST(FittedValueIterationTest, SingleIntegrator) {
   }
 }
 
+// Computing the transitions on several threads gives the same solution.
+GTEST_TEST(FittedValueIterationTest, MultipleThreads) {
+  Integrator<double> sys(2);
+  Simulator<double> simulator(sys);
+  // Take a single step from each mesh point, so that the simulation results do
+  // not depend on which simulator is used.
+  const double timestep = 0.3;
+  simulator.get_mutable_integrator().set_fixed_step_mode(true);
+  simulator.get_mutable_integrator().set_maximum_step_size(timestep);
+
+  const auto cost_function = [](const Context<double>& context) {
+    return context.get_continuous_state_vector().CopyToVector().squaredNorm();
+  };
+
+  const math::BarycentricMesh<double>::MeshGrid state_grid(
+      {{-2., -1., 0., 1., 2.}, {-2., -1., -0.5, 0., 0.5, 1., 2.}});
+  const math::BarycentricMesh<double>::MeshGrid input_grid(
+      {{-1., 0., 1.}, {-0.5, 0., 0.5}});
+
+  DynamicProgrammingOptions options;
+  options.discount_factor = 0.9;
+  std::unique_ptr<BarycentricMeshSystem<double>> policy;
+  Eigen::RowVectorXd cost_to_go_values;
+  std::tie(policy, cost_to_go_values) = FittedValueIteration(
+      &simulator, cost_function, state_grid, input_grid, timestep, options);
+
+  options.num_threads = 4;
+  std::unique_ptr<BarycentricMeshSystem<double>> threaded_policy;
+  Eigen::RowVectorXd threaded_cost_to_go_values;
+  std::tie(threaded_policy, threaded_cost_to_go_values) = FittedValueIteration(
+      &simulator, cost_function, state_grid, input_grid, timestep, options);
+
+  EXPECT_TRUE(CompareMatrices(threaded_cost_to_go_values, cost_to_go_values,
+                              1e-12));
+  EXPECT_TRUE(CompareMatrices(threaded_policy->get_output_values(),
+                              policy->get_output_values()));
+}
+
 // Single integrator minimum time problem, but with the goal at -3, and the
 // state wrapped on itself.
 GTEST_TEST(FittedValueIterationTest, PeriodicBoundary) {
@@ -87,6 +87,81 @@ GTEST_TEST(FiniteHorizonLQRTest, InfiniteHorizonTest) {
   // Already confirmed above that sx, s0, and k0 stay zero.
 }
 
+// For a time-invariant difference-equation system and cost, the
+// DiscreteTimeLinearQuadraticRegulator should be a stable fixed-point for the
+// solution of the Riccati difference equation.
+GTEST_TEST(FiniteHorizonLQRTest, DiscreteTimeInfiniteHorizonTest) {
+  // Discretized double integrator.
+  const double h = 0.1;
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  A << 1, h, 0, 1;
+  B << 0.5 * h * h, h;
+  LinearSystem<double> sys(A, B, Eigen::Matrix<double, 0, 2>::Zero(),
+                           Eigen::Matrix<double, 0, 1>::Zero(), h);
+
+  Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  Vector1d R = Vector1d(4.12);
+
+  LinearQuadraticRegulatorResult lqr_result =
+      DiscreteTimeLinearQuadraticRegulator(A, B, Q, R);
+
+  const double t0 = 0;
+  const double tf = 40.0;
+  auto context = sys.CreateDefaultContext();
+  context->FixInputPort(0, Vector1d(0.0));
+
+  FiniteHorizonLinearQuadraticRegulatorOptions options;
+  for (int num_threads : {1, 3}) {
+    options.num_threads = num_threads;
+    FiniteHorizonLinearQuadraticRegulatorResult result =
+        FiniteHorizonLinearQuadraticRegulator(sys, *context, t0, tf, Q, R,
+                                              options);
+    EXPECT_EQ(result.S->start_time(), t0);
+    EXPECT_EQ(result.S->end_time(), tf);
+    EXPECT_EQ(result.K->start_time(), t0);
+    EXPECT_EQ(result.K->end_time(), tf);
+    // Confirm that it's initialized to zero.
+    EXPECT_TRUE(result.S->value(tf).isZero(1e-12));
+    // After one step the cost-to-go is the running cost, and the optimal
+    // input is zero.
+    EXPECT_TRUE(CompareMatrices(result.S->value(tf - h), Q, 1e-12));
+    EXPECT_TRUE(result.K->value(tf - h).isZero(1e-12));
+    // Confirm that it converges to the infinite-horizon solution.
+    EXPECT_TRUE(CompareMatrices(result.S->value(t0), lqr_result.S, 1e-5));
+    EXPECT_TRUE(CompareMatrices(result.K->value(t0), lqr_result.K, 1e-5));
+    // The solution is held between the samples.
+    EXPECT_TRUE(CompareMatrices(result.K->value(t0 + 0.5 * h),
+                                result.K->value(t0)));
+    EXPECT_TRUE(result.sx->value(t0).isZero(1e-12));
+    EXPECT_TRUE(result.s0->value(t0).isZero(1e-12));
+    EXPECT_TRUE(result.k0->value(t0).isZero(1e-12));
+  }
+
+  // Test that the System version also works.
+  const std::unique_ptr<System<double>> regulator =
+      MakeFiniteHorizonLinearQuadraticRegulator(sys, *context, t0, tf, Q, R);
+  auto regulator_context = regulator->CreateDefaultContext();
+  const Eigen::Vector2d x(.1, -.3);
+  regulator_context->FixInputPort(0, x);
+  EXPECT_TRUE(
+      CompareMatrices(regulator->get_output_port(0).Eval(*regulator_context),
+                      -lqr_result.K * x, 1e-5));
+
+  // Test that it stays at the fixed-point if initialized at the fixed point.
+  options.Qf = lqr_result.S;
+  FiniteHorizonLinearQuadraticRegulatorResult result =
+      FiniteHorizonLinearQuadraticRegulator(sys, *context, t0, t0 + 2.0, Q, R,
+                                            options);
+  EXPECT_TRUE(CompareMatrices(result.S->value(t0), lqr_result.S, 1e-10));
+  EXPECT_TRUE(CompareMatrices(result.K->value(t0), lqr_result.K, 1e-10));
+
+  // The horizon must be a whole number of steps.
+  EXPECT_THROW(FiniteHorizonLinearQuadraticRegulator(sys, *context, t0,
+                                                     t0 + 0.25, Q, R),
+               std::exception);
+}
+
 // Verify that we can stabilize a non-zero fixed-point specified via the
 // nominal trajectory options.
 GTEST_TEST(FiniteHorizonLQRTest, NominalTrajectoryTest) {
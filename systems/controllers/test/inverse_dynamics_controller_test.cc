@@ -39,7 +39,14 @@ class InverseDynamicsControllerTest : public ::testing::Test {
 
     q_r = (q + VectorX<double>::Constant(dim, 0.1)) * 2.;
     v_r.setZero();
-    vd_r << 1, 2, 3, 4, 5, 6, 7;
+    // The reference acceleration is zero unless the controller has a port for
+    // it.
+    const bool has_reference_acceleration = test_sys->num_input_ports() == 3;
+    if (has_reference_acceleration) {
+      vd_r << 1, 2, 3, 4, 5, 6, 7;
+    } else {
+      vd_r.setZero();
+    }
 
     // Connects inputs.
     VectorX<double> state_input(robot_plant.num_positions() +
@@ -57,8 +64,10 @@ class InverseDynamicsControllerTest : public ::testing::Test {
         inverse_dynamics_context.get(), state_input);
     test_sys->get_input_port_desired_state().FixValue(
         inverse_dynamics_context.get(), reference_state_input);
-    test_sys->get_input_port_desired_acceleration().FixValue(
-        inverse_dynamics_context.get(), reference_acceleration_input);
+    if (has_reference_acceleration) {
+      test_sys->get_input_port_desired_acceleration().FixValue(
+          inverse_dynamics_context.get(), reference_acceleration_input);
+    }
 
     // Sets integrated position error.
     VectorX<double> q_int(dim);
@@ -131,6 +140,28 @@ TEST_F(InverseDynamicsControllerTest, TestTorqueWithOwnedPlant) {
   ConfigTestAndCheck(dut.get(), kp, ki, kd);
 }
 
+// Tests the computed torque when the controller does not track a reference
+// acceleration.
+TEST_F(InverseDynamicsControllerTest, TestTorqueWithoutReferenceAcceleration) {
+  auto robot = std::make_unique<MultibodyPlant<double>>(0.0);
+  const std::string full_name = drake::FindResourceOrThrow(
+      "drake/manipulation/models/iiwa_description/sdf/iiwa14_no_collision.sdf");
+  multibody::Parser(robot.get()).AddModelFromFile(full_name);
+  robot->WeldFrames(robot->world_frame(), robot->GetFrameByName("iiwa_link_0"));
+  robot->Finalize();
+
+  // Sets pid gains.
+  const int dim = robot->num_positions();
+  VectorX<double> kp(dim), ki(dim), kd(dim);
+  SetPidGains(&kp, &ki, &kd);
+
+  auto dut = std::make_unique<InverseDynamicsController<double>>(
+      std::move(robot), kp, ki, kd,
+      false /* expose reference acceleration port */);
+  EXPECT_EQ(dut->num_input_ports(), 2);
+
+  ConfigTestAndCheck(dut.get(), kp, ki, kd);
+}
 
 }  // namespace
 }  // namespace controllers
@@ -16,7 +16,8 @@ namespace {
 
 using math::DiscreteAlgebraicRiccatiEquation;
 
-class TestMpcWithDoubleIntegrator : public ::testing::Test {
+class TestMpcWithDoubleIntegrator
+    : public ::testing::TestWithParam<MpcFormulation> {
  protected:
   void SetUp() override {
     const double kTimeStep = 0.1;     // discrete time step.
@@ -44,7 +45,7 @@ class TestMpcWithDoubleIntegrator : public ::testing::Test {
 
     dut_.reset(new LinearModelPredictiveController<double>(
         std::move(system), std::move(system_context), Q_, R_, kTimeStep,
-        kTimeHorizon));
+        kTimeHorizon, GetParam()));
 
     // Store another copy of the linear plant model.
     system_.reset(new LinearSystem<double>(A, B, C, D, kTimeStep));
@@ -58,7 +59,7 @@ class TestMpcWithDoubleIntegrator : public ::testing::Test {
   std::unique_ptr<LinearSystem<double>> system_;
 };
 
-TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
+TEST_P(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
   const double kTolerance = 1e-5;
 
   const Eigen::Matrix2d A = system_->A();
@@ -81,6 +82,33 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
                               kTolerance));
 }
 
+// Each control update re-solves the QP that was built at construction, so
+// repeated and interleaved updates must not depend on the previous state.
+TEST_P(TestMpcWithDoubleIntegrator, RepeatedUpdates) {
+  const double kTolerance = 1e-5;
+
+  const Eigen::Matrix2d A = system_->A();
+  const Eigen::Matrix<double, 2, 1> B = system_->B();
+  const Eigen::Matrix2d S = DiscreteAlgebraicRiccatiEquation(A, B, Q_, R_);
+  const Eigen::Matrix<double, 1, 2> K =
+      -(R_ + B.transpose() * S * B).inverse() * (B.transpose() * S * A);
+
+  auto context = dut_->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut_->AllocateOutput();
+  for (const Eigen::Vector2d& x0 :
+       {Eigen::Vector2d(1, 1), Eigen::Vector2d(-2, 0.5),
+        Eigen::Vector2d(1, 1)}) {
+    dut_->get_input_port(0).FixValue(context.get(), x0);
+    dut_->CalcOutput(*context, output.get());
+    EXPECT_TRUE(CompareMatrices(
+        K * x0, output->get_vector_data(0)->get_value(), kTolerance));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Formulations, TestMpcWithDoubleIntegrator,
+                         ::testing::Values(MpcFormulation::kSparse,
+                                           MpcFormulation::kCondensed));
+
 namespace {
 
 // A discrete-time cubic polynomial system.
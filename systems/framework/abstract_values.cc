@@ -14,6 +14,7 @@ AbstractValues::AbstractValues() {}
 AbstractValues::AbstractValues(
     std::vector<std::unique_ptr<AbstractValue>>&& data)
     : owned_data_(std::move(data)) {
+  data_.reserve(owned_data_.size());
   for (auto& datum : owned_data_) {
     data_.push_back(datum.get());
   }
@@ -73,6 +73,17 @@ class BasicVector : public VectorBase<T> {
     values_ = value;
   }
 
+  /// Swaps the values of this vector with those of `other` in constant time,
+  /// i.e., without copying the elements. Only the values are exchanged; the
+  /// vector objects themselves and their concrete types are not.
+  /// @throws std::exception if `other` is nullptr or has different dimensions.
+  void SwapValues(BasicVector<T>* other) {
+    DRAKE_THROW_UNLESS(other != nullptr);
+    const int n = other->size();
+    if (n != size()) { this->ThrowMismatchedSize(n); }
+    values_.swap(other->values_);
+  }
+
   /// Returns the entire vector as a const Eigen::VectorBlock.
   Eigen::VectorBlock<const VectorX<T>> get_value() const {
     return values_.head(values_.rows());
@@ -1,5 +1,6 @@
 #include "drake/systems/framework/cache.h"
 
+#include <new>
 #include <typeindex>
 #include <typeinfo>
 
@@ -24,7 +25,8 @@ void CacheEntryValue::ThrowIfBadCacheEntryValue(
   if (owning_subcontext && owning_subcontext_ != owning_subcontext) {
     throw std::logic_error(FormatName(__func__) + "wrong owning subcontext.");
   }
-  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0) {
+  if ((flags_.load() & ~(kValueIsOutOfDate | kCacheEntryIsDisabled |
+                         kValueIsBeingUpdated)) != 0) {
     throw std::logic_error(FormatName(__func__) +
                            "flags value is out of range.");
   }
@@ -73,10 +75,11 @@ CacheEntryValue& Cache::CreateNewCacheEntryValue(
   // indirection here means the CacheEntryValue object's address is stable
   // even when store_ is resized.
   DRAKE_DEMAND(store_[index] == nullptr);
-  // Can't use make_unique because constructor is private.
-  store_[index] = std::unique_ptr<CacheEntryValue>(
-      new CacheEntryValue(index, ticket, description, owning_subcontext_,
-                          nullptr /* no value yet */));
+  store_[index] = arena_.Create([&](void* storage) {
+    return new (storage) CacheEntryValue(index, ticket, description,
+                                         owning_subcontext_,
+                                         nullptr /* no value yet */);
+  });
   CacheEntryValue& value = *store_[index];
 
   // Obtain a DependencyTracker for the CacheEntryValue. Normally there will be
@@ -109,6 +112,22 @@ CacheEntryValue& Cache::CreateNewCacheEntryValue(
   return value;
 }
 
+Cache::Cache(const Cache& source)
+    : owning_subcontext_(source.owning_subcontext_),
+      store_(source.cache_size(), nullptr),
+      is_cache_frozen_(source.is_cache_frozen_),
+      is_thread_safe_(source.is_thread_safe_) {
+  // All the copies go in a single block.
+  arena_.Reserve(source.arena_.size());
+  for (CacheIndex index(0); index < source.cache_size(); ++index) {
+    if (!source.has_cache_entry_value(index)) continue;
+    const CacheEntryValue& source_value = source.get_cache_entry_value(index);
+    store_[index] = arena_.Create([&source_value](void* storage) {
+      return new (storage) CacheEntryValue(source_value);
+    });
+  }
+}
+
 void Cache::DisableCaching() {
   for (auto& entry : store_)
     if (entry) entry->disable_caching();
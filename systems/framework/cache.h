@@ -4,6 +4,7 @@
 Declares CacheEntryValue and Cache, which is the container for cache entry
 values. */
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <set>
@@ -18,6 +19,7 @@ values. */
 #include "drake/common/reset_on_copy.h"
 #include "drake/common/value.h"
 #include "drake/systems/framework/framework_common.h"
+#include "drake/systems/framework/object_arena.h"
 
 namespace drake {
 namespace systems {
@@ -320,7 +322,7 @@ class CacheEntryValue {
   @see needs_recomputation() */
   bool is_out_of_date() const {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
-    return (flags_ & kValueIsOutOfDate) != 0;
+    return (flags_.load(std::memory_order_acquire) & kValueIsOutOfDate) != 0;
   }
 
   /** Returns `true` if either (a) the value is out of date, or (b) caching
@@ -334,7 +336,7 @@ class CacheEntryValue {
   is frozen. */
   bool needs_recomputation() const {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
-    return flags_ != kReadyToUse;
+    return flags_.load(std::memory_order_acquire) != kReadyToUse;
   }
 
   /** (Advanced) Marks the cache entry value as up to date with respect to
@@ -355,7 +357,10 @@ class CacheEntryValue {
   good! */
   void mark_up_to_date() {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
-    flags_ &= ~kValueIsOutOfDate;
+    // The release store publishes the new value to threads that see the
+    // cleared flag (see Cache::is_thread_safe()).
+    flags_.store(flags_.load(std::memory_order_relaxed) & ~kValueIsOutOfDate,
+                 std::memory_order_release);
   }
 
   /** (Advanced) Marks the cache entry value as _out-of-date_ with respect to
@@ -369,7 +374,10 @@ class CacheEntryValue {
   If you call it in that case the corresponding value will become
   inaccessible since it would require recomputation. */
   void mark_out_of_date() {
-    flags_ |= kValueIsOutOfDate;
+    // Invalidation never runs concurrently with evaluation, so this need not
+    // be an atomic read-modify-write (which would slow down invalidation).
+    flags_.store(flags_.load(std::memory_order_relaxed) | kValueIsOutOfDate,
+                 std::memory_order_relaxed);
   }
 
   /** Returns the serial number of the contained value. This counts up every
@@ -431,7 +439,7 @@ class CacheEntryValue {
   cache. Once unfrozen, caching will remain disabled unless enable_caching()
   is called. */
   void disable_caching() {
-    flags_ |= kCacheEntryIsDisabled;
+    flags_.fetch_or(kCacheEntryIsDisabled);
   }
 
   /** (Advanced) Enables caching for this cache entry value if it was previously
@@ -440,14 +448,15 @@ class CacheEntryValue {
   entry is marked out of date. It is also independent of whether the cache is
   frozen; in that case caching will be enabled once the cache is unfrozen. */
   void enable_caching() {
-    flags_ &= ~kCacheEntryIsDisabled;
+    flags_.fetch_and(~kCacheEntryIsDisabled);
   }
 
   /** (Advanced) Returns `true` if caching is disabled for this cache entry.
   This is independent of the `out_of_date` flag, and independent of whether
   the cache is currently frozen. */
   bool is_cache_entry_disabled() const {
-    return (flags_ & kCacheEntryIsDisabled) != 0;
+    return (flags_.load(std::memory_order_relaxed) &
+            kCacheEntryIsDisabled) != 0;
   }
   //@}
 
@@ -465,6 +474,37 @@ class CacheEntryValue {
     static never_destroyed<CacheEntryValue> dummy;
     return dummy.access();
   }
+
+  // (Internal use only) For thread-safe caching (see Cache::is_thread_safe()),
+  // attempts to claim this value for recomputation by the calling thread.
+  // Returns false without claiming it if the value is up to date or another
+  // thread has already claimed it. A successful claim must be followed by
+  // a call to release_after_update().
+  bool try_claim_for_update() {
+    int flags = flags_.load(std::memory_order_acquire);
+    while (flags != kReadyToUse && (flags & kValueIsBeingUpdated) == 0) {
+      if (flags_.compare_exchange_weak(flags, flags | kValueIsBeingUpdated,
+                                       std::memory_order_acquire)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // (Internal use only) Releases the claim made by try_claim_for_update(),
+  // marking the value up to date if `is_up_to_date` is true (that is, if the
+  // recomputation succeeded). Threads waiting for the value see the result.
+  void release_after_update(bool is_up_to_date) {
+    int flags = flags_.load(std::memory_order_relaxed) & ~kValueIsBeingUpdated;
+    if (is_up_to_date) flags &= ~kValueIsOutOfDate;
+    flags_.store(flags, std::memory_order_release);
+  }
+
+  // (Internal use only) Returns true if another thread has claimed this value
+  // for recomputation and has not yet released it.
+  bool is_being_updated() const {
+    return (flags_.load(std::memory_order_acquire) & kValueIsBeingUpdated) != 0;
+  }
 #endif
 
  private:
@@ -504,8 +544,16 @@ class CacheEntryValue {
   }
 
   // Copy constructor is private because it requires post-copy cleanup via
-  // set_owning_subcontext().
-  CacheEntryValue(const CacheEntryValue&) = default;
+  // set_owning_subcontext(). The flags are atomic, so we can't use the default.
+  CacheEntryValue(const CacheEntryValue& source)
+      : cache_index_(source.cache_index_),
+        ticket_(source.ticket_),
+        description_(source.description_),
+        owning_subcontext_(source.owning_subcontext_),
+        value_(source.value_),
+        serial_number_(source.serial_number_),
+        flags_(source.flags_.load(std::memory_order_relaxed) &
+               ~kValueIsBeingUpdated) {}
 
   // This is the post-copy cleanup method.
   void set_owning_subcontext(
@@ -600,10 +648,13 @@ class CacheEntryValue {
   // The sense of these flag bits is chosen so that Eval() can check in a single
   // instruction whether it must recalculate. Only if flags==0 (kReadyToUse) can
   // we reuse the existing value. See needs_recomputation() above.
+  // The kValueIsBeingUpdated bit is used only for thread-safe caching, and
+  // is only ever set along with kValueIsOutOfDate.
   enum Flags : int {
-    kReadyToUse           = 0b00,
-    kValueIsOutOfDate     = 0b01,
-    kCacheEntryIsDisabled = 0b10
+    kReadyToUse           = 0b000,
+    kValueIsOutOfDate     = 0b001,
+    kCacheEntryIsDisabled = 0b010,
+    kValueIsBeingUpdated  = 0b100
   };
 
   // The index for this CacheEntryValue within its containing subcontext.
@@ -627,7 +678,7 @@ class CacheEntryValue {
   // 0 on construction but is always >= 1 once we get an initial value.
   copyable_unique_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
-  int flags_{kValueIsOutOfDate};
+  std::atomic<int> flags_{kValueIsOutOfDate};
 };
 
 //==============================================================================
@@ -750,6 +801,26 @@ class Cache {
   @see ContextBase::is_cache_frozen() for the user-facing API */
   bool is_cache_frozen() const { return is_cache_frozen_; }
 
+  /** (Advanced) Sets the "is thread safe" flag. While it is set, concurrent
+  Eval() calls for the same cache entry compute its value only once: one
+  thread recomputes an out-of-date value while the others wait for it, and
+  readers of an up-to-date value take no locks.
+  @see ContextBase::EnableThreadSafeCaching() for the user-facing API */
+  void enable_thread_safe_caching() {
+    is_thread_safe_ = true;
+  }
+
+  /** (Advanced) Clears the "is thread safe" flag, restoring single-threaded
+  cache evaluation.
+  @see ContextBase::DisableThreadSafeCaching() for the user-facing API */
+  void disable_thread_safe_caching() {
+    is_thread_safe_ = false;
+  }
+
+  /** (Advanced) Reports the current value of the "is thread safe" flag.
+  @see ContextBase::is_cache_thread_safe() for the user-facing API */
+  bool is_thread_safe() const { return is_thread_safe_; }
+
  private:
   // So ContextBase and no one else can copy a Cache.
   friend class ContextBase;
@@ -759,7 +830,7 @@ class Cache {
   // must be set properly using RepairCachePointers() once the new subcontext is
   // available. This should only be invoked by ContextBase code as part of
   // copying an entire Context tree.
-  Cache(const Cache& source) = default;
+  Cache(const Cache& source);
 
   // Assumes `this` %Cache is a recent copy that does not yet have its pointers
   // to the system name-providing service of the new owning Context, and sets
@@ -773,11 +844,18 @@ class Cache {
   reset_on_copy<const internal::ContextMessageInterface*>
       owning_subcontext_;
 
-  // All CacheEntryValue objects, indexed by CacheIndex.
-  std::vector<copyable_unique_ptr<CacheEntryValue>> store_;
+  // Owns all the CacheEntryValue objects, allocated in blocks.
+  internal::ObjectArena<CacheEntryValue> arena_;
+
+  // Pointers to the CacheEntryValue objects in arena_, indexed by CacheIndex.
+  // Null for unused indices.
+  std::vector<CacheEntryValue*> store_;
 
   // Whether we are currently preventing mutable access to the cache.
   bool is_cache_frozen_{false};
+
+  // Whether Eval() must coordinate concurrent evaluations of an entry.
+  bool is_thread_safe_{false};
 };
 
 }  // namespace systems
@@ -2,6 +2,7 @@
 
 #include <exception>
 #include <memory>
+#include <thread>
 #include <typeinfo>
 
 #include "drake/common/drake_assert.h"
@@ -52,6 +53,30 @@ void CacheEntry::Calc(const ContextBase& context,
   calc_function_(context, value);
 }
 
+void CacheEntry::UpdateValueThreadSafe(const ContextBase& context,
+                                       CacheEntryValue* cache_value) const {
+  if (cache_value->is_cache_entry_disabled()) {
+    throw std::logic_error(
+        FormatName("Eval") +
+        "caching can't be disabled while thread-safe caching is enabled.");
+  }
+  while (!cache_value->try_claim_for_update()) {
+    // Another thread may be computing the value; wait for it to finish. If it
+    // failed (threw), the value is still out of date and we try again.
+    while (cache_value->is_being_updated()) std::this_thread::yield();
+    if (!cache_value->needs_recomputation()) return;
+  }
+  try {
+    AbstractValue& value = cache_value->GetMutableAbstractValueOrThrow();
+    Calc(context, &value);
+  } catch (...) {
+    // The value remains out of date, as for single-threaded evaluation.
+    cache_value->release_after_update(false);
+    throw;
+  }
+  cache_value->release_after_update(true);
+}
+
 void CacheEntry::CheckValidAbstractValue(const ContextBase& context,
                                          const AbstractValue& proposed) const {
   const CacheEntryValue& cache_value = get_cache_entry_value(context);
@@ -310,12 +310,22 @@ class CacheEntry {
     // We can get a mutable cache entry value from a const context.
     CacheEntryValue& mutable_cache_value =
         get_mutable_cache_entry_value(context);
+    if (context.get_cache().is_thread_safe()) {
+      UpdateValueThreadSafe(context, &mutable_cache_value);
+      return;
+    }
     AbstractValue& value = mutable_cache_value.GetMutableAbstractValueOrThrow();
     // If Calc() throws a recoverable exception, the cache remains out of date.
     Calc(context, &value);
     mutable_cache_value.mark_up_to_date();
   }
 
+  // The thread-safe version of UpdateValue(), for a Context with thread-safe
+  // caching enabled. Exactly one of the threads that find the value in need
+  // of recomputation computes it; the others wait for that to finish.
+  void UpdateValueThreadSafe(const ContextBase& context,
+                             CacheEntryValue* cache_value) const;
+
   // The value was unexpectedly out of date. Issue a helpful message.
   void ThrowOutOfDate(const char* api) const {
     throw std::logic_error(FormatName(api) + "value out of date.");
@@ -116,6 +116,36 @@ class ContextBase : public internal::ContextMessageInterface {
     return get_cache().is_cache_frozen();
   }
 
+  /** (Advanced) Makes cache entry evaluation safe for concurrent use by
+  several threads, recursively for this %Context and all its subcontexts. Then
+  multiple threads may call `Eval()` methods (e.g., evaluate output ports) on
+  this same %Context: an out-of-date value is computed by only one of them
+  while the others wait for it, and an up-to-date value is shared with no
+  locking or recomputation. This mode adds a small cost to recomputations, so
+  it is off by default. It does _not_ make modification of the %Context
+  thread safe; no thread may change the %Context while others are evaluating
+  it. Caching must not be disabled for any entry that is evaluated
+  concurrently (see DisableCaching()); that causes the evaluation to throw.
+  Like FreezeCache(), this is _not_ applied to the parent or siblings so it
+  is most useful when called on the root %Context. */
+  void EnableThreadSafeCaching() const {
+    PropagateCachingChange(*this, &Cache::enable_thread_safe_caching);
+  }
+
+  /** (Advanced) Restores the default, single-threaded cache evaluation
+  recursively for this %Context and all its subcontexts. See
+  EnableThreadSafeCaching(). */
+  void DisableThreadSafeCaching() const {
+    PropagateCachingChange(*this, &Cache::disable_thread_safe_caching);
+  }
+
+  /** (Advanced) Reports whether this %Context's cache entries may be
+  evaluated concurrently. This checks only locally. See
+  EnableThreadSafeCaching(). */
+  bool is_cache_thread_safe() const {
+    return get_cache().is_thread_safe();
+  }
+
   /** Returns the local name of the subsystem for which this is the Context.
   This is intended primarily for error messages and logging.
   @see SystemBase::GetSystemName() for details.
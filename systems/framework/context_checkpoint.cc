@@ -0,0 +1,269 @@
+#include "drake/systems/framework/context_checkpoint.h"
+
+#include <optional>
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Identifies the checkpoint format, "DKCP" followed by its version.
+constexpr uint32_t kMagic = 0x50434b44;
+constexpr uint32_t kVersion = 1;
+
+// Returns the codec for `value`.
+const AbstractValueCodecs::Codec& FindCodec(
+    const AbstractValue& value, const AbstractValueCodecs* codecs) {
+  const AbstractValueCodecs::Codec* codec =
+      codecs != nullptr ? codecs->Find(value.type_info()) : nullptr;
+  if (codec == nullptr) {
+    throw std::logic_error(fmt::format(
+        "Context checkpoint: there is no codec for the abstract value type {}",
+        value.GetNiceTypeName()));
+  }
+  return *codec;
+}
+
+// Appends the binary encoding of the values to a checkpoint.
+class Writer {
+ public:
+  explicit Writer(std::vector<uint8_t>* bytes) : bytes_(bytes) {}
+
+  template <typename Scalar>
+  void WriteScalar(const Scalar& value) {
+    static_assert(std::is_trivially_copyable_v<Scalar>);
+    const auto* data = reinterpret_cast<const uint8_t*>(&value);
+    bytes_->insert(bytes_->end(), data, data + sizeof(Scalar));
+  }
+
+  void WriteVector(const VectorBase<double>& vector) {
+    const int size = vector.size();
+    WriteScalar<int64_t>(size);
+    if (const auto* basic = dynamic_cast<const BasicVector<double>*>(&vector)) {
+      const auto* data = reinterpret_cast<const uint8_t*>(
+          basic->get_value().data());
+      bytes_->insert(bytes_->end(), data, data + size * sizeof(double));
+    } else {
+      for (int i = 0; i < size; ++i) WriteScalar<double>(vector[i]);
+    }
+  }
+
+  void WriteAbstractValue(const AbstractValue& value,
+                          const AbstractValueCodecs* codecs) {
+    const AbstractValueCodecs::Codec& codec = FindCodec(value, codecs);
+    // Reserves the size of the encoding, to be filled in once known.
+    const size_t size_offset = bytes_->size();
+    WriteScalar<int64_t>(0);
+    codec.encode(value, bytes_);
+    const int64_t size = bytes_->size() - size_offset - sizeof(int64_t);
+    std::memcpy(bytes_->data() + size_offset, &size, sizeof(int64_t));
+  }
+
+ private:
+  std::vector<uint8_t>* const bytes_;
+};
+
+// Reads the values of a checkpoint in the order they were written. The
+// vectors and abstract values are only set when given a (non-null) target.
+class Reader {
+ public:
+  explicit Reader(const std::vector<uint8_t>& bytes) : bytes_(bytes) {}
+
+  template <typename Scalar>
+  Scalar ReadScalar() {
+    static_assert(std::is_trivially_copyable_v<Scalar>);
+    Scalar value;
+    std::memcpy(&value, Consume(sizeof(Scalar)), sizeof(Scalar));
+    return value;
+  }
+
+  void ReadVector(const char* description, const VectorBase<double>& expected,
+                  VectorBase<double>* vector) {
+    const int size = expected.size();
+    ReadSize(description, size);
+    const uint8_t* data = Consume(size * sizeof(double));
+    if (vector == nullptr) return;
+    if (auto* basic = dynamic_cast<BasicVector<double>*>(vector)) {
+      std::memcpy(basic->get_mutable_value().data(), data,
+                  size * sizeof(double));
+    } else {
+      for (int i = 0; i < size; ++i) {
+        std::memcpy(&(*vector)[i], data + i * sizeof(double), sizeof(double));
+      }
+    }
+  }
+
+  void ReadAbstractValue(const AbstractValue& expected,
+                         const AbstractValueCodecs* codecs,
+                         AbstractValue* value) {
+    const AbstractValueCodecs::Codec& codec = FindCodec(expected, codecs);
+    const int64_t size = ReadScalar<int64_t>();
+    const uint8_t* data = Consume(size);
+    if (value != nullptr) codec.decode(data, size, value);
+  }
+
+  // Reads a size or a count, which must match the `expected` one.
+  void ReadSize(const char* description, int expected) {
+    const int64_t size = ReadScalar<int64_t>();
+    if (size != expected) {
+      throw std::runtime_error(fmt::format(
+          "RestoreContextCheckpoint(): the checkpoint has {} {} but the "
+          "context has {}", size, description, expected));
+    }
+  }
+
+  void ThrowUnlessDone() const {
+    if (offset_ != bytes_.size()) {
+      throw std::runtime_error(fmt::format(
+          "RestoreContextCheckpoint(): the checkpoint has {} unexpected "
+          "trailing bytes", bytes_.size() - offset_));
+    }
+  }
+
+ private:
+  const uint8_t* Consume(int64_t size) {
+    if (size < 0 || size > static_cast<int64_t>(bytes_.size() - offset_)) {
+      throw std::runtime_error(
+          "RestoreContextCheckpoint(): the checkpoint is truncated");
+    }
+    const uint8_t* data = bytes_.data() + offset_;
+    offset_ += size;
+    return data;
+  }
+
+  const std::vector<uint8_t>& bytes_;
+  size_t offset_{0};
+};
+
+// Reads the whole checkpoint in `reader`, and sets the values of `context`
+// unless it is null. The dimensions are those of `expected`, which is the same
+// context as `context` (if any).
+void ReadCheckpoint(const Context<double>& expected,
+                    const AbstractValueCodecs* codecs, Reader* reader,
+                    Context<double>* context) {
+  if (reader->ReadScalar<uint32_t>() != kMagic) {
+    throw std::runtime_error(
+        "RestoreContextCheckpoint(): the data is not a context checkpoint");
+  }
+  const uint32_t version = reader->ReadScalar<uint32_t>();
+  if (version != kVersion) {
+    throw std::runtime_error(fmt::format(
+        "RestoreContextCheckpoint(): unsupported checkpoint version {}",
+        version));
+  }
+  const double time = reader->ReadScalar<double>();
+  const bool has_accuracy = reader->ReadScalar<uint8_t>() != 0;
+  const double accuracy = reader->ReadScalar<double>();
+
+  State<double>* state =
+      context != nullptr ? &context->get_mutable_state() : nullptr;
+  reader->ReadVector(
+      "continuous states", expected.get_continuous_state_vector(),
+      state != nullptr
+          ? &state->get_mutable_continuous_state().get_mutable_vector()
+          : nullptr);
+
+  const DiscreteValues<double>& xd = expected.get_discrete_state();
+  reader->ReadSize("discrete state groups", xd.num_groups());
+  for (int i = 0; i < xd.num_groups(); ++i) {
+    reader->ReadVector(
+        "discrete states", xd.get_vector(i),
+        state != nullptr
+            ? &state->get_mutable_discrete_state().get_mutable_vector(i)
+            : nullptr);
+  }
+
+  const AbstractValues& xa = expected.get_abstract_state();
+  reader->ReadSize("abstract states", xa.size());
+  for (int i = 0; i < xa.size(); ++i) {
+    reader->ReadAbstractValue(
+        xa.get_value(i), codecs,
+        state != nullptr
+            ? &state->get_mutable_abstract_state().get_mutable_value(i)
+            : nullptr);
+  }
+
+  const Parameters<double>& p = expected.get_parameters();
+  Parameters<double>* parameters =
+      context != nullptr ? &context->get_mutable_parameters() : nullptr;
+  reader->ReadSize("numeric parameter groups",
+                   p.num_numeric_parameter_groups());
+  for (int i = 0; i < p.num_numeric_parameter_groups(); ++i) {
+    reader->ReadVector(
+        "numeric parameters", p.get_numeric_parameter(i),
+        parameters != nullptr ? &parameters->get_mutable_numeric_parameter(i)
+                              : nullptr);
+  }
+  reader->ReadSize("abstract parameters", p.num_abstract_parameters());
+  for (int i = 0; i < p.num_abstract_parameters(); ++i) {
+    reader->ReadAbstractValue(
+        p.get_abstract_parameter(i), codecs,
+        parameters != nullptr ? &parameters->get_mutable_abstract_parameter(i)
+                              : nullptr);
+  }
+  reader->ThrowUnlessDone();
+
+  if (context != nullptr) {
+    context->SetTime(time);
+    context->SetAccuracy(has_accuracy ? std::optional<double>(accuracy)
+                                      : std::nullopt);
+  }
+}
+
+}  // namespace
+
+void SaveContextCheckpoint(const Context<double>& context,
+                           std::vector<uint8_t>* checkpoint,
+                           const AbstractValueCodecs* codecs) {
+  DRAKE_THROW_UNLESS(checkpoint != nullptr);
+  checkpoint->clear();
+  Writer writer(checkpoint);
+  writer.WriteScalar(kMagic);
+  writer.WriteScalar(kVersion);
+  writer.WriteScalar(context.get_time());
+  const std::optional<double>& accuracy = context.get_accuracy();
+  writer.WriteScalar<uint8_t>(accuracy.has_value());
+  writer.WriteScalar(accuracy.value_or(0.0));
+
+  writer.WriteVector(context.get_continuous_state_vector());
+  const DiscreteValues<double>& xd = context.get_discrete_state();
+  writer.WriteScalar<int64_t>(xd.num_groups());
+  for (int i = 0; i < xd.num_groups(); ++i) {
+    writer.WriteVector(xd.get_vector(i));
+  }
+  const AbstractValues& xa = context.get_abstract_state();
+  writer.WriteScalar<int64_t>(xa.size());
+  for (int i = 0; i < xa.size(); ++i) {
+    writer.WriteAbstractValue(xa.get_value(i), codecs);
+  }
+
+  const Parameters<double>& p = context.get_parameters();
+  writer.WriteScalar<int64_t>(p.num_numeric_parameter_groups());
+  for (int i = 0; i < p.num_numeric_parameter_groups(); ++i) {
+    writer.WriteVector(p.get_numeric_parameter(i));
+  }
+  writer.WriteScalar<int64_t>(p.num_abstract_parameters());
+  for (int i = 0; i < p.num_abstract_parameters(); ++i) {
+    writer.WriteAbstractValue(p.get_abstract_parameter(i), codecs);
+  }
+}
+
+void RestoreContextCheckpoint(const std::vector<uint8_t>& checkpoint,
+                              Context<double>* context,
+                              const AbstractValueCodecs* codecs) {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  if (!context->is_root_context()) {
+    throw std::logic_error(
+        "RestoreContextCheckpoint(): the context must be a root context");
+  }
+  // Checks the whole checkpoint before modifying the context, so that a
+  // mismatched checkpoint leaves the context unchanged.
+  {
+    Reader reader(checkpoint);
+    ReadCheckpoint(*context, codecs, &reader, nullptr);
+  }
+  Reader reader(checkpoint);
+  ReadCheckpoint(*context, codecs, &reader, context);
+}
+
+}  // namespace systems
+}  // namespace drake
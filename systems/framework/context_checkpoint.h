@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/common/value.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/// A set of binary encodings of abstract values, one per value type, for use
+/// with context checkpoints (see SaveContextCheckpoint()). Numeric values are
+/// always checkpointed, but abstract state and abstract parameters can only be
+/// checkpointed when a codec for their type has been added.
+class AbstractValueCodecs {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(AbstractValueCodecs)
+
+  /// Appends the encoding of an abstract value to `bytes`.
+  using Encoder =
+      std::function<void(const AbstractValue& value,
+                         std::vector<uint8_t>* bytes)>;
+
+  /// Sets an (existing) abstract value from the `size` bytes starting at
+  /// `data`, as written by the corresponding Encoder.
+  using Decoder =
+      std::function<void(const uint8_t* data, int size, AbstractValue* value)>;
+
+  /// The encoder and decoder for one value type.
+  struct Codec {
+    Encoder encode;
+    Decoder decode;
+  };
+
+  AbstractValueCodecs() = default;
+
+  /// Adds the codec for values of type `ValueType`: `encode` appends the
+  /// encoding of a value to the given bytes, and `decode` sets a value from
+  /// the given bytes.
+  /// @throws std::logic_error if there is already a codec for `ValueType`.
+  template <typename ValueType>
+  void Add(
+      std::function<void(const ValueType&, std::vector<uint8_t>*)> encode,
+      std::function<void(const uint8_t*, int, ValueType*)> decode) {
+    DRAKE_THROW_UNLESS(encode != nullptr);
+    DRAKE_THROW_UNLESS(decode != nullptr);
+    Codec codec{
+        [encode](const AbstractValue& value, std::vector<uint8_t>* bytes) {
+          encode(value.get_value<ValueType>(), bytes);
+        },
+        [decode](const uint8_t* data, int size, AbstractValue* value) {
+          decode(data, size, &value->get_mutable_value<ValueType>());
+        }};
+    if (!codecs_.emplace(typeid(ValueType), std::move(codec)).second) {
+      throw std::logic_error(fmt::format(
+          "AbstractValueCodecs: there is already a codec for {}",
+          NiceTypeName::Get<ValueType>()));
+    }
+  }
+
+  /// Adds a codec for values of type `ValueType` that copies their bytes.
+  /// @tparam ValueType must be trivially copyable.
+  /// @throws std::logic_error if there is already a codec for `ValueType`.
+  template <typename ValueType>
+  void AddTriviallyCopyable() {
+    static_assert(std::is_trivially_copyable_v<ValueType>,
+                  "ValueType must be trivially copyable");
+    Add<ValueType>(
+        [](const ValueType& value, std::vector<uint8_t>* bytes) {
+          const auto* data = reinterpret_cast<const uint8_t*>(&value);
+          bytes->insert(bytes->end(), data, data + sizeof(ValueType));
+        },
+        [](const uint8_t* data, int size, ValueType* value) {
+          if (size != static_cast<int>(sizeof(ValueType))) {
+            throw std::runtime_error(fmt::format(
+                "AbstractValueCodecs: expected {} bytes for {} but got {}",
+                sizeof(ValueType), NiceTypeName::Get<ValueType>(), size));
+          }
+          std::memcpy(value, data, sizeof(ValueType));
+        });
+  }
+
+  /// Returns the codec for abstract values holding a `type`, or nullptr if
+  /// there is none.
+  const Codec* Find(const std::type_info& type) const {
+    auto iter = codecs_.find(type);
+    return iter != codecs_.end() ? &iter->second : nullptr;
+  }
+
+ private:
+  std::unordered_map<std::type_index, Codec> codecs_;
+};
+
+/// Writes a checkpoint of `context` into `checkpoint`, as a compact binary
+/// encoding of its time, accuracy, state (continuous, discrete and abstract)
+/// and parameters (numeric and abstract). As with
+/// Context::SetTimeStateAndParametersFrom(), fixed input port values are not
+/// included. The previous contents of `checkpoint` are replaced but its
+/// capacity is reused, so that taking repeated checkpoints into the same
+/// buffer does not allocate memory once the buffer is large enough.
+///
+/// Numeric values are stored in the byte order of the host, so checkpoints
+/// are meant to be restored on the same platform, into a context of the same
+/// System (see RestoreContextCheckpoint()).
+///
+/// @param codecs Encodes the abstract state and abstract parameters; may be
+///   nullptr if `context` has none.
+/// @throws std::logic_error if `context` has an abstract value that does not
+///   have a codec in `codecs`.
+void SaveContextCheckpoint(const Context<double>& context,
+                           std::vector<uint8_t>* checkpoint,
+                           const AbstractValueCodecs* codecs = nullptr);
+
+/// Restores the time, accuracy, state and parameters of `context` from a
+/// `checkpoint` written by SaveContextCheckpoint(), which must have been taken
+/// from a context of the same System. The values are written in place into
+/// the existing state and parameters of `context`, without any memory
+/// allocation for the numeric values, which makes it cheap to fork many
+/// rollouts from a checkpoint. Sends out of date notifications for all
+/// dependent computations in `context`, as does
+/// Context::SetTimeStateAndParametersFrom().
+///
+/// @param codecs Decodes the abstract state and abstract parameters; may be
+///   nullptr if `context` has none.
+/// @throws std::logic_error if `context` is not a root context, or if it has
+///   an abstract value that does not have a codec in `codecs`.
+/// @throws std::runtime_error if `checkpoint` is malformed or its dimensions
+///   do not match `context`. In that case, `context` may have been partially
+///   restored.
+void RestoreContextCheckpoint(const std::vector<uint8_t>& checkpoint,
+                              Context<double>* context,
+                              const AbstractValueCodecs* codecs = nullptr);
+
+}  // namespace systems
+}  // namespace drake
@@ -6,6 +6,7 @@ trackers. */
 
 #include <cstdint>
 #include <memory>
+#include <new>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -16,6 +17,7 @@ trackers. */
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/cache.h"
 #include "drake/systems/framework/framework_common.h"
+#include "drake/systems/framework/object_arena.h"
 
 namespace drake {
 namespace systems {
@@ -333,13 +335,13 @@ class DependencyTracker {
             : "");
   }
 
-  // Copies the current tracker but with all pointers set to null, and all
-  // counters reset to their default-constructed values (0 for statistics, an
-  // unmatchable value for the last change event).
-  std::unique_ptr<DependencyTracker> CloneWithoutPointers() const {
-    // Can't use make_unique here because constructor is private.
-    std::unique_ptr<DependencyTracker> clone(
-        new DependencyTracker(ticket(), description(), nullptr, nullptr));
+  // Copies the current tracker into the given uninitialized storage but with
+  // all pointers set to null, and all counters reset to their
+  // default-constructed values (0 for statistics, an unmatchable value for the
+  // last change event).
+  DependencyTracker* CloneWithoutPointers(void* storage) const {
+    DependencyTracker* clone = new (storage)
+        DependencyTracker(ticket(), description(), nullptr, nullptr);
     clone->has_associated_cache_entry_ = has_associated_cache_entry_;
     // The constructor sets cache_value_ to dummy by default, but that's wrong
     // if there is an associated cache entry. In that case we'll set it later.
@@ -477,9 +479,11 @@ class DependencyGraph {
       CacheEntryValue* cache_value = nullptr) {
     DRAKE_DEMAND(!has_tracker(known_ticket));
     if (known_ticket >= trackers_size()) graph_.resize(known_ticket + 1);
-    // Can't use make_unique here because constructor is private.
-    graph_[known_ticket].reset(new DependencyTracker(
-        known_ticket, std::move(description), owning_subcontext_, cache_value));
+    graph_[known_ticket] = arena_.Create([&](void* storage) {
+      return new (storage) DependencyTracker(
+          known_ticket, std::move(description), owning_subcontext_,
+          cache_value);
+    });
     return *graph_[known_ticket];
   }
 
@@ -532,13 +536,15 @@ class DependencyGraph {
   tree.
   @see AppendToTrackerPointerMap(), RepairTrackerPointers() */
   DependencyGraph(const DependencyGraph& source) {
-    graph_.reserve(source.trackers_size());
+    graph_.resize(source.trackers_size(), nullptr);
+    arena_.Reserve(source.arena_.size());
     for (DependencyTicket ticket(0); ticket < source.trackers_size();
          ++ticket) {
-      graph_.emplace_back(
-          source.has_tracker(ticket)
-              ? source.get_tracker(ticket).CloneWithoutPointers()
-              : nullptr);
+      if (!source.has_tracker(ticket)) continue;
+      const DependencyTracker& source_tracker = source.get_tracker(ticket);
+      graph_[ticket] = arena_.Create([&source_tracker](void* storage) {
+        return source_tracker.CloneWithoutPointers(storage);
+      });
     }
   }
 
@@ -569,8 +575,13 @@ class DependencyGraph {
   // The system name service of the subcontext that owns this subgraph.
   const internal::ContextMessageInterface* owning_subcontext_{};
 
-  // All value trackers, indexed by DependencyTicket.
-  std::vector<std::unique_ptr<DependencyTracker>> graph_;
+  // Owns all the value trackers. Allocating them in blocks, rather than one at
+  // a time, keeps Context construction and cloning cheap.
+  internal::ObjectArena<DependencyTracker> arena_;
+
+  // Pointers to the trackers in arena_, indexed by DependencyTicket. Null for
+  // unused tickets.
+  std::vector<DependencyTracker*> graph_;
 };
 
 }  // namespace systems
@@ -1,10 +1,12 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <algorithm>
 #include <limits>
 #include <set>
 #include <stdexcept>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/subvector.h"
 #include "drake/systems/framework/system_constraint.h"
@@ -68,6 +70,24 @@ std::multimap<int, int> Diagram<T>::GetDirectFeedthroughs() const {
   return pairs;
 }
 
+template <typename T>
+void Diagram<T>::set_num_evaluation_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  num_evaluation_threads_ = num_threads;
+  derivatives_subsystems_.clear();
+  derivatives_plan_ = {};
+  if (num_threads == 1) return;
+
+  std::vector<bool> is_target(num_subsystems(), false);
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    if (registered_systems_[i]->num_continuous_states() > 0) {
+      is_target[i] = true;
+      derivatives_subsystems_.push_back(i);
+    }
+  }
+  derivatives_plan_ = MakeEvaluationPlan(is_target);
+}
+
 template <typename T>
 std::unique_ptr<CompositeEventCollection<T>>
 Diagram<T>::AllocateCompositeEventCollection() const {
@@ -276,12 +296,31 @@ void Diagram<T>::DoCalcTimeDerivatives(const Context<T>& context,
   const int n = diagram_derivatives->num_substates();
   DRAKE_DEMAND(num_subsystems() == n);
 
-  // Evaluate the derivatives of each constituent system.
-  for (SubsystemIndex i(0); i < n; ++i) {
+  auto calc_derivatives = [this, diagram_context,
+                           diagram_derivatives](SubsystemIndex i) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     ContinuousState<T>& subderivatives =
         diagram_derivatives->get_mutable_substate(i);
     registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
+  };
+
+  if (num_evaluation_threads_ > 1) {
+    // Bring the inputs of the subsystems with continuous state up to date,
+    // then compute their derivatives concurrently. The (empty) derivatives
+    // of the remaining subsystems are computed on this thread.
+    EvaluatePlan(derivatives_plan_, *diagram_context);
+    ForEachSubsystemInParallel(derivatives_subsystems_, calc_derivatives);
+    for (SubsystemIndex i(0); i < n; ++i) {
+      if (registered_systems_[i]->num_continuous_states() == 0) {
+        calc_derivatives(i);
+      }
+    }
+    return;
+  }
+
+  // Evaluate the derivatives of each constituent system.
+  for (SubsystemIndex i(0); i < n; ++i) {
+    calc_derivatives(i);
   }
 }
 
@@ -831,8 +870,13 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
 
   *next_update_time = std::numeric_limits<double>::infinity();
 
-  // Iterate over the subsystems, and harvest the most imminent updates.
-  std::vector<T> times(num_subsystems());
+  // Iterate over the subsystems, and harvest the most imminent updates. The
+  // event collections of subsystems whose next update time is bigger than
+  // next_update_time are cleared as we go, so that no temporary storage is
+  // needed. Invariant: every collection in [0, i) that has not been cleared
+  // belongs to a subsystem in [first_kept, i) that updates at
+  // next_update_time.
+  SubsystemIndex first_kept(0);
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     CompositeEventCollection<T>& subinfo =
@@ -840,19 +884,16 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
 
     const T sub_time =
         registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
-    times[i] = sub_time;
 
     if (sub_time < *next_update_time) {
       *next_update_time = sub_time;
+      for (SubsystemIndex j = first_kept; j < i; ++j)
+        info->get_mutable_subevent_collection(j).Clear();
+      first_kept = i;
+    } else if (sub_time > *next_update_time) {
+      subinfo.Clear();
     }
   }
-
-  // For all the subsystems whose next update time is bigger than
-  // next_update_time, clear their event collections.
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    if (times[i] > *next_update_time)
-      info->get_mutable_subevent_collection(i).Clear();
-  }
 }
 
 template <typename T>
@@ -1082,19 +1123,38 @@ void Diagram<T>::DispatchDiscreteVariableUpdateHandler(
       dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
           events);
 
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+  auto calc_updates = [this, diagram_context, diagram_discrete,
+                       &diagram_events](SubsystemIndex i) {
     const EventCollection<DiscreteUpdateEvent<T>>& subevents =
         diagram_events.get_subevent_collection(i);
+    const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+    DiscreteValues<T>& subdiscrete =
+        diagram_discrete->get_mutable_subdiscrete(i);
 
-    if (subevents.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      DiscreteValues<T>& subdiscrete =
-          diagram_discrete->get_mutable_subdiscrete(i);
+    registered_systems_[i]->CalcDiscreteVariableUpdates(
+        subcontext, subevents, &subdiscrete);
+  };
 
-      registered_systems_[i]->CalcDiscreteVariableUpdates(
-          subcontext, subevents, &subdiscrete);
+  std::vector<SubsystemIndex> updated_subsystems;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    if (diagram_events.get_subevent_collection(i).HasEvents()) {
+      updated_subsystems.push_back(i);
     }
   }
+
+  if (num_evaluation_threads_ > 1 && updated_subsystems.size() > 1) {
+    // Which subsystems have events changes from one update to the next, so
+    // the plan is made anew each time.
+    std::vector<bool> is_target(num_subsystems(), false);
+    for (SubsystemIndex i : updated_subsystems) is_target[i] = true;
+    EvaluatePlan(MakeEvaluationPlan(is_target), *diagram_context);
+    ForEachSubsystemInParallel(updated_subsystems, calc_updates);
+    return;
+  }
+
+  for (SubsystemIndex i : updated_subsystems) {
+    calc_updates(i);
+  }
 }
 
 template <typename T>
@@ -1530,6 +1590,111 @@ int Diagram<T>::num_subsystems() const {
   return static_cast<int>(registered_systems_.size());
 }
 
+template <typename T>
+typename Diagram<T>::EvaluationPlan Diagram<T>::MakeEvaluationPlan(
+    const std::vector<bool>& is_target) const {
+  DRAKE_DEMAND(static_cast<int>(is_target.size()) == num_subsystems());
+
+  // The wave of an output port is one more than the latest wave of the
+  // output ports feeding the input ports on which it has direct feedthrough.
+  // The absence of algebraic loops guarantees that this recursion ends.
+  std::map<OutputPortLocator, int> wave_of_output;
+  std::set<InputPortIndex> diagram_inputs;
+  std::function<int(const OutputPortLocator&)> visit_output;
+  // Returns the wave of the output port feeding `input`, or -1 if no
+  // subsystem output port feeds it.
+  auto visit_input = [this, &visit_output,
+                      &diagram_inputs](const InputPortLocator& input) {
+    const auto upstream_it = connection_map_.find(input);
+    if (upstream_it != connection_map_.end()) {
+      return visit_output(upstream_it->second);
+    }
+    const auto external_it =
+        std::find(input_port_ids_.begin(), input_port_ids_.end(), input);
+    if (external_it != input_port_ids_.end()) {
+      diagram_inputs.insert(
+          InputPortIndex(external_it - input_port_ids_.begin()));
+    }
+    return -1;
+  };
+  visit_output = [&visit_input,
+                  &wave_of_output](const OutputPortLocator& output) {
+    const auto it = wave_of_output.find(output);
+    if (it != wave_of_output.end()) return it->second;
+    const System<T>* const system = output.first;
+    int wave = 0;
+    for (InputPortIndex q(0); q < system->num_input_ports(); ++q) {
+      if (system->HasDirectFeedthrough(q, output.second)) {
+        wave = std::max(wave, visit_input(InputPortLocator{system, q}) + 1);
+      }
+    }
+    wave_of_output[output] = wave;
+    return wave;
+  };
+
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    if (!is_target[i]) continue;
+    const System<T>* const system = registered_systems_[i].get();
+    for (InputPortIndex q(0); q < system->num_input_ports(); ++q) {
+      visit_input(InputPortLocator{system, q});
+    }
+  }
+
+  // Group each wave's output ports by subsystem, since output ports of the
+  // same subsystem may share cache entries and so cannot be evaluated
+  // concurrently.
+  std::vector<std::map<SubsystemIndex, std::vector<OutputPortLocator>>> waves;
+  for (const auto& [output, wave] : wave_of_output) {
+    if (wave >= static_cast<int>(waves.size())) waves.resize(wave + 1);
+    waves[wave][system_index_map_.at(output.first)].push_back(output);
+  }
+
+  EvaluationPlan plan;
+  plan.diagram_inputs.assign(diagram_inputs.begin(), diagram_inputs.end());
+  for (auto& wave : waves) {
+    std::vector<std::vector<OutputPortLocator>>& groups =
+        plan.waves.emplace_back();
+    for (auto& subsystem_outputs : wave) {
+      groups.push_back(std::move(subsystem_outputs.second));
+    }
+  }
+  return plan;
+}
+
+template <typename T>
+void Diagram<T>::EvaluatePlan(const EvaluationPlan& plan,
+                              const DiagramContext<T>& context) const {
+  // Evaluating this Diagram's input ports may evaluate the caches of the
+  // enclosing Diagram, so it is done here on the calling thread.
+  for (InputPortIndex k : plan.diagram_inputs) {
+    this->EvalAbstractInput(context, k);
+  }
+  for (const auto& groups : plan.waves) {
+    drake::internal::StaticParallelForRange(
+        static_cast<int>(groups.size()), num_evaluation_threads_,
+        [this, &groups, &context](int, int begin, int end) {
+          for (int k = begin; k < end; ++k) {
+            for (const OutputPortLocator& output : groups[k]) {
+              EvalSubsystemOutputPort(context, output);
+            }
+          }
+        });
+  }
+}
+
+template <typename T>
+void Diagram<T>::ForEachSubsystemInParallel(
+    const std::vector<SubsystemIndex>& subsystems,
+    const std::function<void(SubsystemIndex)>& calc) const {
+  drake::internal::StaticParallelForRange(
+      static_cast<int>(subsystems.size()), num_evaluation_threads_,
+      [&subsystems, &calc](int, int begin, int end) {
+        for (int k = begin; k < end; ++k) {
+          calc(subsystems[k]);
+        }
+      });
+}
+
 }  // namespace systems
 }  // namespace drake
 
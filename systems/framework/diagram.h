@@ -78,7 +78,9 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
   template <typename U>
   explicit Diagram(const Diagram<U>& other)
-      : Diagram(other.template ConvertScalarType<T>()) {}
+      : Diagram(other.template ConvertScalarType<T>()) {
+    set_num_evaluation_threads(other.num_evaluation_threads_);
+  }
 
   ~Diagram() override;
 
@@ -103,6 +105,35 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
 
   std::multimap<int, int> GetDirectFeedthroughs() const final;
 
+  /// (Advanced) Sets the number of threads used to evaluate this Diagram's
+  /// subsystems when computing time derivatives and discrete variable
+  /// updates. The default is 1, in which case the subsystems are evaluated
+  /// one after another on the calling thread.
+  ///
+  /// With more than one thread, the subsystem output ports feeding the
+  /// subsystems being updated are first evaluated in "waves", using the
+  /// Diagram's connections and the subsystems' direct-feedthrough reports to
+  /// find output ports whose prerequisites are all up to date, so that
+  /// distinct subsystems in a wave can be evaluated concurrently. Then the
+  /// subsystems' derivatives (or discrete updates) are computed concurrently.
+  /// Nested Diagrams are evaluated by their own settings.
+  ///
+  /// @warning This is only safe if every subsystem can be evaluated
+  /// concurrently with every other one: leaf systems must not share mutable
+  /// state (other than through their contexts), and caching must be enabled
+  /// in the Context, since concurrent evaluations rely on reading up-to-date
+  /// cache entries from several threads.
+  ///
+  /// Every connected input port of a subsystem being updated is evaluated,
+  /// even if the subsystem would not have evaluated it.
+  ///
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_evaluation_threads(int num_threads);
+
+  /// Returns the number of threads used to evaluate this Diagram's
+  /// subsystems. @see set_num_evaluation_threads().
+  int num_evaluation_threads() const { return num_evaluation_threads_; }
+
   /// Allocates a DiagramEventCollection for this Diagram.
   /// @sa System::AllocateCompositeEventCollection().
   std::unique_ptr<CompositeEventCollection<T>>
@@ -505,6 +536,31 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
 
   int num_subsystems() const;
 
+  // A schedule for evaluating, on multiple threads, the subsystem output
+  // ports that feed the input ports of a set of target subsystems.
+  struct EvaluationPlan {
+    // The input ports of this Diagram that feed those subsystem output ports
+    // or the targets' input ports.
+    std::vector<InputPortIndex> diagram_inputs;
+    // Each wave holds groups of output ports, one group per subsystem, whose
+    // prerequisites are all evaluated by earlier waves.
+    std::vector<std::vector<std::vector<OutputPortLocator>>> waves;
+  };
+
+  // Returns the plan for the subsystems i for which is_target[i] is true.
+  EvaluationPlan MakeEvaluationPlan(const std::vector<bool>& is_target) const;
+
+  // Evaluates the output ports of the given plan using
+  // num_evaluation_threads_ threads.
+  void EvaluatePlan(const EvaluationPlan& plan,
+                    const DiagramContext<T>& context) const;
+
+  // Calls `calc` for each given subsystem using num_evaluation_threads_
+  // threads.
+  void ForEachSubsystemInParallel(
+      const std::vector<SubsystemIndex>& subsystems,
+      const std::function<void(SubsystemIndex)>& calc) const;
+
   // A map from the input ports of constituent systems, to the output ports of
   // the systems from which they get their values.
   std::map<InputPortLocator, OutputPortLocator> connection_map_;
@@ -521,6 +577,13 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<OutputPortLocator> output_port_ids_;
 
+  // See set_num_evaluation_threads(). When it is greater than 1, the
+  // subsystems with continuous state and the plan for evaluating their
+  // inputs are computed once, and used by DoCalcTimeDerivatives().
+  int num_evaluation_threads_{1};
+  std::vector<SubsystemIndex> derivatives_subsystems_;
+  EvaluationPlan derivatives_plan_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
@@ -522,6 +522,18 @@ class Event {
     DoAddToComposite(trigger_type_, &*events);
   }
 
+  // Note: Users should not be calling this.
+  #if !defined(DRAKE_DOXYGEN_CXX)
+  // Adds `this` event itself, rather than a clone, to `events`, so `this`
+  // must outlive `events`. See LeafEventCollection::add_event_reference().
+  // Must not have an unknown trigger type.
+  void AddReferenceToComposite(CompositeEventCollection<T>* events) const {
+    DRAKE_DEMAND(events != nullptr);
+    DRAKE_DEMAND(trigger_type_ != TriggerType::kUnknown);
+    DoAddReferenceToComposite(&*events);
+  }
+  #endif
+
  protected:
   Event(const Event& other) : trigger_type_(other.trigger_type_) {
     if (other.event_data_ != nullptr)
@@ -541,6 +553,13 @@ class Event {
   virtual void DoAddToComposite(TriggerType trigger_type,
                                 CompositeEventCollection<T>* events) const = 0;
 
+  /**
+   * Derived classes must implement this to add a reference to this Event
+   * (rather than a clone) to the event collection.
+   */
+  virtual void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const = 0;
+
   /**
    * Derived classes must implement this method to clone themselves. Any
    * Event-specific data is cloned using the Clone() method. Data specific
@@ -626,6 +645,11 @@ class PublishEvent final : public Event<T> {
     events->add_publish_event(std::move(event));
   }
 
+  void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_publish_event_reference(this);
+  }
+
   // Clones PublishEvent-specific data.
   [[nodiscard]] PublishEvent<T>* DoClone() const final {
     return new PublishEvent(*this);
@@ -700,6 +724,11 @@ class DiscreteUpdateEvent final : public Event<T> {
     events->add_discrete_update_event(std::move(event));
   }
 
+  void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_discrete_update_event_reference(this);
+  }
+
   // Clones DiscreteUpdateEvent-specific data.
   [[nodiscard]] DiscreteUpdateEvent<T>* DoClone() const final {
     return new DiscreteUpdateEvent(this->get_trigger_type(), callback_);
@@ -772,6 +801,11 @@ class UnrestrictedUpdateEvent final : public Event<T> {
     events->add_unrestricted_update_event(std::move(event));
   }
 
+  void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_unrestricted_update_event_reference(this);
+  }
+
   // Clones event data specific to UnrestrictedUpdateEvent.
   UnrestrictedUpdateEvent<T>* DoClone() const final {
     return new UnrestrictedUpdateEvent(*this);
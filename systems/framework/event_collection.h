@@ -334,8 +334,21 @@ class LeafEventCollection final : public EventCollection<EventType> {
    */
   void add_event(std::unique_ptr<EventType> event) override {
     DRAKE_DEMAND(event != nullptr);
+    events_.push_back(event.get());
     owned_events_.push_back(std::move(event));
-    events_.push_back(owned_events_.back().get());
+  }
+
+  /**
+   * Adds `event` to the existing collection without copying it or taking
+   * ownership. Hence `event` must outlive this collection and any collection
+   * that it is later added to through AddToEnd() or SetFrom(), which also do
+   * not copy it. This is meant for the events declared by a System, which
+   * outlive the event collections allocated for it. Aborts if event is null.
+   */
+  void add_event_reference(const EventType* event) {
+    DRAKE_DEMAND(event != nullptr);
+    events_.push_back(event);
+    owned_events_.push_back(nullptr);
   }
 
   /**
@@ -367,6 +380,8 @@ class LeafEventCollection final : public EventCollection<EventType> {
    * <pre>
    *   EventType: {event1, event2, event3, event4}
    * </pre>
+   * The events owned by `other_collection` are cloned, while those it only
+   * refers to (see add_event_reference()) are referred to by `this` as well.
    *
    * @throws std::bad_cast if `other_collection` is not an instance of
    * LeafEventCollection.
@@ -375,17 +390,23 @@ class LeafEventCollection final : public EventCollection<EventType> {
     const LeafEventCollection<EventType>& other =
         dynamic_cast<const LeafEventCollection<EventType>&>(other_collection);
 
-    const std::vector<const EventType*>& other_events = other.get_events();
-    for (const EventType* other_event : other_events) {
-      this->add_event(static_pointer_cast<EventType>(other_event->Clone()));
+    const int num_other_events = static_cast<int>(other.events_.size());
+    for (int i = 0; i < num_other_events; ++i) {
+      const EventType* other_event = other.events_[i];
+      if (other.owned_events_[i] == nullptr) {
+        this->add_event_reference(other_event);
+      } else {
+        this->add_event(static_pointer_cast<EventType>(other_event->Clone()));
+      }
     }
   }
 
  private:
-  // Owned event unique pointers.
+  // Owned event unique pointers, or nullptr for the events that were added by
+  // reference. It always has the same size as events_.
   std::vector<std::unique_ptr<EventType>> owned_events_;
 
-  // Points to the corresponding unique pointers. This is primarily used for
+  // Points to all of the events, in order. This is primarily used for
   // get_events().
   std::vector<const EventType*> events_;
 };
@@ -498,6 +519,50 @@ class CompositeEventCollection {
     events.add_event(std::move(event));
   }
 
+  /**
+   * Assuming the internal publish event collection is an instance of
+   * LeafEventCollection, adds the publish event `event` to it without copying
+   * it or taking ownership. See LeafEventCollection::add_event_reference().
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_publish_event_reference(const PublishEvent<T>* event) {
+    DRAKE_DEMAND(event != nullptr);
+    auto& events = dynamic_cast<LeafEventCollection<PublishEvent<T>>&>(
+        this->get_mutable_publish_events());
+    events.add_event_reference(event);
+  }
+
+  /**
+   * Assuming the internal discrete update event collection is an instance of
+   * LeafEventCollection, adds the discrete update event `event` to it without
+   * copying it or taking ownership. See
+   * LeafEventCollection::add_event_reference().
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_discrete_update_event_reference(
+      const DiscreteUpdateEvent<T>* event) {
+    DRAKE_DEMAND(event != nullptr);
+    auto& events = dynamic_cast<LeafEventCollection<DiscreteUpdateEvent<T>>&>(
+        this->get_mutable_discrete_update_events());
+    events.add_event_reference(event);
+  }
+
+  /**
+   * Assuming the internal unrestricted update event collection is an instance
+   * of LeafEventCollection, adds the unrestricted update event `event` to it
+   * without copying it or taking ownership. See
+   * LeafEventCollection::add_event_reference().
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_unrestricted_update_event_reference(
+      const UnrestrictedUpdateEvent<T>* event) {
+    DRAKE_DEMAND(event != nullptr);
+    auto& events =
+        dynamic_cast<LeafEventCollection<UnrestrictedUpdateEvent<T>>&>(
+            this->get_mutable_unrestricted_update_events());
+    events.add_event_reference(event);
+  }
+
   /**
    * Adds the contained homogeneous event collections (e.g.,
    * EventCollection<PublishEvent<T>>, EventCollection<DiscreteUpdateEvent<T>>,
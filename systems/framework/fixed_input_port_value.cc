@@ -12,7 +12,10 @@ AbstractValue* FixedInputPortValue::GetMutableData() {
   const int64_t change_event = context.start_new_change_event();
   tracker.NoteValueChange(change_event);
   ++serial_number_;
-  return value_.get_mutable();
+  // Copy on write. A value that is still shared was never written since the
+  // clone was made, so either owner can take the copy.
+  if (value_.use_count() > 1) value_ = value_->Clone();
+  return value_.get();
 }
 
 }  // namespace systems
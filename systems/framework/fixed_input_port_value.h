@@ -31,7 +31,13 @@ use as an internal value source for one of a System's input ports. The semantics
 are identical to a Parameter. We assign a DependencyTracker to this object
 and subscribe the InputPort to it when that port is fixed. Any modification to
 the value here issues a notification to its dependent, and increments a serial
-number kept here. */
+number kept here.
+
+When a Context is cloned, the clone's %FixedInputPortValue shares the source's
+contained value rather than copying it; whichever of them is first granted
+mutable access (see GetMutableData()) makes a private copy at that time. This
+makes cloning cheap when fixed values are large and rarely changed, and is
+invisible except that get_value() may return the same object for both. */
 class FixedInputPortValue {
  public:
   /** @name  Does not allow move or assignment; copy is private. */
@@ -60,7 +66,9 @@ class FixedInputPortValue {
   }
 
   /** Returns a pointer to the data inside this %FixedInputPortValue, and
-  notifies the dependent input port that the value has changed.
+  notifies the dependent input port that the value has changed. If the data is
+  still shared with a clone (or the source of a clone) it is first copied, so
+  the returned pointer may differ from previous calls.
 
   To ensure invalidation notifications are delivered, callers should call this
   method every time they wish to update the stored value. In particular, callers
@@ -120,7 +128,8 @@ class FixedInputPortValue {
   }
 
   // Copy constructor is only used for cloning and is not a complete copy --
-  // owning_subcontext_ is left unassigned.
+  // owning_subcontext_ is left unassigned, and the value is shared rather
+  // than copied.
   FixedInputPortValue(const FixedInputPortValue& source) = default;
 
   // Informs this FixedInputPortValue of its assigned DependencyTracker
@@ -140,8 +149,9 @@ class FixedInputPortValue {
   // Needed for invalidation.
   reset_on_copy<ContextBase*> owning_subcontext_;
 
-  // The value and its serial number.
-  copyable_unique_ptr<AbstractValue> value_;
+  // The value and its serial number. The value may be shared with clones and
+  // must be treated as immutable unless this is its sole owner.
+  std::shared_ptr<AbstractValue> value_;
 
   // The serial number is useful for debugging and counting changes but has
   // no role in cache invalidation. Note that after a Context is cloned, both
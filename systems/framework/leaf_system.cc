@@ -153,18 +153,26 @@ void LeafSystem<T>::SetDefaultState(
   DRAKE_DEMAND(model_discrete_state_.num_groups() == 0 ||
       model_discrete_state_.num_groups() == xd.num_groups());
 
+  // The values are copied into the existing storage (rather than cloned from
+  // the models) so that resetting a Context does not allocate.
   if (model_discrete_state_.num_groups() > 0) {
-    xd.SetFrom(model_discrete_state_);
+    for (int i = 0; i < xd.num_groups(); i++) {
+      xd.get_mutable_vector(i).SetFrom(model_discrete_state_.get_vector(i));
+    }
   } else {
     // With no model vector, we just zero all the discrete variables.
     for (int i = 0; i < xd.num_groups(); i++) {
-      BasicVector<T>& s = xd.get_mutable_vector(i);
-      s.SetFromVector(VectorX<T>::Zero(s.size()));
+      xd.get_mutable_vector(i).SetZero();
     }
   }
 
   AbstractValues& xa = state->get_mutable_abstract_state();
-  xa.SetFrom(AbstractValues(model_abstract_states_.CloneAllModels()));
+  DRAKE_DEMAND(xa.size() == model_abstract_states_.size());
+  for (int i = 0; i < xa.size(); i++) {
+    const AbstractValue* model_value = model_abstract_states_.GetModel(i);
+    DRAKE_DEMAND(model_value != nullptr);
+    xa.get_mutable_value(i).SetFrom(*model_value);
+  }
 }
 
 template <typename T>
@@ -173,16 +181,18 @@ void LeafSystem<T>::SetDefaultParameters(
   this->ValidateContext(context);
   for (int i = 0; i < parameters->num_numeric_parameter_groups(); i++) {
     BasicVector<T>& p = parameters->get_mutable_numeric_parameter(i);
-    auto model_vector = model_numeric_parameters_.CloneVectorModel<T>(i);
+    const BasicVector<T>* model_vector =
+        model_numeric_parameters_.GetVectorModel<T>(i);
     if (model_vector != nullptr) {
       p.SetFrom(*model_vector);
     } else {
-      p.SetFromVector(VectorX<T>::Constant(p.size(), 1.0));
+      p.get_mutable_value().setConstant(1.0);
     }
   }
   for (int i = 0; i < parameters->num_abstract_parameters(); i++) {
     AbstractValue& p = parameters->get_mutable_abstract_parameter(i);
-    auto model_value = model_abstract_parameters_.CloneModel(i);
+    const AbstractValue* model_value = model_abstract_parameters_.GetModel(i);
+    DRAKE_DEMAND(model_value != nullptr);
     p.SetFrom(*model_value);
   }
 }
@@ -350,25 +360,36 @@ void LeafSystem<T>::DoCalcNextUpdateTime(
     return;
   }
 
-  // Find the minimum next sample time across all declared periodic events,
-  // and store the set of declared events that will occur at that time.
-  std::vector<const Event<T>*> next_events;
-  for (const auto& event_pair : periodic_events_) {
-    const PeriodicEventData& event_data = event_pair.first;
-    const Event<T>* const event = event_pair.second.get();
-    const T t = GetNextSampleTime(event_data, context.get_time());
+  // Find the minimum next sample time across the distinct timings of the
+  // declared periodic events. When a single timing attains it, min_timing is
+  // its index; otherwise (a tie between several timings) it is -1.
+  const T& current_time = context.get_time();
+  int min_timing = -1;
+  for (int i = 0; i < static_cast<int>(periodic_event_timings_.size()); ++i) {
+    const T t = GetNextSampleTime(periodic_event_timings_[i], current_time);
     if (t < min_time) {
       min_time = t;
-      next_events = {event};
+      min_timing = i;
     } else if (t == min_time) {
-      next_events.push_back(event);
+      min_timing = -1;
     }
   }
 
-  // Write out the events that fire at min_time.
+  // Write out the events that fire at min_time, in declaration order. Only
+  // in case of a tie are sample times recomputed, which is cheap and avoids
+  // allocating temporary storage. The declared events outlive `events`, so
+  // they are referred to rather than cloned.
   *time = min_time;
-  for (const Event<T>* event : next_events) {
-    event->AddToComposite(events);
+  for (size_t i = 0; i < periodic_events_.size(); ++i) {
+    const int timing = periodic_event_timing_indices_[i];
+    bool fires = (timing == min_timing);
+    if (min_timing < 0) {
+      if (GetNextSampleTime(periodic_event_timings_[timing], current_time) ==
+          min_time) {
+        fires = true;
+      }
+    }
+    if (fires) periodic_events_[i].second->AddReferenceToComposite(events);
   }
 }
 
@@ -758,6 +779,20 @@ std::unique_ptr<AbstractValue> LeafSystem<T>::DoAllocateInput(
       this->GetSystemPathname()));
 }
 
+template <typename T>
+int LeafSystem<T>::FindOrAddPeriodicEventTiming(
+    const PeriodicEventData& timing) {
+  for (int i = 0; i < static_cast<int>(periodic_event_timings_.size()); ++i) {
+    const PeriodicEventData& existing = periodic_event_timings_[i];
+    if (existing.period_sec() == timing.period_sec() &&
+        existing.offset_sec() == timing.offset_sec()) {
+      return i;
+    }
+  }
+  periodic_event_timings_.push_back(timing);
+  return static_cast<int>(periodic_event_timings_.size()) - 1;
+}
+
 template <typename T>
 std::map<PeriodicEventData, std::vector<const Event<T>*>,
     PeriodicEventDataComparator> LeafSystem<T>::DoGetPeriodicEvents() const {
@@ -805,8 +840,16 @@ void LeafSystem<T>::DoApplyDiscreteVariableUpdate(
       dynamic_cast<const LeafEventCollection<DiscreteUpdateEvent<T>>*>(
           &events) != nullptr);
   DRAKE_DEMAND(events.HasEvents());
-  // TODO(sherm1) Should swap rather than copy.
-  context->get_mutable_discrete_state().SetFrom(*discrete_state);
+  // Swap the values rather than copying them. The group vectors themselves
+  // stay in place, since a parent DiagramDiscreteValues refers to them.
+  DiscreteValues<T>& context_discrete_state =
+      context->get_mutable_discrete_state();
+  DRAKE_DEMAND(context_discrete_state.num_groups() ==
+               discrete_state->num_groups());
+  for (int i = 0; i < discrete_state->num_groups(); ++i) {
+    context_discrete_state.get_mutable_vector(i).SwapValues(
+        &discrete_state->get_mutable_vector(i));
+  }
 }
 
 template <typename T>
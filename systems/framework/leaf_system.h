@@ -515,6 +515,8 @@ class LeafSystem : public System<T> {
     event_copy->set_trigger_type(TriggerType::kPeriodic);
     periodic_events_.emplace_back(
         std::make_pair(periodic_data, std::move(event_copy)));
+    periodic_event_timing_indices_.push_back(
+        FindOrAddPeriodicEventTiming(periodic_data));
   }
 
   /** (To be deprecated) Declares a periodic publish event that invokes the
@@ -2082,11 +2084,22 @@ class LeafSystem : public System<T> {
       const std::function<const VectorBase<T>&(const Context<T>&)>&
           get_vector_from_context);
 
+  // Returns the index of `timing` in periodic_event_timings_, adding it first
+  // if no periodic event with the same period and offset was declared yet.
+  int FindOrAddPeriodicEventTiming(const PeriodicEventData& timing);
+
   // Periodic Update or Publish events declared by this system.
   std::vector<std::pair<PeriodicEventData,
                         std::unique_ptr<Event<T>>>>
       periodic_events_;
 
+  // The distinct timings (period and offset) of the periodic events, so that
+  // the next sample time of events that share a timing is computed once. The
+  // timing of periodic_events_[i] is
+  // periodic_event_timings_[periodic_event_timing_indices_[i]].
+  std::vector<PeriodicEventData> periodic_event_timings_;
+  std::vector<int> periodic_event_timing_indices_;
+
   // Update or Publish events declared by this system for every simulator
   // major time step.
   LeafCompositeEventCollection<T> per_step_events_;
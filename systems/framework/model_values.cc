@@ -31,6 +31,12 @@ std::unique_ptr<AbstractValue> ModelValues::CloneModel(int index) const {
   return nullptr;
 }
 
+const AbstractValue* ModelValues::GetModel(int index) const {
+  if (index < size()) {
+    return values_[index].get();
+  }
+  return nullptr;
+}
 
 }  // namespace internal
 }  // namespace systems
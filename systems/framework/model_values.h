@@ -48,6 +48,10 @@ class ModelValues {
   /// Returns a clone of the model value at @p index, which may be nullptr.
   std::unique_ptr<AbstractValue> CloneModel(int index) const;
 
+  /// Returns the model value at @p index, which may be nullptr. Unlike
+  /// CloneModel(), this does not allocate.
+  const AbstractValue* GetModel(int index) const;
+
   /// Returns a vector of all the cloned model values. Some may be nullptr.
   std::vector<std::unique_ptr<AbstractValue>> CloneAllModels() const {
     std::vector<std::unique_ptr<AbstractValue>> ret(size());
@@ -65,6 +69,14 @@ class ModelValues {
   template <typename T>
   std::unique_ptr<BasicVector<T>> CloneVectorModel(int index) const;
 
+  /// Returns the vector within the model value at @p index, which may be
+  /// nullptr. Unlike CloneVectorModel(), this does not allocate.
+  ///
+  /// @throws std::exception if the index has a model but the model's type does
+  /// not match the given @p T
+  template <typename T>
+  const BasicVector<T>* GetVectorModel(int index) const;
+
  private:
   // Elements here are allowed to be nullptr.
   std::vector<std::unique_ptr<const AbstractValue>> values_;
@@ -92,6 +104,15 @@ ModelValues::CloneVectorModel(int index) const {
   return basic_vector.Clone();
 }
 
+template <typename T>
+const BasicVector<T>* ModelValues::GetVectorModel(int index) const {
+  const AbstractValue* const model_value = GetModel(index);
+  if (model_value == nullptr) {
+    return nullptr;
+  }
+  return &model_value->get_value<BasicVector<T>>();
+}
+
 }  // namespace internal
 }  // namespace systems
 }  // namespace drake
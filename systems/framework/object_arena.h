@@ -0,0 +1,114 @@
+#pragma once
+
+/** @file
+Declares ObjectArena, used by Cache and DependencyGraph to own their many small
+objects. */
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+/* Owns objects of type T that are constructed in a few large blocks of storage
+rather than in one heap allocation apiece. Objects are never moved once
+constructed, so their addresses are stable for the lifetime of the arena. All
+objects are destroyed (last-created first) when the arena is destroyed; there
+is no way to destroy an individual object earlier.
+
+The objects are constructed by the caller (via placement new into storage
+provided by the arena) so that types with private constructors can be arena
+allocated by their friends.
+
+@tparam T The type of the owned objects. */
+template <typename T>
+class ObjectArena {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ObjectArena)
+
+  ObjectArena() = default;
+
+  ~ObjectArena() {
+    for (auto block = blocks_.rbegin(); block != blocks_.rend(); ++block) {
+      for (int i = block->size - 1; i >= 0; --i)
+        std::launder(reinterpret_cast<T*>(&block->storage[i]))->~T();
+    }
+  }
+
+  /* Ensures that the next `count` objects created here share a single block
+  of storage, allocating that block now if necessary. Use this when the number
+  of objects to be created is known in advance (e.g., when copying). */
+  void Reserve(int count) {
+    DRAKE_DEMAND(count >= 0);
+    if (num_available() < count) AddBlock(count);
+  }
+
+  /* Constructs a new T owned by this arena. The given functor is passed a
+  pointer to uninitialized storage suitable for a T, must construct a T there
+  (typically with placement new), and must return a pointer to the new
+  object. If the functor throws, the storage remains available for the next
+  object. */
+  template <typename Construct>
+  T* Create(Construct&& construct) {
+    if (num_available() == 0) {
+      const int last_capacity = blocks_.empty() ? 0 : blocks_.back().capacity;
+      AddBlock(std::max(kMinBlockSize, 2 * last_capacity));
+    }
+    Block& block = blocks_.back();
+    void* const storage = &block.storage[block.size];
+    T* const object = construct(storage);
+    DRAKE_DEMAND(static_cast<void*>(object) == storage);
+    ++block.size;
+    return object;
+  }
+
+  /* Returns the number of objects owned by this arena. */
+  int size() const {
+    int result = 0;
+    for (const Block& block : blocks_) result += block.size;
+    return result;
+  }
+
+  /* Returns the number of blocks of storage that have been allocated. */
+  int num_blocks() const { return static_cast<int>(blocks_.size()); }
+
+ private:
+  using Slot = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+  // The smallest block allocated when the expected number of objects is not
+  // known in advance; later blocks double in size.
+  static constexpr int kMinBlockSize = 16;
+
+  // Storage for `capacity` objects, of which the first `size` have been
+  // constructed.
+  struct Block {
+    std::unique_ptr<Slot[]> storage;
+    int capacity{};
+    int size{};
+  };
+
+  int num_available() const {
+    return blocks_.empty() ? 0 : blocks_.back().capacity - blocks_.back().size;
+  }
+
+  // Any unused storage in the current last block is abandoned.
+  void AddBlock(int capacity) {
+    DRAKE_DEMAND(capacity > 0);
+    // Not make_unique, which would needlessly zero the storage.
+    blocks_.push_back(
+        Block{std::unique_ptr<Slot[]>(new Slot[capacity]), capacity, 0});
+  }
+
+  std::vector<Block> blocks_;
+};
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <initializer_list>
 #include <utility>
 #include <vector>
 
@@ -37,6 +38,60 @@ class Supervector final : public VectorBase<T> {
     return lookup_table_.empty() ? 0 : lookup_table_.back();
   }
 
+  // The bulk operations below visit each subvector once, delegating to that
+  // subvector's own (possibly contiguous) implementation, instead of
+  // searching for the subvector of every element.
+
+  void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) final {
+    const int n = value.rows();
+    if (n != size()) { this->ThrowMismatchedSize(n); }
+    int start = 0;
+    for (VectorBase<T>* vec : vectors_) {
+      const int vec_size = vec->size();
+      vec->SetFromVector(value.segment(start, vec_size));
+      start += vec_size;
+    }
+  }
+
+  void SetZero() final {
+    for (VectorBase<T>* vec : vectors_) {
+      vec->SetZero();
+    }
+  }
+
+  VectorX<T> CopyToVector() const final {
+    VectorX<T> result(size());
+    CopyToPreSizedVector(&result);
+    return result;
+  }
+
+  void CopyToPreSizedVector(EigenPtr<VectorX<T>> vec) const final {
+    DRAKE_THROW_UNLESS(vec != nullptr);
+    const int n = vec->rows();
+    if (n != size()) { this->ThrowMismatchedSize(n); }
+    int start = 0;
+    for (const VectorBase<T>* subvector : vectors_) {
+      const int subvector_size = subvector->size();
+      auto segment = vec->segment(start, subvector_size);
+      subvector->CopyToPreSizedVector(&segment);
+      start += subvector_size;
+    }
+  }
+
+  void ScaleAndAddToVector(const T& scale,
+                           EigenPtr<VectorX<T>> vec) const final {
+    DRAKE_THROW_UNLESS(vec != nullptr);
+    const int n = vec->rows();
+    if (n != size()) { this->ThrowMismatchedSize(n); }
+    int start = 0;
+    for (const VectorBase<T>* subvector : vectors_) {
+      const int subvector_size = subvector->size();
+      auto segment = vec->segment(start, subvector_size);
+      subvector->ScaleAndAddToVector(scale, &segment);
+      start += subvector_size;
+    }
+  }
+
  private:
   const T& DoGetAtIndexUnchecked(int index) const final {
     DRAKE_ASSERT(index < size());
@@ -62,6 +117,28 @@ class Supervector final : public VectorBase<T> {
     return (*subvector)[offset];
   }
 
+  // When all operands are supervectors partitioned in the same way as this
+  // one, as with the continuous state of a Diagram and its time derivatives,
+  // this adds each scaled operand subvector to the corresponding subvector of
+  // this, leveraging each subvector's own (e.g., contiguous) implementation.
+  // Otherwise, uses the element-wise default implementation.
+  void DoPlusEqScaled(const std::initializer_list<
+                      std::pair<T, const VectorBase<T>&>>& rhs_scale) final {
+    for (const auto& operand : rhs_scale) {
+      const auto* rhs = dynamic_cast<const Supervector<T>*>(&operand.second);
+      if (rhs == nullptr || rhs->lookup_table_ != lookup_table_) {
+        VectorBase<T>::DoPlusEqScaled(rhs_scale);
+        return;
+      }
+    }
+    for (int i = 0; i < static_cast<int>(vectors_.size()); ++i) {
+      for (const auto& [scale, rhs] : rhs_scale) {
+        const auto& rhs_super = static_cast<const Supervector<T>&>(rhs);
+        vectors_[i]->PlusEqScaled(scale, *rhs_super.vectors_[i]);
+      }
+    }
+  }
+
   // Given an index into the supervector, returns the subvector that
   // contains that index, and its offset within the subvector. This operation
   // is O(log(N)) in the number of subvectors.
@@ -85,6 +85,14 @@ void System<T>::SetDefaultContext(Context<T>* context) const {
   DRAKE_DEMAND(num_params == context->num_numeric_parameter_groups());
 }
 
+template <typename T>
+void System<T>::ResetContext(Context<T>* context) const {
+  this->ValidateContext(context);
+  context->SetTime(T(0.0));
+  context->SetAccuracy(std::nullopt);
+  SetDefaultContext(context);
+}
+
 template <typename T>
 void System<T>::SetRandomState(const Context<T>& context, State<T>* state,
                                RandomGenerator* generator) const {
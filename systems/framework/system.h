@@ -148,6 +148,17 @@ class System : public SystemBase {
   override. */
   void SetDefaultContext(Context<T>* context) const;
 
+  /** Returns the given `context` to the condition of a newly created one
+  (see CreateDefaultContext()), reusing its existing memory: the time is set
+  to zero, the accuracy is unset, and the state and parameters are set to
+  their defaults (see SetDefaultContext()). This is much cheaper than creating
+  a new Context, since the Context tree, its cache, and its dependency graph
+  are not reallocated, so it is the preferred way to start each of many
+  repeated simulations. Fixed input port values are _not_ removed; they keep
+  their current values.
+  @throws std::exception if `context` is not compatible with this System. */
+  void ResetContext(Context<T>* context) const;
+
   /** Assigns random values to all elements of the state.
   This default implementation calls SetDefaultState; override this method to
   provide random initial conditions using the stdc++ random library, e.g.:
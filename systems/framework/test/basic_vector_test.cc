@@ -135,6 +135,23 @@ GTEST_TEST(BasicVectorTest, ArrayOperator) {
   EXPECT_EQ(42, const_vec[1]);
 }
 
+// Tests that the values of two BasicVectors can be swapped without copying.
+GTEST_TEST(BasicVectorTest, SwapValues) {
+  BasicVector<double> a{1.0, 2.0};
+  BasicVector<double> b{3.0, 4.0};
+  const double* const a_data = a.get_value().data();
+  const double* const b_data = b.get_value().data();
+  a.SwapValues(&b);
+  EXPECT_EQ(a.get_value(), Eigen::Vector2d(3.0, 4.0));
+  EXPECT_EQ(b.get_value(), Eigen::Vector2d(1.0, 2.0));
+  EXPECT_EQ(a.get_value().data(), b_data);
+  EXPECT_EQ(b.get_value().data(), a_data);
+
+  BasicVector<double> c(3);
+  EXPECT_THROW(a.SwapValues(&c), std::exception);
+  EXPECT_THROW(a.SwapValues(nullptr), std::exception);
+}
+
 // Tests that the BasicVector can be set from another vector.
 GTEST_TEST(BasicVectorTest, SetWholeVector) {
   BasicVector<double> vec(2);
@@ -16,6 +16,8 @@
 
 #include <memory>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -723,6 +725,49 @@ TEST_F(CacheEntryTest, InvalidationIsRecursive) {
   EXPECT_FALSE(vector_entry().is_out_of_date(context_));
 }
 
+// Tests that with thread-safe caching, concurrent Eval() calls of an
+// out-of-date entry compute it exactly once and all see the result.
+TEST_F(CacheEntryTest, ThreadSafeCaching) {
+  EXPECT_FALSE(context_.is_cache_thread_safe());
+  context_.EnableThreadSafeCaching();
+  EXPECT_TRUE(context_.is_cache_thread_safe());
+
+  const CacheEntryValue& value1 = entry1().get_cache_entry_value(context_);
+  const CacheEntryValue& value2 = entry2().get_cache_entry_value(context_);
+  for (int trial = 0; trial < 20; ++trial) {
+    invalidate(index1_);  // Invalidates entry1 and entry2.
+    const int64_t serial1 = value1.serial_number();
+    const int64_t serial2 = value2.serial_number();
+
+    const int kNumThreads = 4;
+    std::vector<int> results(2 * kNumThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([this, &results, i]() {
+        results[2 * i] = entry1().Eval<int>(context_);
+        results[2 * i + 1] = entry2().Eval<int>(context_);
+      });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    for (int result : results) EXPECT_EQ(result, 98);
+    EXPECT_EQ(value1.serial_number(), serial1 + 1);
+    EXPECT_EQ(value2.serial_number(), serial2 + 1);
+  }
+
+  // The setting is copied along with the Context.
+  EXPECT_TRUE(context_.Clone()->is_cache_thread_safe());
+
+  // Concurrent evaluation doesn't permit disabled caching.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      entry4().EvalAbstract(context_), std::logic_error,
+      ".*Eval.*caching can't be disabled while thread-safe caching is.*");
+
+  context_.DisableThreadSafeCaching();
+  EXPECT_FALSE(context_.is_cache_thread_safe());
+  EXPECT_EQ(entry4().Eval<int>(context_), 98);
+}
+
 TEST_F(CacheEntryTest, Copy) {
   // Create a clone of the cache and dependency graph.
   auto clone_context_ptr = context_.Clone();
@@ -0,0 +1,185 @@
+#include "drake/systems/framework/context_checkpoint.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+
+// A system with all kinds of state and parameters.
+class AllStates : public LeafSystem<double> {
+ public:
+  explicit AllStates(bool with_abstract = true) {
+    DeclareContinuousState(1, 1, 1);
+    DeclareDiscreteState(2);
+    DeclareDiscreteState(1);
+    DeclareNumericParameter(BasicVector<double>(Vector2d(1.0, 2.0)));
+    if (with_abstract) {
+      DeclareAbstractState(AbstractValue::Make<int>(0));
+      DeclareAbstractParameter(Value<std::string>("default"));
+    }
+  }
+};
+
+// Sets distinct values everywhere in `context`, offset by `offset`.
+void SetValues(double offset, Context<double>* context) {
+  context->SetTime(offset);
+  context->SetAccuracy(offset * 1e-3);
+  context->SetContinuousState(Vector3d(1, 2, 3) + Vector3d::Constant(offset));
+  context->get_mutable_discrete_state(0).SetFromVector(
+      Vector2d(4, 5) + Vector2d::Constant(offset));
+  context->get_mutable_discrete_state(1)[0] = 6 + offset;
+  context->get_mutable_numeric_parameter(0).SetFromVector(
+      Vector2d(7, 8) + Vector2d::Constant(offset));
+  if (context->num_abstract_states() > 0) {
+    context->get_mutable_abstract_state<int>(0) = static_cast<int>(9 + offset);
+    context->get_mutable_parameters().get_mutable_abstract_parameter(0)
+        .set_value(std::to_string(offset));
+  }
+}
+
+void ExpectValues(double offset, const Context<double>& context) {
+  EXPECT_EQ(context.get_time(), offset);
+  EXPECT_EQ(context.get_accuracy(), offset * 1e-3);
+  EXPECT_TRUE(CompareMatrices(
+      context.get_continuous_state_vector().CopyToVector(),
+      Vector3d(1, 2, 3) + Vector3d::Constant(offset)));
+  EXPECT_TRUE(CompareMatrices(context.get_discrete_state(0).get_value(),
+                              Vector2d(4, 5) + Vector2d::Constant(offset)));
+  EXPECT_EQ(context.get_discrete_state(1)[0], 6 + offset);
+  EXPECT_TRUE(CompareMatrices(context.get_numeric_parameter(0).get_value(),
+                              Vector2d(7, 8) + Vector2d::Constant(offset)));
+  if (context.num_abstract_states() > 0) {
+    EXPECT_EQ(context.get_abstract_state<int>(0), 9 + offset);
+    EXPECT_EQ(context.get_abstract_parameter(0).get_value<std::string>(),
+              std::to_string(offset));
+  }
+}
+
+AbstractValueCodecs MakeCodecs() {
+  AbstractValueCodecs codecs;
+  codecs.AddTriviallyCopyable<int>();
+  codecs.Add<std::string>(
+      [](const std::string& value, std::vector<uint8_t>* bytes) {
+        bytes->insert(bytes->end(), value.begin(), value.end());
+      },
+      [](const uint8_t* data, int size, std::string* value) {
+        value->assign(reinterpret_cast<const char*>(data), size);
+      });
+  return codecs;
+}
+
+GTEST_TEST(ContextCheckpointTest, LeafContext) {
+  const AllStates system;
+  const AbstractValueCodecs codecs = MakeCodecs();
+  auto context = system.CreateDefaultContext();
+  SetValues(10.0, context.get());
+  std::vector<uint8_t> checkpoint;
+  SaveContextCheckpoint(*context, &checkpoint, &codecs);
+
+  // Restoring into the same context undoes later changes.
+  SetValues(20.0, context.get());
+  RestoreContextCheckpoint(checkpoint, context.get(), &codecs);
+  ExpectValues(10.0, *context);
+
+  // Restoring into another context of the same system forks it.
+  auto fork = system.CreateDefaultContext();
+  RestoreContextCheckpoint(checkpoint, fork.get(), &codecs);
+  ExpectValues(10.0, *fork);
+
+  // Saving again reuses the buffer.
+  const uint8_t* const data = checkpoint.data();
+  SaveContextCheckpoint(*fork, &checkpoint, &codecs);
+  EXPECT_EQ(checkpoint.data(), data);
+}
+
+GTEST_TEST(ContextCheckpointTest, DiagramContext) {
+  DiagramBuilder<double> builder;
+  builder.AddSystem<AllStates>(false /* with_abstract */);
+  builder.AddSystem<AllStates>(false /* with_abstract */);
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  context->SetTime(1.0);
+  for (int i = 0; i < context->num_continuous_states(); ++i) {
+    context->get_mutable_continuous_state_vector()[i] = i;
+  }
+  std::vector<uint8_t> checkpoint;
+  SaveContextCheckpoint(*context, &checkpoint);
+
+  auto fork = diagram->CreateDefaultContext();
+  RestoreContextCheckpoint(checkpoint, fork.get());
+  EXPECT_EQ(fork->get_time(), 1.0);
+  EXPECT_TRUE(CompareMatrices(
+      fork->get_continuous_state_vector().CopyToVector(),
+      context->get_continuous_state_vector().CopyToVector()));
+  EXPECT_EQ(fork->num_discrete_state_groups(), 4);
+
+  // A subcontext cannot be restored.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RestoreContextCheckpoint(
+          checkpoint,
+          &diagram->GetMutableSubsystemContext(
+              *diagram->GetSystems()[0], fork.get())),
+      std::logic_error, ".*root context.*");
+}
+
+GTEST_TEST(ContextCheckpointTest, Errors) {
+  const AllStates system;
+  const AbstractValueCodecs codecs = MakeCodecs();
+  auto context = system.CreateDefaultContext();
+  std::vector<uint8_t> checkpoint;
+
+  // Abstract values need codecs.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SaveContextCheckpoint(*context, &checkpoint),
+      std::logic_error, ".*no codec for the abstract value type int.*");
+  SaveContextCheckpoint(*context, &checkpoint, &codecs);
+
+  // The dimensions must match, and a mismatched checkpoint leaves the context
+  // unchanged.
+  const AllStates other_system(false /* with_abstract */);
+  auto other_context = other_system.CreateDefaultContext();
+  SetValues(3.0, other_context.get());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RestoreContextCheckpoint(checkpoint, other_context.get(), &codecs),
+      std::runtime_error,
+      ".*checkpoint has 1 abstract states but the context has 0.*");
+  ExpectValues(3.0, *other_context);
+
+  // Malformed checkpoints are detected.
+  std::vector<uint8_t> truncated(checkpoint.begin(), checkpoint.end() - 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RestoreContextCheckpoint(truncated, context.get(), &codecs),
+      std::runtime_error, ".*truncated.*");
+  std::vector<uint8_t> trailing = checkpoint;
+  trailing.push_back(0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RestoreContextCheckpoint(trailing, context.get(), &codecs),
+      std::runtime_error, ".*1 unexpected trailing bytes.*");
+  std::vector<uint8_t> garbage(checkpoint.size(), 0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RestoreContextCheckpoint(garbage, context.get(), &codecs),
+      std::runtime_error, ".*not a context checkpoint.*");
+
+  // Codecs are unique per type.
+  AbstractValueCodecs duplicate = MakeCodecs();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      duplicate.AddTriviallyCopyable<int>(),
+      std::logic_error, ".*already a codec for int.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -726,13 +726,13 @@ TEST_F(DiagramContextTest, Clone) {
   EXPECT_EQ(1024.0, clone->get_continuous_state()[0]);
   EXPECT_EQ(42.0, context_->get_continuous_state()[0]);
 
-  // Verify that the cloned input ports contain the same data,
-  // but are different pointers.
+  // Verify that the cloned input ports contain the same data.
   EXPECT_EQ(2, clone->num_input_ports());
   for (int i = 0; i < 2; ++i) {
     const BasicVector<double>* orig_port = ReadVectorInputPort(*context_, i);
     const BasicVector<double>* clone_port = ReadVectorInputPort(*clone, i);
-    EXPECT_NE(orig_port, clone_port);
+    // Fixed values are shared until one of the contexts modifies them.
+    EXPECT_EQ(orig_port, clone_port);
     EXPECT_TRUE(CompareMatrices(orig_port->get_value(), clone_port->get_value(),
                                 1e-8, MatrixCompareType::absolute));
   }
@@ -871,6 +871,38 @@ TEST_F(DiagramTest, CalcTimeDerivatives) {
   EXPECT_EQ(27, integrator1_xcdot.get_vector()[2]);
 }
 
+// Tests that evaluating the subsystems on several threads gives the same
+// derivatives as evaluating them one after another.
+TEST_F(DiagramTest, CalcTimeDerivativesInParallel) {
+  AttachInputs();
+  std::unique_ptr<ContinuousState<double>> expected =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, expected.get());
+
+  EXPECT_EQ(diagram_->num_evaluation_threads(), 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(diagram_->set_num_evaluation_threads(0),
+                              std::exception, ".*num_threads >= 1.*");
+  diagram_->set_num_evaluation_threads(3);
+  EXPECT_EQ(diagram_->num_evaluation_threads(), 3);
+
+  // Change the inputs so that the output ports must be recomputed, then put
+  // them back.
+  context_->FixInputPort(0, input1_);
+  std::unique_ptr<ContinuousState<double>> derivatives =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, derivatives.get());
+  EXPECT_NE(derivatives->CopyToVector(), expected->CopyToVector());
+  AttachInputs();
+  diagram_->CalcTimeDerivatives(*context_, derivatives.get());
+  EXPECT_EQ(derivatives->CopyToVector(), expected->CopyToVector());
+
+  // The setting is preserved by scalar conversion.
+  std::unique_ptr<System<AutoDiffXd>> ad_diagram = diagram_->ToAutoDiffXd();
+  EXPECT_EQ(dynamic_cast<const Diagram<AutoDiffXd>&>(*ad_diagram)
+                .num_evaluation_threads(),
+            3);
+}
+
 TEST_F(DiagramTest, ContinuousStateBelongsWithSystem) {
   AttachInputs();
 
@@ -1983,6 +2015,26 @@ TEST_F(DiscreteStateTest, UpdateDiscreteVariables) {
   EXPECT_EQ(23.0, updates2[0]);
 }
 
+// Tests that the discrete updates of several subsystems can be computed on
+// several threads.
+TEST_F(DiscreteStateTest, UpdateDiscreteVariablesInParallel) {
+  diagram_.set_num_evaluation_threads(2);
+  std::unique_ptr<DiscreteValues<double>> updates =
+      diagram_.AllocateDiscreteVariables();
+
+  // At 12.0 sec both hold1 and hold2 update.
+  context_->SetTime(11.5);
+  auto events = diagram_.AllocateCompositeEventCollection();
+  EXPECT_EQ(diagram_.CalcNextUpdateTime(*context_, events.get()), 12.0);
+  context_->SetTime(12.0);
+  diagram_.CalcDiscreteVariableUpdates(
+      *context_, events->get_discrete_update_events(), updates.get());
+  EXPECT_EQ(diagram_.GetSubsystemDiscreteValues(*diagram_.hold1(),
+                                                *updates)[0], 17.0);
+  EXPECT_EQ(diagram_.GetSubsystemDiscreteValues(*diagram_.hold2(),
+                                                *updates)[0], 23.0);
+}
+
 // Tests that in a Diagram where multiple subsystems have discrete variables,
 // an update in one subsystem doesn't cause invalidation in the other. Note
 // that although we use the caching system to observe what gets invalidated,
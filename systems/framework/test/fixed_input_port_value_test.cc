@@ -143,7 +143,8 @@ TEST_F(FixedInputPortTest, RepeatedFixInputPortUsesSameTracker) {
 // Fixed values are cloned only as part of cloning a context, which
 // requires changing the internal context pointer that is used for value
 // change notification. The ticket and input port index remain unchanged
-// in the new context. The values are copied and serial numbers unchanged.
+// in the new context. The values are shared until one of them is modified, and
+// serial numbers are unchanged.
 TEST_F(FixedInputPortTest, Clone) {
   std::unique_ptr<ContextBase> new_context = context_.Clone();
 
@@ -163,15 +164,25 @@ TEST_F(FixedInputPortTest, Clone) {
   EXPECT_EQ(free0->serial_number(), port0_value_->serial_number());
   EXPECT_EQ(free1->serial_number(), port1_value_->serial_number());
 
+  // Until written, the clone shares the source's values.
+  EXPECT_EQ(&free0->get_value(), &port0_value_->get_value());
+  EXPECT_EQ(&free1->get_value(), &port1_value_->get_value());
+
   // Make sure changing a value in the old context doesn't change a value
   // in the new one, and vice versa.
   port0_value_->GetMutableVectorData<double>()->SetAtIndex(0, 99);
+  EXPECT_NE(&free0->get_value(), &port0_value_->get_value());
   EXPECT_EQ(port0_value_->get_vector_value<double>()[0], 99);
   EXPECT_EQ(free0->get_vector_value<double>()[0], 5);
 
   free1->GetMutableData()->get_mutable_value<std::string>() = "hello";
   EXPECT_EQ(free1->get_value().get_value<std::string>(), "hello");
   EXPECT_EQ(port1_value_->get_value().get_value<std::string>(), "foo");
+
+  // Once a value is no longer shared, writes happen in place.
+  const AbstractValue* const unshared = &free1->get_value();
+  free1->GetMutableData()->get_mutable_value<std::string>() = "again";
+  EXPECT_EQ(&free1->get_value(), unshared);
 }
 
 // Test that we can access values and that doing so does not send value change
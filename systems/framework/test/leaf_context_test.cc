@@ -503,13 +503,13 @@ TEST_F(LeafContextTest, Clone) {
   EXPECT_TRUE(xc.get_system_id().is_valid());
   EXPECT_EQ(xc.get_system_id(), context_.get_system_id());
 
-  // Verify that the cloned input ports contain the same data,
-  // but are different pointers.
+  // Verify that the cloned input ports contain the same data. The fixed
+  // values are shared until one of the contexts modifies them.
   EXPECT_EQ(kNumInputPorts, clone->num_input_ports());
   for (int i = 0; i < kNumInputPorts; ++i) {
     const BasicVector<double>* context_port = ReadVectorInputPort(context_, i);
     const BasicVector<double>* clone_port = ReadVectorInputPort(*clone, i);
-    EXPECT_NE(context_port, clone_port);
+    EXPECT_EQ(context_port, clone_port);
     EXPECT_TRUE(CompareMatrices(context_port->get_value(),
                                 clone_port->get_value(), 1e-8,
                                 MatrixCompareType::absolute));
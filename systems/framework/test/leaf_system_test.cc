@@ -673,6 +673,63 @@ TEST_F(LeafSystemTest, UpdateAndPublish) {
   }
 }
 
+// Tests that events sharing a timing fire together, and that events with
+// distinct timings fire together when their sample times coincide.
+TEST_F(LeafSystemTest, SharedAndDistinctTimings) {
+  system_.AddPeriodicUpdate(2.0, 0.0);
+  system_.AddPeriodicUpdate(3.0, 0.0);
+  system_.AddPeriodicUpdate(2.0, 0.0);
+  const auto& events = leaf_info_->get_discrete_update_events().get_events();
+
+  // Only the two events with period 2 fire at 2sec.
+  context_.SetTime(1.0);
+  EXPECT_EQ(system_.CalcNextUpdateTime(context_, event_info_.get()), 2.0);
+  EXPECT_EQ(events.size(), 2);
+
+  // Only the event with period 3 fires at 3sec.
+  context_.SetTime(2.5);
+  EXPECT_EQ(system_.CalcNextUpdateTime(context_, event_info_.get()), 3.0);
+  EXPECT_EQ(events.size(), 1);
+
+  // All events fire at 6sec.
+  context_.SetTime(5.0);
+  EXPECT_EQ(system_.CalcNextUpdateTime(context_, event_info_.get()), 6.0);
+  EXPECT_EQ(events.size(), 3);
+  for (const auto* event : events) {
+    EXPECT_EQ(event->get_trigger_type(), TriggerType::kPeriodic);
+  }
+}
+
+// Tests that the periodic events are not copied into the event collections,
+// including when collections are merged.
+TEST_F(LeafSystemTest, PeriodicEventsAreReferenced) {
+  system_.AddPeriodicUpdate();
+  system_.CalcNextUpdateTime(context_, event_info_.get());
+  const auto& events = leaf_info_->get_discrete_update_events().get_events();
+  ASSERT_EQ(events.size(), 1);
+  const DiscreteUpdateEvent<double>* const declared = events.front();
+
+  context_.SetTime(6.0);
+  EXPECT_EQ(system_.CalcNextUpdateTime(context_, event_info_.get()), 15.0);
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(events.front(), declared);
+
+  // Merging refers to the same event, but copies owned events.
+  LeafCompositeEventCollection<double> merged;
+  merged.AddToEnd(*event_info_);
+  merged.add_discrete_update_event(
+      std::make_unique<DiscreteUpdateEvent<double>>(TriggerType::kForced));
+  LeafCompositeEventCollection<double> merged_again;
+  merged_again.AddToEnd(merged);
+  const auto& merged_events =
+      merged_again.get_discrete_update_events().get_events();
+  ASSERT_EQ(merged_events.size(), 2);
+  EXPECT_EQ(merged_events[0], declared);
+  EXPECT_NE(merged_events[1],
+            merged.get_discrete_update_events().get_events()[1]);
+  EXPECT_EQ(merged_events[1]->get_trigger_type(), TriggerType::kForced);
+}
+
 // Tests that if the integrator has stopped on the k-th sample, and the current
 // time for that sample is slightly less than k * period due to floating point
 // rounding, the next sample time is (k + 1) * period.
@@ -1380,6 +1437,54 @@ GTEST_TEST(ModelLeafSystemTest, ModelAbstractState) {
   EXPECT_EQ(default_context->get_abstract_state<std::string>(1), "wow");
 }
 
+// Tests that ResetContext() restores the defaults of every Context field in
+// place, without replacing the storage.
+GTEST_TEST(ModelLeafSystemTest, ResetContext) {
+  class ResettableSystem : public LeafSystem<double> {
+   public:
+    ResettableSystem() {
+      DeclareContinuousState(BasicVector<double>(Vector2d(1., 2.)));
+      DeclareDiscreteState(Vector3d(3., 4., 5.));
+      DeclareDiscreteState(2);
+      DeclareAbstractState(AbstractValue::Make<std::string>("wow"));
+      DeclareNumericParameter(BasicVector<double>(Vector2d(6., 7.)));
+      DeclareAbstractParameter(Value<int>(8));
+    }
+  };
+
+  ResettableSystem dut;
+  auto context = dut.CreateDefaultContext();
+  const double* xc_data =
+      &context->get_continuous_state_vector().GetAtIndex(0);
+  const BasicVector<double>* xd0 = &context->get_discrete_state(0);
+  const std::string* xa = &context->get_abstract_state<std::string>(0);
+
+  context->SetTime(1.5);
+  context->SetAccuracy(1e-3);
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      Vector2d(10., 20.));
+  context->get_mutable_discrete_state(0).SetFromVector(Vector3d(0., 0., 0.));
+  context->get_mutable_discrete_state(1).SetFromVector(Vector2d(9., 9.));
+  context->get_mutable_abstract_state<std::string>(0) = "whoops";
+  context->get_mutable_numeric_parameter(0).SetFromVector(Vector2d(0., 0.));
+  context->get_mutable_abstract_parameter(0).set_value<int>(0);
+
+  dut.ResetContext(context.get());
+  EXPECT_EQ(context->get_time(), 0.0);
+  EXPECT_FALSE(context->get_accuracy().has_value());
+  EXPECT_EQ(context->get_continuous_state_vector().CopyToVector(),
+            Vector2d(1., 2.));
+  EXPECT_EQ(context->get_discrete_state(0).get_value(), Vector3d(3., 4., 5.));
+  EXPECT_EQ(context->get_discrete_state(1).get_value(), Vector2d(0., 0.));
+  EXPECT_EQ(context->get_abstract_state<std::string>(0), "wow");
+  EXPECT_EQ(context->get_numeric_parameter(0).get_value(), Vector2d(6., 7.));
+  EXPECT_EQ(context->get_abstract_parameter(0).get_value<int>(), 8);
+
+  // The values were restored in place.
+  EXPECT_EQ(&context->get_continuous_state_vector().GetAtIndex(0), xc_data);
+  EXPECT_EQ(&context->get_discrete_state(0), xd0);
+  EXPECT_EQ(&context->get_abstract_state<std::string>(0), xa);
+}
 
 // A system that exercises the non-model based output port declarations.
 // These include declarations that take only a calculator function and use
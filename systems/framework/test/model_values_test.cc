@@ -46,6 +46,12 @@ GTEST_TEST(ModelValuesTest, AbstractValueTest) {
   // Unknown indices are nullptr.
   EXPECT_EQ(dut.CloneModel(1000000).get(), nullptr);
 
+  // GetModel() refers to the same models without cloning them.
+  EXPECT_EQ(dut.GetModel(0), nullptr);
+  EXPECT_EQ(dut.GetModel(1)->get_value<int>(), 11);
+  EXPECT_EQ(dut.GetModel(1), dut.GetModel(1));
+  EXPECT_EQ(dut.GetModel(1000000), nullptr);
+
   // Test CloneAllModels().
   auto cloned_vec = dut.CloneAllModels();
   EXPECT_EQ(cloned_vec.size(), 100);
@@ -93,6 +99,13 @@ GTEST_TEST(ModelValuesTest, VectorValueTest) {
   MyVector2d* const my_vector = dynamic_cast<MyVector2d*>(basic_vector.get());
   ASSERT_NE(my_vector, nullptr);
 
+  // GetVectorModel() refers to the same vectors without cloning them.
+  EXPECT_EQ(dut.GetVectorModel<double>(0), nullptr);
+  EXPECT_EQ(dut.GetVectorModel<double>(3)->GetAtIndex(1), 34);
+  EXPECT_NE(dynamic_cast<const MyVector2d*>(dut.GetVectorModel<double>(5)),
+            nullptr);
+  EXPECT_THROW(dut.GetVectorModel<double>(1), std::exception);
+
   // Various wrong access patterns throw.
   EXPECT_THROW(dut.CloneVectorModel<double>(1), std::exception);
   EXPECT_THROW(dut.CloneVectorModel<AutoDiffXd>(3), std::exception);
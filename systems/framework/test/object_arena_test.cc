@@ -0,0 +1,100 @@
+#include "drake/systems/framework/object_arena.h"
+
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+namespace {
+
+// Records its construction and destruction in the given log. The constructor
+// is private, as it is for the arena's clients in the framework.
+class Widget {
+ public:
+  ~Widget() { log_->push_back(-id_); }
+
+  int id() const { return id_; }
+
+  static Widget* MakeAt(void* storage, int id, std::vector<int>* log) {
+    if (id < 0) throw std::runtime_error("bad id");
+    return new (storage) Widget(id, log);
+  }
+
+ private:
+  Widget(int id, std::vector<int>* log) : id_(id), log_(log) {
+    log_->push_back(id_);
+  }
+
+  int id_{};
+  std::vector<int>* log_{};
+};
+
+// Objects keep their addresses as more are created, and are destroyed in the
+// reverse order of their creation.
+GTEST_TEST(ObjectArenaTest, StableAddressesAndDestructionOrder) {
+  std::vector<int> log;
+  {
+    ObjectArena<Widget> arena;
+    EXPECT_EQ(arena.size(), 0);
+    EXPECT_EQ(arena.num_blocks(), 0);
+    std::vector<Widget*> widgets;
+    for (int i = 1; i <= 100; ++i) {
+      widgets.push_back(arena.Create([&](void* storage) {
+        return Widget::MakeAt(storage, i, &log);
+      }));
+    }
+    EXPECT_EQ(arena.size(), 100);
+    // Geometric growth means far fewer blocks than objects.
+    EXPECT_LT(arena.num_blocks(), 10);
+    for (int i = 1; i <= 100; ++i) EXPECT_EQ(widgets[i - 1]->id(), i);
+  }
+  ASSERT_EQ(log.size(), 200);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(log[i], i + 1);
+    EXPECT_EQ(log[100 + i], -(100 - i));
+  }
+}
+
+// A reservation is satisfied by a single block.
+GTEST_TEST(ObjectArenaTest, Reserve) {
+  std::vector<int> log;
+  ObjectArena<Widget> arena;
+  arena.Reserve(1000);
+  EXPECT_EQ(arena.num_blocks(), 1);
+  for (int i = 1; i <= 1000; ++i) {
+    arena.Create([&](void* storage) {
+      return Widget::MakeAt(storage, i, &log);
+    });
+  }
+  EXPECT_EQ(arena.num_blocks(), 1);
+  EXPECT_EQ(arena.size(), 1000);
+}
+
+// A failed construction leaves the arena unchanged.
+GTEST_TEST(ObjectArenaTest, ConstructorThrows) {
+  std::vector<int> log;
+  {
+    ObjectArena<Widget> arena;
+    arena.Create([&](void* storage) {
+      return Widget::MakeAt(storage, 1, &log);
+    });
+    EXPECT_THROW(arena.Create([&](void* storage) {
+      return Widget::MakeAt(storage, -1, &log);
+    }), std::runtime_error);
+    EXPECT_EQ(arena.size(), 1);
+    arena.Create([&](void* storage) {
+      return Widget::MakeAt(storage, 2, &log);
+    });
+    EXPECT_EQ(arena.size(), 2);
+  }
+  EXPECT_EQ(log, std::vector<int>({1, 2, -2, -1}));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
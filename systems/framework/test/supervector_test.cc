@@ -99,6 +99,49 @@ TEST_F(SupervectorTest, SetFrom) {
   EXPECT_THROW(supervector_->SetFrom(*bad_value), std::exception);
 }
 
+// Tests the bulk operations that visit each subvector once.
+TEST_F(SupervectorTest, BulkOperations) {
+  const Eigen::VectorXd expected = Eigen::VectorXd::LinSpaced(kLength, 0, 8);
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+
+  Eigen::VectorXd copy(kLength);
+  supervector_->CopyToPreSizedVector(&copy);
+  EXPECT_EQ(copy, expected);
+
+  Eigen::VectorXd sum = Eigen::VectorXd::Ones(kLength);
+  supervector_->ScaleAndAddToVector(2.0, &sum);
+  EXPECT_EQ(sum, Eigen::VectorXd::Ones(kLength) + 2.0 * expected);
+
+  supervector_->SetZero();
+  EXPECT_EQ(supervector_->CopyToVector(), Eigen::VectorXd::Zero(kLength));
+  EXPECT_EQ(vec4_->GetAtIndex(2), 0.0);
+
+  Eigen::VectorXd wrong_size(3);
+  EXPECT_THROW(supervector_->CopyToPreSizedVector(&wrong_size),
+               std::exception);
+  EXPECT_THROW(supervector_->ScaleAndAddToVector(1.0, &wrong_size),
+               std::exception);
+}
+
+// Tests PlusEqScaled() both with operands partitioned as the supervector,
+// which operate subvector by subvector, and with other operands.
+TEST_F(SupervectorTest, PlusEqScaled) {
+  auto rhs1 = BasicVector<double>::Make({1, 1, 1, 1});
+  auto rhs2 = BasicVector<double>::Make({2, 2});
+  auto rhs3 = BasicVector<double>::Make({});
+  auto rhs4 = BasicVector<double>::Make({3, 3, 3});
+  const Supervector<double> same_partition(std::vector<VectorBase<double>*>{
+      rhs1.get(), rhs2.get(), rhs3.get(), rhs4.get()});
+  const Eigen::VectorXd rhs_value = same_partition.CopyToVector();
+  const Eigen::VectorXd initial = supervector_->CopyToVector();
+  supervector_->PlusEqScaled({{2.0, same_partition}, {-1.0, same_partition}});
+  EXPECT_EQ(supervector_->CopyToVector(), initial + rhs_value);
+
+  const BasicVector<double> contiguous(rhs_value);
+  supervector_->PlusEqScaled({{-1.0, contiguous}, {0.5, same_partition}});
+  EXPECT_EQ(supervector_->CopyToVector(), initial + 0.5 * rhs_value);
+}
+
 TEST_F(SupervectorTest, Empty) {
   Supervector<double> supervector(std::vector<VectorBase<double>*>{});
   EXPECT_EQ(0, supervector.size());
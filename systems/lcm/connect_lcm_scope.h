@@ -18,7 +18,10 @@ namespace lcm {
  avoided).
 
  The intention is to enable logging and debugging in complex diagrams
- using external tools like `lcm-spy`.
+ using external tools like `lcm-spy`. Passing a drake::lcm::DrakeLcmLog in
+ write mode as @p lcm instead streams the samples to a log file as they are
+ published, which is an alternative to SignalLogger for logs that are too
+ large to hold in memory.
 
  The optional @p publish_period specifies how often messages will be published.
  If the period is zero (the default), then the underlying LcmPublisherSystem
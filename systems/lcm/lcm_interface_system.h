@@ -50,7 +50,9 @@ class LcmInterfaceSystem final
   /**
    * Constructs using the given LCM service.  The pointer is aliased by this
    * class and must remain valid for the lifetime of this object.  Users MUST
-   * NOT start the receive thread on this object.
+   * NOT call HandleSubscriptions() on `lcm` from any other thread; this System
+   * pumps it synchronously while the Simulator is computing its next event,
+   * so that subscriber handlers never race with the simulation.
    */
   explicit LcmInterfaceSystem(drake::lcm::DrakeLcmInterface* lcm);
 
@@ -38,6 +38,12 @@ using TriggerTypeSet = std::unordered_set<TriggerType, DefaultHash>;
  * interface in your program, you can let %LcmPublisherSystem allocate and
  * maintain a drake::lcm::DrakeLcm object internally.
  *
+ * @note Each message is encoded and sent synchronously within the publish
+ * event, so that the published messages exactly reflect the Context at the
+ * event time. For large messages (e.g., images or contact results), prefer a
+ * periodic publish trigger with a publish_period that is no faster than the
+ * consumer needs, rather than publishing per step.
+ *
  * @system
  * name: LcmPublisherSystem
  * input_ports:
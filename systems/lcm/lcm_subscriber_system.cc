@@ -78,14 +78,19 @@ LcmSubscriberSystem::~LcmSubscriberSystem() {
 systems::EventStatus LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
     const Context<double>&, State<double>* state) const {
   AbstractValues& abstract_state = state->get_mutable_abstract_state();
+  int& message_count = abstract_state.get_mutable_value(
+      kStateIndexMessageCount).get_mutable_value<int>();
   std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  // The message count in `state` tells which message its message value holds,
+  // so there is nothing to decode when it already holds the latest one (e.g.,
+  // for repeated forced updates). Large messages are thus decoded at most once
+  // per received message for a given `state`.
+  if (!received_message_.empty() && message_count != received_message_count_) {
     serializer_->Deserialize(
         received_message_.data(), received_message_.size(),
         &abstract_state.get_mutable_value(kStateIndexMessage));
   }
-  abstract_state.get_mutable_value(kStateIndexMessageCount)
-      .get_mutable_value<int>() = received_message_count_;
+  message_count = received_message_count_;
 
   return systems::EventStatus::Succeeded();
 }
@@ -159,8 +164,9 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
   const uint8_t* const rbuf_end = rbuf_begin + size;
   std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
+  // Reuses the capacity of the buffer, so that messages of a steady size do
+  // not reallocate.
+  received_message_.assign(rbuf_begin, rbuf_end);
   received_message_count_++;
   received_message_condition_variable_.notify_all();
 }
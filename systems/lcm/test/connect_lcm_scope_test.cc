@@ -1,8 +1,11 @@
 #include "drake/systems/lcm/connect_lcm_scope.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/lcm/drake_lcm.h"
+#include "drake/lcm/drake_lcm_log.h"
 #include "drake/lcmt_drake_signal.hpp"
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -39,6 +42,44 @@ GTEST_TEST(ScopeTest, PublishTest) {
   }
 }
 
+// Scope a source into a log file, and read the samples back.
+GTEST_TEST(ScopeTest, LogFileTest) {
+  const std::string channel = "my_channel";
+  const std::string filename = "scope.log";
+  Eigen::VectorXd vec = Eigen::VectorXd::LinSpaced(3, 1.0, 2.0);
+  {
+    drake::lcm::DrakeLcmLog log(filename, true /* is_write */);
+    DiagramBuilder<double> builder;
+    auto source = builder.AddSystem<ConstantVectorSource>(vec);
+    ConnectLcmScope(source->get_output_port(), channel, &builder, &log);
+    auto diagram = builder.Build();
+    auto context = diagram->CreateDefaultContext();
+    for (double time : {0.0, 0.5}) {
+      context->SetTime(time);
+      diagram->Publish(*context);
+    }
+  }
+
+  drake::lcm::DrakeLcmLog log(filename, false /* is_write */);
+  std::vector<lcmt_drake_signal> messages;
+  drake::lcm::Subscribe<lcmt_drake_signal>(
+      &log, channel, [&messages](const auto& message) {
+        messages.push_back(message);
+      });
+  for (double time : {0.0, 0.5}) {
+    EXPECT_EQ(log.GetNextMessageTime(), time);
+    log.DispatchMessageAndAdvanceLog(time);
+  }
+  ASSERT_EQ(messages.size(), 2);
+  for (const auto& message : messages) {
+    ASSERT_EQ(message.dim, vec.size());
+    for (int i = 0; i < vec.size(); i++) {
+      EXPECT_EQ(message.val[i], vec[i]);
+    }
+  }
+  EXPECT_EQ(messages[1].timestamp, 500);
+}
+
 // Check that publish_period defaults to zero, or can be set by the user.
 GTEST_TEST(ScopeTest, PeriodTest) {
   DiagramBuilder<double> builder;
@@ -2,6 +2,8 @@
 
 #include <array>
 #include <future>
+#include <memory>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -77,6 +79,56 @@ GTEST_TEST(LcmSubscriberSystemTest, ForcedEventTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(value, sample_data.value));
 }
 
+// A Serializer that counts its calls to Deserialize().
+class CountingSerializer : public Serializer<lcmt_drake_signal> {
+ public:
+  void Deserialize(const void* message_bytes, int message_length,
+                   AbstractValue* abstract_value) const override {
+    ++num_deserialize;
+    Serializer<lcmt_drake_signal>::Deserialize(message_bytes, message_length,
+                                               abstract_value);
+  }
+
+  mutable int num_deserialize{0};
+};
+
+// Tests that a message is only decoded into a State that does not hold it yet.
+GTEST_TEST(LcmSubscriberSystemTest, DecodeOnceTest) {
+  drake::lcm::DrakeLcm lcm;
+  const std::string channel_name = "channel_name";
+
+  auto serializer = std::make_unique<CountingSerializer>();
+  const CountingSerializer* const counter = serializer.get();
+  LcmSubscriberSystem dut(channel_name, std::move(serializer), &lcm);
+  std::unique_ptr<Context<double>> context = dut.CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut.AllocateOutput();
+
+  SampleData sample_data;
+  sample_data.PublishAndHandle(&lcm, channel_name);
+
+  // The first update decodes the message.
+  std::unique_ptr<State<double>> tmp_state = context->CloneState();
+  dut.CalcUnrestrictedUpdate(*context, tmp_state.get());
+  context->get_mutable_state().SetFrom(*tmp_state);
+  EXPECT_EQ(counter->num_deserialize, 1);
+
+  // Updates of a State that already holds the message do not decode again.
+  dut.CalcUnrestrictedUpdate(*context, tmp_state.get());
+  EXPECT_EQ(counter->num_deserialize, 1);
+  dut.CalcOutput(*context, output.get());
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), sample_data.value));
+
+  // A State that holds an older message decodes the latest one.
+  std::unique_ptr<State<double>> stale_state =
+      dut.CreateDefaultContext()->CloneState();
+  dut.CalcUnrestrictedUpdate(*context, stale_state.get());
+  EXPECT_EQ(counter->num_deserialize, 2);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      stale_state->get_abstract_state<lcmt_drake_signal>(0),
+      sample_data.value));
+}
+
 // Tests LcmSubscriberSystem using a Serializer.
 GTEST_TEST(LcmSubscriberSystemTest, ReceiveTest) {
   drake::lcm::DrakeLcm lcm;
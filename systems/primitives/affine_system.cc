@@ -1,5 +1,6 @@
 #include "drake/systems/primitives/affine_system.h"
 
+#include <optional>
 #include <utility>
 
 #include <Eigen/Eigenvalues>
@@ -223,6 +224,38 @@ bool IsMeaningful(const Eigen::MatrixXd& D) {
   return D.size() > 0 && (D.array() != 0).any();
 }
 
+// Returns a sparse copy of `M` if at most a quarter of its entries are
+// nonzero, so that a sparse product is cheaper than a dense one, or nullopt
+// otherwise.
+std::optional<Eigen::SparseMatrix<double>> MaybeMakeSparse(
+    const Eigen::MatrixXd& M) {
+  const Eigen::Index num_nonzeros = (M.array() != 0).count();
+  if (M.size() == 0 || num_nonzeros > M.size() / 4) {
+    return std::nullopt;
+  }
+  return Eigen::SparseMatrix<double>(M.sparseView());
+}
+
+// Adds M * x to `y`, using M_sparse (the sparse copy of M) if there is one.
+// The sparse product is written out so that it supports any scalar type T.
+template <typename T, typename XDerived, typename YDerived>
+void AddProduct(const Eigen::MatrixXd& M,
+                const std::optional<Eigen::SparseMatrix<double>>& M_sparse,
+                const Eigen::MatrixBase<XDerived>& x,
+                Eigen::MatrixBase<YDerived>* y) {
+  if (!M_sparse) {
+    *y += M * x;
+    return;
+  }
+  for (int k = 0; k < M_sparse->outerSize(); ++k) {
+    const T& x_k = x(k);
+    for (Eigen::SparseMatrix<double>::InnerIterator it(*M_sparse, k); it;
+         ++it) {
+      (*y)(it.row()) += it.value() * x_k;
+    }
+  }
+}
+
 }  // namespace
 
 // Our protected constructor does all of the real work -- everything else
@@ -246,7 +279,11 @@ AffineSystem<T>::AffineSystem(SystemScalarConverter converter,
       y0_(y0),
       // This check permits a workaround for inadvertent computational loops
       // (#12706).
-      has_meaningful_D_(IsMeaningful(D)) {
+      has_meaningful_D_(IsMeaningful(D)),
+      A_sparse_(MaybeMakeSparse(A_)),
+      B_sparse_(MaybeMakeSparse(B_)),
+      C_sparse_(MaybeMakeSparse(C_)),
+      D_sparse_(MaybeMakeSparse(D_)) {
   DRAKE_DEMAND(this->num_states() == A.rows());
   DRAKE_DEMAND(this->num_states() == A.cols());
   DRAKE_DEMAND(this->num_states() == B.rows());
@@ -311,11 +348,12 @@ void AffineSystem<T>::CalcOutputY(const Context<T>& context,
       : context.get_discrete_state().get_vector().get_value();
 
   auto y = output_vector->get_mutable_value();
-  y = C_ * x + y0_;
+  y = y0_.template cast<T>();
+  AddProduct<T>(C_, C_sparse_, x, &y);
 
   if (has_meaningful_D_ && this->num_inputs()) {
     const auto& u = this->get_input_port().Eval(context);
-    y += D_ * u;
+    AddProduct<T>(D_, D_sparse_, u, &y);
   }
 }
 
@@ -328,12 +366,13 @@ void AffineSystem<T>::DoCalcTimeDerivatives(
       dynamic_cast<const BasicVector<T>&>(context.get_continuous_state_vector())
           .get_value();
 
-  VectorX<T> xdot = A_ * x + f0_;
+  VectorX<T> xdot = f0_.template cast<T>();
+  AddProduct<T>(A_, A_sparse_, x, &xdot);
 
   if (this->num_inputs() > 0) {
     const auto& u = this->get_input_port().Eval(context);
 
-    xdot += B_ * u;
+    AddProduct<T>(B_, B_sparse_, u, &xdot);
   }
   derivatives->SetFromVector(xdot);
 }
@@ -347,12 +386,13 @@ void AffineSystem<T>::DoCalcDiscreteVariableUpdates(
 
   const auto& x = context.get_discrete_state(0).get_value();
 
-  VectorX<T> xnext = A_ * x + f0_;
+  VectorX<T> xnext = f0_.template cast<T>();
+  AddProduct<T>(A_, A_sparse_, x, &xnext);
 
   if (this->num_inputs() > 0) {
     const auto& u = this->get_input_port().Eval(context);
 
-    xnext += B_ * u;
+    AddProduct<T>(B_, B_sparse_, u, &xnext);
   }
   updates->get_mutable_vector().SetFromVector(xnext);
 }
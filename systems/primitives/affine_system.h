@@ -1,8 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
@@ -181,6 +184,10 @@ class TimeVaryingAffineSystem : public LeafSystem<T> {
 /// In both cases, the system will have the output:
 ///   @f[y = C x + D u + y_0, @f]
 ///
+/// When most of the entries of a coefficient matrix are zero, as is typical of
+/// large models, the system also keeps a sparse copy of it and uses sparse
+/// products in its derivative, update, and output computations.
+///
 /// @tparam_default_scalar
 ///
 /// @ingroup primitive_systems
@@ -286,6 +293,13 @@ class AffineSystem : public TimeVaryingAffineSystem<T> {
   const Eigen::MatrixXd D_;
   const Eigen::VectorXd y0_;
   const bool has_meaningful_D_{};
+
+  // Sparse copies of the coefficient matrices that are sparse enough for
+  // sparse products to pay off, or nullopt for the others.
+  const std::optional<Eigen::SparseMatrix<double>> A_sparse_;
+  const std::optional<Eigen::SparseMatrix<double>> B_sparse_;
+  const std::optional<Eigen::SparseMatrix<double>> C_sparse_;
+  const std::optional<Eigen::SparseMatrix<double>> D_sparse_;
 };
 
 }  // namespace systems
@@ -1,5 +1,7 @@
 #include "drake/systems/primitives/linear_system.h"
 
+#include <algorithm>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -90,7 +92,8 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     std::variant<OutputPortSelection, OutputPortIndex> output_port_index,
-    std::optional<double> equilibrium_check_tolerance = std::nullopt) {
+    std::optional<double> equilibrium_check_tolerance = std::nullopt,
+    std::optional<int> max_chunk_size = std::nullopt) {
   system.ValidateContext(context);
 
   double time_period = 0.0;
@@ -138,32 +141,77 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     u0 = system.get_input_port(input_port->get_index()).Eval(context);
   }
 
-  auto autodiff_args = math::initializeAutoDiffTuple(x0, u0);
-  if (input_port) {
-    VectorX<AutoDiffXd> input_vector = std::get<1>(autodiff_args);
-    input_port->FixValue(autodiff_context.get(), input_vector);
-  }
+  // The partial derivatives with respect to the num_vars variables (x, u) are
+  // computed in chunks of at most chunk_size variables, each with its own
+  // evaluation of the system. This bounds the size of the derivative vectors.
+  const int num_vars = num_states + num_inputs;
+  Eigen::VectorXd xu0(num_vars);
+  xu0 << x0, u0;
+  const int chunk_size = max_chunk_size.value_or(num_vars);
+  DRAKE_THROW_UNLESS(chunk_size > 0 || num_vars == 0);
+
+  Eigen::MatrixXd AB(num_states, num_vars);
+  Eigen::MatrixXd CD(num_outputs, num_vars);
+  Eigen::VectorXd xnext0(num_states);
+  Eigen::VectorXd y(num_outputs);
+  std::unique_ptr<ContinuousState<AutoDiffXd>> autodiff_xdot =
+      autodiff_system->AllocateTimeDerivatives();
+  std::unique_ptr<DiscreteValues<AutoDiffXd>> autodiff_x1 =
+      autodiff_system->AllocateDiscreteVariables();
+  int first_var = 0;
+  do {
+    // Seed the derivatives with respect to the variables of this chunk.
+    const int num_chunk_vars = std::min(chunk_size, num_vars - first_var);
+    VectorX<AutoDiffXd> autodiff_xu(num_vars);
+    for (int i = 0; i < num_vars; ++i) {
+      autodiff_xu(i).value() = xu0(i);
+      autodiff_xu(i).derivatives() = Eigen::VectorXd::Zero(num_chunk_vars);
+      if (first_var <= i && i < first_var + num_chunk_vars) {
+        autodiff_xu(i).derivatives()(i - first_var) = 1.0;
+      }
+    }
+    if (input_port) {
+      input_port->FixValue(autodiff_context.get(),
+                           VectorX<AutoDiffXd>(autodiff_xu.tail(num_inputs)));
+    }
+
+    if (num_states > 0) {
+      VectorX<AutoDiffXd> autodiff_xnext_vec;
+      if (autodiff_context->has_only_continuous_state()) {
+        autodiff_context->get_mutable_continuous_state_vector().SetFromVector(
+            autodiff_xu.head(num_states));
+        autodiff_system->CalcTimeDerivatives(*autodiff_context,
+                                             autodiff_xdot.get());
+        autodiff_xnext_vec = autodiff_xdot->CopyToVector();
+      } else {
+        DRAKE_ASSERT(is_discrete_system);
+        autodiff_context->get_mutable_discrete_state()
+            .get_mutable_vector()
+            .SetFromVector(autodiff_xu.head(num_states));
+        autodiff_system->CalcDiscreteVariableUpdates(*autodiff_context,
+                                                     autodiff_x1.get());
+        autodiff_xnext_vec = autodiff_x1->get_vector().CopyToVector();
+      }
+      AB.middleCols(first_var, num_chunk_vars) =
+          math::autoDiffToGradientMatrix(autodiff_xnext_vec, num_chunk_vars);
+      xnext0 = math::autoDiffToValueMatrix(autodiff_xnext_vec);
+    }
 
-  Eigen::MatrixXd A(num_states, num_states), B(num_states, num_inputs);
+    if (output_port) {
+      const auto& autodiff_y0 = output_port->Eval(*autodiff_context);
+      CD.middleCols(first_var, num_chunk_vars) =
+          math::autoDiffToGradientMatrix(autodiff_y0, num_chunk_vars);
+      y = math::autoDiffToValueMatrix(autodiff_y0);
+    }
+    first_var += num_chunk_vars;
+  } while (first_var < num_vars);
+
+  const Eigen::MatrixXd A = AB.leftCols(num_states);
+  const Eigen::MatrixXd B = AB.rightCols(num_inputs);
   Eigen::VectorXd f0(num_states);
   if (num_states > 0) {
     if (autodiff_context->has_only_continuous_state()) {
-      autodiff_context->get_mutable_continuous_state_vector().SetFromVector(
-          std::get<0>(autodiff_args));
-      std::unique_ptr<ContinuousState<AutoDiffXd>> autodiff_xdot =
-          autodiff_system->AllocateTimeDerivatives();
-      autodiff_system->CalcTimeDerivatives(*autodiff_context,
-                                           autodiff_xdot.get());
-      auto autodiff_xdot_vec = autodiff_xdot->CopyToVector();
-
-      const Eigen::MatrixXd AB =
-          math::autoDiffToGradientMatrix(autodiff_xdot_vec);
-      A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
-
-      const Eigen::VectorXd xdot0 =
-          math::autoDiffToValueMatrix(autodiff_xdot_vec);
-
+      const Eigen::VectorXd& xdot0 = xnext0;
       if (equilibrium_check_tolerance &&
           !xdot0.isZero(*equilibrium_check_tolerance)) {
         throw std::runtime_error(
@@ -172,26 +220,9 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
             "the system.  Without additional information, a time-invariant "
             "linearization of this system is not well defined.");
       }
-
       f0 = xdot0 - A * x0 - B * u0;
     } else {
-      DRAKE_ASSERT(is_discrete_system);
-      auto& autodiff_x0 =
-          autodiff_context->get_mutable_discrete_state().get_mutable_vector();
-      autodiff_x0.SetFromVector(std::get<0>(autodiff_args));
-      std::unique_ptr<DiscreteValues<AutoDiffXd>> autodiff_x1 =
-          autodiff_system->AllocateDiscreteVariables();
-      autodiff_system->CalcDiscreteVariableUpdates(*autodiff_context,
-                                                   autodiff_x1.get());
-      auto autodiff_x1_vec = autodiff_x1->get_vector().CopyToVector();
-
-      const Eigen::MatrixXd AB =
-          math::autoDiffToGradientMatrix(autodiff_x1_vec);
-      A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
-
-      const Eigen::VectorXd x1 = math::autoDiffToValueMatrix(autodiff_x1_vec);
-
+      const Eigen::VectorXd& x1 = xnext0;
       if (equilibrium_check_tolerance &&
           !(x1 - x0).isZero(*equilibrium_check_tolerance)) {
         throw std::runtime_error(
@@ -199,14 +230,8 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
             "of the system.  Without additional information, a time-invariant "
             "linearization of this system is not well defined.");
       }
-
       f0 = x1 - A * x0 - B * u0;
     }
-  } else {
-    DRAKE_ASSERT(num_states == 0);
-    A = Eigen::MatrixXd(0, 0);
-    B = Eigen::MatrixXd(0, num_inputs);
-    f0 = Eigen::VectorXd(0);
   }
 
   Eigen::MatrixXd C = Eigen::MatrixXd::Zero(num_outputs, num_states);
@@ -214,13 +239,9 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
   Eigen::VectorXd y0 = Eigen::VectorXd::Zero(num_outputs);
 
   if (output_port) {
-    const auto& autodiff_y0 = output_port->Eval(*autodiff_context);
-    const Eigen::MatrixXd CD = math::autoDiffToGradientMatrix(autodiff_y0);
     C = CD.leftCols(num_states);
     D = CD.rightCols(num_inputs);
 
-    const Eigen::VectorXd y = math::autoDiffToValueMatrix(autodiff_y0);
-
     // Note: No tolerance check needed here.  We have defined that the output
     // for the system produced by Linearize is in the coordinates (y-y0).
 
@@ -237,11 +258,12 @@ std::unique_ptr<LinearSystem<double>> Linearize(
     const System<double>& system, const Context<double>& context,
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     std::variant<OutputPortSelection, OutputPortIndex> output_port_index,
-    double equilibrium_check_tolerance) {
+    double equilibrium_check_tolerance, std::optional<int> max_chunk_size) {
   std::unique_ptr<AffineSystem<double>> affine =
       DoFirstOrderTaylorApproximation(
           system, context, std::move(input_port_index),
-          std::move(output_port_index), equilibrium_check_tolerance);
+          std::move(output_port_index), equilibrium_check_tolerance,
+          max_chunk_size);
 
   return std::make_unique<LinearSystem<double>>(affine->A(), affine->B(),
                                                 affine->C(), affine->D(),
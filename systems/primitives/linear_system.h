@@ -150,12 +150,19 @@ class TimeVaryingLinearSystem : public TimeVaryingAffineSystem<T> {
 /// an OutputPortSelection. @default kUseFirstOutputIfItExists.
 /// @param equilibrium_check_tolerance Specifies the tolerance on ensuring that
 /// the derivative vector isZero at the nominal operating point.  @default 1e-6.
+/// @param max_chunk_size If given, the partial derivatives with respect to the
+/// state and input are computed in chunks of at most this many variables, with
+/// one evaluation of the system per chunk. Smaller chunks bound the size of the
+/// autodiff derivative vectors, which reduces the memory use and can be faster
+/// for large systems. By default, all partials are computed in a single
+/// evaluation.
 /// @returns A LinearSystem that approximates the original system in the
 /// vicinity of the operating point.  See note below.
 /// @throws std::runtime_error if the operating point is not an
 /// equilibrium point of the system (within the specified tolerance)
 /// @throws std::runtime_error if the system is not (only)
 /// continuous or (only) discrete time with a single periodic update.
+/// @throws std::exception if @p max_chunk_size is not positive.
 ///
 /// @note All _vector_ inputs in the system must be connected, either to the
 /// output of some upstream System within a Diagram (e.g., if system is a
@@ -180,7 +187,8 @@ std::unique_ptr<LinearSystem<double>> Linearize(
         InputPortSelection::kUseFirstInputIfItExists,
     std::variant<OutputPortSelection, OutputPortIndex> output_port_index =
         OutputPortSelection::kUseFirstOutputIfItExists,
-    double equilibrium_check_tolerance = 1e-6);
+    double equilibrium_check_tolerance = 1e-6,
+    std::optional<int> max_chunk_size = std::nullopt);
 
 /// A first-order Taylor series approximation to a @p system in the neighborhood
 /// of an arbitrary point.  When Taylor-expanding a system at a non-equilibrium
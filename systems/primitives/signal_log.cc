@@ -1,7 +1,10 @@
 #include "drake/systems/primitives/signal_log.h"
 
+#include <algorithm>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 
 namespace drake {
 namespace systems {
@@ -17,24 +20,54 @@ SignalLog<T>::SignalLog(int input_size, int batch_allocation_size)
 
 template <typename T>
 void SignalLog<T>::AddData(T time, VectorX<T> sample) {
-  if (num_samples_ == 0 || time >= sample_times_(num_samples_ - 1))
-    ++num_samples_;
-
-  // If num_samples exceeds the current allocation, then do a conservative
-  // resize (ouch!).
-  // TODO(russt): change to allocating on a std::vector here and moving into a
-  // single block of contiguous memory on the (first) data access, to avoid the
-  // O(n^2) complexity.
+  if (num_samples_ == 0 ||
+      time >= sample_times_(StorageIndex(num_samples_ - 1))) {
+    if (max_samples_ > 0 && num_samples_ == max_samples_) {
+      // The bounded log is full; discard its oldest sample.
+      first_sample_ = (first_sample_ + 1) % max_samples_;
+    } else {
+      ++num_samples_;
+    }
+  }
+
+  // If num_samples exceeds the current allocation, then grow the allocation
+  // geometrically (but by at least a batch, and no more than the bound) so
+  // that the conservative resizes cost amortized O(1) per sample.
   if (num_samples_ > sample_times_.size()) {
-    sample_times_.conservativeResize(sample_times_.size() +
-        batch_allocation_size_);
-    data_.conservativeResize(data_.rows(),
-                             data_.cols() + batch_allocation_size_);
+    int64_t new_size = sample_times_.size() +
+        std::max<int64_t>(batch_allocation_size_, sample_times_.size());
+    if (max_samples_ > 0) {
+      new_size = std::min<int64_t>(new_size, max_samples_);
+    }
+    sample_times_.conservativeResize(new_size);
+    data_.conservativeResize(data_.rows(), new_size);
   }
 
   // Record time and input to the num_samples position.
-  sample_times_(num_samples_ - 1) = time;
-  data_.col(num_samples_ - 1) = sample;
+  const int64_t index = StorageIndex(num_samples_ - 1);
+  sample_times_(index) = time;
+  data_.col(index) = sample;
+}
+
+template <typename T>
+void SignalLog<T>::set_max_samples(int max_samples) {
+  DRAKE_THROW_UNLESS(max_samples > 0);
+  DRAKE_THROW_UNLESS(num_samples_ == 0);
+  max_samples_ = max_samples;
+}
+
+template <typename T>
+void SignalLog<T>::MakeContiguous() const {
+  if (first_sample_ == 0) return;
+  DRAKE_DEMAND(num_samples_ == max_samples_);
+  // The data is stored column-major, so rotating its columns is rotating its
+  // underlying array by whole columns.
+  const int64_t rows = data_.rows();
+  std::rotate(sample_times_.data(), sample_times_.data() + first_sample_,
+              sample_times_.data() + num_samples_);
+  std::rotate(data_.data(), data_.data() + first_sample_ * rows,
+              data_.data() + num_samples_ * rows);
+  first_sample_ = 0;
 }
 
 }  // namespace systems
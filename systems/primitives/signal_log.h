@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 
@@ -21,22 +23,26 @@ class SignalLog {
 
   /** Constructs the signal log.
    @param input_size                Dimension of the per-time step data set.
-   @param batch_allocation_size     Storage is (re)allocated in blocks of size
-                                    (input_size X batch_allocation_size).
+   @param batch_allocation_size     Storage is initially allocated for
+                                    batch_allocation_size samples, and then
+                                    grows geometrically as needed.
   */
   explicit SignalLog(int input_size, int batch_allocation_size = 1000);
 
-  /** Returns the number of samples taken since construction or last reset(). */
+  /** Returns the number of samples taken since construction or last reset(),
+   or the number of retained samples if set_max_samples() has been called. */
   int num_samples() const { return num_samples_; }
 
   /** Accesses the logged time stamps. */
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
+    MakeContiguous();
     return const_cast<const VectorX<T>&>(sample_times_).head(num_samples_);
   }
 
   /** Accesses the logged data. */
   Eigen::Block<const MatrixX<T>, Eigen::Dynamic, Eigen::Dynamic, true> data()
   const {
+    MakeContiguous();
     return const_cast<const MatrixX<T>&>(data_).leftCols(num_samples_);
   }
 
@@ -45,6 +51,7 @@ class SignalLog {
     // Resetting num_samples_ is sufficient to have all future writes and
     // reads re-initialized to the beginning of the data.
     num_samples_ = 0;
+    first_sample_ = 0;
   }
 
   /** Adds a `sample` to the data set with the associated `time` value.
@@ -54,14 +61,43 @@ class SignalLog {
    */
   void AddData(T time, VectorX<T> sample);
 
+  /** Bounds the memory of the log by only retaining its `max_samples` most
+   recent samples. Once the log is full, each new sample overwrites the
+   oldest one in place, so that no memory is allocated anymore.
+   @throws std::exception if `max_samples` is not positive or if samples
+   have already been logged. */
+  void set_max_samples(int max_samples);
+
+  /** Returns the maximum number of retained samples, or std::nullopt if the
+   log is unbounded. */
+  std::optional<int> get_max_samples() const {
+    if (max_samples_ == 0) return std::nullopt;
+    return max_samples_;
+  }
+
   /** Reports the size of the log's input vector. */
   int64_t get_input_size() const { return data_.rows(); }
 
  private:
   const int batch_allocation_size_{1000};
 
-  // Use mutable variables to hold the logged data.
+  // Returns the storage column of the i-th oldest retained sample.
+  int64_t StorageIndex(int64_t i) const {
+    if (max_samples_ == 0) return i;
+    return (first_sample_ + i) % max_samples_;
+  }
+
+  // Rotates the storage of a full bounded log so that the oldest sample is in
+  // the first column, as the accessors expect.
+  void MakeContiguous() const;
+
+  // The maximum number of retained samples, or zero when unbounded.
+  int max_samples_{0};
+
+  // Use mutable variables to hold the logged data. When the log is bounded
+  // and full, the storage is a ring whose oldest sample is at first_sample_.
   mutable int64_t num_samples_{0};
+  mutable int64_t first_sample_{0};
   mutable VectorX<T> sample_times_;
   mutable MatrixX<T> data_;
 };
@@ -24,6 +24,9 @@ template <typename T>
 template <typename U>
 SignalLogger<T>::SignalLogger(const SignalLogger<U>& other)
     : SignalLogger<T>(other.get_input_port().size()) {
+  if (other.log_.get_max_samples()) {
+    this->set_max_samples(*other.log_.get_max_samples());
+  }
   switch (static_cast<LoggingMode>(other.logging_mode_)) {
     case kPeriodic: {
       const auto& events = other.GetPeriodicEvents();
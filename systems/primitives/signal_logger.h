@@ -41,6 +41,8 @@ namespace systems {
 /// You would have to have separate Diagrams in each thread to avoid trouble.
 ///
 /// @see LogOutput() for a convenient way to add %logging to a Diagram.
+/// @see systems::lcm::ConnectLcmScope() with a drake::lcm::DrakeLcmLog, to
+///   stream samples to a file instead of holding them in memory.
 /// @see Simulator::set_publish_every_time_step()
 /// @see Simulator::set_publish_at_initialization()
 ///
@@ -59,15 +61,16 @@ class SignalLogger final : public LeafSystem<T> {
 
   /// Constructs the signal logger system.
   ///
-  /// @warning %SignalLogger may become slower and slower as the number of
-  /// log entries increases due to memory reallocations. You can avoid that by
-  /// providing a `batch_allocation_size` comparable to the total expected
-  /// number of log entries for your simulation.
+  /// @note The storage grows geometrically, so logging costs amortized O(1)
+  /// per entry. You can avoid reallocations altogether by providing a
+  /// `batch_allocation_size` comparable to the total expected number of log
+  /// entries for your simulation. For long simulations, see also
+  /// set_max_samples() to bound the memory of the log.
   ///
   /// @param input_size Dimension of the (single) input port. This corresponds
   /// to the number of rows of the data matrix.
-  /// @param batch_allocation_size Storage is (re)allocated in blocks of
-  /// input_size-by-batch_allocation_size.
+  /// @param batch_allocation_size Storage is initially allocated for
+  /// batch_allocation_size entries, and then grows geometrically as needed.
   /// @see LogOutput() helper function for a convenient way to add %logging.
   explicit SignalLogger(int input_size, int batch_allocation_size = 1000);
 
@@ -90,7 +93,16 @@ class SignalLogger final : public LeafSystem<T> {
   /// @throws std::logic_error if set_publish_period() has been called.
   void set_forced_publish_only();
 
-  /// Returns the number of samples taken since construction or last reset().
+  /// Bounds the memory of the log by only retaining its `max_samples` most
+  /// recent entries. Once the log is full, each new entry overwrites the
+  /// oldest one, without allocating memory. Combine with set_publish_period()
+  /// to retain a fixed window of time.
+  /// @throws std::exception if `max_samples` is not positive or if entries
+  ///   have already been logged.
+  void set_max_samples(int max_samples) { log_.set_max_samples(max_samples); }
+
+  /// Returns the number of samples taken since construction or last reset(),
+  /// or the number of retained samples if set_max_samples() has been called.
   int num_samples() const { return log_.num_samples(); }
 
   /// Provides access to the sample times of the logged data. Time is taken
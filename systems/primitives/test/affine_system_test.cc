@@ -3,6 +3,7 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/systems/framework/test_utilities/scalar_conversion.h"
 #include "drake/systems/primitives/test/affine_linear_test.h"
 
@@ -206,6 +207,64 @@ TEST_F(FeedthroughAffineSystemTest, FeedthroughTest) {
   EXPECT_TRUE(dut_->HasAnyDirectFeedthrough());
 }
 
+// Tests that systems with mostly-zero coefficient matrices, which are
+// evaluated with sparse products, match the dense computations.
+GTEST_TEST(SparseAffineSystemTest, Evaluation) {
+  const int n = 8;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    A(i, i) = -1.0 - i;
+    A(i, (i + 3) % n) = 0.5 * i;
+  }
+  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(n, 2);
+  B(1, 0) = 2.0;
+  B(6, 1) = -3.0;
+  const Eigen::VectorXd f0 = Eigen::VectorXd::LinSpaced(n, -1.0, 1.0);
+  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(3, n);
+  C(0, 7) = 4.0;
+  C(2, 2) = 5.0;
+  // D is dense, and hence is evaluated densely.
+  Eigen::MatrixXd D(3, 2);
+  D << 1, 2, 3, 4, 5, 6;
+  const Eigen::Vector3d y0(0.1, 0.2, 0.3);
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(n, 0.3, 2.4);
+  const Eigen::Vector2d u(0.7, -0.2);
+
+  for (const double time_period : {0.0, 0.1}) {
+    const AffineSystem<double> double_dut(A, B, f0, C, D, y0, time_period);
+    const auto dut = double_dut.ToAutoDiffXd();
+    auto context = dut->CreateDefaultContext();
+    const VectorX<AutoDiffXd> x_ad = math::initializeAutoDiff(x);
+    if (time_period == 0.0) {
+      context->SetContinuousState(x_ad);
+    } else {
+      context->SetDiscreteState(x_ad);
+    }
+    dut->get_input_port(0).FixValue(context.get(),
+                                    u.cast<AutoDiffXd>().eval());
+
+    VectorX<AutoDiffXd> xnext;
+    if (time_period == 0.0) {
+      xnext = dut->EvalTimeDerivatives(*context).CopyToVector();
+    } else {
+      auto updates = dut->AllocateDiscreteVariables();
+      dut->CalcDiscreteVariableUpdates(*context, updates.get());
+      xnext = updates->get_vector().CopyToVector();
+    }
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(xnext),
+                                A * x + B * u + f0, 1e-14));
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(xnext), A,
+                                1e-14));
+
+    const VectorX<AutoDiffXd>& y =
+        dut->get_output_port(0).Eval(*context);
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y),
+                                C * x + D * u + y0, 1e-14));
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y), C,
+                                1e-14));
+  }
+}
+
 // Tests the discrete-time update.
 GTEST_TEST(DiscreteAffineSystemTest, DiscreteTime) {
   Eigen::Matrix3d A;
@@ -317,6 +317,44 @@ TEST_F(TestLinearizeFromAffine, DiscreteAtEquilibrium) {
                               MatrixCompareType::absolute));
 }
 
+// Test that computing the partial derivatives in chunks of various sizes gives
+// the same linearization.
+TEST_F(TestLinearizeFromAffine, ChunkedDerivatives) {
+  for (const AffineSystem<double>* system :
+       {continuous_system_.get(), discrete_system_.get()}) {
+    auto context = system->CreateDefaultContext();
+    system->get_input_port().FixValue(context.get(), u0_);
+    if (system->time_period() == 0.0) {
+      context->get_mutable_continuous_state_vector().SetFromVector(
+          xstar_continuous_);
+    } else {
+      context->get_mutable_discrete_state().get_mutable_vector().SetFromVector(
+          xstar_discrete_);
+    }
+
+    for (int max_chunk_size : {1, 2, 3, 4, 10}) {
+      auto linearized_system = Linearize(
+          *system, *context, InputPortSelection::kUseFirstInputIfItExists,
+          OutputPortSelection::kUseFirstOutputIfItExists, 1e-6, max_chunk_size);
+      const double tol = 1e-10;
+      EXPECT_TRUE(CompareMatrices(A_, linearized_system->A(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(B_, linearized_system->B(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(C_, linearized_system->C(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(D_, linearized_system->D(), tol,
+                                  MatrixCompareType::absolute));
+    }
+
+    EXPECT_THROW(Linearize(*system, *context,
+                           InputPortSelection::kUseFirstInputIfItExists,
+                           OutputPortSelection::kUseFirstOutputIfItExists, 1e-6,
+                           0),
+                 std::exception);
+  }
+}
+
 // Test that linearizing a discrete-time affine system about a point that is not
 // at equilibrium returns the original A,B,C,D matrices and affine terms.
 TEST_F(TestLinearizeFromAffine, DiscreteAtNonEquilibrium) {
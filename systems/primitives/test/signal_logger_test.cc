@@ -1,6 +1,7 @@
 #include "drake/systems/primitives/signal_logger.h"
 
 #include <cmath>
+#include <optional>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
@@ -139,12 +140,59 @@ GTEST_TEST(TestSignalLogger, SetForcedPublishOnly) {
       ".*cannot be called if set_forced_publish_only.*");
 }
 
+// Test that a log grows past its initial allocation, and that a bounded log
+// retains its most recent samples in order.
+GTEST_TEST(TestSignalLogger, MaxSamples) {
+  SignalLog<double> unbounded(2, 2 /* batch_allocation_size */);
+  SignalLog<double> bounded(2, 2 /* batch_allocation_size */);
+  EXPECT_EQ(unbounded.get_max_samples(), std::nullopt);
+  bounded.set_max_samples(5);
+  EXPECT_EQ(bounded.get_max_samples(), 5);
+  const int kNumSamples = 12;
+  for (int i = 0; i < kNumSamples; ++i) {
+    const Eigen::Vector2d sample(i, -i);
+    unbounded.AddData(i, sample);
+    bounded.AddData(i, sample);
+    // Reading a wrapped log must not disturb later additions.
+    if (i == 7) {
+      EXPECT_EQ(bounded.sample_times()(0), 3.0);
+    }
+  }
+
+  ASSERT_EQ(unbounded.num_samples(), kNumSamples);
+  EXPECT_TRUE(CompareMatrices(unbounded.sample_times(),
+                              Eigen::VectorXd::LinSpaced(kNumSamples, 0, 11)));
+
+  ASSERT_EQ(bounded.num_samples(), 5);
+  const Eigen::VectorXd expected_times =
+      Eigen::VectorXd::LinSpaced(5, 7, 11);
+  EXPECT_TRUE(CompareMatrices(bounded.sample_times(), expected_times));
+  EXPECT_TRUE(CompareMatrices(bounded.data().row(0).transpose(),
+                              expected_times));
+  EXPECT_TRUE(CompareMatrices(bounded.data().row(1).transpose(),
+                              -expected_times));
+
+  // A sample that goes back in time still replaces the latest sample.
+  bounded.AddData(10.5, Eigen::Vector2d(-1, 1));
+  ASSERT_EQ(bounded.num_samples(), 5);
+  EXPECT_EQ(bounded.sample_times()(4), 10.5);
+  EXPECT_EQ(bounded.sample_times()(3), 10.0);
+
+  // The bound can only be set on an empty log.
+  EXPECT_THROW(bounded.set_max_samples(10), std::exception);
+  bounded.reset();
+  EXPECT_EQ(bounded.num_samples(), 0);
+  bounded.set_max_samples(10);
+  EXPECT_THROW(bounded.set_max_samples(0), std::exception);
+}
+
 GTEST_TEST(TestSignalLogger, ScalarConversion) {
   SignalLogger<double> dut_per_step_publish(2);
   SignalLogger<double> dut_forced_publish(2);
   dut_forced_publish.set_forced_publish_only();
   SignalLogger<double> dut_periodic_publish(2);
   dut_periodic_publish.set_publish_period(0.25);
+  dut_periodic_publish.set_max_samples(10);
   for (const auto* dut : {
       &dut_per_step_publish, &dut_forced_publish, &dut_periodic_publish}) {
     EXPECT_TRUE(is_autodiffxd_convertible(*dut, [&](const auto& converted) {
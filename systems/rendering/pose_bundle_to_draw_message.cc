@@ -37,7 +37,12 @@ void PoseBundleToDrawMessage::CalcViewerDrawMessage(
   for (int i = 0; i < n; ++i) {
     message.robot_num[i] = poses.get_model_instance_id(i);
 
-    message.link_name[i] = poses.get_name(i);
+    // The names in a PoseBundle rarely change from one evaluation to the next,
+    // so we only copy them when they differ from the names already stored in
+    // the output value, to spare a string copy per link and per publish.
+    if (message.link_name[i] != poses.get_name(i)) {
+      message.link_name[i] = poses.get_name(i);
+    }
 
     Eigen::Translation<double, 3> t(poses.get_transform(i).translation());
     message.position[i].resize(3);
@@ -59,6 +59,37 @@ GTEST_TEST(PoseBundleToDrawMessageTest, Conversion) {
   EXPECT_EQ(0, message.quaternion[0][3]);  // z
 }
 
+// Tests that re-evaluating into a previously computed output value reflects
+// the new poses and names, including when the number of poses changes.
+GTEST_TEST(PoseBundleToDrawMessageTest, ReuseOutput) {
+  PoseBundleToDrawMessage converter;
+  auto context = converter.AllocateContext();
+  auto output = converter.AllocateOutput();
+
+  PoseBundle<double> bundle(2);
+  bundle.set_name(0, "foo");
+  bundle.set_name(1, "bar");
+  bundle.set_transform(1, math::RigidTransformd{Eigen::Vector3d{1, 2, 3}});
+  converter.get_input_port(0).FixValue(context.get(), bundle);
+  converter.CalcOutput(*context, output.get());
+
+  PoseBundle<double> smaller(1);
+  smaller.set_name(0, "baz");
+  smaller.set_transform(0, math::RigidTransformd{Eigen::Vector3d{4, 5, 6}});
+  smaller.set_model_instance_id(0, 7);
+  converter.get_input_port(0).FixValue(context.get(), smaller);
+  converter.CalcOutput(*context, output.get());
+
+  const auto& message = output->get_data(0)->get_value<lcmt_viewer_draw>();
+  ASSERT_EQ(1, message.num_links);
+  ASSERT_EQ(message.link_name.size(), 1u);
+  EXPECT_EQ("baz", message.link_name[0]);
+  EXPECT_EQ(7, message.robot_num[0]);
+  EXPECT_EQ(4, message.position[0][0]);
+  EXPECT_EQ(5, message.position[0][1]);
+  EXPECT_EQ(6, message.position[0][2]);
+}
+
 // Tests that PoseBundleToDrawMessageTest allocates no state variables.
 GTEST_TEST(PoseBundleToDrawMessageTest, Stateless) {
   PoseBundleToDrawMessage converter;
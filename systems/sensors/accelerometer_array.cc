@@ -0,0 +1,107 @@
+#include "drake/systems/sensors/accelerometer_array.h"
+
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/multibody/math/spatial_algebra.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using math::RigidTransform;
+using math::RotationMatrix;
+using multibody::SpatialAcceleration;
+using multibody::SpatialVelocity;
+
+template <typename T>
+AccelerometerArray<T>::AccelerometerArray(
+    std::vector<multibody::BodyIndex> body_indices,
+    std::vector<RigidTransform<double>> X_BS,
+    const Eigen::Vector3d& gravity_vector)
+    : LeafSystem<T>(SystemTypeTag<AccelerometerArray>{}),
+      body_indices_(std::move(body_indices)),
+      X_BS_(std::move(X_BS)),
+      gravity_vector_(gravity_vector) {
+  DRAKE_THROW_UNLESS(body_indices_.size() == X_BS_.size());
+
+  // Declare measurement output port.
+  measurement_output_port_ = &this->DeclareVectorOutputPort(
+      "measurement", BasicVector<T>(3 * num_sensors()),
+      &AccelerometerArray<T>::CalcOutput);
+
+  body_poses_input_port_ = &this->DeclareAbstractInputPort(
+      "body_poses", Value<std::vector<RigidTransform<T>>>());
+  body_velocities_input_port_ = &this->DeclareAbstractInputPort(
+      "body_spatial_velocities", Value<std::vector<SpatialVelocity<T>>>());
+  body_accelerations_input_port_ = &this->DeclareAbstractInputPort(
+      "body_spatial_accelerations",
+      Value<std::vector<SpatialAcceleration<T>>>());
+}
+
+template <typename T>
+void AccelerometerArray<T>::CalcOutput(const Context<T>& context,
+                                       BasicVector<T>* output) const {
+  const auto& X_WB_all =
+      get_body_poses_input_port().template Eval<std::vector<RigidTransform<T>>>(
+          context);
+  const auto& V_WB_all =
+      get_body_velocities_input_port()
+          .template Eval<std::vector<SpatialVelocity<T>>>(context);
+  const auto& A_WB_all =
+      get_body_accelerations_input_port()
+          .template Eval<std::vector<SpatialAcceleration<T>>>(context);
+
+  auto measurements = output->get_mutable_value();
+  for (int i = 0; i < num_sensors(); ++i) {
+    const RigidTransform<T>& X_WB = X_WB_all[body_indices_[i]];
+    const SpatialVelocity<T>& V_WB = V_WB_all[body_indices_[i]];
+    const SpatialAcceleration<T>& A_WB = A_WB_all[body_indices_[i]];
+    const RotationMatrix<T>& R_WB = X_WB.rotation();
+
+    // Sensor position expressed in world coordinates.
+    const Vector3<T> p_BS_W = R_WB * X_BS_[i].translation().template cast<T>();
+
+    // Acceleration of the accelerometer expressed in world coordinates.
+    const SpatialAcceleration<T> A_WS = A_WB.Shift(p_BS_W, V_WB.rotational());
+
+    // Rotation from world to accelerometer.
+    const RotationMatrix<T> R_SW =
+        X_BS_[i].rotation().template cast<T>().inverse() * R_WB.inverse();
+
+    measurements.template segment<3>(3 * i) =
+        R_SW * (A_WS.translational() - gravity_vector_);
+  }
+}
+
+template <typename T>
+const AccelerometerArray<T>& AccelerometerArray<T>::AddToDiagram(
+    std::vector<multibody::BodyIndex> body_indices,
+    std::vector<RigidTransform<double>> X_BS,
+    const Eigen::Vector3d& gravity_vector,
+    const multibody::MultibodyPlant<T>& plant, DiagramBuilder<T>* builder) {
+  const auto& accelerometers =
+      *builder->template AddSystem<AccelerometerArray<T>>(
+          std::move(body_indices), std::move(X_BS), gravity_vector);
+
+  builder->Connect(plant.get_body_poses_output_port(),
+                   accelerometers.get_body_poses_input_port());
+  builder->Connect(plant.get_body_spatial_velocities_output_port(),
+                   accelerometers.get_body_velocities_input_port());
+  builder->Connect(plant.get_body_spatial_accelerations_output_port(),
+                   accelerometers.get_body_accelerations_input_port());
+  return accelerometers;
+}
+
+template <typename T>
+template <typename U>
+AccelerometerArray<T>::AccelerometerArray(const AccelerometerArray<U>& other)
+    : AccelerometerArray(other.body_indices(), other.poses(),
+                         other.gravity_vector()) {}
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::sensors::AccelerometerArray)
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
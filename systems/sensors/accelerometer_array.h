@@ -0,0 +1,121 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/// A set of N ideal accelerometers, each modeled exactly as an Accelerometer,
+/// in a single system. Using a single %AccelerometerArray in place of N
+/// Accelerometer systems avoids the per-system overhead (diagram nodes, port
+/// evaluations, and contexts) when a model carries many accelerometers; the
+/// body kinematics input ports are evaluated once for all N sensors.
+///
+/// Sensor i measures the proper acceleration of the origin of its sensor
+/// frame Sᵢ, rigidly affixed to body Bᵢ, expressed in Sᵢ. See Accelerometer
+/// for details. The measurement output is a vector of size 3N, whose i-th
+/// three-element segment is the measurement of sensor i.
+///
+/// @system
+/// name: AccelerometerArray
+/// input_ports:
+/// - body_poses
+/// - body_spatial_velocities
+/// - body_spatial_accelerations
+/// output_ports:
+/// - measurement
+/// @endsystem
+///
+/// @ingroup sensor_systems
+template <typename T>
+class AccelerometerArray final : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AccelerometerArray)
+
+  /// @param body_indices the index of the body Bᵢ to which each sensor i is
+  ///    affixed
+  /// @param X_BS the pose of each sensor frame Sᵢ in its body Bᵢ
+  /// @param gravity_vector the constant acceleration due to gravity
+  ///    expressed in world coordinates
+  /// @throws std::exception if `body_indices` and `X_BS` have different sizes.
+  AccelerometerArray(
+      std::vector<multibody::BodyIndex> body_indices,
+      std::vector<math::RigidTransform<double>> X_BS,
+      const Eigen::Vector3d& gravity_vector = Eigen::Vector3d::Zero());
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit AccelerometerArray(const AccelerometerArray<U>&);
+
+  const InputPort<T>& get_body_poses_input_port() const {
+    return *body_poses_input_port_;
+  }
+
+  const InputPort<T>& get_body_velocities_input_port() const {
+    return *body_velocities_input_port_;
+  }
+
+  const InputPort<T>& get_body_accelerations_input_port() const {
+    return *body_accelerations_input_port_;
+  }
+
+  const OutputPort<T>& get_measurement_output_port() const {
+    return *measurement_output_port_;
+  }
+
+  /// Returns the number of sensors N.
+  int num_sensors() const { return static_cast<int>(body_indices_.size()); }
+
+  /// Returns the indices of the bodies that were supplied in the constructor.
+  const std::vector<multibody::BodyIndex>& body_indices() const {
+    return body_indices_;
+  }
+
+  /// Returns the gravity vector supplied in the constructor, or zero if none.
+  const Eigen::Vector3d& gravity_vector() const { return gravity_vector_; }
+
+  /// Gets the poses X_BS of the sensor frames in their bodies.
+  const std::vector<math::RigidTransform<double>>& poses() const {
+    return X_BS_;
+  }
+
+  /// Static factory method that creates an AccelerometerArray object and
+  /// connects it to the given plant, in the same way as
+  /// Accelerometer::AddToDiagram().
+  /// @param body_indices the index of the body Bᵢ to which each sensor i is
+  ///    affixed
+  /// @param X_BS the pose of each sensor frame Sᵢ in its body Bᵢ
+  /// @param gravity_vector the constant acceleration due to gravity
+  ///    expressed in world coordinates
+  /// @param plant the plant to which the sensors will be connected
+  /// @param builder a pointer to the DiagramBuilder
+  static const AccelerometerArray& AddToDiagram(
+      std::vector<multibody::BodyIndex> body_indices,
+      std::vector<math::RigidTransform<double>> X_BS,
+      const Eigen::Vector3d& gravity_vector,
+      const multibody::MultibodyPlant<T>& plant, DiagramBuilder<T>* builder);
+
+ private:
+  // Outputs the stacked measurements.
+  void CalcOutput(const Context<T>& context, BasicVector<T>* output) const;
+
+  const std::vector<multibody::BodyIndex> body_indices_;
+  const std::vector<math::RigidTransform<double>> X_BS_;
+  const Eigen::Vector3d gravity_vector_;
+  const InputPort<T>* body_poses_input_port_{nullptr};
+  const InputPort<T>* body_velocities_input_port_{nullptr};
+  const InputPort<T>* body_accelerations_input_port_{nullptr};
+  const OutputPort<T>* measurement_output_port_{nullptr};
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,85 @@
+#include "drake/systems/sensors/gyroscope_array.h"
+
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/multibody/math/spatial_algebra.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using math::RigidTransform;
+using math::RotationMatrix;
+using multibody::SpatialVelocity;
+
+template <typename T>
+GyroscopeArray<T>::GyroscopeArray(
+    std::vector<multibody::BodyIndex> body_indices,
+    std::vector<RigidTransform<double>> X_BS)
+    : LeafSystem<T>(SystemTypeTag<GyroscopeArray>{}),
+      body_indices_(std::move(body_indices)),
+      X_BS_(std::move(X_BS)) {
+  DRAKE_THROW_UNLESS(body_indices_.size() == X_BS_.size());
+
+  // Declare measurement output port.
+  measurement_output_port_ = &this->DeclareVectorOutputPort(
+      "measurement", BasicVector<T>(3 * num_sensors()),
+      &GyroscopeArray<T>::CalcOutput);
+
+  body_poses_input_port_ = &this->DeclareAbstractInputPort(
+      "body_poses", Value<std::vector<RigidTransform<T>>>());
+  body_velocities_input_port_ = &this->DeclareAbstractInputPort(
+      "body_spatial_velocities", Value<std::vector<SpatialVelocity<T>>>());
+}
+
+template <typename T>
+void GyroscopeArray<T>::CalcOutput(const Context<T>& context,
+                                   BasicVector<T>* output) const {
+  const auto& X_WB_all =
+      get_body_poses_input_port().template Eval<std::vector<RigidTransform<T>>>(
+          context);
+  const auto& V_WB_all =
+      get_body_velocities_input_port()
+          .template Eval<std::vector<SpatialVelocity<T>>>(context);
+
+  auto measurements = output->get_mutable_value();
+  for (int i = 0; i < num_sensors(); ++i) {
+    const RigidTransform<T>& X_WB = X_WB_all[body_indices_[i]];
+    const SpatialVelocity<T>& V_WB = V_WB_all[body_indices_[i]];
+
+    // Calculate rotation from world to gyroscope: R_SW = R_SB * R_BW.
+    const RotationMatrix<T> R_SW =
+        X_BS_[i].rotation().template cast<T>().inverse() *
+        X_WB.rotation().inverse();
+
+    // Re-express in local frame.
+    measurements.template segment<3>(3 * i) = R_SW * V_WB.rotational();
+  }
+}
+
+template <typename T>
+const GyroscopeArray<T>& GyroscopeArray<T>::AddToDiagram(
+    std::vector<multibody::BodyIndex> body_indices,
+    std::vector<RigidTransform<double>> X_BS,
+    const multibody::MultibodyPlant<T>& plant, DiagramBuilder<T>* builder) {
+  const auto& gyroscopes = *builder->template AddSystem<GyroscopeArray<T>>(
+      std::move(body_indices), std::move(X_BS));
+  builder->Connect(plant.get_body_poses_output_port(),
+                   gyroscopes.get_body_poses_input_port());
+  builder->Connect(plant.get_body_spatial_velocities_output_port(),
+                   gyroscopes.get_body_velocities_input_port());
+  return gyroscopes;
+}
+
+template <typename T>
+template <typename U>
+GyroscopeArray<T>::GyroscopeArray(const GyroscopeArray<U>& other)
+    : GyroscopeArray(other.body_indices(), other.poses()) {}
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::sensors::GyroscopeArray)
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/// A set of N ideal gyroscopes, each modeled exactly as a Gyroscope, in a
+/// single system. Using a single %GyroscopeArray in place of N Gyroscope
+/// systems avoids the per-system overhead (diagram nodes, port evaluations,
+/// and contexts) when a model carries many gyroscopes; the body kinematics
+/// input ports are evaluated once for all N sensors.
+///
+/// Sensor i measures the angular velocity of its sensor frame Sᵢ, rigidly
+/// affixed to body Bᵢ, in the world frame, expressed in Sᵢ. See Gyroscope for
+/// details. The measurement output is a vector of size 3N, whose i-th
+/// three-element segment is the measurement of sensor i.
+///
+/// @system
+/// name: GyroscopeArray
+/// input_ports:
+/// - body_poses
+/// - body_spatial_velocities
+/// output_ports:
+/// - measurement
+/// @endsystem
+///
+/// @ingroup sensor_systems
+template <typename T>
+class GyroscopeArray final : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GyroscopeArray)
+
+  /// @param body_indices the index of the body Bᵢ to which each sensor i is
+  ///    affixed
+  /// @param X_BS the pose of each sensor frame Sᵢ in its body Bᵢ
+  /// @throws std::exception if `body_indices` and `X_BS` have different sizes.
+  GyroscopeArray(std::vector<multibody::BodyIndex> body_indices,
+                 std::vector<math::RigidTransform<double>> X_BS);
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit GyroscopeArray(const GyroscopeArray<U>&);
+
+  const InputPort<T>& get_body_poses_input_port() const {
+    return *body_poses_input_port_;
+  }
+
+  const InputPort<T>& get_body_velocities_input_port() const {
+    return *body_velocities_input_port_;
+  }
+
+  const OutputPort<T>& get_measurement_output_port() const {
+    return *measurement_output_port_;
+  }
+
+  /// Returns the number of sensors N.
+  int num_sensors() const { return static_cast<int>(body_indices_.size()); }
+
+  /// Returns the indices of the bodies that were supplied in the constructor.
+  const std::vector<multibody::BodyIndex>& body_indices() const {
+    return body_indices_;
+  }
+
+  /// Gets the poses X_BS of the sensor frames in their bodies.
+  const std::vector<math::RigidTransform<double>>& poses() const {
+    return X_BS_;
+  }
+
+  /// Static factory method that creates a GyroscopeArray object and connects
+  /// it to the given plant, in the same way as Gyroscope::AddToDiagram().
+  /// @param body_indices the index of the body Bᵢ to which each sensor i is
+  ///    affixed
+  /// @param X_BS the pose of each sensor frame Sᵢ in its body Bᵢ
+  /// @param plant the plant to which the sensors will be connected
+  /// @param builder a pointer to the DiagramBuilder
+  static const GyroscopeArray& AddToDiagram(
+      std::vector<multibody::BodyIndex> body_indices,
+      std::vector<math::RigidTransform<double>> X_BS,
+      const multibody::MultibodyPlant<T>& plant, DiagramBuilder<T>* builder);
+
+ private:
+  // Outputs the stacked measurements.
+  void CalcOutput(const Context<T>& context, BasicVector<T>* output) const;
+
+  const std::vector<multibody::BodyIndex> body_indices_;
+  const std::vector<math::RigidTransform<double>> X_BS_;
+  const InputPort<T>* body_poses_input_port_{nullptr};
+  const InputPort<T>* body_velocities_input_port_{nullptr};
+  const OutputPort<T>* measurement_output_port_{nullptr};
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
-#include <memory>
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include "robotlocomotion/image_t.hpp"
 #include <zlib.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/systems/sensors/lcm_image_traits.h"
 
 using std::string;
@@ -21,25 +23,25 @@ namespace {
 
 const int64_t kSecToMillisec = 1000000;
 
+// Both Compress() and Pack() write directly into the message's data, whose
+// capacity is reused when the message is recalculated.
 template <PixelType kPixelType>
 void Compress(const Image<kPixelType>& image, image_t* msg) {
   msg->compression_method = image_t::COMPRESSION_METHOD_ZLIB;
 
   const int source_size = image.width() * image.height() * image.kPixelSize;
-  // The destination buf_size must be slightly larger than the source size.
-  // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
-  size_t buf_size = source_size * 1.001 + 12;
-  std::unique_ptr<uint8_t[]> buf(new uint8_t[buf_size]);
+  uLongf buf_size = compressBound(source_size);
+  msg->data.resize(buf_size);
 
   auto compress_status = compress2(
-      buf.get(), &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
-      source_size, Z_BEST_SPEED);
+      msg->data.data(), &buf_size,
+      reinterpret_cast<const Bytef*>(image.at(0, 0)), source_size,
+      Z_BEST_SPEED);
 
   DRAKE_DEMAND(compress_status == Z_OK);
 
   msg->data.resize(buf_size);
   msg->size = buf_size;
-  memcpy(&msg->data[0], buf.get(), buf_size);
 }
 
 template <PixelType kPixelType>
@@ -47,9 +49,9 @@ void Pack(const Image<kPixelType>& image, image_t* msg) {
   msg->compression_method = image_t::COMPRESSION_METHOD_NOT_COMPRESSED;
 
   const int size = image.width() * image.height() * image.kPixelSize;
-  msg->data.resize(size);
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(image.at(0, 0));
+  msg->data.assign(data, data + size);
   msg->size = size;
-  memcpy(&msg->data[0], image.at(0, 0), size);
 }
 
 template <PixelType kPixelType>
@@ -179,24 +181,41 @@ const OutputPort<double>& ImageToLcmImageArrayT::image_array_t_msg_output_port()
   return System<double>::get_output_port(image_array_t_msg_output_port_index_);
 }
 
+void ImageToLcmImageArrayT::set_num_threads(int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(
+        "ImageToLcmImageArrayT::set_num_threads(): num_threads should be "
+        "positive.");
+  }
+  num_threads_ = num_threads;
+}
+
 void ImageToLcmImageArrayT::CalcImageArray(
     const systems::Context<double>& context, image_array_t* msg) const {
   msg->header.utime = static_cast<int64_t>(context.get_time() * kSecToMillisec);
   msg->header.frame_name.clear();
-  msg->num_images = 0;
-  msg->images.clear();
-
+  msg->num_images = num_input_ports();
+  // Resizing (rather than clearing) keeps the images of the previous message,
+  // so that their data buffers get reused.
+  msg->images.resize(num_input_ports());
+
+  // The input ports are evaluated on this thread; only the packing of the
+  // (now up to date) images is spread across threads.
+  std::vector<const AbstractValue*> image_values;
   for (int i = 0; i < num_input_ports(); i++) {
-    const auto& image_value = this->get_input_port(i).
-        template Eval<AbstractValue>(context);
-
-    image_t image_msg;
-    PackImageToLcmImageT(image_value, input_port_pixel_type_[i],
-                         msg->header.utime, this->get_input_port(i).get_name(),
-                         &image_msg, do_compress_);
-    msg->images.push_back(image_msg);
-    msg->num_images++;
+    image_values.push_back(
+        &this->get_input_port(i).template Eval<AbstractValue>(context));
   }
+  drake::internal::StaticParallelForRange(
+      num_input_ports(), std::min(num_threads_, std::max(num_input_ports(), 1)),
+      [&](int, int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          PackImageToLcmImageT(*image_values[i], input_port_pixel_type_[i],
+                               msg->header.utime,
+                               this->get_input_port(i).get_name(),
+                               &msg->images[i], do_compress_);
+        }
+      });
 }
 
 }  // namespace sensors
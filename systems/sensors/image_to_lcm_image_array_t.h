@@ -66,6 +66,19 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
         name, Value<Image<kPixelType>>());
   }
 
+  /// Sets the number of threads used to pack (and compress, if enabled) the
+  /// images of the input ports into the output message. Each image is packed
+  /// by a single thread, so there is no benefit to using more threads than
+  /// there are input ports. The default of 1 packs the images sequentially on
+  /// the calling thread.
+  ///
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_threads(int num_threads);
+
+  /// Returns the number of threads used to pack the images.
+  /// @see set_num_threads().
+  int num_threads() const { return num_threads_; }
+
  private:
   void CalcImageArray(const systems::Context<double>& context,
                       robotlocomotion::image_array_t* msg) const;
@@ -77,6 +90,7 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
 
   std::vector<PixelType> input_port_pixel_type_{};
   const bool do_compress_;
+  int num_threads_{1};
 };
 
 }  // namespace sensors
@@ -2,8 +2,15 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -95,6 +102,117 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
 
+// A bounded queue of image writes, consumed by a pool of worker threads.
+class ImageWriter::AsyncWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncWriter)
+
+  AsyncWriter(int num_threads, int max_queue_size, QueueFullPolicy policy)
+      : max_queue_size_(max_queue_size), policy_(policy) {
+    DRAKE_DEMAND(num_threads > 0 && max_queue_size > 0);
+    for (int i = 0; i < num_threads; ++i) {
+      workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+  }
+
+  // Completes the pending writes and joins the workers.
+  ~AsyncWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    job_available_.notify_all();
+    for (std::thread& worker : workers_) worker.join();
+  }
+
+  // Queues the `write` job, waiting for room in the queue or dropping the job
+  // according to the policy if the queue is full. Returns false if the job was
+  // dropped.
+  bool Push(std::function<void()> write) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (static_cast<int>(queue_.size()) >= max_queue_size_) {
+      if (policy_ == QueueFullPolicy::kDrop) {
+        ++stats_.num_dropped;
+        return false;
+      }
+      room_available_.wait(lock, [this]() {
+        return static_cast<int>(queue_.size()) < max_queue_size_;
+      });
+    }
+    queue_.push_back(std::move(write));
+    ++stats_.num_queued;
+    stats_.queue_depth = static_cast<int>(queue_.size());
+    stats_.max_queue_depth =
+        std::max(stats_.max_queue_depth, stats_.queue_depth);
+    lock.unlock();
+    job_available_.notify_one();
+    return true;
+  }
+
+  // Waits until the queue is empty and no worker is busy, then rethrows the
+  // first error of a worker, if any.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    all_done_.wait(lock, [this]() { return queue_.empty() && num_busy_ == 0; });
+    if (error_ != nullptr) {
+      std::exception_ptr error = std::move(error_);
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  AsyncWriteStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  void WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      job_available_.wait(lock,
+                          [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return;  // Stopping, with nothing left to write.
+      std::function<void()> write = std::move(queue_.front());
+      queue_.pop_front();
+      stats_.queue_depth = static_cast<int>(queue_.size());
+      ++num_busy_;
+      lock.unlock();
+      room_available_.notify_one();
+      std::exception_ptr error;
+      try {
+        write();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      --num_busy_;
+      if (error == nullptr) {
+        ++stats_.num_written;
+      } else if (error_ == nullptr) {
+        error_ = std::move(error);
+      }
+      if (queue_.empty() && num_busy_ == 0) all_done_.notify_all();
+    }
+  }
+
+  const int max_queue_size_;
+  const QueueFullPolicy policy_;
+
+  // Guards all the members below.
+  mutable std::mutex mutex_;
+  std::condition_variable job_available_;
+  std::condition_variable room_available_;
+  std::condition_variable all_done_;
+  std::deque<std::function<void()>> queue_;
+  int num_busy_{0};
+  bool stopping_{false};
+  std::exception_ptr error_;
+  AsyncWriteStats stats_;
+
+  std::vector<std::thread> workers_;
+};
+
 ImageWriter::ImageWriter() {
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
@@ -109,6 +227,33 @@ ImageWriter::ImageWriter() {
   extensions_[PixelType::kGrey8U] = ".png";
 }
 
+ImageWriter::~ImageWriter() = default;
+
+void ImageWriter::EnableAsyncWrites(int num_threads, int max_queue_size,
+                                    QueueFullPolicy policy) {
+  if (num_threads <= 0) {
+    throw std::logic_error(
+        "ImageWriter: the number of writer threads must be positive");
+  }
+  if (max_queue_size <= 0) {
+    throw std::logic_error(
+        "ImageWriter: the maximum queue size must be positive");
+  }
+  // Destroying the previous writer completes its pending writes.
+  async_writer_.reset();
+  async_writer_ =
+      std::make_unique<AsyncWriter>(num_threads, max_queue_size, policy);
+}
+
+void ImageWriter::WaitForPendingWrites() const {
+  if (async_writer_ != nullptr) async_writer_->Wait();
+}
+
+ImageWriter::AsyncWriteStats ImageWriter::get_async_write_stats() const {
+  if (async_writer_ == nullptr) return AsyncWriteStats{};
+  return async_writer_->stats();
+}
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -182,9 +327,22 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  if (async_writer_ == nullptr) {
+    SaveToFileHelper(
+        image, MakeFileName(data.format, data.pixel_type, context.get_time(),
+                            port.get_name(), data.count++));
+    return;
+  }
+  // The file name is fixed now so that the names follow the publish order.
+  // The image is copied, as the port value may change before it is written.
+  std::string file_name = MakeFileName(
+      data.format, data.pixel_type, context.get_time(), port.get_name(),
+      data.count);
+  const bool queued = async_writer_->Push(
+      [image, file_name = std::move(file_name)]() {
+        SaveToFileHelper(image, file_name);
+      });
+  if (queued) ++data.count;
 }
 
 std::string ImageWriter::MakeFileName(const std::string& format,
@@ -6,6 +6,8 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -87,14 +89,78 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  that function's documentation for elaboration on how to configure image output.
  It is important to note, that every declared image input port _must_ be
  connected; otherwise, attempting to write an image from that port, will cause
- an error in the system.  */
+ an error in the system.
+
+ By default, the images are encoded and written to disk within the publish
+ event, which stalls the simulation at every image. EnableAsyncWrites() moves
+ this work to a pool of worker threads.  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
 
+  /** What the asynchronous writes do with an image published while their
+   queue is full; see EnableAsyncWrites().  */
+  enum class QueueFullPolicy {
+    /** The publish event waits until a worker takes an image off the queue. */
+    kBlock,
+    /** The image is not written.  */
+    kDrop,
+  };
+
+  /** Statistics of the asynchronous writes; see EnableAsyncWrites().  */
+  struct AsyncWriteStats {
+    /** The number of images that were queued to be written.  */
+    int64_t num_queued{0};
+    /** The number of queued images that have been written.  */
+    int64_t num_written{0};
+    /** The number of images that were not written because the queue was full
+     (only with QueueFullPolicy::kDrop).  */
+    int64_t num_dropped{0};
+    /** The number of images in the queue, not yet taken by a worker.  */
+    int queue_depth{0};
+    /** The largest `queue_depth` so far.  */
+    int max_queue_depth{0};
+  };
+
   /** Constructs default instance with no image ports.  */
   ImageWriter();
 
+  /** Waits for the pending asynchronous writes, if any, to complete.  */
+  ~ImageWriter() override;
+
+  /** Makes the publish events queue copies of the images, which are encoded
+   and written to disk by `num_threads` worker threads, so that the simulation
+   is not stalled by image I/O.
+
+   The file names are still determined when the images are published, so the
+   `count` and time format arguments follow the order of the publish events
+   even though the workers may complete the writes out of order. At most
+   `max_queue_size` images wait in the queue; the `policy` determines what
+   happens to an image published while the queue is full. A dropped image does
+   not increment `count`.
+
+   Calling this again first waits for the writes pending with the previous
+   configuration. The writes pending at destruction are completed.
+
+   @throws std::logic_error if `num_threads` or `max_queue_size` is not
+                            positive.  */
+  void EnableAsyncWrites(int num_threads, int max_queue_size,
+                         QueueFullPolicy policy = QueueFullPolicy::kBlock);
+
+  /** Returns true if EnableAsyncWrites() has been called.  */
+  bool is_writing_async() const { return async_writer_ != nullptr; }
+
+  /** Blocks until all the images queued by the asynchronous writes have been
+   written to disk. Does nothing if the writes are synchronous.
+   @throws std::exception the first error thrown by a worker while writing an
+                          image since the previous call, if any.  */
+  void WaitForPendingWrites() const;
+
+  /** Returns the statistics of the asynchronous writes since
+   EnableAsyncWrites() was last called, or all zeros if the writes are
+   synchronous.  */
+  AsyncWriteStats get_async_write_stats() const;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -261,6 +327,11 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  // The queue and worker threads of the asynchronous writes; null if the
+  // images are written within the publish events.
+  class AsyncWriter;
+  std::unique_ptr<AsyncWriter> async_writer_;
 };
 
 }  // namespace sensors
@@ -0,0 +1,121 @@
+#include "drake/systems/sensors/render_thread_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using geometry::render::RenderEngine;
+
+class RenderThreadPool::Worker {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Worker)
+
+  Worker() : thread_([this]() { Run(); }) {}
+
+  // Completes the queued renders and joins the thread.
+  ~Worker() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    render_available_.notify_one();
+    thread_.join();
+  }
+
+  void Push(std::packaged_task<void()> render) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(render));
+    }
+    render_available_.notify_one();
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      render_available_.wait(lock,
+                             [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return;  // Stopping, with nothing left to render.
+      {
+        std::packaged_task<void()> render = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+        // The packaged task stores any exception in its future.
+        render();
+      }
+      lock.lock();
+    }
+  }
+
+  // Guards the members below, except for thread_.
+  std::mutex mutex_;
+  std::condition_variable render_available_;
+  std::deque<std::packaged_task<void()>> queue_;
+  bool stopping_{false};
+
+  // Declared last, so that the thread starts after the other members are
+  // initialized.
+  std::thread thread_;
+};
+
+RenderThreadPool::RenderThreadPool(int num_threads) {
+  if (num_threads <= 0) {
+    throw std::logic_error(fmt::format(
+        "RenderThreadPool: the number of threads must be positive; got {}",
+        num_threads));
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  num_engines_.resize(num_threads, 0);
+}
+
+RenderThreadPool::~RenderThreadPool() = default;
+
+std::future<void> RenderThreadPool::Submit(const RenderEngine* engine,
+                                           std::function<void()> render) {
+  if (engine == nullptr) {
+    throw std::logic_error("RenderThreadPool: the render engine is null");
+  }
+  DRAKE_DEMAND(render != nullptr);
+  int index{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = assignments_.find(engine);
+    if (iter == assignments_.end()) {
+      index = static_cast<int>(
+          std::min_element(num_engines_.begin(), num_engines_.end()) -
+          num_engines_.begin());
+      ++num_engines_[index];
+      assignments_.emplace(engine, index);
+    } else {
+      index = iter->second;
+    }
+  }
+  std::packaged_task<void()> task(std::move(render));
+  std::future<void> result = task.get_future();
+  workers_[index]->Push(std::move(task));
+  return result;
+}
+
+int RenderThreadPool::thread_index(const RenderEngine* engine) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = assignments_.find(engine);
+  return iter == assignments_.end() ? -1 : iter->second;
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
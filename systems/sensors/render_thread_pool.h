@@ -0,0 +1,81 @@
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/render/render_engine.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/** A pool of threads on which the renders of several render engines run
+ concurrently, e.g., to render the cameras of simulations that run on
+ different threads (see MonteCarloSimulation) without creating more render
+ threads than the GPU can use.
+
+ A render engine is not thread safe, and the OpenGL context of a render engine
+ such as geometry::render::RenderEngineVtk should stay current on the same
+ thread. Therefore, the first time a render is submitted for an engine, the
+ engine is assigned to the thread that was assigned the fewest engines so far,
+ and all of the renders submitted for that engine are then run on that thread,
+ in the order in which they were submitted. The renders of engines assigned to
+ different threads run concurrently.
+
+ A pool is typically shared by several RgbdSensor systems, see
+ RgbdSensor::set_render_thread_pool(). All of the renders of an engine should
+ then go through the same pool.
+
+ This class is thread safe.  */
+class RenderThreadPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RenderThreadPool)
+
+  /** Starts `num_threads` render threads.
+   @throws std::exception if `num_threads` is not positive.  */
+  explicit RenderThreadPool(int num_threads);
+
+  /** Completes the renders that were already submitted, then joins the render
+   threads.  */
+  ~RenderThreadPool();
+
+  /** Returns the number of render threads.  */
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+
+  /** Queues the `render` function to be run on the thread assigned to
+   `engine`, and returns a future that becomes ready once it ran. If `render`
+   throws, the exception is rethrown by the future's `get()`. The `engine` is
+   only used as a key; it is not dereferenced.
+
+   @warning Waiting on the future from within a render of this pool may
+            deadlock.
+   @throws std::exception if `engine` is nullptr.  */
+  std::future<void> Submit(const geometry::render::RenderEngine* engine,
+                           std::function<void()> render);
+
+  /** Returns the index, in [0, num_threads()), of the thread assigned to
+   `engine`, or -1 if no render was submitted for `engine` yet.  */
+  int thread_index(const geometry::render::RenderEngine* engine) const;
+
+ private:
+  // A render thread with its queue of renders.
+  class Worker;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // Guards the members below.
+  mutable std::mutex mutex_;
+  // The index of the worker assigned to each engine.
+  std::unordered_map<const geometry::render::RenderEngine*, int> assignments_;
+  // The number of engines assigned to each worker.
+  std::vector<int> num_engines_;
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
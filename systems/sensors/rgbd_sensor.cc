@@ -1,6 +1,7 @@
 #include "drake/systems/sensors/rgbd_sensor.h"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <string>
 #include <utility>
@@ -106,9 +107,12 @@ RgbdSensor::RgbdSensor(FrameId parent_id, const RigidTransformd& X_PB,
   depth_image_32F_port_ = &this->DeclareAbstractOutputPort(
       "depth_image_32f", depth32, &RgbdSensor::CalcDepthImage32F);
 
+  // The 16U depth image is converted from the (cached) 32F depth image, so
+  // evaluating both ports only renders the depth image once.
   ImageDepth16U depth16(depth_intrinsics.width(), depth_intrinsics.height());
   depth_image_16U_port_ = &this->DeclareAbstractOutputPort(
-      "depth_image_16u", depth16, &RgbdSensor::CalcDepthImage16U);
+      "depth_image_16u", depth16, &RgbdSensor::CalcDepthImage16U,
+      {this->output_port_ticket(depth_image_32F_port_->get_index())});
 
   ImageLabel16I label_image(color_intrinsics.width(),
                             color_intrinsics.height());
@@ -160,32 +164,41 @@ const OutputPort<double>& RgbdSensor::X_WB_output_port() const {
 void RgbdSensor::CalcColorImage(const Context<double>& context,
                                 ImageRgba8U* color_image) const {
   const QueryObject<double>& query_object = get_query_object(context);
-  query_object.RenderColorImage(
-      color_camera_, parent_frame_id_,
-      X_PB_ * color_camera_.core().sensor_pose_in_camera_body(), color_image);
+  Render(query_object, color_camera_.core().renderer_name(), [&]() {
+    query_object.RenderColorImage(
+        color_camera_, parent_frame_id_,
+        X_PB_ * color_camera_.core().sensor_pose_in_camera_body(),
+        color_image);
+  });
 }
 
 void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
                                    ImageDepth32F* depth_image) const {
   const QueryObject<double>& query_object = get_query_object(context);
-  query_object.RenderDepthImage(
-      depth_camera_, parent_frame_id_,
-      X_PB_ * depth_camera_.core().sensor_pose_in_camera_body(), depth_image);
+  Render(query_object, depth_camera_.core().renderer_name(), [&]() {
+    query_object.RenderDepthImage(
+        depth_camera_, parent_frame_id_,
+        X_PB_ * depth_camera_.core().sensor_pose_in_camera_body(),
+        depth_image);
+  });
 }
 
 void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
                                    ImageDepth16U* depth_image) const {
-  ImageDepth32F depth32(depth_image->width(), depth_image->height());
-  CalcDepthImage32F(context, &depth32);
+  const ImageDepth32F& depth32 =
+      depth_image_32F_port_->Eval<ImageDepth32F>(context);
   ConvertDepth32FTo16U(depth32, depth_image);
 }
 
 void RgbdSensor::CalcLabelImage(const Context<double>& context,
                                 ImageLabel16I* label_image) const {
   const QueryObject<double>& query_object = get_query_object(context);
-  query_object.RenderLabelImage(
-      color_camera_, parent_frame_id_,
-      X_PB_ * color_camera_.core().sensor_pose_in_camera_body(), label_image);
+  Render(query_object, color_camera_.core().renderer_name(), [&]() {
+    query_object.RenderLabelImage(
+        color_camera_, parent_frame_id_,
+        X_PB_ * color_camera_.core().sensor_pose_in_camera_body(),
+        label_image);
+  });
 }
 
 void RgbdSensor::CalcX_WB(const Context<double>& context,
@@ -227,6 +240,25 @@ const geometry::QueryObject<double>& RgbdSensor::get_query_object(
   return query_object_input_port().Eval<geometry::QueryObject<double>>(context);
 }
 
+void RgbdSensor::Render(const QueryObject<double>& query_object,
+                        const std::string& renderer_name,
+                        const std::function<void()>& render) const {
+  if (render_thread_pool_ == nullptr) {
+    render();
+    return;
+  }
+  // Looking up the engine also brings the poses in the context up to date, so
+  // that the render thread only reads the context while this thread waits.
+  const geometry::render::RenderEngine* engine =
+      query_object.GetRenderEngineByName(renderer_name);
+  if (engine == nullptr) {
+    // Let the query object report the missing renderer.
+    render();
+    return;
+  }
+  render_thread_pool_->Submit(engine, render).get();
+}
+
 RgbdSensorDiscrete::RgbdSensorDiscrete(std::unique_ptr<RgbdSensor> camera,
                                        double period, bool render_label_image)
     : camera_(camera.get()), period_(period) {
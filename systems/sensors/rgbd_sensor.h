@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -20,6 +21,7 @@
 #include "drake/systems/rendering/pose_vector.h"
 #include "drake/systems/sensors/camera_info.h"
 #include "drake/systems/sensors/image.h"
+#include "drake/systems/sensors/render_thread_pool.h"
 
 namespace drake {
 namespace systems {
@@ -88,10 +90,31 @@ namespace sensors {
      color camera frame. See @ref geometry::render::RenderLabel "RenderLabel"
      for discussion of interpreting rendered labels.
 
+ Each image output port is cached, so that an image is rendered at most once
+ for a given context no matter how many times its port is evaluated. The
+ depth_image_16u image is converted from the depth_image_32f image, so
+ evaluating both only renders depth once. To render images at a fixed camera
+ frame rate, rather than whenever the context changes, use
+ RgbdSensorDiscrete.
+
  @note These depth sensor measurements differ from those of range data used by
  laser range finders (like DepthSensor), where the depth value represents the
  distance from the sensor origin to the object's surface.
 
+ @note A simulation that can tolerate images that are one evaluation old can
+ overlap the rendering of each image with the computation that follows it by
+ giving the sensor's camera a renderer made by
+ geometry::render::MakeRenderEngineGl() with
+ geometry::render::RenderEngineGlParams::pipelined_readback set. Each
+ evaluation of an image output port then returns the image rendered by the
+ previous evaluation of that port (see RenderEngineGlParams). Since the
+ pipeline is kept per renderer and image size, each such sensor should have a
+ renderer of its own.
+
+ @note By default, the images are rendered on the thread that evaluates the
+ output ports. Sensors can instead dispatch their renders to a shared
+ RenderThreadPool, see set_render_thread_pool().
+
  @ingroup sensor_systems  */
 class RgbdSensor final : public LeafSystem<double> {
  public:
@@ -216,6 +239,23 @@ class RgbdSensor final : public LeafSystem<double> {
    */
   const OutputPort<double>& X_WB_output_port() const;
 
+  /** Makes this sensor render its images on the threads of `pool`, instead of
+   on the thread that evaluates its output ports. Each evaluation still waits
+   for its image, but the renders of the sensors that share `pool`, e.g., the
+   sensors of simulations running on different threads, are then run on at
+   most RenderThreadPool::num_threads() threads, and the renders of each
+   render engine always run on the same thread. All of the sensors that render
+   with a given render engine should then share the same pool. Passing nullptr
+   restores the rendering on the evaluating thread.  */
+  void set_render_thread_pool(std::shared_ptr<RenderThreadPool> pool) {
+    render_thread_pool_ = std::move(pool);
+  }
+
+  /** Returns the pool given to set_render_thread_pool(), if any.  */
+  const std::shared_ptr<RenderThreadPool>& render_thread_pool() const {
+    return render_thread_pool_;
+  }
+
  private:
   friend class RgbdSensorTester;
 
@@ -241,6 +281,13 @@ class RgbdSensor final : public LeafSystem<double> {
   const geometry::QueryObject<double>& get_query_object(
       const Context<double>& context) const;
 
+  // Calls `render`, which renders with the named render engine of
+  // `query_object`, either directly or, if there is a render thread pool, on
+  // the pool thread assigned to the engine, waiting for it to complete.
+  void Render(const geometry::QueryObject<double>& query_object,
+              const std::string& renderer_name,
+              const std::function<void()>& render) const;
+
   const InputPort<double>* query_object_input_port_{};
   const OutputPort<double>* color_image_port_{};
   const OutputPort<double>* depth_image_32F_port_{};
@@ -256,11 +303,14 @@ class RgbdSensor final : public LeafSystem<double> {
   const geometry::render::DepthRenderCamera depth_camera_;
   // The position of the camera's B frame relative to its parent frame P.
   const math::RigidTransformd X_PB_;
+  // The pool that renders the images, if any.
+  std::shared_ptr<RenderThreadPool> render_thread_pool_;
 };
 
 /**
  Wraps a continuous %RgbdSensor with a zero-order hold to create a discrete
- sensor.
+ sensor. The images are only rendered at the sample times, once per period,
+ and evaluating the output ports between samples does not render.
 
  @system
  name: RgbdSensorDiscrete
@@ -0,0 +1,83 @@
+#include "drake/systems/sensors/accelerometer_array.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/test_utilities/scalar_conversion.h"
+#include "drake/systems/sensors/accelerometer_sensor.h"
+
+namespace drake {
+namespace {
+
+using systems::BasicVector;
+using systems::sensors::Accelerometer;
+using systems::sensors::AccelerometerArray;
+
+// Confirms that each sensor of the array reports the same measurement as the
+// equivalent Accelerometer.
+GTEST_TEST(AccelerometerArrayTest, MatchesAccelerometers) {
+  systems::DiagramBuilder<double> builder;
+  auto* plant = builder.AddSystem<multibody::MultibodyPlant>(0.0);
+  multibody::Parser parser(plant);
+  parser.AddModelFromFile(
+      FindResourceOrThrow("drake/examples/pendulum/Pendulum.urdf"));
+  plant->WeldFrames(plant->world_frame(), plant->GetFrameByName("base"));
+  plant->Finalize();
+
+  const multibody::Body<double>& arm = plant->GetBodyByName("arm");
+  const multibody::Body<double>& base = plant->GetBodyByName("base");
+  const std::vector<math::RigidTransform<double>> X_BS{
+      math::RigidTransform<double>(Eigen::Vector3d(0, 0, -0.375)),
+      math::RigidTransform<double>(
+          math::RotationMatrix<double>::MakeYRotation(M_PI / 2),
+          Eigen::Vector3d(0.1, 0, -0.2)),
+      math::RigidTransform<double>(Eigen::Vector3d(0, 0.1, 0))};
+  const std::vector<const multibody::Body<double>*> bodies{&arm, &arm, &base};
+  const Eigen::Vector3d gravity = plant->gravity_field().gravity_vector();
+
+  const auto& dut = AccelerometerArray<double>::AddToDiagram(
+      {arm.index(), arm.index(), base.index()}, X_BS, gravity, *plant,
+      &builder);
+  EXPECT_EQ(dut.num_sensors(), 3);
+  EXPECT_EQ(dut.get_measurement_output_port().size(), 9);
+  std::vector<const Accelerometer<double>*> singles;
+  for (int i = 0; i < 3; ++i) {
+    singles.push_back(&Accelerometer<double>::AddToDiagram(
+        *bodies[i], X_BS[i], gravity, *plant, &builder));
+  }
+  auto diagram = builder.Build();
+
+  auto diagram_context = diagram->CreateDefaultContext();
+  auto& plant_context =
+      diagram->GetMutableSubsystemContext(*plant, diagram_context.get());
+  plant->get_actuation_input_port().FixValue(&plant_context, Vector1d(0.3));
+  plant->SetPositions(&plant_context, Vector1d(0.5));
+  plant->SetVelocities(&plant_context, Vector1d(-2));
+
+  const Eigen::VectorXd measurements =
+      dut.get_measurement_output_port().Eval(
+          diagram->GetSubsystemContext(dut, *diagram_context));
+  for (int i = 0; i < 3; ++i) {
+    const Eigen::VectorXd expected =
+        singles[i]->get_measurement_output_port().Eval(
+            diagram->GetSubsystemContext(*singles[i], *diagram_context));
+    EXPECT_TRUE(CompareMatrices(measurements.segment<3>(3 * i), expected,
+                                10 * std::numeric_limits<double>::epsilon()));
+  }
+
+  EXPECT_TRUE(is_autodiffxd_convertible(dut));
+  EXPECT_TRUE(is_symbolic_convertible(dut));
+}
+
+GTEST_TEST(AccelerometerArrayTest, MismatchedSizes) {
+  EXPECT_THROW(AccelerometerArray<double>({multibody::BodyIndex(1)}, {}),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace drake
@@ -1,7 +1,11 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <cstring>
+#include <vector>
+
 #include "robotlocomotion/image_array_t.hpp"
 #include <gtest/gtest.h>
+#include <zlib.h>
 
 #include "drake/systems/sensors/image.h"
 
@@ -113,6 +117,104 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          image_t::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+// Packs the images on several threads; the message must be the same as the one
+// packed sequentially, and must reflect the input images when it is
+// recalculated (reusing its buffers).
+GTEST_TEST(ImageToLcmImageArrayT, ThreadedPacking) {
+  ImageRgba8U color_image(kImageWidth, kImageHeight);
+  ImageDepth32F depth_image(kImageWidth, kImageHeight);
+  ImageLabel16I label_image(kImageWidth, kImageHeight);
+  for (int y = 0; y < kImageHeight; ++y) {
+    for (int x = 0; x < kImageWidth; ++x) {
+      for (int c = 0; c < ImageRgba8U::kNumChannels; ++c) {
+        color_image.at(x, y)[c] = x + 10 * y + c;
+      }
+      depth_image.at(x, y)[0] = 0.5f * x + y;
+      label_image.at(x, y)[0] = x - y;
+    }
+  }
+
+  // Extracts the (decompressed) pixel data of the image with the given pixel
+  // format.
+  auto get_data = [](const robotlocomotion::image_array_t& msg,
+                     int8_t pixel_format) {
+    for (const image_t& image : msg.images) {
+      if (image.pixel_format != pixel_format) continue;
+      if (image.compression_method ==
+          image_t::COMPRESSION_METHOD_NOT_COMPRESSED) {
+        return image.data;
+      }
+      std::vector<uint8_t> data(image.row_stride * image.height);
+      uLongf size = data.size();
+      EXPECT_EQ(uncompress(data.data(), &size, image.data.data(),
+                           image.data.size()),
+                Z_OK);
+      EXPECT_EQ(size, data.size());
+      return data;
+    }
+    ADD_FAILURE() << "No image with pixel format " << int{pixel_format};
+    return std::vector<uint8_t>();
+  };
+  auto expect_data = [&get_data](const robotlocomotion::image_array_t& msg,
+                                 int8_t pixel_format, const void* expected,
+                                 int size) {
+    const std::vector<uint8_t> data = get_data(msg, pixel_format);
+    ASSERT_EQ(static_cast<int>(data.size()), size);
+    EXPECT_EQ(std::memcmp(data.data(), expected, size), 0);
+  };
+
+  for (bool do_compress : {false, true}) {
+    ImageToLcmImageArrayT dut(kColorFrameName, kDepthFrameName,
+                              kLabelFrameName, do_compress);
+    EXPECT_EQ(dut.num_threads(), 1);
+    dut.set_num_threads(3);
+    EXPECT_EQ(dut.num_threads(), 3);
+    ImageToLcmImageArrayT sequential_dut(kColorFrameName, kDepthFrameName,
+                                         kLabelFrameName, do_compress);
+
+    const auto msg =
+        SetUpInputAndOutput(&dut, color_image, depth_image, label_image);
+    const auto sequential_msg = SetUpInputAndOutput(
+        &sequential_dut, color_image, depth_image, label_image);
+    ASSERT_EQ(msg.num_images, 3);
+    ASSERT_EQ(msg.images.size(), sequential_msg.images.size());
+    for (int i = 0; i < msg.num_images; ++i) {
+      EXPECT_EQ(msg.images[i].header.frame_name,
+                sequential_msg.images[i].header.frame_name);
+      EXPECT_EQ(msg.images[i].data, sequential_msg.images[i].data);
+    }
+    expect_data(msg, image_t::PIXEL_FORMAT_RGBA, color_image.at(0, 0),
+                color_image.size());
+    expect_data(msg, image_t::PIXEL_FORMAT_DEPTH, depth_image.at(0, 0),
+                depth_image.size() * sizeof(float));
+    expect_data(msg, image_t::PIXEL_FORMAT_LABEL, label_image.at(0, 0),
+                label_image.size() * sizeof(int16_t));
+
+    // Recalculating the message into the same storage.
+    std::unique_ptr<Context<double>> context = dut.CreateDefaultContext();
+    auto output = dut.image_array_t_msg_output_port().Allocate();
+    dut.color_image_input_port().FixValue(context.get(), color_image);
+    dut.depth_image_input_port().FixValue(context.get(), depth_image);
+    dut.label_image_input_port().FixValue(context.get(), label_image);
+    dut.image_array_t_msg_output_port().Calc(*context, output.get());
+    ImageLabel16I new_label_image(kImageWidth, kImageHeight, 7);
+    dut.label_image_input_port().FixValue(context.get(), new_label_image);
+    dut.image_array_t_msg_output_port().Calc(*context, output.get());
+    const auto& new_msg =
+        output->get_value<robotlocomotion::image_array_t>();
+    EXPECT_EQ(new_msg.num_images, 3);
+    EXPECT_EQ(new_msg.images.size(), 3);
+    expect_data(new_msg, image_t::PIXEL_FORMAT_RGBA, color_image.at(0, 0),
+                color_image.size());
+    expect_data(new_msg, image_t::PIXEL_FORMAT_LABEL,
+                new_label_image.at(0, 0),
+                new_label_image.size() * sizeof(int16_t));
+  }
+
+  ImageToLcmImageArrayT dut;
+  EXPECT_THROW(dut.set_num_threads(0), std::logic_error);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -5,6 +5,7 @@
 #include <fstream>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <vtkImageData.h>
@@ -17,6 +18,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/filesystem.h"
 #include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/systems/framework/event_collection.h"
 
@@ -699,6 +701,131 @@ TEST_F(ImageWriterTest, WritesGreyImage) {
   TestWritingImageOnPort<PixelType::kGrey8U>();
 }
 
+// Publishes `num_images` frames of the color test image, with the pixel
+// values of each frame varied to tell them apart, and returns the images in
+// publish order.
+std::vector<ImageRgba8U> PublishColorImages(const ImageWriter& writer,
+                                            const InputPort<double>& port,
+                                            int num_images) {
+  auto events = writer.AllocateCompositeEventCollection();
+  auto context = writer.AllocateContext();
+  std::vector<ImageRgba8U> images;
+  for (int i = 0; i < num_images; ++i) {
+    ImageRgba8U image = test_image<PixelType::kRgba8U>();
+    image.at(3, 0)[0] = static_cast<uint8_t>(i);
+    port.FixValue(context.get(), image);
+    context->SetTime(0.1 * i);
+    events->Clear();
+    writer.CalcNextUpdateTime(*context, events.get());
+    writer.Publish(*context, events->get_publish_events());
+    images.push_back(image);
+  }
+  return images;
+}
+
+// With asynchronous writes, the images are named in publish order and each
+// file holds the image published with that name, even though several workers
+// write them concurrently.
+TEST_F(ImageWriterTest, AsyncWritesBlock) {
+  ImageWriter writer;
+  ImageWriterTester tester(writer);
+  EXPECT_FALSE(writer.is_writing_async());
+  writer.EnableAsyncWrites(3, 2);
+  EXPECT_TRUE(writer.is_writing_async());
+
+  filesystem::path path(temp_dir());
+  path.append("async_block_{count:03}");
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      "async_block", path.string(), 0.1, 0.);
+
+  const int num_images = 20;
+  const std::vector<ImageRgba8U> images =
+      PublishColorImages(writer, port, num_images);
+  writer.WaitForPendingWrites();
+
+  const ImageWriter::AsyncWriteStats stats = writer.get_async_write_stats();
+  EXPECT_EQ(stats.num_queued, num_images);
+  EXPECT_EQ(stats.num_written, num_images);
+  EXPECT_EQ(stats.num_dropped, 0);
+  EXPECT_EQ(stats.queue_depth, 0);
+  EXPECT_GE(stats.max_queue_depth, 1);
+  EXPECT_LE(stats.max_queue_depth, 2);
+  EXPECT_EQ(tester.port_count(port.get_index()), num_images);
+
+  for (int i = 0; i < num_images; ++i) {
+    const std::string file_name =
+        tester.MakeFileName(tester.port_format(port.get_index()),
+                            PixelType::kRgba8U, 0.1 * i, "async_block", i);
+    add_file_for_cleanup(file_name);
+    EXPECT_TRUE(MatchesFileOnDisk(file_name, images[i]));
+  }
+}
+
+// With the drop policy, the images that find the queue full are not written
+// and do not use up a count, so that the written images are still numbered
+// consecutively. Which images are dropped depends on the timing of the
+// workers, so only the invariants are checked.
+TEST_F(ImageWriterTest, AsyncWritesDrop) {
+  ImageWriter writer;
+  ImageWriterTester tester(writer);
+  writer.EnableAsyncWrites(1, 1, ImageWriter::QueueFullPolicy::kDrop);
+
+  filesystem::path path(temp_dir());
+  path.append("async_drop_{count:03}");
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      "async_drop", path.string(), 0.1, 0.);
+
+  const int num_images = 50;
+  PublishColorImages(writer, port, num_images);
+  writer.WaitForPendingWrites();
+
+  const ImageWriter::AsyncWriteStats stats = writer.get_async_write_stats();
+  EXPECT_EQ(stats.num_queued + stats.num_dropped, num_images);
+  EXPECT_EQ(stats.num_written, stats.num_queued);
+  EXPECT_EQ(stats.max_queue_depth, 1);
+  EXPECT_EQ(tester.port_count(port.get_index()), stats.num_queued);
+
+  for (int i = 0; i < num_images; ++i) {
+    const std::string file_name =
+        tester.MakeFileName(tester.port_format(port.get_index()),
+                            PixelType::kRgba8U, 0., "async_drop", i);
+    add_file_for_cleanup(file_name);
+    EXPECT_EQ(filesystem::exists({file_name}), i < stats.num_queued);
+  }
+}
+
+// Pending writes are completed when the writer is destroyed.
+TEST_F(ImageWriterTest, AsyncWritesCompleteOnDestruction) {
+  filesystem::path path(temp_dir());
+  path.append("async_destroy_{count:03}");
+  std::string file_name;
+  {
+    ImageWriter writer;
+    ImageWriterTester tester(writer);
+    writer.EnableAsyncWrites(1, 4);
+    const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+        "async_destroy", path.string(), 0.1, 0.);
+    PublishColorImages(writer, port, 4);
+    file_name = tester.MakeFileName(tester.port_format(port.get_index()),
+                                    PixelType::kRgba8U, 0., "async_destroy",
+                                    3);
+  }
+  add_file_for_cleanup(file_name);
+  EXPECT_TRUE(filesystem::exists({file_name}));
+}
+
+TEST_F(ImageWriterTest, AsyncWritesErrors) {
+  ImageWriter writer;
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.EnableAsyncWrites(0, 1), std::logic_error,
+                              ".*number of writer threads must be positive");
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.EnableAsyncWrites(1, 0), std::logic_error,
+                              ".*maximum queue size must be positive");
+  EXPECT_FALSE(writer.is_writing_async());
+  // Synchronous writes have nothing to wait for, and no statistics.
+  DRAKE_EXPECT_NO_THROW(writer.WaitForPendingWrites());
+  EXPECT_EQ(writer.get_async_write_stats().num_queued, 0);
+}
+
 // Evaluate the stand-alone test for color images.
 TEST_F(ImageWriterTest, SaveToPng_Color) {
   ImageRgba8U color_image = test_image<PixelType::kRgba8U>();
@@ -0,0 +1,105 @@
+#include "drake/systems/sensors/render_thread_pool.h"
+
+#include <future>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/test_utilities/dummy_render_engine.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+using geometry::internal::DummyRenderEngine;
+
+// The engines are spread over the threads, and the renders of each engine all
+// run on its thread, in submission order.
+GTEST_TEST(RenderThreadPoolTest, EngineThreadAffinity) {
+  RenderThreadPool pool(2);
+  EXPECT_EQ(pool.num_threads(), 2);
+
+  DummyRenderEngine engine_a;
+  DummyRenderEngine engine_b;
+  EXPECT_EQ(pool.thread_index(&engine_a), -1);
+
+  const int num_renders = 20;
+  std::vector<int> order_a;
+  std::vector<int> order_b;
+  std::set<std::thread::id> threads_a;
+  std::set<std::thread::id> threads_b;
+  std::vector<std::future<void>> results;
+  for (int i = 0; i < num_renders; ++i) {
+    results.push_back(pool.Submit(&engine_a, [&order_a, &threads_a, i]() {
+      order_a.push_back(i);
+      threads_a.insert(std::this_thread::get_id());
+    }));
+    results.push_back(pool.Submit(&engine_b, [&order_b, &threads_b, i]() {
+      order_b.push_back(i);
+      threads_b.insert(std::this_thread::get_id());
+    }));
+  }
+  for (auto& result : results) result.get();
+
+  EXPECT_EQ(pool.thread_index(&engine_a), 0);
+  EXPECT_EQ(pool.thread_index(&engine_b), 1);
+  ASSERT_EQ(threads_a.size(), 1u);
+  ASSERT_EQ(threads_b.size(), 1u);
+  EXPECT_NE(*threads_a.begin(), *threads_b.begin());
+  EXPECT_NE(*threads_a.begin(), std::this_thread::get_id());
+  ASSERT_EQ(static_cast<int>(order_a.size()), num_renders);
+  ASSERT_EQ(static_cast<int>(order_b.size()), num_renders);
+  for (int i = 0; i < num_renders; ++i) {
+    EXPECT_EQ(order_a[i], i);
+    EXPECT_EQ(order_b[i], i);
+  }
+
+  // A third engine goes to one of the two threads, which now each have one.
+  DummyRenderEngine engine_c;
+  pool.Submit(&engine_c, []() {}).get();
+  EXPECT_NE(pool.thread_index(&engine_c), -1);
+}
+
+// The exception of a render is rethrown by its future, and the thread keeps
+// running the next renders.
+GTEST_TEST(RenderThreadPoolTest, Exceptions) {
+  RenderThreadPool pool(1);
+  DummyRenderEngine engine;
+  std::future<void> failure = pool.Submit(&engine, []() {
+    throw std::runtime_error("render failed");
+  });
+  bool ran = false;
+  std::future<void> success = pool.Submit(&engine, [&ran]() { ran = true; });
+  DRAKE_EXPECT_THROWS_MESSAGE(failure.get(), std::runtime_error,
+                              "render failed");
+  success.get();
+  EXPECT_TRUE(ran);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(pool.Submit(nullptr, []() {}), std::logic_error,
+                              ".*render engine is null");
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderThreadPool(0), std::logic_error,
+                              ".*number of threads must be positive; got 0");
+}
+
+// The pending renders are completed when the pool is destroyed.
+GTEST_TEST(RenderThreadPoolTest, CompletesOnDestruction) {
+  int num_ran = 0;
+  {
+    RenderThreadPool pool(1);
+    DummyRenderEngine engine;
+    for (int i = 0; i < 10; ++i) {
+      pool.Submit(&engine, [&num_ran]() { ++num_ran; });
+    }
+  }
+  EXPECT_EQ(num_ran, 10);
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
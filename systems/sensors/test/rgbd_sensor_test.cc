@@ -463,6 +463,61 @@ TEST_F(RgbdSensorTest, DepthImage32FTo16U) {
   }
 }
 
+// Confirms that, with caching enabled, each image is rendered once per context
+// and that the 16U depth image reuses the rendered 32F depth image.
+TEST_F(RgbdSensorTest, RenderOncePerContext) {
+  auto make_sensor = [this](SceneGraph<double>*) {
+    return make_unique<RgbdSensor>(SceneGraph<double>::world_frame_id(),
+                                   RigidTransformd::Identity(),
+                                   color_properties_, depth_properties_);
+  };
+  MakeCameraDiagram(make_sensor);
+  context_->EnableCaching();
+
+  sensor_->depth_image_32F_output_port().Eval<ImageDepth32F>(*sensor_context_);
+  sensor_->depth_image_16U_output_port().Eval<ImageDepth16U>(*sensor_context_);
+  sensor_->depth_image_16U_output_port().Eval<ImageDepth16U>(*sensor_context_);
+  EXPECT_EQ(render_engine_->num_simple_depth_renders(), 1);
+
+  sensor_->color_image_output_port().Eval<ImageRgba8U>(*sensor_context_);
+  sensor_->color_image_output_port().Eval<ImageRgba8U>(*sensor_context_);
+  EXPECT_EQ(render_engine_->num_simple_color_renders(), 1);
+
+  // A change to the context renders again.
+  context_->SetTime(1.0);
+  sensor_->depth_image_16U_output_port().Eval<ImageDepth16U>(*sensor_context_);
+  EXPECT_EQ(render_engine_->num_simple_depth_renders(), 2);
+}
+
+// Confirms that a sensor given a render thread pool renders its images on the
+// pool thread assigned to the render engine of its context.
+TEST_F(RgbdSensorTest, RenderThreadPool) {
+  auto make_sensor = [this](SceneGraph<double>*) {
+    return make_unique<RgbdSensor>(SceneGraph<double>::world_frame_id(),
+                                   RigidTransformd::Identity(),
+                                   color_properties_, depth_properties_);
+  };
+  MakeCameraDiagram(make_sensor);
+  EXPECT_EQ(sensor_->render_thread_pool(), nullptr);
+  auto pool = std::make_shared<RenderThreadPool>(2);
+  sensor_->set_render_thread_pool(pool);
+  EXPECT_EQ(sensor_->render_thread_pool(), pool);
+  EXPECT_EQ(pool->thread_index(render_engine_), -1);
+
+  sensor_->color_image_output_port().Eval<ImageRgba8U>(*sensor_context_);
+  sensor_->depth_image_32F_output_port().Eval<ImageDepth32F>(*sensor_context_);
+  sensor_->label_image_output_port().Eval<ImageLabel16I>(*sensor_context_);
+  EXPECT_EQ(render_engine_->num_simple_color_renders(), 1);
+  EXPECT_EQ(render_engine_->num_simple_depth_renders(), 1);
+  EXPECT_EQ(render_engine_->num_simple_label_renders(), 1);
+  EXPECT_EQ(pool->thread_index(render_engine_), 0);
+
+  // Without the pool, the images are rendered directly again.
+  sensor_->set_render_thread_pool(nullptr);
+  sensor_->color_image_output_port().Eval<ImageRgba8U>(*sensor_context_);
+  EXPECT_EQ(render_engine_->num_simple_color_renders(), 2);
+}
+
 // Tests that the discrete sensor is properly constructed.
 GTEST_TEST(RgbdSensorDiscrete, Construction) {
   DepthCameraProperties properties(640, 480, M_PI / 4, "render", 0.1, 10);
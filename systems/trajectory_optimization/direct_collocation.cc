@@ -23,21 +23,37 @@ DirectCollocationConstraint::DirectCollocationConstraint(
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     bool assume_non_continuous_states_are_fixed)
     : DirectCollocationConstraint(
-          system, context, context.num_continuous_states(),
+          system, nullptr, context, context.num_continuous_states(),
           system.get_input_port_selection(input_port_index)
               ? system.get_input_port_selection(input_port_index)->size()
               : 0,
           input_port_index, assume_non_continuous_states_are_fixed) {}
 
 DirectCollocationConstraint::DirectCollocationConstraint(
-    const System<double>& system, const Context<double>& context,
-    int num_states, int num_inputs,
+    const System<double>& system, const System<AutoDiffXd>& system_autodiff,
+    const Context<double>& context,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index,
+    bool assume_non_continuous_states_are_fixed)
+    : DirectCollocationConstraint(
+          system, &system_autodiff, context, context.num_continuous_states(),
+          system.get_input_port_selection(input_port_index)
+              ? system.get_input_port_selection(input_port_index)->size()
+              : 0,
+          input_port_index, assume_non_continuous_states_are_fixed) {}
+
+DirectCollocationConstraint::DirectCollocationConstraint(
+    const System<double>& system, const System<AutoDiffXd>* system_autodiff,
+    const Context<double>& context, int num_states, int num_inputs,
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     bool assume_non_continuous_states_are_fixed)
     : Constraint(num_states, 1 + (2 * num_states) + (2 * num_inputs),
                  Eigen::VectorXd::Zero(num_states),
                  Eigen::VectorXd::Zero(num_states)),
-      system_(System<double>::ToAutoDiffXd(system)),
+      owned_system_(system_autodiff == nullptr
+                        ? System<double>::ToAutoDiffXd(system)
+                        : nullptr),
+      system_(system_autodiff == nullptr ? owned_system_.get()
+                                         : system_autodiff),
       context_(system_->CreateDefaultContext()),
       input_port_(system_->get_input_port_selection(input_port_index)),
       // Don't allocate the input port value until we're past the point
@@ -81,6 +97,43 @@ void DirectCollocationConstraint::dynamics(const AutoDiffVecXd& state,
   *xdot = derivatives_->CopyToVector();
 }
 
+AutoDiffVecXd DirectCollocationConstraint::EvalDynamicsWithChainRule(
+    const AutoDiffVecXd& state, const AutoDiffVecXd& input,
+    bool use_knot_cache) const {
+  Eigen::VectorXd xu(num_states_ + num_inputs_);
+  xu << math::autoDiffToValueMatrix(state), math::autoDiffToValueMatrix(input);
+
+  const bool cache_hit = use_knot_cache && knot_cache_xu_.size() == xu.size() &&
+                         knot_cache_xu_ == xu;
+  Eigen::VectorXd xdot_value;
+  Eigen::MatrixXd dxdot_dxu;
+  if (cache_hit) {
+    xdot_value = knot_cache_xdot_;
+    dxdot_dxu = knot_cache_dxdot_;
+  } else {
+    // Differentiate with respect to the knot values only, which is usually
+    // far fewer derivatives than those of the constraint's own input.
+    const AutoDiffVecXd xu_autodiff = math::initializeAutoDiff(xu);
+    AutoDiffVecXd xdot;
+    dynamics(xu_autodiff.head(num_states_), xu_autodiff.tail(num_inputs_),
+             &xdot);
+    xdot_value = math::autoDiffToValueMatrix(xdot);
+    dxdot_dxu = math::autoDiffToGradientMatrix(xdot, xu.size());
+    if (use_knot_cache) {
+      knot_cache_xu_ = xu;
+      knot_cache_xdot_ = xdot_value;
+      knot_cache_dxdot_ = dxdot_dxu;
+    }
+  }
+
+  AutoDiffVecXd xu_with_derivatives(num_states_ + num_inputs_);
+  xu_with_derivatives << state, input;
+  const Eigen::MatrixXd dxu =
+      math::autoDiffToGradientMatrix(xu_with_derivatives);
+  return math::initializeAutoDiffGivenGradientMatrix(xdot_value,
+                                                     dxdot_dxu * dxu);
+}
+
 void DirectCollocationConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
   AutoDiffVecXd y_t;
@@ -105,23 +158,17 @@ void DirectCollocationConstraint::DoEval(
   const auto u0 = x.segment(1 + (2 * num_states_), num_inputs_);
   const auto u1 = x.segment(1 + (2 * num_states_) + num_inputs_, num_inputs_);
 
-  // TODO(sam.creasey): Use caching (when it arrives) to avoid recomputing
-  // the dynamics.  Currently the dynamics evaluated here as {u1,x1} are
-  // recomputed in the next constraint as {u0,x0}.
-  AutoDiffVecXd xdot0;
-  dynamics(x0, u0, &xdot0);
-  const Eigen::MatrixXd dxdot0 = math::autoDiffToGradientMatrix(xdot0);
-
-  AutoDiffVecXd xdot1;
-  dynamics(x1, u1, &xdot1);
-  const Eigen::MatrixXd dxdot1 = math::autoDiffToGradientMatrix(xdot1);
+  // The dynamics evaluated here at {x1, u1} are usually needed again by the
+  // next segment at {x0, u0}, so they are cached.
+  const AutoDiffVecXd xdot0 = EvalDynamicsWithChainRule(x0, u0, true);
+  const AutoDiffVecXd xdot1 = EvalDynamicsWithChainRule(x1, u1, true);
 
   // Cubic interpolation to get xcol and xdotcol.
   const AutoDiffVecXd xcol = 0.5 * (x0 + x1) + h / 8 * (xdot0 - xdot1);
   const AutoDiffVecXd xdotcol = -1.5 * (x0 - x1) / h - .25 * (xdot0 + xdot1);
 
-  AutoDiffVecXd g;
-  dynamics(xcol, 0.5 * (u0 + u1), &g);
+  const AutoDiffVecXd g =
+      EvalDynamicsWithChainRule(xcol, 0.5 * (u0 + u1), false);
   *y = xdotcol - g;
 }
 
@@ -154,6 +201,16 @@ DirectCollocation::DirectCollocation(
     int num_time_samples, double minimum_timestep, double maximum_timestep,
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     bool assume_non_continuous_states_are_fixed)
+    : DirectCollocation(system, nullptr, context, num_time_samples,
+                        minimum_timestep, maximum_timestep, input_port_index,
+                        assume_non_continuous_states_are_fixed) {}
+
+DirectCollocation::DirectCollocation(
+    const System<double>* system, const System<AutoDiffXd>* system_autodiff,
+    const Context<double>& context, int num_time_samples,
+    double minimum_timestep, double maximum_timestep,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index,
+    bool assume_non_continuous_states_are_fixed)
     : MultipleShooting(
           system->get_input_port_selection(input_port_index)
               ? system->get_input_port_selection(input_port_index)->size()
@@ -176,9 +233,14 @@ DirectCollocation::DirectCollocation(
   }
 
   // Add the dynamic constraints.
-  auto constraint = std::make_shared<DirectCollocationConstraint>(
-      *system, context, input_port_index,
-      assume_non_continuous_states_are_fixed);
+  auto constraint =
+      system_autodiff == nullptr
+          ? std::make_shared<DirectCollocationConstraint>(
+                *system, context, input_port_index,
+                assume_non_continuous_states_are_fixed)
+          : std::make_shared<DirectCollocationConstraint>(
+                *system, *system_autodiff, context, input_port_index,
+                assume_non_continuous_states_are_fixed);
 
   DRAKE_ASSERT(static_cast<int>(constraint->num_constraints()) == num_states());
 
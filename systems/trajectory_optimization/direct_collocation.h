@@ -59,6 +59,25 @@ class DirectCollocation : public MultipleShooting {
                     InputPortSelection::kUseFirstInputIfItExists,
                     bool assume_non_continuous_states_are_fixed = false);
 
+  /// Constructs the %MathematicalProgram% and adds the collocation constraints
+  /// exactly like the constructor above, but uses `system_autodiff` rather
+  /// than converting `system` to AutoDiffXd again. This is useful for building
+  /// several programs for the same system, since scalar conversion copies the
+  /// whole system.
+  ///
+  /// @param system_autodiff The result of System::ToAutoDiffXd() for @p
+  /// system, or nullptr to have it converted here. Note that this is aliased
+  /// for the lifetime of this object.
+  /// @see the constructor above for a description of the other parameters.
+  DirectCollocation(const System<double>* system,
+                    const System<AutoDiffXd>* system_autodiff,
+                    const Context<double>& context, int num_time_samples,
+                    double minimum_timestep, double maximum_timestep,
+                    std::variant<InputPortSelection, InputPortIndex>
+                        input_port_index =
+                    InputPortSelection::kUseFirstInputIfItExists,
+                    bool assume_non_continuous_states_are_fixed = false);
+
   // NOTE: The fixed timestep constructor, which would avoid adding h as
   // decision variables, has been removed since it complicates the API and code.
   // Unlike other trajectory optimization transcriptions, direct collocation
@@ -105,15 +124,28 @@ class DirectCollocationConstraint : public solvers::Constraint {
           InputPortSelection::kUseFirstInputIfItExists,
       bool assume_non_continuous_states_are_fixed = false);
 
+  /// Constructs the constraint like the constructor above, but uses
+  /// `system_autodiff`, the result of System::ToAutoDiffXd() for `system`,
+  /// rather than converting `system` again. `system_autodiff` is aliased for
+  /// the lifetime of this object; it may be shared among several constraints.
+  /// @see DirectCollocation constructor for a description of the parameters.
+  DirectCollocationConstraint(
+      const System<double>& system, const System<AutoDiffXd>& system_autodiff,
+      const Context<double>& context,
+      std::variant<InputPortSelection, InputPortIndex> input_port_index =
+          InputPortSelection::kUseFirstInputIfItExists,
+      bool assume_non_continuous_states_are_fixed = false);
+
   ~DirectCollocationConstraint() override = default;
 
   int num_states() const { return num_states_; }
   int num_inputs() const { return num_inputs_; }
 
  protected:
+  // Converts `system` to AutoDiffXd iff `system_autodiff` is nullptr.
   DirectCollocationConstraint(
-      const System<double>& system, const Context<double>& context,
-      int num_states, int num_inputs,
+      const System<double>& system, const System<AutoDiffXd>* system_autodiff,
+      const Context<double>& context, int num_states, int num_inputs,
       std::variant<InputPortSelection, InputPortIndex> input_port_index,
       bool assume_non_continuous_states_are_fixed);
 
@@ -131,7 +163,19 @@ class DirectCollocationConstraint : public solvers::Constraint {
   void dynamics(const AutoDiffVecXd& state, const AutoDiffVecXd& input,
                 AutoDiffVecXd* xdot) const;
 
-  const std::unique_ptr<System<AutoDiffXd>> system_;
+  // Computes the value of the dynamics at the values of `state` and `input`
+  // along with its gradient with respect to them, and then uses the chain rule
+  // to return xdot with the derivatives of `state` and `input`. When
+  // `use_knot_cache` is true, the result of the previous evaluation at a knot
+  // is reused if `state` and `input` have the same values, and the cache is
+  // updated otherwise.
+  AutoDiffVecXd EvalDynamicsWithChainRule(const AutoDiffVecXd& state,
+                                          const AutoDiffVecXd& input,
+                                          bool use_knot_cache) const;
+
+  // The AutoDiffXd system, which is owned only when it was converted here.
+  const std::unique_ptr<const System<AutoDiffXd>> owned_system_;
+  const System<AutoDiffXd>* const system_{nullptr};
   std::unique_ptr<Context<AutoDiffXd>> context_;
   const InputPort<AutoDiffXd>* input_port_{nullptr};
   FixedInputPortValue* input_port_value_{nullptr};
@@ -139,6 +183,15 @@ class DirectCollocationConstraint : public solvers::Constraint {
 
   const int num_states_{0};
   const int num_inputs_{0};
+
+  // Since the constraint is bound to every segment of the trajectory and
+  // solvers evaluate the segments in order, the dynamics at the end knot
+  // {x1, u1} of a segment are usually also needed at the start knot {x0, u0}
+  // of the next one. We keep the last knot evaluation: the knot's values
+  // [x; u], the dynamics value xdot and its gradient ∂xdot/∂[x; u].
+  mutable Eigen::VectorXd knot_cache_xu_;
+  mutable Eigen::VectorXd knot_cache_xdot_;
+  mutable Eigen::MatrixXd knot_cache_dxdot_;
 };
 
 // Note: The order of arguments is a compromise between GSG and the desire to
@@ -9,6 +9,8 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/examples/rimless_wheel/rimless_wheel.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/math/compute_numerical_gradient.h"
 #include "drake/multibody/benchmarks/pendulum/make_pendulum_plant.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/snopt_solver.h"
@@ -118,6 +120,35 @@ GTEST_TEST(DirectCollocationTest, TestCollocationConstraint) {
   }
 }
 
+// Checks that programs built from a shared AutoDiffXd conversion of the
+// system impose the same collocation constraints.
+GTEST_TEST(DirectCollocationTest, SharedAutoDiffSystem) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+  const std::unique_ptr<System<AutoDiffXd>> system_autodiff =
+      system->ToAutoDiffXd();
+
+  const int kNumSampleTimes = 3;
+  const double kTimeStep = .1;
+  const DirectCollocation expected_prog(system.get(), *context,
+                                        kNumSampleTimes, kTimeStep, kTimeStep);
+  const DirectCollocation prog1(system.get(), system_autodiff.get(), *context,
+                                kNumSampleTimes, kTimeStep, kTimeStep);
+  const DirectCollocation prog2(system.get(), system_autodiff.get(), *context,
+                                kNumSampleTimes, kTimeStep, kTimeStep);
+
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(9, 0.1, 0.9);
+  for (const DirectCollocation* prog : {&prog1, &prog2}) {
+    ASSERT_EQ(prog->generic_constraints().size(), kNumSampleTimes - 1);
+    for (int i = 0; i < kNumSampleTimes - 1; ++i) {
+      Eigen::VectorXd y, y_expected;
+      prog->generic_constraints()[i].evaluator()->Eval(x, &y);
+      expected_prog.generic_constraints()[i].evaluator()->Eval(x, &y_expected);
+      EXPECT_TRUE(CompareMatrices(y, y_expected));
+    }
+  }
+}
+
 // Checks the collocation constraint value against the interpolation used
 // in the reconstructed trajectories.  This confirms that the reconstruction
 // is using the same interpolation algorithms as the actual optimization.
@@ -344,6 +375,46 @@ GTEST_TEST(DirectCollocation, InputPortSelection) {
   EXPECT_TRUE(result.is_success());
 }
 
+// Checks that reusing the dynamics at the knot shared by two consecutive
+// segments gives the same values and gradients as evaluating them afresh, and
+// that the gradients are correct.
+GTEST_TEST(DirectCollocationTest, SharedKnotEvaluation) {
+  const auto plant = multibody::benchmarks::pendulum::MakePendulumPlant();
+  auto context = plant->CreateDefaultContext();
+  const InputPortIndex input_port_index =
+      plant->get_actuation_input_port().get_index();
+  const DirectCollocationConstraint constraint(*plant, *context,
+                                               input_port_index);
+  const DirectCollocationConstraint fresh_constraint(*plant, *context,
+                                                     input_port_index);
+
+  // The input is {h, x0, x1, u0, u1}; the second segment starts at the knot
+  // where the first one ends.
+  Eigen::VectorXd first(7), second(7);
+  first << 0.1, 0.2, -0.3, 0.4, 0.5, 1.2, -0.7;
+  second << 0.2, 0.4, 0.5, -0.1, 0.8, -0.7, 0.3;
+
+  AutoDiffVecXd y;
+  constraint.Eval(math::initializeAutoDiff(first), &y);
+  constraint.Eval(math::initializeAutoDiff(second), &y);
+  AutoDiffVecXd y_expected;
+  fresh_constraint.Eval(math::initializeAutoDiff(second), &y_expected);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y),
+                              math::autoDiffToValueMatrix(y_expected)));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y),
+                              math::autoDiffToGradientMatrix(y_expected)));
+
+  std::function<void(const Eigen::VectorXd&, Eigen::VectorXd*)> eval =
+      [&fresh_constraint](const Eigen::VectorXd& x, Eigen::VectorXd* y_x) {
+        fresh_constraint.Eval(x, y_x);
+      };
+  const Eigen::MatrixXd numerical_gradient = math::ComputeNumericalGradient(
+      eval, second,
+      math::NumericalGradientOption{math::NumericalGradientMethod::kCentral});
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y),
+                              numerical_gradient, 1e-7));
+}
+
 // The Rimless Wheel example has discrete state for book-keeping only.  The
 // following is a simple example of effectively simulating one "step" of the
 // wheel using direct collocation; this system was a motivating example for
@@ -0,0 +1,40 @@
+# -*- python -*-
+
+load("@drake//tools/workspace:os.bzl", "determine_os")
+
+def _impl(repository_ctx):
+    os_result = determine_os(repository_ctx)
+
+    if os_result.error != None:
+        fail(os_result.error)
+
+    if os_result.is_macos:
+        # On macOS, no targets should depend on @egl.
+        repository_ctx.symlink(
+            Label("@drake//tools/workspace/egl:package-macos.BUILD.bazel"),
+            "BUILD.bazel",
+        )
+    elif os_result.is_ubuntu:
+        hdrs = [
+            "EGL/egl.h",
+            "EGL/eglext.h",
+            "EGL/eglplatform.h",
+            "KHR/khrplatform.h",
+        ]
+        for hdr in hdrs:
+            repository_ctx.symlink(
+                "/usr/include/{}".format(hdr),
+                "include/{}".format(hdr),
+            )
+        repository_ctx.symlink(
+            Label("@drake//tools/workspace/egl:package-ubuntu.BUILD.bazel"),
+            "BUILD.bazel",
+        )
+    else:
+        fail("Operating system is NOT supported", attr = os_result)
+
+egl_repository = repository_rule(
+    local = True,
+    configure = True,
+    implementation = _impl,
+)